@@ -2995,6 +2995,10 @@ SOURCE=.\src\opt\dar\darMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\dar\darPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\dar\darPrec.c
 # End Source File
 # Begin Source File
@@ -3207,6 +3211,10 @@ SOURCE=.\src\opt\sfm\sfmNtk.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\sfm\sfmPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\sfm\sfmSat.c
 # End Source File
 # Begin Source File
@@ -3651,6 +3659,10 @@ SOURCE=.\src\map\amap\amapOutput.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\amap\amapPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\amap\amapParse.c
 # End Source File
 # Begin Source File
@@ -4155,6 +4167,10 @@ SOURCE=.\src\misc\util\utilNam.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilNpn.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilPth.c
 # End Source File
 # Begin Source File
@@ -4167,6 +4183,14 @@ SOURCE=.\src\misc\util\utilSignal.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilSimd.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilSimd.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSort.c
 # End Source File
 # Begin Source File
@@ -4935,6 +4959,14 @@ SOURCE=.\src\aig\gia\giaClp.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaCnfInc.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\aig\gia\giaCnfInc.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaCof.c
 # End Source File
 # Begin Source File
@@ -1631,6 +1631,7 @@ extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, i
 /*=== giaSimBase.c ============================================================*/
 extern Vec_Wrd_t *         Gia_ManSimPatSim( Gia_Man_t * p );
 extern Vec_Wrd_t *         Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts );
+extern Vec_Wrd_t *         Gia_ManSimPatSimOutTiled( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int nTileWords, int nProcs, int fVerbose );
 extern void                Gia_ManSim2ArrayOne( Vec_Wrd_t * vSimsPi, Vec_Int_t * vRes );
 extern Vec_Wec_t *         Gia_ManSim2Array( Vec_Ptr_t * vSims );
 extern Vec_Wrd_t *         Gia_ManArray2SimOne( Vec_Int_t * vRes );
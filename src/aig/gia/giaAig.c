@@ -599,6 +599,20 @@ Gia_Man_t * Gia_ManCompress2( Gia_Man_t * p, int fUpdateLevel, int fVerbose )
     Gia_ManTransferTiming( pGia, p );
     return pGia;
 }
+Gia_Man_t * Gia_ManCompress2Par( Gia_Man_t * p, int fUpdateLevel, int nSuppMax, int nProcs, int fVerbose )
+{
+    Gia_Man_t * pGia;
+    Aig_Man_t * pNew, * pTemp;
+    if ( p->pManTime && p->vLevels == NULL )
+        Gia_ManLevelWithBoxes( p );
+    pNew = Gia_ManToAig( p, 0 );
+    pNew = Dar_ManCompress2Par( pTemp = pNew, 1, fUpdateLevel, 1, 0, nSuppMax, nProcs, fVerbose );
+    Aig_ManStop( pTemp );
+    pGia = Gia_ManFromAig( pNew );
+    Aig_ManStop( pNew );
+    Gia_ManTransferTiming( pGia, p );
+    return pGia;
+}
 
 /**Function*************************************************************
 
@@ -118,43 +118,68 @@ void Gia_ManSimplifyAnd( Vec_Int_t * vSuper )
 
   Synopsis    [Collect multi-input AND/XOR.]
 
-  Description []
+  Description [The supergate is traversed using an explicit stack kept 
+  on top of p->vStore, which is restored before returning. The leaves 
+  are visited in the same order as in the depth-first recursion, while 
+  long chains of gates do not overflow the call stack.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManSuperCollectXor_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+static inline int Gia_ManSuperIsXorLeaf( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
 {
     assert( !Gia_IsComplement(pObj) );
-    if ( !Gia_ObjIsXor(pObj) ||     
+    return !Gia_ObjIsXor(pObj) ||     
         (fStrict && Gia_ObjRefNum(p, pObj) > 1) || 
         Gia_ObjRefNum(p, pObj) > 2 || 
         (Gia_ObjRefNum(p, pObj) == 2 && (Gia_ObjRefNum(p, Gia_ObjFanin0(pObj)) == 1 || Gia_ObjRefNum(p, Gia_ObjFanin1(pObj)) == 1)) || 
-        Vec_IntSize(p->vSuper) > 50 )
-    {
-        Vec_IntPush( p->vSuper, Gia_ObjToLit(p, pObj) );
-        return;
-    }
-    assert( !Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) );
-    Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin0(pObj), fStrict );
-    Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin1(pObj), fStrict );
+        Vec_IntSize(p->vSuper) > 50;
 }
-void Gia_ManSuperCollectAnd_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+static inline int Gia_ManSuperIsAndLeaf( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
 {
-    if ( Gia_IsComplement(pObj) || 
+    return Gia_IsComplement(pObj) || 
         !Gia_ObjIsAndReal(p, pObj) || 
         (fStrict && Gia_ObjRefNum(p, pObj) > 1) || 
         Gia_ObjRefNum(p, pObj) > 2 || 
         (Gia_ObjRefNum(p, pObj) == 2 && (Gia_ObjRefNum(p, Gia_ObjFanin0(pObj)) == 1 || Gia_ObjRefNum(p, Gia_ObjFanin1(pObj)) == 1)) || 
-        Vec_IntSize(p->vSuper) > 50 )
+        Vec_IntSize(p->vSuper) > 50;
+}
+void Gia_ManSuperCollectXor( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+{
+    int iStack = Vec_IntSize( p->vStore );
+    Vec_IntPush( p->vStore, Gia_ObjFaninId1p(p, pObj) );
+    Vec_IntPush( p->vStore, Gia_ObjFaninId0p(p, pObj) );
+    while ( Vec_IntSize(p->vStore) > iStack )
     {
-        Vec_IntPush( p->vSuper, Gia_ObjToLit(p, pObj) );
-        return;
+        pObj = Gia_ManObj( p, Vec_IntPop(p->vStore) );
+        if ( Gia_ManSuperIsXorLeaf(p, pObj, fStrict) )
+        {
+            Vec_IntPush( p->vSuper, Gia_ObjToLit(p, pObj) );
+            continue;
+        }
+        assert( !Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) );
+        Vec_IntPush( p->vStore, Gia_ObjFaninId1p(p, pObj) );
+        Vec_IntPush( p->vStore, Gia_ObjFaninId0p(p, pObj) );
+    }
+}
+void Gia_ManSuperCollectAnd( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+{
+    int iStack = Vec_IntSize( p->vStore );
+    Vec_IntPush( p->vStore, Gia_ObjToLit(p, Gia_ObjChild1(pObj)) );
+    Vec_IntPush( p->vStore, Gia_ObjToLit(p, Gia_ObjChild0(pObj)) );
+    while ( Vec_IntSize(p->vStore) > iStack )
+    {
+        pObj = Gia_ObjFromLit( p, Vec_IntPop(p->vStore) );
+        if ( Gia_ManSuperIsAndLeaf(p, pObj, fStrict) )
+        {
+            Vec_IntPush( p->vSuper, Gia_ObjToLit(p, pObj) );
+            continue;
+        }
+        Vec_IntPush( p->vStore, Gia_ObjToLit(p, Gia_ObjChild1(pObj)) );
+        Vec_IntPush( p->vStore, Gia_ObjToLit(p, Gia_ObjChild0(pObj)) );
     }
-    Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild0(pObj), fStrict );
-    Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild1(pObj), fStrict );
 }
 void Gia_ManSuperCollect( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
 {
@@ -163,11 +188,12 @@ void Gia_ManSuperCollect( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
         p->vSuper = Vec_IntAlloc( 1000 );
     else
         Vec_IntClear( p->vSuper );
+    if ( p->vStore == NULL )
+        p->vStore = Vec_IntAlloc( 1000 );
     if ( Gia_ObjIsXor(pObj) )
     {
         assert( !Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) );
-        Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin0(pObj), fStrict );
-        Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin1(pObj), fStrict );
+        Gia_ManSuperCollectXor( p, pObj, fStrict );
 //        nSize = Vec_IntSize(vSuper);
         Vec_IntSort( p->vSuper, 0 );
         Gia_ManSimplifyXor( p->vSuper );
@@ -176,8 +202,7 @@ void Gia_ManSuperCollect( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
     }
     else if ( Gia_ObjIsAndReal(p, pObj) )
     {
-        Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild0(pObj), fStrict );
-        Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild1(pObj), fStrict );
+        Gia_ManSuperCollectAnd( p, pObj, fStrict );
 //        nSize = Vec_IntSize(vSuper);
         Vec_IntSort( p->vSuper, 0 );
         Gia_ManSimplifyAnd( p->vSuper );
@@ -329,56 +354,80 @@ int Gia_ManBalanceGate( Gia_Man_t * pNew, Gia_Obj_t * pObj, Vec_Int_t * vSuper,
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Balances the logic cone of the node.]
 
-  Description []
+  Description [The cone is traversed without recursion. Each entry of 
+  vFrames stores the node ID, the first of its fanins in p->vStore, and 
+  the next fanin to be visited. For a MUX, the fanins are its three data 
+  inputs; otherwise they are the leaves of the supergate, which are 
+  overwritten by their new literals as soon as they are constructed.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManBalance_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+static inline void Gia_ManBalancePushFrame( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vFrames, int fStrict )
 {
-    int i, iLit, iBeg, iEnd;
-    if ( ~pObj->Value )
-        return;
     assert( Gia_ObjIsAnd(pObj) );
     assert( !Gia_ObjIsBuf(pObj) );
-    // handle MUX
     if ( Gia_ObjIsMux(p, pObj) )
     {
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict );
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin1(pObj), fStrict );
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin2(p, pObj), fStrict );
-        pObj->Value = Gia_ManHashMuxReal( pNew, Gia_ObjFanin2Copy(p, pObj), Gia_ObjFanin1Copy(pObj), Gia_ObjFanin0Copy(pObj) );
-        Gia_ObjSetGateLevel( pNew, Gia_ManObj(pNew, Abc_Lit2Var(pObj->Value)) );
+        Vec_IntPushTwo( vFrames, Gia_ObjId(p, pObj), Vec_IntSize(p->vStore) );
+        Vec_IntPush( vFrames, Vec_IntSize(p->vStore) );
+        Vec_IntPush( p->vStore, Abc_Var2Lit(Gia_ObjFaninId0p(p, pObj), 0) );
+        Vec_IntPush( p->vStore, Abc_Var2Lit(Gia_ObjFaninId1p(p, pObj), 0) );
+        Vec_IntPush( p->vStore, Abc_Var2Lit(Gia_ObjFaninId2p(p, pObj), 0) );
         return;
     }
     // find supergate
     Gia_ManSuperCollect( p, pObj, fStrict );
     // save entries
+    Vec_IntPushTwo( vFrames, Gia_ObjId(p, pObj), Vec_IntSize(p->vStore) );
+    Vec_IntPush( vFrames, Vec_IntSize(p->vStore) );
+    Vec_IntAppend( p->vStore, p->vSuper );
+}
+void Gia_ManBalanceNode( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pRoot, Vec_Int_t * vFrames, int fStrict )
+{
+    if ( ~pRoot->Value )
+        return;
     if ( p->vStore == NULL )
         p->vStore = Vec_IntAlloc( 1000 );
-    iBeg = Vec_IntSize( p->vStore );
-    Vec_IntAppend( p->vStore, p->vSuper );
-    iEnd = Vec_IntSize( p->vStore );
-    // call recursively
-    Vec_IntForEachEntryStartStop( p->vStore, iLit, i, iBeg, iEnd )
+    Vec_IntClear( vFrames );
+    Gia_ManBalancePushFrame( p, pRoot, vFrames, fStrict );
+    while ( Vec_IntSize(vFrames) > 0 )
     {
-        Gia_Obj_t * pTemp = Gia_ManObj( p, Abc_Lit2Var(iLit) );
-        Gia_ManBalance_rec( pNew, p, pTemp, fStrict );
-        Vec_IntWriteEntry( p->vStore, i, Abc_LitNotCond(pTemp->Value, Abc_LitIsCompl(iLit)) );
+        int * pFrame = Vec_IntLimit(vFrames) - 3;
+        Gia_Obj_t * pObj = Gia_ManObj( p, pFrame[0] );
+        int iBeg = pFrame[1], iEnd = Vec_IntSize(p->vStore);
+        // visit the next fanin
+        if ( pFrame[2] < iEnd )
+        {
+            int iLit = Vec_IntEntry( p->vStore, pFrame[2] );
+            Gia_Obj_t * pTemp = Gia_ManObj( p, Abc_Lit2Var(iLit) );
+            if ( ~pTemp->Value )
+                Vec_IntWriteEntry( p->vStore, pFrame[2]++, Abc_LitNotCond(pTemp->Value, Abc_LitIsCompl(iLit)) );
+            else
+                Gia_ManBalancePushFrame( p, pTemp, vFrames, fStrict );
+            continue;
+        }
+        // handle MUX
+        if ( Gia_ObjIsMux(p, pObj) )
+        {
+            pObj->Value = Gia_ManHashMuxReal( pNew, Gia_ObjFanin2Copy(p, pObj), Gia_ObjFanin1Copy(pObj), Gia_ObjFanin0Copy(pObj) );
+            Gia_ObjSetGateLevel( pNew, Gia_ManObj(pNew, Abc_Lit2Var(pObj->Value)) );
+        }
+        else // consider general case
+            pObj->Value = Gia_ManBalanceGate( pNew, pObj, p->vSuper, Vec_IntEntryP(p->vStore, iBeg), iEnd-iBeg );
+        Vec_IntShrink( p->vStore, iBeg );
+        Vec_IntShrink( vFrames, Vec_IntSize(vFrames) - 3 );
     }
-    assert( Vec_IntSize(p->vStore) == iEnd );
-    // consider general case
-    pObj->Value = Gia_ManBalanceGate( pNew, pObj, p->vSuper, Vec_IntEntryP(p->vStore, iBeg), iEnd-iBeg );
-    Vec_IntShrink( p->vStore, iBeg );
 }
 Gia_Man_t * Gia_ManBalanceInt( Gia_Man_t * p, int fStrict )
 {
     Gia_Man_t * pNew, * pTemp;
     Gia_Obj_t * pObj;
+    Vec_Int_t * vFrames = Vec_IntAlloc( 1000 );
     int i;
     Gia_ManFillValue( p );
     Gia_ManCreateRefs( p ); 
@@ -409,15 +458,16 @@ Gia_Man_t * Gia_ManBalanceInt( Gia_Man_t * p, int fStrict )
     Gia_ManHashStart( pNew );
     Gia_ManForEachBuf( p, pObj, i )
     {
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict );
+        Gia_ManBalanceNode( pNew, p, Gia_ObjFanin0(pObj), vFrames, fStrict );
         pObj->Value = Gia_ManAppendBuf( pNew, Gia_ObjFanin0Copy(pObj) );
         Gia_ObjSetGateLevel( pNew, Gia_ManObj(pNew, Abc_Lit2Var(pObj->Value)) );
     }
     Gia_ManForEachCo( p, pObj, i )
     {
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict );
+        Gia_ManBalanceNode( pNew, p, Gia_ObjFanin0(pObj), vFrames, fStrict );
         pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
     }
+    Vec_IntFree( vFrames );
     assert( !fStrict || Gia_ManObjNum(pNew) <= Gia_ManObjNum(p) );
     Gia_ManHashStop( pNew );
     Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
@@ -506,47 +556,55 @@ void Dam_ManFree( Dam_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-void Dam_ManCollectSets_rec( Dam_Man_t * p, int Id )
+void Dam_ManCollectSetsCone( Dam_Man_t * p, int Id, Vec_Int_t * vStack )
 {
     Gia_Obj_t * pObj;
-    int i, iBeg, iEnd, iLit;
-    if ( Dam_ObjHand(p, Id) || Id == 0 )
-        return;
-    pObj = Gia_ManObj(p->pGia, Id);
-    if ( Gia_ObjIsCi(pObj) )
-        return;
-    if ( Gia_ObjIsBuf(pObj) )
+    int i, iBeg, iEnd;
+    // the nodes are visited in the depth-first order using explicit stack
+    Vec_IntClear( vStack );
+    Vec_IntPush( vStack, Id );
+    while ( Vec_IntSize(vStack) > 0 )
     {
-        Dam_ManCollectSets_rec( p, Gia_ObjFaninId0(pObj, Id) );
-        return;
-    }
-    if ( Gia_ObjIsMux(p->pGia, pObj) )
-    {
-        if ( pObj->fMark0 )
-            return;
-        pObj->fMark0 = 1;
-        Vec_IntPush( p->vVisit, Id );
-        Dam_ManCollectSets_rec( p, Gia_ObjFaninId0(pObj, Id) );
-        Dam_ManCollectSets_rec( p, Gia_ObjFaninId1(pObj, Id) );
-        Dam_ManCollectSets_rec( p, Gia_ObjFaninId2(p->pGia, Id) );
-        p->nAnds += 3;
-        return;
+        Id = Vec_IntPop( vStack );
+        if ( Dam_ObjHand(p, Id) || Id == 0 )
+            continue;
+        pObj = Gia_ManObj(p->pGia, Id);
+        if ( Gia_ObjIsCi(pObj) )
+            continue;
+        if ( Gia_ObjIsBuf(pObj) )
+        {
+            Vec_IntPush( vStack, Gia_ObjFaninId0(pObj, Id) );
+            continue;
+        }
+        if ( Gia_ObjIsMux(p->pGia, pObj) )
+        {
+            if ( pObj->fMark0 )
+                continue;
+            pObj->fMark0 = 1;
+            Vec_IntPush( p->vVisit, Id );
+            Vec_IntPush( vStack, Gia_ObjFaninId2(p->pGia, Id) );
+            Vec_IntPush( vStack, Gia_ObjFaninId1(pObj, Id) );
+            Vec_IntPush( vStack, Gia_ObjFaninId0(pObj, Id) );
+            p->nAnds += 3;
+            continue;
+        }
+        Gia_ManSuperCollect( p->pGia, pObj, 0 );
+        Vec_IntWriteEntry( p->vNod2Set, Id, Vec_IntSize(p->vSetStore) );
+        Vec_IntPush( p->vSetStore, Vec_IntSize(p->pGia->vSuper) );
+        p->nAnds += (1 + 2 * Gia_ObjIsXor(pObj)) * (Vec_IntSize(p->pGia->vSuper) - 1);
+        // save entries
+        iBeg = Vec_IntSize( p->vSetStore );
+        Vec_IntAppend( p->vSetStore, p->pGia->vSuper );
+        iEnd = Vec_IntSize( p->vSetStore );
+        // visit the leaves in the direct order
+        for ( i = iEnd - 1; i >= iBeg; i-- )
+            Vec_IntPush( vStack, Abc_Lit2Var(Vec_IntEntry(p->vSetStore, i)) );
     }
-    Gia_ManSuperCollect( p->pGia, pObj, 0 );
-    Vec_IntWriteEntry( p->vNod2Set, Id, Vec_IntSize(p->vSetStore) );
-    Vec_IntPush( p->vSetStore, Vec_IntSize(p->pGia->vSuper) );
-    p->nAnds += (1 + 2 * Gia_ObjIsXor(pObj)) * (Vec_IntSize(p->pGia->vSuper) - 1);
-    // save entries
-    iBeg = Vec_IntSize( p->vSetStore );
-    Vec_IntAppend( p->vSetStore, p->pGia->vSuper );
-    iEnd = Vec_IntSize( p->vSetStore );
-    // call recursively
-    Vec_IntForEachEntryStartStop( p->vSetStore, iLit, i, iBeg, iEnd )
-        Dam_ManCollectSets_rec( p, Abc_Lit2Var(iLit) );
 }
 void Dam_ManCollectSets( Dam_Man_t * p )
 {
     Gia_Obj_t * pObj;
+    Vec_Int_t * vStack = Vec_IntAlloc( 1000 );
     int i;
     Gia_ManCreateRefs( p->pGia );
     p->vNod2Set  = Vec_IntStart( Gia_ManObjNum(p->pGia) );
@@ -554,7 +612,8 @@ void Dam_ManCollectSets( Dam_Man_t * p )
     Vec_IntPush( p->vSetStore, -1 );
     Vec_IntClear( p->vVisit );
     Gia_ManForEachCo( p->pGia, pObj, i )
-        Dam_ManCollectSets_rec( p, Gia_ObjFaninId0p(p->pGia, pObj) );
+        Dam_ManCollectSetsCone( p, Gia_ObjFaninId0p(p->pGia, pObj), vStack );
+    Vec_IntFree( vStack );
     ABC_FREE( p->pGia->pRefs );
     Gia_ManForEachObjVec( p->vVisit, p->pGia, pObj, i )
         pObj->fMark0 = 0;
@@ -750,45 +809,60 @@ void Dam_ManCreatePairs( Dam_Man_t * p, int fVerbose )
   SeeAlso     []
 
 ***********************************************************************/
-void Dam_ManMultiAig_rec( Dam_Man_t * pMan, Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
+void Dam_ManMultiAigNode( Dam_Man_t * pMan, Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pRoot, Vec_Int_t * vFrames )
 {
-    int i, * pSet;
-    if ( ~pObj->Value )
+    if ( ~pRoot->Value )
         return;
-    assert( Gia_ObjIsAnd(pObj) );
-    pSet = Dam_ObjSet(pMan, Gia_ObjId(p, pObj));
-    if ( pSet == NULL )
+    // each frame stores the node ID and the next fanin to be visited
+    Vec_IntClear( vFrames );
+    Vec_IntPushTwo( vFrames, Gia_ObjId(p, pRoot), 0 );
+    while ( Vec_IntSize(vFrames) > 0 )
     {
-        Dam_ManMultiAig_rec( pMan, pNew, p, Gia_ObjFanin0(pObj) );
-        Dam_ManMultiAig_rec( pMan, pNew, p, Gia_ObjFanin1(pObj) );
-        if ( Gia_ObjIsMux(p, pObj) )
+        int * pFrame = Vec_IntLimit(vFrames) - 2;
+        Gia_Obj_t * pObj = Gia_ManObj( p, pFrame[0] ), * pTemp;
+        int * pSet = Dam_ObjSet( pMan, pFrame[0] );
+        int nFanins = pSet ? pSet[0] : 2 + Gia_ObjIsMux(p, pObj);
+        assert( Gia_ObjIsAnd(pObj) );
+        // visit the next fanin
+        if ( pFrame[1] < nFanins )
         {
-            Dam_ManMultiAig_rec( pMan, pNew, p, Gia_ObjFanin2(p, pObj) );
-            pObj->Value = Gia_ManHashMuxReal( pNew, Gia_ObjFanin2Copy(p, pObj), Gia_ObjFanin1Copy(pObj), Gia_ObjFanin0Copy(pObj) );
+            if ( pSet )
+                pTemp = Gia_ManObj( p, Abc_Lit2Var(pSet[pFrame[1]+1]) );
+            else
+                pTemp = pFrame[1] == 0 ? Gia_ObjFanin0(pObj) : pFrame[1] == 1 ? Gia_ObjFanin1(pObj) : Gia_ObjFanin2(p, pObj);
+            if ( !~pTemp->Value )
+            {
+                Vec_IntPushTwo( vFrames, Gia_ObjId(p, pTemp), 0 );
+                continue;
+            }
+            if ( pSet )
+                pSet[pFrame[1]+1] = Abc_LitNotCond( pTemp->Value, Abc_LitIsCompl(pSet[pFrame[1]+1]) );
+            pFrame[1]++;
+            continue;
         }
-        else if ( Gia_ObjIsXor(pObj) )
-            pObj->Value = Gia_ManHashXorReal( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
-        else 
-            pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
-        Gia_ObjSetGateLevel( pNew, Gia_ManObj(pNew, Abc_Lit2Var(pObj->Value)) );
-        return;
-    }
-    assert( Gia_ObjIsXor(pObj) || Gia_ObjIsAndReal(p, pObj) );
-    // call recursively
-    for ( i = 1; i <= pSet[0]; i++ )
-    {
-        Gia_Obj_t * pTemp = Gia_ManObj( p, Abc_Lit2Var(pSet[i]) );
-        Dam_ManMultiAig_rec( pMan, pNew, p, pTemp );
-        pSet[i] = Abc_LitNotCond( pTemp->Value, Abc_LitIsCompl(pSet[i]) );
+        Vec_IntShrink( vFrames, Vec_IntSize(vFrames) - 2 );
+        if ( pSet == NULL )
+        {
+            if ( Gia_ObjIsMux(p, pObj) )
+                pObj->Value = Gia_ManHashMuxReal( pNew, Gia_ObjFanin2Copy(p, pObj), Gia_ObjFanin1Copy(pObj), Gia_ObjFanin0Copy(pObj) );
+            else if ( Gia_ObjIsXor(pObj) )
+                pObj->Value = Gia_ManHashXorReal( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+            else 
+                pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+            Gia_ObjSetGateLevel( pNew, Gia_ManObj(pNew, Abc_Lit2Var(pObj->Value)) );
+            continue;
+        }
+        assert( Gia_ObjIsXor(pObj) || Gia_ObjIsAndReal(p, pObj) );
+        // create balanced gate
+        pObj->Value = Gia_ManBalanceGate( pNew, pObj, p->vSuper, pSet + 1, pSet[0] );
     }
-    // create balanced gate
-    pObj->Value = Gia_ManBalanceGate( pNew, pObj, p->vSuper, pSet + 1, pSet[0] );
 }
 Gia_Man_t * Dam_ManMultiAig( Dam_Man_t * pMan )
 {
     Gia_Man_t * p = pMan->pGia;
     Gia_Man_t * pNew, * pTemp;
     Gia_Obj_t * pObj;
+    Vec_Int_t * vFrames = Vec_IntAlloc( 1000 );
     int i;
     // start the new manager
     pNew = Gia_ManStart( 2*Gia_ManObjNum(p) );
@@ -808,15 +882,16 @@ Gia_Man_t * Dam_ManMultiAig( Dam_Man_t * pMan )
     Gia_ManHashStart( pNew );
     Gia_ManForEachBuf( p, pObj, i )
     {
-        Dam_ManMultiAig_rec( pMan, pNew, p, Gia_ObjFanin0(pObj) );
+        Dam_ManMultiAigNode( pMan, pNew, p, Gia_ObjFanin0(pObj), vFrames );
         pObj->Value = Gia_ManAppendBuf( pNew, Gia_ObjFanin0Copy(pObj) );
         Gia_ObjSetGateLevel( pNew, Gia_ManObj(pNew, Abc_Lit2Var(pObj->Value)) );
     }
     Gia_ManForEachCo( p, pObj, i )
     {
-        Dam_ManMultiAig_rec( pMan, pNew, p, Gia_ObjFanin0(pObj) );
+        Dam_ManMultiAigNode( pMan, pNew, p, Gia_ObjFanin0(pObj), vFrames );
         pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
     }
+    Vec_IntFree( vFrames );
 //    assert( Gia_ManObjNum(pNew) <= Gia_ManObjNum(p) );
     Gia_ManHashStop( pNew );
     Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
@@ -1060,6 +1135,8 @@ Gia_Man_t * Gia_ManAreaBalance( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax,
     else if ( p->vInArrs )
     {
         int i, Id, And2Delay = p->And2Delay ? p->And2Delay : 1;
+        Vec_IntFreeP( &p->vLevels );
+        p->vLevels = Vec_IntStart( Gia_ManObjNum(p) );
         Gia_ManForEachCiId( p, Id, i )
             Vec_IntWriteEntry( p->vLevels, Id, (int)(Vec_FltEntry(p->vInArrs, i)/And2Delay) );
     }
@@ -0,0 +1,427 @@
+/**CFile****************************************************************
+
+  FileName    [giaCnfInc.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Incremental CNF loader independent of the SAT solver.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    [$Id: giaCnfInc.c,v 1.00 2026/10/16 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "giaCnfInc.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose2/AbcGlucose2.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Interfaces to the SAT solvers.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_CnfIncBsatAddVar( void * pSat )                                { return sat_solver_addvar( (sat_solver *)pSat );                            }
+static int Gia_CnfIncBsatVarNum( void * pSat )                                { return sat_solver_nvars( (sat_solver *)pSat );                             }
+static int Gia_CnfIncBsatAddClause( void * pSat, int * pLits, int nLits )     { return sat_solver_addclause( (sat_solver *)pSat, pLits, pLits + nLits );   }
+static int Gia_CnfIncSatokoAddVar( void * pSat )                              { return satoko_add_variable( (satoko_t *)pSat, 0 );                         }
+static int Gia_CnfIncSatokoVarNum( void * pSat )                              { return satoko_varnum( (satoko_t *)pSat );                                  }
+static int Gia_CnfIncSatokoAddClause( void * pSat, int * pLits, int nLits )   { return satoko_add_clause( (satoko_t *)pSat, pLits, nLits ) == SATOKO_OK;   }
+static int Gia_CnfIncGlucose2AddVar( void * pSat )                            { return bmcg2_sat_solver_addvar( (bmcg2_sat_solver *)pSat );                }
+static int Gia_CnfIncGlucose2VarNum( void * pSat )                            { return bmcg2_sat_solver_varnum( (bmcg2_sat_solver *)pSat );                }
+static int Gia_CnfIncGlucose2AddClause( void * pSat, int * pLits, int nLits ) { return bmcg2_sat_solver_addclause( (bmcg2_sat_solver *)pSat, pLits, nLits ); }
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the loader.]
+
+  Description [If fRecord is set, the clauses are also saved, so that
+  they can be loaded into another solver without re-encoding the AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_CnfInc_t * Gia_CnfIncStart( Gia_Man_t * pGia, int fRecord )
+{
+    Gia_CnfInc_t * p = ABC_CALLOC( Gia_CnfInc_t, 1 );
+    p->pGia     = pGia;
+    p->vObj2Var = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    p->vVar2Obj = Vec_IntAlloc( 1000 );
+    p->vCis     = Vec_IntAlloc( 100 );
+    p->vStack   = Vec_IntAlloc( 100 );
+    p->vLits    = Vec_IntAlloc( 10 );
+    p->vClauses = fRecord ? Vec_IntAlloc( 1000 ) : NULL;
+    return p;
+}
+void Gia_CnfIncStop( Gia_CnfInc_t * p )
+{
+    Vec_IntFree( p->vObj2Var );
+    Vec_IntFree( p->vVar2Obj );
+    Vec_IntFree( p->vCis );
+    Vec_IntFree( p->vStack );
+    Vec_IntFree( p->vLits );
+    Vec_IntFreeP( &p->vClauses );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads pre-encoded clauses into the solver.]
+
+  Description [The clauses are stored as (nLits, Lit0, Lit1, ...).
+  Variables are added to the solver until it has at least nVars of them,
+  so the solver does not have to be empty. Returns 0 if the solver
+  became UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_CnfIncImport( void * pSat, Gia_CnfIncAddVar_f pFuncAddVar, Gia_CnfIncVarNum_f pFuncVarNum, Gia_CnfIncAddClause_f pFuncAddClause, Vec_Int_t * vClauses, int nVars )
+{
+    Vec_Int_t * vLits = Vec_IntAlloc( 10 );
+    int i, k, nLits, RetValue = 1;
+    for ( k = pFuncVarNum(pSat); k < nVars; k++ )
+        pFuncAddVar( pSat );
+    for ( i = 0; i < Vec_IntSize(vClauses); i += nLits + 1 )
+    {
+        nLits = Vec_IntEntry( vClauses, i );
+        // the solvers may reorder the literals, so the buffer is copied
+        Vec_IntClear( vLits );
+        for ( k = 0; k < nLits; k++ )
+            Vec_IntPush( vLits, Vec_IntEntry(vClauses, i + 1 + k) );
+        if ( !pFuncAddClause(pSat, Vec_IntArray(vLits), nLits) )
+            RetValue = 0;
+    }
+    Vec_IntFree( vLits );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Forgets the variables of the loaded objects.]
+
+  Description [The runtime is proportional to the number of objects
+  loaded since the last reset, rather than to the size of the AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CnfIncReset( Gia_CnfInc_t * p )
+{
+    int iVar, iObj;
+    Vec_IntForEachEntry( p->vVar2Obj, iObj, iVar )
+        if ( iObj >= 0 )
+            Vec_IntWriteEntry( p->vObj2Var, iObj, -1 );
+    Vec_IntClear( p->vVar2Obj );
+    Vec_IntClear( p->vCis );
+    if ( p->vClauses )
+        Vec_IntClear( p->vClauses );
+    p->nVars = p->nClauses = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the current SAT solver.]
+
+  Description [If fReload is set, the clauses recorded so far are loaded
+  into the new solver, and the CNF variables of the AIG nodes remain valid.
+  Otherwise, the mapping of AIG nodes into variables is reset. Returns 0
+  if the new solver became UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_CnfIncSetSolver( Gia_CnfInc_t * p, void * pSat, Gia_CnfIncAddVar_f pFuncAddVar, Gia_CnfIncVarNum_f pFuncVarNum, Gia_CnfIncAddClause_f pFuncAddClause, int fReload )
+{
+    p->pSat           = pSat;
+    p->pFuncAddVar    = pFuncAddVar;
+    p->pFuncVarNum    = pFuncVarNum;
+    p->pFuncAddClause = pFuncAddClause;
+    p->fUnsat         = 0;
+    if ( fReload && p->nVars > 0 )
+    {
+        assert( p->vClauses != NULL );
+        p->fUnsat = !Gia_CnfIncImport( pSat, pFuncAddVar, pFuncVarNum, pFuncAddClause, p->vClauses, p->nVars );
+        return !p->fUnsat;
+    }
+    Gia_CnfIncReset( p );
+    return 1;
+}
+int Gia_CnfIncSetBsat( Gia_CnfInc_t * p, void * pSat, int fReload )
+{
+    return Gia_CnfIncSetSolver( p, pSat, Gia_CnfIncBsatAddVar, Gia_CnfIncBsatVarNum, Gia_CnfIncBsatAddClause, fReload );
+}
+int Gia_CnfIncSetSatoko( Gia_CnfInc_t * p, void * pSat, int fReload )
+{
+    return Gia_CnfIncSetSolver( p, pSat, Gia_CnfIncSatokoAddVar, Gia_CnfIncSatokoVarNum, Gia_CnfIncSatokoAddClause, fReload );
+}
+int Gia_CnfIncSetGlucose2( Gia_CnfInc_t * p, void * pSat, int fReload )
+{
+    return Gia_CnfIncSetSolver( p, pSat, Gia_CnfIncGlucose2AddVar, Gia_CnfIncGlucose2VarNum, Gia_CnfIncGlucose2AddClause, fReload );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Passes the gates of the loaded nodes to the solver.]
+
+  Description [Solvers using circuit-based decision heuristics (such as
+  glucose2 with JFTR) can be given the fanin literals of each AND and XOR
+  node. The two literals are passed in the order of the AIG fanins. If
+  fGatesOnly is set, the clauses of these nodes are not added, because
+  the solver derives them from the gates. MUX nodes are always loaded
+  as clauses. The recorded clauses do not include the gates, so fGatesOnly
+  cannot be used when the clauses are recorded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CnfIncSetGates( Gia_CnfInc_t * p, Gia_CnfIncAddGate_f pFuncAddGate, int fGatesOnly )
+{
+    assert( pFuncAddGate != NULL || !fGatesOnly );
+    assert( p->vClauses == NULL || !fGatesOnly );
+    p->pFuncAddGate = pFuncAddGate;
+    p->fGatesOnly   = fGatesOnly;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one clause.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_CnfIncAddClause( Gia_CnfInc_t * p, int Lit0, int Lit1, int Lit2 )
+{
+    Vec_IntClear( p->vLits );
+    Vec_IntPush( p->vLits, Lit0 );
+    if ( Lit1 >= 0 )
+        Vec_IntPush( p->vLits, Lit1 );
+    if ( Lit2 >= 0 )
+        Vec_IntPush( p->vLits, Lit2 );
+    if ( p->vClauses )
+    {
+        Vec_IntPush( p->vClauses, Vec_IntSize(p->vLits) );
+        Vec_IntAppend( p->vClauses, p->vLits );
+    }
+    if ( !p->pFuncAddClause(p->pSat, Vec_IntArray(p->vLits), Vec_IntSize(p->vLits)) )
+        p->fUnsat = 1;
+    p->nClauses++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the fanin literals of the node.]
+
+  Description [Returns the number of fanins (0 for constants and CIs,
+  3 for MUXes and 2 otherwise) and sets *pfXor for XOR gates. In an AIG
+  without XOR nodes, the XOR of two nodes is recognized structurally and
+  loaded as one gate, which skips the two internal AND nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_CnfIncObjFanins( Gia_CnfInc_t * p, int iObj, int * pFanins, int * pfXor )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj ), * pFan0, * pFan1;
+    *pfXor = 0;
+    if ( !Gia_ObjIsAnd(pObj) )
+        return 0;
+    if ( Gia_ObjIsMux(p->pGia, pObj) )
+    {
+        // f = c ? t : e
+        pFanins[0] = Gia_ObjFaninLit2( p->pGia, iObj );
+        pFanins[1] = Gia_ObjFaninLit1( pObj, iObj );
+        pFanins[2] = Gia_ObjFaninLit0( pObj, iObj );
+        return 3;
+    }
+    if ( p->pGia->pMuxes == NULL && Gia_ObjRecognizeExor(pObj, &pFan0, &pFan1) && Gia_IsComplement(pFan0) == Gia_IsComplement(pFan1) )
+    {
+        pFanins[0] = Abc_Var2Lit( Gia_ObjId(p->pGia, Gia_Regular(pFan0)), 0 );
+        pFanins[1] = Abc_Var2Lit( Gia_ObjId(p->pGia, Gia_Regular(pFan1)), 0 );
+        *pfXor = 1;
+        return 2;
+    }
+    pFanins[0] = Gia_ObjFaninLit0( pObj, iObj );
+    pFanins[1] = Gia_ObjFaninLit1( pObj, iObj );
+    *pfXor = Gia_ObjIsXor( pObj );
+    return 2;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds clauses for one node whose fanins are loaded.]
+
+  Description [The clauses of AND and XOR gates are added in the same
+  order as by the gate-adding procedures of the SAT solvers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_CnfIncFaninLit( Gia_CnfInc_t * p, int iFaninLit )
+{
+    assert( Gia_CnfIncObjVar(p, Abc_Lit2Var(iFaninLit)) >= 0 );
+    return Abc_Var2Lit( Gia_CnfIncObjVar(p, Abc_Lit2Var(iFaninLit)), Abc_LitIsCompl(iFaninLit) );
+}
+static void Gia_CnfIncLoadNode( Gia_CnfInc_t * p, int iObj, int * pFanins, int nFanins, int fXor )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    int iVar = p->pFuncAddVar( p->pSat );
+    int Lit  = Abc_Var2Lit( iVar, 0 );
+    assert( Gia_CnfIncObjVar(p, iObj) == -1 );
+    Vec_IntWriteEntry( p->vObj2Var, iObj, iVar );
+    Vec_IntSetEntryFull( p->vVar2Obj, iVar, iObj );
+    p->nVars = Abc_MaxInt( p->nVars, iVar + 1 );
+    if ( Gia_ObjIsConst0(pObj) )
+        Gia_CnfIncAddClause( p, Abc_LitNot(Lit), -1, -1 );
+    else if ( Gia_ObjIsCi(pObj) )
+        Vec_IntPushTwo( p->vCis, iObj, iVar );
+    else if ( nFanins == 3 )
+    {
+        // f = c ? t : e
+        int LitC = Gia_CnfIncFaninLit( p, pFanins[0] );
+        int LitT = Gia_CnfIncFaninLit( p, pFanins[1] );
+        int LitE = Gia_CnfIncFaninLit( p, pFanins[2] );
+        Gia_CnfIncAddClause( p, Abc_LitNot(LitC), Abc_LitNot(LitT), Lit );
+        Gia_CnfIncAddClause( p, Abc_LitNot(LitC), LitT, Abc_LitNot(Lit) );
+        Gia_CnfIncAddClause( p, LitC, Abc_LitNot(LitE), Lit );
+        Gia_CnfIncAddClause( p, LitC, LitE, Abc_LitNot(Lit) );
+        if ( Abc_Lit2Var(LitT) == Abc_Lit2Var(LitE) )
+            return;
+        Gia_CnfIncAddClause( p, LitT, LitE, Abc_LitNot(Lit) );
+        Gia_CnfIncAddClause( p, Abc_LitNot(LitT), Abc_LitNot(LitE), Lit );
+    }
+    else
+    {
+        int Lit0 = Gia_CnfIncFaninLit( p, pFanins[0] );
+        int Lit1 = Gia_CnfIncFaninLit( p, pFanins[1] );
+        assert( nFanins == 2 );
+        if ( !p->fGatesOnly && fXor )
+        {
+            // f = a ^ b
+            int LitF = Abc_LitNotCond( Lit, Abc_LitIsCompl(Lit0) ^ Abc_LitIsCompl(Lit1) );
+            int LitA = Abc_LitRegular( Lit0 );
+            int LitB = Abc_LitRegular( Lit1 );
+            Gia_CnfIncAddClause( p, Abc_LitNot(LitF), Abc_LitNot(LitA), Abc_LitNot(LitB) );
+            Gia_CnfIncAddClause( p, Abc_LitNot(LitF), LitA, LitB );
+            Gia_CnfIncAddClause( p, LitF, Abc_LitNot(LitA), LitB );
+            Gia_CnfIncAddClause( p, LitF, LitA, Abc_LitNot(LitB) );
+        }
+        else if ( !p->fGatesOnly )
+        {
+            // f = a & b
+            Gia_CnfIncAddClause( p, Abc_LitNot(Lit), Lit0, -1 );
+            Gia_CnfIncAddClause( p, Abc_LitNot(Lit), Lit1, -1 );
+            Gia_CnfIncAddClause( p, Lit, Abc_LitNot(Lit0), Abc_LitNot(Lit1) );
+        }
+        if ( p->pFuncAddGate )
+        {
+            p->pFuncAddGate( p->pSat, iVar, Lit0, Lit1, fXor );
+            p->nGates[fXor]++;
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the CNF variable of the node.]
+
+  Description [Loads the clauses of the nodes in the TFI of the node,
+  which were not loaded before. The traversal is not recursive, so that
+  deep AIGs do not overflow the stack. The nodes are loaded in the DFS
+  order visiting the fanins first to last, so the variables are the same
+  as those assigned by a recursive loader.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_CnfIncLoadObj( Gia_CnfInc_t * p, int iObj )
+{
+    int k, iCur, nFanins, fXor, fReady, pFanins[3];
+    assert( p->pSat != NULL );
+    assert( !Gia_ObjIsCo(Gia_ManObj(p->pGia, iObj)) );
+    if ( Gia_CnfIncObjVar(p, iObj) >= 0 )
+        return Gia_CnfIncObjVar(p, iObj);
+    Vec_IntFillExtra( p->vObj2Var, Gia_ManObjNum(p->pGia), -1 );
+    Vec_IntClear( p->vStack );
+    Vec_IntPush( p->vStack, iObj );
+    while ( Vec_IntSize(p->vStack) )
+    {
+        iCur = Vec_IntEntryLast( p->vStack );
+        if ( Gia_CnfIncObjVar(p, iCur) >= 0 )
+        {
+            Vec_IntPop( p->vStack );
+            continue;
+        }
+        nFanins = Gia_CnfIncObjFanins( p, iCur, pFanins, &fXor );
+        fReady = 1;
+        for ( k = nFanins - 1; k >= 0; k-- )
+            if ( Gia_CnfIncObjVar(p, Abc_Lit2Var(pFanins[k])) == -1 )
+                Vec_IntPush( p->vStack, Abc_Lit2Var(pFanins[k]) ), fReady = 0;
+        if ( !fReady )
+            continue;
+        Vec_IntPop( p->vStack );
+        Gia_CnfIncLoadNode( p, iCur, pFanins, nFanins, fXor );
+    }
+    return Gia_CnfIncObjVar(p, iObj);
+}
+int Gia_CnfIncLoadLit( Gia_CnfInc_t * p, int iLit )
+{
+    return Abc_Var2Lit( Gia_CnfIncLoadObj(p, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit) );
+}
+int Gia_CnfIncLoadCo( Gia_CnfInc_t * p, int iCo )
+{
+    Gia_Obj_t * pObj = Gia_ManCo( p->pGia, iCo );
+    return Abc_Var2Lit( Gia_CnfIncLoadObj(p, Gia_ObjFaninId0p(p->pGia, pObj)), Gia_ObjFaninC0(pObj) );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
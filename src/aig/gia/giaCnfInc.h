@@ -0,0 +1,103 @@
+/**CFile****************************************************************
+
+  FileName    [giaCnfInc.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Incremental CNF loader independent of the SAT solver.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    [$Id: giaCnfInc.h,v 1.00 2026/10/16 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__aig__gia__giaCnfInc_h
+#define ABC__aig__gia__giaCnfInc_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "gia.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the SAT solver interface: adding a variable returns its number;
+// adding a clause returns 0 if the problem became trivially UNSAT;
+// adding a gate passes the fanin literals of an AND or XOR node
+typedef int  (*Gia_CnfIncAddVar_f)( void * pSat );
+typedef int  (*Gia_CnfIncVarNum_f)( void * pSat );
+typedef int  (*Gia_CnfIncAddClause_f)( void * pSat, int * pLits, int nLits );
+typedef void (*Gia_CnfIncAddGate_f)( void * pSat, int iVar, int Lit0, int Lit1, int fXor );
+
+typedef struct Gia_CnfInc_t_ Gia_CnfInc_t;
+struct Gia_CnfInc_t_
+{
+    Gia_Man_t *           pGia;          // the AIG (may grow between the calls)
+    void *                pSat;          // the current SAT solver
+    Gia_CnfIncAddVar_f    pFuncAddVar;   // adds a variable to the solver
+    Gia_CnfIncVarNum_f    pFuncVarNum;   // returns the number of variables in the solver
+    Gia_CnfIncAddClause_f pFuncAddClause;// adds a clause to the solver
+    Gia_CnfIncAddGate_f   pFuncAddGate;  // passes the gate structure to the solver (or NULL)
+    int                   fGatesOnly;    // the gates are passed without the clauses
+    Vec_Int_t *           vObj2Var;      // SAT variable of each object (-1 if not loaded)
+    Vec_Int_t *           vVar2Obj;      // object of each SAT variable (-1 if not an object)
+    Vec_Int_t *           vCis;          // pairs (ObjId, Var) of the loaded CIs
+    Vec_Int_t *           vStack;        // traversal stack
+    Vec_Int_t *           vLits;         // temporary clause
+    Vec_Int_t *           vClauses;      // recorded clauses as (nLits, Lit0, Lit1, ...) or NULL
+    int                   nVars;         // the largest variable used plus one
+    int                   nClauses;      // the number of clauses added
+    int                   nGates[2];     // the number of AND and XOR gates passed to the solver
+    int                   fUnsat;        // the solver became UNSAT while loading
+};
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+static inline int Gia_CnfIncObjVar( Gia_CnfInc_t * p, int iObj ) { return iObj < Vec_IntSize(p->vObj2Var) ? Vec_IntEntry(p->vObj2Var, iObj) : -1; }
+static inline int Gia_CnfIncVarObj( Gia_CnfInc_t * p, int iVar ) { return iVar < Vec_IntSize(p->vVar2Obj) ? Vec_IntEntry(p->vVar2Obj, iVar) : -1; }
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== giaCnfInc.c ===========================================================*/
+extern Gia_CnfInc_t * Gia_CnfIncStart( Gia_Man_t * pGia, int fRecord );
+extern void           Gia_CnfIncStop( Gia_CnfInc_t * p );
+extern void           Gia_CnfIncReset( Gia_CnfInc_t * p );
+extern int            Gia_CnfIncSetSolver( Gia_CnfInc_t * p, void * pSat, Gia_CnfIncAddVar_f pFuncAddVar, Gia_CnfIncVarNum_f pFuncVarNum, Gia_CnfIncAddClause_f pFuncAddClause, int fReload );
+extern void           Gia_CnfIncSetGates( Gia_CnfInc_t * p, Gia_CnfIncAddGate_f pFuncAddGate, int fGatesOnly );
+extern int            Gia_CnfIncSetBsat( Gia_CnfInc_t * p, void * pSat, int fReload );
+extern int            Gia_CnfIncSetSatoko( Gia_CnfInc_t * p, void * pSat, int fReload );
+extern int            Gia_CnfIncSetGlucose2( Gia_CnfInc_t * p, void * pSat, int fReload );
+extern int            Gia_CnfIncLoadObj( Gia_CnfInc_t * p, int iObj );
+extern int            Gia_CnfIncLoadLit( Gia_CnfInc_t * p, int iLit );
+extern int            Gia_CnfIncLoadCo( Gia_CnfInc_t * p, int iCo );
+extern int            Gia_CnfIncImport( void * pSat, Gia_CnfIncAddVar_f pFuncAddVar, Gia_CnfIncVarNum_f pFuncVarNum, Gia_CnfIncAddClause_f pFuncAddClause, Vec_Int_t * vClauses, int nVars );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
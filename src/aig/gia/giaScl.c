@@ -42,31 +42,49 @@ ABC_NAMESPACE_IMPL_START
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManCombMarkUsed_rec( Gia_Man_t * p, Gia_Obj_t * pObj )
+static inline void Gia_ManCombMarkUsedPush( Vec_Int_t * vStack, Gia_Man_t * p, Gia_Obj_t * pObj )
 {
-    if ( pObj == NULL )
-        return 0;
-    if ( !pObj->fMark0 )
-        return 0;
-    pObj->fMark0 = 0;
-    assert( Gia_ObjIsAnd(pObj) );
-    assert( !Gia_ObjIsBuf(pObj) );
-    return 1 + Gia_ManCombMarkUsed_rec( p, Gia_ObjFanin0(pObj) )
-             + Gia_ManCombMarkUsed_rec( p, Gia_ObjFanin1(pObj) )
-             + (p->pNexts ? Gia_ManCombMarkUsed_rec( p, Gia_ObjNextObj(p, Gia_ObjId(p, pObj)) ) : 0)
-             + (p->pSibls ? Gia_ManCombMarkUsed_rec( p, Gia_ObjSiblObj(p, Gia_ObjId(p, pObj)) ) : 0)
-             + (p->pMuxes ? Gia_ManCombMarkUsed_rec( p, Gia_ObjFanin2(p, pObj) ) : 0);
+    if ( pObj && pObj->fMark0 )
+        Vec_IntPush( vStack, Gia_ObjId(p, pObj) );
+}
+int Gia_ManCombMarkUsedCone( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vStack )
+{
+    int nNodes = 0;
+    // explicit stack is used to avoid deep recursion on long chains of nodes
+    Vec_IntClear( vStack );
+    Gia_ManCombMarkUsedPush( vStack, p, pObj );
+    while ( Vec_IntSize(vStack) > 0 )
+    {
+        pObj = Gia_ManObj( p, Vec_IntPop(vStack) );
+        if ( !pObj->fMark0 )
+            continue;
+        pObj->fMark0 = 0;
+        assert( Gia_ObjIsAnd(pObj) );
+        assert( !Gia_ObjIsBuf(pObj) );
+        nNodes++;
+        Gia_ManCombMarkUsedPush( vStack, p, Gia_ObjFanin0(pObj) );
+        Gia_ManCombMarkUsedPush( vStack, p, Gia_ObjFanin1(pObj) );
+        if ( p->pNexts )
+            Gia_ManCombMarkUsedPush( vStack, p, Gia_ObjNextObj(p, Gia_ObjId(p, pObj)) );
+        if ( p->pSibls )
+            Gia_ManCombMarkUsedPush( vStack, p, Gia_ObjSiblObj(p, Gia_ObjId(p, pObj)) );
+        if ( p->pMuxes )
+            Gia_ManCombMarkUsedPush( vStack, p, Gia_ObjFanin2(p, pObj) );
+    }
+    return nNodes;
 }
 int Gia_ManCombMarkUsed( Gia_Man_t * p )
 {
     Gia_Obj_t * pObj;
+    Vec_Int_t * vStack = Vec_IntAlloc( 100 );
     int i, nNodes = 0;
     Gia_ManForEachObj( p, pObj, i )
         pObj->fMark0 = Gia_ObjIsAnd(pObj) && !Gia_ObjIsBuf(pObj);
     Gia_ManForEachBuf( p, pObj, i )
-        nNodes += Gia_ManCombMarkUsed_rec( p, Gia_ObjFanin0(pObj) );
+        nNodes += Gia_ManCombMarkUsedCone( p, Gia_ObjFanin0(pObj), vStack );
     Gia_ManForEachCo( p, pObj, i )
-        nNodes += Gia_ManCombMarkUsed_rec( p, Gia_ObjFanin0(pObj) );
+        nNodes += Gia_ManCombMarkUsedCone( p, Gia_ObjFanin0(pObj), vStack );
+    Vec_IntFree( vStack );
     return nNodes;
 }
 
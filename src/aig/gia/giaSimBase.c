@@ -20,6 +20,7 @@
 
 #include "gia.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilSimd.h"
 #include "misc/extra/extra.h"
 //#include <immintrin.h>
 #include "aig/miniaig/miniaig.h"
@@ -92,35 +93,26 @@ void Gia_ManSimPatAssignInputs( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims, Ve
 }
 static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
-    word pComps[2] = { 0, ~(word)0 };
-    word Diff0 = pComps[Gia_ObjFaninC0(pObj)];
-    word Diff1 = pComps[Gia_ObjFaninC1(pObj)];
     word * pSims  = Vec_WrdArray(vSims);
     word * pSims0 = pSims + nWords*Gia_ObjFaninId0(pObj, i);
     word * pSims1 = pSims + nWords*Gia_ObjFaninId1(pObj, i);
-    word * pSims2 = pSims + nWords*i; int w;
+    word * pSims2 = pSims + nWords*i;
     if ( Gia_ObjIsXor(pObj) )
-        for ( w = 0; w < nWords; w++ )
-            pSims2[w] = (pSims0[w] ^ Diff0) ^ (pSims1[w] ^ Diff1);
+        Abc_SimdXor( pSims2, pSims0, pSims1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj), nWords );
     else
-        for ( w = 0; w < nWords; w++ )
-            pSims2[w] = (pSims0[w] ^ Diff0) & (pSims1[w] ^ Diff1);
+        Abc_SimdAnd( pSims2, pSims0, pSims1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), nWords );
 }
 static inline void Gia_ManSimPatSimPo( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
-    word pComps[2] = { 0, ~(word)0 };
-    word Diff0     = pComps[Gia_ObjFaninC0(pObj)];
     word * pSims   = Vec_WrdArray(vSims);
     word * pSims0  = pSims + nWords*Gia_ObjFaninId0(pObj, i);
-    word * pSims2  = pSims + nWords*i; int w;
-    for ( w = 0; w < nWords; w++ )
-        pSims2[w]  = (pSims0[w] ^ Diff0);
+    word * pSims2  = pSims + nWords*i;
+    Abc_SimdCopy( pSims2, pSims0, Gia_ObjFaninC0(pObj), nWords );
 }
 static inline void Gia_ManSimPatSimNot( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
-    word * pSims   = Vec_WrdArray(vSims) + nWords*i; int w;
-    for ( w = 0; w < nWords; w++ )
-        pSims[w]   = ~pSims[w];
+    word * pSims   = Vec_WrdArray(vSims) + nWords*i;
+    Abc_SimdCopy( pSims, pSims, 1, nWords );
 }
 Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
 {
@@ -139,20 +131,161 @@ Vec_Wrd_t * Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOut
 {
     Gia_Obj_t * pObj;
     int i, nWords = Vec_WrdSize(vSimsPi) / Gia_ManCiNum(pGia);
-    Vec_Wrd_t * vSimsCo = fOuts ? Vec_WrdStart( Gia_ManCoNum(pGia) * nWords ) : NULL;
-    Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
+    Vec_Wrd_t * vSims;
     assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(pGia) == 0 );
+    if ( fOuts ) // only the outputs are needed
+        return Gia_ManSimPatSimOutTiled( pGia, vSimsPi, 0, 1, 0 );
+    vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
     Gia_ManSimPatAssignInputs( pGia, nWords, vSims, vSimsPi );
     Gia_ManForEachAnd( pGia, pObj, i ) 
         Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
     Gia_ManForEachCo( pGia, pObj, i )
         Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
-    if ( !fOuts )
-        return vSims;
-    Gia_ManForEachCo( pGia, pObj, i )
-        memcpy( Vec_WrdEntryP(vSimsCo, i*nWords), Vec_WrdEntryP(vSims, Gia_ObjId(pGia, pObj)*nWords), sizeof(word)*nWords );
-    Vec_WrdFree( vSims );
-    return vSimsCo;
+    return vSims;
+}
+/**Function*************************************************************
+
+  Synopsis    [Tiled simulation of the outputs.]
+
+  Description [Patterns are split into tiles of nTileWords words, which
+  are simulated independently, possibly by several threads. Each tile
+  keeps simulation info of the live frontier only: the rows are assigned
+  once using fanout counters, and a row is reused as soon as the last
+  fanout of its object is simulated. CIs are read directly from the input
+  patterns. The memory per tile is the max frontier width times the tile
+  size, instead of the number of objects times the number of patterns.
+  If nTileWords is 0, the tile is selected to fit into L2 cache.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_SimTileMan_t_ Gia_SimTileMan_t;
+struct Gia_SimTileMan_t_
+{
+    Gia_Man_t *     pGia;       // the AIG
+    Vec_Wrd_t *     vSimsPi;    // input patterns (nCis x nWords)
+    Vec_Wrd_t *     vSimsCo;    // output patterns (nCos x nWords)
+    Vec_Int_t *     vRows;      // working row of each object (-1 if none)
+    int             nRows;      // the number of working rows
+    int             nWords;     // the number of words in the patterns
+};
+typedef struct Gia_SimTile_t_ Gia_SimTile_t;
+struct Gia_SimTile_t_
+{
+    Gia_SimTileMan_t * pMan;    // shared data
+    int             iStart;     // the first word of the tile
+    int             nWords;     // the number of words in the tile
+};
+int Gia_ManSimTileAssignRows( Gia_Man_t * p, Vec_Int_t * vRows )
+{
+    Vec_Int_t * vFree = Vec_IntAlloc( 100 );
+    int * pRefs = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    Gia_Obj_t * pObj; int i, k, iFan, nRows = 0;
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        pRefs[Gia_ObjFaninId0(pObj, i)]++;
+        pRefs[Gia_ObjFaninId1(pObj, i)]++;
+    }
+    Gia_ManForEachCo( p, pObj, i )
+        pRefs[Gia_ObjFaninId0p(p, pObj)]++;
+    Vec_IntFill( vRows, Gia_ManObjNum(p), -1 );
+    if ( pRefs[0] )
+        Vec_IntWriteEntry( vRows, 0, nRows++ );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        // the output row is taken before the fanin rows are released
+        if ( pRefs[i] )
+            Vec_IntWriteEntry( vRows, i, Vec_IntSize(vFree) ? Vec_IntPop(vFree) : nRows++ );
+        for ( k = 0; k < 2; k++ )
+        {
+            iFan = k ? Gia_ObjFaninId1(pObj, i) : Gia_ObjFaninId0(pObj, i);
+            if ( --pRefs[iFan] == 0 && Vec_IntEntry(vRows, iFan) >= 0 )
+                Vec_IntPush( vFree, Vec_IntEntry(vRows, iFan) );
+        }
+    }
+    ABC_FREE( pRefs );
+    Vec_IntFree( vFree );
+    return nRows;
+}
+static inline word * Gia_ManSimTileObj( Gia_SimTile_t * pTile, word * pMem, int iObj )
+{
+    Gia_SimTileMan_t * p = pTile->pMan;
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    if ( Gia_ObjIsCi(pObj) )
+        return Vec_WrdEntryP( p->vSimsPi, Gia_ObjCioId(pObj) * p->nWords + pTile->iStart );
+    assert( Vec_IntEntry(p->vRows, iObj) >= 0 );
+    return pMem + Vec_IntEntry(p->vRows, iObj) * pTile->nWords;
+}
+int Gia_ManSimTileProcess( void * pData )
+{
+    Gia_SimTile_t * pTile = (Gia_SimTile_t *)pData;
+    Gia_SimTileMan_t * p = pTile->pMan;
+    word * pMem = ABC_CALLOC( word, Abc_MaxInt(p->nRows, 1) * pTile->nWords );
+    Gia_Obj_t * pObj; int i;
+    Gia_ManForEachAnd( p->pGia, pObj, i )
+    {
+        word * pSims, * pSims0, * pSims1;
+        if ( Vec_IntEntry(p->vRows, i) == -1 )
+            continue;
+        pSims  = Gia_ManSimTileObj( pTile, pMem, i );
+        pSims0 = Gia_ManSimTileObj( pTile, pMem, Gia_ObjFaninId0(pObj, i) );
+        pSims1 = Gia_ManSimTileObj( pTile, pMem, Gia_ObjFaninId1(pObj, i) );
+        if ( Gia_ObjIsXor(pObj) )
+            Abc_SimdXor( pSims, pSims0, pSims1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj), pTile->nWords );
+        else
+            Abc_SimdAnd( pSims, pSims0, pSims1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), pTile->nWords );
+    }
+    Gia_ManForEachCo( p->pGia, pObj, i )
+        Abc_SimdCopy( Vec_WrdEntryP(p->vSimsCo, i * p->nWords + pTile->iStart), 
+            Gia_ManSimTileObj(pTile, pMem, Gia_ObjFaninId0p(p->pGia, pObj)), Gia_ObjFaninC0(pObj), pTile->nWords );
+    ABC_FREE( pMem );
+    return 1;
+}
+Vec_Wrd_t * Gia_ManSimPatSimOutTiled( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int nTileWords, int nProcs, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    Gia_SimTileMan_t Man, * p = &Man;
+    Gia_SimTile_t * pTiles;
+    Vec_Ptr_t * vData;
+    int i, nTiles;
+    assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(pGia) == 0 );
+    memset( p, 0, sizeof(Gia_SimTileMan_t) );
+    p->pGia    = pGia;
+    p->vSimsPi = vSimsPi;
+    p->nWords  = Vec_WrdSize(vSimsPi) / Gia_ManCiNum(pGia);
+    p->vSimsCo = Vec_WrdStart( Gia_ManCoNum(pGia) * p->nWords );
+    if ( p->nWords == 0 )
+        return p->vSimsCo;
+    p->vRows   = Vec_IntAlloc( Gia_ManObjNum(pGia) );
+    p->nRows   = Gia_ManSimTileAssignRows( pGia, p->vRows );
+    if ( nTileWords <= 0 ) // 256 KB per tile
+        nTileWords = Abc_MaxInt( ABC_SIMD_WORDS_MIN, (1 << 15) / Abc_MaxInt(p->nRows, 1) );
+    nTileWords = Abc_MinInt( nTileWords, p->nWords );
+    nTiles = (p->nWords + nTileWords - 1) / nTileWords;
+    pTiles = ABC_CALLOC( Gia_SimTile_t, nTiles );
+    vData  = Vec_PtrAlloc( nTiles );
+    for ( i = 0; i < nTiles; i++ )
+    {
+        pTiles[i].pMan   = p;
+        pTiles[i].iStart = i * nTileWords;
+        pTiles[i].nWords = Abc_MinInt( nTileWords, p->nWords - pTiles[i].iStart );
+        Vec_PtrPush( vData, pTiles + i );
+    }
+    // the calling thread only dispatches the tiles
+    Util_ProcessThreads( Gia_ManSimTileProcess, vData, nProcs + 1, 0, fVerbose );
+    if ( fVerbose )
+    {
+        printf( "Simulated %d patterns in %d tiles of %d words using %d threads.  ", 64*p->nWords, nTiles, nTileWords, nProcs );
+        printf( "Live rows = %d (%.2f %% of %d objects).  Tile memory = %.2f MB.\n", 
+            p->nRows, 100.0*p->nRows/Gia_ManObjNum(pGia), Gia_ManObjNum(pGia), 8.0*p->nRows*nTileWords/(1<<20) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_PtrFree( vData );
+    Vec_IntFree( p->vRows );
+    ABC_FREE( pTiles );
+    return p->vSimsCo;
 }
 static inline void Gia_ManSimPatSimAnd3( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims, Vec_Wrd_t * vSimsC )
 {
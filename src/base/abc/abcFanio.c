@@ -209,6 +209,41 @@ void Abc_ObjPatchFanin( Abc_Obj_t * pObj, Abc_Obj_t * pFaninOld, Abc_Obj_t * pFa
     Vec_IntPushMem( pObj->pNtk->pMmStep, &pFaninNewR->vFanouts, pObj->Id );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Replaces a fanin of the node without updating the old fanin.]
+
+  Description [Same as Abc_ObjPatchFanin() but the node is not removed from 
+  the fanout array of the old fanin, which takes time linear in the number
+  of fanouts. Useful when many fanouts of the same node are moved. The caller 
+  is responsible for compacting the fanout array of the old fanin afterwards.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_ObjPatchFaninNoFanout( Abc_Obj_t * pObj, Abc_Obj_t * pFaninOld, Abc_Obj_t * pFaninNew )
+{
+    Abc_Obj_t * pFaninNewR = Abc_ObjRegular(pFaninNew);
+    int iFanin;
+    assert( !Abc_ObjIsComplement(pObj) );
+    assert( !Abc_ObjIsComplement(pFaninOld) );
+    assert( pFaninOld != pFaninNewR );
+    assert( pObj->pNtk == pFaninOld->pNtk );
+    assert( pObj->pNtk == pFaninNewR->pNtk );
+    if ( (iFanin = Vec_IntFind( &pObj->vFanins, pFaninOld->Id )) == -1 )
+    {
+        printf( "Node %s is not among", Abc_ObjName(pFaninOld) );
+        printf( " the fanins of node %s...\n", Abc_ObjName(pObj) );
+        return;
+    }
+    Vec_IntWriteEntry( &pObj->vFanins, iFanin, pFaninNewR->Id );
+    if ( Abc_ObjIsComplement(pFaninNew) )
+        Abc_ObjXorFaninC( pObj, iFanin );
+    Vec_IntPushMem( pObj->pNtk->pMmStep, &pFaninNewR->vFanouts, pObj->Id );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Replaces pObj by iObjNew in the fanin arrays of the fanouts.]
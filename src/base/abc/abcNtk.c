@@ -1450,6 +1450,11 @@ void Abc_NtkDelete( Abc_Ntk_t * pNtk )
     // free the timing manager
     if ( pNtk->pManTime )
         Abc_ManTimeStop( pNtk->pManTime );
+    // free the cuts kept with the AIG
+    Abc_NtkStopCuts( pNtk );
+    // free the timing manager kept by the gate-sizing commands
+    if ( pNtk->pSclMan )
+        pNtk->pSclManFree( pNtk->pSclMan );
     Vec_IntFreeP( &pNtk->vPhases );
     // start the functionality manager
     if ( Abc_NtkIsStrash(pNtk) )
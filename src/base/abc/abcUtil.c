@@ -1868,6 +1868,16 @@ void Abc_NtkReassignIds( Abc_Ntk_t * pNtk )
             pNode->vFanouts.pArray[k] = pTemp->Id;
     }
 
+    // renumber the cuts kept with the network
+    if ( pNtk->pManCut )
+    {
+        Vec_Int_t * vMap = Vec_IntStartFull( Vec_PtrSize(pNtk->vObjs) );
+        Abc_NtkForEachObj( pNtk, pNode, i )
+            Vec_IntWriteEntry( vMap, i, pNode->Id );
+        Abc_NtkRemapCuts( pNtk, vMap );
+        Vec_IntFree( vMap );
+    }
+
     // replace the array of objs
     Vec_PtrFree( pNtk->vObjs );
     pNtk->vObjs = vObjsNew;
@@ -529,6 +529,44 @@ void Abc_NodeFreeCuts( void * p, Abc_Obj_t * pObj )
     Cut_NodeFreeCuts( (Cut_Man_t *)p, pObj->Id );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Releases the cuts kept with the network.]
+
+  Description [Should be called before the network is deleted or before 
+  another manager is stored in pNtk->pManCut.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkStopCuts( Abc_Ntk_t * pNtk )
+{
+    if ( pNtk->pManCut == NULL )
+        return;
+    Cut_ManStop( (Cut_Man_t *)pNtk->pManCut );
+    pNtk->pManCut = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Renumbers the cuts kept with the network.]
+
+  Description [The array maps the old object IDs into the new ones.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkRemapCuts( Abc_Ntk_t * pNtk, Vec_Int_t * vMap )
+{
+    if ( pNtk->pManCut == NULL )
+        return;
+    Cut_ManRemapNodes( (Cut_Man_t *)pNtk->pManCut, vMap );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the cuts for the network.]
@@ -1558,7 +1558,13 @@ Abc_Ntk_t * Abc_NtkDRewrite( Abc_Ntk_t * pNtk, Dar_RwrPar_t * pPars )
         Vec_VecFree( vParts );
     }
 */
-    Dar_ManRewrite( pMan, pPars );
+    if ( pPars->nProcs > 1 )
+    {
+        pMan = Dar_ManRewritePar( pTemp = pMan, pPars );
+        Aig_ManStop( pTemp );
+    }
+    else
+        Dar_ManRewrite( pMan, pPars );
 //    pMan = Dar_ManBalance( pTemp = pMan, pPars->fUpdateLevel );
 //    Aig_ManStop( pTemp );
 
@@ -1621,7 +1627,7 @@ clk = Abc_Clock();
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fVerbose )
+Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fFanout, int fPower, int nSuppMax, int nProcs, int fVerbose )
 {
     Aig_Man_t * pMan, * pTemp;
     Abc_Ntk_t * pNtkAig;
@@ -1633,7 +1639,10 @@ Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fF
 //    Aig_ManPrintStats( pMan );
 
 clk = Abc_Clock();
-    pMan = Dar_ManCompress2( pTemp = pMan, fBalance, fUpdateLevel, fFanout, fPower, fVerbose ); 
+    if ( nProcs > 1 )
+        pMan = Dar_ManCompress2Par( pTemp = pMan, fBalance, fUpdateLevel, fFanout, fPower, nSuppMax, nProcs, fVerbose ); 
+    else
+        pMan = Dar_ManCompress2( pTemp = pMan, fBalance, fUpdateLevel, fFanout, fPower, fVerbose ); 
     Aig_ManStop( pTemp );
 //ABC_PRT( "time", Abc_Clock() - clk );
 
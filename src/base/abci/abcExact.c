@@ -28,6 +28,7 @@
 #include "misc/util/utilTruth.h"
 #include "misc/vec/vecInt.h"
 #include "misc/vec/vecPtr.h"
+#include "opt/dau/dau.h"
 #include "proof/cec/cec.h"
 #include "sat/bsat/satSolver.h"
 
@@ -295,6 +296,7 @@ struct Ses_TimesEntry_t_
 {
     int                pArrTimeProfile[8]; /* normalized arrival time profile */
     int                fResLimit;          /* solution found after resource limit */
+    int                fMemo;              /* copy of the network of another entry (not written to file) */
     Ses_TimesEntry_t * next;               /* linked list pointer */
     char *             pNetwork;           /* pointer to char array representation of optimum network */
 };
@@ -309,10 +311,12 @@ struct Ses_TruthEntry_t_
 };
 
 #define SES_STORE_TABLE_SIZE 1024
+#define SES_STORE_FILE_MAGIC "BMSC"   /* the file signature followed by the key mode (1 = canonical) */
 typedef struct Ses_Store_t_ Ses_Store_t;
 struct Ses_Store_t_
 {
     int                fMakeAIG;                       /* create AIG instead of general network */
+    int                fCanon;                         /* use NPN-canonical truth tables as keys */
     int                fVerbose;                       /* be verbose */
     int                fVeryVerbose;                   /* be very verbose */
     int                nBTLimit;                       /* conflict limit */
@@ -338,6 +342,8 @@ struct Ses_Store_t_
     unsigned long      pSynthesizedRL[9];              /* -> per cut size */
     unsigned long      nCacheHits;                     /* number of cache hits */
     unsigned long      pCacheHits[9];                  /* -> per cut size */
+    unsigned long      nCanonHits;                     /* number of cache hits for non-canonical functions */
+    unsigned long      pCanonHits[9];                  /* -> per cut size */
 
     unsigned long      nSatCalls;                      /* number of total SAT calls */
     unsigned long      nUnsatCalls;                    /* number of total UNSAT calls */
@@ -349,6 +355,7 @@ struct Ses_Store_t_
     abctime            timeSatUnsat;                   /* SAT runtime (unsat instance) */
     abctime            timeSatUndef;                   /* SAT runtime (undef instance) */
     abctime            timeInstance;                   /* creating instance runtime */
+    abctime            timeCanon;                      /* NPN canonicization runtime */
     abctime            timeTotal;                      /* all runtime */
 };
 
@@ -476,6 +483,48 @@ static inline void Ses_StoreTimesCopy( int * pTimesDest, int * pTimesSrc, int nV
         pTimesDest[i] = pTimesSrc[i];
 }
 
+// derives the store key of a function and its arrival times: if the store is
+// canonical, canonical input i is original input pCanonPerm[i] complemented if
+// bit i of the returned phase is set, and bit nVars is the output complement;
+// otherwise, the truth table is copied and the identity permutation is returned
+static inline unsigned Ses_StoreCanonicize( Ses_Store_t * pStore, word * pTruth, int nVars, int * pArrTimeProfile, word * pCanon, int * pCanonTimes, char * pCanonPerm )
+{
+    int i, j, nWords = Abc_TtWordNum( nVars );
+    unsigned uCanonPhase = 0;
+    word pTemp[4];
+    abctime timeStart = Abc_Clock();
+
+    memset( pCanon, 0, sizeof(word) * 4 );
+    Abc_TtCopy( pCanon, pTruth, nWords, 0 );
+    for ( i = 0; i < nVars; ++i )
+        pCanonPerm[i] = (char)i;
+    if ( pStore->fCanon )
+    {
+        if ( nVars < 6 )
+            Abc_TtStretch6( pCanon, nVars, 6 );
+        uCanonPhase = Abc_TtCanonicize( pCanon, nVars, pCanonPerm );
+        // order symmetric inputs by decreasing arrival time
+        for ( i = 0; i < nVars; ++i )
+            for ( j = i + 1; j < nVars; ++j )
+            {
+                if ( pArrTimeProfile[(int)pCanonPerm[i]] >= pArrTimeProfile[(int)pCanonPerm[j]] )
+                    continue;
+                Abc_TtCopy( pTemp, pCanon, nWords, 0 );
+                Abc_TtSwapVars( pTemp, nVars, i, j );
+                if ( !Abc_TtEqual( pTemp, pCanon, nWords ) )
+                    continue;
+                ABC_SWAP( char, pCanonPerm[i], pCanonPerm[j] );
+                if ( ( ( uCanonPhase >> i ) ^ ( uCanonPhase >> j ) ) & 1 )
+                    uCanonPhase ^= ( 1 << i ) | ( 1 << j );
+            }
+    }
+    for ( i = 0; i < nVars; ++i )
+        pCanonTimes[i] = pArrTimeProfile[(int)pCanonPerm[i]];
+
+    pStore->timeCanon += Abc_Clock() - timeStart;
+    return uCanonPhase;
+}
+
 static inline void Ses_StorePrintEntry( Ses_TruthEntry_t * pEntry, Ses_TimesEntry_t * pTiEntry )
 {
     int i;
@@ -577,10 +626,19 @@ static void Ses_StoreWrite( Ses_Store_t * pStore, const char * pFilename, int fS
         return;
     }
 
-    if ( fSynthImp )   nEntries += pStore->nSynthesizedImp;
-    if ( fSynthRL )    nEntries += pStore->nSynthesizedRL;
-    if ( fUnsynthImp ) nEntries += pStore->nUnsynthesizedImp;
-    if ( fUnsynthRL )  nEntries += pStore->nUnsynthesizedRL;
+    /* the memoized copies are derived again when the file is read, so they are skipped */
+    for ( i = 0; i < SES_STORE_TABLE_SIZE; ++i )
+        for ( pTEntry = pStore->pEntries[i]; pTEntry; pTEntry = pTEntry->next )
+            for ( pTiEntry = pTEntry->head; pTiEntry; pTiEntry = pTiEntry->next )
+            {
+                if ( pTiEntry->fMemo )
+                    continue;
+                if ( pTiEntry->pNetwork && !pTiEntry->fResLimit ? fSynthImp :
+                     pTiEntry->pNetwork ? fSynthRL : !pTiEntry->fResLimit ? fUnsynthImp : fUnsynthRL )
+                    nEntries++;
+            }
+    fwrite( SES_STORE_FILE_MAGIC, sizeof( char ), 4, pFile );
+    fwrite( &pStore->fCanon, sizeof( int ), 1, pFile );
     fwrite( &nEntries, sizeof( unsigned long ), 1, pFile );
 
     for ( i = 0; i < SES_STORE_TABLE_SIZE; ++i )
@@ -593,6 +651,7 @@ static void Ses_StoreWrite( Ses_Store_t * pStore, const char * pFilename, int fS
                 pTiEntry = pTEntry->head;
                 while ( pTiEntry )
                 {
+                    if ( pTiEntry->fMemo )                                             { pTiEntry = pTiEntry->next; continue; }
                     if ( !fSynthImp && pTiEntry->pNetwork && !pTiEntry->fResLimit )    { pTiEntry = pTiEntry->next; continue; }
                     if ( !fSynthRL && pTiEntry->pNetwork && pTiEntry->fResLimit )      { pTiEntry = pTiEntry->next; continue; }
                     if ( !fUnsynthImp && !pTiEntry->pNetwork && !pTiEntry->fResLimit ) { pTiEntry = pTiEntry->next; continue; }
@@ -624,6 +683,63 @@ static void Ses_StoreWrite( Ses_Store_t * pStore, const char * pFilename, int fS
     fclose( pFile );
 }
 
+// returns the output arrival time of the network for the given arrival times
+static inline int Ses_StoreNetworkDelay( char * pSol, int * pArrTimeProfile, int nVars )
+{
+    int l, Delay = 0;
+    char * pPinDelays = pSol + 3 + 4 * pSol[ABC_EXACT_SOL_NGATES] + 2;
+    for ( l = 0; l < nVars; ++l )
+        if ( pPinDelays[l] )
+            Delay = Abc_MaxInt( Delay, pArrTimeProfile[l] + pPinDelays[l] );
+    return Delay;
+}
+
+// returns the lower bound on the output arrival time of any network of 
+// two-input gates, which is reached by a balanced tree of the inputs
+static inline int Ses_StoreDelayLowerBound( word * pTruth, int nVars, int * pArrTimeProfile )
+{
+    int l, nMax = 0, Delay;
+    word Sum = 0;
+    for ( l = 0; l < nVars; ++l )
+        if ( Abc_TtHasVar( pTruth, nVars, l ) )
+            nMax = Abc_MaxInt( nMax, pArrTimeProfile[l] );
+    /* the inputs arriving much earlier than the latest one are rounded up */
+    for ( l = 0; l < nVars; ++l )
+        if ( Abc_TtHasVar( pTruth, nVars, l ) )
+            Sum += (word)1 << Abc_MaxInt( 0, pArrTimeProfile[l] - nMax + 32 );
+    for ( Delay = nMax; ((word)1 << (Delay - nMax + 32)) < Sum; Delay++ );
+    return Delay;
+}
+
+// returns the entry with the fastest network for the given arrival times
+static Ses_TimesEntry_t * Ses_StoreBestEntry( Ses_TruthEntry_t * pTEntry, int nVars, int * pArrTimeProfile, int * pDelay )
+{
+    Ses_TimesEntry_t * pTiEntry, * pTiBest = NULL;
+    int Delay;
+
+    *pDelay = ABC_INFINITY;
+    for ( pTiEntry = pTEntry->head; pTiEntry; pTiEntry = pTiEntry->next )
+    {
+        if ( !pTiEntry->pNetwork )
+            continue;
+        Delay = Ses_StoreNetworkDelay( pTiEntry->pNetwork, pArrTimeProfile, nVars );
+        if ( *pDelay > Delay )
+        {
+            *pDelay = Delay;
+            pTiBest = pTiEntry;
+        }
+    }
+    return pTiBest;
+}
+
+static inline char * Ses_StoreNetworkDup( char * pSol )
+{
+    int nSol = 3 + 4 * pSol[ABC_EXACT_SOL_NGATES] + 2 + pSol[ABC_EXACT_SOL_NVARS];
+    char * pNew = ABC_ALLOC( char, nSol );
+    memcpy( pNew, pSol, sizeof(char) * nSol );
+    return pNew;
+}
+
 // pArrTimeProfile is normalized
 // returns 1 if and only if a new TimesEntry has been created
 int Ses_StoreAddEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pArrTimeProfile, char * pSol, int fResLimit )
@@ -632,7 +748,8 @@ int Ses_StoreAddEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pAr
     Ses_TruthEntry_t * pTEntry;
     Ses_TimesEntry_t * pTiEntry;
 
-    if ( pSol )
+    /* the canonical store keeps the arrival times the network was computed for */
+    if ( pSol && !pStore->fCanon )
         Abc_ExactNormalizeArrivalTimesForNetwork( nVars, pArrTimeProfile, pSol );
 
     key = Ses_StoreTableHash( pTruth, nVars );
@@ -765,6 +882,39 @@ int Ses_StoreGetEntrySimple( Ses_Store_t * pStore, word * pTruth, int nVars, int
     return 1;
 }
 
+// pArrTimeProfile is normalized
+// returns the entry computed for the given arrival times or the fastest network 
+// for other arrival times if it is known to be optimal for the given ones
+static int Ses_StoreGetEntryCanon( Ses_Store_t * pStore, Ses_TruthEntry_t * pTEntry, int nVars, int * pArrTimeProfile, char ** pSol )
+{
+    Ses_TimesEntry_t * pTiEntry, * pTiBest;
+    int Delay;
+
+    for ( pTiEntry = pTEntry->head; pTiEntry; pTiEntry = pTiEntry->next )
+        if ( Ses_StoreTimesEqual( pArrTimeProfile, pTiEntry->pArrTimeProfile, nVars ) )
+        {
+            *pSol = pTiEntry->pNetwork;
+            return 1;
+        }
+
+    pTiBest = Ses_StoreBestEntry( pTEntry, nVars, pArrTimeProfile, &Delay );
+    if ( !pTiBest || Delay > Ses_StoreDelayLowerBound( pTEntry->pTruth, nVars, pArrTimeProfile ) )
+        return 0;
+
+    /* remember the network for these arrival times, so that it is returned again;
+       the copy is not counted as an entry and is not written to the file */
+    pTiEntry = ABC_CALLOC( Ses_TimesEntry_t, 1 );
+    Ses_StoreTimesCopy( pTiEntry->pArrTimeProfile, pArrTimeProfile, nVars );
+    pTiEntry->pNetwork = Ses_StoreNetworkDup( pTiBest->pNetwork );
+    pTiEntry->fResLimit = pTiBest->fResLimit;
+    pTiEntry->fMemo = 1;
+    pTiEntry->next = pTEntry->head;
+    pTEntry->head = pTiEntry;
+
+    *pSol = pTiEntry->pNetwork;
+    return 1;
+}
+
 int Ses_StoreGetEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pArrTimeProfile, char ** pSol )
 {
     int key;
@@ -788,6 +938,9 @@ int Ses_StoreGetEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pAr
     if ( !pTEntry )
         return 0;
 
+    if ( pStore->fCanon )
+        return Ses_StoreGetEntryCanon( pStore, pTEntry, nVars, pArrTimeProfile, pSol );
+
     /* find times entry */
     pTiEntry = pTEntry->head;
     while ( pTiEntry )
@@ -816,29 +969,60 @@ int Ses_StoreGetEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pAr
     return 1;
 }
 
-static void Ses_StoreRead( Ses_Store_t * pStore, const char * pFilename, int fSynthImp, int fSynthRL, int fUnsynthImp, int fUnsynthRL )
+// pArrTimeProfile is normalized
+// returns a copy of the fastest network stored for the function or NULL
+static char * Ses_StoreGetBestNetwork( Ses_Store_t * pStore, word * pTruth, int nVars, int * pArrTimeProfile, int * pDelay )
+{
+    Ses_TruthEntry_t * pTEntry;
+    Ses_TimesEntry_t * pTiBest;
+
+    pTEntry = pStore->pEntries[Ses_StoreTableHash( pTruth, nVars )];
+    while ( pTEntry && !Ses_StoreTruthEqual( pTEntry, pTruth, nVars ) )
+        pTEntry = pTEntry->next;
+    if ( !pTEntry )
+        return NULL;
+
+    pTiBest = Ses_StoreBestEntry( pTEntry, nVars, pArrTimeProfile, pDelay );
+    return pTiBest ? Ses_StoreNetworkDup( pTiBest->pNetwork ) : NULL;
+}
+
+// returns 0 if the file was written with the other kind of keys (see bms_start -n)
+static int Ses_StoreRead( Ses_Store_t * pStore, const char * pFilename, int fSynthImp, int fSynthRL, int fUnsynthImp, int fUnsynthRL )
 {
     int i;
     unsigned long nEntries;
     word pTruth[4];
     int nVars, fResLimit;
     int pArrTimeProfile[8];
-    char pHeader[3];
+    char pHeader[3], pMagic[4];
     char * pNetwork;
     FILE * pFile;
-    int value;
+    int value, fCanon = 0;
 
     if ( pStore->szDBName )
     {
         printf( "cannot read from database when szDBName is set" );
-        return;
+        return 1;
     }
 
     pFile = fopen( pFilename, "rb" );
     if (pFile == NULL)
     {
         printf( "cannot open file \"%s\" for reading\n", pFilename );
-        return;
+        return 1;
+    }
+
+    /* the files without the signature were written with the original functions as keys */
+    if ( fread( pMagic, sizeof( char ), 4, pFile ) == 4 && !strncmp( pMagic, SES_STORE_FILE_MAGIC, 4 ) )
+        value = fread( &fCanon, sizeof( int ), 1, pFile );
+    else
+        rewind( pFile );
+    if ( fCanon != pStore->fCanon )
+    {
+        printf( "cannot read file \"%s\" written with %s functions as keys (use \"bms_start%s\")\n",
+            pFilename, fCanon ? "canonical" : "original", fCanon ? "" : " -n" );
+        fclose( pFile );
+        return 0;
     }
 
     value = fread( &nEntries, sizeof( unsigned long ), 1, pFile );
@@ -874,6 +1058,7 @@ static void Ses_StoreRead( Ses_Store_t * pStore, const char * pFilename, int fSy
     fclose( pFile );
 
     printf( "read %lu entries from file\n", (long)nEntries );
+    return 1;
 }
 
 // computes top decomposition of variables wrt. to AND and OR
@@ -2613,16 +2798,16 @@ int Abc_ExactInputNum()
     return 8;
 }
 // start exact store manager
-void Abc_ExactStart( int nBTLimit, int fMakeAIG, int fVerbose, int fVeryVerbose, const char * pFilename )
+void Abc_ExactStart( int nBTLimit, int fMakeAIG, int fCanon, int fVerbose, int fVeryVerbose, const char * pFilename )
 {
     if ( !s_pSesStore )
     {
         s_pSesStore = Ses_StoreAlloc( nBTLimit, fMakeAIG, fVerbose );
+        s_pSesStore->fCanon = fCanon;
         s_pSesStore->fVeryVerbose = fVeryVerbose;
-        if ( pFilename )
+        /* the file is not updated if its entries cannot be read into this store */
+        if ( pFilename && Ses_StoreRead( s_pSesStore, pFilename, 1, 0, 0, 0 ) )
         {
-            Ses_StoreRead( s_pSesStore, pFilename, 1, 0, 0, 0 );
-
             s_pSesStore->szDBName = ABC_CALLOC( char, strlen( pFilename ) + 1 );
             strcpy( s_pSesStore->szDBName, pFilename );
         }
@@ -2644,6 +2829,7 @@ void Abc_ExactStop( const char * pFilename )
         if ( s_pSesStore->pDebugEntries )
             fclose( s_pSesStore->pDebugEntries );
         Ses_StoreClean( s_pSesStore );
+        s_pSesStore = NULL;
     }
     else
         printf( "BMS manager has not been started\n" );
@@ -2690,6 +2876,10 @@ void Abc_ExactStats()
     for ( i = 0; i < 9; ++i )
         printf( "%10lu", s_pSesStore->pCacheHits[i] );
     printf( "%10lu\n", s_pSesStore->nCacheHits );
+    printf( " - NPN cache hits         :" );
+    for ( i = 0; i < 9; ++i )
+        printf( "%10lu", s_pSesStore->pCanonHits[i] );
+    printf( "%10lu\n", s_pSesStore->nCanonHits );
     printf( "-------------------------------------------------------------------------------------------------------------------------------\n" );
     printf( "number of entries         : %d\n", s_pSesStore->nEntriesCount );
     printf( "number of valid entries   : %d\n", s_pSesStore->nValidEntriesCount );
@@ -2707,6 +2897,7 @@ void Abc_ExactStats()
     ABC_PRTP( "  Unsat  ", s_pSesStore->timeSatUnsat,                       s_pSesStore->timeTotal );
     ABC_PRTP( "  Undef  ", s_pSesStore->timeSatUndef,                       s_pSesStore->timeTotal );
     ABC_PRTP( " Instance", s_pSesStore->timeInstance,                       s_pSesStore->timeTotal );
+    ABC_PRTP( "Canon    ", s_pSesStore->timeCanon,                          s_pSesStore->timeTotal );
     ABC_PRTP( "Other    ", s_pSesStore->timeTotal - s_pSesStore->timeExact, s_pSesStore->timeTotal );
     ABC_PRTP( "ALL      ", s_pSesStore->timeTotal,                          s_pSesStore->timeTotal );
 }
@@ -2719,7 +2910,9 @@ int Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char *
     Ses_Man_t * pSes = NULL;
     char * pSol = NULL, * pSol2 = NULL, * p;
     int pNormalArrTime[8];
-    int Delay = ABC_INFINITY, nMaxDepth, fResLimit;
+    word pCanon[4];
+    char pCanonPerm[8];
+    int Delay = ABC_INFINITY, nMaxDepth, fResLimit, fNonCanon;
     abctime timeStart = Abc_Clock(), timeStartExact;
 
     /* some checks */
@@ -2754,8 +2947,10 @@ int Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char *
         return pArrTimeProfile[0];
     }
 
-    for ( l = 0; l < nVars; ++l )
-        pNormalArrTime[l] = pArrTimeProfile[l];
+    /* the store is queried and updated with the canonical function */
+    Ses_StoreCanonicize( s_pSesStore, pTruth, nVars, pArrTimeProfile, pCanon, pNormalArrTime, pCanonPerm );
+    fNonCanon = !Abc_TtEqual( pCanon, pTruth, Abc_TtWordNum( nVars ) );
+    pTruth = pCanon;
 
     nDelta = Abc_NormalizeArrivalTimes( pNormalArrTime, nVars, &nMaxArrival );
 
@@ -2765,6 +2960,11 @@ int Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char *
     {
         s_pSesStore->nCacheHits++;
         s_pSesStore->pCacheHits[nVars]++;
+        if ( fNonCanon )
+        {
+            s_pSesStore->nCanonHits++;
+            s_pSesStore->pCanonHits[nVars]++;
+        }
     }
     else
     {
@@ -2787,6 +2987,10 @@ int Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char *
         if ( AigLevel != -1 )
             nMaxDepth = Abc_MinInt( AigLevel - nDelta, nMaxDepth + nVars + 1 );
 
+        /* the fastest network stored for other arrival times is only improved upon */
+        if ( s_pSesStore->fCanon && ( pSol = Ses_StoreGetBestNetwork( s_pSesStore, pTruth, nVars, pNormalArrTime, &Delay ) ) )
+            nMaxDepth = Abc_MinInt( nMaxDepth, Delay - 1 );
+
         timeStartExact = Abc_Clock();
 
         pSes = Ses_ManAlloc( pTruth, nVars, 1 /* nSpecFunc */, nMaxDepth, pNormalArrTime, s_pSesStore->fMakeAIG, s_pSesStore->nBTLimit, s_pSesStore->fVerbose );
@@ -2860,7 +3064,7 @@ int Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char *
         p = pSol + 3 + 4 * pSol[ABC_EXACT_SOL_NGATES] + 1;
         Delay = *p++;
         for ( l = 0; l < nVars; ++l )
-            pPerm[l] = *p++;
+            pPerm[(int)pCanonPerm[l]] = *p++;
     }
 
     if ( pSol )
@@ -2894,8 +3098,11 @@ int Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char *
 Abc_Obj_t * Abc_ExactBuildNode( word * pTruth, int nVars, int * pArrTimeProfile, Abc_Obj_t ** pFanins, Abc_Ntk_t * pNtk )
 {
     char * pSol = NULL;
-    int i, j, nMaxArrival;
+    int i, j, nMaxArrival, RetValue;
     int pNormalArrTime[8];
+    word pCanon[4];
+    char pCanonPerm[8];
+    unsigned uCanonPhase, uGate;
     char const * p;
     Abc_Obj_t * pObj;
     Vec_Ptr_t * pGates;
@@ -2914,10 +3121,10 @@ Abc_Obj_t * Abc_ExactBuildNode( word * pTruth, int nVars, int * pArrTimeProfile,
         return (pTruth[0] & 1) ? Abc_NtkCreateNodeInv(pNtk, pFanins[0]) : Abc_NtkCreateNodeBuf(pNtk, pFanins[0]);
     }
 
-    for ( i = 0; i < nVars; ++i )
-        pNormalArrTime[i] = pArrTimeProfile[i];
+    uCanonPhase = Ses_StoreCanonicize( s_pSesStore, pTruth, nVars, pArrTimeProfile, pCanon, pNormalArrTime, pCanonPerm );
     Abc_NormalizeArrivalTimes( pNormalArrTime, nVars, &nMaxArrival );
-    assert( Ses_StoreGetEntry( s_pSesStore, pTruth, nVars, pNormalArrTime, &pSol ) );
+    RetValue = Ses_StoreGetEntry( s_pSesStore, pCanon, nVars, pNormalArrTime, &pSol );
+    assert( RetValue );
     if ( !pSol )
     {
         s_pSesStore->timeTotal += ( Abc_Clock() - timeStart );
@@ -2928,32 +3135,39 @@ Abc_Obj_t * Abc_ExactBuildNode( word * pTruth, int nVars, int * pArrTimeProfile,
     assert( pSol[ABC_EXACT_SOL_NFUNC] == 1 );
 
     pGates = Vec_PtrAlloc( nVars + pSol[ABC_EXACT_SOL_NGATES] );
-    pGateTruth[3] = '0';
     pGateTruth[4] = '\0';
 
-    /* primary inputs */
+    /* primary inputs (in the order of the canonical function) */
     for ( i = 0; i < nVars; ++i )
     {
-        assert( pFanins[i] );
-        Vec_PtrPush( pGates, pFanins[i] );
+        assert( pFanins[(int)pCanonPerm[i]] );
+        Vec_PtrPush( pGates, pFanins[(int)pCanonPerm[i]] );
     }
 
     /* gates */
     p = pSol + 3;
     for ( i = 0; i < pSol[ABC_EXACT_SOL_NGATES]; ++i )
     {
-        pGateTruth[2] = '0' + ( *p & 1 );
-        pGateTruth[1] = '0' + ( ( *p >> 1 ) & 1 );
-        pGateTruth[0] = '0' + ( ( *p >> 2 ) & 1 );
+        /* the solution stores minterms 01, 10, and 11 of a normal gate, where
+           the first fanin is the more significant bit of the minterm */
+        uGate = ( ( *p & 1 ) << 2 ) | ( *p & 2 ) | ( ( *p & 4 ) << 1 );
         ++p;
 
         assert( *p == 2 ); /* binary gate */
         ++p;
 
+        /* absorb the complemented inputs of the canonical function */
+        if ( p[0] < nVars && ( ( uCanonPhase >> p[0] ) & 1 ) )
+            uGate = ( ( uGate & 0x5 ) << 1 ) | ( ( uGate & 0xA ) >> 1 );
+        if ( p[1] < nVars && ( ( uCanonPhase >> p[1] ) & 1 ) )
+            uGate = ( ( uGate & 0x3 ) << 2 ) | ( ( uGate & 0xC ) >> 2 );
+
         /* invert truth table if we are last gate and inverted */
-        if ( i + 1 == pSol[ABC_EXACT_SOL_NGATES] && Abc_LitIsCompl( *( p + 2 ) ) )
-            for ( j = 0; j < 4; ++j )
-                pGateTruth[j] = ( pGateTruth[j] == '0' ) ? '1' : '0';
+        if ( i + 1 == pSol[ABC_EXACT_SOL_NGATES] && ( Abc_LitIsCompl( *( p + 2 ) ) ^ ( ( uCanonPhase >> nVars ) & 1 ) ) )
+            uGate ^= 0xF;
+
+        for ( j = 0; j < 4; ++j )
+            pGateTruth[j] = '0' + ( ( uGate >> ( 3 - j ) ) & 1 );
 
         pSopCover = Abc_SopFromTruthBin( pGateTruth );
         pObj = Abc_NtkCreateNode( pNtk );
@@ -2999,7 +3213,7 @@ void Abc_ExactStoreTest( int fVerbose )
     }
     Abc_NodeFreeNames( vNames );
 
-    Abc_ExactStart( 10000, 1, fVerbose, 0, NULL );
+    Abc_ExactStart( 10000, 1, 1, fVerbose, 0, NULL );
 
     assert( !Abc_ExactBuildNode( pTruth, 4, pArrTimeProfile, pFanins, pNtk ) );
 
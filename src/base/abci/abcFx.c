@@ -143,7 +143,7 @@ Vec_Wec_t * Abc_NtkFxRetrieve( Abc_Ntk_t * pNtk )
     Vec_Int_t * vCube;
     Abc_Obj_t * pNode;
     char * pCube, * pSop;
-    int nVars, i, v, Lit;
+    int nVars, nLits, i, v, Lit;
     assert( Abc_NtkIsSopLogic(pNtk) );
     vCubes = Vec_WecAlloc( 1000 );
     Abc_NtkForEachNode( pNtk, pNode, i )
@@ -154,7 +154,12 @@ Vec_Wec_t * Abc_NtkFxRetrieve( Abc_Ntk_t * pNtk )
 //        if ( nVars < 2 ) continue;
         Abc_SopForEachCube( pSop, nVars, pCube )
         {
+            // allocate cubes exactly, since huge covers are made of short cubes
+            nLits = 0;
+            Abc_CubeForEachVar( pCube, Lit, v )
+                nLits += (Lit != '-');
             vCube = Vec_WecPushLevel( vCubes );
+            Vec_IntGrow( vCube, nLits + 1 );
             Vec_IntPush( vCube, Abc_ObjId(pNode) );
             Abc_CubeForEachVar( pCube, Lit, v )
             {
@@ -477,6 +482,21 @@ static void Fx_PrintStats( Fx_Man_t * p, abctime clk )
     printf( "Extr  =%7d  ", p->nDivs );
     Abc_PrintTime( 1, "Time", clk );
 }
+static void Fx_PrintMemory( Fx_Man_t * p )
+{
+    double MemCubes = Vec_WecMemory( p->vCubes ),
+           MemLits  = Vec_WecMemory( p->vLits ) + Vec_IntMemory( p->vCounts ),
+           MemDivs  = Hsh_VecManMemory( p->pHash ),
+           MemPrio  = Vec_FltMemory( p->vWeights ) + Vec_QueMemory( p->vPrio ),
+           MemVars  = Vec_IntMemory( p->vVarCube ) + Vec_IntMemory( p->vLevels ),
+           MemTotal = MemCubes + MemLits + MemDivs + MemPrio + MemVars;
+    ABC_PRMP( "Memory: Cubes      ", MemCubes, MemTotal );
+    ABC_PRMP( "Memory: Lit->cubes ", MemLits,  MemTotal );
+    ABC_PRMP( "Memory: Divisors   ", MemDivs,  MemTotal );
+    ABC_PRMP( "Memory: Weights    ", MemPrio,  MemTotal );
+    ABC_PRMP( "Memory: Variables  ", MemVars,  MemTotal );
+    ABC_PRMP( "Memory: TOTAL      ", MemTotal, MemTotal );
+}
 
 /**Function*************************************************************
 
@@ -1192,7 +1212,10 @@ int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitC
             Fx_PrintDivisors( p );
     }
     if ( fVerbose )
+    {
         Fx_PrintStats( p, Abc_Clock() - clk );
+        Fx_PrintMemory( p );
+    }
     Fx_ManStop( p );
     // return the result
     Vec_WecRemoveEmpty( vCubes );
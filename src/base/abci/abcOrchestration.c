@@ -188,6 +188,7 @@ int Abc_NtkRewrite3( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rw, int fUpdateLevel, i
     if ( fUpdateLevel )
         Abc_NtkStartReverseLevels( pNtk, 0 );
 clk = Abc_Clock();
+    Abc_NtkStopCuts( pNtk );
     pManCut = Abc_NtkStartCutManForRewrite( pNtk );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCut;
@@ -2720,6 +2721,7 @@ int Abc_NtkOrchSA( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **pGain_re
             pNode->pNext = (Abc_Obj_t *)pNode->pData;
     }
 clk = Abc_Clock();
+    Abc_NtkStopCuts( pNtk );
     pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCutRwr;
@@ -3289,6 +3291,7 @@ int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, in
     }
     // cut manager for rewrite
 clk = Abc_Clock();
+    Abc_NtkStopCuts( pNtk );
     pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCutRwr;
@@ -3554,6 +3557,7 @@ int Abc_NtkOchestration( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **pG
     
     // cut manager for rewrite
 clk = Abc_Clock();
+    Abc_NtkStopCuts( pNtk );
     pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCutRwr;
@@ -4380,6 +4384,7 @@ int Abc_NtkOchestration3( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **p
     }
     // cut manager for rewrite
 clk = Abc_Clock();
+    Abc_NtkStopCuts( pNtk );
     pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCutRwr;
@@ -4744,6 +4749,7 @@ int Abc_NtkOchestration2( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **p
     }
     // cut manager for rewrite
 clk = Abc_Clock();
+    Abc_NtkStopCuts( pNtk );
     pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCutRwr;
@@ -5140,6 +5146,7 @@ int Abc_NtkOrchGNN( Abc_Ntk_t * pNtk,  char * edgelistFile, char * featFile, int
     }
     // cut manager for rewrite
 clk = Abc_Clock();
+    Abc_NtkStopCuts( pNtk );
     pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCutRwr;
@@ -5384,6 +5391,7 @@ int Abc_NtkOrchRand( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **pGain_
     
     // cut manager for rewrite
 clk = Abc_Clock();
+    Abc_NtkStopCuts( pNtk );
     pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCutRwr;
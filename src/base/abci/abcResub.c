@@ -46,7 +46,9 @@ struct Abc_ManRes_t_
     Vec_Ptr_t *        vDivs;      // the divisors
     // representation of the simulation info
     int                nBits;      // the number of simulation bits
-    int                nWords;     // the number of unsigneds for siminfo
+    int                nWords;     // the number of unsigneds for siminfo of the current cone
+    int                nWordsMax;  // the number of unsigneds for siminfo allocated
+    int                fCareSet;   // the care set is computed for each cone
     Vec_Ptr_t        * vSims;      // simulation info
     unsigned         * pInfo;      // pointer to simulation info
     // observability don't-cares
@@ -156,6 +158,7 @@ int Abc_NtkResubstitute( Abc_Ntk_t * pNtk, int nCutMax, int nStepsMax, int nMinS
     pManRes = Abc_ManResubStart( nCutMax, ABC_RS_DIV1_MAX );
     if ( nLevelsOdc > 0 )
     pManOdc = Abc_NtkDontCareAlloc( nCutMax, nLevelsOdc, fVerbose, fVeryVerbose );
+    pManRes->fCareSet = (pManOdc != NULL);
 
     // compute the reverse levels if level update is requested
     if ( fUpdateLevel )
@@ -305,6 +308,7 @@ Abc_ManRes_t * Abc_ManResubStart( int nLeavesMax, int nDivsMax )
     // allocate simulation info
     p->nBits      = (1 << p->nLeavesMax);
     p->nWords     = (p->nBits <= 32)? 1 : (p->nBits / 32);
+    p->nWordsMax  = p->nWords;
     p->pInfo      = ABC_ALLOC( unsigned, p->nWords * (p->nDivsMax + 1) );
     memset( p->pInfo, 0, sizeof(unsigned) * p->nWords * p->nLeavesMax );
     p->vSims      = Vec_PtrAlloc( p->nDivsMax );
@@ -1938,6 +1942,10 @@ clk = Abc_Clock();
     p->nTotalDivs   += p->nDivs;
     p->nTotalLeaves += p->nLeaves;
 
+    // the truth tables of the cone are periodic with the period of 2^nLeaves bits,
+    // so unless the care set depends on other variables, the first period is enough
+    p->nWords = p->fCareSet ? p->nWordsMax : Abc_TruthWordNum( p->nLeaves );
+
     // simulate the nodes
 clk = Abc_Clock();
     Abc_ManResubSimulate( p->vDivs, p->nLeaves, p->vSims, p->nLeavesMax, p->nWords );
@@ -36,6 +36,8 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 static Cut_Man_t * Abc_NtkStartCutManForRewrite( Abc_Ntk_t * pNtk );
+static void        Abc_NtkUpdateCutManForRewrite( Abc_Ntk_t * pNtk, Cut_Man_t * pManCut );
+static void        Abc_NodeUpdateCutsForRewrite_rec( Cut_Man_t * pManCut, Abc_Obj_t * pObj, int iVisit );
 static void        Abc_NodePrintCuts( Abc_Obj_t * pNode );
 static void        Abc_ManShowCutCone( Abc_Obj_t * pNode, Vec_Ptr_t * vLeaves );
 
@@ -51,14 +53,16 @@ extern void  Abc_PlaceUpdate( Vec_Ptr_t * vAddedCells, Vec_Ptr_t * vUpdatedNets
 
   Synopsis    [Performs incremental rewriting of the AIG.]
 
-  Description []
+  Description [If fKeepCuts is set, the cuts stay with the network after
+  rewriting, and the next rewriting pass re-enumerates only the cuts of
+  the logic modified in between. Otherwise, the cuts are freed.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_NtkRewrite( Abc_Ntk_t * pNtk, int fUpdateLevel, int fUseZeros, int fVerbose, int fVeryVerbose, int fPlaceEnable )
+int Abc_NtkRewrite( Abc_Ntk_t * pNtk, int fUpdateLevel, int fUseZeros, int fVerbose, int fVeryVerbose, int fPlaceEnable, int fKeepCuts )
 {
     extern int           Dec_GraphUpdateNetwork( Abc_Obj_t * pRoot, Dec_Graph_t * pGraph, int fUpdateLevel, int nGain );
     ProgressBar * pProgress;
@@ -95,9 +99,15 @@ int Abc_NtkRewrite( Abc_Ntk_t * pNtk, int fUpdateLevel, int fUseZeros, int fVerb
     // compute the reverse levels if level update is requested
     if ( fUpdateLevel )
         Abc_NtkStartReverseLevels( pNtk, 0 );
-    // start the cut manager
+    // start the cut manager or reuse the cuts kept from the previous pass
 clk = Abc_Clock();
-    pManCut = Abc_NtkStartCutManForRewrite( pNtk );
+    if ( pNtk->pManCut )
+    {
+        pManCut = (Cut_Man_t *)pNtk->pManCut;
+        Abc_NtkUpdateCutManForRewrite( pNtk, pManCut );
+    }
+    else
+        pManCut = Abc_NtkStartCutManForRewrite( pNtk );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCut;
 
@@ -114,6 +124,9 @@ Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
         // stop if all nodes have been tried once
         if ( i >= nNodes )
             break;
+        // drop the cuts of the node if the logic below it has changed
+        Abc_NtkIncrementTravId( pNtk );
+        Abc_NodeUpdateCutsForRewrite_rec( pManCut, pNode, i );
         // skip persistant nodes
         if ( Abc_NodeIsPersistant(pNode) )
             continue;
@@ -159,10 +172,10 @@ Rwr_ManAddTimeTotal( pManRwr, Abc_Clock() - clkStart );
 //        Rwr_ManPrintStatsFile( pManRwr );
     if ( fVeryVerbose )
         Rwr_ScoresReport( pManRwr );
-    // delete the managers
+    // delete the managers (the cuts stay with the network if requested)
     Rwr_ManStop( pManRwr );
-    Cut_ManStop( pManCut );
-    pNtk->pManCut = NULL;
+    if ( !fKeepCuts || RetValue < 0 )
+        Abc_NtkStopCuts( pNtk );
 
     // start placement package
 //    if ( fPlaceEnable )
@@ -219,6 +232,7 @@ Cut_Man_t * Abc_NtkStartCutManForRewrite( Abc_Ntk_t * pNtk )
     pParams->nKeepMax  = 250;   // the max number of cuts kept at a node
     pParams->fTruth    = 1;     // compute truth tables
     pParams->fFilter   = 1;     // filter dominated cuts
+    pParams->fIncremental = 1;  // record computation stamps
     pParams->fSeq      = 0;     // compute sequential cuts
     pParams->fDrop     = 0;     // drop cuts on the fly
     pParams->fVerbose  = 0;     // the verbosiness flag
@@ -233,6 +247,65 @@ Cut_Man_t * Abc_NtkStartCutManForRewrite( Abc_Ntk_t * pNtk )
     return pManCut;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Prepares the cuts kept from the previous pass.]
+
+  Description [Frees the cuts of the nodes modified since the cuts were
+  computed, together with the cuts in their transitive fanout, so that
+  only these nodes are re-enumerated in the next pass.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkUpdateCutManForRewrite( Abc_Ntk_t * pNtk, Cut_Man_t * pManCut )
+{
+    Vec_Ptr_t * vNodes;
+    Abc_Obj_t * pObj;
+    int i;
+    // set cuts for the PIs that did not have fanouts before
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        if ( Abc_ObjFanoutNum(pObj) > 0 && Cut_NodeReadCutsNew(pManCut, pObj->Id) == NULL )
+            Cut_NodeSetTriv( pManCut, pObj->Id );
+    // visit the nodes in the topological order
+    vNodes = Abc_AigDfs( pNtk, 0, 0 );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+        if ( !Cut_NodeIsCurrent(pManCut, pObj->Id, Abc_ObjFaninId0(pObj), Abc_ObjFaninId1(pObj), Abc_ObjFaninC0(pObj), Abc_ObjFaninC1(pObj)) )
+            Cut_NodeFreeCuts( pManCut, pObj->Id );
+    Vec_PtrFree( vNodes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the cuts of the node before it is rewritten.]
+
+  Description [Replacing a node changes the fanins of its fanouts in 
+  place and may connect them to the new nodes with larger IDs. The nodes
+  with smaller IDs than the current one (iVisit) were checked when they
+  were visited and did not change since. The nodes with larger IDs are 
+  checked recursively, so that the cuts in the transitive fanout of the
+  replaced nodes are re-enumerated.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NodeUpdateCutsForRewrite_rec( Cut_Man_t * pManCut, Abc_Obj_t * pObj, int iVisit )
+{
+    if ( !Abc_ObjIsNode(pObj) || Abc_ObjId(pObj) < iVisit )
+        return;
+    if ( Abc_NodeIsTravIdCurrent(pObj) )
+        return;
+    Abc_NodeSetTravIdCurrent( pObj );
+    Abc_NodeUpdateCutsForRewrite_rec( pManCut, Abc_ObjFanin0(pObj), iVisit );
+    Abc_NodeUpdateCutsForRewrite_rec( pManCut, Abc_ObjFanin1(pObj), iVisit );
+    if ( !Cut_NodeIsCurrent(pManCut, pObj->Id, Abc_ObjFaninId0(pObj), Abc_ObjFaninId1(pObj), Abc_ObjFaninC0(pObj), Abc_ObjFaninC1(pObj)) )
+        Cut_NodeFreeCuts( pManCut, pObj->Id );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Prints the cuts at the nodes.]
@@ -23,6 +23,7 @@
 #include "bool/dec/dec.h"
 #include "map/if/if.h"
 #include "aig/miniaig/ndr.h"
+#include "misc/util/utilSimd.h"
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
@@ -643,6 +644,8 @@ Abc_Frame_t * Abc_FrameGetGlobalFrame()
 {
     if ( s_GlobalFrame == 0 )
     {
+        // detect the instruction sets used by the simulation kernels
+        Abc_SimdStart();
         // start the framework
         s_GlobalFrame = Abc_FrameAllocate();
         // perform initializations
@@ -52,6 +52,7 @@ struct Amap_Par_t_
     int    fFreeInvs;   // assume inverters are free (area = 0)
     float  fEpsilon;    // used to compare floating point numbers
     float  fADratio;    // ratio of area/delay improvement
+    int    nProcs;      // the number of threads
     int    fVerbose;    // verbosity flag
 };
 
@@ -79,6 +80,7 @@ extern void          Amap_ManSetDefaultParams( Amap_Par_t * pPars );
 extern void          Amap_LibFree( Amap_Lib_t * p );
 extern void          Amap_LibPrintSelectedGates( Amap_Lib_t * p, int fAllGates );
 extern Amap_Lib_t *  Amap_LibReadAndPrepare( char * pFileName, char * pBuffer, int fVerbose, int fVeryVerbose );
+extern Amap_Lib_t *  Amap_LibReadAndPrepareRules( char * pFileName, char * pBuffer, char * pRulesFile, int fVerbose, int fVeryVerbose );
 /*=== amapLiberty.c ==========================================================*/
 extern int           Amap_LibertyParse( char * pFileName, int fVerbose );
 extern Vec_Str_t *   Amap_LibertyParseStr( char * pFileName, int fVerbose );
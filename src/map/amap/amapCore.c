@@ -53,6 +53,7 @@ void Amap_ManSetDefaultParams( Amap_Par_t * p )
     p->fUseXors  = 1;            // enables the use of XORs
     p->fFreeInvs = 0;            // assume inverters are free (area = 0)
     p->fEpsilon  = (float)0.001; // used to compare floating point numbers
+    p->nProcs    = 1;            // the number of threads
     p->fVerbose  = 0;            // verbosity flag
 }
 
@@ -104,6 +104,9 @@ struct Amap_Man_t_
     Vec_Ptr_t *        vCuts1;
     Vec_Ptr_t *        vCuts2;
     Vec_Ptr_t *        vTempP;
+    // parallel computation
+    Vec_Wec_t *        vLevels;    // internal nodes by level
+    Vec_Ptr_t *        vMemPar;    // cut memory managers of the threads
     // statistics
     int                nCutsUsed;
     int                nCutsTried;
@@ -341,11 +344,19 @@ extern Vec_Ptr_t *   Amap_LibSelectGates( Amap_Lib_t * p, int fVerbose );
 extern Amap_Man_t *  Amap_ManStart( int nNodes );
 extern void          Amap_ManStop( Amap_Man_t * p );
 /*=== amapMatch.c ==========================================================*/
+extern Amap_Cut_t *  Amap_ManDupCut( Amap_Man_t * p, Amap_Cut_t * pCut );
+extern void          Amap_ManMatchNode( Amap_Man_t * p, Amap_Obj_t * pNode, int fFlow, int fRefs );
 extern void          Amap_ManMap( Amap_Man_t * p );
 /*=== amapMerge.c ==========================================================*/
+extern void          Amap_ManMergeNodeChoice( Amap_Man_t * p, Amap_Obj_t * pNode );
+extern void          Amap_ManMergeNodeCuts( Amap_Man_t * p, Amap_Obj_t * pNode );
 extern void          Amap_ManMerge( Amap_Man_t * p );
 /*=== amapOutput.c ==========================================================*/
 extern Vec_Ptr_t *   Amap_ManProduceMapped( Amap_Man_t * p );
+/*=== amapPar.c ==========================================================*/
+extern int           Amap_ManMergePar( Amap_Man_t * p );
+extern int           Amap_ManMatchPar( Amap_Man_t * p );
+extern void          Amap_ManFreeMemPar( Amap_Man_t * p );
 /*=== amapParse.c ==========================================================*/
 extern int           Amap_LibParseEquations( Amap_Lib_t * p, int fVerbose );
 /*=== amapPerm.c ==========================================================*/
@@ -355,6 +366,8 @@ extern Amap_Lib_t *  Amap_LibReadFile( char * pFileName, int fVerbose );
 /*=== amapRule.c ==========================================================*/
 extern short *       Amap_LibTableFindNode( Amap_Lib_t * p, int iFan0, int iFan1, int fXor );
 extern void          Amap_LibCreateRules( Amap_Lib_t * p, int fVeryVerbose );
+extern int           Amap_LibWriteRules( Amap_Lib_t * p, char * pFileName );
+extern int           Amap_LibReadRules( Amap_Lib_t * p, char * pFileName );
 /*=== amapUniq.c ==========================================================*/
 extern int           Amap_LibFindNode( Amap_Lib_t * pLib, int iFan0, int iFan1, int fXor );
 extern int           Amap_LibFindMux( Amap_Lib_t * p, int iFan0, int iFan1, int iFan2 );
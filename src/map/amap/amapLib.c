@@ -322,7 +322,9 @@ void Amap_LibPrintSelectedGates( Amap_Lib_t * p, int fAllGates )
 
   Synopsis    [Parses equations for the gates.]
 
-  Description []
+  Description [If the file with the rules is given, the rules are read
+  from it. If the file does not exist or was created for another library,
+  the rules are created and written into it.]
                
   SideEffects []
 
@@ -330,6 +332,10 @@ void Amap_LibPrintSelectedGates( Amap_Lib_t * p, int fAllGates )
 
 ***********************************************************************/
 Amap_Lib_t * Amap_LibReadAndPrepare( char * pFileName, char * pBuffer, int fVerbose, int fVeryVerbose )
+{
+    return Amap_LibReadAndPrepareRules( pFileName, pBuffer, NULL, fVerbose, fVeryVerbose );
+}
+Amap_Lib_t * Amap_LibReadAndPrepareRules( char * pFileName, char * pBuffer, char * pRulesFile, int fVerbose, int fVeryVerbose )
 {
     Amap_Lib_t * p;
     abctime clk = Abc_Clock();
@@ -359,12 +365,23 @@ Amap_Lib_t * Amap_LibReadAndPrepare( char * pFileName, char * pBuffer, int fVerb
 //       Amap_LibPrintSelectedGates( p, 0 );
     }
     clk = Abc_Clock();
+    if ( pRulesFile && Amap_LibReadRules( p, pRulesFile ) )
+    {
+        if ( fVerbose )
+        {
+            printf( "Read %d rules and %d matches from file \"%s\". ", p->nNodes, p->nSets, pRulesFile );
+            ABC_PRT( "Time", Abc_Clock() - clk );
+        }
+        return p;
+    }
     Amap_LibCreateRules( p, fVeryVerbose );
     if ( fVerbose )
     {
         printf( "Created %d rules and %d matches. ", p->nNodes, p->nSets );
         ABC_PRT( "Time", Abc_Clock() - clk );
     }
+    if ( pRulesFile )
+        Amap_LibWriteRules( p, pRulesFile );
     return p;
 }
 
@@ -91,6 +91,8 @@ void Amap_ManStop( Amap_Man_t * p )
     Aig_MmFlexStop( p->pMemCuts, 0 );
     Aig_MmFlexStop( p->pMemCutBest, 0 );
     Aig_MmFlexStop( p->pMemTemp, 0 );
+    Amap_ManFreeMemPar( p );
+    Vec_WecFreeP( &p->vLevels );
     ABC_FREE( p->pMatsTemp );
     ABC_FREE( p->ppCutsTemp );
     ABC_FREE( p->pCutsPi );
@@ -624,9 +624,13 @@ void Amap_ManMatch( Amap_Man_t * p, int fFlow, int fRefs )
     abctime clk = Abc_Clock();
     pMemOld = p->pMemCutBest;
     p->pMemCutBest = Aig_MmFlexStart();
-    Amap_ManForEachNode( p, pObj, i )
-        if ( pObj->pData )
-            Amap_ManMatchNode( p, pObj, fFlow, fRefs );
+    // without reference counters, the matches depend only on the fanins
+    if ( !fFlow || fRefs || p->pPars->nProcs < 2 || !Amap_ManMatchPar( p ) )
+    {
+        Amap_ManForEachNode( p, pObj, i )
+            if ( pObj->pData )
+                Amap_ManMatchNode( p, pObj, fFlow, fRefs );
+    }
     Aig_MmFlexStop( pMemOld, 0 );
     Area = Amap_ManComputeMapping( p );
     nInvs = Amap_ManCountInverters( p );
@@ -669,6 +673,10 @@ void Amap_ManMap( Amap_Man_t * p )
         Amap_ManMatch( p, 0, 1 );
 */
     Amap_ManCleanData( p );
+    // the cuts are not needed after the last pass (the best cuts are duplicated)
+    Aig_MmFlexRestart( p->pMemCuts );
+    Aig_MmFlexRestart( p->pMemTemp );
+    Amap_ManFreeMemPar( p );
 }
 
 ////////////////////////////////////////////////////////////////////////
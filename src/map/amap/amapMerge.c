@@ -103,7 +103,7 @@ Amap_Cut_t * Amap_ManCutStore( Amap_Man_t * p, Amap_Cut_t * pCut, int fCompl )
 
 ***********************************************************************/
 Amap_Cut_t * Amap_ManCutCreate( Amap_Man_t * p, 
-    Amap_Cut_t * pCut0, Amap_Cut_t * pCut1, int iMat )
+    Amap_Cut_t * pCut0, Amap_Cut_t * pCut1, int fCompl0, int fCompl1, int iMat )
 {
     Amap_Cut_t * pCut;
     int i, nSize  = pCut0->nFans + pCut1->nFans;
@@ -117,6 +117,11 @@ Amap_Cut_t * Amap_ManCutCreate( Amap_Man_t * p,
         pCut->Fans[i] = pCut0->Fans[i];
     for ( i = 0; i < (int)pCut1->nFans; i++ )
         pCut->Fans[pCut0->nFans+i] = pCut1->Fans[i];
+    // complement literals
+    if ( fCompl0 )
+        pCut->Fans[0] = Abc_LitNot( pCut->Fans[0] );
+    if ( fCompl1 )
+        pCut->Fans[pCut0->nFans] = Abc_LitNot( pCut->Fans[pCut0->nFans] );
     // add it to storage
     if ( p->ppCutsTemp[ pCut->iMat ] == NULL )
         Vec_IntPushOrder( p->vTemp, pCut->iMat );
@@ -137,7 +142,8 @@ Amap_Cut_t * Amap_ManCutCreate( Amap_Man_t * p,
 
 ***********************************************************************/
 Amap_Cut_t * Amap_ManCutCreate3( Amap_Man_t * p, 
-    Amap_Cut_t * pCut0, Amap_Cut_t * pCut1, Amap_Cut_t * pCut2, int iMat )
+    Amap_Cut_t * pCut0, Amap_Cut_t * pCut1, Amap_Cut_t * pCut2, 
+    int fCompl0, int fCompl1, int fCompl2, int iMat )
 {
     Amap_Cut_t * pCut;
     int i, nSize  = pCut0->nFans + pCut1->nFans + pCut2->nFans;
@@ -152,6 +158,13 @@ Amap_Cut_t * Amap_ManCutCreate3( Amap_Man_t * p,
         pCut->Fans[pCut0->nFans+i] = pCut1->Fans[i];
     for ( i = 0; i < (int)pCut2->nFans; i++ )
         pCut->Fans[pCut0->nFans+pCut1->nFans+i] = pCut2->Fans[i];
+    // complement literals
+    if ( fCompl0 )
+        pCut->Fans[0] = Abc_LitNot( pCut->Fans[0] );
+    if ( fCompl1 )
+        pCut->Fans[pCut0->nFans] = Abc_LitNot( pCut->Fans[pCut0->nFans] );
+    if ( fCompl2 )
+        pCut->Fans[pCut0->nFans+pCut1->nFans] = Abc_LitNot( pCut->Fans[pCut0->nFans+pCut1->nFans] );
     // add it to storage
     if ( p->ppCutsTemp[ pCut->iMat ] == NULL )
         Vec_IntPushOrder( p->vTemp, pCut->iMat );
@@ -404,22 +417,11 @@ void Amap_ManMergeNodeCutsMux( Amap_Man_t * p, Amap_Obj_t * pNode )
             Amap_Nod_t * pNod = Amap_LibNod( p->pLib, Vec_IntEntry(vRules, x+3) );
             if ( pNod->pSets == NULL )
                 continue;
-            // complement literals
-            if ( pCut0->nFans == 1 && (pCut0->fInv ^ fComplFanin0) )
-                pCut0->Fans[0] = Abc_LitNot(pCut0->Fans[0]);
-            if ( pCut1->nFans == 1 && (pCut1->fInv ^ fComplFanin1) )
-                pCut1->Fans[0] = Abc_LitNot(pCut1->Fans[0]);
-            if ( pCut2->nFans == 1 && (pCut2->fInv ^ fComplFanin2) )
-                pCut2->Fans[0] = Abc_LitNot(pCut2->Fans[0]);
             // create new cut
-            Amap_ManCutCreate3( p, pCut0, pCut1, pCut2, Vec_IntEntry(vRules, x+3) );
-            // uncomplement literals
-            if ( pCut0->nFans == 1 && (pCut0->fInv ^ fComplFanin0) )
-                pCut0->Fans[0] = Abc_LitNot(pCut0->Fans[0]);
-            if ( pCut1->nFans == 1 && (pCut1->fInv ^ fComplFanin1) )
-                pCut1->Fans[0] = Abc_LitNot(pCut1->Fans[0]);
-            if ( pCut2->nFans == 1 && (pCut2->fInv ^ fComplFanin2) )
-                pCut2->Fans[0] = Abc_LitNot(pCut2->Fans[0]);
+            Amap_ManCutCreate3( p, pCut0, pCut1, pCut2, 
+                pCut0->nFans == 1 && (pCut0->fInv ^ fComplFanin0), 
+                pCut1->nFans == 1 && (pCut1->fInv ^ fComplFanin1), 
+                pCut2->nFans == 1 && (pCut2->fInv ^ fComplFanin2), Vec_IntEntry(vRules, x+3) );
         }
     }
     Amap_ManCutSaveStored( p, pNode );
@@ -445,7 +447,7 @@ void Amap_ManMergeNodeCuts( Amap_Man_t * p, Amap_Obj_t * pNode )
     Amap_Obj_t * pFanin0 = Amap_ObjFanin0( p, pNode );
     Amap_Obj_t * pFanin1 = Amap_ObjFanin1( p, pNode );
     Amap_Cut_t * pCut0, * pCut1;
-    int ** pRules, Entry, i, k, c, iCompl0, iCompl1, iFan0, iFan1;
+    int ** pRules, Entry, i, k, c, iCompl0, iCompl1, iFan0, iFan1, fCompl0, fCompl1;
     assert( pNode->pData == NULL );
     if ( pNode->Type == AMAP_OBJ_MUX )
     {
@@ -458,9 +460,7 @@ void Amap_ManMergeNodeCuts( Amap_Man_t * p, Amap_Obj_t * pNode )
     {
         iCompl0 = pCut0->fInv ^ Amap_ObjFaninC0(pNode);
         iFan0   = !pCut0->iMat? 0: Abc_Var2Lit( pCut0->iMat, iCompl0 );
-        // complement literals
-        if ( pCut0->nFans == 1 && iCompl0 )
-            pCut0->Fans[0] = Abc_LitNot(pCut0->Fans[0]);
+        fCompl0 = pCut0->nFans == 1 && iCompl0;
         // label resulting sets
         for ( i = 0; (Entry = pRules[iFan0][i]); i++ )
             p->pMatsTemp[Entry & 0xffff] = (Entry >> 16);
@@ -471,21 +471,14 @@ void Amap_ManMergeNodeCuts( Amap_Man_t * p, Amap_Obj_t * pNode )
             iFan1   = !pCut1->iMat? 0: Abc_Var2Lit( pCut1->iMat, iCompl1 );
             if ( p->pMatsTemp[iFan1] == 0 )
                 continue;
-            // complement literals
-            if ( pCut1->nFans == 1 && iCompl1 )
-                pCut1->Fans[0] = Abc_LitNot(pCut1->Fans[0]);
-            // create new cut
+            fCompl1 = pCut1->nFans == 1 && iCompl1;
+            // create new cut (the fanin cuts are not modified, so that 
+            // the cuts of several nodes can be computed concurrently)
             if ( iFan0 >= iFan1 )
-                Amap_ManCutCreate( p, pCut0, pCut1, p->pMatsTemp[iFan1] );
+                Amap_ManCutCreate( p, pCut0, pCut1, fCompl0, fCompl1, p->pMatsTemp[iFan1] );
             else
-                Amap_ManCutCreate( p, pCut1, pCut0, p->pMatsTemp[iFan1] );
-            // uncomplement literals
-            if ( pCut1->nFans == 1 && iCompl1 )
-                pCut1->Fans[0] = Abc_LitNot(pCut1->Fans[0]);
+                Amap_ManCutCreate( p, pCut1, pCut0, fCompl1, fCompl0, p->pMatsTemp[iFan1] );
         }
-        // uncomplement literals
-        if ( pCut0->nFans == 1 && iCompl0 )
-            pCut0->Fans[0] = Abc_LitNot(pCut0->Fans[0]);
         // label resulting sets
         for ( i = 0; (Entry = pRules[iFan0][i]); i++ )
             p->pMatsTemp[Entry & 0xffff] = 0;
@@ -494,8 +487,6 @@ void Amap_ManMergeNodeCuts( Amap_Man_t * p, Amap_Obj_t * pNode )
     p->nCutsUsed += pNode->nCuts;
     p->nCutsTried += pFanin0->nCuts * pFanin1->nCuts;
 //    assert( (int)pNode->nCuts == Amap_ManMergeCountCuts(p, pNode) );
-    if ( pNode->fRepr )
-        Amap_ManMergeNodeChoice( p, pNode );
 
 //    Amap_ManPrintCuts( pNode );
 }
@@ -517,8 +508,15 @@ void Amap_ManMerge( Amap_Man_t * p )
     int i;
     abctime clk = Abc_Clock();
     p->pCutsPi = Amap_ManSetupPis( p );
-    Amap_ManForEachNode( p, pObj, i )
-        Amap_ManMergeNodeCuts( p, pObj );
+    if ( p->pPars->nProcs < 2 || !Amap_ManMergePar( p ) )
+    {
+        Amap_ManForEachNode( p, pObj, i )
+        {
+            Amap_ManMergeNodeCuts( p, pObj );
+            if ( pObj->fRepr )
+                Amap_ManMergeNodeChoice( p, pObj );
+        }
+    }
     if ( p->pPars->fVerbose )
     {
         printf( "AIG object is %d bytes.  ", (int)sizeof(Amap_Obj_t) );
@@ -0,0 +1,362 @@
+/**CFile****************************************************************
+
+  FileName    [amapPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Technology mapper for standard cells.]
+
+  Synopsis    [Computing cuts and matches using threads.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: amapPar.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "amapInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define AMAP_PAR_THR_MAX    100   // the largest number of threads
+#define AMAP_PAR_LEVEL_MIN   64   // levels with fewer nodes are processed by one thread
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Releases cut memory allocated by the threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Amap_ManFreeMemPar( Amap_Man_t * p )
+{
+    Aig_MmFlex_t * pMem;
+    int i;
+    if ( p->vMemPar == NULL )
+        return;
+    Vec_PtrForEachEntry( Aig_MmFlex_t *, p->vMemPar, pMem, i )
+        Aig_MmFlexStop( pMem, 0 );
+    Vec_PtrFreeP( &p->vMemPar );
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Collects internal nodes by level.]
+
+  Description [The fanins of a node have smaller levels than the node.
+  The level of a choice node is the largest level of the nodes in its
+  class, so the nodes of the class are not processed after it.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Amap_ManCollectLevels( Amap_Man_t * p )
+{
+    Vec_Wec_t * vLevels;
+    Amap_Obj_t * pObj;
+    int i;
+    vLevels = Vec_WecStart( p->nLevelMax + 1 );
+    Amap_ManForEachNode( p, pObj, i )
+    {
+        assert( Amap_ObjFanin0(p, pObj)->Level < pObj->Level );
+        assert( Amap_ObjFanin1(p, pObj)->Level < pObj->Level );
+        assert( !Amap_ObjIsMux(pObj) || Amap_ObjFanin2(p, pObj)->Level < pObj->Level );
+        Vec_WecPush( vLevels, pObj->Level, pObj->Id );
+    }
+    return vLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts or matches of the nodes level by level.]
+
+  Description [Each thread works with a private copy of the manager that
+  has its own temporary storage and memory managers. The nodes of one
+  level are split among the threads. The cuts and the flow-based matches
+  of a node depend only on its fanins (and the nodes of its choice class),
+  so the results are the same as those of the serial computation. Between
+  the levels, the workers sleep on a condition variable.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Amap_ParMan_t_
+{
+    pthread_mutex_t Mutex;     // protects the fields below
+    pthread_cond_t  CondStart; // signaled when a level is ready or the threads should stop
+    pthread_cond_t  CondDone;  // signaled when the last worker has finished the level
+    int          iRound;       // the number of levels given to the workers
+    int          nBusy;        // the number of workers processing the current level
+    int          fStop;        // the workers should stop
+} Amap_ParMan_t;
+typedef struct Amap_ThData_t_
+{
+    Amap_Man_t   Man;          // the copy of the manager with private storage
+    Amap_ParMan_t * pPar;
+    Vec_Int_t *  vNodes;       // the nodes of the current level
+    int          fMatch;       // computing matches rather than cuts
+    int          iThread;      // the thread number
+    int          nThreads;     // the number of threads
+    int          iRound;       // the last level processed by this thread
+} Amap_ThData_t;
+void Amap_ManParProcessLevel( Amap_ThData_t * pThData )
+{
+    Amap_Man_t * p = &pThData->Man;
+    Amap_Obj_t * pObj;
+    int k;
+    for ( k = pThData->iThread; k < Vec_IntSize(pThData->vNodes); k += pThData->nThreads )
+    {
+        pObj = Amap_ManObj( p, Vec_IntEntry(pThData->vNodes, k) );
+        if ( !pThData->fMatch )
+            Amap_ManMergeNodeCuts( p, pObj );
+        else if ( pObj->pData )
+            Amap_ManMatchNode( p, pObj, 1, 0 );
+    }
+}
+void * Amap_ManParWorkerThread( void * pArg )
+{
+    Amap_ThData_t * pThData = (Amap_ThData_t *)pArg;
+    Amap_ParMan_t * pPar = pThData->pPar;
+    while ( 1 )
+    {
+        // sleep until the next level is ready
+        pthread_mutex_lock( &pPar->Mutex );
+        while ( !pPar->fStop && pPar->iRound == pThData->iRound )
+            pthread_cond_wait( &pPar->CondStart, &pPar->Mutex );
+        if ( pPar->fStop )
+        {
+            pthread_mutex_unlock( &pPar->Mutex );
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        pThData->iRound = pPar->iRound;
+        pthread_mutex_unlock( &pPar->Mutex );
+        Amap_ManParProcessLevel( pThData );
+        // report that the level is done
+        pthread_mutex_lock( &pPar->Mutex );
+        if ( --pPar->nBusy == 0 )
+            pthread_cond_signal( &pPar->CondDone );
+        pthread_mutex_unlock( &pPar->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+Amap_ThData_t * Amap_ManParStart( Amap_Man_t * p, int fMatch, pthread_t * pWorkers, int nThreads )
+{
+    Amap_ParMan_t * pPar;
+    Amap_ThData_t * ThData;
+    int i, status;
+    if ( p->vLevels == NULL )
+        p->vLevels = Amap_ManCollectLevels( p );
+    pPar = ABC_CALLOC( Amap_ParMan_t, 1 );
+    pthread_mutex_init( &pPar->Mutex, NULL );
+    pthread_cond_init( &pPar->CondStart, NULL );
+    pthread_cond_init( &pPar->CondDone, NULL );
+    ThData = ABC_CALLOC( Amap_ThData_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].Man = *p;
+        if ( fMatch )
+            ThData[i].Man.pMemCutBest = Aig_MmFlexStart();
+        else
+        {
+            ThData[i].Man.vTemp       = Vec_IntAlloc( 100 );
+            ThData[i].Man.vCuts0      = Vec_PtrAlloc( 100 );
+            ThData[i].Man.vCuts1      = Vec_PtrAlloc( 100 );
+            ThData[i].Man.vCuts2      = Vec_PtrAlloc( 100 );
+            ThData[i].Man.pMatsTemp   = ABC_CALLOC( int, 2 * p->pLib->nNodes );
+            ThData[i].Man.ppCutsTemp  = ABC_CALLOC( Amap_Cut_t *, 2 * p->pLib->nNodes );
+            ThData[i].Man.pMemCuts    = Aig_MmFlexStart();
+            ThData[i].Man.pMemTemp    = Aig_MmFlexStart();
+            ThData[i].Man.nCutsUsed   = 0;
+            ThData[i].Man.nCutsTried  = 0;
+            ThData[i].Man.nCutsTried3 = 0;
+            ThData[i].Man.nBytesUsed  = 0;
+        }
+        ThData[i].pPar     = pPar;
+        ThData[i].fMatch   = fMatch;
+        ThData[i].iThread  = i;
+        ThData[i].nThreads = nThreads;
+        ThData[i].iRound   = 0;
+        if ( i == 0 )
+            continue;
+        status = pthread_create( pWorkers + i, NULL, Amap_ManParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    return ThData;
+}
+void Amap_ManParRunLevel( Amap_ThData_t * ThData, Vec_Int_t * vNodes )
+{
+    Amap_ParMan_t * pPar = ThData[0].pPar;
+    int i, nThreads = ThData[0].nThreads;
+    ThData[0].vNodes = vNodes;
+    if ( Vec_IntSize(vNodes) < AMAP_PAR_LEVEL_MIN || nThreads == 1 )
+    {
+        ThData[0].nThreads = 1;
+        Amap_ManParProcessLevel( ThData );
+        ThData[0].nThreads = nThreads;
+        return;
+    }
+    // wake up the workers, process the share of the main thread, and wait for the rest
+    pthread_mutex_lock( &pPar->Mutex );
+    for ( i = 1; i < nThreads; i++ )
+        ThData[i].vNodes = vNodes;
+    pPar->nBusy = nThreads - 1;
+    pPar->iRound++;
+    pthread_cond_broadcast( &pPar->CondStart );
+    pthread_mutex_unlock( &pPar->Mutex );
+    Amap_ManParProcessLevel( ThData );
+    pthread_mutex_lock( &pPar->Mutex );
+    while ( pPar->nBusy > 0 )
+        pthread_cond_wait( &pPar->CondDone, &pPar->Mutex );
+    pthread_mutex_unlock( &pPar->Mutex );
+}
+void Amap_ManParStop( Amap_ThData_t * ThData, pthread_t * pWorkers )
+{
+    Amap_ParMan_t * pPar = ThData[0].pPar;
+    int i, nThreads = ThData[0].nThreads;
+    pthread_mutex_lock( &pPar->Mutex );
+    pPar->fStop = 1;
+    pthread_cond_broadcast( &pPar->CondStart );
+    pthread_mutex_unlock( &pPar->Mutex );
+    for ( i = 1; i < nThreads; i++ )
+        pthread_join( pWorkers[i], NULL );
+    pthread_cond_destroy( &pPar->CondStart );
+    pthread_cond_destroy( &pPar->CondDone );
+    pthread_mutex_destroy( &pPar->Mutex );
+    ABC_FREE( pPar );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives cuts for all nodes using threads.]
+
+  Description [The cuts of the choice nodes are merged with those of their
+  classes by the main thread after each level.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Amap_ManMergePar( Amap_Man_t * p )
+{
+    pthread_t WorkerThread[AMAP_PAR_THR_MAX];
+    Amap_ThData_t * ThData;
+    Amap_Man_t * pCopy;
+    Amap_Obj_t * pObj;
+    Vec_Int_t * vLevel;
+    int nThreads = Abc_MinInt( p->pPars->nProcs, AMAP_PAR_THR_MAX );
+    int i, k, Id;
+    ThData = Amap_ManParStart( p, 0, WorkerThread, nThreads );
+    Vec_WecForEachLevel( p->vLevels, vLevel, i )
+    {
+        Amap_ManParRunLevel( ThData, vLevel );
+        Vec_IntForEachEntry( vLevel, Id, k )
+            if ( (pObj = Amap_ManObj(p, Id))->fRepr )
+                Amap_ManMergeNodeChoice( p, pObj );
+    }
+    Amap_ManParStop( ThData, WorkerThread );
+    // collect the statistics and keep the memory with the cuts
+    if ( p->vMemPar == NULL )
+        p->vMemPar = Vec_PtrAlloc( nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pCopy = &ThData[i].Man;
+        p->nCutsUsed   += pCopy->nCutsUsed;
+        p->nCutsTried  += pCopy->nCutsTried;
+        p->nCutsTried3 += pCopy->nCutsTried3;
+        p->nBytesUsed  += pCopy->nBytesUsed;
+        Vec_PtrPush( p->vMemPar, pCopy->pMemCuts );
+        Aig_MmFlexStop( pCopy->pMemTemp, 0 );
+        Vec_IntFree( pCopy->vTemp );
+        Vec_PtrFree( pCopy->vCuts0 );
+        Vec_PtrFree( pCopy->vCuts1 );
+        Vec_PtrFree( pCopy->vCuts2 );
+        ABC_FREE( pCopy->pMatsTemp );
+        ABC_FREE( pCopy->ppCutsTemp );
+    }
+    ABC_FREE( ThData );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes area-flow matches without references using threads.]
+
+  Description [The best cuts are copied into the memory manager of the
+  main thread at the end.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Amap_ManMatchPar( Amap_Man_t * p )
+{
+    pthread_t WorkerThread[AMAP_PAR_THR_MAX];
+    Amap_ThData_t * ThData;
+    Amap_Obj_t * pObj;
+    Vec_Int_t * vLevel;
+    int nThreads = Abc_MinInt( p->pPars->nProcs, AMAP_PAR_THR_MAX );
+    int i;
+    ThData = Amap_ManParStart( p, 1, WorkerThread, nThreads );
+    Vec_WecForEachLevel( p->vLevels, vLevel, i )
+        Amap_ManParRunLevel( ThData, vLevel );
+    Amap_ManParStop( ThData, WorkerThread );
+    Amap_ManForEachNode( p, pObj, i )
+        if ( pObj->pData )
+            pObj->Best.pCut = Amap_ManDupCut( p, pObj->Best.pCut );
+    for ( i = 0; i < nThreads; i++ )
+        Aig_MmFlexStop( ThData[i].Man.pMemCutBest, 0 );
+    ABC_FREE( ThData );
+    return 1;
+}
+
+#else // pthreads are not used
+
+int Amap_ManMergePar( Amap_Man_t * p ) { return 0; }
+int Amap_ManMatchPar( Amap_Man_t * p ) { return 0; }
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -30,6 +30,9 @@ ABC_NAMESPACE_IMPL_START
 
 extern int Amap_LibDeriveGatePerm( Amap_Lib_t * pLib, Amap_Gat_t * pGate, Kit_DsdNtk_t * pNtk, Amap_Nod_t * pNod, char * pArray );
 
+#define AMAP_RULES_HEADER   "ABC amap rule library"
+#define AMAP_RULES_VER_NUM  1
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -453,6 +456,294 @@ void Amap_LibCreateRules( Amap_Lib_t * pLib, int fVeryVerbose )
     Vec_VecFree( (Vec_Vec_t *)pLib->vRulesX ); pLib->vRulesX = NULL;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes the signature of the gates used to create the rules.]
+
+  Description [The rules refer to the selected gates by their IDs and
+  depend on their functions. The selection depends on the areas.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+unsigned Amap_LibRulesHash( Amap_Lib_t * pLib )
+{
+    Amap_Gat_t * pGate;
+    unsigned uHash = 0;
+    char * pName;
+    int i, k;
+    Vec_PtrForEachEntry( Amap_Gat_t *, pLib->vSelect, pGate, i )
+    {
+        for ( pName = pGate->pName; *pName; pName++ )
+            uHash = uHash * 31 + (unsigned char)*pName;
+        uHash = uHash * 31 + (unsigned)pGate->Id;
+        uHash = uHash * 31 + (unsigned)pGate->nPins;
+        if ( pGate->pFunc )
+            for ( k = 0; k < Abc_TruthWordNum(pGate->nPins); k++ )
+                uHash = uHash * 31 + pGate->pFunc[k];
+    }
+    return uHash;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the rules in the binary format.]
+
+  Description [Saves the nodes of the rules with their lists of matches
+  in the same order, the MUX rules, and the lookup tables of the AND and
+  XOR rules. This way, loading the library does not decompose the gates
+  and does not create the rules.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Amap_LibWriteLookupTable( Vec_Str_t * vStr, int ** pRules, int nEntries )
+{
+    int i, k;
+    for ( i = 0; i < nEntries; i++ )
+    {
+        for ( k = 0; pRules[i][k]; k++ );
+        Vec_StrPutI( vStr, k );
+        for ( k = 0; pRules[i][k]; k++ )
+            Vec_StrPutI( vStr, pRules[i][k] );
+    }
+}
+int Amap_LibWriteRules( Amap_Lib_t * pLib, char * pFileName )
+{
+    Amap_Gat_t * pGate;
+    Amap_Nod_t * pNod;
+    Amap_Set_t * pSet;
+    Vec_Str_t * vStr;
+    FILE * pFile;
+    int i, k, nSets, Entry, RetValue;
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open output file \"%s\".\n", pFileName );
+        return 0;
+    }
+    vStr = Vec_StrAlloc( 1000 );
+    Vec_StrPutS( vStr, AMAP_RULES_HEADER );
+    Vec_StrPutI_ne( vStr, AMAP_RULES_VER_NUM );
+    Vec_StrPutS( vStr, pLib->pName ? pLib->pName : (char *)"" );
+    Vec_StrPutI_ne( vStr, (int)Amap_LibRulesHash(pLib) );
+    Vec_StrPutI( vStr, pLib->fHasXor );
+    Vec_StrPutI( vStr, pLib->fHasMux );
+    Vec_PtrForEachEntry( Amap_Gat_t *, pLib->vSelect, pGate, i )
+        Vec_StrPutI( vStr, pGate->fMux );
+    // save the nodes with their matches
+    Vec_StrPutI( vStr, pLib->nNodes );
+    for ( i = 0; i < pLib->nNodes; i++ )
+    {
+        pNod = Amap_LibNod( pLib, i );
+        Vec_StrPutI( vStr, pNod->Type );
+        Vec_StrPutI( vStr, pNod->nSuppSize );
+        Vec_StrPutI( vStr, pNod->iFan0 );
+        Vec_StrPutI( vStr, pNod->iFan1 );
+        Vec_StrPutI( vStr, pNod->iFan2 );
+        nSets = 0;
+        for ( pSet = pNod->pSets; pSet; pSet = pSet->pNext )
+            nSets++;
+        Vec_StrPutI( vStr, nSets );
+        for ( pSet = pNod->pSets; pSet; pSet = pSet->pNext )
+        {
+            Vec_StrPutI( vStr, (pSet->iGate << 1) | pSet->fInv );
+            Vec_StrPutI( vStr, pSet->nIns );
+            for ( k = 0; k < (int)pSet->nIns; k++ )
+                Vec_StrPutC( vStr, pSet->Ins[k] );
+        }
+    }
+    // save the rules
+    Vec_StrPutI( vStr, Vec_IntSize(pLib->vRules3) );
+    Vec_IntForEachEntry( pLib->vRules3, Entry, i )
+        Vec_StrPutI( vStr, Entry );
+    Amap_LibWriteLookupTable( vStr, pLib->pRules, 2 * pLib->nNodes );
+    Amap_LibWriteLookupTable( vStr, pLib->pRulesX, 2 * pLib->nNodes );
+    RetValue = (int)fwrite( Vec_StrArray(vStr), 1, (size_t)Vec_StrSize(vStr), pFile );
+    fclose( pFile );
+    if ( RetValue != Vec_StrSize(vStr) )
+        printf( "Writing file \"%s\" has failed.\n", pFileName );
+    RetValue = (RetValue == Vec_StrSize(vStr));
+    Vec_StrFree( vStr );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the rules in the binary format.]
+
+  Description [Returns 0 if the file does not exist, was written for 
+  another set of gates, or is corrupted. In this case, the library is 
+  left without the rules.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Amap_LibRulesCheckLit( int iLit, int nNodes )
+{
+    return iLit == 0 || (iLit > 0 && Abc_Lit2Var(iLit) < nNodes);
+}
+int ** Amap_LibReadLookupTable( Vec_Str_t * vStr, int * piStr, int nEntries, int nNodes )
+{
+    Vec_Ptr_t * vVec = Vec_PtrAlloc( nEntries );
+    Vec_Int_t * vOne;
+    int ** pRules = NULL;
+    int i, k, nSize, Entry;
+    for ( i = 0; i < nEntries; i++ )
+    {
+        vOne = Vec_IntAlloc( 8 );
+        Vec_PtrPush( vVec, vOne );
+        nSize = Vec_StrGetI( vStr, piStr );
+        if ( *piStr >= Vec_StrSize(vStr) || nSize < 0 || nSize > 2 * nNodes )
+            break;
+        for ( k = 0; k < nSize; k++ )
+        {
+            Entry = Vec_StrGetI( vStr, piStr );
+            if ( Entry <= 0 || (Entry >> 16) >= nNodes || (Entry & 0xFFFF) >= 2 * nNodes )
+                break;
+            Vec_IntPush( vOne, Entry );
+        }
+        if ( k < nSize )
+            break;
+    }
+    if ( i == nEntries )
+        pRules = Amap_LibLookupTableAlloc( vVec, 0 );
+    Vec_VecFree( (Vec_Vec_t *)vVec );
+    return pRules;
+}
+int Amap_LibReadRulesInt( Amap_Lib_t * pLib, Vec_Str_t * vStr, int nFileSize, char * pFileName )
+{
+    Amap_Gat_t * pGate;
+    Amap_Nod_t * pNod;
+    Amap_Set_t * pSet, ** ppTail;
+    char * pLibName;
+    int i, k, f, nSets, nIns, nRules3, Entry, iStr = sizeof(AMAP_RULES_HEADER);
+    if ( Vec_StrGetI_ne( vStr, &iStr ) != AMAP_RULES_VER_NUM )
+    {
+        printf( "Rule library \"%s\" has unsupported version.\n", pFileName );
+        return -1;
+    }
+    pLibName = Vec_StrGetS( vStr, &iStr );
+    if ( (unsigned)Vec_StrGetI_ne( vStr, &iStr ) != Amap_LibRulesHash(pLib) )
+    {
+        printf( "Rule library \"%s\" was created for another genlib library \"%s\".\n", pFileName, pLibName );
+        ABC_FREE( pLibName );
+        return -1;
+    }
+    ABC_FREE( pLibName );
+    pLib->fHasXor = Vec_StrGetI( vStr, &iStr );
+    pLib->fHasMux = Vec_StrGetI( vStr, &iStr );
+    Vec_PtrForEachEntry( Amap_Gat_t *, pLib->vSelect, pGate, i )
+        pGate->fMux = Vec_StrGetI( vStr, &iStr ) & 1;
+    // restore the nodes with their matches
+    pLib->nNodes = Vec_StrGetI( vStr, &iStr );
+    if ( pLib->nNodes < 1 || pLib->nNodes > (1 << 15) )
+        return 0;
+    pLib->nNodesAlloc = pLib->nNodes;
+    pLib->pNodes = ABC_CALLOC( Amap_Nod_t, pLib->nNodesAlloc );
+    for ( i = 0; i < pLib->nNodes && iStr < nFileSize; i++ )
+    {
+        pNod = Amap_LibNod( pLib, i );
+        pNod->Id        = i;
+        pNod->Type      = Vec_StrGetI( vStr, &iStr );
+        pNod->nSuppSize = Vec_StrGetI( vStr, &iStr );
+        pNod->iFan0     = Vec_StrGetI( vStr, &iStr );
+        pNod->iFan1     = Vec_StrGetI( vStr, &iStr );
+        pNod->iFan2     = Vec_StrGetI( vStr, &iStr );
+        if ( pNod->Type >= AMAP_OBJ_VOID || !Amap_LibRulesCheckLit(pNod->iFan0, i) || 
+             !Amap_LibRulesCheckLit(pNod->iFan1, i) || !Amap_LibRulesCheckLit(pNod->iFan2, i) )
+            break;
+        nSets  = Vec_StrGetI( vStr, &iStr );
+        ppTail = &pNod->pSets;
+        for ( k = 0; k < nSets && iStr < nFileSize; k++ )
+        {
+            Entry = Vec_StrGetI( vStr, &iStr );
+            nIns  = Vec_StrGetI( vStr, &iStr );
+            if ( Entry < 0 || (Entry >> 1) >= Vec_PtrSize(pLib->vGates) || 
+                 nIns != Amap_LibGate(pLib, Entry >> 1)->nPins || nIns > AMAP_MAXINS )
+                break;
+            pSet = (Amap_Set_t *)Aig_MmFlexEntryFetch( pLib->pMemSet, sizeof(Amap_Set_t) );
+            memset( pSet, 0, sizeof(Amap_Set_t) );
+            pSet->iGate = Entry >> 1;
+            pSet->fInv  = Entry & 1;
+            pSet->nIns  = nIns;
+            for ( f = 0; f < nIns; f++ )
+                pSet->Ins[f] = Vec_StrGetC( vStr, &iStr );
+            for ( f = 0; f < nIns; f++ )
+                if ( pSet->Ins[f] < 0 || Abc_Lit2Var(pSet->Ins[f]) >= AMAP_MAXINS )
+                    break;
+            if ( f < nIns )
+                break;
+            *ppTail = pSet;
+            ppTail = &pSet->pNext;
+            pLib->nSets++;
+        }
+        if ( k < nSets )
+            break;
+    }
+    if ( i < pLib->nNodes )
+        return 0;
+    // restore the rules
+    nRules3 = Vec_StrGetI( vStr, &iStr );
+    if ( nRules3 < 0 || nRules3 % 4 || iStr + nRules3 > nFileSize )
+        return 0;
+    pLib->vRules3 = Vec_IntAlloc( nRules3 );
+    for ( i = 0; i < nRules3; i++ )
+    {
+        Entry = Vec_StrGetI( vStr, &iStr );
+        if ( i % 4 == 3 ? (Entry <= 0 || Entry >= pLib->nNodes) : !Amap_LibRulesCheckLit(Entry, pLib->nNodes) )
+            return 0;
+        Vec_IntPush( pLib->vRules3, Entry );
+    }
+    pLib->pRules  = Amap_LibReadLookupTable( vStr, &iStr, 2 * pLib->nNodes, pLib->nNodes );
+    pLib->pRulesX = Amap_LibReadLookupTable( vStr, &iStr, 2 * pLib->nNodes, pLib->nNodes );
+    return pLib->pRules && pLib->pRulesX && iStr <= nFileSize;
+}
+int Amap_LibReadRules( Amap_Lib_t * pLib, char * pFileName )
+{
+    Amap_Gat_t * pGate;
+    Vec_Str_t * vStr;
+    FILE * pFile;
+    int i, nFileSize, RetValue;
+    assert( pLib->pNodes == NULL );
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    nFileSize = Extra_FileSize( pFileName );
+    // pad the buffer with zeros to stop reading a truncated file at the end
+    vStr = Vec_StrStart( nFileSize + 16 );
+    RetValue = (int)fread( Vec_StrArray(vStr), 1, (size_t)nFileSize, pFile );
+    fclose( pFile );
+    if ( RetValue != nFileSize || strcmp( Vec_StrArray(vStr), AMAP_RULES_HEADER ) )
+    {
+        printf( "File \"%s\" is not a rule library.\n", pFileName );
+        Vec_StrFree( vStr );
+        return 0;
+    }
+    RetValue = Amap_LibReadRulesInt( pLib, vStr, nFileSize, pFileName );
+    Vec_StrFree( vStr );
+    if ( RetValue == 1 )
+        return 1;
+    if ( RetValue == 0 )
+        printf( "Rule library \"%s\" is corrupted.\n", pFileName );
+    // undo the partial reading (the matches stay in the memory manager)
+    ABC_FREE( pLib->pNodes );
+    ABC_FREE( pLib->pRules );
+    ABC_FREE( pLib->pRulesX );
+    Vec_IntFreeP( &pLib->vRules3 );
+    pLib->nNodes = pLib->nNodesAlloc = pLib->nSets = 0;
+    pLib->fHasXor = pLib->fHasMux = 0;
+    Vec_PtrForEachEntry( Amap_Gat_t *, pLib->vSelect, pGate, i )
+        pGate->fMux = 0;
+    return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
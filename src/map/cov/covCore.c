@@ -64,6 +64,8 @@ Abc_Ntk_t * Abc_NtkSopEsopCover( Abc_Ntk_t * pNtk, int nFaninMax, int nCubesMax,
 
     assert( Abc_NtkIsStrash(pNtk) );
 
+    // release the cuts kept with the AIG
+    Abc_NtkStopCuts( pNtk );
     // create the manager
     p = Cov_ManAlloc( pNtk, nFaninMax, nCubesMax );
     p->fUseEsop = fUseEsop;
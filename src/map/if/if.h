@@ -114,6 +114,7 @@ struct If_Par_t_
     int                nAndDelay;     // delay of AND-gate in LUT library units
     int                nAndArea;      // area of AND-gate in LUT library units
     int                nLutDecSize;   // the LUT size for decomposition
+    int                nProcs;        // the number of threads for delay-oriented cut enumeration
     int                fPreprocess;   // preprossing
     int                fArea;         // area-oriented mapping
     int                fFancy;        // a fancy feature
@@ -153,6 +154,7 @@ struct If_Par_t_
     int                fVerboseTrace; // the verbosity flag
     char *             pLutStruct;    // LUT structure
     int                fEnableStructN;// LUT structure using a new method
+    char *             pTtCache;      // file name of the persistent cache of cut function checks
     float              WireDelay;     // wire delay
     // internal parameters
     int                fSkipCutFilter;// skip cut filter
@@ -265,6 +267,9 @@ struct If_Man_t_
     Vec_Str_t *        vTtVars[IF_MAX_FUNC_LUTSIZE+1];  // mapping of truth table into selected vars
     Vec_Int_t *        vTtDecs[IF_MAX_FUNC_LUTSIZE+1];  // mapping of truth table into decomposition pattern
     Vec_Int_t *        vTtOccurs[IF_MAX_FUNC_LUTSIZE+1];// truth table occurange counters
+    Vec_Str_t *        vTtCells[IF_MAX_FUNC_LUTSIZE+1]; // mapping of truth table literal into cell check result
+    int                nTtCellHits;   // the number of cell checks answered by the cache
+    int                nTtCellLoaded; // the number of cell checks loaded from the cache file
     Hash_IntMan_t *    vPairHash;     // hashing pairs of truth tables
     Vec_Int_t *        vPairRes;      // resulting truth table
     Vec_Str_t *        vPairPerms;    // resulting permutation
@@ -306,7 +311,7 @@ struct If_Cut_t_
     float              Delay;         // delay of the cut
     int                iCutFunc;      // TT ID of the cut
     int                uMaskFunc;     // polarity bitmask
-    unsigned           uSign;         // cut signature
+    word               uSign;         // cut signature
     unsigned           Cost    : 12;  // the user's cost of the cut (related to IF_COST_MAX)
     unsigned           fCompl  :  1;  // the complemented attribute 
     unsigned           fUser   :  1;  // using the user's area and delay
@@ -428,8 +433,8 @@ static inline void       If_CutCopy( If_Man_t * p, If_Cut_t * pDst, If_Cut_t * p
 static inline void       If_CutSetup( If_Man_t * p, If_Cut_t * pCut        ) { memset(pCut, 0, (size_t)p->nCutBytes); pCut->nLimit = p->pPars->nLutSize; }
 
 static inline If_Cut_t * If_ObjCutBest( If_Obj_t * pObj )                    { return &pObj->CutBest;                }
-static inline unsigned   If_ObjCutSign( unsigned ObjId )                     { return (1 << (ObjId % 31));           }
-static inline unsigned   If_ObjCutSignCompute( If_Cut_t * p )                { unsigned s = 0; int i; for ( i = 0; i < If_CutLeaveNum(p); i++ ) s |= If_ObjCutSign(p->pLeaves[i]); return s; }
+static inline word       If_ObjCutSign( unsigned ObjId )                     { return ((word)1 << (ObjId % 63));     }
+static inline word       If_ObjCutSignCompute( If_Cut_t * p )                { word s = 0; int i; for ( i = 0; i < If_CutLeaveNum(p); i++ ) s |= If_ObjCutSign(p->pLeaves[i]); return s; }
 
 static inline float      If_ObjArrTime( If_Obj_t * pObj )                    { return If_ObjCutBest(pObj)->Delay;    }
 static inline void       If_ObjSetArrTime( If_Obj_t * pObj, float ArrTime )  { If_ObjCutBest(pObj)->Delay = ArrTime; }
@@ -449,6 +454,8 @@ static inline word *     If_CutTruthWR( If_Man_t * p, If_Cut_t * pCut )      { r
 static inline unsigned * If_CutTruthUR( If_Man_t * p, If_Cut_t * pCut)       { return (unsigned *)If_CutTruthWR(p, pCut);                        }
 static inline word *     If_CutTruthW( If_Man_t * p, If_Cut_t * pCut )       { assert( pCut->iCutFunc >= 0 ); Abc_TtCopy( p->puTempW, If_CutTruthWR(p, pCut), p->nTruth6Words[pCut->nLeaves], If_CutTruthIsCompl(pCut) ); return p->puTempW;  }
 static inline unsigned * If_CutTruth( If_Man_t * p, If_Cut_t * pCut )        { return (unsigned *)If_CutTruthW(p, pCut);                         }
+static inline int        If_ManTtCellRead( If_Man_t * p, int nLeaves, int iLit ) { return iLit < Vec_StrSize(p->vTtCells[nLeaves]) ? (int)Vec_StrEntry(p->vTtCells[nLeaves], iLit) : -1; }
+static inline void       If_ManTtCellWrite( If_Man_t * p, int nLeaves, int iLit, int Value ) { Vec_StrFillExtra( p->vTtCells[nLeaves], iLit + 1, (char)-1 ); Vec_StrWriteEntry( p->vTtCells[nLeaves], iLit, (char)Value ); }
 
 static inline int        If_CutDsdLit( If_Man_t * p, If_Cut_t * pCut )       { return Abc_Lit2LitL( Vec_IntArray(p->vTtDsds[pCut->nLeaves]), If_CutTruthLit(pCut) );               }
 static inline int        If_CutDsdIsCompl( If_Man_t * p, If_Cut_t * pCut )   { return Abc_LitIsCompl( If_CutDsdLit(p, pCut) );                                                     }
@@ -519,9 +526,12 @@ extern void            If_ManSetDefaultPars( If_Par_t * pPars );
 extern int             If_ManPerformMapping( If_Man_t * p );
 extern int             If_ManPerformMappingComb( If_Man_t * p );
 extern void            If_ManComputeSwitching( If_Man_t * p );
+/*=== ifCache.c ==========================================================*/
+extern int             If_ManTtCacheLoad( If_Man_t * p, char * pFileName );
+extern int             If_ManTtCacheSave( If_Man_t * p, char * pFileName );
 /*=== ifCut.c ============================================================*/
 extern int             If_CutVerifyCuts( If_Set_t * pCutSet, int fOrdered );
-extern int             If_CutFilter( If_Set_t * pCutSet, If_Cut_t * pCut, int fSaveCut0 );
+extern int             If_CutFilter( If_Set_t * pCutSet, If_Cut_t * pCut, int fSaveCut0, int fOrdered );
 extern void            If_CutSort( If_Man_t * p, If_Set_t * pCutSet, If_Cut_t * pCut );
 extern void            If_CutOrder( If_Cut_t * pCut );
 extern int             If_CutMergeOrdered( If_Man_t * p, If_Cut_t * pCut0, If_Cut_t * pCut1, If_Cut_t * pCut );
@@ -653,6 +663,7 @@ extern void            If_ManSetupSetAll( If_Man_t * p, int nCrossCut );
 /*=== ifMap.c =============================================================*/
 extern int *           If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut );
 extern void            If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst );
+extern int             If_ManPerformMappingParCheck( If_Man_t * p );
 extern void            If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess );
 extern int             If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPreprocess, int fFirst, char * pLabel );
 /*=== ifReduce.c ==========================================================*/
@@ -696,6 +707,8 @@ extern float           If_ManScanMappingDirect( If_Man_t * p );
 extern float           If_ManScanMappingSeq( If_Man_t * p );
 extern void            If_ManResetOriginalRefs( If_Man_t * p );
 extern int             If_ManCrossCut( If_Man_t * p );
+extern int             If_ManCrossCutLevel( If_Man_t * p );
+extern Vec_Wec_t *     If_ManLevelizeNodes( If_Man_t * p );
 
 extern Vec_Ptr_t *     If_ManReverseOrder( If_Man_t * p );
 extern void            If_ManMarkMapping( If_Man_t * p );
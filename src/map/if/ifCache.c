@@ -18,8 +18,19 @@
 
 ***********************************************************************/
 
+#include <fcntl.h>
+#ifdef _WIN32
+#include <io.h>
+#include <sys/locking.h>
+#include <sys/stat.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "if.h"
 #include "misc/vec/vecHsh.h"
+#include "misc/util/utilSignal.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -27,6 +38,10 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define IF_TT_CACHE_MAGIC   "IFTC"  // the first four bytes of the file
+#define IF_TT_CACHE_VERSION 2       // the format version following them
+#define IF_TT_CACHE_SIGN    1000
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -91,6 +106,306 @@ void If_ManCacheAnalize( If_Man_t * p )
     Vec_IntFree( vRes );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives the parameters the cut function checks depend on.]
+
+  Description [The cache file is only reused by the runs that perform
+  the same check with the same parameters.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_ManTtCacheSign( If_Man_t * p, char * pSign )
+{
+    If_Par_t * pPars = p->pPars;
+    sprintf( pSign, "K=%d S=%s N=%d C=%d%d%d%d%d M=%d", pPars->nLutSize, pPars->pLutStruct ? pPars->pLutStruct : "-", pPars->fEnableStructN, 
+        pPars->fEnableCheck07, pPars->fEnableCheck75, pPars->fEnableCheck75u, pPars->fUseCheck1, pPars->fUseCheck2, pPars->fCutMin );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads and writes the cache file contents.]
+
+  Description [The integers and the truth table words are stored in the
+  little-endian byte order, so the file does not depend on the platform.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_ManTtCacheWriteInt( FILE * pFile, int Data )
+{
+    unsigned char pBytes[4];
+    int i;
+    for ( i = 0; i < 4; i++ )
+        pBytes[i] = (unsigned char)(((unsigned)Data >> (8*i)) & 0xFF);
+    fwrite( pBytes, 4, 1, pFile );
+}
+static int If_ManTtCacheReadInt( FILE * pFile, int * pData )
+{
+    unsigned char pBytes[4];
+    unsigned Data = 0;
+    int i;
+    if ( fread( pBytes, 4, 1, pFile ) != 1 )
+        return 0;
+    for ( i = 0; i < 4; i++ )
+        Data |= (unsigned)pBytes[i] << (8*i);
+    *pData = (int)Data;
+    return 1;
+}
+static void If_ManTtCacheWriteTruth( FILE * pFile, word * pTruth, int nWords )
+{
+    unsigned char pBytes[8];
+    int w, i;
+    for ( w = 0; w < nWords; w++ )
+    {
+        for ( i = 0; i < 8; i++ )
+            pBytes[i] = (unsigned char)((pTruth[w] >> (8*i)) & 0xFF);
+        fwrite( pBytes, 8, 1, pFile );
+    }
+}
+static int If_ManTtCacheReadTruth( FILE * pFile, word * pTruth, int nWords )
+{
+    unsigned char pBytes[8];
+    int w, i;
+    for ( w = 0; w < nWords; w++ )
+    {
+        if ( fread( pBytes, 8, 1, pFile ) != 1 )
+            return 0;
+        pTruth[w] = 0;
+        for ( i = 0; i < 8; i++ )
+            pTruth[w] |= (word)pBytes[i] << (8*i);
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Serializes the updates of the cache file.]
+
+  Description [Takes an advisory lock on the file with the ".lock" suffix,
+  which is never renamed or removed, so that all processes updating the
+  same cache lock the same file. Returns the descriptor of the lock file,
+  or -1 if the lock could not be taken.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int If_ManTtCacheLock( char * pFileName )
+{
+    char * pFileLock = ABC_ALLOC( char, strlen(pFileName) + 10 );
+    int fd;
+    sprintf( pFileLock, "%s.lock", pFileName );
+#ifdef _WIN32
+    fd = _open( pFileLock, _O_CREAT | _O_RDWR, _S_IREAD | _S_IWRITE );
+    if ( fd != -1 && _locking( fd, _LK_LOCK, 1 ) )
+        _close( fd ), fd = -1;
+#else
+    fd = open( pFileLock, O_CREAT | O_RDWR, 0666 );
+    if ( fd != -1 && lockf( fd, F_LOCK, 0 ) )
+        close( fd ), fd = -1;
+#endif
+    ABC_FREE( pFileLock );
+    return fd;
+}
+static void If_ManTtCacheUnlock( int fd )
+{
+    if ( fd == -1 )
+        return;
+#ifdef _WIN32
+    _locking( fd, _LK_UNLCK, 1 );
+    _close( fd );
+#else
+    lockf( fd, F_ULOCK, 0 );
+    close( fd );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the persistent cache of cut function checks.]
+
+  Description [The file contains, for each cut size, the phase-normalized
+  truth tables with the output phase and the result of the check.
+  The truth tables are added to the truth table manager and the results
+  are recorded for their literals. Returns the number of new entries,
+  or -1 if the file does not exist or cannot be used.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManTtCacheLoad( If_Man_t * p, char * pFileName )
+{
+    char pSign[IF_TT_CACHE_SIGN], pSignFile[IF_TT_CACHE_SIGN], pBuffer[4];
+    int v, i, nEntries, nWords, Data = -1, iLit, nLoaded = 0, fError = 0;
+    word * pTruth;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return -1;
+    if ( fread( pBuffer, 4, 1, pFile ) != 1 || strncmp(pBuffer, IF_TT_CACHE_MAGIC, 4) )
+    {
+        printf( "Unrecognized format of truth table cache file \"%s\".\n", pFileName );
+        fclose( pFile );
+        return -1;
+    }
+    if ( !If_ManTtCacheReadInt( pFile, &Data ) || Data != IF_TT_CACHE_VERSION )
+    {
+        printf( "Truth table cache file \"%s\" has unsupported version %d (expected %d).\n", pFileName, Data, IF_TT_CACHE_VERSION );
+        fclose( pFile );
+        return -1;
+    }
+    If_ManTtCacheSign( p, pSign );
+    if ( !If_ManTtCacheReadInt( pFile, &Data ) || Data <= 0 || Data >= IF_TT_CACHE_SIGN || fread( pSignFile, Data, 1, pFile ) != 1 )
+    {
+        printf( "Truth table cache file \"%s\" is corrupted.\n", pFileName );
+        fclose( pFile );
+        return -1;
+    }
+    pSignFile[Data] = 0;
+    if ( strcmp(pSign, pSignFile) )
+    {
+        printf( "Truth table cache file \"%s\" was computed for different parameters (%s).\n", pFileName, pSignFile );
+        fclose( pFile );
+        return -1;
+    }
+    pTruth = ABC_ALLOC( word, p->nTruth6Words[p->pPars->nLutSize] );
+    for ( v = 0; !fError && v <= p->pPars->nLutSize; v++ )
+    {
+        if ( !If_ManTtCacheReadInt( pFile, &nEntries ) || nEntries < 0 )
+        {
+            fError = 1;
+            break;
+        }
+        nWords = Vec_MemEntrySize( p->vTtMem[v] );
+        for ( i = 0; i < nEntries; i++ )
+        {
+            if ( !If_ManTtCacheReadInt( pFile, &Data ) || !If_ManTtCacheReadTruth( pFile, pTruth, nWords ) || (pTruth[0] & 1) )
+            {
+                fError = 1;
+                break;
+            }
+            iLit = Abc_Var2Lit( Vec_MemHashInsert(p->vTtMem[v], pTruth), Data & 1 );
+            if ( If_ManTtCellRead(p, v, iLit) != -1 )
+                continue;
+            If_ManTtCellWrite( p, v, iLit, Data >> 1 );
+            nLoaded++;
+        }
+    }
+    if ( fError )
+        printf( "Truth table cache file \"%s\" is corrupted. Only %d entries are loaded.\n", pFileName, nLoaded );
+    ABC_FREE( pTruth );
+    fclose( pFile );
+    return nLoaded;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the persistent cache of cut function checks.]
+
+  Description [The file is re-read before saving to merge the entries
+  added by other processes sharing it. If it cannot be used (for example,
+  it has another format or was computed for other parameters), it is
+  replaced by the entries of this run. The new contents are written into
+  a temporary file, which is then renamed, so that concurrent readers
+  never see a partially written file. The merge and the rename are done
+  under an advisory lock, so that concurrent writers do not lose each
+  other's entries. Returns the number of entries saved, or -1 if the
+  file could not be written.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManTtCacheSave( If_Man_t * p, char * pFileName )
+{
+    char pSign[IF_TT_CACHE_SIGN], * pFileTemp = NULL;
+    int v, iLit, nEntries, nWords, Value, Data, nSaved = 0;
+    int fdLock = If_ManTtCacheLock( pFileName );
+#ifndef _WIN32
+    mode_t Mask;
+#endif
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( fdLock == -1 )
+        printf( "Cannot lock truth table cache file \"%s\". Entries saved by other processes may be lost.\n", pFileName );
+    if ( pFile != NULL )
+    {
+        fclose( pFile );
+        if ( If_ManTtCacheLoad( p, pFileName ) == -1 )
+            printf( "Truth table cache file \"%s\" is replaced by the entries of this run.\n", pFileName );
+    }
+    Value = Util_SignalTmpFile( pFileName, ".tmp", &pFileTemp );
+    if ( Value == -1 )
+    {
+        printf( "Cannot create temporary file for truth table cache \"%s\".\n", pFileName );
+        If_ManTtCacheUnlock( fdLock );
+        return -1;
+    }
+#ifdef _WIN32
+    _close( Value );
+#else
+    // the temporary file is created readable only by the owner;
+    // give the cache file the usual permissions before it is renamed
+    Mask = umask( 0 );
+    umask( Mask );
+    fchmod( Value, 0666 & ~Mask );
+    close( Value );
+#endif
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Writing truth table cache file \"%s\" has failed.\n", pFileTemp );
+        Util_SignalTmpFileRemove( pFileTemp, 0 );
+        ABC_FREE( pFileTemp );
+        If_ManTtCacheUnlock( fdLock );
+        return -1;
+    }
+    If_ManTtCacheSign( p, pSign );
+    fwrite( IF_TT_CACHE_MAGIC, 4, 1, pFile );
+    If_ManTtCacheWriteInt( pFile, IF_TT_CACHE_VERSION );
+    Data = strlen(pSign);
+    If_ManTtCacheWriteInt( pFile, Data );
+    fwrite( pSign, Data, 1, pFile );
+    for ( v = 0; v <= p->pPars->nLutSize; v++ )
+    {
+        nEntries = 0;
+        Vec_StrForEachEntry( p->vTtCells[v], Value, iLit )
+            nEntries += (Value != -1);
+        If_ManTtCacheWriteInt( pFile, nEntries );
+        nWords = Vec_MemEntrySize( p->vTtMem[v] );
+        Vec_StrForEachEntry( p->vTtCells[v], Value, iLit )
+        {
+            if ( Value == -1 )
+                continue;
+            Data = (Value << 1) | Abc_LitIsCompl(iLit);
+            If_ManTtCacheWriteInt( pFile, Data );
+            If_ManTtCacheWriteTruth( pFile, Vec_MemReadEntry(p->vTtMem[v], Abc_Lit2Var(iLit)), nWords );
+        }
+        nSaved += nEntries;
+    }
+    fclose( pFile );
+#ifdef _WIN32
+    remove( pFileName );
+#endif
+    if ( rename( pFileTemp, pFileName ) )
+    {
+        printf( "Renaming \"%s\" into truth table cache file \"%s\" has failed.\n", pFileTemp, pFileName );
+        Util_SignalTmpFileRemove( pFileTemp, 0 );
+        nSaved = -1;
+    }
+    If_ManTtCacheUnlock( fdLock );
+    ABC_FREE( pFileTemp );
+    return nSaved;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -64,6 +64,7 @@ void If_ManSetDefaultPars( If_Par_t * pPars )
     pPars->fBidec      =  0;
     pPars->fUserLutDec =  0;
     pPars->fUserLut2D  =  0;
+    pPars->nProcs      =  1;
     pPars->fVerbose    =  0;
 }
 
@@ -81,11 +82,15 @@ void If_ManSetDefaultPars( If_Par_t * pPars )
 ***********************************************************************/
 int If_ManPerformMapping( If_Man_t * p )
 {
+    int nCrossCut;
     p->pPars->fAreaOnly = p->pPars->fArea; // temporary
     // create the CI cutsets
     If_ManSetupCiCutSets( p );
-    // allocate memory for other cutsets
-    If_ManSetupSetAll( p, If_ManCrossCut(p) );
+    // allocate memory for other cutsets (level-by-level mapping may need more)
+    nCrossCut = If_ManCrossCut( p );
+    if ( If_ManPerformMappingParCheck(p) )
+        nCrossCut = Abc_MaxInt( nCrossCut, If_ManCrossCutLevel(p) );
+    If_ManSetupSetAll( p, nCrossCut );
     // derive reverse top order
     p->vObjsRev = If_ManReverseOrder( p );
     return If_ManPerformMappingComb( p );
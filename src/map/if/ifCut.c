@@ -132,6 +132,38 @@ static inline int If_CutCheckDominance( If_Cut_t * pDom, If_Cut_t * pCut )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if pDom is contained in pCut.]
+
+  Description [Assumes that the leaves of both cuts are in increasing 
+  order, which is true unless truth tables are computed using permutations.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int If_CutCheckDominanceOrdered( If_Cut_t * pDom, If_Cut_t * pCut )
+{
+    int nSizeD = pDom->nLeaves;
+    int nSizeC = pCut->nLeaves;
+    int * pD = pDom->pLeaves;
+    int * pC = pCut->pLeaves;
+    int i, k = 0;
+    assert( nSizeD <= nSizeC );
+    for ( i = 0; i < nSizeD; i++, k++ )
+    {
+        // skip the leaves of pCut that are smaller than the leaf of pDom
+        while ( k < nSizeC && pC[k] < pD[i] )
+            k++;
+        // stop if the leaf of pDom is not among the remaining leaves of pCut
+        if ( k == nSizeC || pC[k] != pD[i] || nSizeC - k < nSizeD - i )
+            return 0;
+    }
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns 1 if the cut is contained.]
@@ -143,24 +175,29 @@ static inline int If_CutCheckDominance( If_Cut_t * pDom, If_Cut_t * pCut )
   SeeAlso     []
 
 ***********************************************************************/
-int If_CutFilter( If_Set_t * pCutSet, If_Cut_t * pCut, int fSaveCut0 )
+int If_CutFilter( If_Set_t * pCutSet, If_Cut_t * pCut, int fSaveCut0, int fOrdered )
 { 
     If_Cut_t * pTemp;
+    word uSignAnd;
     int i, k;
     assert( pCutSet->ppCuts[pCutSet->nCuts] == pCut );
     for ( i = 0; i < pCutSet->nCuts; i++ )
     {
         pTemp = pCutSet->ppCuts[i];
+        // skip the cuts that cannot contain and cannot be contained in the new cut
+        uSignAnd = pTemp->uSign & pCut->uSign;
+        if ( uSignAnd != pCut->uSign && uSignAnd != pTemp->uSign )
+            continue;
         if ( pTemp->nLeaves > pCut->nLeaves )
         {
             // do not fiter the first cut
             if ( i == 0 && ((pCutSet->nCuts > 1 && pCutSet->ppCuts[1]->fUseless) || (fSaveCut0 && pCutSet->nCuts == 1)) )
                 continue;
             // skip the non-contained cuts
-            if ( (pTemp->uSign & pCut->uSign) != pCut->uSign )
+            if ( uSignAnd != pCut->uSign )
                 continue;
             // check containment seriously
-            if ( If_CutCheckDominance( pCut, pTemp ) )
+            if ( fOrdered ? If_CutCheckDominanceOrdered( pCut, pTemp ) : If_CutCheckDominance( pCut, pTemp ) )
             {
 //                p->ppCuts[i] = p->ppCuts[p->nCuts-1];
 //                p->ppCuts[p->nCuts-1] = pTemp;
@@ -177,10 +214,10 @@ int If_CutFilter( If_Set_t * pCutSet, If_Cut_t * pCut, int fSaveCut0 )
         else
         {
             // skip the non-contained cuts
-            if ( (pTemp->uSign & pCut->uSign) != pTemp->uSign )
+            if ( uSignAnd != pTemp->uSign )
                 continue;
             // check containment seriously
-            if ( If_CutCheckDominance( pTemp, pCut ) )
+            if ( fOrdered ? If_CutCheckDominanceOrdered( pTemp, pCut ) : If_CutCheckDominance( pTemp, pCut ) )
                 return 1;
         }
     }
@@ -292,7 +329,7 @@ int If_CutMergeOrdered( If_Man_t * p, If_Cut_t * pC0, If_Cut_t * pC1, If_Cut_t *
     int nSizeC0 = pC0->nLeaves;
     int nSizeC1 = pC1->nLeaves;
     int nLimit  = pC0->nLimit;
-    int i, k, c, s;
+    int i, k, c;
 
     // both cuts are the largest
     if ( nSizeC0 == nLimit && nSizeC1 == nLimit )
@@ -308,41 +345,23 @@ int If_CutMergeOrdered( If_Man_t * p, If_Cut_t * pC0, If_Cut_t * pC1, If_Cut_t *
         return 1;
     }
 
-    // compare two cuts with different numbers
-    i = k = c = s = 0; 
-    if ( nSizeC0 == 0 ) goto FlushCut1;
-    if ( nSizeC1 == 0 ) goto FlushCut0;
-    while ( 1 )
+    // merge two cuts with different numbers of leaves without branching on the leaf order
+    i = k = c = 0;
+    while ( i < nSizeC0 && k < nSizeC1 )
     {
-        if ( c == nLimit ) return 0;
-        if ( pC0->pLeaves[i] < pC1->pLeaves[k] )
-        {
-            pC->pLeaves[c++] = pC0->pLeaves[i++];
-            if ( i == nSizeC0 ) goto FlushCut1;
-        }
-        else if ( pC0->pLeaves[i] > pC1->pLeaves[k] )
-        {
-            pC->pLeaves[c++] = pC1->pLeaves[k++];
-            if ( k == nSizeC1 ) goto FlushCut0;
-        }
-        else
-        {
-            pC->pLeaves[c++] = pC0->pLeaves[i++]; k++;
-            if ( i == nSizeC0 ) goto FlushCut1;
-            if ( k == nSizeC1 ) goto FlushCut0;
-        }
+        int Leaf0 = pC0->pLeaves[i];
+        int Leaf1 = pC1->pLeaves[k];
+        if ( c == nLimit ) 
+            return 0;
+        pC->pLeaves[c++] = Abc_MinInt( Leaf0, Leaf1 );
+        i += (Leaf0 <= Leaf1);
+        k += (Leaf1 <= Leaf0);
     }
-
-FlushCut0:
-    if ( c + nSizeC0 > nLimit + i ) return 0;
+    // copy the remaining leaves of one of the cuts
+    if ( c + (nSizeC0 - i) + (nSizeC1 - k) > nLimit ) 
+        return 0;
     while ( i < nSizeC0 )
         pC->pLeaves[c++] = pC0->pLeaves[i++];
-    pC->nLeaves = c;
-    pC->uSign = pC0->uSign | pC1->uSign;
-    return 1;
-
-FlushCut1:
-    if ( c + nSizeC1 > nLimit + k ) return 0;
     while ( k < nSizeC1 )
         pC->pLeaves[c++] = pC1->pLeaves[k++];
     pC->nLeaves = c;
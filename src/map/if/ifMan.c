@@ -154,6 +154,17 @@ If_Man_t * If_ManStart( If_Par_t * pPars )
         for ( v = 0; v < 6; v++ )
             p->vTtDecs[v]  = p->vTtDecs[6];
     }
+    if ( pPars->pFuncCell && pPars->fTruth && !pPars->fUseDsd && !pPars->pFuncCell2 && !pPars->fUseTtPerm )
+    {
+        for ( v = 0; v <= p->pPars->nLutSize; v++ )
+            p->vTtCells[v] = Vec_StrAlloc( 1000 );
+        if ( pPars->pTtCache )
+        {
+            p->nTtCellLoaded = Abc_MaxInt( 0, If_ManTtCacheLoad( p, pPars->pTtCache ) );
+            if ( pPars->fVerbose )
+                Abc_Print( 1, "Loaded %d cut function checks from cache file \"%s\".\n", p->nTtCellLoaded, pPars->pTtCache );
+        }
+    }
     if ( pPars->fUseBat )
     {
 //        abctime clk = Abc_Clock();
@@ -234,6 +245,12 @@ void If_ManStop( If_Man_t * p )
             Abc_PrintTime( 1, "Canon     ", p->timeCache[3] );
         }
     }
+    if ( p->vTtCells[0] )
+    {
+        int nSaved = p->pPars->pTtCache ? If_ManTtCacheSave( p, p->pPars->pTtCache ) : -1;
+        if ( p->pPars->fVerbose )
+            Abc_Print( 1, "Cut function checks: Cache hits = %d. Loaded = %d. Saved = %d.\n", p->nTtCellHits, p->nTtCellLoaded, Abc_MaxInt(nSaved, 0) );
+    }
     if ( p->pPars->fVerbose && p->nCutsUselessAll )
     {
         for ( i = 0; i <= 16; i++ )
@@ -269,6 +286,8 @@ void If_ManStop( If_Man_t * p )
         Vec_StrFreeP( &p->vTtVars[i] );
     for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
         Vec_IntFreeP( &p->vTtDecs[i] );
+    for ( i = 0; i <= p->pPars->nLutSize; i++ )
+        Vec_StrFreeP( &p->vTtCells[i] );
     Vec_IntFreeP( &p->vCutData );
     Vec_IntFreeP( &p->vPairRes );
     Vec_StrFreeP( &p->vPairPerms );
@@ -21,6 +21,16 @@
 #include "if.h"
 #include "misc/extra/extra.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -31,6 +41,9 @@ extern char * Dau_DsdMerge( char * pDsd0i, int * pPerm0, char * pDsd1i, int * pP
 extern int    If_CutDelayRecCost3( If_Man_t* p, If_Cut_t* pCut, If_Obj_t * pObj );
 extern int    Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char * pPerm, int * Cost, int AigLevel );
 
+#define IF_PAR_THR_MAX   100   // the max number of threads
+#define IF_PAR_LEVEL_MIN 256   // the min number of nodes in a level processed by several threads
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -82,26 +95,6 @@ int If_ManCutAigDelay( If_Man_t * p, If_Obj_t * pObj, If_Cut_t * pCut )
     return Delay;
 }
 
-/**Function*************************************************************
-
-  Synopsis    [Counts the number of 1s in the signature.]
-
-  Description []
-               
-  SideEffects []
-
-  SeeAlso     []
-
-***********************************************************************/
-static inline int If_WordCountOnes( unsigned uWord )
-{
-    uWord = (uWord & 0x55555555) + ((uWord>>1) & 0x55555555);
-    uWord = (uWord & 0x33333333) + ((uWord>>2) & 0x33333333);
-    uWord = (uWord & 0x0F0F0F0F) + ((uWord>>4) & 0x0F0F0F0F);
-    uWord = (uWord & 0x00FF00FF) + ((uWord>>8) & 0x00FF00FF);
-    return  (uWord & 0x0000FFFF) + (uWord>>16);
-}
-
 /**Function*************************************************************
 
   Synopsis    [Counts the number of 1s in the signature.]
@@ -159,9 +152,9 @@ int * If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut )
   SeeAlso     []
 
 ***********************************************************************/
-void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+void If_ObjPerformMappingAndInt( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst, int * pnCuts )
 {
-    If_Set_t * pCutSet;
+    If_Set_t * pCutSet = pObj->pCutSet;
     If_Cut_t * pCut0, * pCut1, * pCut;
     If_Cut_t * pCut0R, * pCut1R;
     int fFunc0R, fFunc1R;
@@ -171,18 +164,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     int fUseAndCut = (p->pPars->nAndDelay > 0) || (p->pPars->nAndArea > 0);
     assert( !If_ObjIsAnd(pObj->pFanin0) || pObj->pFanin0->pCutSet->nCuts > 0 );
     assert( !If_ObjIsAnd(pObj->pFanin1) || pObj->pFanin1->pCutSet->nCuts > 0 );
-
-    // prepare
-    if ( Mode == 0 )
-        pObj->EstRefs = (float)pObj->nRefs;
-    else if ( Mode == 1 )
-        pObj->EstRefs = (float)((2.0 * pObj->EstRefs + pObj->nRefs) / 3.0);
-    // deref the selected cut
-    if ( Mode && pObj->nRefs > 0 )
-        If_CutAreaDeref( p, If_ObjCutBest(pObj) );
-
-    // prepare the cutset
-    pCutSet = If_ManSetupNodeCutSet( p, pObj );
+    assert( pCutSet != NULL && pCutSet->nCuts == 0 );
 
     // get the current assigned best cut
     pCut = If_ObjCutBest(pObj);
@@ -241,7 +223,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         assert( pCutSet->nCuts <= pCutSet->nCutsMax );
         pCut = pCutSet->ppCuts[pCutSet->nCuts];
         // make sure K-feasible cut exists
-        if ( If_WordCountOnes(pCut0->uSign | pCut1->uSign) > p->pPars->nLutSize )
+        if ( Abc_TtCountOnes(pCut0->uSign | pCut1->uSign) > p->pPars->nLutSize )
             continue;
 
         pCut0R = pCut0;
@@ -272,10 +254,9 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
             continue;
         if ( pObj->fSpec && pCut->nLeaves == (unsigned)p->pPars->nLutSize )
             continue;
-        p->nCutsMerged++;
-        p->nCutsTotal++;
+        (*pnCuts)++;
         // check if this cut is contained in any of the available cuts
-        if ( !p->pPars->fSkipCutFilter && If_CutFilter( pCutSet, pCut, fSave0 ) )
+        if ( !p->pPars->fSkipCutFilter && If_CutFilter( pCutSet, pCut, fSave0, !p->pPars->fUseTtPerm ) )
             continue;
         // check if the cut is a special AND-gate cut
         pCut->fAndCut = fUseAndCut && pCut->nLeaves == 2 && pCut->pLeaves[0] == pObj->pFanin0->Id && pCut->pLeaves[1] == pObj->pFanin1->Id;
@@ -296,7 +277,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                 fChange = If_CutComputeTruth( p, pCut, pCut0, pCut1, pObj->fCompl0, pObj->fCompl1 );
             if ( p->pPars->fVerbose )
                 p->timeCache[4] += Abc_Clock() - clk;
-            if ( !p->pPars->fSkipCutFilter && fChange && If_CutFilter( pCutSet, pCut, fSave0 ) )
+            if ( !p->pPars->fSkipCutFilter && fChange && If_CutFilter( pCutSet, pCut, fSave0, !p->pPars->fUseTtPerm ) )
                 continue;
             if ( p->pPars->fLut6Filter && pCut->nLeaves == 6 && !If_CutCheckTruth6(p, pCut) )
                 continue;
@@ -328,6 +309,18 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                     pCut->fUseless = If_DsdManCheckDec( p->pIfDsdMan, If_CutDsdLit(p, pCut) );
                 else if ( p->pPars->pFuncCell2 )
                     pCut->fUseless = !p->pPars->pFuncCell2( p, (word *)If_CutTruthW(p, pCut), pCut->nLeaves, NULL, NULL );
+                else if ( p->vTtCells[0] )
+                {
+                    int Value = If_ManTtCellRead( p, pCut->nLeaves, pCut->iCutFunc );
+                    if ( Value == -1 )
+                    {
+                        Value = p->pPars->pFuncCell( p, If_CutTruth(p, pCut), Abc_MaxInt(6, pCut->nLeaves), pCut->nLeaves, p->pPars->pLutStruct ) ? 1 : 0;
+                        If_ManTtCellWrite( p, pCut->nLeaves, pCut->iCutFunc, Value );
+                    }
+                    else
+                        p->nTtCellHits++;
+                    pCut->fUseless = !Value;
+                }
                 else
                     pCut->fUseless = !p->pPars->pFuncCell( p, If_CutTruth(p, pCut), Abc_MaxInt(6, pCut->nLeaves), pCut->nLeaves, p->pPars->pLutStruct );
                 p->nCutsUselessAll += pCut->fUseless;
@@ -493,6 +486,26 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
 //        p->nBestCutSmall[0]++;
 //    else if ( If_ObjCutBest(pObj)->nLeaves == 1 )
 //        p->nBestCutSmall[1]++;
+}
+void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+{
+    If_Cut_t * pCut;
+    int i, nCuts = 0;
+    // prepare
+    if ( Mode == 0 )
+        pObj->EstRefs = (float)pObj->nRefs;
+    else if ( Mode == 1 )
+        pObj->EstRefs = (float)((2.0 * pObj->EstRefs + pObj->nRefs) / 3.0);
+    // deref the selected cut
+    if ( Mode && pObj->nRefs > 0 )
+        If_CutAreaDeref( p, If_ObjCutBest(pObj) );
+
+    // prepare the cutset
+    If_ManSetupNodeCutSet( p, pObj );
+    // compute the cuts and select the best one
+    If_ObjPerformMappingAndInt( p, pObj, Mode, fPreprocess, fFirst, &nCuts );
+    p->nCutsMerged += nCuts;
+    p->nCutsTotal  += nCuts;
 
     // ref the selected cut
     if ( Mode && pObj->nRefs > 0 )
@@ -554,7 +567,7 @@ void If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fP
             // copy the cut into storage
             If_CutCopy( p, pCut, pCutTemp );
             // check if this cut is contained in any of the available cuts
-            if ( If_CutFilter( pCutSet, pCut, fSave0 ) )
+            if ( If_CutFilter( pCutSet, pCut, fSave0, !p->pPars->fUseTtPerm ) )
                 continue;
             // check if the cut satisfies the required times
 //            assert( pCut->Delay == If_CutDelay( p, pTemp, pCut ) );
@@ -592,6 +605,217 @@ void If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fP
     If_ManDerefChoiceCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Checks if delay-oriented cut enumeration can use threads.]
+
+  Description [The nodes of one level are mapped concurrently. This is only
+  done when the mapping of a node depends only on the nodes with smaller
+  levels and does not update the shared data of the manager: no choices,
+  no boxes, no truth tables, no user-specified cost or delay functions.
+  Area recovery is always serial, because it references and dereferences
+  the best cuts in the topological order.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPerformMappingParCheck( If_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    If_Par_t * pPars = p->pPars;
+    if ( pPars->nProcs < 2 || p->nChoices > 0 || p->pManTim != NULL )
+        return 0;
+    if ( pPars->fTruth || pPars->fUseTtPerm || pPars->fUseDsd || pPars->fPower || pPars->fLiftLeaves || pPars->nGateSize > 0 )
+        return 0;
+    if ( pPars->fDelayOpt || pPars->fDelayOptLut || pPars->fDsdBalance || pPars->fUserRecLib || pPars->fUserSesLib || pPars->fUserLutDec || pPars->fUserLut2D )
+        return 0;
+    if ( pPars->pFuncCost || pPars->pFuncUser || pPars->pFuncCell || pPars->pFuncCell2 )
+        return 0;
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Performs delay-oriented mapping level by level using threads.]
+
+  Description [The cutsets of the nodes are allocated before the level is
+  processed and released after it, by the main thread in the topological
+  order. Within the level, thread i maps the nodes i, i + nThreads, etc,
+  of the level. Since each node reads only the cutsets and the best cuts
+  of the nodes with smaller levels, the result does not depend on the
+  number of threads and is the same as that of serial mapping. Between
+  the levels, the workers sleep on a condition variable.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct If_ParMan_t_
+{
+    pthread_mutex_t Mutex;     // protects the fields below
+    pthread_cond_t  CondStart; // signaled when a level is ready or the threads should stop
+    pthread_cond_t  CondDone;  // signaled when the last worker has finished the level
+    Vec_Int_t *     vLevel;    // the nodes of the current level
+    int             iRound;    // the number of levels given to the workers
+    int             nBusy;     // the number of workers mapping the current level
+    int             fStop;     // the workers should stop
+} If_ParMan_t;
+typedef struct If_ParThData_t_
+{
+    If_Man_t *      p;
+    If_ParMan_t *   pPar;
+    Vec_Int_t *     vLevel;    // the nodes of the current level
+    int             iThread;   // the thread number
+    int             nThreads;  // the number of threads
+    int             iRound;    // the last level mapped by this thread
+    int             fPreprocess;
+    int             fFirst;
+    int             nCuts;     // the number of cuts merged by this thread
+} If_ParThData_t;
+void If_ManParMapLevel( If_ParThData_t * pThData )
+{
+    If_Man_t * p = pThData->p;
+    int k;
+    for ( k = pThData->iThread; k < Vec_IntSize(pThData->vLevel); k += pThData->nThreads )
+        If_ObjPerformMappingAndInt( p, If_ManObj(p, Vec_IntEntry(pThData->vLevel, k)), 0, pThData->fPreprocess, pThData->fFirst, &pThData->nCuts );
+}
+void * If_ManParWorkerThread( void * pArg )
+{
+    If_ParThData_t * pThData = (If_ParThData_t *)pArg;
+    If_ParMan_t * pPar = pThData->pPar;
+    while ( 1 )
+    {
+        // sleep until the next level is ready
+        pthread_mutex_lock( &pPar->Mutex );
+        while ( !pPar->fStop && pPar->iRound == pThData->iRound )
+            pthread_cond_wait( &pPar->CondStart, &pPar->Mutex );
+        if ( pPar->fStop )
+        {
+            pthread_mutex_unlock( &pPar->Mutex );
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        pThData->iRound = pPar->iRound;
+        pThData->vLevel = pPar->vLevel;
+        pthread_mutex_unlock( &pPar->Mutex );
+        If_ManParMapLevel( pThData );
+        // report that the level is done
+        pthread_mutex_lock( &pPar->Mutex );
+        if ( --pPar->nBusy == 0 )
+            pthread_cond_signal( &pPar->CondDone );
+        pthread_mutex_unlock( &pPar->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+void If_ManPerformMappingPar( If_Man_t * p, int fPreprocess, int fFirst )
+{
+    If_ParMan_t Par, * pPar = &Par;
+    If_ParThData_t ThData[IF_PAR_THR_MAX];
+    pthread_t WorkerThread[IF_PAR_THR_MAX];
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel;
+    If_Obj_t * pObj;
+    int nThreads = Abc_MinInt( p->pPars->nProcs, IF_PAR_THR_MAX );
+    int i, k, iObj, status;
+    assert( If_ManPerformMappingParCheck(p) );
+    vLevels = If_ManLevelizeNodes( p );
+    memset( pPar, 0, sizeof(If_ParMan_t) );
+    pthread_mutex_init( &pPar->Mutex, NULL );
+    pthread_cond_init( &pPar->CondStart, NULL );
+    pthread_cond_init( &pPar->CondDone, NULL );
+    // start the threads (thread 0 is the main thread)
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].p           = p;
+        ThData[i].pPar        = pPar;
+        ThData[i].vLevel      = NULL;
+        ThData[i].iThread     = i;
+        ThData[i].nThreads    = nThreads;
+        ThData[i].iRound      = 0;
+        ThData[i].fPreprocess = fPreprocess;
+        ThData[i].fFirst      = fFirst;
+        ThData[i].nCuts       = 0;
+        if ( i == 0 )
+            continue;
+        status = pthread_create( WorkerThread + i, NULL, If_ManParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        if ( Vec_IntSize(vLevel) == 0 )
+            continue;
+        // prepare the cutsets
+        Vec_IntForEachEntry( vLevel, iObj, k )
+        {
+            pObj = If_ManObj( p, iObj );
+            pObj->EstRefs = (float)pObj->nRefs;
+            If_ManSetupNodeCutSet( p, pObj );
+        }
+        // map the nodes
+        ThData[0].vLevel = vLevel;
+        if ( Vec_IntSize(vLevel) < IF_PAR_LEVEL_MIN || nThreads == 1 )
+        {
+            ThData[0].nThreads = 1;
+            If_ManParMapLevel( ThData );
+            ThData[0].nThreads = nThreads;
+        }
+        else
+        {
+            // wake up the workers, map the share of the main thread, and wait for the rest
+            pthread_mutex_lock( &pPar->Mutex );
+            pPar->vLevel = vLevel;
+            pPar->nBusy  = nThreads - 1;
+            pPar->iRound++;
+            pthread_cond_broadcast( &pPar->CondStart );
+            pthread_mutex_unlock( &pPar->Mutex );
+            If_ManParMapLevel( ThData );
+            pthread_mutex_lock( &pPar->Mutex );
+            while ( pPar->nBusy > 0 )
+                pthread_cond_wait( &pPar->CondDone, &pPar->Mutex );
+            pthread_mutex_unlock( &pPar->Mutex );
+        }
+        // release the cutsets
+        Vec_IntForEachEntry( vLevel, iObj, k )
+        {
+            pObj = If_ManObj( p, iObj );
+            if ( If_ObjCutBest(pObj)->fUseless )
+                Abc_Print( 1, "The best cut is useless.\n" );
+            If_ManDerefNodeCutSet( p, pObj );
+        }
+    }
+    // stop the threads
+    pthread_mutex_lock( &pPar->Mutex );
+    pPar->fStop = 1;
+    pthread_cond_broadcast( &pPar->CondStart );
+    pthread_mutex_unlock( &pPar->Mutex );
+    for ( i = 1; i < nThreads; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    pthread_cond_destroy( &pPar->CondStart );
+    pthread_cond_destroy( &pPar->CondDone );
+    pthread_mutex_destroy( &pPar->Mutex );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        p->nCutsMerged += ThData[i].nCuts;
+        p->nCutsTotal  += ThData[i].nCuts;
+    }
+    Vec_WecFree( vLevels );
+}
+
+#else // pthreads are not used
+
+void If_ManPerformMappingPar( If_Man_t * p, int fPreprocess, int fFirst ) { assert( 0 ); }
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Performs one mapping pass over all nodes.]
@@ -658,6 +882,8 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( Mode == 0 && If_ManPerformMappingParCheck(p) )
+        If_ManPerformMappingPar( p, fPreprocess, fFirst );
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
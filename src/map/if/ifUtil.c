@@ -349,6 +349,75 @@ int If_ManCrossCut( If_Man_t * p )
     return nCutSizeMax;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the internal nodes by level.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * If_ManLevelizeNodes( If_Man_t * p )
+{
+    Vec_Wec_t * vLevels;
+    If_Obj_t * pObj;
+    int i;
+    vLevels = Vec_WecStart( p->nLevelMax + 1 );
+    If_ManForEachNode( p, pObj, i )
+        Vec_WecPush( vLevels, (int)pObj->Level, pObj->Id );
+    return vLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cross-cut of the circuit processed level by level.]
+
+  Description [All nodes of a level get their cutsets at once; the cutsets
+  are released after the whole level is processed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManCrossCutLevel( If_Man_t * p )
+{
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel;
+    If_Obj_t * pObj, * pFanin;
+    int i, k, iObj, nCutSize = 0, nCutSizeMax = 0;
+    assert( p->nChoices == 0 );
+    vLevels = If_ManLevelizeNodes( p );
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        // consider the nodes
+        nCutSize += Vec_IntSize(vLevel);
+        if ( nCutSizeMax < nCutSize )
+            nCutSizeMax = nCutSize;
+        Vec_IntForEachEntry( vLevel, iObj, k )
+        {
+            pObj = If_ManObj( p, iObj );
+            if ( pObj->nVisits == 0 )
+                nCutSize--;
+            // consider the fanins
+            pFanin = If_ObjFanin0(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin1(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+        }
+    }
+    If_ManForEachNode( p, pObj, i )
+        pObj->nVisits = pObj->nVisitsCopy;
+    assert( nCutSize == 0 );
+    Vec_WecFree( vLevels );
+    return nCutSizeMax;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the reverse topological order of nodes.]
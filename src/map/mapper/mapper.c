@@ -29,6 +29,7 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 static int Map_CommandReadLibrary ( Abc_Frame_t * pAbc, int argc, char **argv );
+static int Map_CommandWriteLibrary( Abc_Frame_t * pAbc, int argc, char **argv );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -48,6 +49,7 @@ static int Map_CommandReadLibrary ( Abc_Frame_t * pAbc, int argc, char **argv );
 void Map_Init( Abc_Frame_t * pAbc )
 {
     Cmd_CommandAdd( pAbc, "SC mapping", "read_super",  Map_CommandReadLibrary, 0 ); 
+    Cmd_CommandAdd( pAbc, "SC mapping", "write_super", Map_CommandWriteLibrary, 0 ); 
 }
 
 /**Function*************************************************************
@@ -168,6 +170,7 @@ int Map_CommandReadLibrary( Abc_Frame_t * pAbc, int argc, char **argv )
 usage:
     fprintf( pErr, "\nusage: read_super [-ovh]\n");
     fprintf( pErr, "\t         read the supergate library from the file\n" );  
+    fprintf( pErr, "\t         (the binary library written by \"write_super\" is recognized automatically)\n" );  
     fprintf( pErr, "\t-e file : file contains list of genlib gates to exclude\n" );
     fprintf( pErr, "\t-o      : toggles the use of old file format [default = %s]\n", (fAlgorithm? "new" : "old") );
     fprintf( pErr, "\t-v      : toggles enabling of verbose output [default = %s]\n", (fVerbose? "yes" : "no") );
@@ -175,6 +178,77 @@ usage:
     return 1;       /* error exit */
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Map_CommandWriteLibrary( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    FILE * pErr;
+    Map_SuperLib_t * pLib;
+    char * FileName;
+    int fVerbose;
+    int c;
+
+    pErr = Abc_FrameReadErr(pAbc);
+
+    // set the defaults
+    fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( (c = Extra_UtilGetopt(argc, argv, "vh")) != EOF ) 
+    {
+        switch (c) 
+        {
+            case 'v':
+                fVerbose ^= 1;
+                break;
+            case 'h':
+                goto usage;
+                break;
+            default:
+                goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    FileName = argv[globalUtilOptind];
+
+    // derive the supergate library if it is not available
+    pLib = (Map_SuperLib_t *)Abc_FrameReadLibSuper();
+    if ( pLib == NULL && Abc_FrameReadLibGen() )
+    {
+        Map_SuperLibDeriveFromGenlib( (Mio_Library_t *)Abc_FrameReadLibGen(), fVerbose );
+        pLib = (Map_SuperLib_t *)Abc_FrameReadLibSuper();
+    }
+    if ( pLib == NULL )
+    {
+        fprintf( pErr, "The supergate library is not available.\n" );
+        return 1;
+    }
+    if ( !Map_LibraryWriteBinary( pLib, FileName ) )
+        return 1;
+    if ( fVerbose )
+        printf( "Written %d supergates of library \"%s\" into binary file \"%s\" (%.2f MB).\n", 
+            pLib->nSupersReal, pLib->pName, FileName, 1.0*Extra_FileSize(FileName)/(1<<20) );
+    return 0;
+
+usage:
+    fprintf( pErr, "\nusage: write_super [-vh] <file>\n");
+    fprintf( pErr, "\t         writes the current supergate library into a binary file,\n" );  
+    fprintf( pErr, "\t         which can be loaded by \"read_super\" without recomputation\n" );  
+    fprintf( pErr, "\t-v      : toggles enabling of verbose output [default = %s]\n", (fVerbose? "yes" : "no") );
+    fprintf( pErr, "\t-h      : print the command usage\n");
+    return 1;       /* error exit */
+}
+
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
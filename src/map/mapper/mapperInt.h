@@ -397,10 +397,15 @@ extern float             Map_SwitchCutRef( Map_Node_t * pNode, Map_Cut_t * pCut,
 extern float             Map_SwitchCutDeref( Map_Node_t * pNode, Map_Cut_t * pCut, int fPhase );
 extern float             Map_MappingGetSwitching( Map_Man_t * pMan );
 /*=== mapperTree.c ===============================================================*/
+extern int               Map_LibraryDeriveGateInfoOne( Map_SuperLib_t * pLib, Map_Super_t * pGate );
 extern int               Map_LibraryDeriveGateInfo( Map_SuperLib_t * pLib, st__table * tExcludeGate );
 extern int               Map_LibraryReadFileTreeStr( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib, Vec_Str_t * vStr, char * pFileName );
 extern int               Map_LibraryReadTree( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib, char * pFileName, char * pExcludeFile );
 extern void              Map_LibraryPrintTree( Map_SuperLib_t * pLib );
+extern unsigned          Map_LibraryGenlibHash( Mio_Library_t * pGenlib );
+extern int               Map_LibraryWriteBinary( Map_SuperLib_t * pLib, char * pFileName );
+extern int               Map_LibraryIsBinary( char * pFileName );
+extern int               Map_LibraryReadBinary( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib, char * pFileName );
 /*=== mapperSuper.c ===============================================================*/
 extern int               Map_LibraryRead( Map_SuperLib_t * p, char * pFileName );
 extern void              Map_LibraryPrintSupergate( Map_Super_t * pGate );
@@ -408,6 +413,7 @@ extern void              Map_LibraryPrintSupergate( Map_Super_t * pGate );
 extern Map_HashTable_t * Map_SuperTableCreate( Map_SuperLib_t * pLib );
 extern void              Map_SuperTableFree( Map_HashTable_t * p );
 extern int               Map_SuperTableInsertC( Map_HashTable_t * pLib, unsigned uTruthC[], Map_Super_t * pGate );
+extern int               Map_SuperTableInsertCList( Map_HashTable_t * p, unsigned uTruthC[], Map_Super_t ** ppGates, int nGates );
 extern int               Map_SuperTableInsert( Map_HashTable_t * pLib, unsigned uTruth[], Map_Super_t * pGate, unsigned uPhase );
 extern Map_Super_t *     Map_SuperTableLookup( Map_HashTable_t * p, unsigned uTruth[], unsigned * puPhase );
 extern void              Map_SuperTableSortSupergates( Map_HashTable_t * p, int nSupersMax );
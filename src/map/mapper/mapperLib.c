@@ -51,7 +51,10 @@ ABC_NAMESPACE_IMPL_START
   indicates how the current truth table should be phase assigned to 
   match the canonical form of the supergate. The resulting phase is the
   bitwise EXOR of the phase needed to canonicize the supergate and the
-  phase needed to transform the truth table into its canonical form.]
+  phase needed to transform the truth table into its canonical form.
+  The supergate library written by "write_super" is loaded directly, 
+  without canonicizing the supergates. If it cannot be loaded, the 
+  supergates are derived from the genlib library.]
                
   SideEffects []
 
@@ -97,6 +100,26 @@ clk = Abc_Clock();
         }
         assert( p->nVarsMax > 0 );
     }
+    else if ( Map_LibraryIsBinary( pFileName ) )
+    {
+        if ( pExcludeFile != 0 )
+        {
+            Map_SuperLibFree( p );
+            printf ("Error: Exclude file support not present for binary format. Stop.\n");
+            return NULL;
+        }
+        if ( !Map_LibraryReadBinary( p, pGenlib, pFileName ) )
+        {
+            // derive the supergates from the genlib library, as if no library was given
+            Map_SuperLibFree( p );
+            if ( pGenlib == NULL || (vStr = Super_PrecomputeStr( pGenlib, 5, 1, 100000000, 10000000, 10000000, 100, 1, 0 )) == NULL )
+                return NULL;
+            printf( "Deriving the supergates from genlib library \"%s\" instead.\n", Mio_LibraryReadName(pGenlib) );
+            p = Map_SuperLibCreate( pGenlib, vStr, pFileName, NULL, 1, fVerbose );
+            Vec_StrFree( vStr );
+            return p;
+        }
+    }
     else if ( fAlgorithm )
     {
         if ( !Map_LibraryReadTree( p, pGenlib, pFileName, pExcludeFile ) )
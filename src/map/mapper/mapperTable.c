@@ -120,6 +120,53 @@ int Map_SuperTableInsertC( Map_HashTable_t * p, unsigned uTruthC[], Map_Super_t
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Inserts a new entry with the list of supergates.]
+
+  Description [This function creates the entry for the canonical form 
+  (uTruthC) and links the given supergates in the given order. It is used
+  when the supergates are already sorted, for example, when loading the
+  binary supergate library.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Map_SuperTableInsertCList( Map_HashTable_t * p, unsigned uTruthC[], Map_Super_t ** ppGates, int nGates )
+{
+    Map_HashEntry_t * pEnt;
+    unsigned Key;
+    int i;
+    assert( nGates > 0 );
+    // resize the table
+    if ( p->nEntries >= 2 * p->nBins )
+        Map_SuperTableResize( p );
+    // check that the entry does not exist
+    Key = MAP_TABLE_HASH( uTruthC[0], uTruthC[1], p->nBins );
+    for ( pEnt = p->pBins[Key]; pEnt; pEnt = pEnt->pNext )
+        if ( pEnt->uTruth[0] == uTruthC[0] && pEnt->uTruth[1] == uTruthC[1] )
+            return 0;
+    // add the new entry to the table
+    pEnt = (Map_HashEntry_t *)Extra_MmFixedEntryFetch( p->mmMan );
+    memset( pEnt, 0, sizeof(Map_HashEntry_t) );
+    pEnt->uTruth[0] = uTruthC[0];
+    pEnt->uTruth[1] = uTruthC[1];
+    pEnt->pNext   = p->pBins[Key];
+    p->pBins[Key] = pEnt;
+    p->nEntries++;
+    // link the supergates in the given order
+    for ( i = nGates - 1; i >= 0; i-- )
+    {
+        ppGates[i]->pNext = pEnt->pGates;
+        pEnt->pGates = ppGates[i];
+    }
+    // save the number of supergates in the list
+    pEnt->pGates->nSupers = nGates;
+    return 1;
+}
+
 
 
 /**Function*************************************************************
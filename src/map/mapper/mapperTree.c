@@ -32,10 +32,15 @@ ABC_NAMESPACE_IMPL_START
 static void      Map_LibraryAddFaninDelays( Map_SuperLib_t * pLib, Map_Super_t * pGate, Map_Super_t * pFanin, Mio_Pin_t * pPin );
 static int       Map_LibraryGetMaxSuperPi_rec( Map_Super_t * pGate );
 static unsigned  Map_LibraryGetGateSupp_rec( Map_Super_t * pGate );
+static void      Map_LibraryCreateElementaryGates( Map_SuperLib_t * pLib );
 
 // fanout limits
 static const int s_MapFanoutLimits[10] = { 1/*0*/, 10/*1*/, 5/*2*/, 2/*3*/, 1/*4*/, 1/*5*/, 1/*6*/ };
 
+// binary supergate library
+#define MAP_BINARY_HEADER   "ABC supergate library"
+#define MAP_BINARY_VER_NUM  1
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -377,6 +382,45 @@ int Map_LibraryCompareLibNames( char * pName1, char * pName2 )
     return RetValue; 
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Creates the elementary supergates.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Map_LibraryCreateElementaryGates( Map_SuperLib_t * pLib )
+{
+    Map_Super_t * pGate;
+    int i, k;
+    for ( i = 0; i < pLib->nVarsMax; i++ )
+    {
+        // get a new gate
+        pGate = (Map_Super_t *)Extra_MmFixedEntryFetch( pLib->mmSupers );
+        memset( pGate, 0, sizeof(Map_Super_t) );
+        // assign the elementary variable, the truth table, and the delays
+        pGate->Num = i;
+        // set the truth table
+        pGate->uTruth[0] = pLib->uTruths[i][0];
+        pGate->uTruth[1] = pLib->uTruths[i][1];
+        // set the arrival times of all input to non-existent delay
+        for ( k = 0; k < pLib->nVarsMax; k++ )
+        {
+            pGate->tDelaysR[k].Rise = pGate->tDelaysR[k].Fall = MAP_NO_VAR;
+            pGate->tDelaysF[k].Rise = pGate->tDelaysF[k].Fall = MAP_NO_VAR;
+        }
+        // set an existent arrival time for rise and fall
+        pGate->tDelaysR[i].Rise = 0.0;
+        pGate->tDelaysF[i].Fall = 0.0;
+        // set the gate
+        pLib->ppSupers[i] = pGate;
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the supergate library from file.]
@@ -394,7 +438,7 @@ int Map_LibraryReadFileTreeStr( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib,
     char pBuffer[5000];
     Map_Super_t * pGate;
     char * pTemp = 0, * pLibName;
-    int nCounter, k, i;
+    int nCounter, k;
     int RetValue, nPos = 0;
 
     // skip empty and comment lines
@@ -458,28 +502,7 @@ int Map_LibraryReadFileTreeStr( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib,
     pLib->ppSupers = ABC_ALLOC( Map_Super_t *, pLib->nLines + 10000 );
 
     // create the elementary supergates
-    for ( i = 0; i < pLib->nVarsMax; i++ )
-    {
-        // get a new gate
-        pGate = (Map_Super_t *)Extra_MmFixedEntryFetch( pLib->mmSupers );
-        memset( pGate, 0, sizeof(Map_Super_t) );
-        // assign the elementary variable, the truth table, and the delays
-        pGate->Num = i;
-        // set the truth table
-        pGate->uTruth[0] = pLib->uTruths[i][0];
-        pGate->uTruth[1] = pLib->uTruths[i][1];
-        // set the arrival times of all input to non-existent delay
-        for ( k = 0; k < pLib->nVarsMax; k++ )
-        {
-            pGate->tDelaysR[k].Rise = pGate->tDelaysR[k].Fall = MAP_NO_VAR;
-            pGate->tDelaysF[k].Rise = pGate->tDelaysF[k].Fall = MAP_NO_VAR;
-        }
-        // set an existent arrival time for rise and fall
-        pGate->tDelaysR[i].Rise = 0.0;
-        pGate->tDelaysF[i].Fall = 0.0;
-        // set the gate
-        pLib->ppSupers[i] = pGate;
-    }
+    Map_LibraryCreateElementaryGates( pLib );
 
     // read the lines
     nCounter = pLib->nVarsMax;
@@ -565,12 +588,377 @@ int Map_LibraryReadTree( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib, char *
     return Map_LibraryDeriveGateInfo( pLib, tExcludeGate );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes the signature of the genlib library.]
+
+  Description [The binary supergate library stores the supergate structure
+  and the canonical forms, which depend on the gate names, functions,
+  and areas. The delays are recomputed from the genlib library on loading.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+unsigned Map_LibraryGenlibHash( Mio_Library_t * pGenlib )
+{
+    Mio_Gate_t * pGate;
+    unsigned uHash = 0;
+    word uTruth;
+    char * pName;
+    int i;
+    for ( i = 0; i < Mio_LibraryReadGateNum(pGenlib); i++ )
+    {
+        pGate = Mio_LibraryReadGateById( pGenlib, i );
+        for ( pName = Mio_GateReadName(pGate); *pName; pName++ )
+            uHash = uHash * 31 + (unsigned char)*pName;
+        uTruth = Mio_GateReadTruth( pGate );
+        uHash = uHash * 31 + (unsigned)uTruth;
+        uHash = uHash * 31 + (unsigned)(uTruth >> 32);
+        uHash = uHash * 31 + (unsigned)Mio_GateReadPinNum( pGate );
+        uHash = uHash * 31 + (unsigned)(int)(1000 * Mio_GateReadArea( pGate ));
+    }
+    return uHash;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the supergate library in the binary format.]
 
+  Description [For each supergate, saves the root gate, the fanins, and
+  the phases of its N-canonical form. Then saves the N-canonical table
+  with the supergate lists in their sorted order. This way, loading the 
+  library does not parse the formulas, canonicize, and sort supergates.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Map_LibraryWriteBinary( Map_SuperLib_t * pLib, char * pFileName )
+{
+    Map_HashEntry_t * pEnt;
+    Map_Super_t * pGate;
+    Vec_Str_t * vStr;
+    FILE * pFile;
+    int i, k, nSupers, RetValue;
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open output file \"%s\".\n", pFileName );
+        return 0;
+    }
+    vStr = Vec_StrAlloc( 16 * pLib->nLines + 1000 );
+    Vec_StrPutS( vStr, MAP_BINARY_HEADER );
+    Vec_StrPutI_ne( vStr, MAP_BINARY_VER_NUM );
+    Vec_StrPutS( vStr, Mio_LibraryReadName(pLib->pGenlib) );
+    Vec_StrPutI_ne( vStr, (int)Map_LibraryGenlibHash(pLib->pGenlib) );
+    Vec_StrPutI( vStr, pLib->nVarsMax );
+    Vec_StrPutI( vStr, pLib->nSupersReal );
+    Vec_StrPutI( vStr, pLib->nLines );
+    // save the supergates
+    for ( i = pLib->nVarsMax; i < pLib->nLines; i++ )
+    {
+        pGate = pLib->ppSupers[i];
+        assert( pGate->Num == i );
+        Vec_StrPutI( vStr, (Mio_GateReadCell(pGate->pRoot) << 2) | (pGate->fExclude << 1) | pGate->fSuper );
+        for ( k = 0; k < (int)pGate->nFanins; k++ )
+        {
+            assert( pGate->pFanins[k]->Num < i );
+            Vec_StrPutI( vStr, i - pGate->pFanins[k]->Num );
+        }
+        if ( !pGate->fSuper || pGate->fExclude )
+            continue;
+        Vec_StrPutC( vStr, (char)pGate->nPhases );
+        for ( k = 0; k < (int)pGate->nPhases; k++ )
+            Vec_StrPutC( vStr, (char)pGate->uPhases[k] );
+    }
+    // save the table of N-canonical forms
+    Vec_StrPutI( vStr, pLib->tTableC->nEntries );
+    for ( i = 0; i < pLib->tTableC->nBins; i++ )
+        for ( pEnt = pLib->tTableC->pBins[i]; pEnt; pEnt = pEnt->pNext )
+        {
+            nSupers = 0;
+            for ( pGate = pEnt->pGates; pGate; pGate = pGate->pNext )
+                nSupers++;
+            Vec_StrPutI_ne( vStr, (int)pEnt->uTruth[0] );
+            Vec_StrPutI_ne( vStr, (int)pEnt->uTruth[1] );
+            Vec_StrPutI( vStr, nSupers );
+            for ( pGate = pEnt->pGates; pGate; pGate = pGate->pNext )
+                Vec_StrPutI( vStr, pGate->Num );
+        }
+    RetValue = (int)fwrite( Vec_StrArray(vStr), 1, (size_t)Vec_StrSize(vStr), pFile );
+    fclose( pFile );
+    if ( RetValue != Vec_StrSize(vStr) )
+        printf( "Writing file \"%s\" has failed.\n", pFileName );
+    RetValue = (RetValue == Vec_StrSize(vStr));
+    Vec_StrFree( vStr );
+    return RetValue;
+}
 
+/**Function*************************************************************
 
+  Synopsis    [Returns 1 if the file contains a binary supergate library.]
 
+  Description []
+               
+  SideEffects []
 
+  SeeAlso     []
 
+***********************************************************************/
+int Map_LibraryIsBinary( char * pFileName )
+{
+    char pBuffer[sizeof(MAP_BINARY_HEADER)] = {0};
+    FILE * pFile = fopen( pFileName, "rb" );
+    int RetValue;
+    if ( pFile == NULL )
+        return 0;
+    RetValue = (int)fread( pBuffer, 1, sizeof(MAP_BINARY_HEADER), pFile );
+    fclose( pFile );
+    return RetValue == (int)sizeof(MAP_BINARY_HEADER) && !memcmp( pBuffer, MAP_BINARY_HEADER, sizeof(MAP_BINARY_HEADER) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the supergate library in the binary format.]
+
+  Description [The supergates are restored in the same order and with 
+  the same lists of N-canonical forms as in the library that was written.
+  The truth tables, the delays, and the areas are derived from the current
+  genlib library.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Map_LibraryReadBinary( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib, char * pFileName )
+{
+    Map_Super_t * pGate, ** ppGates;
+    Vec_Str_t * vStr;
+    FILE * pFile;
+    unsigned uCanon[2];
+    char * pLibName, * pUsed;
+    int i, k, Entry, Num, nEntries, nSupers, nFileSize, RetValue, iStr = 0;
+    // read the file
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open input file \"%s\".\n", pFileName );
+        return 0;
+    }
+    nFileSize = Extra_FileSize( pFileName );
+    // pad the buffer with zeros to stop reading a truncated file at the end
+    vStr = Vec_StrStart( nFileSize + 16 );
+    RetValue = (int)fread( Vec_StrArray(vStr), 1, (size_t)nFileSize, pFile );
+    fclose( pFile );
+    if ( RetValue != nFileSize || strcmp( Vec_StrArray(vStr), MAP_BINARY_HEADER ) )
+    {
+        printf( "File \"%s\" is not a binary supergate library.\n", pFileName );
+        Vec_StrFree( vStr );
+        return 0;
+    }
+    iStr = sizeof(MAP_BINARY_HEADER);
+    if ( Vec_StrGetI_ne( vStr, &iStr ) != MAP_BINARY_VER_NUM )
+    {
+        printf( "Binary supergate library \"%s\" has unsupported version.\n", pFileName );
+        Vec_StrFree( vStr );
+        return 0;
+    }
+    pLibName = Vec_StrGetS( vStr, &iStr );
+    pLib->pGenlib = pGenlib;
+    if ( pGenlib == NULL || (unsigned)Vec_StrGetI_ne( vStr, &iStr ) != Map_LibraryGenlibHash(pGenlib) )
+    {
+        printf( "Supergate library \"%s\" requires the use of genlib library \"%s\".\n", pFileName, pLibName );
+        ABC_FREE( pLibName );
+        Vec_StrFree( vStr );
+        return 0;
+    }
+    ABC_FREE( pLibName );
+    pLib->nVarsMax    = Vec_StrGetI( vStr, &iStr );
+    pLib->nSupersReal = Vec_StrGetI( vStr, &iStr );
+    pLib->nLines      = Vec_StrGetI( vStr, &iStr );
+    if ( pLib->nVarsMax < 2 || pLib->nVarsMax > 6 || pLib->nLines < pLib->nVarsMax || pLib->nLines - pLib->nVarsMax > nFileSize )
+    {
+        printf( "Binary supergate library \"%s\" is corrupted.\n", pFileName );
+        Vec_StrFree( vStr );
+        return 0;
+    }
+    pLib->ppSupers = ABC_ALLOC( Map_Super_t *, pLib->nLines + 10000 );
+    Map_LibraryCreateElementaryGates( pLib );
+    // restore the supergates
+    for ( i = pLib->nVarsMax; i < pLib->nLines; i++ )
+    {
+        if ( iStr >= nFileSize )
+            break;
+        pGate = (Map_Super_t *)Extra_MmFixedEntryFetch( pLib->mmSupers );
+        memset( pGate, 0, sizeof(Map_Super_t) );
+        pGate->Num = i;
+        pLib->ppSupers[i] = pGate;
+        Entry = Vec_StrGetI( vStr, &iStr );
+        if ( Entry < 0 || (Entry >> 2) >= Mio_LibraryReadGateNum(pGenlib) || 
+             Mio_GateReadPinNum(Mio_LibraryReadGateById(pGenlib, Entry >> 2)) > 6 )
+            break;
+        pGate->fSuper    = (Entry & 1);
+        pGate->fExclude  = ((Entry >> 1) & 1);
+        pGate->pRoot     = Mio_LibraryReadGateById( pGenlib, Entry >> 2 );
+        pGate->nFanins   = Mio_GateReadPinNum( pGate->pRoot );
+        pGate->nFanLimit = s_MapFanoutLimits[ pGate->nFanins ];
+        for ( k = 0; k < (int)pGate->nFanins; k++ )
+        {
+            Num = i - Vec_StrGetI( vStr, &iStr );
+            if ( Num < 0 || Num >= i )
+                break;
+            pGate->pFanins[k] = pLib->ppSupers[Num];
+        }
+        if ( k < (int)pGate->nFanins )
+            break;
+        if ( !Map_LibraryDeriveGateInfoOne( pLib, pGate ) )
+            break;
+        if ( !pGate->fSuper || pGate->fExclude )
+            continue;
+        Num = Vec_StrGetC( vStr, &iStr );
+        if ( Num < 0 || Num > 4 )
+            break;
+        pGate->nPhases = Num;
+        for ( k = 0; k < (int)pGate->nPhases; k++ )
+            pGate->uPhases[k] = (unsigned char)Vec_StrGetC( vStr, &iStr );
+    }
+    if ( i < pLib->nLines )
+    {
+        printf( "Binary supergate library \"%s\" is corrupted.\n", pFileName );
+        Vec_StrFree( vStr );
+        return 0;
+    }
+    pLib->nSupersAll = pLib->nLines;
+    // restore the table of N-canonical forms
+    // (each supergate is linked into one list)
+    ppGates  = ABC_ALLOC( Map_Super_t *, pLib->nLines );
+    pUsed    = ABC_CALLOC( char, pLib->nLines );
+    nEntries = Vec_StrGetI( vStr, &iStr );
+    for ( i = 0; i < nEntries && iStr < nFileSize; i++ )
+    {
+        uCanon[0] = (unsigned)Vec_StrGetI_ne( vStr, &iStr );
+        uCanon[1] = (unsigned)Vec_StrGetI_ne( vStr, &iStr );
+        nSupers   = Vec_StrGetI( vStr, &iStr );
+        if ( nSupers < 1 || nSupers > pLib->nLines )
+            break;
+        for ( k = 0; k < nSupers; k++ )
+        {
+            Num = Vec_StrGetI( vStr, &iStr );
+            if ( Num < pLib->nVarsMax || Num >= pLib->nLines || !pLib->ppSupers[Num]->fSuper || pUsed[Num] )
+                break;
+            pUsed[Num] = 1;
+            ppGates[k] = pLib->ppSupers[Num];
+        }
+        if ( k < nSupers )
+            break;
+        if ( !Map_SuperTableInsertCList( pLib->tTableC, uCanon, ppGates, nSupers ) )
+            break;
+    }
+    ABC_FREE( ppGates );
+    ABC_FREE( pUsed );
+    Vec_StrFree( vStr );
+    if ( i < nEntries || iStr > nFileSize )
+    {
+        printf( "Binary supergate library \"%s\" is corrupted.\n", pFileName );
+        return 0;
+    }
+    return 1;
+}
+
+
+
+
+
+
+
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the truth table, delays, and area of one supergate.]
+
+  Description [Assumes that the fanins of the supergate are already derived.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Map_LibraryDeriveGateInfoOne( Map_SuperLib_t * pLib, Map_Super_t * pGate )
+{
+    Map_Super_t * pFanin;
+    Mio_Pin_t * pPin;
+    unsigned uTruths[6][2];
+    int k;
+
+    // collect the truth tables of the fanins
+    for ( k = 0; k < (int)pGate->nFanins; k++ )
+    {
+        pFanin = pGate->pFanins[k];
+        uTruths[k][0] = pFanin->uTruth[0];
+        uTruths[k][1] = pFanin->uTruth[1];
+    }
+    // derive the new truth table
+    Mio_DeriveTruthTable( pGate->pRoot, uTruths, pGate->nFanins, 6, pGate->uTruth );
+
+    // set the initial delays of the supergate
+    for ( k = 0; k < pLib->nVarsMax; k++ )
+    {
+        pGate->tDelaysR[k].Rise = pGate->tDelaysR[k].Fall = MAP_NO_VAR;
+        pGate->tDelaysF[k].Rise = pGate->tDelaysF[k].Fall = MAP_NO_VAR;
+    }
+    // get the linked list of pins for the given root gate
+    pPin = Mio_GateReadPins( pGate->pRoot );
+    // update the initial delay of the supergate using info from the corresponding pin
+    for ( k = 0; k < (int)pGate->nFanins; k++, pPin = Mio_PinReadNext(pPin) )
+    {
+        // if there is no corresponding pin, this is a bug, return fail
+        if ( pPin == NULL )
+        {
+            printf( "There are less pins than gate inputs.\n" );
+            return 0;
+        }
+        // update the delay information of k-th fanins info from the corresponding pin
+        Map_LibraryAddFaninDelays( pLib, pGate, pGate->pFanins[k], pPin );
+    }
+    // if there are some pins left, this is a bug, return fail
+    if ( pPin != NULL )
+    {
+        printf( "There are more pins than gate inputs.\n" );
+        return 0;
+    }
+    // find the max delay
+    pGate->tDelayMax.Rise = pGate->tDelayMax.Fall = MAP_NO_VAR;
+    for ( k = 0; k < pLib->nVarsMax; k++ )
+    {
+        // the rise of the output depends on the rise and fall of the output
+        if ( pGate->tDelayMax.Rise < pGate->tDelaysR[k].Rise )
+            pGate->tDelayMax.Rise = pGate->tDelaysR[k].Rise;
+        if ( pGate->tDelayMax.Rise < pGate->tDelaysR[k].Fall )
+            pGate->tDelayMax.Rise = pGate->tDelaysR[k].Fall;
+        // the fall of the output depends on the rise and fall of the output
+        if ( pGate->tDelayMax.Fall < pGate->tDelaysF[k].Rise )
+            pGate->tDelayMax.Fall = pGate->tDelaysF[k].Rise;
+        if ( pGate->tDelayMax.Fall < pGate->tDelaysF[k].Fall )
+            pGate->tDelayMax.Fall = pGate->tDelaysF[k].Fall;
+
+        pGate->tDelaysF[k].Worst = MAP_MAX( pGate->tDelaysF[k].Fall, pGate->tDelaysF[k].Rise );
+        pGate->tDelaysR[k].Worst = MAP_MAX( pGate->tDelaysR[k].Fall, pGate->tDelaysR[k].Rise );
+    }
+
+    // count gates and area of the supergate
+    pGate->nGates = 1;
+    pGate->Area   = (float)Mio_GateReadArea(pGate->pRoot);
+    for ( k = 0; k < (int)pGate->nFanins; k++ )
+    {
+        pGate->nGates += pGate->pFanins[k]->nGates;
+        pGate->Area   += pGate->pFanins[k]->Area;
+    }
+    return 1;
+}
 
 /**Function*************************************************************
 
@@ -586,9 +974,7 @@ int Map_LibraryReadTree( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib, char *
 int Map_LibraryDeriveGateInfo( Map_SuperLib_t * pLib, st__table * tExcludeGate )
 {
     Map_Super_t * pGate, * pFanin;
-    Mio_Pin_t * pPin;
     unsigned uCanon[2];
-    unsigned uTruths[6][2];
     int i, k, nRealVars;
 
     // set all the derivable info related to the supergates
@@ -611,69 +997,9 @@ int Map_LibraryDeriveGateInfo( Map_SuperLib_t * pLib, st__table * tExcludeGate )
             }
         }
         
-        // collect the truth tables of the fanins
-        for ( k = 0; k < (int)pGate->nFanins; k++ )
-        {
-            pFanin = pGate->pFanins[k];
-            uTruths[k][0] = pFanin->uTruth[0];
-            uTruths[k][1] = pFanin->uTruth[1];
-        }
-        // derive the new truth table
-        Mio_DeriveTruthTable( pGate->pRoot, uTruths, pGate->nFanins, 6, pGate->uTruth );
-
-        // set the initial delays of the supergate
-        for ( k = 0; k < pLib->nVarsMax; k++ )
-        {
-            pGate->tDelaysR[k].Rise = pGate->tDelaysR[k].Fall = MAP_NO_VAR;
-            pGate->tDelaysF[k].Rise = pGate->tDelaysF[k].Fall = MAP_NO_VAR;
-        }
-        // get the linked list of pins for the given root gate
-        pPin = Mio_GateReadPins( pGate->pRoot );
-        // update the initial delay of the supergate using info from the corresponding pin
-        for ( k = 0; k < (int)pGate->nFanins; k++, pPin = Mio_PinReadNext(pPin) )
-        {
-            // if there is no corresponding pin, this is a bug, return fail
-            if ( pPin == NULL )
-            {
-                printf( "There are less pins than gate inputs.\n" );
-                return 0;
-            }
-            // update the delay information of k-th fanins info from the corresponding pin
-            Map_LibraryAddFaninDelays( pLib, pGate, pGate->pFanins[k], pPin );
-        }
-        // if there are some pins left, this is a bug, return fail
-        if ( pPin != NULL )
-        {
-            printf( "There are more pins than gate inputs.\n" );
+        // derive the truth table, the delays, and the area
+        if ( !Map_LibraryDeriveGateInfoOne( pLib, pGate ) )
             return 0;
-        }
-        // find the max delay
-        pGate->tDelayMax.Rise = pGate->tDelayMax.Fall = MAP_NO_VAR;
-        for ( k = 0; k < pLib->nVarsMax; k++ )
-        {
-            // the rise of the output depends on the rise and fall of the output
-            if ( pGate->tDelayMax.Rise < pGate->tDelaysR[k].Rise )
-                pGate->tDelayMax.Rise = pGate->tDelaysR[k].Rise;
-            if ( pGate->tDelayMax.Rise < pGate->tDelaysR[k].Fall )
-                pGate->tDelayMax.Rise = pGate->tDelaysR[k].Fall;
-            // the fall of the output depends on the rise and fall of the output
-            if ( pGate->tDelayMax.Fall < pGate->tDelaysF[k].Rise )
-                pGate->tDelayMax.Fall = pGate->tDelaysF[k].Rise;
-            if ( pGate->tDelayMax.Fall < pGate->tDelaysF[k].Fall )
-                pGate->tDelayMax.Fall = pGate->tDelaysF[k].Fall;
-
-            pGate->tDelaysF[k].Worst = MAP_MAX( pGate->tDelaysF[k].Fall, pGate->tDelaysF[k].Rise );
-            pGate->tDelaysR[k].Worst = MAP_MAX( pGate->tDelaysR[k].Fall, pGate->tDelaysR[k].Rise );
-        }
-
-        // count gates and area of the supergate
-        pGate->nGates = 1;
-        pGate->Area   = (float)Mio_GateReadArea(pGate->pRoot);
-        for ( k = 0; k < (int)pGate->nFanins; k++ )
-        {
-            pGate->nGates += pGate->pFanins[k]->nGates;
-            pGate->Area   += pGate->pFanins[k]->Area;
-        }
         // do not add the gate to the table, if this gate is an internal gate
         // of some supegate and does not correspond to a supergate output
         if ( ( !pGate->fSuper ) || pGate->fExclude )
@@ -289,6 +289,7 @@ int Mio_CommandReadGenlib( Abc_Frame_t * pAbc, int argc, char **argv )
     Amap_Lib_t * pLib2;
     char * pFileName;
     char * pExcludeFile = NULL;
+    char * pRulesFile = NULL;
     double WireDelay = 0.0;
     int fShortNames = 0;
     int nFaninLimit = 0;
@@ -297,7 +298,7 @@ int Mio_CommandReadGenlib( Abc_Frame_t * pAbc, int argc, char **argv )
     pOut = Abc_FrameReadOut(pAbc);
     pErr = Abc_FrameReadErr(pAbc);
     Extra_UtilGetoptReset();
-    while ( (c = Extra_UtilGetopt(argc, argv, "WEKnvh")) != EOF ) 
+    while ( (c = Extra_UtilGetopt(argc, argv, "WERKnvh")) != EOF ) 
     {
         switch (c) 
         {
@@ -321,6 +322,15 @@ int Mio_CommandReadGenlib( Abc_Frame_t * pAbc, int argc, char **argv )
                 pExcludeFile = argv[globalUtilOptind];
                 globalUtilOptind++;
                 break;
+            case 'R':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-R\" should be followed by a file name.\n" );
+                    goto usage;
+                }
+                pRulesFile = argv[globalUtilOptind];
+                globalUtilOptind++;
+                break;
             case 'K':
                 if ( globalUtilOptind >= argc )
                 {
@@ -382,7 +392,7 @@ int Mio_CommandReadGenlib( Abc_Frame_t * pAbc, int argc, char **argv )
     Mio_UpdateGenlib( pLib );
 
     // replace the current library
-    pLib2 = Amap_LibReadAndPrepare( pFileName, NULL, 0, 0 );  
+    pLib2 = Amap_LibReadAndPrepareRules( pFileName, NULL, pRulesFile, 0, 0 );  
     if ( pLib2 == NULL )
     {
         fprintf( pErr, "Reading second genlib library has failed.\n" );
@@ -392,13 +402,15 @@ int Mio_CommandReadGenlib( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pErr, "usage: read_genlib [-W float] [-E filename] [-K num] [-nvh]\n");
+    fprintf( pErr, "usage: read_genlib [-W float] [-E filename] [-R filename] [-K num] [-nvh]\n");
     fprintf( pErr, "\t           read the library from a genlib file\n" );  
     fprintf( pErr, "\t           (if the library contains more than one gate\n" );  
     fprintf( pErr, "\t           with the same Boolean function, only the gate\n" );  
     fprintf( pErr, "\t           with the smallest area will be used)\n" );  
     fprintf( pErr, "\t-W float : wire delay (added to pin-to-pin gate delays) [default = %g]\n", WireDelay );  
     fprintf( pErr, "\t-E file  : the file name with gates to be excluded [default = none]\n" );
+    fprintf( pErr, "\t-R file  : the file name with the rules of the mapper \"amap\" (written if missing\n" );
+    fprintf( pErr, "\t           or created for another library) [default = none]\n" );
     fprintf( pErr, "\t-K num   : the max number of gate fanins (0 = no limit) [default = %d]\n", nFaninLimit );
     fprintf( pErr, "\t-n       : toggle replacing gate/pin names by short strings [default = %s]\n", fShortNames? "yes": "no" );
     fprintf( pErr, "\t-v       : toggle verbose printout [default = %s]\n", fVerbose? "yes": "no" );
@@ -141,7 +141,7 @@ void Scl_End( Abc_Frame_t * pAbc )
   SeeAlso     []
 
 ***********************************************************************/
-SC_Lib * Scl_ReadLibraryFile( Abc_Frame_t * pAbc, char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use )
+SC_Lib * Scl_ReadLibraryFile( Abc_Frame_t * pAbc, char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use, int nProcs, int fUseCache )
 {
     SC_Lib * pLib;
     FILE * pFile;
@@ -152,7 +152,7 @@ SC_Lib * Scl_ReadLibraryFile( Abc_Frame_t * pAbc, char * pFileName, int fVerbose
     }
     fclose( pFile );
     // read new library
-    pLib = Abc_SclReadLiberty( pFileName, fVerbose, fVeryVerbose, dont_use);
+    pLib = Abc_SclReadLibertyPar( pFileName, fVerbose, fVeryVerbose, dont_use, nProcs, fUseCache );
     if ( pLib == NULL )
     {
         fprintf( pAbc->Err, "Reading SCL library from file \"%s\" has failed. \n", pFileName );
@@ -179,19 +179,22 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
     float Slew = 0;
     float Gain = 0;
     int nGatesMin = 0;
+    int nProcs = 1;
+    int fUseCache = 0;
     int fShortNames = 0;
     int fUnit = 0;
     int fVerbose = 1;
     int fVeryVerbose = 0;
     int fMerge = 0;
     int fUsePrefix = 0;
+    int fAddCorner = 0;
     
     SC_DontUse dont_use = {0};
     dont_use.dont_use_list = ABC_ALLOC(char *, argc);
     dont_use.size = 0;
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "SGMXdnuvwmph" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "SGMPXdnuvwmpcah" ) ) != EOF )
     {
         switch ( c )
         {
@@ -228,6 +231,20 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nGatesMin < 0 ) 
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs < 1 || nProcs > 100 ) 
+            {
+                Abc_Print( -1, "The number of threads (%d) should be between 1 and 100.\n", nProcs );
+                goto usage;
+            }
+            break;
         case 'X':
             if ( globalUtilOptind >= argc )
             {
@@ -259,15 +276,45 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'p':
             fUsePrefix ^= 1;
             break;            
+        case 'c':
+            fUseCache ^= 1;
+            break;
+        case 'a':
+            fAddCorner ^= 1;
+            break;
         case 'h':
             goto usage;
         default:
             goto usage;
         }
     }
+    if ( fAddCorner ) {
+        SC_Lib * pLibMain = (SC_Lib *)pAbc->pLibScl;
+        if ( argc != globalUtilOptind + 1 ) {
+            ABC_FREE(dont_use.dont_use_list);
+            goto usage;
+        }
+        if ( pLibMain == NULL ) {
+            ABC_FREE(dont_use.dont_use_list);
+            fprintf( pAbc->Err, "There is no current library to add the timing corner to.\n" );
+            return 1;
+        }
+        pLib = Scl_ReadLibraryFile( pAbc, argv[globalUtilOptind], fVerbose, fVeryVerbose, dont_use, nProcs, fUseCache );
+        ABC_FREE(dont_use.dont_use_list);
+        if ( pLib == NULL )
+            return 1;
+        if ( !Abc_SclLibAddCorner( pLibMain, pLib ) ) {
+            fprintf( pAbc->Err, "Library \"%s\" cannot be used as a timing corner of library \"%s\".\n", pLib->pName, pLibMain->pName );
+            Abc_SclLibFree( pLib );
+            return 1;
+        }
+        if ( fVerbose )
+            printf( "Library \"%s\" is added as timing corner %d of library \"%s\".\n", pLib->pName, SC_LibCornerNum(pLibMain), pLibMain->pName );
+        return 0;
+    }
     if ( argc == globalUtilOptind + 2 ) { // expecting two files
-        SC_Lib * pLib1 = Scl_ReadLibraryFile( pAbc, argv[globalUtilOptind],   fVerbose, fVeryVerbose, dont_use );
-        SC_Lib * pLib2 = Scl_ReadLibraryFile( pAbc, argv[globalUtilOptind+1], fVerbose, fVeryVerbose, dont_use );        
+        SC_Lib * pLib1 = Scl_ReadLibraryFile( pAbc, argv[globalUtilOptind],   fVerbose, fVeryVerbose, dont_use, nProcs, fUseCache );
+        SC_Lib * pLib2 = Scl_ReadLibraryFile( pAbc, argv[globalUtilOptind+1], fVerbose, fVeryVerbose, dont_use, nProcs, fUseCache );        
         ABC_FREE(dont_use.dont_use_list);
         if ( pLib1 == NULL || pLib2 == NULL ) {
             if (pLib1) Abc_SclLibFree(pLib1);
@@ -279,7 +326,7 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_SclLibFree(pLib2);
     }
     else if ( argc == globalUtilOptind + 1 ) { // expecting one file
-        SC_Lib * pLib1 = Scl_ReadLibraryFile( pAbc, argv[globalUtilOptind], fVerbose, fVeryVerbose, dont_use );
+        SC_Lib * pLib1 = Scl_ReadLibraryFile( pAbc, argv[globalUtilOptind], fVerbose, fVeryVerbose, dont_use, nProcs, fUseCache );
 
         SC_Lib * pLib_ext = (SC_Lib *)pAbc->pLibScl;
         if ( fMerge && pLib_ext != NULL && pLib1 != NULL ) {
@@ -302,6 +349,9 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_SclLibFree(pLib);
         return 0;
     }
+    // keep the timing corners of the current library
+    if ( pAbc->pLibScl && pAbc->pLibScl != pLib )
+        Abc_SclLibTransferCorners( (SC_Lib *)pAbc->pLibScl, pLib );
     Abc_SclLoad( pLib, (SC_Lib **)&pAbc->pLibScl );
     // convert the library if needed
     if ( fShortNames )
@@ -324,11 +374,12 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_lib [-SG float] [-M num] [-dnuvwmph] [-X cell_name] <file> <file2>\n" );
+    fprintf( pAbc->Err, "usage: read_lib [-SG float] [-MP num] [-dnuvwmpcah] [-X cell_name] <file> <file2>\n" );
     fprintf( pAbc->Err, "\t           reads Liberty library from file\n" );
     fprintf( pAbc->Err, "\t-S float : the slew parameter used to generate the library [default = %.2f]\n", Slew );
     fprintf( pAbc->Err, "\t-G float : the gain parameter used to generate the library [default = %.2f]\n", Gain );
     fprintf( pAbc->Err, "\t-M num   : skip gate classes whose size is less than this [default = %d]\n", nGatesMin );
+    fprintf( pAbc->Err, "\t-P num   : the number of threads used to parse the file (1 <= num <= 100) [default = %d]\n", nProcs );
     fprintf( pAbc->Err, "\t-X name  : adds name to the list of cells ABC shouldn't use. Flag can be passed multiple times\n");
     fprintf( pAbc->Err, "\t-d       : toggle dumping the parsed library into file \"*_temp.lib\" [default = %s]\n", fDump? "yes": "no" );
     fprintf( pAbc->Err, "\t-n       : toggle replacing gate/pin names by short strings [default = %s]\n", fShortNames? "yes": "no" );
@@ -337,6 +388,8 @@ usage:
     fprintf( pAbc->Err, "\t-w       : toggle writing information about skipped gates [default = %s]\n", fVeryVerbose? "yes": "no" );
     fprintf( pAbc->Err, "\t-m       : toggle merging library with exisiting library [default = %s]\n", fMerge? "yes": "no" );
     fprintf( pAbc->Err, "\t-p       : toggle using prefix for the cell names [default = %s]\n", fUsePrefix? "yes": "no" );
+    fprintf( pAbc->Err, "\t-c       : toggle using compiled library cache \"<file>.scl_cache\" [default = %s]\n", fUseCache? "yes": "no" );
+    fprintf( pAbc->Err, "\t-a       : toggle adding the library as a timing corner of the current library (corners are kept when a new library is read) [default = %s]\n", fAddCorner? "yes": "no" );
     fprintf( pAbc->Err, "\t-h       : prints the command summary\n" );
     fprintf( pAbc->Err, "\t<file>   : the name of a file to read\n" );
     fprintf( pAbc->Err, "\t<file2>  : the name of a file to read (optional)\n" );    
@@ -1461,13 +1514,14 @@ int Scl_CommandUpsize( Abc_Frame_t * pAbc, int argc, char **argv )
     pPars->TimeOut       =    0;
     pPars->BuffTreeEst   =    0;
     pPars->BypassFreq    =    0;
+    pPars->nProcs        =    1;
     pPars->fUseDept      =    1;
     pPars->fUseWireLoads =    0;
     pPars->fDumpStats    =    0;
     pPars->fVerbose      =    0;
     pPars->fVeryVerbose  =    0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "IJWRNDGTXBcsdvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "IJWRNDGTXBPcsdvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -1579,6 +1633,17 @@ int Scl_CommandUpsize( Abc_Frame_t * pAbc, int argc, char **argv )
             if ( pPars->BypassFreq < 0 ) 
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 1 || pPars->nProcs > 100 ) 
+                goto usage;
+            break;
         case 'c':
             pPars->fUseWireLoads ^= 1;
             break;
@@ -1626,7 +1691,7 @@ int Scl_CommandUpsize( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: upsize [-IJWRNDGTXB num] [-csdvwh]\n" );
+    fprintf( pAbc->Err, "usage: upsize [-IJWRNDGTXBP num] [-csdvwh]\n" );
     fprintf( pAbc->Err, "\t           selectively increases gate sizes on the critical path\n" );
     fprintf( pAbc->Err, "\t-I <num> : the number of upsizing iterations to perform [default = %d]\n", pPars->nIters );
     fprintf( pAbc->Err, "\t-J <num> : the number of iterations without improvement to stop [default = %d]\n", pPars->nIterNoChange );
@@ -1638,6 +1703,7 @@ usage:
     fprintf( pAbc->Err, "\t-T <num> : approximate timeout in seconds [default = %d]\n", pPars->TimeOut );
     fprintf( pAbc->Err, "\t-X <num> : ratio for buffer tree estimation [default = %d]\n", pPars->BuffTreeEst );
     fprintf( pAbc->Err, "\t-B <num> : frequency of bypass transforms [default = %d]\n", pPars->BypassFreq );
+    fprintf( pAbc->Err, "\t-P <num> : the number of threads to evaluate upsizing candidates (1 <= num <= 100) [default = %d]\n", pPars->nProcs );
     fprintf( pAbc->Err, "\t-c       : toggle using wire-loads if specified [default = %s]\n", pPars->fUseWireLoads? "yes": "no" );
     fprintf( pAbc->Err, "\t-s       : toggle using slack based on departure times [default = %s]\n", pPars->fUseDept? "yes": "no" );
     fprintf( pAbc->Err, "\t-d       : toggle dumping statistics into a file [default = %s]\n", pPars->fDumpStats? "yes": "no" );
@@ -47,6 +47,7 @@ struct Bus_Man_t_
     Vec_Flt_t *    vLoads;     // loads for all nodes
     Vec_Flt_t *    vDepts;     // departure times
     Vec_Ptr_t *    vFanouts;   // fanout array
+    double         LoadCins;   // input cap of the fanouts in the array
 };
 
 
@@ -281,41 +282,97 @@ int Bus_SclCompareFanouts( Abc_Obj_t ** pp1, Abc_Obj_t ** pp2 )
         return 1;
     return -1;
 }
-void Bus_SclInsertFanout( Vec_Ptr_t * vFanouts, Abc_Obj_t * pObj )
+
+/**Function*************************************************************
+
+  Synopsis    [Priority queue of fanouts ordered by departure times.]
+
+  Description [The queue is a binary heap stored in the fanout array.
+  Its top is the fanout that comes first in the order given by 
+  Bus_SclCompareFanouts(), so a sorted array is a valid queue.
+  Taking a fanout and adding a new inverter both take O(log n).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Bus_SclHeapLess( Abc_Obj_t * p1, Abc_Obj_t * p2 )
 {
-    Abc_Obj_t * pCur;
-    int i, k;
-    // compact array
-    for ( i = k = 0; i < Vec_PtrSize(vFanouts); i++ )
-        if ( Vec_PtrEntry(vFanouts, i) != NULL )
-            Vec_PtrWriteEntry( vFanouts, k++, Vec_PtrEntry(vFanouts, i) );
-    Vec_PtrShrink( vFanouts, k );
-    // insert new entry
-    Vec_PtrPush( vFanouts, pObj );
-    for ( i = Vec_PtrSize(vFanouts) - 1; i > 0; i-- )
+    return Bus_SclCompareFanouts( &p1, &p2 ) == -1;
+}
+void Bus_SclHeapPush( Vec_Ptr_t * vHeap, Abc_Obj_t * pObj )
+{
+    void ** pArray;
+    int i, iParent;
+    Vec_PtrPush( vHeap, pObj );
+    pArray = Vec_PtrArray( vHeap );
+    for ( i = Vec_PtrSize(vHeap) - 1; i > 0; i = iParent )
     {
-        pCur = (Abc_Obj_t *)Vec_PtrEntry(vFanouts, i-1);
-        pObj = (Abc_Obj_t *)Vec_PtrEntry(vFanouts, i);
-        if ( Bus_SclCompareFanouts( &pCur, &pObj ) == -1 )
+        iParent = (i - 1) >> 1;
+        if ( !Bus_SclHeapLess( pObj, (Abc_Obj_t *)pArray[iParent] ) )
             break;
-        ABC_SWAP( void *, Vec_PtrArray(vFanouts)[i-1], Vec_PtrArray(vFanouts)[i] );
+        pArray[i] = pArray[iParent];
     }
+    pArray[i] = pObj;
 }
-void Bus_SclCheckSortedFanout( Vec_Ptr_t * vFanouts )
+Abc_Obj_t * Bus_SclHeapPop( Vec_Ptr_t * vHeap )
 {
-    Abc_Obj_t * pObj, * pNext;
-    int i;
-    for ( i = 0; i < Vec_PtrSize(vFanouts) - 1; i++ )
+    void ** pArray = Vec_PtrArray( vHeap );
+    Abc_Obj_t * pTop  = (Abc_Obj_t *)pArray[0];
+    Abc_Obj_t * pLast = (Abc_Obj_t *)Vec_PtrPop( vHeap );
+    int i = 0, iChild, nSize = Vec_PtrSize( vHeap );
+    if ( nSize == 0 )
+        return pTop;
+    while ( (iChild = 2 * i + 1) < nSize )
     {
-        pObj  = (Abc_Obj_t *)Vec_PtrEntry(vFanouts, i);
-        pNext = (Abc_Obj_t *)Vec_PtrEntry(vFanouts, i+1);
-        if ( Bus_SclCompareFanouts( &pObj, &pNext ) != -1 )
-        {
-            printf( "Fanouts %d and %d are out of order.\n", i, i+1 );
-            Abc_NtkPrintFanoutProfileVec( NULL, vFanouts );
-            return;
-        }
+        if ( iChild + 1 < nSize && Bus_SclHeapLess( (Abc_Obj_t *)pArray[iChild+1], (Abc_Obj_t *)pArray[iChild] ) )
+            iChild++;
+        if ( !Bus_SclHeapLess( (Abc_Obj_t *)pArray[iChild], pLast ) )
+            break;
+        pArray[i] = pArray[iChild];
+        i = iChild;
+    }
+    pArray[i] = pLast;
+    return pTop;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves one fanout of the node to the new inverter.]
+
+  Description [The fanout is not removed from the fanout array of the node, 
+  which would take linear time for each moved fanout. Instead, the number 
+  of moved fanin entries is recorded in the fanout, and the array is 
+  compacted once per net by Bus_SclCompactFanouts().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bus_SclMoveFanout( Abc_Obj_t * pFanout, Abc_Obj_t * pObj, Abc_Obj_t * pInv )
+{
+    Abc_ObjPatchFaninNoFanout( pFanout, pObj, pInv );
+    if ( !Abc_NodeIsTravIdCurrent(pFanout) )
+    {
+        Abc_NodeSetTravIdCurrent( pFanout );
+        pFanout->iTemp = 0;
     }
+    pFanout->iTemp++;
+}
+void Bus_SclCompactFanouts( Abc_Obj_t * pObj )
+{
+    Abc_Obj_t * pFanout;
+    int i, k = 0;
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+    {
+        if ( Abc_NodeIsTravIdCurrent(pFanout) && pFanout->iTemp > 0 )
+            pFanout->iTemp--;
+        else
+            Vec_IntWriteEntry( &pObj->vFanouts, k++, Abc_ObjId(pFanout) );
+    }
+    Vec_IntShrink( &pObj->vFanouts, k );
 }
 
 /**Function*************************************************************
@@ -347,19 +404,7 @@ Abc_Obj_t * Abc_SclAddOneInv( Bus_Man_t * p, Abc_Obj_t * pObj, Vec_Ptr_t * vFano
     float Target = SC_CellPinCap(p->pInv, 0) * Gain;
     float LoadWirePrev, LoadWireThis, Load = 0;
     int Limit = Abc_MinInt( p->pPars->nDegree, Vec_PtrSize(vFanouts) );
-    int i, iStop;
-    Bus_SclCheckSortedFanout( vFanouts );
-    Vec_PtrForEachEntryStop( Abc_Obj_t *, vFanouts, pFanout, iStop, Limit )
-    {
-        LoadWirePrev = Abc_SclFindWireLoad( p->vWireCaps, iStop );
-        LoadWireThis = Abc_SclFindWireLoad( p->vWireCaps, iStop+1 );
-        Load += Bus_SclObjCin( pFanout ) - LoadWirePrev + LoadWireThis;
-        if ( Load > Target )
-        {
-            iStop++;
-            break;
-        }
-    }
+    int iStop;
     // create inverter
     if ( p->pPars->fAddBufs )
         pInv = Abc_NtkCreateNodeBuf( p->pNtk, NULL );
@@ -370,14 +415,22 @@ Abc_Obj_t * Abc_SclAddOneInv( Bus_Man_t * p, Abc_Obj_t * pObj, Vec_Ptr_t * vFano
     Vec_FltPush( p->vETimes, 0 );
     Vec_FltPush( p->vLoads,  0 );
     Vec_FltPush( p->vDepts,  0 );
-    Limit = Abc_MinInt( Abc_MaxInt(iStop, 2), Vec_PtrSize(vFanouts) );
-    Vec_PtrForEachEntryStop( Abc_Obj_t *, vFanouts, pFanout, i, Limit )
+    // move the earliest fanouts to the inverter until the target load is reached
+    for ( iStop = 0; iStop < Limit || (iStop < 2 && Vec_PtrSize(vFanouts) > 0); iStop++ )
     {
-        Vec_PtrWriteEntry( vFanouts, i, NULL );
+        pFanout = Bus_SclHeapPop( vFanouts );
+        p->LoadCins -= Bus_SclObjCin( pFanout );
         if ( Abc_ObjFaninNum(pFanout) == 0 )
             Abc_ObjAddFanin( pFanout, pInv );
         else
-            Abc_ObjPatchFanin( pFanout, pObj, pInv );
+            Bus_SclMoveFanout( pFanout, pObj, pInv );
+        if ( iStop >= Limit ) // the second fanout is added without counting its load
+            continue;
+        LoadWirePrev = Abc_SclFindWireLoad( p->vWireCaps, iStop );
+        LoadWireThis = Abc_SclFindWireLoad( p->vWireCaps, iStop+1 );
+        Load += Bus_SclObjCin( pFanout ) - LoadWirePrev + LoadWireThis;
+        if ( Load > Target )
+            Limit = iStop + 1;
     }
     // set the gate
     pCellNew = Abc_SclFindSmallestGate( p->pInv, Load / Gain );
@@ -435,6 +488,10 @@ void Abc_SclBufSize( Bus_Man_t * p, float Gain )
 //            Abc_NtkPrintFanoutProfile( pObj );
             Abc_NodeCollectFanouts( pObj, p->vFanouts );
             Vec_PtrSort( p->vFanouts, (int(*)(const void *, const void *))Bus_SclCompareFanouts );
+            p->LoadCins = 0;
+            Vec_PtrForEachEntry( Abc_Obj_t *, p->vFanouts, pFanout, k )
+                p->LoadCins += Bus_SclObjCin( pFanout );
+            Abc_NtkIncrementTravId( p->pNtk );
             do 
             {
                 Abc_Obj_t * pInv;
@@ -443,11 +500,13 @@ void Abc_SclBufSize( Bus_Man_t * p, float Gain )
                 pInv = Abc_SclAddOneInv( p, pObj, p->vFanouts, GainInv );
                 if ( p->pPars->fVeryVerbose )
                     Abc_SclOneNodePrint( p, pInv );
-                Bus_SclInsertFanout( p->vFanouts, pInv );
-                Load = Abc_NtkComputeFanoutLoad( p, p->vFanouts );
+                Bus_SclHeapPush( p->vFanouts, pInv );
+                p->LoadCins += Bus_SclObjCin( pInv );
+                Load = Abc_SclFindWireLoad( p->vWireCaps, Vec_PtrSize(p->vFanouts) ) + (float)p->LoadCins;
             }
             while ( Vec_PtrSize(p->vFanouts) > p->pPars->nDegree || (Vec_PtrSize(p->vFanouts) > 1 && Load > GainGate * Cin) );
             // update node fanouts
+            Bus_SclCompactFanouts( pObj );
             Vec_PtrForEachEntry( Abc_Obj_t *, p->vFanouts, pFanout, k )
                 if ( Abc_ObjFaninNum(pFanout) == 0 )
                     Abc_ObjAddFanin( pFanout, pObj );
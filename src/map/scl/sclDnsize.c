@@ -343,7 +343,7 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
 
     // save the result and quit
     Abc_SclSclGates2MioGates( pLib, pNtk ); // updates gate pointers
-    Abc_SclManFree( p );
+    Abc_SclManStore( p, pPars->fUseDept );
 //    Abc_NtkCleanMarkAB( pNtk );
 }
 
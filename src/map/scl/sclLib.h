@@ -92,6 +92,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    int        nProcs;           // the number of threads
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -237,12 +238,17 @@ struct SC_Lib_
     Vec_Ptr_t      vCellClasses;   // NamedSet<SC_Cell>
     int *          pBins;          // hashing gateName -> gateId
     int            nBins;
+    Vec_Ptr_t *    vCorners;       // additional timing corners (SC_Lib *)
+    Vec_Ptr_t *    vCornerCells;   // for a corner, its cell for each cell of the main library
+    int            nGeneration;    // changes whenever the library is read, modified, or freed
 };
 
 ////////////////////////////////////////////////////////////////////////
 ///                       GLOBAL VARIABLES                           ///
 ////////////////////////////////////////////////////////////////////////
 
+extern int Abc_SclLibGeneration;   // the last generation given to a library
+
 ////////////////////////////////////////////////////////////////////////
 ///                       MACRO DEFINITIONS                          ///
 ////////////////////////////////////////////////////////////////////////
@@ -258,6 +264,8 @@ static inline int         SC_PairEqual( SC_Pair * d, SC_Pair * s )  { return d->
 static inline int         SC_PairEqualE( SC_Pair * d, SC_Pair * s, float E )  { return d->rise - s->rise < E && s->rise - d->rise < E &&  d->fall - s->fall < E && s->fall - d->fall < E;    }
 
 static inline int         SC_LibCellNum( SC_Lib * p )               { return Vec_PtrSize(&p->vCells);                                  }
+static inline int         SC_LibCornerNum( SC_Lib * p )             { return p->vCorners ? Vec_PtrSize(p->vCorners) : 0;               }
+static inline SC_Lib *    SC_LibCorner( SC_Lib * p, int i )         { return (SC_Lib *)Vec_PtrEntry(p->vCorners, i);                   }
 static inline SC_Cell *   SC_LibCell( SC_Lib * p, int i )           { return (SC_Cell *)Vec_PtrEntry(&p->vCells, i);                   }
 static inline SC_Pin  *   SC_CellPin( SC_Cell * p, int i )          { return (SC_Pin *)Vec_PtrEntry(&p->vPins, i);                     }
 static inline Vec_Wrd_t * SC_CellFunc( SC_Cell * p )                { return &SC_CellPin(p, p->n_inputs)->vFunc;                       }
@@ -351,6 +359,7 @@ static inline SC_Lib * Abc_SclLibAlloc()
     p->unit_time      = 9;
     p->unit_cap_fst   = 1;
     p->unit_cap_snd   = 12;
+    p->nGeneration    = ++Abc_SclLibGeneration;
     return p;
 }
 
@@ -462,6 +471,10 @@ static inline void Abc_SclLibFree( SC_Lib * p )
     SC_LibForEachCell( p, pCell, i )
         Abc_SclCellFree( pCell );
     Vec_PtrErase( &p->vCells );
+    for ( i = 0; i < SC_LibCornerNum(p); i++ )
+        Abc_SclLibFree( SC_LibCorner(p, i) );
+    Vec_PtrFreeP( &p->vCorners );
+    Vec_PtrFreeP( &p->vCornerCells );
     Vec_PtrErase( &p->vCellClasses );
     ABC_FREE( p->pName );
     ABC_FREE( p->pFileName );
@@ -469,6 +482,7 @@ static inline void Abc_SclLibFree( SC_Lib * p )
     ABC_FREE( p->default_wire_load_sel );
     ABC_FREE( p->pBins );
     ABC_FREE( p );
+    Abc_SclLibGeneration++;
 }
 
 
@@ -742,6 +756,7 @@ static inline void Scl_LibHandleInputDriver2( SC_Cell * pCell, SC_PairI * pLoadI
 
 /*=== sclLiberty.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use );
+extern SC_Lib *      Abc_SclReadLibertyPar( char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use, int nProcs, int fUseCache );
 /*=== sclLibScl.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
 extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
@@ -755,6 +770,8 @@ extern int           Abc_SclCellFind( SC_Lib * p, char * pName );
 extern int           Abc_SclClassCellNum( SC_Cell * pClass );
 extern void          Abc_SclShortNames( SC_Lib * p );
 extern int           Abc_SclLibClassNum( SC_Lib * pLib );
+extern int           Abc_SclLibAddCorner( SC_Lib * p, SC_Lib * pCorner );
+extern void          Abc_SclLibTransferCorners( SC_Lib * pOld, SC_Lib * pNew );
 extern void          Abc_SclLinkCells( SC_Lib * p );
 extern void          Abc_SclPrintCells( SC_Lib * p, float Slew, float Gain, int fInvOnly, int fShort );
 extern void          Abc_SclConvertLeakageIntoArea( SC_Lib * p, float A, float B );
@@ -30,6 +30,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+int Abc_SclLibGeneration = 0;
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -101,6 +103,90 @@ int Abc_SclLibClassNum( SC_Lib * pLib )
     return Count;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds another timing corner to the library.]
+
+  Description [The corner library should contain each cell of the main 
+  library with the same number of inputs and outputs. The cell of the 
+  corner corresponding to each cell of the main library is recorded, so 
+  that the timing of a mapped network can be computed in the corner.
+  The main library takes ownership of the corner library. Returns 0 if 
+  the libraries do not match.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclLibAddCorner( SC_Lib * p, SC_Lib * pCorner )
+{
+    SC_Cell * pCell, * pCellC;
+    int i, k, iCell;
+    assert( pCorner->vCornerCells == NULL && pCorner->vCorners == NULL );
+    if ( p->unit_time != pCorner->unit_time || p->unit_cap_snd != pCorner->unit_cap_snd )
+    {
+        printf( "The time and capacitance units of the corner library \"%s\" are different.\n", pCorner->pName );
+        return 0;
+    }
+    pCorner->vCornerCells = Vec_PtrStart( SC_LibCellNum(p) );
+    SC_LibForEachCell( p, pCell, i )
+    {
+        iCell = Abc_SclCellFind( pCorner, pCell->pName );
+        pCellC = iCell >= 0 ? SC_LibCell( pCorner, iCell ) : NULL;
+        if ( pCellC == NULL || pCellC->n_inputs != pCell->n_inputs || pCellC->n_outputs != pCell->n_outputs )
+        {
+            printf( "Cell \"%s\" is %s the corner library \"%s\".\n", pCell->pName, pCellC ? "different in" : "missing in", pCorner->pName );
+            Vec_PtrFreeP( &pCorner->vCornerCells );
+            return 0;
+        }
+        for ( k = 0; k < pCell->n_inputs; k++ )
+            if ( strcmp(SC_CellPin(pCell, k)->pName, SC_CellPin(pCellC, k)->pName) )
+                break;
+        if ( k < pCell->n_inputs )
+        {
+            printf( "Cell \"%s\" has different input pins in the corner library \"%s\".\n", pCell->pName, pCorner->pName );
+            Vec_PtrFreeP( &pCorner->vCornerCells );
+            return 0;
+        }
+        Vec_PtrWriteEntry( pCorner->vCornerCells, i, pCellC );
+    }
+    if ( p->vCorners == NULL )
+        p->vCorners = Vec_PtrAlloc( 4 );
+    Vec_PtrPush( p->vCorners, pCorner );
+    p->nGeneration = ++Abc_SclLibGeneration;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the timing corners of the old library to the new one.]
+
+  Description [The corners that do not match the new library are freed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclLibTransferCorners( SC_Lib * pOld, SC_Lib * pNew )
+{
+    SC_Lib * pCorner;
+    int i;
+    for ( i = 0; i < SC_LibCornerNum(pOld); i++ )
+    {
+        pCorner = SC_LibCorner( pOld, i );
+        Vec_PtrFreeP( &pCorner->vCornerCells );
+        if ( Abc_SclLibAddCorner( pNew, pCorner ) )
+            continue;
+        printf( "Timing corner \"%s\" is removed because it cannot be used with library \"%s\".\n", pCorner->pName, pNew->pName );
+        Abc_SclLibFree( pCorner );
+    }
+    Vec_PtrFreeP( &pOld->vCorners );
+    Vec_PtrFreeP( &pOld->vCornerCells );
+    pOld->nGeneration = ++Abc_SclLibGeneration;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Change cell names and pin names.]
@@ -721,6 +807,7 @@ void Abc_SclConvertLeakageIntoArea( SC_Lib * p, float A, float B )
     SC_Cell * pCell; int i;
     SC_LibForEachCell( p, pCell, i )
         pCell->area = A * pCell->area + B * pCell->leakage;
+    p->nGeneration = ++Abc_SclLibGeneration;
 }
 
 
@@ -782,6 +869,7 @@ void Abc_SclLibNormalize( SC_Lib * p )
             Abc_SclLibNormalizeSurface( &pTiming->pFallTrans, Time, Load );
         }
     }
+    p->nGeneration = ++Abc_SclLibGeneration;
 }
 
 /**Function*************************************************************
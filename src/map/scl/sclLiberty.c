@@ -28,6 +28,23 @@
 #include "sclLib.h"
 #include "misc/st/st.h"
 #include "map/mio/mio.h"
+#include "misc/util/utilSignal.h"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -38,6 +55,12 @@ ABC_NAMESPACE_IMPL_START
 
 // #define ABC_MAX_LIB_STR_LEN 5000
 
+#define SCL_PAR_THR_MAX    100         // the largest number of threads
+#define SCL_PAR_SIZE_MIN   (1 << 20)   // the smallest file parsed by several threads
+#define SCL_PAR_CELL_MIN   64          // the smallest number of cells read by several threads
+
+#define SCL_CACHE_VERSION  "scc1"      // the format of the compiled library cache
+
 // entry types
 typedef enum { 
     SCL_LIBERTY_NONE = 0,        // 0:  unknown
@@ -624,15 +647,210 @@ void Scl_LibertyStop( Scl_Tree_t * p, int fVerbose )
     ABC_FREE( p->pError );
     ABC_FREE( p );
 }
-Scl_Tree_t * Scl_LibertyParse( char * pFileName, int fVerbose )
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the parse tree using several threads.]
+
+  Description [The body of the top-level library group is divided into
+  ranges at the ends of its top-level groups (cells, templates, wire loads,
+  etc). The items of each range are built by a separate thread into its own
+  array. The arrays are then appended to the tree in the order of the ranges,
+  with the item numbers and line numbers shifted, which gives the same tree
+  as the serial parser. If the file is small or its top-level structure is
+  not recognized, or if some range cannot be parsed, the tree is built
+  serially. Returns the root item, or -1 if parsing failed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Scl_ParThData_t_ Scl_ParThData_t;
+struct Scl_ParThData_t_
+{
+    Scl_Tree_t      Tree;         // the items of the range
+    long            Beg;          // the beginning of the range
+    long            End;          // the end of the range
+    long            Res;          // the first item of the range (-2 if no items; -1 if failed)
+};
+void * Scl_LibertyParWorkerThread( void * pArg )
+{
+    Scl_ParThData_t * pThData = (Scl_ParThData_t *)pArg;
+    Scl_Tree_t * p = &pThData->Tree;
+    char * pPos = p->pContents + pThData->Beg;
+    p->nItermAlloc = 10 + Scl_LibertyCountItems( pPos, p->pContents + pThData->End );
+    p->pItems  = ABC_CALLOC( Scl_Item_t, p->nItermAlloc );
+    p->vBuffer = Vec_StrStart( 10 );
+    pThData->Res = Scl_LibertyBuildItem( p, &pPos, p->pContents + pThData->End );
+    return NULL;
+}
+// divides the body into ranges ending after a top-level group
+static int Scl_LibertySplitBody( Scl_Tree_t * p, char * pBeg, char * pEnd, int nParts, long * pSplits )
 {
-    Scl_Tree_t * p;
     char * pPos;
+    long nStep = (pEnd - pBeg) / nParts;
+    int nSplits = 0;
+    for ( pPos = pBeg; pPos < pEnd && nSplits < nParts - 1; pPos++ )
+    {
+        if ( *pPos == '\"' )
+        {
+            for ( pPos++; pPos < pEnd && *pPos != '\"'; pPos++ );
+            if ( pPos == pEnd )
+                return 0;
+        }
+        else if ( *pPos == '(' || *pPos == '{' )
+        {
+            char Close = *pPos == '(' ? ')' : '}';
+            pPos = Scl_LibertyFindMatch( pPos, pEnd );
+            if ( pPos == pEnd || *pPos != Close )
+                return 0;
+            if ( Close == '}' && pPos + 1 - pBeg >= (nSplits + 1) * nStep )
+                pSplits[nSplits++] = pPos + 1 - p->pContents;
+        }
+    }
+    return nSplits;
+}
+long Scl_LibertyBuildItemPar( Scl_Tree_t * p, int nProcs )
+{
+    Scl_ParThData_t ThData[SCL_PAR_THR_MAX];
+    pthread_t WorkerThread[SCL_PAR_THR_MAX];
+    long Splits[SCL_PAR_THR_MAX];
+    char * pPos = p->pContents, * pEnd = p->pContents + p->nContents, * pStop;
+    Scl_Pair_t Key, Head, Body;
+    Scl_Item_t * pRoot, * pItem;
+    long * pLink, iItem, Offset;
+    int i, k, nParts, status, fFailed = 0;
+    assert( p->nItems == 0 && p->nLines == 1 );
+    nProcs = Abc_MinInt( nProcs, SCL_PAR_THR_MAX );
+    if ( nProcs < 2 || p->nContents < SCL_PAR_SIZE_MIN )
+        goto serial;
+    // parse the head of the top-level group
+    if ( Scl_LibertySkipSpaces( p, &pPos, pEnd, 0 ) )
+        goto serial;
+    Key.Beg = pPos - p->pContents;
+    if ( Scl_LibertySkipEntry( &pPos, pEnd ) )
+        goto serial;
+    Key.End = pPos - p->pContents;
+    if ( Scl_LibertySkipSpaces( p, &pPos, pEnd, 0 ) || *pPos != '(' )
+        goto serial;
+    pStop = Scl_LibertyFindMatch( pPos, pEnd );
+    Head.Beg = pPos - p->pContents + 1;
+    Head.End = pStop - p->pContents;
+    pPos = pStop + 1;
+    if ( Scl_LibertySkipSpaces( p, &pPos, pEnd, 0 ) || *pPos != '{' )
+        goto serial;
+    pStop = Scl_LibertyFindMatch( pPos, pEnd );
+    Body.Beg = pPos - p->pContents + 1;
+    Body.End = pStop - p->pContents;
+    // divide the body into ranges
+    nParts = 1 + Scl_LibertySplitBody( p, p->pContents + Body.Beg, pStop, nProcs, Splits );
+    if ( nParts < 2 )
+        goto serial;
+    pRoot = Scl_LibertyNewItem( p, SCL_LIBERTY_PROC );
+    pRoot->Key  = Key;
+    pRoot->Head = Scl_LibertyUpdateHead( p, Head );
+    pRoot->Body = Body;
+    // build the items of the ranges
+    for ( i = 0; i < nParts; i++ )
+    {
+        ThData[i].Tree        = *p;
+        ThData[i].Tree.nLines = 0;
+        ThData[i].Tree.nItems = 0;
+        ThData[i].Tree.pError = NULL;
+        ThData[i].Beg = i ? Splits[i-1] : Body.Beg;
+        ThData[i].End = i < nParts-1 ? Splits[i] : Body.End;
+        if ( i == 0 )
+            continue;
+        status = pthread_create( WorkerThread + i, NULL, Scl_LibertyParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    Scl_LibertyParWorkerThread( (void *)ThData );
+    for ( i = 1; i < nParts; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    for ( i = 0; i < nParts; i++ )
+        fFailed |= (ThData[i].Res == -1);
+    // append the items to the tree
+    pLink = &pRoot->Child;
+    for ( i = 0; !fFailed && i < nParts; i++ )
+    {
+        Scl_Tree_t * pPart = &ThData[i].Tree;
+        Offset = p->nItems;
+        assert( Offset + pPart->nItems <= p->nItermAlloc );
+        memcpy( p->pItems + Offset, pPart->pItems, sizeof(Scl_Item_t) * pPart->nItems );
+        for ( k = 0; k < pPart->nItems; k++ )
+        {
+            pItem = p->pItems + Offset + k;
+            pItem->iLine += p->nLines;
+            if ( pItem->Next >= 0 )
+                pItem->Next += Offset;
+            if ( pItem->Child >= 0 )
+                pItem->Child += Offset;
+        }
+        p->nItems += pPart->nItems;
+        p->nLines += pPart->nLines;
+        if ( ThData[i].Res == -2 )
+            continue;
+        assert( ThData[i].Res == 0 );
+        // link the top-level items of this range to those of the previous ranges
+        *pLink = Offset;
+        for ( iItem = Offset; p->pItems[iItem].Next >= 0; iItem = p->pItems[iItem].Next );
+        pLink = &p->pItems[iItem].Next;
+    }
+    *pLink = -2;
+    for ( i = 0; i < nParts; i++ )
+    {
+        ABC_FREE( ThData[i].Tree.pItems );
+        ABC_FREE( ThData[i].Tree.pError );
+        Vec_StrFree( ThData[i].Tree.vBuffer );
+    }
+    if ( fFailed ) // the serial parser reports the error
+    {
+        memset( p->pItems, 0, sizeof(Scl_Item_t) * p->nItems );
+        goto serial;
+    }
+    // parse the remainder of the file
+    pPos = pStop + 1;
+    pRoot->Next = Scl_LibertyBuildItem( p, &pPos, pEnd );
+    if ( pRoot->Next == -1 )
+        return -1;
+    return Scl_LibertyItemId( p, pRoot );
+serial:
+    p->nItems = 0;
+    p->nLines = 1;
+    pPos = p->pContents;
+    return Scl_LibertyBuildItem( p, &pPos, pEnd );
+}
+
+#else // pthreads are not used
+
+long Scl_LibertyBuildItemPar( Scl_Tree_t * p, int nProcs )
+{
+    char * pPos = p->pContents;
+    return Scl_LibertyBuildItem( p, &pPos, p->pContents + p->nContents );
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the Liberty file.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Scl_Tree_t * Scl_LibertyParse( char * pFileName, int fVerbose, int nProcs )
+{
+    Scl_Tree_t * p;
     if ( (p = Scl_LibertyStart(pFileName)) == NULL )
         return NULL;
-    pPos = p->pContents;
     Scl_LibertyWipeOutComments( p->pContents, p->pContents+p->nContents );
-    if ( (!Scl_LibertyBuildItem( p, &pPos, p->pContents + p->nContents )) == 0 )
+    if ( (!Scl_LibertyBuildItemPar( p, nProcs )) == 0 )
     {
         if ( p->pError ) printf( "%s", p->pError );
         printf( "Parsing failed.  " );
@@ -1031,10 +1249,20 @@ int Scl_LibertyReadTimingSense( Scl_Tree_t * p, Scl_Item_t * pPin )
 }
 Vec_Flt_t * Scl_LibertyReadFloatVec( char * pName )
 {
-    char * pToken;
+    // same as strtok() with delimiters " \t\n\r\\\"," but reentrant
+    char * pDelims = " \t\n\r\\\",", * pToken;
     Vec_Flt_t * vValues = Vec_FltAlloc( 100 );
-    for ( pToken = strtok(pName, " \t\n\r\\\","); pToken; pToken = strtok(NULL, " \t\n\r\\\",") )
+    while ( 1 )
+    {
+        while ( *pName && strchr(pDelims, *pName) )
+            pName++;
+        if ( *pName == 0 )
+            break;
+        for ( pToken = pName; *pName && !strchr(pDelims, *pName); pName++ );
+        if ( *pName )
+            *pName++ = 0;
         Vec_FltPush( vValues, atof(pToken) );
+    }
     return vValues;
 }
 
@@ -1454,15 +1682,273 @@ Vec_Ptr_t * Scl_LibertyReadTemplates( Scl_Tree_t * p )
 //    Scl_LibertyPrintTemplates( vRes );
     return vRes;
 }
-Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbose, SC_DontUse dont_use )
+static int Scl_LibertyReadCell( Scl_Tree_t * p, Vec_Str_t * vOut, Scl_Item_t * pCell, Vec_Ptr_t * vTemples )
 {
     int fUseFirstTable = 0;
-    Vec_Str_t * vOut;
-    Vec_Ptr_t * vNameIns, * vTemples = NULL;
-    Scl_Item_t * pCell, * pPin, * pTiming;
+    Vec_Ptr_t * vNameIns;
+    Scl_Item_t * pPin, * pTiming;
     Vec_Wrd_t * vTruth;
     char * pFormula, * pName;
-    int i, k, Counter, nOutputs, nCells;
+    int i, k, nOutputs;
+    // top level information
+    Vec_StrPutS_( vOut, Scl_LibertyReadString(p, pCell->Head) );
+    pName = Scl_LibertyReadCellArea(p, pCell);
+    Vec_StrPutF_( vOut, pName ? atof(pName) : 1 );
+    pName = Scl_LibertyReadCellLeakage(p, pCell);
+    Vec_StrPutF_( vOut, pName ? atof(pName) : 0 );
+    Vec_StrPutI_( vOut, Scl_LibertyReadDeriveStrength(p, pCell) );
+    // pin count
+    nOutputs = Scl_LibertyReadCellOutputNum( p, pCell );
+    Vec_StrPutI_( vOut, Scl_LibertyItemNum(p, pCell, "pin") - nOutputs );
+    Vec_StrPutI_( vOut, nOutputs );
+    Vec_StrPut_( vOut );
+    Vec_StrPut_( vOut );
+
+    // input pins
+    vNameIns = Vec_PtrAlloc( 16 );
+    Scl_ItemForEachChildName( p, pCell, pPin, "pin" )
+    {
+        float CapOne, CapRise, CapFall;
+        if ( Scl_LibertyReadPinFormula(p, pPin) != NULL ) // skip output pin
+            continue;
+        assert( Scl_LibertyReadPinDirection(p, pPin) == 0 || Scl_LibertyReadPinDirection(p, pPin) == 2);
+        pName = Scl_LibertyReadString(p, pPin->Head);
+        Vec_PtrPush( vNameIns, Abc_UtilStrsav(pName) );
+        Vec_StrPutS_( vOut, pName );
+        CapOne  = Scl_LibertyReadPinCap( p, pPin, "capacitance" );
+        CapRise = Scl_LibertyReadPinCap( p, pPin, "rise_capacitance" );
+        CapFall = Scl_LibertyReadPinCap( p, pPin, "fall_capacitance" );
+        if ( CapRise == 0 )
+            CapRise = CapOne;
+        if ( CapFall == 0 )
+            CapFall = CapOne;
+        Vec_StrPutF_( vOut, CapRise );
+        Vec_StrPutF_( vOut, CapFall );
+        Vec_StrPut_( vOut );
+    }
+    Vec_StrPut_( vOut );
+    // output pins
+    Scl_ItemForEachChildName( p, pCell, pPin, "pin" )
+    {
+        if ( !Scl_LibertyReadPinFormula(p, pPin) ) // skip input pin
+            continue;
+        if (Scl_LibertyReadPinDirection(p, pPin) == 2) // skip internal pin
+            continue;
+        assert( Scl_LibertyReadPinDirection(p, pPin) == 1 );
+        pName = Scl_LibertyReadString(p, pPin->Head);
+        Vec_StrPutS_( vOut, pName );
+        Vec_StrPutF_( vOut, Scl_LibertyReadPinCap( p, pPin, "max_capacitance" ) );
+        Vec_StrPutF_( vOut, Scl_LibertyReadPinCap( p, pPin, "max_transition" ) );
+        Vec_StrPutI_( vOut, Vec_PtrSize(vNameIns) );
+        pFormula = Scl_LibertyReadPinFormula(p, pPin);
+        Vec_StrPutS_( vOut, pFormula );
+        // write truth table
+        vTruth = Mio_ParseFormulaTruth( pFormula, (char **)Vec_PtrArray(vNameIns), Vec_PtrSize(vNameIns) );
+        if ( vTruth == NULL )
+            return 0;
+        for ( i = 0; i < Abc_Truth6WordNum(Vec_PtrSize(vNameIns)); i++ )
+            Vec_StrPutW_( vOut, Vec_WrdEntry(vTruth, i) );
+        Vec_WrdFree( vTruth );
+        Vec_StrPut_( vOut );
+        Vec_StrPut_( vOut );
+
+        // write the delay tables
+        if ( fUseFirstTable )
+        {
+            Vec_PtrForEachEntry( char *, vNameIns, pName, i )
+            {
+                pTiming = Scl_LibertyReadPinTiming( p, pPin, pName );
+                Vec_StrPutS_( vOut, pName );
+                Vec_StrPutI_( vOut, (int)(pTiming != NULL) );
+                if ( pTiming == NULL ) // output does not depend on input
+                    continue;
+                Vec_StrPutI_( vOut, Scl_LibertyReadTimingSense(p, pTiming) );
+                Vec_StrPut_( vOut );
+                Vec_StrPut_( vOut );
+                // some cells only have 'rise' or 'fall' but not both - here we work around this
+                if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_rise",           vTemples ) )
+                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_fall",       vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_fall",           vTemples ) )
+                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_rise",       vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyReadTable( p, vOut, pTiming, "rise_transition",     vTemples ) )
+                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "fall_transition", vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyReadTable( p, vOut, pTiming, "fall_transition",     vTemples ) )
+                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "rise_transition", vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }  
+            }
+            continue;
+        }
+
+        // write the timing tables
+        Vec_PtrForEachEntry( char *, vNameIns, pName, i )
+        {
+            Vec_Ptr_t * vTables[4];
+            Vec_Ptr_t * vTimings;
+            vTimings = Scl_LibertyReadPinTimingAll( p, pPin, pName );
+            Vec_StrPutS_( vOut, pName );
+            Vec_StrPutI_( vOut, (int)(Vec_PtrSize(vTimings) != 0) );
+            if ( Vec_PtrSize(vTimings) == 0 ) // output does not depend on input
+            {
+                Vec_PtrFree( vTimings );
+                continue;
+            }
+            Vec_StrPutI_( vOut, Scl_LibertyReadTimingSense(p, (Scl_Item_t *)Vec_PtrEntry(vTimings, 0)) );
+            Vec_StrPut_( vOut );
+            Vec_StrPut_( vOut );
+            // collect the timing tables
+            for ( k = 0; k < 4; k++ )
+                vTables[k] = Vec_PtrAlloc( 16 );
+            Vec_PtrForEachEntry( Scl_Item_t *, vTimings, pTiming, k )
+            {
+                // some cells only have 'rise' or 'fall' but not both - here we work around this
+                if ( !Scl_LibertyScanTable( p, vTables[0], pTiming, "cell_rise",           vTemples ) )
+                    if ( !Scl_LibertyScanTable( p, vTables[0], pTiming, "cell_fall",       vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyScanTable( p, vTables[1], pTiming, "cell_fall",           vTemples ) )
+                    if ( !Scl_LibertyScanTable( p, vTables[1], pTiming, "cell_rise",       vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyScanTable( p, vTables[2], pTiming, "rise_transition",     vTemples ) )
+                    if ( !Scl_LibertyScanTable( p, vTables[2], pTiming, "fall_transition", vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyScanTable( p, vTables[3], pTiming, "fall_transition",     vTemples ) )
+                    if ( !Scl_LibertyScanTable( p, vTables[3], pTiming, "rise_transition", vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }  
+            }
+            Vec_PtrFree( vTimings );
+            // compute worse case of the tables
+            for ( k = 0; k < 4; k++ )
+            {
+                Vec_Flt_t * vInd0, * vInd1, * vValues;
+                if ( !Scl_LibertyComputeWorstCase( vTables[k], &vInd0, &vInd1, &vValues ) )
+                    { printf( "Table indexes have different values\n" ); return 0; }  
+                Vec_VecFree( (Vec_Vec_t *)vTables[k] );
+                Scl_LibertyDumpTables( vOut, vInd0, vInd1, vValues );
+                Vec_FltFree( vInd0 );
+                Vec_FltFree( vInd1 );
+                Vec_FltFree( vValues );
+            }
+        }
+    }
+    Vec_StrPut_( vOut );
+    Vec_PtrFreeFree( vNameIns );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the cells using several threads.]
+
+  Description [Thread i reads the cells i, i + nThreads, etc, into separate
+  strings, which are appended to the output in the original order. Each
+  thread uses its own copy of the tree manager, because reading the item
+  strings uses the temporary buffer of the manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Scl_ParCellData_t_ Scl_ParCellData_t;
+struct Scl_ParCellData_t_
+{
+    Scl_Tree_t      Tree;         // the copy of the tree manager
+    Vec_Ptr_t *     vCells;       // the cells to read
+    Vec_Ptr_t *     vTemples;     // the delay-table templates
+    Vec_Ptr_t *     vOuts;        // the strings of the cells (NULL if failed)
+    int             iThread;      // the thread number
+    int             nThreads;     // the number of threads
+};
+void * Scl_LibertyParCellThread( void * pArg )
+{
+    Scl_ParCellData_t * pThData = (Scl_ParCellData_t *)pArg;
+    Scl_Item_t * pCell;
+    Vec_Str_t * vOut;
+    int i;
+    pThData->Tree.vBuffer = Vec_StrStart( 10 );
+    for ( i = pThData->iThread; i < Vec_PtrSize(pThData->vCells); i += pThData->nThreads )
+    {
+        pCell = (Scl_Item_t *)Vec_PtrEntry( pThData->vCells, i );
+        vOut  = Vec_StrAlloc( 1000 );
+        if ( !Scl_LibertyReadCell( &pThData->Tree, vOut, pCell, pThData->vTemples ) )
+            Vec_StrFreeP( &vOut );
+        Vec_PtrWriteEntry( pThData->vOuts, i, vOut );
+    }
+    Vec_StrFree( pThData->Tree.vBuffer );
+    return NULL;
+}
+int Scl_LibertyReadCellsPar( Scl_Tree_t * p, Vec_Str_t * vOut, Vec_Ptr_t * vCells, Vec_Ptr_t * vTemples, int nProcs )
+{
+    Scl_ParCellData_t ThData[SCL_PAR_THR_MAX];
+    pthread_t WorkerThread[SCL_PAR_THR_MAX];
+    Vec_Ptr_t * vOuts = Vec_PtrStart( Vec_PtrSize(vCells) );
+    Vec_Str_t * vCell;
+    int i, status, RetValue = 1;
+    int nThreads = Abc_MinInt( nProcs, SCL_PAR_THR_MAX );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].Tree     = *p;
+        ThData[i].vCells   = vCells;
+        ThData[i].vTemples = vTemples;
+        ThData[i].vOuts    = vOuts;
+        ThData[i].iThread  = i;
+        ThData[i].nThreads = nThreads;
+        if ( i == 0 )
+            continue;
+        status = pthread_create( WorkerThread + i, NULL, Scl_LibertyParCellThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    Scl_LibertyParCellThread( (void *)ThData );
+    for ( i = 1; i < nThreads; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    Vec_PtrForEachEntry( Vec_Str_t *, vOuts, vCell, i )
+    {
+        if ( vCell == NULL )
+        {
+            RetValue = 0;
+            continue;
+        }
+        Vec_StrPushBuffer( vOut, Vec_StrArray(vCell), Vec_StrSize(vCell) );
+        Vec_StrFree( vCell );
+    }
+    Vec_PtrFree( vOuts );
+    return RetValue;
+}
+
+#else // pthreads are not used
+
+int Scl_LibertyReadCellsPar( Scl_Tree_t * p, Vec_Str_t * vOut, Vec_Ptr_t * vCells, Vec_Ptr_t * vTemples, int nProcs )
+{
+    Scl_Item_t * pCell;
+    int i;
+    Vec_PtrForEachEntry( Scl_Item_t *, vCells, pCell, i )
+        if ( !Scl_LibertyReadCell( p, vOut, pCell, vTemples ) )
+            return 0;
+    return 1;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the binary representation of the library.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbose, SC_DontUse dont_use, int nProcs )
+{
+    Vec_Str_t * vOut;
+    Vec_Ptr_t * vCells, * vTemples = NULL;
+    Scl_Item_t * pCell;
+    int i, Counter, nCells;
     int nSkipped[4] = {0};
 
     // read delay-table templates
@@ -1487,8 +1973,9 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     Scl_LibertyReadWireLoad( p, vOut );
     Scl_LibertyReadWireLoadSelect( p, vOut );
 
-    // count cells
+    // collect cells
     nCells = 0;
+    vCells = Vec_PtrAlloc( 1000 );
     Scl_ItemForEachChildName( p, Scl_LibertyRoot(p), pCell, "cell" )
     {
         if ( Scl_LibertyReadCellIsFlop(p, pCell) )
@@ -1515,167 +2002,25 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
             nSkipped[2]++;
             continue;
         }
+        Vec_PtrPush( vCells, pCell );
         nCells++;
     }
     // read cells
     Vec_StrPutI_( vOut, nCells );
     Vec_StrPut_( vOut );
     Vec_StrPut_( vOut );
-    Scl_ItemForEachChildName( p, Scl_LibertyRoot(p), pCell, "cell" )
+    if ( nProcs > 1 && nCells >= SCL_PAR_CELL_MIN )
     {
-        if ( Scl_LibertyReadCellIsFlop(p, pCell) )
-            continue;
-        if ( Scl_LibertyReadCellIsDontUse(p, pCell, dont_use) )
-            continue;
-        if ( Scl_LibertyReadCellIsThreeState(p, pCell) )
-            continue;
-        if ( (Counter = Scl_LibertyReadCellOutputNum(p, pCell)) == 0 )
-            continue;
-        // top level information
-        Vec_StrPutS_( vOut, Scl_LibertyReadString(p, pCell->Head) );
-        pName = Scl_LibertyReadCellArea(p, pCell);
-        Vec_StrPutF_( vOut, pName ? atof(pName) : 1 );
-        pName = Scl_LibertyReadCellLeakage(p, pCell);
-        Vec_StrPutF_( vOut, pName ? atof(pName) : 0 );
-        Vec_StrPutI_( vOut, Scl_LibertyReadDeriveStrength(p, pCell) );
-        // pin count
-        nOutputs = Scl_LibertyReadCellOutputNum( p, pCell );
-        Vec_StrPutI_( vOut, Scl_LibertyItemNum(p, pCell, "pin") - nOutputs );
-        Vec_StrPutI_( vOut, nOutputs );
-        Vec_StrPut_( vOut );
-        Vec_StrPut_( vOut );
-
-        // input pins
-        vNameIns = Vec_PtrAlloc( 16 );
-        Scl_ItemForEachChildName( p, pCell, pPin, "pin" )
-        {
-            float CapOne, CapRise, CapFall;
-            if ( Scl_LibertyReadPinFormula(p, pPin) != NULL ) // skip output pin
-                continue;
-            assert( Scl_LibertyReadPinDirection(p, pPin) == 0 || Scl_LibertyReadPinDirection(p, pPin) == 2);
-            pName = Scl_LibertyReadString(p, pPin->Head);
-            Vec_PtrPush( vNameIns, Abc_UtilStrsav(pName) );
-            Vec_StrPutS_( vOut, pName );
-            CapOne  = Scl_LibertyReadPinCap( p, pPin, "capacitance" );
-            CapRise = Scl_LibertyReadPinCap( p, pPin, "rise_capacitance" );
-            CapFall = Scl_LibertyReadPinCap( p, pPin, "fall_capacitance" );
-            if ( CapRise == 0 )
-                CapRise = CapOne;
-            if ( CapFall == 0 )
-                CapFall = CapOne;
-            Vec_StrPutF_( vOut, CapRise );
-            Vec_StrPutF_( vOut, CapFall );
-            Vec_StrPut_( vOut );
-        }
-        Vec_StrPut_( vOut );
-        // output pins
-        Scl_ItemForEachChildName( p, pCell, pPin, "pin" )
-        {
-            if ( !Scl_LibertyReadPinFormula(p, pPin) ) // skip input pin
-                continue;
-            if (Scl_LibertyReadPinDirection(p, pPin) == 2) // skip internal pin
-                continue;
-            assert( Scl_LibertyReadPinDirection(p, pPin) == 1 );
-            pName = Scl_LibertyReadString(p, pPin->Head);
-            Vec_StrPutS_( vOut, pName );
-            Vec_StrPutF_( vOut, Scl_LibertyReadPinCap( p, pPin, "max_capacitance" ) );
-            Vec_StrPutF_( vOut, Scl_LibertyReadPinCap( p, pPin, "max_transition" ) );
-            Vec_StrPutI_( vOut, Vec_PtrSize(vNameIns) );
-            pFormula = Scl_LibertyReadPinFormula(p, pPin);
-            Vec_StrPutS_( vOut, pFormula );
-            // write truth table
-            vTruth = Mio_ParseFormulaTruth( pFormula, (char **)Vec_PtrArray(vNameIns), Vec_PtrSize(vNameIns) );
-            if ( vTruth == NULL )
+        if ( !Scl_LibertyReadCellsPar( p, vOut, vCells, vTemples, nProcs ) )
+            return NULL;
+    }
+    else
+    {
+        Vec_PtrForEachEntry( Scl_Item_t *, vCells, pCell, i )
+            if ( !Scl_LibertyReadCell( p, vOut, pCell, vTemples ) )
                 return NULL;
-            for ( i = 0; i < Abc_Truth6WordNum(Vec_PtrSize(vNameIns)); i++ )
-                Vec_StrPutW_( vOut, Vec_WrdEntry(vTruth, i) );
-            Vec_WrdFree( vTruth );
-            Vec_StrPut_( vOut );
-            Vec_StrPut_( vOut );
-
-            // write the delay tables
-            if ( fUseFirstTable )
-            {
-                Vec_PtrForEachEntry( char *, vNameIns, pName, i )
-                {
-                    pTiming = Scl_LibertyReadPinTiming( p, pPin, pName );
-                    Vec_StrPutS_( vOut, pName );
-                    Vec_StrPutI_( vOut, (int)(pTiming != NULL) );
-                    if ( pTiming == NULL ) // output does not depend on input
-                        continue;
-                    Vec_StrPutI_( vOut, Scl_LibertyReadTimingSense(p, pTiming) );
-                    Vec_StrPut_( vOut );
-                    Vec_StrPut_( vOut );
-                    // some cells only have 'rise' or 'fall' but not both - here we work around this
-                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_rise",           vTemples ) )
-                        if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_fall",       vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_fall",           vTemples ) )
-                        if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_rise",       vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "rise_transition",     vTemples ) )
-                        if ( !Scl_LibertyReadTable( p, vOut, pTiming, "fall_transition", vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "fall_transition",     vTemples ) )
-                        if ( !Scl_LibertyReadTable( p, vOut, pTiming, "rise_transition", vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }  
-                }
-                continue;
-            }
-
-            // write the timing tables
-            Vec_PtrForEachEntry( char *, vNameIns, pName, i )
-            {
-                Vec_Ptr_t * vTables[4];
-                Vec_Ptr_t * vTimings;
-                vTimings = Scl_LibertyReadPinTimingAll( p, pPin, pName );
-                Vec_StrPutS_( vOut, pName );
-                Vec_StrPutI_( vOut, (int)(Vec_PtrSize(vTimings) != 0) );
-                if ( Vec_PtrSize(vTimings) == 0 ) // output does not depend on input
-                {
-                    Vec_PtrFree( vTimings );
-                    continue;
-                }
-                Vec_StrPutI_( vOut, Scl_LibertyReadTimingSense(p, (Scl_Item_t *)Vec_PtrEntry(vTimings, 0)) );
-                Vec_StrPut_( vOut );
-                Vec_StrPut_( vOut );
-                // collect the timing tables
-                for ( k = 0; k < 4; k++ )
-                    vTables[k] = Vec_PtrAlloc( 16 );
-                Vec_PtrForEachEntry( Scl_Item_t *, vTimings, pTiming, k )
-                {
-                    // some cells only have 'rise' or 'fall' but not both - here we work around this
-                    if ( !Scl_LibertyScanTable( p, vTables[0], pTiming, "cell_rise",           vTemples ) )
-                        if ( !Scl_LibertyScanTable( p, vTables[0], pTiming, "cell_fall",       vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyScanTable( p, vTables[1], pTiming, "cell_fall",           vTemples ) )
-                        if ( !Scl_LibertyScanTable( p, vTables[1], pTiming, "cell_rise",       vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyScanTable( p, vTables[2], pTiming, "rise_transition",     vTemples ) )
-                        if ( !Scl_LibertyScanTable( p, vTables[2], pTiming, "fall_transition", vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyScanTable( p, vTables[3], pTiming, "fall_transition",     vTemples ) )
-                        if ( !Scl_LibertyScanTable( p, vTables[3], pTiming, "rise_transition", vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }  
-                }
-                Vec_PtrFree( vTimings );
-                // compute worse case of the tables
-                for ( k = 0; k < 4; k++ )
-                {
-                    Vec_Flt_t * vInd0, * vInd1, * vValues;
-                    if ( !Scl_LibertyComputeWorstCase( vTables[k], &vInd0, &vInd1, &vValues ) )
-                        { printf( "Table indexes have different values\n" ); return NULL; }  
-                    Vec_VecFree( (Vec_Vec_t *)vTables[k] );
-                    Scl_LibertyDumpTables( vOut, vInd0, vInd1, vValues );
-                    Vec_FltFree( vInd0 );
-                    Vec_FltFree( vInd1 );
-                    Vec_FltFree( vValues );
-                }
-            }
-        }
-        Vec_StrPut_( vOut );
-        Vec_PtrFreeFree( vNameIns );
     }
+    Vec_PtrFree( vCells );
     // free templates
     if ( vTemples )
     {
@@ -1702,30 +2047,220 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     }
     return vOut;
 }
-SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use )
+
+/**Function*************************************************************
+
+  Synopsis    [Cache of the compiled library.]
+
+  Description [The cache file "<file>.scl_cache" stored next to the Liberty
+  file contains the binary representation of the library produced by
+  Scl_LibertyReadSclStr(), which is loaded by Abc_SclReadFromStr() without
+  parsing the text. It is preceded by the cache format version and the key,
+  which is the hash of the contents of the Liberty file, the version of
+  the binary representation, and the list of dont_use cells. If the key
+  does not match, the library is parsed and the cache file is rewritten.
+  The key and the size are stored in the little-endian byte order, so the 
+  cache file does not depend on the platform.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Scl_LibertyCacheGetWord( unsigned char * pBytes, int nBytes )
+{
+    word Data = 0;
+    int i;
+    for ( i = 0; i < nBytes; i++ )
+        Data |= (word)pBytes[i] << (8*i);
+    return Data;
+}
+static void Scl_LibertyCacheWriteWord( FILE * pFile, word Data, int nBytes )
+{
+    unsigned char pBytes[8];
+    int i;
+    for ( i = 0; i < nBytes; i++ )
+        pBytes[i] = (unsigned char)((Data >> (8*i)) & 0xFF);
+    fwrite( pBytes, nBytes, 1, pFile );
+}
+static int Scl_LibertyCacheReadWord( FILE * pFile, word * pData, int nBytes )
+{
+    unsigned char pBytes[8];
+    if ( fread( pBytes, nBytes, 1, pFile ) != 1 )
+        return 0;
+    *pData = Scl_LibertyCacheGetWord( pBytes, nBytes );
+    return 1;
+}
+static word Scl_LibertyCacheKey( char * pFileName, SC_DontUse dont_use )
+{
+    word Key = ABC_SCL_CUR_VERSION, Data;
+    long nContents = Scl_LibertyFileSize( pFileName ), i;
+    char * pContents;
+    if ( nContents == 0 )
+        return 0;
+    pContents = Scl_LibertyFileContents( pFileName, nContents );
+    for ( i = 0; i + 8 <= nContents; i += 8 )
+    {
+        Data = Scl_LibertyCacheGetWord( (unsigned char *)pContents + i, 8 );
+        Key = (Key ^ Data) * ABC_CONST(0x9E3779B97F4A7C15);
+        Key ^= Key >> 32;
+    }
+    for ( ; i < nContents; i++ )
+        Key = (Key ^ (word)(unsigned char)pContents[i]) * ABC_CONST(0x9E3779B97F4A7C15);
+    Key ^= (word)nContents;
+    for ( i = 0; i < dont_use.size; i++ )
+    {
+        char * pName;
+        for ( pName = dont_use.dont_use_list[i]; *pName; pName++ )
+            Key = (Key ^ (word)(unsigned char)*pName) * ABC_CONST(0x9E3779B97F4A7C15);
+        Key = (Key ^ 0xFF) * ABC_CONST(0x9E3779B97F4A7C15);
+    }
+    ABC_FREE( pContents );
+    return Key;
+}
+static Vec_Str_t * Scl_LibertyCacheRead( char * pCacheName, word Key )
 {
-    SC_Lib * pLib;
-    Scl_Tree_t * p;
     Vec_Str_t * vStr;
-    p = Scl_LibertyParse( pFileName, fVeryVerbose );
-    if ( p == NULL )
+    char pVersion[4];
+    word KeyFile, Size;
+    int nSize;
+    FILE * pFile = fopen( pCacheName, "rb" );
+    if ( pFile == NULL )
         return NULL;
-//    Scl_LibertyParseDump( p, "temp_.lib" );
-    // collect relevant data
-    vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose, dont_use );
-    Scl_LibertyStop( p, fVeryVerbose );
-    if ( vStr == NULL )
+    if ( fread( pVersion, 4, 1, pFile ) != 1 || strncmp( pVersion, SCL_CACHE_VERSION, 4 ) ||
+         !Scl_LibertyCacheReadWord( pFile, &KeyFile, 8 ) || KeyFile != Key || 
+         !Scl_LibertyCacheReadWord( pFile, &Size, 4 ) || (nSize = (int)Size) <= 0 )
+    {
+        fclose( pFile );
         return NULL;
+    }
+    vStr = Vec_StrAlloc( nSize );
+    vStr->nSize = nSize;
+    if ( fread( Vec_StrArray(vStr), nSize, 1, pFile ) != 1 )
+    {
+        printf( "Library cache file \"%s\" is corrupted.\n", pCacheName );
+        Vec_StrFree( vStr );
+        vStr = NULL;
+    }
+    fclose( pFile );
+    return vStr;
+}
+static void Scl_LibertyCacheWrite( char * pCacheName, word Key, Vec_Str_t * vStr )
+{
+    char * pFileTemp = NULL;
+    int nSize = Vec_StrSize(vStr);
+    FILE * pFile;
+    int Value = Util_SignalTmpFile( pCacheName, ".tmp", &pFileTemp );
+    if ( Value == -1 )
+    {
+        printf( "Cannot create temporary file for library cache \"%s\".\n", pCacheName );
+        return;
+    }
+#ifdef _WIN32
+    _close( Value );
+#else
+    close( Value );
+#endif
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Writing library cache file \"%s\" has failed.\n", pFileTemp );
+        Util_SignalTmpFileRemove( pFileTemp, 0 );
+        ABC_FREE( pFileTemp );
+        return;
+    }
+    fwrite( SCL_CACHE_VERSION, 4, 1, pFile );
+    Scl_LibertyCacheWriteWord( pFile, Key, 8 );
+    Scl_LibertyCacheWriteWord( pFile, (word)nSize, 4 );
+    fwrite( Vec_StrArray(vStr), nSize, 1, pFile );
+    fclose( pFile );
+    // rename, so that concurrent readers never see a partially written file
+#ifdef _WIN32
+    remove( pCacheName );
+#endif
+    if ( rename( pFileTemp, pCacheName ) )
+    {
+        printf( "Renaming \"%s\" into library cache file \"%s\" has failed.\n", pFileTemp, pCacheName );
+        Util_SignalTmpFileRemove( pFileTemp, 0 );
+    }
+    ABC_FREE( pFileTemp );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the Liberty library.]
+
+  Description [Uses nProcs threads to parse the file. If fUseCache is set,
+  the library is loaded from the cache of the compiled library if the cache
+  is up to date, or the cache is written after parsing otherwise.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+SC_Lib * Abc_SclReadLibertyPar( char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use, int nProcs, int fUseCache )
+{
+    SC_Lib * pLib;
+    Scl_Tree_t * p;
+    Vec_Str_t * vStr = NULL;
+    char * pCacheName = NULL;
+    word Key = 0;
+    int fCached = 0;
+    abctime clk = Abc_Clock();
+    if ( fUseCache )
+    {
+        Scl_LibertyFixFileName( pFileName );
+        pCacheName = ABC_ALLOC( char, strlen(pFileName) + 20 );
+        sprintf( pCacheName, "%s.scl_cache", pFileName );
+        Key  = Scl_LibertyCacheKey( pFileName, dont_use );
+        vStr = Key ? Scl_LibertyCacheRead( pCacheName, Key ) : NULL;
+        fCached = (vStr != NULL);
+    }
+    if ( vStr == NULL )
+    {
+        p = Scl_LibertyParse( pFileName, fVeryVerbose, nProcs );
+        if ( p == NULL )
+        {
+            ABC_FREE( pCacheName );
+            return NULL;
+        }
+    //    Scl_LibertyParseDump( p, "temp_.lib" );
+        // collect relevant data
+        vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose, dont_use, nProcs );
+        Scl_LibertyStop( p, fVeryVerbose );
+        if ( vStr == NULL )
+        {
+            ABC_FREE( pCacheName );
+            return NULL;
+        }
+        if ( fUseCache && Key )
+            Scl_LibertyCacheWrite( pCacheName, Key, vStr );
+    }
     // construct SCL data-structure
     pLib = Abc_SclReadFromStr( vStr );
     if ( pLib == NULL )
+    {
+        ABC_FREE( pCacheName );
         return NULL;
+    }
     pLib->pFileName = Abc_UtilStrsav( pFileName );
     Abc_SclLibNormalize( pLib );
     Vec_StrFree( vStr );
 //    printf( "Average slew = %.2f ps\n", Abc_SclComputeAverageSlew(pLib) );
+    if ( fCached && fVerbose )
+    {
+        printf( "Library \"%s\" from \"%s\" has %d cells (loaded from cache \"%s\").  ", 
+            pLib->pName, pFileName, SC_LibCellNum(pLib), pCacheName );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    ABC_FREE( pCacheName );
     return pLib;
 }
+SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use )
+{
+    return Abc_SclReadLibertyPar( pFileName, fVerbose, fVeryVerbose, dont_use, 1, 0 );
+}
 
 /**Function*************************************************************
 
@@ -1746,12 +2281,12 @@ void Scl_LibertyTest()
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
 //    return;
-    p = Scl_LibertyParse( pFileName, fVeryVerbose );
+    p = Scl_LibertyParse( pFileName, fVeryVerbose, 1 );
     if ( p == NULL )
         return;
 //    Scl_LibertyParseDump( p, "temp_.lib" );
     SC_DontUse dont_use = {0};
-    vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose, dont_use);
+    vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose, dont_use, 1 );
     Scl_LibertyStringDump( "test_scl.lib", vStr );
     Vec_StrFree( vStr );
     Scl_LibertyStop( p, fVerbose );
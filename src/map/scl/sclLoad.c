@@ -167,24 +167,27 @@ void Abc_SclComputeLoad( SC_Man * p )
 */
     // calculate average load
 //    if ( p->EstLoadMax )
+    Abc_SclComputeLoadAve( p );
+}
+void Abc_SclComputeLoadAve( SC_Man * p )
+{
+    Abc_Obj_t * pObj;
+    double TotalLoad = 0;
+    int i, nObjs = 0;
+    Abc_NtkForEachNode1( p->pNtk, pObj, i )
     {
-        double TotalLoad = 0;
-        int nObjs = 0;
-        Abc_NtkForEachNode1( p->pNtk, pObj, i )
-        {
-            SC_Pair * pLoad = Abc_SclObjLoad( p, pObj );
-            TotalLoad += 0.5 * pLoad->fall + 0.5 * pLoad->rise;
-            nObjs++;
-        }
-        Abc_NtkForEachPi( p->pNtk, pObj, i )
-        {
-            SC_Pair * pLoad = Abc_SclObjLoad( p, pObj );
-            TotalLoad += 0.5 * pLoad->fall + 0.5 * pLoad->rise;
-            nObjs++;
-        }
-        p->EstLoadAve = (float)(TotalLoad / nObjs);
-//        printf( "Average load = %.2f\n", p->EstLoadAve );
+        SC_Pair * pLoad = Abc_SclObjLoad( p, pObj );
+        TotalLoad += 0.5 * pLoad->fall + 0.5 * pLoad->rise;
+        nObjs++;
+    }
+    Abc_NtkForEachPi( p->pNtk, pObj, i )
+    {
+        SC_Pair * pLoad = Abc_SclObjLoad( p, pObj );
+        TotalLoad += 0.5 * pLoad->fall + 0.5 * pLoad->rise;
+        nObjs++;
     }
+    p->EstLoadAve = (float)(TotalLoad / nObjs);
+//    printf( "Average load = %.2f\n", p->EstLoadAve );
 }
 
 /**Function*************************************************************
@@ -201,7 +204,7 @@ void Abc_SclComputeLoad( SC_Man * p )
 void Abc_SclUpdateLoad( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pOld, SC_Cell * pNew )
 {
     Abc_Obj_t * pFanin;
-    int k;
+    int k, c;
     Abc_ObjForEachFanin( pObj, pFanin, k )
     {
         SC_Pair * pLoad = Abc_SclObjLoad( p, pFanin );
@@ -209,6 +212,15 @@ void Abc_SclUpdateLoad( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pOld, SC_Cell *
         SC_Pin * pPinNew = SC_CellPin( pNew, k );
         pLoad->rise += pPinNew->rise_cap - pPinOld->rise_cap;
         pLoad->fall += pPinNew->fall_cap - pPinOld->fall_cap;
+        // the loads in the additional corners
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            pLoad   = Abc_SclObjLoadC( p, pFanin, c );
+            pPinOld = SC_CellPin( Abc_SclCornerCells(p, pOld)[c], k );
+            pPinNew = SC_CellPin( Abc_SclCornerCells(p, pNew)[c], k );
+            pLoad->rise += pPinNew->rise_cap - pPinOld->rise_cap;
+            pLoad->fall += pPinNew->fall_cap - pPinOld->fall_cap;
+        }
     }
 }
 void Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Abc_Obj_t * pFanout )
@@ -175,6 +175,10 @@ void Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath )
     Abc_Print( 1, "(%5.1f %%)   ",         100.0 * Abc_SclCountNearCriticalNodes(p) / Abc_NtkNodeNum(p->pNtk) );
     Abc_Print( 1, "            \n" );
 #endif
+    for ( i = 0; i < p->nCorners; i++ )
+        Abc_Print( 1, "Corner %d: Library = \"%s\"  Delay =%9.2f ps\n", i + 1, SC_LibCorner(p->pLib, i)->pName, p->pDelaysC[i] );
+    if ( p->nCorners )
+        Abc_Print( 1, "Worst delay across %d corners =%9.2f ps\n", p->nCorners + 1, p->MaxDelayC );
 
     if ( fShowAll )
     {
@@ -441,6 +445,123 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Timing computation in the additional corners.]
+
+  Description [Computes arrivals and slews in all additional corners in 
+  one topological traversal, using the up-to-date timing of the main 
+  corner. The loads in each corner are those of the main corner adjusted 
+  by the difference in the pin capacitances of the corner cells, so the 
+  wire loads and the output loads are shared by all corners. The values 
+  of the corners are stored next to each other for each object. Buffer 
+  tree estimation is only used in the main corner. The departure times 
+  in the corners are computed in one reverse traversal. Returns the max 
+  delay across all corners, including the main one.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_SclTimeNodeCorners( SC_Man * p, Abc_Obj_t * pObj )
+{
+    SC_Cell ** pCells;
+    SC_Pair * pLoad, * pArr, * pSlew;
+    Abc_Obj_t * pFanin;
+    int k, c, nCorners = p->nCorners;
+    pLoad = Abc_SclObjLoadC( p, pObj, 0 );
+    pArr  = Abc_SclObjTimeC( p, pObj, 0 );
+    pSlew = Abc_SclObjSlewC( p, pObj, 0 );
+    if ( Abc_ObjIsCi(pObj) )
+    {
+        for ( c = 0; c < nCorners; c++ )
+            if ( p->pPiDrive != NULL )
+                Scl_LibHandleInputDriver( Abc_SclCornerCells(p, p->pPiDrive)[c], pLoad + c, pArr + c, pSlew + c );
+            else
+                pArr[c] = *Abc_SclObjTime(p, pObj), pSlew[c] = *Abc_SclObjSlew(p, pObj);
+        return;
+    }
+    if ( Abc_ObjIsCo(pObj) )
+    {
+        for ( c = 0; c < nCorners; c++ )
+            pArr[c] = *Abc_SclObjTimeC( p, Abc_ObjFanin0(pObj), c );
+        return;
+    }
+    pCells = Abc_SclCornerCells( p, Abc_SclObjCell(pObj) );
+    for ( c = 0; c < nCorners; c++ )
+    {
+        SC_PairClean( pArr + c );
+        SC_PairClean( pSlew + c );
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Scl_LibPinArrival( Scl_CellPinTime(pCells[c], k), Abc_SclObjTimeC(p, pFanin, c), Abc_SclObjSlewC(p, pFanin, c), pLoad + c, pArr + c, pSlew + c );
+    }
+}
+float Abc_SclTimeCorners( SC_Man * p )
+{
+    SC_Cell * pCell, ** pCells;
+    SC_Pin * pPin, * pPinC;
+    SC_Pair * pLoad, * pArr;
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k, c, nCorners = p->nCorners;
+    p->MaxDelayC = Abc_SclReadMaxDelay( p );
+    if ( nCorners == 0 )
+        return p->MaxDelayC;
+    // compute loads
+    Abc_NtkForEachObj( p->pNtk, pObj, i )
+        for ( c = 0; c < nCorners; c++ )
+            *Abc_SclObjLoadC(p, pObj, c) = *Abc_SclObjLoad(p, pObj);
+    Abc_NtkForEachNode1( p->pNtk, pObj, i )
+    {
+        pCell  = Abc_SclObjCell( pObj );
+        pCells = Abc_SclCornerCells( p, pCell );
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+        {
+            pPin  = SC_CellPin( pCell, k );
+            pLoad = Abc_SclObjLoadC( p, pFanin, 0 );
+            for ( c = 0; c < nCorners; c++ )
+            {
+                pPinC = SC_CellPin( pCells[c], k );
+                pLoad[c].rise += pPinC->rise_cap - pPin->rise_cap;
+                pLoad[c].fall += pPinC->fall_cap - pPin->fall_cap;
+            }
+        }
+    }
+    // compute arrivals and slews
+    Abc_NtkForEachCi( p->pNtk, pObj, i )
+        Abc_SclTimeNodeCorners( p, pObj );
+    Abc_NtkForEachNode1( p->pNtk, pObj, i )
+        Abc_SclTimeNodeCorners( p, pObj );
+    for ( c = 0; c < nCorners; c++ )
+        p->pDelaysC[c] = 0;
+    Abc_NtkForEachCo( p->pNtk, pObj, i )
+    {
+        Abc_SclTimeNodeCorners( p, pObj );
+        pArr = Abc_SclObjTimeC( p, pObj, 0 );
+        for ( c = 0; c < nCorners; c++ )
+            p->pDelaysC[c] = Abc_MaxFloat( p->pDelaysC[c], SC_PairMax(pArr + c) );
+    }
+    for ( c = 0; c < nCorners; c++ )
+        p->MaxDelayC = Abc_MaxFloat( p->MaxDelayC, p->pDelaysC[c] );
+    // compute departures
+    memset( p->pDeptsC, 0, sizeof(SC_Pair) * p->nObjs * nCorners );
+    Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
+    {
+        pCells = Abc_SclCornerCells( p, Abc_SclObjCell(pObj) );
+        for ( c = 0; c < nCorners; c++ )
+            Abc_ObjForEachFanin( pObj, pFanin, k )
+                Scl_LibPinDeparture( Scl_CellPinTime(pCells[c], k), Abc_SclObjDeptC(p, pFanin, c), Abc_SclObjSlewC(p, pFanin, c), Abc_SclObjLoadC(p, pObj, c), Abc_SclObjDeptC(p, pObj, c) );
+    }
+    return p->MaxDelayC;
+}
+void Abc_SclTimeConeCorners( SC_Man * p, Vec_Int_t * vCone )
+{
+    Abc_Obj_t * pObj;
+    int i;
+    Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
+        Abc_SclTimeNodeCorners( p, pObj );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Incremental timing update.]
@@ -492,13 +613,12 @@ static inline void Abc_SclTimeIncAddFanouts( SC_Man * p, Abc_Obj_t * pObj )
         if ( !pFanout->fMarkC && !Abc_ObjIsLatch(pFanout) )
             Abc_SclTimeIncAddNode( p, pFanout );
 }
-static inline void Abc_SclTimeIncUpdateArrival( SC_Man * p )
+static inline void Abc_SclTimeIncUpdateArrival( SC_Man * p, float E )
 {
     Vec_Int_t * vLevel;
     SC_Pair ArrOut, SlewOut;
     SC_Pair * pArrOut, *pSlewOut;
     Abc_Obj_t * pObj;
-    float E = (float)0.1;
     int i, k;
     Vec_WecForEachLevel( p->vLevels, vLevel, i )
     {
@@ -517,18 +637,17 @@ static inline void Abc_SclTimeIncUpdateArrival( SC_Man * p )
             SC_PairMove( &SlewOut, pSlewOut );
             Abc_SclTimeNode( p, pObj, 0 );
 //            if ( !SC_PairEqual(&ArrOut, pArrOut) || !SC_PairEqual(&SlewOut, pSlewOut) )
-            if ( !SC_PairEqualE(&ArrOut, pArrOut, E) || !SC_PairEqualE(&SlewOut, pSlewOut, E) )
+            if ( E == 0 ? !SC_PairEqual(&ArrOut, pArrOut) || !SC_PairEqual(&SlewOut, pSlewOut) : !SC_PairEqualE(&ArrOut, pArrOut, E) || !SC_PairEqualE(&SlewOut, pSlewOut, E) )
                 Abc_SclTimeIncAddFanouts( p, pObj );
         }
     }
     p->MaxDelay = Abc_SclReadMaxDelay( p );
 }
-static inline void Abc_SclTimeIncUpdateDeparture( SC_Man * p )
+static inline void Abc_SclTimeIncUpdateDeparture( SC_Man * p, float E )
 {
     Vec_Int_t * vLevel;
     SC_Pair DepOut, * pDepOut;
     Abc_Obj_t * pObj;
-    float E = (float)0.1;
     int i, k;
     Vec_WecForEachLevelReverse( p->vLevels, vLevel, i )
     {
@@ -538,7 +657,7 @@ static inline void Abc_SclTimeIncUpdateDeparture( SC_Man * p )
             SC_PairMove( &DepOut, pDepOut );
             Abc_SclDeptObj( p, pObj );
 //            if ( !SC_PairEqual(&DepOut, pDepOut) )
-            if ( !SC_PairEqualE(&DepOut, pDepOut, E) )
+            if ( E == 0 ? !SC_PairEqual(&DepOut, pDepOut) : !SC_PairEqualE(&DepOut, pDepOut, E) )
                 Abc_SclTimeIncAddFanins( p, pObj );
         }
     } 
@@ -552,7 +671,7 @@ void Abc_SclTimeIncCheckLevel( Abc_Ntk_t * pNtk )
         if ( (int)pObj->Level != Abc_ObjLevelNew(pObj) )
             printf( "Level of node %d is out of date!\n", i );
 }
-int Abc_SclTimeIncUpdate( SC_Man * p )
+static int Abc_SclTimeIncUpdateInt( SC_Man * p, int fDept, float E )
 {
     Abc_Obj_t * pObj;
     int i, RetValue;
@@ -567,13 +686,18 @@ int Abc_SclTimeIncUpdate( SC_Man * p )
         Abc_SclTimeIncAddNode( p, pObj );
     }
     Vec_IntClear( p->vChanged );
-    Abc_SclTimeIncUpdateArrival( p );
-    Abc_SclTimeIncUpdateDeparture( p );
+    Abc_SclTimeIncUpdateArrival( p, E );
+    if ( fDept )
+        Abc_SclTimeIncUpdateDeparture( p, E );
     Abc_SclTimeIncUpdateClean( p );
     RetValue = p->nIncUpdates;
     p->nIncUpdates = 0;
     return RetValue;
 }
+int Abc_SclTimeIncUpdate( SC_Man * p )
+{
+    return Abc_SclTimeIncUpdateInt( p, 1, (float)0.1 );
+}
 void Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj )
 {
     Vec_IntPush( p->vChanged, Abc_ObjId(pObj) );
@@ -634,6 +758,129 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
     }
 }
  
+/**Function*************************************************************
+
+  Synopsis    [Timing manager kept with the network between the commands.]
+
+  Description [When a sizing command finishes, its timing manager is stored
+  with the network together with the gate assignment and a structural
+  signature of the network. The next command started on the same network
+  with the same library and timing settings takes over the stored arrival
+  times, slews, and loads and only updates timing in the fanin/fanout cones
+  of the gates that were changed in between, instead of recomputing
+  the timing of the whole network.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Abc_SclNtkSign( Abc_Ntk_t * pNtk )
+{
+    Abc_Obj_t * pObj, * pFanin;
+    word uSign = Abc_NtkObjNum(pNtk);
+    int i, k;
+    Abc_NtkForEachObj( pNtk, pObj, i )
+    {
+        uSign = uSign * ABC_CONST(0x9E3779B97F4A7C15) + ((word)i << 8) + pObj->Type;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            uSign = uSign * ABC_CONST(0x9E3779B97F4A7C15) + Abc_ObjId(pFanin);
+    }
+    return uSign;
+}
+static void Abc_SclManStoredFreeInt( void * p )
+{
+    Abc_SclManFreeInt( (SC_Man *)p );
+}
+void Abc_SclManStoredFree( Abc_Ntk_t * pNtk )
+{
+    if ( pNtk->pSclMan == NULL )
+        return;
+    Abc_SclManFreeInt( (SC_Man *)pNtk->pSclMan );
+    pNtk->pSclMan = NULL;
+}
+void Abc_SclManStore( SC_Man * p, int fDeptValid )
+{
+    Abc_Ntk_t * pNtk = p->pNtk;
+    Abc_SclManStoredFree( pNtk );
+    assert( p->vGatesPrev == NULL );
+    // the gates may have been already transferred back to the mapped network
+    if ( pNtk->vGates == NULL )
+        Abc_SclMioGates2SclGates( p->pLib, pNtk );
+    if ( pNtk->vGates == NULL )
+    {
+        Abc_SclManFree( p );
+        return;
+    }
+    p->vGatesPrev = Vec_IntDup( pNtk->vGates );
+    p->pLibName   = Abc_UtilStrsav( p->pLib->pName );
+    p->LibGeneration = p->pLib->nGeneration;
+    p->uNtkSign   = Abc_SclNtkSign( pNtk );
+    p->fDeptValid = fDeptValid;
+    Abc_SclManReleaseNtk( p );
+    pNtk->pSclMan = p;
+    pNtk->pSclManFree = Abc_SclManStoredFreeInt;
+}
+static int Abc_SclManRestore( SC_Man * p, int fDept, float DUser )
+{
+    Abc_Ntk_t * pNtk = p->pNtk;
+    SC_Man * pOld = (SC_Man *)pNtk->pSclMan;
+    Abc_Obj_t * pObj;
+    int i, iGate, iGateOld, fDeptValid, fReuse;
+    if ( pOld == NULL )
+        return 0;
+    pNtk->pSclMan = NULL;
+    // the stored library may have been freed; it is never dereferenced
+    fReuse = pOld->LibGeneration == p->pLib->nGeneration && pOld->pLibName && p->pLib->pName && !strcmp(pOld->pLibName, p->pLib->pName) &&
+        pOld->pLib == p->pLib && pOld->nObjs == p->nObjs && pOld->pWLoadUsed == p->pWLoadUsed && pOld->pPiDrive == p->pPiDrive && pOld->EstLoadMax == 0 && p->EstLoadMax == 0 &&
+        Vec_IntSize(pOld->vGatesPrev) == Vec_IntSize(pNtk->vGates) && pOld->uNtkSign == Abc_SclNtkSign(pNtk);
+    Abc_NtkForEachPo( pNtk, pObj, i )
+        if ( fReuse && !SC_PairEqual(Abc_SclObjLoad(p, pObj), Abc_SclObjLoad(pOld, pObj)) )
+            fReuse = 0;
+    if ( !fReuse )
+    {
+        Abc_SclManFreeInt( pOld );
+        return 0;
+    }
+    // take over the timing information
+    memcpy( p->pLoads, pOld->pLoads, sizeof(SC_Pair) * p->nObjs );
+    memcpy( p->pDepts, pOld->pDepts, sizeof(SC_Pair) * p->nObjs );
+    memcpy( p->pTimes, pOld->pTimes, sizeof(SC_Pair) * p->nObjs );
+    memcpy( p->pSlews, pOld->pSlews, sizeof(SC_Pair) * p->nObjs );
+    memcpy( Vec_FltArray(p->vTimesOut), Vec_FltArray(pOld->vTimesOut), sizeof(float) * Vec_FltSize(p->vTimesOut) );
+    for ( i = 0; i < Vec_FltSize(p->vTimesOut); i++ )
+        Vec_QueUpdate( p->vQue, i );
+    ABC_SWAP( Vec_Flt_t *, p->vWireCaps, pOld->vWireCaps );
+    // schedule the gates changed since the manager was stored
+    Vec_IntForEachEntry( pNtk->vGates, iGate, i )
+    {
+        iGateOld = Vec_IntEntry( pOld->vGatesPrev, i );
+        if ( iGate == iGateOld )
+            continue;
+        assert( iGate >= 0 && iGateOld >= 0 );
+        pObj = Abc_NtkObj( pNtk, i );
+        Abc_SclUpdateLoad( p, pObj, SC_LibCell(p->pLib, iGateOld), SC_LibCell(p->pLib, iGate) );
+        Abc_SclTimeIncInsert( p, pObj );
+    }
+    fDeptValid = pOld->fDeptValid;
+    Abc_SclManFreeInt( pOld );
+    // update timing in the cones of the changed gates
+    Abc_SclTimeIncUpdateInt( p, fDept && fDeptValid, 0 );
+    if ( fDept && !fDeptValid )
+    {
+        memset( p->pDepts, 0, sizeof(SC_Pair) * p->nObjs );
+        p->nEstNodes = 0;
+        Abc_NtkForEachNodeReverse1( pNtk, pObj, i )
+            Abc_SclTimeNode( p, pObj, 1 );
+    }
+    Abc_SclComputeLoadAve( p );
+    p->SumArea0  = Abc_SclGetTotalArea( pNtk );
+    p->MaxDelay0 = Abc_SclReadMaxDelay( p );
+    if ( fDept && DUser > 0 && p->MaxDelay0 < DUser )
+        p->MaxDelay0 = DUser;
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Prepare timing manager.]
@@ -666,7 +913,9 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
         else
             p->pWLoadUsed = Abc_SclFetchWireLoadModel( pLib, pNtk->pWLoadUsed );
     }
-    Abc_SclTimeNtkRecompute( p, &p->SumArea0, &p->MaxDelay0, fDept, DUser );
+    if ( !Abc_SclManRestore( p, fDept, DUser ) )
+        Abc_SclTimeNtkRecompute( p, &p->SumArea0, &p->MaxDelay0, fDept, DUser );
+    Abc_SclTimeCorners( p );
     p->SumArea  = p->SumArea0;
     p->MaxDelay = p->MaxDelay0;
     return p;
@@ -690,7 +939,7 @@ void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, in
     Abc_SclTimeNtkPrint( p, fShowAll, fPrintPath );
     if ( fDumpStats )
         Abc_SclDumpStats( p, "stats.txt", 0 );
-    Abc_SclManFree( p );
+    Abc_SclManStore( p, 1 );
 }
 
 /**Function*************************************************************
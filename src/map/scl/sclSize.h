@@ -62,6 +62,15 @@ struct SC_Man_
     Vec_Flt_t *    vTimesOut;     // output arrival times
     Vec_Que_t *    vQue;          // outputs by their time
     SC_Cell *      pPiDrive;      // cell driving primary inputs
+    // additional timing corners
+    int            nCorners;      // the number of additional corners
+    SC_Cell **     pCornerCells;  // the corner cells of each cell (nCorners entries per cell)
+    SC_Pair *      pLoadsC;       // loads for each gate (nCorners entries per gate)
+    SC_Pair *      pTimesC;       // arrivals for each gate (nCorners entries per gate)
+    SC_Pair *      pSlewsC;       // slews for each gate (nCorners entries per gate)
+    SC_Pair *      pDeptsC;       // departures for each gate (nCorners entries per gate)
+    float *        pDelaysC;      // max delay in each corner
+    float          MaxDelayC;     // max delay across all corners
     // backup information
     Vec_Flt_t *    vLoads2;       // backup storage for loads
     Vec_Flt_t *    vLoads3;       // backup storage for loads
@@ -82,6 +91,12 @@ struct SC_Man_
     Vec_Wec_t *    vLevels;
     Vec_Int_t *    vChanged; 
     int            nIncUpdates;
+    // timing kept with the network between the commands
+    Vec_Int_t *    vGatesPrev;    // gates when the manager was stored
+    char *         pLibName;      // name of the library when the manager was stored
+    int            LibGeneration; // generation of the library when the manager was stored
+    word           uNtkSign;      // structural signature of the network
+    int            fDeptValid;    // departure times are up to date
     // optimization parameters
     float          SumArea;       // total area
     float          MaxDelay;      // max delay
@@ -116,6 +131,12 @@ static inline SC_Pair * Abc_SclObjDept( SC_Man * p, Abc_Obj_t * pObj )
 static inline SC_Pair * Abc_SclObjTime( SC_Man * p, Abc_Obj_t * pObj )              { return p->pTimes + Abc_ObjId(pObj);  }
 static inline SC_Pair * Abc_SclObjSlew( SC_Man * p, Abc_Obj_t * pObj )              { return p->pSlews + Abc_ObjId(pObj);  }
 
+static inline SC_Cell ** Abc_SclCornerCells( SC_Man * p, SC_Cell * pCell )          { return p->pCornerCells + pCell->Id * p->nCorners;  }
+static inline SC_Pair * Abc_SclObjLoadC( SC_Man * p, Abc_Obj_t * pObj, int c )      { return p->pLoadsC + Abc_ObjId(pObj) * p->nCorners + c;  }
+static inline SC_Pair * Abc_SclObjTimeC( SC_Man * p, Abc_Obj_t * pObj, int c )      { return p->pTimesC + Abc_ObjId(pObj) * p->nCorners + c;  }
+static inline SC_Pair * Abc_SclObjSlewC( SC_Man * p, Abc_Obj_t * pObj, int c )      { return p->pSlewsC + Abc_ObjId(pObj) * p->nCorners + c;  }
+static inline SC_Pair * Abc_SclObjDeptC( SC_Man * p, Abc_Obj_t * pObj, int c )      { return p->pDeptsC + Abc_ObjId(pObj) * p->nCorners + c;  }
+
 static inline double    Abc_SclObjLoadMax( SC_Man * p, Abc_Obj_t * pObj )           { return Abc_MaxFloat(Abc_SclObjLoad(p, pObj)->rise, Abc_SclObjLoad(p, pObj)->fall);  }
 static inline float     Abc_SclObjLoadAve( SC_Man * p, Abc_Obj_t * pObj )           { return 0.5 * Abc_SclObjLoad(p, pObj)->rise + 0.5 * Abc_SclObjLoad(p, pObj)->fall;   }
 static inline double    Abc_SclObjTimeOne( SC_Man * p, Abc_Obj_t * pObj, int fRise ){ return fRise ? Abc_SclObjTime(p, pObj)->rise : Abc_SclObjTime(p, pObj)->fall;       }
@@ -162,6 +183,21 @@ static inline SC_Man * Abc_SclManAlloc( SC_Lib * pLib, Abc_Ntk_t * pNtk )
     p->pTimes    = ABC_CALLOC( SC_Pair, p->nObjs );
     p->pSlews    = ABC_CALLOC( SC_Pair, p->nObjs );
     p->vBestFans = Vec_IntStart( p->nObjs );
+    p->nCorners  = SC_LibCornerNum( pLib );
+    if ( p->nCorners )
+    {
+        SC_Cell * pCell;
+        int c;
+        p->pCornerCells = ABC_ALLOC( SC_Cell *, SC_LibCellNum(pLib) * p->nCorners );
+        SC_LibForEachCell( pLib, pCell, i )
+            for ( c = 0; c < p->nCorners; c++ )
+                p->pCornerCells[i * p->nCorners + c] = (SC_Cell *)Vec_PtrEntry( SC_LibCorner(pLib, c)->vCornerCells, i );
+        p->pLoadsC  = ABC_CALLOC( SC_Pair, p->nObjs * p->nCorners );
+        p->pTimesC  = ABC_CALLOC( SC_Pair, p->nObjs * p->nCorners );
+        p->pSlewsC  = ABC_CALLOC( SC_Pair, p->nObjs * p->nCorners );
+        p->pDeptsC  = ABC_CALLOC( SC_Pair, p->nObjs * p->nCorners );
+        p->pDelaysC = ABC_CALLOC( float, p->nCorners );
+    }
     p->vTimesOut = Vec_FltStart( Abc_NtkCoNum(pNtk) );
     p->vQue      = Vec_QueAlloc( Abc_NtkCoNum(pNtk) );
     Vec_QueSetPriority( p->vQue, Vec_FltArrayP(p->vTimesOut) );
@@ -190,7 +226,7 @@ static inline SC_Man * Abc_SclManAlloc( SC_Lib * pLib, Abc_Ntk_t * pNtk )
         pObj->iData = i;
     return p;
 }
-static inline void Abc_SclManFree( SC_Man * p )
+static inline void Abc_SclManReleaseNtk( SC_Man * p )
 {
     Abc_Obj_t * pObj;
     int i;
@@ -202,6 +238,11 @@ static inline void Abc_SclManFree( SC_Man * p )
     // other
     p->pNtk->pSCLib = NULL;
     Vec_IntFreeP( &p->pNtk->vGates );
+}
+static inline void Abc_SclManFreeInt( SC_Man * p )
+{
+    Vec_IntFreeP( &p->vGatesPrev );
+    ABC_FREE( p->pLibName );
     Vec_IntFreeP( &p->vNodeIter );
     Vec_QueFreeP( &p->vNodeByGain );
     Vec_FltFreeP( &p->vNode2Gain );
@@ -227,8 +268,19 @@ static inline void Abc_SclManFree( SC_Man * p )
     ABC_FREE( p->pDepts );
     ABC_FREE( p->pTimes );
     ABC_FREE( p->pSlews );
+    ABC_FREE( p->pCornerCells );
+    ABC_FREE( p->pLoadsC );
+    ABC_FREE( p->pTimesC );
+    ABC_FREE( p->pSlewsC );
+    ABC_FREE( p->pDeptsC );
+    ABC_FREE( p->pDelaysC );
     ABC_FREE( p );
 }
+static inline void Abc_SclManFree( SC_Man * p )
+{
+    Abc_SclManReleaseNtk( p );
+    Abc_SclManFreeInt( p );
+}
 /*
 static inline void Abc_SclManCleanTime( SC_Man * p )
 {
@@ -291,22 +343,32 @@ static inline void Abc_SclManCleanTime( SC_Man * p )
 static inline void Abc_SclLoadStore( SC_Man * p, Abc_Obj_t * pObj )
 {
     Abc_Obj_t * pFanin;
-    int i;
+    int i, c;
     Vec_FltClear( p->vLoads2 );
     Abc_ObjForEachFanin( pObj, pFanin, i )
     {
         Vec_FltPush( p->vLoads2, Abc_SclObjLoad(p, pFanin)->rise );
         Vec_FltPush( p->vLoads2, Abc_SclObjLoad(p, pFanin)->fall );
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            Vec_FltPush( p->vLoads2, Abc_SclObjLoadC(p, pFanin, c)->rise );
+            Vec_FltPush( p->vLoads2, Abc_SclObjLoadC(p, pFanin, c)->fall );
+        }
     }
 }
 static inline void Abc_SclLoadRestore( SC_Man * p, Abc_Obj_t * pObj )
 {
     Abc_Obj_t * pFanin;
-    int i, k = 0;
+    int i, c, k = 0;
     Abc_ObjForEachFanin( pObj, pFanin, i )
     {
         Abc_SclObjLoad(p, pFanin)->rise = Vec_FltEntry(p->vLoads2, k++);
         Abc_SclObjLoad(p, pFanin)->fall = Vec_FltEntry(p->vLoads2, k++);
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            Abc_SclObjLoadC(p, pFanin, c)->rise = Vec_FltEntry(p->vLoads2, k++);
+            Abc_SclObjLoadC(p, pFanin, c)->fall = Vec_FltEntry(p->vLoads2, k++);
+        }
     }
     assert( Vec_FltSize(p->vLoads2) == k );
 }
@@ -340,7 +402,7 @@ static inline void Abc_SclLoadRestore3( SC_Man * p, Abc_Obj_t * pObj )
 static inline void Abc_SclConeStore( SC_Man * p, Vec_Int_t * vCone )
 {
     Abc_Obj_t * pObj;
-    int i;
+    int i, c;
     Vec_FltClear( p->vTimes2 );
     Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
     {
@@ -348,18 +410,32 @@ static inline void Abc_SclConeStore( SC_Man * p, Vec_Int_t * vCone )
         Vec_FltPush( p->vTimes2, Abc_SclObjTime(p, pObj)->fall );
         Vec_FltPush( p->vTimes2, Abc_SclObjSlew(p, pObj)->rise );
         Vec_FltPush( p->vTimes2, Abc_SclObjSlew(p, pObj)->fall );
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            Vec_FltPush( p->vTimes2, Abc_SclObjTimeC(p, pObj, c)->rise );
+            Vec_FltPush( p->vTimes2, Abc_SclObjTimeC(p, pObj, c)->fall );
+            Vec_FltPush( p->vTimes2, Abc_SclObjSlewC(p, pObj, c)->rise );
+            Vec_FltPush( p->vTimes2, Abc_SclObjSlewC(p, pObj, c)->fall );
+        }
     }
 }
 static inline void Abc_SclConeRestore( SC_Man * p, Vec_Int_t * vCone )
 {
     Abc_Obj_t * pObj;
-    int i, k = 0;
+    int i, c, k = 0;
     Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
     {
         Abc_SclObjTime(p, pObj)->rise = Vec_FltEntry(p->vTimes2, k++);
         Abc_SclObjTime(p, pObj)->fall = Vec_FltEntry(p->vTimes2, k++);
         Abc_SclObjSlew(p, pObj)->rise = Vec_FltEntry(p->vTimes2, k++);
         Abc_SclObjSlew(p, pObj)->fall = Vec_FltEntry(p->vTimes2, k++);
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            Abc_SclObjTimeC(p, pObj, c)->rise = Vec_FltEntry(p->vTimes2, k++);
+            Abc_SclObjTimeC(p, pObj, c)->fall = Vec_FltEntry(p->vTimes2, k++);
+            Abc_SclObjSlewC(p, pObj, c)->rise = Vec_FltEntry(p->vTimes2, k++);
+            Abc_SclObjSlewC(p, pObj, c)->fall = Vec_FltEntry(p->vTimes2, k++);
+        }
     }
     assert( Vec_FltSize(p->vTimes2) == k );
 }
@@ -388,6 +464,43 @@ static inline float Abc_SclEvalPerform( SC_Man * p, Vec_Int_t * vCone )
     assert( Vec_FltSize(p->vTimes3) == k );
     return Eval / Vec_IntSize(vCone);
 }
+static inline void Abc_SclEvalStoreCorners( SC_Man * p, Vec_Int_t * vCone )
+{
+    Abc_Obj_t * pObj;
+    int i, c;
+    Vec_FltClear( p->vTimes3 );
+    Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
+    {
+        Vec_FltPush( p->vTimes3, Abc_SclObjTime(p, pObj)->rise );
+        Vec_FltPush( p->vTimes3, Abc_SclObjTime(p, pObj)->fall );
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            Vec_FltPush( p->vTimes3, Abc_SclObjTimeC(p, pObj, c)->rise );
+            Vec_FltPush( p->vTimes3, Abc_SclObjTimeC(p, pObj, c)->fall );
+        }
+    }
+}
+static inline float Abc_SclEvalPerformCorners( SC_Man * p, Vec_Int_t * vCone )
+{
+    Abc_Obj_t * pObj;
+    SC_Pair * pTime;
+    float Diff, Multi = 1.5, Eval, EvalMax = 0;
+    int i, c, k;
+    for ( c = -1; c < p->nCorners; c++ )
+    {
+        Eval = 0;
+        Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
+        {
+            k = 2 * (i * (p->nCorners + 1) + c + 1);
+            pTime = c < 0 ? Abc_SclObjTime(p, pObj) : Abc_SclObjTimeC(p, pObj, c);
+            Diff  = (Vec_FltEntry(p->vTimes3, k)   - pTime->rise);
+            Diff += (Vec_FltEntry(p->vTimes3, k+1) - pTime->fall);
+            Eval += 0.5 * (Diff > 0 ? Diff : Multi * Diff);
+        }
+        EvalMax = c < 0 ? Eval : Abc_MaxFloat( EvalMax, Eval );
+    }
+    return EvalMax / Vec_IntSize(vCone);
+}
 static inline float Abc_SclEvalPerformLegal( SC_Man * p, Vec_Int_t * vCone, float D )
 {
     Abc_Obj_t * pObj;
@@ -476,6 +589,41 @@ static inline float Abc_SclReadMaxDelay( SC_Man * p )
 {
     return Abc_SclObjTimeMax( p, Abc_NtkCo(p->pNtk, Vec_QueTop(p->vQue)) );
 }
+static inline float Abc_SclReadMaxDelayWorst( SC_Man * p )
+{
+    return p->nCorners ? p->MaxDelayC : Abc_SclReadMaxDelay( p );
+}
+static inline float Abc_SclObjTimeMaxWorst( SC_Man * p, Abc_Obj_t * pObj )
+{
+    float Time = Abc_SclObjTimeMax( p, pObj );
+    int c;
+    for ( c = 0; c < p->nCorners; c++ )
+        Time = Abc_MaxFloat( Time, SC_PairMax(Abc_SclObjTimeC(p, pObj, c)) );
+    return Time;
+}
+static inline float Abc_SclGetMaxDelayNodeFaninsWorst( SC_Man * p, Abc_Obj_t * pNode )
+{
+    float fMaxArr = 0;
+    Abc_Obj_t * pObj;
+    int i;
+    assert( Abc_ObjIsNode(pNode) );
+    Abc_ObjForEachFanin( pNode, pObj, i )
+        fMaxArr = Abc_MaxFloat( fMaxArr, Abc_SclObjTimeMaxWorst(p, pObj) );
+    return fMaxArr;
+}
+static inline float Abc_SclObjGetSlackWorst( SC_Man * p, Abc_Obj_t * pObj, float D )
+{
+    float Slack = Abc_SclObjGetSlack( p, pObj, D );
+    SC_Pair * pArr, * pDep;
+    int c;
+    for ( c = 0; c < p->nCorners; c++ )
+    {
+        pArr  = Abc_SclObjTimeC( p, pObj, c );
+        pDep  = Abc_SclObjDeptC( p, pObj, c );
+        Slack = Abc_MinFloat( Slack, D - Abc_MaxFloat(pArr->rise + pDep->rise, pArr->fall + pDep->fall) );
+    }
+    return Slack;
+}
 
 /**Function*************************************************************
 
@@ -558,6 +706,7 @@ extern Vec_Flt_t *   Abc_SclFindWireCaps( SC_WireLoad * pWL, int nFanoutMax );
 extern float         Abc_SclFindWireLoad( Vec_Flt_t * vWireCaps, int nFans );
 extern void          Abc_SclAddWireLoad( SC_Man * p, Abc_Obj_t * pObj, int fSubtr );
 extern void          Abc_SclComputeLoad( SC_Man * p );
+extern void          Abc_SclComputeLoadAve( SC_Man * p );
 extern void          Abc_SclUpdateLoad( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pOld, SC_Cell * pNew );
 extern void          Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Abc_Obj_t * pFanout );
 /*=== sclSize.c ===============================================================*/
@@ -565,8 +714,12 @@ extern Abc_Obj_t *   Abc_SclFindCriticalCo( SC_Man * p, int * pfRise );
 extern Abc_Obj_t *   Abc_SclFindMostCriticalFanin( SC_Man * p, int * pfRise, Abc_Obj_t * pNode );
 extern void          Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath );
 extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio );
+extern void          Abc_SclManStore( SC_Man * p, int fDeptValid );
+extern void          Abc_SclManStoredFree( Abc_Ntk_t * pNtk );
 extern void          Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone );
 extern void          Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser );
+extern float         Abc_SclTimeCorners( SC_Man * p );
+extern void          Abc_SclTimeConeCorners( SC_Man * p, Vec_Int_t * vCone );
 extern int           Abc_SclTimeIncUpdate( SC_Man * p );
 extern void          Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj );
 extern void          Abc_SclTimeIncUpdateLevel( Abc_Obj_t * pObj );
@@ -20,6 +20,16 @@
 
 #include "sclSize.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,6 +37,9 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define SCL_UPS_THR_MAX    100   // the largest number of threads
+#define SCL_UPS_BATCH_MIN    4   // smaller batches are evaluated by the main thread
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -97,13 +110,13 @@ Vec_Int_t * Abc_SclFindTFO( Abc_Ntk_t * p, Vec_Int_t * vPath )
 ***********************************************************************/
 Vec_Int_t * Abc_SclFindCriticalCoWindow( SC_Man * p, int Window )
 {
-    float fMaxArr = Abc_SclReadMaxDelay( p ) * (100.0 - Window) / 100.0;
+    float fMaxArr = Abc_SclReadMaxDelayWorst( p ) * (100.0 - Window) / 100.0;
     Vec_Int_t * vPivots;
     Abc_Obj_t * pObj;
     int i;
     vPivots = Vec_IntAlloc( 100 );
     Abc_NtkForEachCo( p->pNtk, pObj, i )
-        if ( Abc_SclObjTimeMax(p, pObj) >= fMaxArr )
+        if ( Abc_SclObjTimeMaxWorst(p, pObj) >= fMaxArr )
             Vec_IntPush( vPivots, Abc_ObjId(pObj) );
     assert( Vec_IntSize(vPivots) > 0 );
     return vPivots;
@@ -134,9 +147,9 @@ void Abc_SclFindCriticalNodeWindow_rec( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t
     // compute the max arrival time of the fanins
     if ( fDept )
 //        fArrMax = p->pSlack[Abc_ObjId(pObj)];
-        fArrMax = Abc_SclObjGetSlack(p, pObj, p->MaxDelay);
+        fArrMax = Abc_SclObjGetSlackWorst(p, pObj, p->MaxDelay);
     else
-        fArrMax = Abc_SclGetMaxDelayNodeFanins( p, pObj );
+        fArrMax = Abc_SclGetMaxDelayNodeFaninsWorst( p, pObj );
 //    assert( fArrMax >= -1 );
     fArrMax = Abc_MaxFloat( fArrMax, 0 );
     // traverse all fanins whose arrival times are within a window
@@ -147,9 +160,9 @@ void Abc_SclFindCriticalNodeWindow_rec( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t
         assert( Abc_ObjIsNode(pNext) );
         if ( fDept )
 //            fSlackFan = fSlack - (p->pSlack[Abc_ObjId(pNext)] - fArrMax);
-            fSlackFan = fSlack - (Abc_SclObjGetSlack(p, pNext, p->MaxDelay) - fArrMax);
+            fSlackFan = fSlack - (Abc_SclObjGetSlackWorst(p, pNext, p->MaxDelay) - fArrMax);
         else
-            fSlackFan = fSlack - (fArrMax - Abc_SclObjTimeMax(p, pNext));
+            fSlackFan = fSlack - (fArrMax - Abc_SclObjTimeMaxWorst(p, pNext));
         if ( fSlackFan >= 0 )
             Abc_SclFindCriticalNodeWindow_rec( p, pNext, vPath, fSlackFan, fDept );
     }
@@ -158,7 +171,7 @@ void Abc_SclFindCriticalNodeWindow_rec( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t
 }
 Vec_Int_t * Abc_SclFindCriticalNodeWindow( SC_Man * p, Vec_Int_t * vPathCos, int Window, int fDept )
 {
-    float fMaxArr = Abc_SclReadMaxDelay( p );
+    float fMaxArr = Abc_SclReadMaxDelayWorst( p );
     float fSlackMax = fMaxArr * Window / 100.0;
     Vec_Int_t * vPath = Vec_IntAlloc( 100 );
     Abc_Obj_t * pObj;
@@ -166,7 +179,7 @@ Vec_Int_t * Abc_SclFindCriticalNodeWindow( SC_Man * p, Vec_Int_t * vPathCos, int
     Abc_NtkIncrementTravId( p->pNtk ); 
     Abc_NtkForEachObjVec( vPathCos, p->pNtk, pObj, i )
     {
-        float fSlackThis = fSlackMax - (fMaxArr - Abc_SclObjTimeMax(p, pObj));
+        float fSlackThis = fSlackMax - (fMaxArr - Abc_SclObjTimeMaxWorst(p, pObj));
         if ( fSlackThis >= 0 )
             Abc_SclFindCriticalNodeWindow_rec( p, Abc_ObjFanin0(pObj), vPath, fSlackThis, fDept );
     }
@@ -280,7 +293,10 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
     // save old gate, timing, fanin load
     pCellOld = Abc_SclObjCell( pObj );
     Abc_SclConeStore( p, vRecalcs );
-    Abc_SclEvalStore( p, vEvals );
+    if ( p->nCorners )
+        Abc_SclEvalStoreCorners( p, vEvals );
+    else
+        Abc_SclEvalStore( p, vEvals );
     Abc_SclLoadStore( p, pObj );
     // try different gate sizes for this node
     gateBest = -1;
@@ -296,11 +312,13 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
         Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
         // recompute timing
         Abc_SclTimeCone( p, vRecalcs );
+        if ( p->nCorners )
+            Abc_SclTimeConeCorners( p, vRecalcs );
         // set old cell
         Abc_SclObjSetCell( pObj, pCellOld );
         Abc_SclLoadRestore( p, pObj );
-        // save best gain
-        dGain = Abc_SclEvalPerform( p, vEvals );
+        // save best gain (the largest gain across the corners)
+        dGain = p->nCorners ? Abc_SclEvalPerformCorners( p, vEvals ) : Abc_SclEvalPerform( p, vEvals );
         if ( dGainBest < dGain )
         {
             dGainBest = dGain;
@@ -582,6 +600,300 @@ void Abc_SclObjMarkFanFans( Abc_Obj_t * pObj, Vec_Ptr_t * vNodes )
 */
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Checks or marks the objects touched by evaluating a candidate.]
+
+  Description [While trying the sizes of the pivot, Abc_SclFindBestCell() 
+  changes the gate of the pivot, the loads of its fanins, and the timing 
+  of the nodes in vRecalcs. It reads the gates, loads, and timing of the
+  nodes in vRecalcs and the timing of their fanins. Two candidates can be
+  evaluated concurrently if neither of them changes what the other one 
+  reads or changes. When fMark is 0, returns 1 if the candidate conflicts 
+  with the candidates already marked with Stamp. When fMark is 1, marks 
+  the objects of the candidate with Stamp.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_SclUpsizeParWrite( Vec_Int_t * vStampW, Vec_Int_t * vStampR, int iObj, int Stamp, int fMark )
+{
+    if ( !fMark )
+        return Vec_IntEntry(vStampW, iObj) == Stamp || Vec_IntEntry(vStampR, iObj) == Stamp;
+    Vec_IntWriteEntry( vStampW, iObj, Stamp );
+    Vec_IntWriteEntry( vStampR, iObj, Stamp );
+    return 0;
+}
+static inline int Abc_SclUpsizeParRead( Vec_Int_t * vStampW, Vec_Int_t * vStampR, int iObj, int Stamp, int fMark )
+{
+    if ( !fMark )
+        return Vec_IntEntry(vStampW, iObj) == Stamp;
+    Vec_IntWriteEntry( vStampR, iObj, Stamp );
+    return 0;
+}
+int Abc_SclUpsizeParConflict( SC_Man * p, Abc_Obj_t * pPivot, Vec_Int_t * vRecalcs, Vec_Int_t * vStampW, Vec_Int_t * vStampR, int Stamp, int fMark )
+{
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k;
+    Abc_ObjForEachFanin( pPivot, pFanin, k )
+        if ( Abc_SclUpsizeParWrite( vStampW, vStampR, Abc_ObjId(pFanin), Stamp, fMark ) )
+            return 1;
+    Abc_NtkForEachObjVec( vRecalcs, p->pNtk, pObj, i )
+    {
+        if ( Abc_SclUpsizeParWrite( vStampW, vStampR, Abc_ObjId(pObj), Stamp, fMark ) )
+            return 1;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            if ( Abc_SclUpsizeParRead( vStampW, vStampR, Abc_ObjId(pFanin), Stamp, fMark ) )
+                return 1;
+    }
+    return 0;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the upsizing gains of the critical nodes using threads.]
+
+  Description [The candidates and their cones are collected by the main 
+  thread. They are then grouped into batches of non-conflicting candidates 
+  (see Abc_SclUpsizeParConflict), which are evaluated by the threads, each 
+  working with a private copy of the manager that has its own backup 
+  storage for loads and timing. Since Abc_SclFindBestCell() restores all 
+  the values it changes, the gains do not depend on the evaluation order.
+  They are recorded in the order of candidates, so the result is the same 
+  as that of the serial evaluation. Between the batches, the workers sleep 
+  on a condition variable.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Scl_UpsParMan_t_
+{
+    pthread_mutex_t Mutex;     // protects the fields below
+    pthread_cond_t  CondStart; // signaled when a batch is ready or the threads should stop
+    pthread_cond_t  CondDone;  // signaled when the last worker has finished the batch
+    int          iRound;       // the number of batches given to the workers
+    int          nBusy;        // the number of workers evaluating the current batch
+    int          fStop;        // the workers should stop
+} Scl_UpsParMan_t;
+typedef struct Scl_UpsThData_t_
+{
+    SC_Man       Man;          // the copy of the manager with private backup storage
+    Scl_UpsParMan_t * pPar;
+    Vec_Int_t *  vCands;       // the candidate nodes
+    Vec_Wec_t *  vCones;       // the nodes to recalculate and to evaluate for each candidate
+    Vec_Int_t *  vBatch;       // the candidates of the current batch
+    Vec_Int_t *  vGates;       // the best gate of each candidate
+    Vec_Flt_t *  vGains;       // the best gain of each candidate
+    int          Notches;
+    int          DelayGap;
+    int          iThread;      // the thread number
+    int          nThreads;     // the number of threads
+    int          iRound;       // the last batch evaluated by this thread
+} Scl_UpsThData_t;
+void Abc_SclUpsizeParEvalBatch( Scl_UpsThData_t * pThData )
+{
+    SC_Man * p = &pThData->Man;
+    float dGainBest;
+    int k, iCand;
+    for ( k = pThData->iThread; k < Vec_IntSize(pThData->vBatch); k += pThData->nThreads )
+    {
+        iCand = Vec_IntEntry( pThData->vBatch, k );
+        Vec_IntWriteEntry( pThData->vGates, iCand, Abc_SclFindBestCell( p, Abc_NtkObj(p->pNtk, Vec_IntEntry(pThData->vCands, iCand)), 
+            Vec_WecEntry(pThData->vCones, 2*iCand), Vec_WecEntry(pThData->vCones, 2*iCand+1), pThData->Notches, pThData->DelayGap, &dGainBest ) );
+        Vec_FltWriteEntry( pThData->vGains, iCand, dGainBest );
+    }
+}
+void * Abc_SclUpsizeParWorkerThread( void * pArg )
+{
+    Scl_UpsThData_t * pThData = (Scl_UpsThData_t *)pArg;
+    Scl_UpsParMan_t * pPar = pThData->pPar;
+    while ( 1 )
+    {
+        // sleep until the next batch is ready
+        pthread_mutex_lock( &pPar->Mutex );
+        while ( !pPar->fStop && pPar->iRound == pThData->iRound )
+            pthread_cond_wait( &pPar->CondStart, &pPar->Mutex );
+        if ( pPar->fStop )
+        {
+            pthread_mutex_unlock( &pPar->Mutex );
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        pThData->iRound = pPar->iRound;
+        pthread_mutex_unlock( &pPar->Mutex );
+        Abc_SclUpsizeParEvalBatch( pThData );
+        // report that the batch is done
+        pthread_mutex_lock( &pPar->Mutex );
+        if ( --pPar->nBusy == 0 )
+            pthread_cond_signal( &pPar->CondDone );
+        pthread_mutex_unlock( &pPar->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+int Abc_SclFindGainsPar( SC_Man * p, Vec_Int_t * vPathNodes, int Notches, int iIter, int DelayGap, int nProcs )
+{
+    Scl_UpsParMan_t Par, * pPar = &Par;
+    Scl_UpsThData_t * ThData;
+    pthread_t WorkerThread[SCL_UPS_THR_MAX];
+    Vec_Int_t * vCands, * vBatch, * vLeft, * vNext, * vGates, * vStampW, * vStampR;
+    Vec_Flt_t * vGains;
+    Vec_Wec_t * vCones;
+    Vec_Int_t * vRecalcs, * vEvals;
+    Abc_Obj_t * pObj;
+    int nThreads = Abc_MinInt( nProcs, SCL_UPS_THR_MAX );
+    int i, k, iCand, iIterLast, status, Stamp = 0;
+    // collect the candidates and their cones
+    vCands = Vec_IntAlloc( Vec_IntSize(vPathNodes) );
+    vCones = Vec_WecAlloc( 2 * Vec_IntSize(vPathNodes) );
+    Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
+    {
+        assert( pObj->fMarkB == 0 );
+        iIterLast = Vec_IntEntry(p->vNodeIter, Abc_ObjId(pObj));
+        if ( iIterLast >= 0 && iIterLast + 5 > iIter )
+            continue;
+        Vec_WecPushLevel( vCones );
+        Vec_WecPushLevel( vCones );
+        vRecalcs = Vec_WecEntry( vCones, 2*Vec_IntSize(vCands) );
+        vEvals   = Vec_WecEntry( vCones, 2*Vec_IntSize(vCands)+1 );
+        Abc_SclFindNodesToUpdate( pObj, &vRecalcs, &vEvals, NULL );
+        assert( Vec_IntSize(vEvals) > 0 );
+        Vec_IntPush( vCands, Abc_ObjId(pObj) );
+    }
+    if ( Vec_IntSize(vCands) == 0 )
+    {
+        Vec_IntFree( vCands );
+        Vec_WecFree( vCones );
+        return 1;
+    }
+    vGates  = Vec_IntStartFull( Vec_IntSize(vCands) );
+    vGains  = Vec_FltStart( Vec_IntSize(vCands) );
+    vBatch  = Vec_IntAlloc( Vec_IntSize(vCands) );
+    vLeft   = Vec_IntStartNatural( Vec_IntSize(vCands) );
+    vNext   = Vec_IntAlloc( Vec_IntSize(vCands) );
+    vStampW = Vec_IntStart( Abc_NtkObjNumMax(p->pNtk) );
+    vStampR = Vec_IntStart( Abc_NtkObjNumMax(p->pNtk) );
+    // start the threads (thread 0 is the main thread)
+    memset( pPar, 0, sizeof(Scl_UpsParMan_t) );
+    pthread_mutex_init( &pPar->Mutex, NULL );
+    pthread_cond_init( &pPar->CondStart, NULL );
+    pthread_cond_init( &pPar->CondDone, NULL );
+    ThData = ABC_CALLOC( Scl_UpsThData_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].Man           = *p;
+        ThData[i].Man.vLoads2   = Vec_FltAlloc( 100 );
+        ThData[i].Man.vTimes2   = Vec_FltAlloc( 100 );
+        ThData[i].Man.vTimes3   = Vec_FltAlloc( 100 );
+        ThData[i].Man.nEstNodes = 0;
+        ThData[i].pPar          = pPar;
+        ThData[i].vCands        = vCands;
+        ThData[i].vCones        = vCones;
+        ThData[i].vBatch        = vBatch;
+        ThData[i].vGates        = vGates;
+        ThData[i].vGains        = vGains;
+        ThData[i].Notches       = Notches;
+        ThData[i].DelayGap      = DelayGap;
+        ThData[i].iThread       = i;
+        ThData[i].nThreads      = nThreads;
+        ThData[i].iRound        = 0;
+        if ( i == 0 )
+            continue;
+        status = pthread_create( WorkerThread + i, NULL, Abc_SclUpsizeParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    // evaluate batches of non-conflicting candidates
+    while ( Vec_IntSize(vLeft) > 0 )
+    {
+        Stamp++;
+        Vec_IntClear( vBatch );
+        Vec_IntClear( vNext );
+        Vec_IntForEachEntry( vLeft, iCand, k )
+        {
+            pObj = Abc_NtkObj( p->pNtk, Vec_IntEntry(vCands, iCand) );
+            if ( Abc_SclUpsizeParConflict( p, pObj, Vec_WecEntry(vCones, 2*iCand), vStampW, vStampR, Stamp, 0 ) )
+            {
+                Vec_IntPush( vNext, iCand );
+                continue;
+            }
+            Abc_SclUpsizeParConflict( p, pObj, Vec_WecEntry(vCones, 2*iCand), vStampW, vStampR, Stamp, 1 );
+            Vec_IntPush( vBatch, iCand );
+        }
+        assert( Vec_IntSize(vBatch) > 0 );
+        if ( Vec_IntSize(vBatch) < SCL_UPS_BATCH_MIN )
+        {
+            ThData[0].nThreads = 1;
+            Abc_SclUpsizeParEvalBatch( ThData );
+            ThData[0].nThreads = nThreads;
+        }
+        else
+        {
+            // wake up the workers, evaluate the share of the main thread, and wait for the rest
+            pthread_mutex_lock( &pPar->Mutex );
+            pPar->nBusy = nThreads - 1;
+            pPar->iRound++;
+            pthread_cond_broadcast( &pPar->CondStart );
+            pthread_mutex_unlock( &pPar->Mutex );
+            Abc_SclUpsizeParEvalBatch( ThData );
+            pthread_mutex_lock( &pPar->Mutex );
+            while ( pPar->nBusy > 0 )
+                pthread_cond_wait( &pPar->CondDone, &pPar->Mutex );
+            pthread_mutex_unlock( &pPar->Mutex );
+        }
+        ABC_SWAP( Vec_Int_t *, vLeft, vNext );
+    }
+    // stop the threads
+    pthread_mutex_lock( &pPar->Mutex );
+    pPar->fStop = 1;
+    pthread_cond_broadcast( &pPar->CondStart );
+    pthread_mutex_unlock( &pPar->Mutex );
+    for ( i = 1; i < nThreads; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    pthread_cond_destroy( &pPar->CondStart );
+    pthread_cond_destroy( &pPar->CondDone );
+    pthread_mutex_destroy( &pPar->Mutex );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        p->nEstNodes += ThData[i].Man.nEstNodes;
+        Vec_FltFree( ThData[i].Man.vLoads2 );
+        Vec_FltFree( ThData[i].Man.vTimes2 );
+        Vec_FltFree( ThData[i].Man.vTimes3 );
+    }
+    ABC_FREE( ThData );
+    // remember savings in the order of candidates
+    Vec_IntForEachEntry( vCands, iCand, i )
+    {
+        if ( Vec_IntEntry(vGates, i) < 0 )
+            continue;
+        assert( Vec_FltEntry(vGains, i) > 0.0 );
+        Vec_FltWriteEntry( p->vNode2Gain, iCand, Vec_FltEntry(vGains, i) );
+        Vec_IntWriteEntry( p->vNode2Gate, iCand, Vec_IntEntry(vGates, i) );
+        Vec_QuePush( p->vNodeByGain, iCand );
+    }
+    Vec_IntFree( vCands );
+    Vec_WecFree( vCones );
+    Vec_IntFree( vGates );
+    Vec_FltFree( vGains );
+    Vec_IntFree( vBatch );
+    Vec_IntFree( vLeft );
+    Vec_IntFree( vNext );
+    Vec_IntFree( vStampW );
+    Vec_IntFree( vStampR );
+    return 1;
+}
+
+#else // pthreads are not used
+
+int Abc_SclFindGainsPar( SC_Man * p, Vec_Int_t * vPathNodes, int Notches, int iIter, int DelayGap, int nProcs ) { return 0; }
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Computes the set of gates to upsize.]
@@ -593,7 +905,7 @@ void Abc_SclObjMarkFanFans( Abc_Obj_t * pObj, Vec_Ptr_t * vNodes )
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notches, int iIter, int DelayGap, int fMoreConserf )
+int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notches, int iIter, int DelayGap, int fMoreConserf, int nProcs )
 {
     SC_Cell * pCellOld, * pCellNew;
     Vec_Int_t * vRecalcs, * vEvals;
@@ -603,31 +915,34 @@ int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notch
     int i, gateBest, Limit, Counter, iIterLast;
 
     // compute savings due to upsizing each node
-    vRecalcs = Vec_IntAlloc( 100 );
-    vEvals = Vec_IntAlloc( 100 );
     Vec_QueClear( p->vNodeByGain );
-    Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
+    if ( nProcs < 2 || p->pFuncFanin != NULL || !Abc_SclFindGainsPar( p, vPathNodes, Notches, iIter, DelayGap, nProcs ) )
     {
-        assert( pObj->fMarkB == 0 );
-        iIterLast = Vec_IntEntry(p->vNodeIter, Abc_ObjId(pObj));
-        if ( iIterLast >= 0 && iIterLast + 5 > iIter )
-            continue;
-        // compute nodes to recalculate timing and nodes to evaluate afterwards
-        Abc_SclFindNodesToUpdate( pObj, &vRecalcs, &vEvals, NULL );
-        assert( Vec_IntSize(vEvals) > 0 );
-        //printf( "%d -> %d\n", Vec_IntSize(vRecalcs), Vec_IntSize(vEvals) );
-        gateBest = Abc_SclFindBestCell( p, pObj, vRecalcs, vEvals, Notches, DelayGap, &dGainBest );
-        // remember savings
-        if ( gateBest >= 0 )
+        vRecalcs = Vec_IntAlloc( 100 );
+        vEvals = Vec_IntAlloc( 100 );
+        Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
         {
-            assert( dGainBest > 0.0 );
-            Vec_FltWriteEntry( p->vNode2Gain, Abc_ObjId(pObj), dGainBest );
-            Vec_IntWriteEntry( p->vNode2Gate, Abc_ObjId(pObj), gateBest );
-            Vec_QuePush( p->vNodeByGain, Abc_ObjId(pObj) );
+            assert( pObj->fMarkB == 0 );
+            iIterLast = Vec_IntEntry(p->vNodeIter, Abc_ObjId(pObj));
+            if ( iIterLast >= 0 && iIterLast + 5 > iIter )
+                continue;
+            // compute nodes to recalculate timing and nodes to evaluate afterwards
+            Abc_SclFindNodesToUpdate( pObj, &vRecalcs, &vEvals, NULL );
+            assert( Vec_IntSize(vEvals) > 0 );
+            //printf( "%d -> %d\n", Vec_IntSize(vRecalcs), Vec_IntSize(vEvals) );
+            gateBest = Abc_SclFindBestCell( p, pObj, vRecalcs, vEvals, Notches, DelayGap, &dGainBest );
+            // remember savings
+            if ( gateBest >= 0 )
+            {
+                assert( dGainBest > 0.0 );
+                Vec_FltWriteEntry( p->vNode2Gain, Abc_ObjId(pObj), dGainBest );
+                Vec_IntWriteEntry( p->vNode2Gate, Abc_ObjId(pObj), gateBest );
+                Vec_QuePush( p->vNodeByGain, Abc_ObjId(pObj) );
+            }
         }
+        Vec_IntFree( vRecalcs );
+        Vec_IntFree( vEvals );
     }
-    Vec_IntFree( vRecalcs );
-    Vec_IntFree( vEvals );
     if ( Vec_QueSize(p->vNodeByGain) == 0 )
         return 0;
 /*
@@ -895,6 +1210,9 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     p->timeTotal  = Abc_Clock();
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
+    // with additional corners, the worst delay across the corners is reduced
+    if ( p->nCorners )
+        p->MaxDelay0 = p->MaxDelay = p->MaxDelayC;
     p->BestDelay  = p->MaxDelay0;
     // perform upsizing
     nAllPos = nAllNodes = nAllTfos = nAllUpsizes = 0;
@@ -916,7 +1234,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
             if ( pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0 )
                 nUpsizes = Abc_SclFindBypasses( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, pPars->fVeryVerbose );
             else
-                nUpsizes = Abc_SclFindUpsizes( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, (pPars->BypassFreq > 0) );
+                nUpsizes = Abc_SclFindUpsizes( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, (pPars->BypassFreq > 0), pPars->nProcs );
             p->timeSize += Abc_Clock() - clk;
 
             // unmark critical path
@@ -952,7 +1270,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
 //        Abc_SclUpsizePrintDiffs( p, pLib, pNtk );
 
         // save the best network
-        p->MaxDelay = Abc_SclReadMaxDelay( p );
+        p->MaxDelay = p->nCorners ? Abc_SclTimeCorners( p ) : Abc_SclReadMaxDelay( p );
         if ( p->BestDelay > p->MaxDelay )
         {
             p->BestDelay = p->MaxDelay;
@@ -988,6 +1306,8 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     if ( pPars->BypassFreq != 0 )
         Abc_SclUpsizeRemoveDangling( p, pNtk );
     Abc_SclTimeNtkRecompute( p, &p->SumArea, &p->MaxDelay, 0, 0 );
+    if ( p->nCorners )
+        p->MaxDelay = Abc_SclTimeCorners( p );
     if ( pPars->fVerbose )
         Abc_SclUpsizePrint( p, i, pPars->Window, nAllPos/(i?i:1), nAllNodes/(i?i:1), nAllUpsizes/(i?i:1), nAllTfos/(i?i:1), 1 );
     else
@@ -1010,7 +1330,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
 
     // save the result and quit
     Abc_SclSclGates2MioGates( pLib, pNtk ); // updates gate pointers
-    Abc_SclManFree( p );
+    Abc_SclManStore( p, 0 );
 //    Abc_NtkCleanMarkAB( pNtk );
 }
 
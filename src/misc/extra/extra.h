@@ -156,6 +156,8 @@ extern void        Extra_MmFixedEntryRecycle( Extra_MmFixed_t * p, char * pEntry
 extern void        Extra_MmFixedRestart( Extra_MmFixed_t * p );
 extern int         Extra_MmFixedReadMemUsage( Extra_MmFixed_t * p );
 extern int         Extra_MmFixedReadMaxEntriesUsed( Extra_MmFixed_t * p );
+extern int         Extra_MmFixedReadEntrySize( Extra_MmFixed_t * p );
+extern int         Extra_MmFixedReadEntriesUsed( Extra_MmFixed_t * p );
 // flexible-size-block memory manager
 extern Extra_MmFlex_t * Extra_MmFlexStart();
 extern void        Extra_MmFlexStop( Extra_MmFlex_t * p );
@@ -196,6 +198,8 @@ extern unsigned    Extra_TruthCanonNP( unsigned uTruth, int nVars );
 extern unsigned    Extra_TruthCanonNPN( unsigned uTruth, int nVars );
 /* canonical forms of 4-variable functions */
 extern void        Extra_Truth4VarNPN( unsigned short ** puCanons, char ** puPhases, char ** puPerms, unsigned char ** puMap );
+extern void        Extra_Truth4VarNPNCompute( unsigned short ** puCanons, char ** puPhases, char ** puPerms, unsigned char ** puMap );
+extern void        Extra_Truth4VarNPNWrite( char * pFileName );
 extern void        Extra_Truth4VarN( unsigned short ** puCanons, char *** puPhases, char ** ppCounters, int nPhasesMax );
 /* permutation mapping */
 extern unsigned short Extra_TruthPerm4One( unsigned uTruth, int Phase );
@@ -329,6 +329,38 @@ int Extra_MmFixedReadMaxEntriesUsed( Extra_MmFixed_t * p )
     return p->nEntriesMax;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Extra_MmFixedReadEntrySize( Extra_MmFixed_t * p )
+{
+    return p->nEntrySize;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Extra_MmFixedReadEntriesUsed( Extra_MmFixed_t * p )
+{
+    return p->nEntriesUsed;
+}
+
 
 /**Function*************************************************************
 
@@ -629,6 +629,85 @@ unsigned Extra_TruthCanonNPN( unsigned uTruth, int nVars )
     return uTruthMin;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns NPN canonical forms for 4-variable functions.]
+
+  Description [The tables are precomputed by Extra_Truth4VarNPNCompute()
+  and saved in the source code by Extra_Truth4VarNPNWrite().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Extra_Truth4VarNPN( unsigned short ** puCanons, char ** puPhases, char ** puPerms, unsigned char ** puMap )
+{
+    Abc_Truth4VarNPN( puCanons, puPhases, puPerms, puMap );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes NPN canonical forms for 4-variable functions.]
+
+  Description [Writes the tables in the format of "misc/util/utilNpn.c".]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Extra_Truth4VarNPNWriteOne( FILE * pFile, char * pName, char * pType, int * pEntries, int nEntries, int nPerLine, int fHex )
+{
+    int i;
+    fprintf( pFile, "static const %s %s[%d] = {", pType, pName, nEntries );
+    for ( i = 0; i < nEntries; i++ )
+    {
+        if ( i % nPerLine == 0 )
+            fprintf( pFile, "\n   " );
+        fprintf( pFile, fHex ? " 0x%04X" : " %d", pEntries[i] );
+        if ( i < nEntries-1 )
+            fprintf( pFile, "," );
+    }
+    fprintf( pFile, "\n};\n\n" );
+}
+void Extra_Truth4VarNPNWrite( char * pFileName )
+{
+    unsigned short * uCanons;
+    unsigned char * uMap;
+    char * uPhases, * uPerms;
+    int * pEntries = ABC_ALLOC( int, (1 << 16) );
+    int i, nClasses = 0;
+    FILE * pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pFileName );
+        ABC_FREE( pEntries );
+        return;
+    }
+    Extra_Truth4VarNPNCompute( &uCanons, &uPhases, &uPerms, &uMap );
+    for ( i = 0; i < (1 << 16); i++ )
+        if ( uMap[i] == nClasses && uCanons[i] == i )
+            pEntries[nClasses++] = i;
+    assert( nClasses == 222 );
+    Extra_Truth4VarNPNWriteOne( pFile, "s_Npn4Classes", "unsigned short", pEntries, nClasses, 12, 1 );
+    for ( i = 0; i < (1 << 16); i++ )
+        pEntries[i] = uMap[i];
+    Extra_Truth4VarNPNWriteOne( pFile, "s_Npn4Map", "unsigned char", pEntries, (1 << 16), 32, 0 );
+    for ( i = 0; i < (1 << 16); i++ )
+        pEntries[i] = uPhases[i];
+    Extra_Truth4VarNPNWriteOne( pFile, "s_Npn4Phases", "char", pEntries, (1 << 16), 32, 0 );
+    for ( i = 0; i < (1 << 16); i++ )
+        pEntries[i] = uPerms[i];
+    Extra_Truth4VarNPNWriteOne( pFile, "s_Npn4Perms", "char", pEntries, (1 << 16), 32, 0 );
+    fclose( pFile );
+    ABC_FREE( pEntries );
+    ABC_FREE( uCanons );
+    ABC_FREE( uPhases );
+    ABC_FREE( uPerms );
+    ABC_FREE( uMap );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes NPN canonical forms for 4-variable functions.]
@@ -640,7 +719,7 @@ unsigned Extra_TruthCanonNPN( unsigned uTruth, int nVars )
   SeeAlso     []
 
 ***********************************************************************/
-void Extra_Truth4VarNPN( unsigned short ** puCanons, char ** puPhases, char ** puPerms, unsigned char ** puMap )
+void Extra_Truth4VarNPNCompute( unsigned short ** puCanons, char ** puPhases, char ** puPerms, unsigned char ** puMap )
 {
     unsigned short * uCanons;
     unsigned char * uMap;
@@ -555,6 +555,9 @@ extern word     Abc_RandomW( int fReset );
 // pthreads
 extern void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose );
 
+// precomputed NPN classes of 4-input functions
+extern void Abc_Truth4VarNPN( unsigned short ** puCanons, char ** puPhases, char ** puPerms, unsigned char ** puMap );
+
 ABC_NAMESPACE_HEADER_END
 
 #endif
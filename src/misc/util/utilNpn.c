@@ -0,0 +1,6271 @@
+/**CFile****************************************************************
+
+  FileName    [utilNpn.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Precomputed NPN classes of 4-input functions.]
+
+  Synopsis    [Precomputed NPN classes of 4-input functions.]
+
+  Author      [agent]
+  
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: utilNpn.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "abc_global.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The tables below are generated by Extra_Truth4VarNPNWrite(), which saves
+// the results of Extra_Truth4VarNPNCompute(). They are constant and stay in
+// the read-only data of the binary, shared by all threads and processes,
+// which avoids enumerating 768 NPN transforms of each class on start-up.
+//
+// s_Npn4Classes - the canonical forms (representatives) of the 222 classes
+// s_Npn4Map     - the class of each function (the complements of the class
+//                 representatives are not mapped and have class 0)
+// s_Npn4Phases  - the phase transforming the canonical form into the function
+// s_Npn4Perms   - the permutation transforming the canonical form into the function
+
+static const unsigned short s_Npn4Classes[222] = {
+    0x0000, 0x0001, 0x0003, 0x0006, 0x0007, 0x000F, 0x0016, 0x0017, 0x0018, 0x0019, 0x001B, 0x001E,
+    0x001F, 0x003C, 0x003D, 0x003F, 0x0069, 0x006B, 0x006F, 0x007E, 0x007F, 0x00FF, 0x0116, 0x0117,
+    0x0118, 0x0119, 0x011A, 0x011B, 0x011E, 0x011F, 0x012C, 0x012D, 0x012F, 0x013C, 0x013D, 0x013E,
+    0x013F, 0x0168, 0x0169, 0x016A, 0x016B, 0x016E, 0x016F, 0x017E, 0x017F, 0x0180, 0x0181, 0x0182,
+    0x0183, 0x0186, 0x0187, 0x0189, 0x018B, 0x018F, 0x0196, 0x0197, 0x0198, 0x0199, 0x019A, 0x019B,
+    0x019E, 0x019F, 0x01A8, 0x01A9, 0x01AA, 0x01AB, 0x01AC, 0x01AD, 0x01AE, 0x01AF, 0x01BC, 0x01BD,
+    0x01BE, 0x01BF, 0x01E8, 0x01E9, 0x01EA, 0x01EB, 0x01EE, 0x01EF, 0x01FE, 0x033C, 0x033D, 0x033F,
+    0x0356, 0x0357, 0x0358, 0x0359, 0x035A, 0x035B, 0x035E, 0x035F, 0x0368, 0x0369, 0x036A, 0x036B,
+    0x036C, 0x036D, 0x036E, 0x036F, 0x037C, 0x037D, 0x037E, 0x03C0, 0x03C1, 0x03C3, 0x03C5, 0x03C6,
+    0x03C7, 0x03CF, 0x03D4, 0x03D5, 0x03D6, 0x03D7, 0x03D8, 0x03D9, 0x03DB, 0x03DC, 0x03DD, 0x03DE,
+    0x03FC, 0x0660, 0x0661, 0x0662, 0x0663, 0x0666, 0x0667, 0x0669, 0x066B, 0x066F, 0x0672, 0x0673,
+    0x0676, 0x0678, 0x0679, 0x067A, 0x067B, 0x067E, 0x0690, 0x0691, 0x0693, 0x0696, 0x0697, 0x069F,
+    0x06B0, 0x06B1, 0x06B2, 0x06B3, 0x06B4, 0x06B5, 0x06B6, 0x06B7, 0x06B9, 0x06BD, 0x06F0, 0x06F1,
+    0x06F2, 0x06F6, 0x06F9, 0x0776, 0x0778, 0x0779, 0x077A, 0x077E, 0x07B0, 0x07B1, 0x07B4, 0x07B5,
+    0x07B6, 0x07BC, 0x07E0, 0x07E1, 0x07E2, 0x07E3, 0x07E6, 0x07E9, 0x07F0, 0x07F1, 0x07F2, 0x07F8,
+    0x0FF0, 0x1668, 0x1669, 0x166A, 0x166B, 0x166E, 0x167E, 0x1681, 0x1683, 0x1686, 0x1687, 0x1689,
+    0x168B, 0x168E, 0x1696, 0x1697, 0x1698, 0x1699, 0x169A, 0x169B, 0x169E, 0x16A9, 0x16AC, 0x16AD,
+    0x16BC, 0x16E9, 0x177E, 0x178E, 0x1796, 0x1798, 0x179A, 0x17AC, 0x17E8, 0x18E7, 0x19E1, 0x19E3,
+    0x19E6, 0x1BD8, 0x1BE4, 0x1EE1, 0x3CC3, 0x6996
+};
+
+static const unsigned char s_Npn4Map[65536] = {
+    0, 1, 1, 2, 1, 2, 3, 4, 1, 3, 2, 4, 2, 4, 4, 5, 1, 2, 3, 4, 3, 4, 6, 7, 8, 9, 9, 10, 9, 10, 11, 12,
+    1, 3, 2, 4, 8, 9, 9, 10, 3, 6, 4, 7, 9, 11, 10, 12, 2, 4, 4, 5, 9, 10, 11, 12, 9, 11, 10, 12, 13, 14, 14, 15,
+    1, 3, 8, 9, 2, 4, 9, 10, 3, 6, 9, 11, 4, 7, 10, 12, 2, 4, 9, 10, 4, 5, 11, 12, 9, 11, 13, 14, 10, 12, 14, 15,
+    3, 6, 9, 11, 9, 11, 13, 14, 6, 16, 11, 17, 11, 17, 14, 18, 4, 7, 10, 12, 10, 12, 14, 15, 11, 17, 14, 18, 14, 18, 19, 20,
+    1, 8, 3, 9, 3, 9, 6, 11, 2, 9, 4, 10, 4, 10, 7, 12, 3, 9, 6, 11, 6, 11, 16, 17, 9, 13, 11, 14, 11, 14, 17, 18,
+    2, 9, 4, 10, 9, 13, 11, 14, 4, 11, 5, 12, 10, 14, 12, 15, 4, 10, 7, 12, 11, 14, 17, 18, 10, 14, 12, 15, 14, 19, 18, 20,
+    2, 9, 9, 13, 4, 10, 11, 14, 4, 11, 10, 14, 5, 12, 12, 15, 4, 10, 11, 14, 7, 12, 17, 18, 10, 14, 14, 19, 12, 15, 18, 20,
+    4, 11, 10, 14, 10, 14, 14, 19, 7, 17, 12, 18, 12, 18, 15, 20, 5, 12, 12, 15, 12, 15, 18, 20, 12, 18, 15, 20, 15, 20, 20, 21,
+    1, 2, 3, 4, 3, 4, 6, 7, 8, 9, 9, 10, 9, 10, 11, 12, 3, 4, 6, 7, 6, 7, 22, 23, 24, 25, 26, 27, 26, 27, 28, 29,
+    8, 9, 9, 10, 24, 25, 26, 27, 24, 26, 25, 27, 30, 31, 31, 32, 9, 10, 11, 12, 26, 27, 28, 29, 30, 31, 31, 32, 33, 34, 35, 36,
+    8, 9, 24, 25, 9, 10, 26, 27, 24, 26, 30, 31, 25, 27, 31, 32, 9, 10, 26, 27, 11, 12, 28, 29, 30, 31, 33, 34, 31, 32, 35, 36,
+    24, 26, 30, 31, 30, 31, 33, 34, 37, 38, 39, 40, 39, 40, 41, 42, 25, 27, 31, 32, 31, 32, 35, 36, 39, 40, 41, 42, 41, 42, 43, 44,
+    45, 46, 47, 48, 47, 48, 49, 50, 46, 51, 48, 52, 48, 52, 50, 53, 47, 48, 49, 50, 49, 50, 54, 55, 56, 57, 58, 59, 58, 59, 60, 61,
+    46, 51, 48, 52, 56, 57, 58, 59, 62, 63, 64, 65, 66, 67, 68, 69, 48, 52, 50, 53, 58, 59, 60, 61, 66, 67, 68, 69, 70, 71, 72, 73,
+    46, 51, 56, 57, 48, 52, 58, 59, 62, 63, 66, 67, 64, 65, 68, 69, 48, 52, 58, 59, 50, 53, 60, 61, 66, 67, 70, 71, 68, 69, 72, 73,
+    62, 63, 66, 67, 66, 67, 70, 71, 74, 75, 76, 77, 76, 77, 78, 79, 64, 65, 68, 69, 68, 69, 72, 73, 76, 77, 78, 79, 78, 79, 80, 20,
+    1, 3, 2, 4, 8, 9, 9, 10, 3, 6, 4, 7, 9, 11, 10, 12, 8, 9, 9, 10, 24, 25, 26, 27, 24, 26, 25, 27, 30, 31, 31, 32,
+    3, 6, 4, 7, 24, 26, 25, 27, 6, 22, 7, 23, 26, 28, 27, 29, 9, 11, 10, 12, 30, 31, 31, 32, 26, 28, 27, 29, 33, 35, 34, 36,
+    45, 47, 46, 48, 46, 48, 51, 52, 47, 49, 48, 50, 48, 50, 52, 53, 46, 48, 51, 52, 62, 64, 63, 65, 56, 58, 57, 59, 66, 68, 67, 69,
+    47, 49, 48, 50, 56, 58, 57, 59, 49, 54, 50, 55, 58, 60, 59, 61, 48, 50, 52, 53, 66, 68, 67, 69, 58, 60, 59, 61, 70, 72, 71, 73,
+    8, 24, 9, 25, 24, 30, 26, 31, 9, 26, 10, 27, 25, 31, 27, 32, 24, 30, 26, 31, 37, 39, 38, 40, 30, 33, 31, 34, 39, 41, 40, 42,
+    9, 26, 10, 27, 30, 33, 31, 34, 11, 28, 12, 29, 31, 35, 32, 36, 25, 31, 27, 32, 39, 41, 40, 42, 31, 35, 32, 36, 41, 43, 42, 44,
+    46, 56, 51, 57, 62, 66, 63, 67, 48, 58, 52, 59, 64, 68, 65, 69, 62, 66, 63, 67, 74, 76, 75, 77, 66, 70, 67, 71, 76, 78, 77, 79,
+    48, 58, 52, 59, 66, 70, 67, 71, 50, 60, 53, 61, 68, 72, 69, 73, 64, 68, 65, 69, 76, 78, 77, 79, 68, 72, 69, 73, 78, 80, 79, 20,
+    2, 4, 4, 5, 9, 10, 11, 12, 9, 11, 10, 12, 13, 14, 14, 15, 9, 10, 11, 12, 26, 27, 28, 29, 30, 31, 31, 32, 33, 34, 35, 36,
+    9, 11, 10, 12, 30, 31, 31, 32, 26, 28, 27, 29, 33, 35, 34, 36, 13, 14, 14, 15, 33, 34, 35, 36, 33, 35, 34, 36, 81, 82, 82, 83,
+    46, 48, 62, 64, 51, 52, 63, 65, 56, 58, 66, 68, 57, 59, 67, 69, 51, 52, 63, 65, 63, 65, 84, 85, 86, 87, 88, 89, 88, 89, 90, 91,
+    56, 58, 66, 68, 86, 87, 88, 89, 92, 93, 94, 95, 96, 97, 98, 99, 57, 59, 67, 69, 88, 89, 90, 91, 96, 97, 98, 99, 100, 101, 102, 36,
+    46, 62, 48, 64, 56, 66, 58, 68, 51, 63, 52, 65, 57, 67, 59, 69, 56, 66, 58, 68, 92, 94, 93, 95, 86, 88, 87, 89, 96, 98, 97, 99,
+    51, 63, 52, 65, 86, 88, 87, 89, 63, 84, 65, 85, 88, 90, 89, 91, 57, 67, 59, 69, 96, 98, 97, 99, 88, 90, 89, 91, 100, 102, 101, 36,
+    103, 104, 104, 105, 104, 106, 107, 108, 104, 107, 106, 108, 105, 108, 108, 109, 104, 106, 107, 108, 110, 111, 112, 113, 114, 115, 115, 116, 117, 118, 119, 69,
+    104, 107, 106, 108, 114, 115, 115, 116, 110, 112, 111, 113, 117, 119, 118, 69, 105, 108, 108, 109, 117, 118, 119, 69, 117, 119, 118, 69, 120, 78, 78, 15,
+    1, 3, 8, 9, 2, 4, 9, 10, 3, 6, 9, 11, 4, 7, 10, 12, 8, 9, 24, 25, 9, 10, 26, 27, 24, 26, 30, 31, 25, 27, 31, 32,
+    45, 47, 46, 48, 46, 48, 51, 52, 47, 49, 48, 50, 48, 50, 52, 53, 46, 48, 62, 64, 51, 52, 63, 65, 56, 58, 66, 68, 57, 59, 67, 69,
+    3, 6, 24, 26, 4, 7, 25, 27, 6, 22, 26, 28, 7, 23, 27, 29, 9, 11, 30, 31, 10, 12, 31, 32, 26, 28, 33, 35, 27, 29, 34, 36,
+    47, 49, 56, 58, 48, 50, 57, 59, 49, 54, 58, 60, 50, 55, 59, 61, 48, 50, 66, 68, 52, 53, 67, 69, 58, 60, 70, 72, 59, 61, 71, 73,
+    8, 24, 24, 30, 9, 25, 26, 31, 9, 26, 25, 31, 10, 27, 27, 32, 24, 30, 37, 39, 26, 31, 38, 40, 30, 33, 39, 41, 31, 34, 40, 42,
+    46, 56, 62, 66, 51, 57, 63, 67, 48, 58, 64, 68, 52, 59, 65, 69, 62, 66, 74, 76, 63, 67, 75, 77, 66, 70, 76, 78, 67, 71, 77, 79,
+    9, 26, 30, 33, 10, 27, 31, 34, 11, 28, 31, 35, 12, 29, 32, 36, 25, 31, 39, 41, 27, 32, 40, 42, 31, 35, 41, 43, 32, 36, 42, 44,
+    48, 58, 66, 70, 52, 59, 67, 71, 50, 60, 68, 72, 53, 61, 69, 73, 64, 68, 76, 78, 65, 69, 77, 79, 68, 72, 78, 80, 69, 73, 79, 20,
+    2, 4, 9, 10, 4, 5, 11, 12, 9, 11, 13, 14, 10, 12, 14, 15, 9, 10, 26, 27, 11, 12, 28, 29, 30, 31, 33, 34, 31, 32, 35, 36,
+    46, 48, 51, 52, 62, 64, 63, 65, 56, 58, 57, 59, 66, 68, 67, 69, 51, 52, 63, 65, 63, 65, 84, 85, 86, 87, 88, 89, 88, 89, 90, 91,
+    9, 11, 30, 31, 10, 12, 31, 32, 26, 28, 33, 35, 27, 29, 34, 36, 13, 14, 33, 34, 14, 15, 35, 36, 33, 35, 81, 82, 34, 36, 82, 83,
+    56, 58, 86, 87, 66, 68, 88, 89, 92, 93, 96, 97, 94, 95, 98, 99, 57, 59, 88, 89, 67, 69, 90, 91, 96, 97, 100, 101, 98, 99, 102, 36,
+    46, 62, 56, 66, 48, 64, 58, 68, 51, 63, 57, 67, 52, 65, 59, 69, 56, 66, 92, 94, 58, 68, 93, 95, 86, 88, 96, 98, 87, 89, 97, 99,
+    103, 104, 104, 106, 104, 105, 107, 108, 104, 107, 105, 108, 106, 108, 108, 109, 104, 106, 110, 111, 107, 108, 112, 113, 114, 115, 117, 118, 115, 116, 119, 69,
+    51, 63, 86, 88, 52, 65, 87, 89, 63, 84, 88, 90, 65, 85, 89, 91, 57, 67, 96, 98, 59, 69, 97, 99, 88, 90, 100, 102, 89, 91, 101, 36,
+    104, 107, 114, 115, 106, 108, 115, 116, 110, 112, 117, 119, 111, 113, 118, 69, 105, 108, 117, 118, 108, 109, 119, 69, 117, 119, 120, 78, 118, 69, 78, 15,
+    3, 6, 9, 11, 9, 11, 13, 14, 6, 16, 11, 17, 11, 17, 14, 18, 24, 26, 30, 31, 30, 31, 33, 34, 37, 38, 39, 40, 39, 40, 41, 42,
+    47, 49, 48, 50, 56, 58, 57, 59, 49, 54, 50, 55, 58, 60, 59, 61, 56, 58, 66, 68, 86, 87, 88, 89, 92, 93, 94, 95, 96, 97, 98, 99,
+    47, 49, 56, 58, 48, 50, 57, 59, 49, 54, 58, 60, 50, 55, 59, 61, 56, 58, 86, 87, 66, 68, 88, 89, 92, 93, 96, 97, 94, 95, 98, 99,
+    121, 122, 123, 124, 123, 124, 125, 126, 122, 127, 124, 128, 124, 128, 126, 129, 123, 124, 130, 131, 130, 131, 132, 113, 133, 134, 135, 136, 135, 136, 137, 61,
+    24, 37, 30, 39, 30, 39, 33, 41, 26, 38, 31, 40, 31, 40, 34, 42, 138, 139, 139, 140, 139, 140, 141, 142, 139, 141, 140, 142, 140, 142, 142, 143,
+    56, 92, 66, 94, 86, 96, 88, 98, 58, 93, 68, 95, 87, 97, 89, 99, 144, 145, 146, 147, 148, 149, 150, 151, 145, 152, 147, 101, 149, 153, 151, 42,
+    56, 92, 86, 96, 66, 94, 88, 98, 58, 93, 87, 97, 68, 95, 89, 99, 144, 145, 148, 149, 146, 147, 150, 151, 145, 152, 149, 153, 147, 101, 151, 42,
+    123, 133, 130, 135, 130, 135, 132, 137, 124, 134, 131, 136, 131, 136, 113, 61, 154, 155, 156, 119, 156, 119, 157, 77, 155, 158, 119, 72, 119, 72, 77, 18,
+    4, 7, 10, 12, 10, 12, 14, 15, 11, 17, 14, 18, 14, 18, 19, 20, 25, 27, 31, 32, 31, 32, 35, 36, 39, 40, 41, 42, 41, 42, 43, 44,
+    48, 50, 52, 53, 66, 68, 67, 69, 58, 60, 59, 61, 70, 72, 71, 73, 57, 59, 67, 69, 88, 89, 90, 91, 96, 97, 98, 99, 100, 101, 102, 36,
+    48, 50, 66, 68, 52, 53, 67, 69, 58, 60, 70, 72, 59, 61, 71, 73, 57, 59, 88, 89, 67, 69, 90, 91, 96, 97, 100, 101, 98, 99, 102, 36,
+    123, 124, 130, 131, 130, 131, 132, 113, 133, 134, 135, 136, 135, 136, 137, 61, 125, 126, 132, 113, 132, 113, 159, 85, 160, 161, 162, 95, 162, 95, 163, 29,
+    62, 74, 66, 76, 66, 76, 70, 78, 63, 75, 67, 77, 67, 77, 71, 79, 144, 146, 145, 147, 145, 147, 152, 101, 148, 150, 149, 151, 149, 151, 153, 42,
+    104, 110, 106, 111, 114, 117, 115, 118, 107, 112, 108, 113, 115, 119, 116, 69, 164, 165, 165, 116, 166, 167, 168, 89, 166, 168, 167, 89, 169, 147, 147, 32,
+    104, 110, 114, 117, 106, 111, 115, 118, 107, 112, 115, 119, 108, 113, 116, 69, 164, 165, 166, 167, 165, 116, 168, 89, 166, 168, 169, 147, 167, 89, 147, 32,
+    170, 171, 172, 173, 172, 173, 174, 111, 171, 175, 173, 131, 173, 131, 111, 53, 176, 177, 178, 108, 178, 108, 156, 65, 179, 155, 117, 68, 117, 68, 76, 12,
+    1, 8, 3, 9, 3, 9, 6, 11, 2, 9, 4, 10, 4, 10, 7, 12, 45, 46, 47, 48, 47, 48, 49, 50, 46, 51, 48, 52, 48, 52, 50, 53,
+    8, 24, 9, 25, 24, 30, 26, 31, 9, 26, 10, 27, 25, 31, 27, 32, 46, 62, 48, 64, 56, 66, 58, 68, 51, 63, 52, 65, 57, 67, 59, 69,
+    8, 24, 24, 30, 9, 25, 26, 31, 9, 26, 25, 31, 10, 27, 27, 32, 46, 62, 56, 66, 48, 64, 58, 68, 51, 63, 57, 67, 52, 65, 59, 69,
+    24, 37, 30, 39, 30, 39, 33, 41, 26, 38, 31, 40, 31, 40, 34, 42, 62, 74, 66, 76, 66, 76, 70, 78, 63, 75, 67, 77, 67, 77, 71, 79,
+    3, 24, 6, 26, 6, 26, 22, 28, 4, 25, 7, 27, 7, 27, 23, 29, 47, 56, 49, 58, 49, 58, 54, 60, 48, 57, 50, 59, 50, 59, 55, 61,
+    9, 30, 11, 31, 26, 33, 28, 35, 10, 31, 12, 32, 27, 34, 29, 36, 48, 66, 50, 68, 58, 70, 60, 72, 52, 67, 53, 69, 59, 71, 61, 73,
+    9, 30, 26, 33, 11, 31, 28, 35, 10, 31, 27, 34, 12, 32, 29, 36, 48, 66, 58, 70, 50, 68, 60, 72, 52, 67, 59, 71, 53, 69, 61, 73,
+    25, 39, 31, 41, 31, 41, 35, 43, 27, 40, 32, 42, 32, 42, 36, 44, 64, 76, 68, 78, 68, 78, 72, 80, 65, 77, 69, 79, 69, 79, 73, 20,
+    3, 9, 6, 11, 6, 11, 16, 17, 9, 13, 11, 14, 11, 14, 17, 18, 47, 48, 49, 50, 49, 50, 54, 55, 56, 57, 58, 59, 58, 59, 60, 61,
+    24, 30, 26, 31, 37, 39, 38, 40, 30, 33, 31, 34, 39, 41, 40, 42, 56, 66, 58, 68, 92, 94, 93, 95, 86, 88, 87, 89, 96, 98, 97, 99,
+    24, 30, 37, 39, 26, 31, 38, 40, 30, 33, 39, 41, 31, 34, 40, 42, 56, 66, 92, 94, 58, 68, 93, 95, 86, 88, 96, 98, 87, 89, 97, 99,
+    138, 139, 139, 140, 139, 140, 141, 142, 139, 141, 140, 142, 140, 142, 142, 143, 144, 146, 145, 147, 145, 147, 152, 101, 148, 150, 149, 151, 149, 151, 153, 42,
+    47, 56, 49, 58, 49, 58, 54, 60, 48, 57, 50, 59, 50, 59, 55, 61, 121, 123, 122, 124, 122, 124, 127, 128, 123, 125, 124, 126, 124, 126, 128, 129,
+    56, 86, 58, 87, 92, 96, 93, 97, 66, 88, 68, 89, 94, 98, 95, 99, 123, 130, 124, 131, 133, 135, 134, 136, 130, 132, 131, 113, 135, 137, 136, 61,
+    56, 86, 92, 96, 58, 87, 93, 97, 66, 88, 94, 98, 68, 89, 95, 99, 123, 130, 133, 135, 124, 131, 134, 136, 130, 132, 135, 137, 131, 113, 136, 61,
+    144, 148, 145, 149, 145, 149, 152, 153, 146, 150, 147, 151, 147, 151, 101, 42, 154, 156, 155, 119, 155, 119, 158, 72, 156, 157, 119, 77, 119, 77, 72, 18,
+    2, 9, 4, 10, 9, 13, 11, 14, 4, 11, 5, 12, 10, 14, 12, 15, 46, 51, 48, 52, 56, 57, 58, 59, 62, 63, 64, 65, 66, 67, 68, 69,
+    9, 26, 10, 27, 30, 33, 31, 34, 11, 28, 12, 29, 31, 35, 32, 36, 51, 63, 52, 65, 86, 88, 87, 89, 63, 84, 65, 85, 88, 90, 89, 91,
+    46, 56, 62, 66, 51, 57, 63, 67, 48, 58, 64, 68, 52, 59, 65, 69, 103, 104, 104, 106, 104, 105, 107, 108, 104, 107, 105, 108, 106, 108, 108, 109,
+    56, 92, 66, 94, 86, 96, 88, 98, 58, 93, 68, 95, 87, 97, 89, 99, 104, 110, 106, 111, 114, 117, 115, 118, 107, 112, 108, 113, 115, 119, 116, 69,
+    9, 30, 11, 31, 26, 33, 28, 35, 10, 31, 12, 32, 27, 34, 29, 36, 56, 86, 58, 87, 92, 96, 93, 97, 66, 88, 68, 89, 94, 98, 95, 99,
+    13, 33, 14, 34, 33, 81, 35, 82, 14, 35, 15, 36, 34, 82, 36, 83, 57, 88, 59, 89, 96, 100, 97, 101, 67, 90, 69, 91, 98, 102, 99, 36,
+    51, 86, 63, 88, 63, 88, 84, 90, 52, 87, 65, 89, 65, 89, 85, 91, 104, 114, 107, 115, 110, 117, 112, 119, 106, 115, 108, 116, 111, 118, 113, 69,
+    57, 96, 67, 98, 88, 100, 90, 102, 59, 97, 69, 99, 89, 101, 91, 36, 105, 117, 108, 118, 117, 120, 119, 78, 108, 119, 109, 69, 118, 78, 69, 15,
+    4, 10, 7, 12, 11, 14, 17, 18, 10, 14, 12, 15, 14, 19, 18, 20, 48, 52, 50, 53, 58, 59, 60, 61, 66, 67, 68, 69, 70, 71, 72, 73,
+    25, 31, 27, 32, 39, 41, 40, 42, 31, 35, 32, 36, 41, 43, 42, 44, 57, 67, 59, 69, 96, 98, 97, 99, 88, 90, 89, 91, 100, 102, 101, 36,
+    62, 66, 74, 76, 63, 67, 75, 77, 66, 70, 76, 78, 67, 71, 77, 79, 104, 106, 110, 111, 107, 108, 112, 113, 114, 115, 117, 118, 115, 116, 119, 69,
+    144, 145, 146, 147, 148, 149, 150, 151, 145, 152, 147, 101, 149, 153, 151, 42, 164, 165, 165, 116, 166, 167, 168, 89, 166, 168, 167, 89, 169, 147, 147, 32,
+    48, 66, 50, 68, 58, 70, 60, 72, 52, 67, 53, 69, 59, 71, 61, 73, 123, 130, 124, 131, 133, 135, 134, 136, 130, 132, 131, 113, 135, 137, 136, 61,
+    57, 88, 59, 89, 96, 100, 97, 101, 67, 90, 69, 91, 98, 102, 99, 36, 125, 132, 126, 113, 160, 162, 161, 95, 132, 159, 113, 85, 162, 163, 95, 29,
+    104, 114, 110, 117, 107, 115, 112, 119, 106, 115, 111, 118, 108, 116, 113, 69, 170, 172, 171, 173, 171, 173, 175, 131, 172, 174, 173, 111, 173, 111, 131, 53,
+    164, 166, 165, 167, 166, 169, 168, 147, 165, 168, 116, 89, 167, 147, 89, 32, 176, 178, 177, 108, 179, 117, 155, 68, 178, 156, 108, 65, 117, 76, 68, 12,
+    2, 9, 9, 13, 4, 10, 11, 14, 4, 11, 10, 14, 5, 12, 12, 15, 46, 51, 56, 57, 48, 52, 58, 59, 62, 63, 66, 67, 64, 65, 68, 69,
+    46, 56, 51, 57, 62, 66, 63, 67, 48, 58, 52, 59, 64, 68, 65, 69, 103, 104, 104, 105, 104, 106, 107, 108, 104, 107, 106, 108, 105, 108, 108, 109,
+    9, 26, 30, 33, 10, 27, 31, 34, 11, 28, 31, 35, 12, 29, 32, 36, 51, 63, 86, 88, 52, 65, 87, 89, 63, 84, 88, 90, 65, 85, 89, 91,
+    56, 92, 86, 96, 66, 94, 88, 98, 58, 93, 87, 97, 68, 95, 89, 99, 104, 110, 114, 117, 106, 111, 115, 118, 107, 112, 115, 119, 108, 113, 116, 69,
+    9, 30, 26, 33, 11, 31, 28, 35, 10, 31, 27, 34, 12, 32, 29, 36, 56, 86, 92, 96, 58, 87, 93, 97, 66, 88, 94, 98, 68, 89, 95, 99,
+    51, 86, 63, 88, 63, 88, 84, 90, 52, 87, 65, 89, 65, 89, 85, 91, 104, 114, 110, 117, 107, 115, 112, 119, 106, 115, 111, 118, 108, 116, 113, 69,
+    13, 33, 33, 81, 14, 34, 35, 82, 14, 35, 34, 82, 15, 36, 36, 83, 57, 88, 96, 100, 59, 89, 97, 101, 67, 90, 98, 102, 69, 91, 99, 36,
+    57, 96, 88, 100, 67, 98, 90, 102, 59, 97, 89, 101, 69, 99, 91, 36, 105, 117, 117, 120, 108, 118, 119, 78, 108, 119, 118, 78, 109, 69, 69, 15,
+    4, 10, 11, 14, 7, 12, 17, 18, 10, 14, 14, 19, 12, 15, 18, 20, 48, 52, 58, 59, 50, 53, 60, 61, 66, 67, 70, 71, 68, 69, 72, 73,
+    62, 66, 63, 67, 74, 76, 75, 77, 66, 70, 67, 71, 76, 78, 77, 79, 104, 106, 107, 108, 110, 111, 112, 113, 114, 115, 115, 116, 117, 118, 119, 69,
+    25, 31, 39, 41, 27, 32, 40, 42, 31, 35, 41, 43, 32, 36, 42, 44, 57, 67, 96, 98, 59, 69, 97, 99, 88, 90, 100, 102, 89, 91, 101, 36,
+    144, 145, 148, 149, 146, 147, 150, 151, 145, 152, 149, 153, 147, 101, 151, 42, 164, 165, 166, 167, 165, 116, 168, 89, 166, 168, 169, 147, 167, 89, 147, 32,
+    48, 66, 58, 70, 50, 68, 60, 72, 52, 67, 59, 71, 53, 69, 61, 73, 123, 130, 133, 135, 124, 131, 134, 136, 130, 132, 135, 137, 131, 113, 136, 61,
+    104, 114, 107, 115, 110, 117, 112, 119, 106, 115, 108, 116, 111, 118, 113, 69, 170, 172, 171, 173, 171, 173, 175, 131, 172, 174, 173, 111, 173, 111, 131, 53,
+    57, 88, 96, 100, 59, 89, 97, 101, 67, 90, 98, 102, 69, 91, 99, 36, 125, 132, 160, 162, 126, 113, 161, 95, 132, 159, 162, 163, 113, 85, 95, 29,
+    164, 166, 166, 169, 165, 167, 168, 147, 165, 168, 167, 147, 116, 89, 89, 32, 176, 178, 179, 117, 177, 108, 155, 68, 178, 156, 117, 76, 108, 65, 68, 12,
+    4, 11, 10, 14, 10, 14, 14, 19, 7, 17, 12, 18, 12, 18, 15, 20, 62, 63, 66, 67, 66, 67, 70, 71, 74, 75, 76, 77, 76, 77, 78, 79,
+    48, 58, 52, 59, 66, 70, 67, 71, 50, 60, 53, 61, 68, 72, 69, 73, 104, 107, 106, 108, 114, 115, 115, 116, 110, 112, 111, 113, 117, 119, 118, 69,
+    48, 58, 66, 70, 52, 59, 67, 71, 50, 60, 68, 72, 53, 61, 69, 73, 104, 107, 114, 115, 106, 108, 115, 116, 110, 112, 117, 119, 111, 113, 118, 69,
+    123, 133, 130, 135, 130, 135, 132, 137, 124, 134, 131, 136, 131, 136, 113, 61, 170, 171, 172, 173, 172, 173, 174, 111, 171, 175, 173, 131, 173, 131, 111, 53,
+    25, 39, 31, 41, 31, 41, 35, 43, 27, 40, 32, 42, 32, 42, 36, 44, 144, 148, 145, 149, 145, 149, 152, 153, 146, 150, 147, 151, 147, 151, 101, 42,
+    57, 96, 67, 98, 88, 100, 90, 102, 59, 97, 69, 99, 89, 101, 91, 36, 164, 166, 165, 167, 166, 169, 168, 147, 165, 168, 116, 89, 167, 147, 89, 32,
+    57, 96, 88, 100, 67, 98, 90, 102, 59, 97, 89, 101, 69, 99, 91, 36, 164, 166, 166, 169, 165, 167, 168, 147, 165, 168, 167, 147, 116, 89, 89, 32,
+    125, 160, 132, 162, 132, 162, 159, 163, 126, 161, 113, 95, 113, 95, 85, 29, 176, 179, 178, 117, 178, 117, 156, 76, 177, 155, 108, 68, 108, 68, 65, 12,
+    5, 12, 12, 15, 12, 15, 18, 20, 12, 18, 15, 20, 15, 20, 20, 21, 64, 65, 68, 69, 68, 69, 72, 73, 76, 77, 78, 79, 78, 79, 80, 20,
+    64, 68, 65, 69, 76, 78, 77, 79, 68, 72, 69, 73, 78, 80, 79, 20, 105, 108, 108, 109, 117, 118, 119, 69, 117, 119, 118, 69, 120, 78, 78, 15,
+    64, 68, 76, 78, 65, 69, 77, 79, 68, 72, 78, 80, 69, 73, 79, 20, 105, 108, 117, 118, 108, 109, 119, 69, 117, 119, 120, 78, 118, 69, 78, 15,
+    154, 155, 156, 119, 156, 119, 157, 77, 155, 158, 119, 72, 119, 72, 77, 18, 176, 177, 178, 108, 178, 108, 156, 65, 179, 155, 117, 68, 117, 68, 76, 12,
+    64, 76, 68, 78, 68, 78, 72, 80, 65, 77, 69, 79, 69, 79, 73, 20, 154, 156, 155, 119, 155, 119, 158, 72, 156, 157, 119, 77, 119, 77, 72, 18,
+    105, 117, 108, 118, 117, 120, 119, 78, 108, 119, 109, 69, 118, 78, 69, 15, 176, 178, 177, 108, 179, 117, 155, 68, 178, 156, 108, 65, 117, 76, 68, 12,
+    105, 117, 117, 120, 108, 118, 119, 78, 108, 119, 118, 78, 109, 69, 69, 15, 176, 178, 179, 117, 177, 108, 155, 68, 178, 156, 117, 76, 108, 65, 68, 12,
+    176, 179, 178, 117, 178, 117, 156, 76, 177, 155, 108, 68, 108, 68, 65, 12, 180, 176, 176, 105, 176, 105, 154, 64, 176, 154, 105, 64, 105, 64, 64, 5,
+    1, 3, 8, 9, 8, 9, 24, 25, 45, 47, 46, 48, 46, 48, 62, 64, 2, 4, 9, 10, 9, 10, 26, 27, 46, 48, 51, 52, 51, 52, 63, 65,
+    3, 6, 9, 11, 24, 26, 30, 31, 47, 49, 48, 50, 56, 58, 66, 68, 4, 7, 10, 12, 25, 27, 31, 32, 48, 50, 52, 53, 57, 59, 67, 69,
+    3, 6, 24, 26, 9, 11, 30, 31, 47, 49, 56, 58, 48, 50, 66, 68, 4, 7, 25, 27, 10, 12, 31, 32, 48, 50, 57, 59, 52, 53, 67, 69,
+    6, 22, 26, 28, 26, 28, 33, 35, 49, 54, 58, 60, 58, 60, 70, 72, 7, 23, 27, 29, 27, 29, 34, 36, 50, 55, 59, 61, 59, 61, 71, 73,
+    8, 24, 24, 30, 24, 30, 37, 39, 46, 56, 62, 66, 62, 66, 74, 76, 9, 25, 26, 31, 26, 31, 38, 40, 51, 57, 63, 67, 63, 67, 75, 77,
+    9, 26, 25, 31, 30, 33, 39, 41, 48, 58, 64, 68, 66, 70, 76, 78, 10, 27, 27, 32, 31, 34, 40, 42, 52, 59, 65, 69, 67, 71, 77, 79,
+    9, 26, 30, 33, 25, 31, 39, 41, 48, 58, 66, 70, 64, 68, 76, 78, 10, 27, 31, 34, 27, 32, 40, 42, 52, 59, 67, 71, 65, 69, 77, 79,
+    11, 28, 31, 35, 31, 35, 41, 43, 50, 60, 68, 72, 68, 72, 78, 80, 12, 29, 32, 36, 32, 36, 42, 44, 53, 61, 69, 73, 69, 73, 79, 20,
+    2, 4, 9, 10, 9, 10, 26, 27, 46, 48, 51, 52, 51, 52, 63, 65, 4, 5, 11, 12, 11, 12, 28, 29, 62, 64, 63, 65, 63, 65, 84, 85,
+    9, 11, 13, 14, 30, 31, 33, 34, 56, 58, 57, 59, 86, 87, 88, 89, 10, 12, 14, 15, 31, 32, 35, 36, 66, 68, 67, 69, 88, 89, 90, 91,
+    9, 11, 30, 31, 13, 14, 33, 34, 56, 58, 86, 87, 57, 59, 88, 89, 10, 12, 31, 32, 14, 15, 35, 36, 66, 68, 88, 89, 67, 69, 90, 91,
+    26, 28, 33, 35, 33, 35, 81, 82, 92, 93, 96, 97, 96, 97, 100, 101, 27, 29, 34, 36, 34, 36, 82, 83, 94, 95, 98, 99, 98, 99, 102, 36,
+    46, 62, 56, 66, 56, 66, 92, 94, 103, 104, 104, 106, 104, 106, 110, 111, 48, 64, 58, 68, 58, 68, 93, 95, 104, 105, 107, 108, 107, 108, 112, 113,
+    51, 63, 57, 67, 86, 88, 96, 98, 104, 107, 105, 108, 114, 115, 117, 118, 52, 65, 59, 69, 87, 89, 97, 99, 106, 108, 108, 109, 115, 116, 119, 69,
+    51, 63, 86, 88, 57, 67, 96, 98, 104, 107, 114, 115, 105, 108, 117, 118, 52, 65, 87, 89, 59, 69, 97, 99, 106, 108, 115, 116, 108, 109, 119, 69,
+    63, 84, 88, 90, 88, 90, 100, 102, 110, 112, 117, 119, 117, 119, 120, 78, 65, 85, 89, 91, 89, 91, 101, 36, 111, 113, 118, 69, 118, 69, 78, 15,
+    3, 6, 9, 11, 24, 26, 30, 31, 47, 49, 48, 50, 56, 58, 66, 68, 9, 11, 13, 14, 30, 31, 33, 34, 56, 58, 57, 59, 86, 87, 88, 89,
+    6, 16, 11, 17, 37, 38, 39, 40, 49, 54, 50, 55, 92, 93, 94, 95, 11, 17, 14, 18, 39, 40, 41, 42, 58, 60, 59, 61, 96, 97, 98, 99,
+    47, 49, 56, 58, 56, 58, 86, 87, 121, 122, 123, 124, 123, 124, 130, 131, 48, 50, 57, 59, 66, 68, 88, 89, 123, 124, 125, 126, 130, 131, 132, 113,
+    49, 54, 58, 60, 92, 93, 96, 97, 122, 127, 124, 128, 133, 134, 135, 136, 50, 55, 59, 61, 94, 95, 98, 99, 124, 128, 126, 129, 135, 136, 137, 61,
+    24, 37, 30, 39, 138, 139, 139, 140, 56, 92, 66, 94, 144, 145, 146, 147, 30, 39, 33, 41, 139, 140, 141, 142, 86, 96, 88, 98, 148, 149, 150, 151,
+    26, 38, 31, 40, 139, 141, 140, 142, 58, 93, 68, 95, 145, 152, 147, 101, 31, 40, 34, 42, 140, 142, 142, 143, 87, 97, 89, 99, 149, 153, 151, 42,
+    56, 92, 86, 96, 144, 145, 148, 149, 123, 133, 130, 135, 154, 155, 156, 119, 66, 94, 88, 98, 146, 147, 150, 151, 130, 135, 132, 137, 156, 119, 157, 77,
+    58, 93, 87, 97, 145, 152, 149, 153, 124, 134, 131, 136, 155, 158, 119, 72, 68, 95, 89, 99, 147, 101, 151, 42, 131, 136, 113, 61, 119, 72, 77, 18,
+    4, 7, 10, 12, 25, 27, 31, 32, 48, 50, 52, 53, 57, 59, 67, 69, 10, 12, 14, 15, 31, 32, 35, 36, 66, 68, 67, 69, 88, 89, 90, 91,
+    11, 17, 14, 18, 39, 40, 41, 42, 58, 60, 59, 61, 96, 97, 98, 99, 14, 18, 19, 20, 41, 42, 43, 44, 70, 72, 71, 73, 100, 101, 102, 36,
+    48, 50, 66, 68, 57, 59, 88, 89, 123, 124, 130, 131, 125, 126, 132, 113, 52, 53, 67, 69, 67, 69, 90, 91, 130, 131, 132, 113, 132, 113, 159, 85,
+    58, 60, 70, 72, 96, 97, 100, 101, 133, 134, 135, 136, 160, 161, 162, 95, 59, 61, 71, 73, 98, 99, 102, 36, 135, 136, 137, 61, 162, 95, 163, 29,
+    62, 74, 66, 76, 144, 146, 145, 147, 104, 110, 106, 111, 164, 165, 165, 116, 66, 76, 70, 78, 145, 147, 152, 101, 114, 117, 115, 118, 166, 167, 168, 89,
+    63, 75, 67, 77, 148, 150, 149, 151, 107, 112, 108, 113, 166, 168, 167, 89, 67, 77, 71, 79, 149, 151, 153, 42, 115, 119, 116, 69, 169, 147, 147, 32,
+    104, 110, 114, 117, 164, 165, 166, 167, 170, 171, 172, 173, 176, 177, 178, 108, 106, 111, 115, 118, 165, 116, 168, 89, 172, 173, 174, 111, 178, 108, 156, 65,
+    107, 112, 115, 119, 166, 168, 169, 147, 171, 175, 173, 131, 179, 155, 117, 68, 108, 113, 116, 69, 167, 89, 147, 32, 173, 131, 111, 53, 117, 68, 76, 12,
+    3, 6, 24, 26, 9, 11, 30, 31, 47, 49, 56, 58, 48, 50, 66, 68, 9, 11, 30, 31, 13, 14, 33, 34, 56, 58, 86, 87, 57, 59, 88, 89,
+    47, 49, 56, 58, 56, 58, 86, 87, 121, 122, 123, 124, 123, 124, 130, 131, 48, 50, 66, 68, 57, 59, 88, 89, 123, 124, 130, 131, 125, 126, 132, 113,
+    6, 16, 37, 38, 11, 17, 39, 40, 49, 54, 92, 93, 50, 55, 94, 95, 11, 17, 39, 40, 14, 18, 41, 42, 58, 60, 96, 97, 59, 61, 98, 99,
+    49, 54, 92, 93, 58, 60, 96, 97, 122, 127, 133, 134, 124, 128, 135, 136, 50, 55, 94, 95, 59, 61, 98, 99, 124, 128, 135, 136, 126, 129, 137, 61,
+    24, 37, 138, 139, 30, 39, 139, 140, 56, 92, 144, 145, 66, 94, 146, 147, 30, 39, 139, 140, 33, 41, 141, 142, 86, 96, 148, 149, 88, 98, 150, 151,
+    56, 92, 144, 145, 86, 96, 148, 149, 123, 133, 154, 155, 130, 135, 156, 119, 66, 94, 146, 147, 88, 98, 150, 151, 130, 135, 156, 119, 132, 137, 157, 77,
+    26, 38, 139, 141, 31, 40, 140, 142, 58, 93, 145, 152, 68, 95, 147, 101, 31, 40, 140, 142, 34, 42, 142, 143, 87, 97, 149, 153, 89, 99, 151, 42,
+    58, 93, 145, 152, 87, 97, 149, 153, 124, 134, 155, 158, 131, 136, 119, 72, 68, 95, 147, 101, 89, 99, 151, 42, 131, 136, 119, 72, 113, 61, 77, 18,
+    4, 7, 25, 27, 10, 12, 31, 32, 48, 50, 57, 59, 52, 53, 67, 69, 10, 12, 31, 32, 14, 15, 35, 36, 66, 68, 88, 89, 67, 69, 90, 91,
+    48, 50, 57, 59, 66, 68, 88, 89, 123, 124, 125, 126, 130, 131, 132, 113, 52, 53, 67, 69, 67, 69, 90, 91, 130, 131, 132, 113, 132, 113, 159, 85,
+    11, 17, 39, 40, 14, 18, 41, 42, 58, 60, 96, 97, 59, 61, 98, 99, 14, 18, 41, 42, 19, 20, 43, 44, 70, 72, 100, 101, 71, 73, 102, 36,
+    58, 60, 96, 97, 70, 72, 100, 101, 133, 134, 160, 161, 135, 136, 162, 95, 59, 61, 98, 99, 71, 73, 102, 36, 135, 136, 162, 95, 137, 61, 163, 29,
+    62, 74, 144, 146, 66, 76, 145, 147, 104, 110, 164, 165, 106, 111, 165, 116, 66, 76, 145, 147, 70, 78, 152, 101, 114, 117, 166, 167, 115, 118, 168, 89,
+    104, 110, 164, 165, 114, 117, 166, 167, 170, 171, 176, 177, 172, 173, 178, 108, 106, 111, 165, 116, 115, 118, 168, 89, 172, 173, 178, 108, 174, 111, 156, 65,
+    63, 75, 148, 150, 67, 77, 149, 151, 107, 112, 166, 168, 108, 113, 167, 89, 67, 77, 149, 151, 71, 79, 153, 42, 115, 119, 169, 147, 116, 69, 147, 32,
+    107, 112, 166, 168, 115, 119, 169, 147, 171, 175, 179, 155, 173, 131, 117, 68, 108, 113, 167, 89, 116, 69, 147, 32, 173, 131, 117, 68, 111, 53, 76, 12,
+    6, 22, 26, 28, 26, 28, 33, 35, 49, 54, 58, 60, 58, 60, 70, 72, 26, 28, 33, 35, 33, 35, 81, 82, 92, 93, 96, 97, 96, 97, 100, 101,
+    49, 54, 58, 60, 92, 93, 96, 97, 122, 127, 124, 128, 133, 134, 135, 136, 58, 60, 70, 72, 96, 97, 100, 101, 133, 134, 135, 136, 160, 161, 162, 95,
+    49, 54, 92, 93, 58, 60, 96, 97, 122, 127, 133, 134, 124, 128, 135, 136, 58, 60, 96, 97, 70, 72, 100, 101, 133, 134, 160, 161, 135, 136, 162, 95,
+    122, 127, 133, 134, 133, 134, 160, 161, 181, 182, 183, 184, 183, 184, 185, 128, 124, 128, 135, 136, 135, 136, 162, 95, 183, 184, 185, 128, 185, 128, 186, 55,
+    37, 187, 139, 188, 139, 188, 189, 190, 92, 191, 145, 192, 145, 192, 193, 153, 139, 188, 189, 190, 189, 190, 194, 195, 196, 197, 198, 199, 198, 199, 200, 142,
+    92, 191, 145, 192, 196, 197, 198, 199, 133, 201, 155, 161, 202, 203, 168, 97, 145, 192, 193, 153, 198, 199, 200, 142, 202, 203, 168, 97, 204, 192, 150, 40,
+    92, 191, 196, 197, 145, 192, 198, 199, 133, 201, 202, 203, 155, 161, 168, 97, 145, 192, 198, 199, 193, 153, 200, 142, 202, 203, 204, 192, 168, 97, 150, 40,
+    133, 201, 202, 203, 202, 203, 204, 192, 183, 205, 175, 134, 175, 134, 112, 60, 155, 161, 168, 97, 168, 97, 150, 40, 175, 134, 112, 60, 112, 60, 75, 17,
+    7, 23, 27, 29, 27, 29, 34, 36, 50, 55, 59, 61, 59, 61, 71, 73, 27, 29, 34, 36, 34, 36, 82, 83, 94, 95, 98, 99, 98, 99, 102, 36,
+    50, 55, 59, 61, 94, 95, 98, 99, 124, 128, 126, 129, 135, 136, 137, 61, 59, 61, 71, 73, 98, 99, 102, 36, 135, 136, 137, 61, 162, 95, 163, 29,
+    50, 55, 94, 95, 59, 61, 98, 99, 124, 128, 135, 136, 126, 129, 137, 61, 59, 61, 98, 99, 71, 73, 102, 36, 135, 136, 162, 95, 137, 61, 163, 29,
+    124, 128, 135, 136, 135, 136, 162, 95, 183, 184, 185, 128, 185, 128, 186, 55, 126, 129, 137, 61, 137, 61, 163, 29, 185, 128, 186, 55, 186, 55, 206, 23,
+    74, 206, 146, 163, 146, 163, 193, 102, 110, 186, 165, 137, 165, 137, 207, 71, 146, 163, 193, 102, 193, 102, 208, 82, 209, 162, 210, 98, 210, 98, 193, 34,
+    110, 186, 165, 137, 209, 162, 210, 98, 171, 185, 177, 126, 211, 135, 165, 59, 165, 137, 207, 71, 210, 98, 193, 34, 211, 135, 165, 59, 209, 94, 146, 27,
+    110, 186, 209, 162, 165, 137, 210, 98, 171, 185, 211, 135, 177, 126, 165, 59, 165, 137, 210, 98, 207, 71, 193, 34, 211, 135, 209, 94, 165, 59, 146, 27,
+    171, 185, 211, 135, 211, 135, 209, 94, 212, 183, 171, 124, 171, 124, 110, 50, 177, 126, 165, 59, 165, 59, 146, 27, 171, 124, 110, 50, 110, 50, 74, 7,
+    8, 24, 24, 30, 24, 30, 37, 39, 46, 56, 62, 66, 62, 66, 74, 76, 46, 62, 56, 66, 56, 66, 92, 94, 103, 104, 104, 106, 104, 106, 110, 111,
+    24, 37, 30, 39, 138, 139, 139, 140, 56, 92, 66, 94, 144, 145, 146, 147, 62, 74, 66, 76, 144, 146, 145, 147, 104, 110, 106, 111, 164, 165, 165, 116,
+    24, 37, 138, 139, 30, 39, 139, 140, 56, 92, 144, 145, 66, 94, 146, 147, 62, 74, 144, 146, 66, 76, 145, 147, 104, 110, 164, 165, 106, 111, 165, 116,
+    37, 187, 139, 188, 139, 188, 189, 190, 92, 191, 145, 192, 145, 192, 193, 153, 74, 206, 146, 163, 146, 163, 193, 102, 110, 186, 165, 137, 165, 137, 207, 71,
+    24, 138, 37, 139, 37, 139, 187, 188, 62, 144, 74, 146, 74, 146, 206, 163, 56, 144, 92, 145, 92, 145, 191, 192, 104, 164, 110, 165, 110, 165, 186, 137,
+    30, 139, 39, 140, 139, 189, 188, 190, 66, 145, 76, 147, 146, 193, 163, 102, 66, 146, 94, 147, 145, 193, 192, 153, 106, 165, 111, 116, 165, 207, 137, 71,
+    30, 139, 139, 189, 39, 140, 188, 190, 66, 145, 146, 193, 76, 147, 163, 102, 66, 146, 145, 193, 94, 147, 192, 153, 106, 165, 165, 207, 111, 116, 137, 71,
+    39, 188, 140, 190, 140, 190, 190, 213, 94, 192, 147, 153, 147, 153, 102, 43, 76, 163, 147, 102, 147, 102, 153, 43, 111, 137, 116, 71, 116, 71, 71, 19,
+    9, 25, 26, 31, 26, 31, 38, 40, 51, 57, 63, 67, 63, 67, 75, 77, 48, 64, 58, 68, 58, 68, 93, 95, 104, 105, 107, 108, 107, 108, 112, 113,
+    30, 39, 33, 41, 139, 140, 141, 142, 86, 96, 88, 98, 148, 149, 150, 151, 66, 76, 70, 78, 145, 147, 152, 101, 114, 117, 115, 118, 166, 167, 168, 89,
+    30, 39, 139, 140, 33, 41, 141, 142, 86, 96, 148, 149, 88, 98, 150, 151, 66, 76, 145, 147, 70, 78, 152, 101, 114, 117, 166, 167, 115, 118, 168, 89,
+    139, 188, 189, 190, 189, 190, 194, 195, 196, 197, 198, 199, 198, 199, 200, 142, 146, 163, 193, 102, 193, 102, 208, 82, 209, 162, 210, 98, 210, 98, 193, 34,
+    56, 144, 92, 145, 92, 145, 191, 192, 104, 164, 110, 165, 110, 165, 186, 137, 123, 154, 133, 155, 133, 155, 201, 161, 170, 176, 171, 177, 171, 177, 185, 126,
+    86, 148, 96, 149, 196, 198, 197, 199, 114, 166, 117, 167, 209, 210, 162, 98, 130, 156, 135, 119, 202, 168, 203, 97, 172, 178, 173, 108, 211, 165, 135, 59,
+    86, 148, 196, 198, 96, 149, 197, 199, 114, 166, 209, 210, 117, 167, 162, 98, 130, 156, 202, 168, 135, 119, 203, 97, 172, 178, 211, 165, 173, 108, 135, 59,
+    148, 214, 198, 215, 198, 215, 216, 190, 209, 204, 169, 149, 169, 149, 100, 41, 156, 159, 168, 90, 168, 90, 152, 35, 174, 132, 115, 67, 115, 67, 70, 14,
+    9, 26, 25, 31, 30, 33, 39, 41, 48, 58, 64, 68, 66, 70, 76, 78, 51, 63, 57, 67, 86, 88, 96, 98, 104, 107, 105, 108, 114, 115, 117, 118,
+    26, 38, 31, 40, 139, 141, 140, 142, 58, 93, 68, 95, 145, 152, 147, 101, 63, 75, 67, 77, 148, 150, 149, 151, 107, 112, 108, 113, 166, 168, 167, 89,
+    56, 92, 144, 145, 86, 96, 148, 149, 123, 133, 154, 155, 130, 135, 156, 119, 104, 110, 164, 165, 114, 117, 166, 167, 170, 171, 176, 177, 172, 173, 178, 108,
+    92, 191, 145, 192, 196, 197, 198, 199, 133, 201, 155, 161, 202, 203, 168, 97, 110, 186, 165, 137, 209, 162, 210, 98, 171, 185, 177, 126, 211, 135, 165, 59,
+    30, 139, 39, 140, 139, 189, 188, 190, 66, 145, 76, 147, 146, 193, 163, 102, 86, 148, 96, 149, 196, 198, 197, 199, 114, 166, 117, 167, 209, 210, 162, 98,
+    33, 141, 41, 142, 189, 194, 190, 195, 70, 152, 78, 101, 193, 208, 102, 82, 88, 150, 98, 151, 198, 200, 199, 142, 115, 168, 118, 89, 210, 193, 98, 34,
+    86, 196, 148, 198, 148, 198, 214, 215, 130, 202, 156, 168, 156, 168, 159, 90, 114, 209, 166, 210, 209, 169, 204, 149, 172, 211, 178, 165, 174, 115, 132, 67,
+    96, 197, 149, 199, 198, 216, 215, 190, 135, 203, 119, 97, 168, 152, 90, 35, 117, 162, 167, 98, 169, 100, 149, 41, 173, 135, 108, 59, 115, 70, 67, 14,
+    10, 27, 27, 32, 31, 34, 40, 42, 52, 59, 65, 69, 67, 71, 77, 79, 52, 65, 59, 69, 87, 89, 97, 99, 106, 108, 108, 109, 115, 116, 119, 69,
+    31, 40, 34, 42, 140, 142, 142, 143, 87, 97, 89, 99, 149, 153, 151, 42, 67, 77, 71, 79, 149, 151, 153, 42, 115, 119, 116, 69, 169, 147, 147, 32,
+    66, 94, 146, 147, 88, 98, 150, 151, 130, 135, 156, 119, 132, 137, 157, 77, 106, 111, 165, 116, 115, 118, 168, 89, 172, 173, 178, 108, 174, 111, 156, 65,
+    145, 192, 193, 153, 198, 199, 200, 142, 202, 203, 168, 97, 204, 192, 150, 40, 165, 137, 207, 71, 210, 98, 193, 34, 211, 135, 165, 59, 209, 94, 146, 27,
+    66, 146, 94, 147, 145, 193, 192, 153, 106, 165, 111, 116, 165, 207, 137, 71, 130, 156, 135, 119, 202, 168, 203, 97, 172, 178, 173, 108, 211, 165, 135, 59,
+    88, 150, 98, 151, 198, 200, 199, 142, 115, 168, 118, 89, 210, 193, 98, 34, 132, 157, 137, 77, 204, 150, 192, 40, 174, 156, 111, 65, 209, 146, 94, 27,
+    114, 209, 209, 169, 166, 210, 204, 149, 172, 211, 174, 115, 178, 165, 132, 67, 172, 174, 211, 115, 211, 115, 202, 87, 217, 172, 172, 106, 172, 106, 130, 52,
+    166, 204, 210, 149, 218, 198, 198, 140, 211, 202, 115, 87, 166, 145, 88, 31, 178, 132, 165, 67, 166, 88, 145, 31, 172, 130, 106, 52, 114, 66, 66, 10,
+    9, 26, 30, 33, 25, 31, 39, 41, 48, 58, 66, 70, 64, 68, 76, 78, 51, 63, 86, 88, 57, 67, 96, 98, 104, 107, 114, 115, 105, 108, 117, 118,
+    56, 92, 86, 96, 144, 145, 148, 149, 123, 133, 130, 135, 154, 155, 156, 119, 104, 110, 114, 117, 164, 165, 166, 167, 170, 171, 172, 173, 176, 177, 178, 108,
+    26, 38, 139, 141, 31, 40, 140, 142, 58, 93, 145, 152, 68, 95, 147, 101, 63, 75, 148, 150, 67, 77, 149, 151, 107, 112, 166, 168, 108, 113, 167, 89,
+    92, 191, 196, 197, 145, 192, 198, 199, 133, 201, 202, 203, 155, 161, 168, 97, 110, 186, 209, 162, 165, 137, 210, 98, 171, 185, 211, 135, 177, 126, 165, 59,
+    30, 139, 139, 189, 39, 140, 188, 190, 66, 145, 146, 193, 76, 147, 163, 102, 86, 148, 196, 198, 96, 149, 197, 199, 114, 166, 209, 210, 117, 167, 162, 98,
+    86, 196, 148, 198, 148, 198, 214, 215, 130, 202, 156, 168, 156, 168, 159, 90, 114, 209, 209, 169, 166, 210, 204, 149, 172, 211, 174, 115, 178, 165, 132, 67,
+    33, 141, 189, 194, 41, 142, 190, 195, 70, 152, 193, 208, 78, 101, 102, 82, 88, 150, 198, 200, 98, 151, 199, 142, 115, 168, 210, 193, 118, 89, 98, 34,
+    96, 197, 198, 216, 149, 199, 215, 190, 135, 203, 168, 152, 119, 97, 90, 35, 117, 162, 169, 100, 167, 98, 149, 41, 173, 135, 115, 70, 108, 59, 67, 14,
+    10, 27, 31, 34, 27, 32, 40, 42, 52, 59, 67, 71, 65, 69, 77, 79, 52, 65, 87, 89, 59, 69, 97, 99, 106, 108, 115, 116, 108, 109, 119, 69,
+    66, 94, 88, 98, 146, 147, 150, 151, 130, 135, 132, 137, 156, 119, 157, 77, 106, 111, 115, 118, 165, 116, 168, 89, 172, 173, 174, 111, 178, 108, 156, 65,
+    31, 40, 140, 142, 34, 42, 142, 143, 87, 97, 149, 153, 89, 99, 151, 42, 67, 77, 149, 151, 71, 79, 153, 42, 115, 119, 169, 147, 116, 69, 147, 32,
+    145, 192, 198, 199, 193, 153, 200, 142, 202, 203, 204, 192, 168, 97, 150, 40, 165, 137, 210, 98, 207, 71, 193, 34, 211, 135, 209, 94, 165, 59, 146, 27,
+    66, 146, 145, 193, 94, 147, 192, 153, 106, 165, 165, 207, 111, 116, 137, 71, 130, 156, 202, 168, 135, 119, 203, 97, 172, 178, 211, 165, 173, 108, 135, 59,
+    114, 209, 166, 210, 209, 169, 204, 149, 172, 211, 178, 165, 174, 115, 132, 67, 172, 174, 211, 115, 211, 115, 202, 87, 217, 172, 172, 106, 172, 106, 130, 52,
+    88, 150, 198, 200, 98, 151, 199, 142, 115, 168, 210, 193, 118, 89, 98, 34, 132, 157, 204, 150, 137, 77, 192, 40, 174, 156, 209, 146, 111, 65, 94, 27,
+    166, 204, 218, 198, 210, 149, 198, 140, 211, 202, 166, 145, 115, 87, 88, 31, 178, 132, 166, 88, 165, 67, 145, 31, 172, 130, 114, 66, 106, 52, 66, 10,
+    11, 28, 31, 35, 31, 35, 41, 43, 50, 60, 68, 72, 68, 72, 78, 80, 63, 84, 88, 90, 88, 90, 100, 102, 110, 112, 117, 119, 117, 119, 120, 78,
+    58, 93, 87, 97, 145, 152, 149, 153, 124, 134, 131, 136, 155, 158, 119, 72, 107, 112, 115, 119, 166, 168, 169, 147, 171, 175, 173, 131, 179, 155, 117, 68,
+    58, 93, 145, 152, 87, 97, 149, 153, 124, 134, 155, 158, 131, 136, 119, 72, 107, 112, 166, 168, 115, 119, 169, 147, 171, 175, 179, 155, 173, 131, 117, 68,
+    133, 201, 202, 203, 202, 203, 204, 192, 183, 205, 175, 134, 175, 134, 112, 60, 171, 185, 211, 135, 211, 135, 209, 94, 212, 183, 171, 124, 171, 124, 110, 50,
+    39, 188, 140, 190, 140, 190, 190, 213, 94, 192, 147, 153, 147, 153, 102, 43, 148, 214, 198, 215, 198, 215, 216, 190, 209, 204, 169, 149, 169, 149, 100, 41,
+    96, 197, 149, 199, 198, 216, 215, 190, 135, 203, 119, 97, 168, 152, 90, 35, 166, 204, 210, 149, 218, 198, 198, 140, 211, 202, 115, 87, 166, 145, 88, 31,
+    96, 197, 198, 216, 149, 199, 215, 190, 135, 203, 168, 152, 119, 97, 90, 35, 166, 204, 218, 198, 210, 149, 198, 140, 211, 202, 166, 145, 115, 87, 88, 31,
+    160, 219, 204, 197, 204, 197, 214, 188, 185, 201, 112, 93, 112, 93, 84, 28, 179, 160, 166, 96, 166, 96, 148, 39, 171, 133, 107, 58, 107, 58, 63, 11,
+    12, 29, 32, 36, 32, 36, 42, 44, 53, 61, 69, 73, 69, 73, 79, 20, 65, 85, 89, 91, 89, 91, 101, 36, 111, 113, 118, 69, 118, 69, 78, 15,
+    68, 95, 89, 99, 147, 101, 151, 42, 131, 136, 113, 61, 119, 72, 77, 18, 108, 113, 116, 69, 167, 89, 147, 32, 173, 131, 111, 53, 117, 68, 76, 12,
+    68, 95, 147, 101, 89, 99, 151, 42, 131, 136, 119, 72, 113, 61, 77, 18, 108, 113, 167, 89, 116, 69, 147, 32, 173, 131, 117, 68, 111, 53, 76, 12,
+    155, 161, 168, 97, 168, 97, 150, 40, 175, 134, 112, 60, 112, 60, 75, 17, 177, 126, 165, 59, 165, 59, 146, 27, 171, 124, 110, 50, 110, 50, 74, 7,
+    76, 163, 147, 102, 147, 102, 153, 43, 111, 137, 116, 71, 116, 71, 71, 19, 156, 159, 168, 90, 168, 90, 152, 35, 174, 132, 115, 67, 115, 67, 70, 14,
+    117, 162, 167, 98, 169, 100, 149, 41, 173, 135, 108, 59, 115, 70, 67, 14, 178, 132, 165, 67, 166, 88, 145, 31, 172, 130, 106, 52, 114, 66, 66, 10,
+    117, 162, 169, 100, 167, 98, 149, 41, 173, 135, 115, 70, 108, 59, 67, 14, 178, 132, 166, 88, 165, 67, 145, 31, 172, 130, 114, 66, 106, 52, 66, 10,
+    179, 160, 166, 96, 166, 96, 148, 39, 171, 133, 107, 58, 107, 58, 63, 11, 176, 125, 164, 57, 164, 57, 144, 25, 170, 123, 104, 48, 104, 48, 62, 4,
+    1, 8, 3, 9, 45, 46, 47, 48, 8, 24, 9, 25, 46, 62, 48, 64, 3, 9, 6, 11, 47, 48, 49, 50, 24, 30, 26, 31, 56, 66, 58, 68,
+    2, 9, 4, 10, 46, 51, 48, 52, 9, 26, 10, 27, 51, 63, 52, 65, 4, 10, 7, 12, 48, 52, 50, 53, 25, 31, 27, 32, 57, 67, 59, 69,
+    8, 24, 24, 30, 46, 62, 56, 66, 24, 37, 30, 39, 62, 74, 66, 76, 9, 25, 26, 31, 48, 64, 58, 68, 30, 39, 33, 41, 66, 76, 70, 78,
+    9, 26, 25, 31, 51, 63, 57, 67, 26, 38, 31, 40, 63, 75, 67, 77, 10, 27, 27, 32, 52, 65, 59, 69, 31, 40, 34, 42, 67, 77, 71, 79,
+    3, 24, 6, 26, 47, 56, 49, 58, 9, 30, 11, 31, 48, 66, 50, 68, 6, 26, 22, 28, 49, 58, 54, 60, 26, 33, 28, 35, 58, 70, 60, 72,
+    4, 25, 7, 27, 48, 57, 50, 59, 10, 31, 12, 32, 52, 67, 53, 69, 7, 27, 23, 29, 50, 59, 55, 61, 27, 34, 29, 36, 59, 71, 61, 73,
+    9, 30, 26, 33, 48, 66, 58, 70, 25, 39, 31, 41, 64, 76, 68, 78, 11, 31, 28, 35, 50, 68, 60, 72, 31, 41, 35, 43, 68, 78, 72, 80,
+    10, 31, 27, 34, 52, 67, 59, 71, 27, 40, 32, 42, 65, 77, 69, 79, 12, 32, 29, 36, 53, 69, 61, 73, 32, 42, 36, 44, 69, 79, 73, 20,
+    3, 9, 6, 11, 47, 48, 49, 50, 24, 30, 26, 31, 56, 66, 58, 68, 6, 11, 16, 17, 49, 50, 54, 55, 37, 39, 38, 40, 92, 94, 93, 95,
+    9, 13, 11, 14, 56, 57, 58, 59, 30, 33, 31, 34, 86, 88, 87, 89, 11, 14, 17, 18, 58, 59, 60, 61, 39, 41, 40, 42, 96, 98, 97, 99,
+    24, 30, 37, 39, 56, 66, 92, 94, 138, 139, 139, 140, 144, 146, 145, 147, 26, 31, 38, 40, 58, 68, 93, 95, 139, 140, 141, 142, 145, 147, 152, 101,
+    30, 33, 39, 41, 86, 88, 96, 98, 139, 141, 140, 142, 148, 150, 149, 151, 31, 34, 40, 42, 87, 89, 97, 99, 140, 142, 142, 143, 149, 151, 153, 42,
+    47, 56, 49, 58, 121, 123, 122, 124, 56, 86, 58, 87, 123, 130, 124, 131, 49, 58, 54, 60, 122, 124, 127, 128, 92, 96, 93, 97, 133, 135, 134, 136,
+    48, 57, 50, 59, 123, 125, 124, 126, 66, 88, 68, 89, 130, 132, 131, 113, 50, 59, 55, 61, 124, 126, 128, 129, 94, 98, 95, 99, 135, 137, 136, 61,
+    56, 86, 92, 96, 123, 130, 133, 135, 144, 148, 145, 149, 154, 156, 155, 119, 58, 87, 93, 97, 124, 131, 134, 136, 145, 149, 152, 153, 155, 119, 158, 72,
+    66, 88, 94, 98, 130, 132, 135, 137, 146, 150, 147, 151, 156, 157, 119, 77, 68, 89, 95, 99, 131, 113, 136, 61, 147, 151, 101, 42, 119, 77, 72, 18,
+    2, 9, 4, 10, 46, 51, 48, 52, 9, 26, 10, 27, 51, 63, 52, 65, 9, 13, 11, 14, 56, 57, 58, 59, 30, 33, 31, 34, 86, 88, 87, 89,
+    4, 11, 5, 12, 62, 63, 64, 65, 11, 28, 12, 29, 63, 84, 65, 85, 10, 14, 12, 15, 66, 67, 68, 69, 31, 35, 32, 36, 88, 90, 89, 91,
+    46, 56, 62, 66, 103, 104, 104, 106, 56, 92, 66, 94, 104, 110, 106, 111, 51, 57, 63, 67, 104, 105, 107, 108, 86, 96, 88, 98, 114, 117, 115, 118,
+    48, 58, 64, 68, 104, 107, 105, 108, 58, 93, 68, 95, 107, 112, 108, 113, 52, 59, 65, 69, 106, 108, 108, 109, 87, 97, 89, 99, 115, 119, 116, 69,
+    9, 30, 11, 31, 56, 86, 58, 87, 13, 33, 14, 34, 57, 88, 59, 89, 26, 33, 28, 35, 92, 96, 93, 97, 33, 81, 35, 82, 96, 100, 97, 101,
+    10, 31, 12, 32, 66, 88, 68, 89, 14, 35, 15, 36, 67, 90, 69, 91, 27, 34, 29, 36, 94, 98, 95, 99, 34, 82, 36, 83, 98, 102, 99, 36,
+    51, 86, 63, 88, 104, 114, 107, 115, 57, 96, 67, 98, 105, 117, 108, 118, 63, 88, 84, 90, 110, 117, 112, 119, 88, 100, 90, 102, 117, 120, 119, 78,
+    52, 87, 65, 89, 106, 115, 108, 116, 59, 97, 69, 99, 108, 119, 109, 69, 65, 89, 85, 91, 111, 118, 113, 69, 89, 101, 91, 36, 118, 78, 69, 15,
+    4, 10, 7, 12, 48, 52, 50, 53, 25, 31, 27, 32, 57, 67, 59, 69, 11, 14, 17, 18, 58, 59, 60, 61, 39, 41, 40, 42, 96, 98, 97, 99,
+    10, 14, 12, 15, 66, 67, 68, 69, 31, 35, 32, 36, 88, 90, 89, 91, 14, 19, 18, 20, 70, 71, 72, 73, 41, 43, 42, 44, 100, 102, 101, 36,
+    62, 66, 74, 76, 104, 106, 110, 111, 144, 145, 146, 147, 164, 165, 165, 116, 63, 67, 75, 77, 107, 108, 112, 113, 148, 149, 150, 151, 166, 167, 168, 89,
+    66, 70, 76, 78, 114, 115, 117, 118, 145, 152, 147, 101, 166, 168, 167, 89, 67, 71, 77, 79, 115, 116, 119, 69, 149, 153, 151, 42, 169, 147, 147, 32,
+    48, 66, 50, 68, 123, 130, 124, 131, 57, 88, 59, 89, 125, 132, 126, 113, 58, 70, 60, 72, 133, 135, 134, 136, 96, 100, 97, 101, 160, 162, 161, 95,
+    52, 67, 53, 69, 130, 132, 131, 113, 67, 90, 69, 91, 132, 159, 113, 85, 59, 71, 61, 73, 135, 137, 136, 61, 98, 102, 99, 36, 162, 163, 95, 29,
+    104, 114, 110, 117, 170, 172, 171, 173, 164, 166, 165, 167, 176, 178, 177, 108, 107, 115, 112, 119, 171, 173, 175, 131, 166, 169, 168, 147, 179, 117, 155, 68,
+    106, 115, 111, 118, 172, 174, 173, 111, 165, 168, 116, 89, 178, 156, 108, 65, 108, 116, 113, 69, 173, 111, 131, 53, 167, 147, 89, 32, 117, 76, 68, 12,
+    8, 24, 24, 30, 46, 62, 56, 66, 24, 37, 30, 39, 62, 74, 66, 76, 24, 30, 37, 39, 56, 66, 92, 94, 138, 139, 139, 140, 144, 146, 145, 147,
+    46, 56, 62, 66, 103, 104, 104, 106, 56, 92, 66, 94, 104, 110, 106, 111, 62, 66, 74, 76, 104, 106, 110, 111, 144, 145, 146, 147, 164, 165, 165, 116,
+    24, 37, 138, 139, 62, 74, 144, 146, 37, 187, 139, 188, 74, 206, 146, 163, 30, 39, 139, 140, 66, 76, 145, 147, 139, 188, 189, 190, 146, 163, 193, 102,
+    56, 92, 144, 145, 104, 110, 164, 165, 92, 191, 145, 192, 110, 186, 165, 137, 66, 94, 146, 147, 106, 111, 165, 116, 145, 192, 193, 153, 165, 137, 207, 71,
+    24, 138, 37, 139, 56, 144, 92, 145, 30, 139, 39, 140, 66, 146, 94, 147, 37, 139, 187, 188, 92, 145, 191, 192, 139, 189, 188, 190, 145, 193, 192, 153,
+    62, 144, 74, 146, 104, 164, 110, 165, 66, 145, 76, 147, 106, 165, 111, 116, 74, 146, 206, 163, 110, 165, 186, 137, 146, 193, 163, 102, 165, 207, 137, 71,
+    30, 139, 139, 189, 66, 146, 145, 193, 39, 188, 140, 190, 76, 163, 147, 102, 39, 140, 188, 190, 94, 147, 192, 153, 140, 190, 190, 213, 147, 102, 153, 43,
+    66, 145, 146, 193, 106, 165, 165, 207, 94, 192, 147, 153, 111, 137, 116, 71, 76, 147, 163, 102, 111, 116, 137, 71, 147, 153, 102, 43, 116, 71, 71, 19,
+    9, 25, 26, 31, 48, 64, 58, 68, 30, 39, 33, 41, 66, 76, 70, 78, 26, 31, 38, 40, 58, 68, 93, 95, 139, 140, 141, 142, 145, 147, 152, 101,
+    51, 57, 63, 67, 104, 105, 107, 108, 86, 96, 88, 98, 114, 117, 115, 118, 63, 67, 75, 77, 107, 108, 112, 113, 148, 149, 150, 151, 166, 167, 168, 89,
+    30, 39, 139, 140, 66, 76, 145, 147, 139, 188, 189, 190, 146, 163, 193, 102, 33, 41, 141, 142, 70, 78, 152, 101, 189, 190, 194, 195, 193, 102, 208, 82,
+    86, 96, 148, 149, 114, 117, 166, 167, 196, 197, 198, 199, 209, 162, 210, 98, 88, 98, 150, 151, 115, 118, 168, 89, 198, 199, 200, 142, 210, 98, 193, 34,
+    56, 144, 92, 145, 123, 154, 133, 155, 86, 148, 96, 149, 130, 156, 135, 119, 92, 145, 191, 192, 133, 155, 201, 161, 196, 198, 197, 199, 202, 168, 203, 97,
+    104, 164, 110, 165, 170, 176, 171, 177, 114, 166, 117, 167, 172, 178, 173, 108, 110, 165, 186, 137, 171, 177, 185, 126, 209, 210, 162, 98, 211, 165, 135, 59,
+    86, 148, 196, 198, 130, 156, 202, 168, 148, 214, 198, 215, 156, 159, 168, 90, 96, 149, 197, 199, 135, 119, 203, 97, 198, 215, 216, 190, 168, 90, 152, 35,
+    114, 166, 209, 210, 172, 178, 211, 165, 209, 204, 169, 149, 174, 132, 115, 67, 117, 167, 162, 98, 173, 108, 135, 59, 169, 149, 100, 41, 115, 67, 70, 14,
+    9, 26, 25, 31, 51, 63, 57, 67, 26, 38, 31, 40, 63, 75, 67, 77, 30, 33, 39, 41, 86, 88, 96, 98, 139, 141, 140, 142, 148, 150, 149, 151,
+    48, 58, 64, 68, 104, 107, 105, 108, 58, 93, 68, 95, 107, 112, 108, 113, 66, 70, 76, 78, 114, 115, 117, 118, 145, 152, 147, 101, 166, 168, 167, 89,
+    56, 92, 144, 145, 104, 110, 164, 165, 92, 191, 145, 192, 110, 186, 165, 137, 86, 96, 148, 149, 114, 117, 166, 167, 196, 197, 198, 199, 209, 162, 210, 98,
+    123, 133, 154, 155, 170, 171, 176, 177, 133, 201, 155, 161, 171, 185, 177, 126, 130, 135, 156, 119, 172, 173, 178, 108, 202, 203, 168, 97, 211, 135, 165, 59,
+    30, 139, 39, 140, 86, 148, 96, 149, 33, 141, 41, 142, 88, 150, 98, 151, 139, 189, 188, 190, 196, 198, 197, 199, 189, 194, 190, 195, 198, 200, 199, 142,
+    66, 145, 76, 147, 114, 166, 117, 167, 70, 152, 78, 101, 115, 168, 118, 89, 146, 193, 163, 102, 209, 210, 162, 98, 193, 208, 102, 82, 210, 193, 98, 34,
+    86, 196, 148, 198, 114, 209, 166, 210, 96, 197, 149, 199, 117, 162, 167, 98, 148, 198, 214, 215, 209, 169, 204, 149, 198, 216, 215, 190, 169, 100, 149, 41,
+    130, 202, 156, 168, 172, 211, 178, 165, 135, 203, 119, 97, 173, 135, 108, 59, 156, 168, 159, 90, 174, 115, 132, 67, 168, 152, 90, 35, 115, 70, 67, 14,
+    10, 27, 27, 32, 52, 65, 59, 69, 31, 40, 34, 42, 67, 77, 71, 79, 31, 34, 40, 42, 87, 89, 97, 99, 140, 142, 142, 143, 149, 151, 153, 42,
+    52, 59, 65, 69, 106, 108, 108, 109, 87, 97, 89, 99, 115, 119, 116, 69, 67, 71, 77, 79, 115, 116, 119, 69, 149, 153, 151, 42, 169, 147, 147, 32,
+    66, 94, 146, 147, 106, 111, 165, 116, 145, 192, 193, 153, 165, 137, 207, 71, 88, 98, 150, 151, 115, 118, 168, 89, 198, 199, 200, 142, 210, 98, 193, 34,
+    130, 135, 156, 119, 172, 173, 178, 108, 202, 203, 168, 97, 211, 135, 165, 59, 132, 137, 157, 77, 174, 111, 156, 65, 204, 192, 150, 40, 209, 94, 146, 27,
+    66, 146, 94, 147, 130, 156, 135, 119, 88, 150, 98, 151, 132, 157, 137, 77, 145, 193, 192, 153, 202, 168, 203, 97, 198, 200, 199, 142, 204, 150, 192, 40,
+    106, 165, 111, 116, 172, 178, 173, 108, 115, 168, 118, 89, 174, 156, 111, 65, 165, 207, 137, 71, 211, 165, 135, 59, 210, 193, 98, 34, 209, 146, 94, 27,
+    114, 209, 209, 169, 172, 174, 211, 115, 166, 204, 210, 149, 178, 132, 165, 67, 166, 210, 204, 149, 211, 115, 202, 87, 218, 198, 198, 140, 166, 88, 145, 31,
+    172, 211, 174, 115, 217, 172, 172, 106, 211, 202, 115, 87, 172, 130, 106, 52, 178, 165, 132, 67, 172, 106, 130, 52, 166, 145, 88, 31, 114, 66, 66, 10,
+    3, 24, 6, 26, 47, 56, 49, 58, 9, 30, 11, 31, 48, 66, 50, 68, 47, 56, 49, 58, 121, 123, 122, 124, 56, 86, 58, 87, 123, 130, 124, 131,
+    9, 30, 11, 31, 56, 86, 58, 87, 13, 33, 14, 34, 57, 88, 59, 89, 48, 66, 50, 68, 123, 130, 124, 131, 57, 88, 59, 89, 125, 132, 126, 113,
+    24, 138, 37, 139, 56, 144, 92, 145, 30, 139, 39, 140, 66, 146, 94, 147, 56, 144, 92, 145, 123, 154, 133, 155, 86, 148, 96, 149, 130, 156, 135, 119,
+    30, 139, 39, 140, 86, 148, 96, 149, 33, 141, 41, 142, 88, 150, 98, 151, 66, 146, 94, 147, 130, 156, 135, 119, 88, 150, 98, 151, 132, 157, 137, 77,
+    6, 37, 16, 38, 49, 92, 54, 93, 11, 39, 17, 40, 50, 94, 55, 95, 49, 92, 54, 93, 122, 133, 127, 134, 58, 96, 60, 97, 124, 135, 128, 136,
+    11, 39, 17, 40, 58, 96, 60, 97, 14, 41, 18, 42, 59, 98, 61, 99, 50, 94, 55, 95, 124, 135, 128, 136, 59, 98, 61, 99, 126, 137, 129, 61,
+    26, 139, 38, 141, 58, 145, 93, 152, 31, 140, 40, 142, 68, 147, 95, 101, 58, 145, 93, 152, 124, 155, 134, 158, 87, 149, 97, 153, 131, 119, 136, 72,
+    31, 140, 40, 142, 87, 149, 97, 153, 34, 142, 42, 143, 89, 151, 99, 42, 68, 147, 95, 101, 131, 119, 136, 72, 89, 151, 99, 42, 113, 77, 61, 18,
+    6, 26, 22, 28, 49, 58, 54, 60, 26, 33, 28, 35, 58, 70, 60, 72, 49, 58, 54, 60, 122, 124, 127, 128, 92, 96, 93, 97, 133, 135, 134, 136,
+    26, 33, 28, 35, 92, 96, 93, 97, 33, 81, 35, 82, 96, 100, 97, 101, 58, 70, 60, 72, 133, 135, 134, 136, 96, 100, 97, 101, 160, 162, 161, 95,
+    37, 139, 187, 188, 92, 145, 191, 192, 139, 189, 188, 190, 145, 193, 192, 153, 92, 145, 191, 192, 133, 155, 201, 161, 196, 198, 197, 199, 202, 168, 203, 97,
+    139, 189, 188, 190, 196, 198, 197, 199, 189, 194, 190, 195, 198, 200, 199, 142, 145, 193, 192, 153, 202, 168, 203, 97, 198, 200, 199, 142, 204, 150, 192, 40,
+    49, 92, 54, 93, 122, 133, 127, 134, 58, 96, 60, 97, 124, 135, 128, 136, 122, 133, 127, 134, 181, 183, 182, 184, 133, 160, 134, 161, 183, 185, 184, 128,
+    58, 96, 60, 97, 133, 160, 134, 161, 70, 100, 72, 101, 135, 162, 136, 95, 124, 135, 128, 136, 183, 185, 184, 128, 135, 162, 136, 95, 185, 186, 128, 55,
+    92, 196, 191, 197, 133, 202, 201, 203, 145, 198, 192, 199, 155, 168, 161, 97, 133, 202, 201, 203, 183, 175, 205, 134, 202, 204, 203, 192, 175, 112, 134, 60,
+    145, 198, 192, 199, 202, 204, 203, 192, 193, 200, 153, 142, 168, 150, 97, 40, 155, 168, 161, 97, 175, 112, 134, 60, 168, 150, 97, 40, 112, 75, 60, 17,
+    4, 25, 7, 27, 48, 57, 50, 59, 10, 31, 12, 32, 52, 67, 53, 69, 48, 57, 50, 59, 123, 125, 124, 126, 66, 88, 68, 89, 130, 132, 131, 113,
+    10, 31, 12, 32, 66, 88, 68, 89, 14, 35, 15, 36, 67, 90, 69, 91, 52, 67, 53, 69, 130, 132, 131, 113, 67, 90, 69, 91, 132, 159, 113, 85,
+    62, 144, 74, 146, 104, 164, 110, 165, 66, 145, 76, 147, 106, 165, 111, 116, 104, 164, 110, 165, 170, 176, 171, 177, 114, 166, 117, 167, 172, 178, 173, 108,
+    66, 145, 76, 147, 114, 166, 117, 167, 70, 152, 78, 101, 115, 168, 118, 89, 106, 165, 111, 116, 172, 178, 173, 108, 115, 168, 118, 89, 174, 156, 111, 65,
+    11, 39, 17, 40, 58, 96, 60, 97, 14, 41, 18, 42, 59, 98, 61, 99, 58, 96, 60, 97, 133, 160, 134, 161, 70, 100, 72, 101, 135, 162, 136, 95,
+    14, 41, 18, 42, 70, 100, 72, 101, 19, 43, 20, 44, 71, 102, 73, 36, 59, 98, 61, 99, 135, 162, 136, 95, 71, 102, 73, 36, 137, 163, 61, 29,
+    63, 148, 75, 150, 107, 166, 112, 168, 67, 149, 77, 151, 108, 167, 113, 89, 107, 166, 112, 168, 171, 179, 175, 155, 115, 169, 119, 147, 173, 117, 131, 68,
+    67, 149, 77, 151, 115, 169, 119, 147, 71, 153, 79, 42, 116, 147, 69, 32, 108, 167, 113, 89, 173, 117, 131, 68, 116, 147, 69, 32, 111, 76, 53, 12,
+    7, 27, 23, 29, 50, 59, 55, 61, 27, 34, 29, 36, 59, 71, 61, 73, 50, 59, 55, 61, 124, 126, 128, 129, 94, 98, 95, 99, 135, 137, 136, 61,
+    27, 34, 29, 36, 94, 98, 95, 99, 34, 82, 36, 83, 98, 102, 99, 36, 59, 71, 61, 73, 135, 137, 136, 61, 98, 102, 99, 36, 162, 163, 95, 29,
+    74, 146, 206, 163, 110, 165, 186, 137, 146, 193, 163, 102, 165, 207, 137, 71, 110, 165, 186, 137, 171, 177, 185, 126, 209, 210, 162, 98, 211, 165, 135, 59,
+    146, 193, 163, 102, 209, 210, 162, 98, 193, 208, 102, 82, 210, 193, 98, 34, 165, 207, 137, 71, 211, 165, 135, 59, 210, 193, 98, 34, 209, 146, 94, 27,
+    50, 94, 55, 95, 124, 135, 128, 136, 59, 98, 61, 99, 126, 137, 129, 61, 124, 135, 128, 136, 183, 185, 184, 128, 135, 162, 136, 95, 185, 186, 128, 55,
+    59, 98, 61, 99, 135, 162, 136, 95, 71, 102, 73, 36, 137, 163, 61, 29, 126, 137, 129, 61, 185, 186, 128, 55, 137, 163, 61, 29, 186, 206, 55, 23,
+    110, 209, 186, 162, 171, 211, 185, 135, 165, 210, 137, 98, 177, 165, 126, 59, 171, 211, 185, 135, 212, 171, 183, 124, 211, 209, 135, 94, 171, 110, 124, 50,
+    165, 210, 137, 98, 211, 209, 135, 94, 207, 193, 71, 34, 165, 146, 59, 27, 177, 165, 126, 59, 171, 110, 124, 50, 165, 146, 59, 27, 110, 74, 50, 7,
+    9, 30, 26, 33, 48, 66, 58, 70, 25, 39, 31, 41, 64, 76, 68, 78, 56, 86, 92, 96, 123, 130, 133, 135, 144, 148, 145, 149, 154, 156, 155, 119,
+    51, 86, 63, 88, 104, 114, 107, 115, 57, 96, 67, 98, 105, 117, 108, 118, 104, 114, 110, 117, 170, 172, 171, 173, 164, 166, 165, 167, 176, 178, 177, 108,
+    30, 139, 139, 189, 66, 146, 145, 193, 39, 188, 140, 190, 76, 163, 147, 102, 86, 148, 196, 198, 130, 156, 202, 168, 148, 214, 198, 215, 156, 159, 168, 90,
+    86, 196, 148, 198, 114, 209, 166, 210, 96, 197, 149, 199, 117, 162, 167, 98, 114, 209, 209, 169, 172, 174, 211, 115, 166, 204, 210, 149, 178, 132, 165, 67,
+    26, 139, 38, 141, 58, 145, 93, 152, 31, 140, 40, 142, 68, 147, 95, 101, 92, 196, 191, 197, 133, 202, 201, 203, 145, 198, 192, 199, 155, 168, 161, 97,
+    63, 148, 75, 150, 107, 166, 112, 168, 67, 149, 77, 151, 108, 167, 113, 89, 110, 209, 186, 162, 171, 211, 185, 135, 165, 210, 137, 98, 177, 165, 126, 59,
+    33, 189, 141, 194, 70, 193, 152, 208, 41, 190, 142, 195, 78, 102, 101, 82, 96, 198, 197, 216, 135, 168, 203, 152, 149, 215, 199, 190, 119, 90, 97, 35,
+    88, 198, 150, 200, 115, 210, 168, 193, 98, 199, 151, 142, 118, 98, 89, 34, 117, 169, 162, 100, 173, 115, 135, 70, 167, 149, 98, 41, 108, 67, 59, 14,
+    11, 31, 28, 35, 50, 68, 60, 72, 31, 41, 35, 43, 68, 78, 72, 80, 58, 87, 93, 97, 124, 131, 134, 136, 145, 149, 152, 153, 155, 119, 158, 72,
+    63, 88, 84, 90, 110, 117, 112, 119, 88, 100, 90, 102, 117, 120, 119, 78, 107, 115, 112, 119, 171, 173, 175, 131, 166, 169, 168, 147, 179, 117, 155, 68,
+    39, 140, 188, 190, 94, 147, 192, 153, 140, 190, 190, 213, 147, 102, 153, 43, 96, 149, 197, 199, 135, 119, 203, 97, 198, 215, 216, 190, 168, 90, 152, 35,
+    148, 198, 214, 215, 209, 169, 204, 149, 198, 216, 215, 190, 169, 100, 149, 41, 166, 210, 204, 149, 211, 115, 202, 87, 218, 198, 198, 140, 166, 88, 145, 31,
+    58, 145, 93, 152, 124, 155, 134, 158, 87, 149, 97, 153, 131, 119, 136, 72, 133, 202, 201, 203, 183, 175, 205, 134, 202, 204, 203, 192, 175, 112, 134, 60,
+    107, 166, 112, 168, 171, 179, 175, 155, 115, 169, 119, 147, 173, 117, 131, 68, 171, 211, 185, 135, 212, 171, 183, 124, 211, 209, 135, 94, 171, 110, 124, 50,
+    96, 198, 197, 216, 135, 168, 203, 152, 149, 215, 199, 190, 119, 90, 97, 35, 160, 204, 219, 197, 185, 112, 201, 93, 204, 214, 197, 188, 112, 84, 93, 28,
+    166, 218, 204, 198, 211, 166, 202, 145, 210, 198, 149, 140, 115, 88, 87, 31, 179, 166, 160, 96, 171, 107, 133, 58, 166, 148, 96, 39, 107, 63, 58, 11,
+    10, 31, 27, 34, 52, 67, 59, 71, 27, 40, 32, 42, 65, 77, 69, 79, 66, 88, 94, 98, 130, 132, 135, 137, 146, 150, 147, 151, 156, 157, 119, 77,
+    52, 87, 65, 89, 106, 115, 108, 116, 59, 97, 69, 99, 108, 119, 109, 69, 106, 115, 111, 118, 172, 174, 173, 111, 165, 168, 116, 89, 178, 156, 108, 65,
+    66, 145, 146, 193, 106, 165, 165, 207, 94, 192, 147, 153, 111, 137, 116, 71, 114, 166, 209, 210, 172, 178, 211, 165, 209, 204, 169, 149, 174, 132, 115, 67,
+    130, 202, 156, 168, 172, 211, 178, 165, 135, 203, 119, 97, 173, 135, 108, 59, 172, 211, 174, 115, 217, 172, 172, 106, 211, 202, 115, 87, 172, 130, 106, 52,
+    31, 140, 40, 142, 87, 149, 97, 153, 34, 142, 42, 143, 89, 151, 99, 42, 145, 198, 192, 199, 202, 204, 203, 192, 193, 200, 153, 142, 168, 150, 97, 40,
+    67, 149, 77, 151, 115, 169, 119, 147, 71, 153, 79, 42, 116, 147, 69, 32, 165, 210, 137, 98, 211, 209, 135, 94, 207, 193, 71, 34, 165, 146, 59, 27,
+    88, 198, 150, 200, 115, 210, 168, 193, 98, 199, 151, 142, 118, 98, 89, 34, 166, 218, 204, 198, 211, 166, 202, 145, 210, 198, 149, 140, 115, 88, 87, 31,
+    132, 204, 157, 150, 174, 209, 156, 146, 137, 192, 77, 40, 111, 94, 65, 27, 178, 166, 132, 88, 172, 114, 130, 66, 165, 145, 67, 31, 106, 66, 52, 10,
+    12, 32, 29, 36, 53, 69, 61, 73, 32, 42, 36, 44, 69, 79, 73, 20, 68, 89, 95, 99, 131, 113, 136, 61, 147, 151, 101, 42, 119, 77, 72, 18,
+    65, 89, 85, 91, 111, 118, 113, 69, 89, 101, 91, 36, 118, 78, 69, 15, 108, 116, 113, 69, 173, 111, 131, 53, 167, 147, 89, 32, 117, 76, 68, 12,
+    76, 147, 163, 102, 111, 116, 137, 71, 147, 153, 102, 43, 116, 71, 71, 19, 117, 167, 162, 98, 173, 108, 135, 59, 169, 149, 100, 41, 115, 67, 70, 14,
+    156, 168, 159, 90, 174, 115, 132, 67, 168, 152, 90, 35, 115, 70, 67, 14, 178, 165, 132, 67, 172, 106, 130, 52, 166, 145, 88, 31, 114, 66, 66, 10,
+    68, 147, 95, 101, 131, 119, 136, 72, 89, 151, 99, 42, 113, 77, 61, 18, 155, 168, 161, 97, 175, 112, 134, 60, 168, 150, 97, 40, 112, 75, 60, 17,
+    108, 167, 113, 89, 173, 117, 131, 68, 116, 147, 69, 32, 111, 76, 53, 12, 177, 165, 126, 59, 171, 110, 124, 50, 165, 146, 59, 27, 110, 74, 50, 7,
+    117, 169, 162, 100, 173, 115, 135, 70, 167, 149, 98, 41, 108, 67, 59, 14, 179, 166, 160, 96, 171, 107, 133, 58, 166, 148, 96, 39, 107, 63, 58, 11,
+    178, 166, 132, 88, 172, 114, 130, 66, 165, 145, 67, 31, 106, 66, 52, 10, 176, 164, 125, 57, 170, 104, 123, 48, 164, 144, 57, 25, 104, 62, 48, 4,
+    2, 9, 9, 13, 46, 51, 56, 57, 46, 56, 51, 57, 103, 104, 104, 105, 4, 10, 11, 14, 48, 52, 58, 59, 62, 66, 63, 67, 104, 106, 107, 108,
+    4, 11, 10, 14, 62, 63, 66, 67, 48, 58, 52, 59, 104, 107, 106, 108, 5, 12, 12, 15, 64, 65, 68, 69, 64, 68, 65, 69, 105, 108, 108, 109,
+    9, 26, 30, 33, 51, 63, 86, 88, 56, 92, 86, 96, 104, 110, 114, 117, 10, 27, 31, 34, 52, 65, 87, 89, 66, 94, 88, 98, 106, 111, 115, 118,
+    11, 28, 31, 35, 63, 84, 88, 90, 58, 93, 87, 97, 107, 112, 115, 119, 12, 29, 32, 36, 65, 85, 89, 91, 68, 95, 89, 99, 108, 113, 116, 69,
+    9, 30, 26, 33, 56, 86, 92, 96, 51, 86, 63, 88, 104, 114, 110, 117, 11, 31, 28, 35, 58, 87, 93, 97, 63, 88, 84, 90, 107, 115, 112, 119,
+    10, 31, 27, 34, 66, 88, 94, 98, 52, 87, 65, 89, 106, 115, 111, 118, 12, 32, 29, 36, 68, 89, 95, 99, 65, 89, 85, 91, 108, 116, 113, 69,
+    13, 33, 33, 81, 57, 88, 96, 100, 57, 96, 88, 100, 105, 117, 117, 120, 14, 34, 35, 82, 59, 89, 97, 101, 67, 98, 90, 102, 108, 118, 119, 78,
+    14, 35, 34, 82, 67, 90, 98, 102, 59, 97, 89, 101, 108, 119, 118, 78, 15, 36, 36, 83, 69, 91, 99, 36, 69, 99, 91, 36, 109, 69, 69, 15,
+    4, 10, 11, 14, 48, 52, 58, 59, 62, 66, 63, 67, 104, 106, 107, 108, 7, 12, 17, 18, 50, 53, 60, 61, 74, 76, 75, 77, 110, 111, 112, 113,
+    10, 14, 14, 19, 66, 67, 70, 71, 66, 70, 67, 71, 114, 115, 115, 116, 12, 15, 18, 20, 68, 69, 72, 73, 76, 78, 77, 79, 117, 118, 119, 69,
+    25, 31, 39, 41, 57, 67, 96, 98, 144, 145, 148, 149, 164, 165, 166, 167, 27, 32, 40, 42, 59, 69, 97, 99, 146, 147, 150, 151, 165, 116, 168, 89,
+    31, 35, 41, 43, 88, 90, 100, 102, 145, 152, 149, 153, 166, 168, 169, 147, 32, 36, 42, 44, 89, 91, 101, 36, 147, 101, 151, 42, 167, 89, 147, 32,
+    48, 66, 58, 70, 123, 130, 133, 135, 104, 114, 107, 115, 170, 172, 171, 173, 50, 68, 60, 72, 124, 131, 134, 136, 110, 117, 112, 119, 171, 173, 175, 131,
+    52, 67, 59, 71, 130, 132, 135, 137, 106, 115, 108, 116, 172, 174, 173, 111, 53, 69, 61, 73, 131, 113, 136, 61, 111, 118, 113, 69, 173, 111, 131, 53,
+    57, 88, 96, 100, 125, 132, 160, 162, 164, 166, 166, 169, 176, 178, 179, 117, 59, 89, 97, 101, 126, 113, 161, 95, 165, 167, 168, 147, 177, 108, 155, 68,
+    67, 90, 98, 102, 132, 159, 162, 163, 165, 168, 167, 147, 178, 156, 117, 76, 69, 91, 99, 36, 113, 85, 95, 29, 116, 89, 89, 32, 108, 65, 68, 12,
+    4, 11, 10, 14, 62, 63, 66, 67, 48, 58, 52, 59, 104, 107, 106, 108, 10, 14, 14, 19, 66, 67, 70, 71, 66, 70, 67, 71, 114, 115, 115, 116,
+    7, 17, 12, 18, 74, 75, 76, 77, 50, 60, 53, 61, 110, 112, 111, 113, 12, 18, 15, 20, 76, 77, 78, 79, 68, 72, 69, 73, 117, 119, 118, 69,
+    48, 58, 66, 70, 104, 107, 114, 115, 123, 133, 130, 135, 170, 171, 172, 173, 52, 59, 67, 71, 106, 108, 115, 116, 130, 135, 132, 137, 172, 173, 174, 111,
+    50, 60, 68, 72, 110, 112, 117, 119, 124, 134, 131, 136, 171, 175, 173, 131, 53, 61, 69, 73, 111, 113, 118, 69, 131, 136, 113, 61, 173, 131, 111, 53,
+    25, 39, 31, 41, 144, 148, 145, 149, 57, 96, 67, 98, 164, 166, 165, 167, 31, 41, 35, 43, 145, 149, 152, 153, 88, 100, 90, 102, 166, 169, 168, 147,
+    27, 40, 32, 42, 146, 150, 147, 151, 59, 97, 69, 99, 165, 168, 116, 89, 32, 42, 36, 44, 147, 151, 101, 42, 89, 101, 91, 36, 167, 147, 89, 32,
+    57, 96, 88, 100, 164, 166, 166, 169, 125, 160, 132, 162, 176, 179, 178, 117, 67, 98, 90, 102, 165, 167, 168, 147, 132, 162, 159, 163, 178, 117, 156, 76,
+    59, 97, 89, 101, 165, 168, 167, 147, 126, 161, 113, 95, 177, 155, 108, 68, 69, 99, 91, 36, 116, 89, 89, 32, 113, 95, 85, 29, 108, 68, 65, 12,
+    5, 12, 12, 15, 64, 65, 68, 69, 64, 68, 65, 69, 105, 108, 108, 109, 12, 15, 18, 20, 68, 69, 72, 73, 76, 78, 77, 79, 117, 118, 119, 69,
+    12, 18, 15, 20, 76, 77, 78, 79, 68, 72, 69, 73, 117, 119, 118, 69, 15, 20, 20, 21, 78, 79, 80, 20, 78, 80, 79, 20, 120, 78, 78, 15,
+    64, 68, 76, 78, 105, 108, 117, 118, 154, 155, 156, 119, 176, 177, 178, 108, 65, 69, 77, 79, 108, 109, 119, 69, 156, 119, 157, 77, 178, 108, 156, 65,
+    68, 72, 78, 80, 117, 119, 120, 78, 155, 158, 119, 72, 179, 155, 117, 68, 69, 73, 79, 20, 118, 69, 78, 15, 119, 72, 77, 18, 117, 68, 76, 12,
+    64, 76, 68, 78, 154, 156, 155, 119, 105, 117, 108, 118, 176, 178, 177, 108, 68, 78, 72, 80, 155, 119, 158, 72, 117, 120, 119, 78, 179, 117, 155, 68,
+    65, 77, 69, 79, 156, 157, 119, 77, 108, 119, 109, 69, 178, 156, 108, 65, 69, 79, 73, 20, 119, 77, 72, 18, 118, 78, 69, 15, 117, 76, 68, 12,
+    105, 117, 117, 120, 176, 178, 179, 117, 176, 179, 178, 117, 180, 176, 176, 105, 108, 118, 119, 78, 177, 108, 155, 68, 178, 117, 156, 76, 176, 105, 154, 64,
+    108, 119, 118, 78, 178, 156, 117, 76, 177, 155, 108, 68, 176, 154, 105, 64, 109, 69, 69, 15, 108, 65, 68, 12, 108, 68, 65, 12, 105, 64, 64, 5,
+    9, 26, 30, 33, 51, 63, 86, 88, 56, 92, 86, 96, 104, 110, 114, 117, 25, 31, 39, 41, 57, 67, 96, 98, 144, 145, 148, 149, 164, 165, 166, 167,
+    48, 58, 66, 70, 104, 107, 114, 115, 123, 133, 130, 135, 170, 171, 172, 173, 64, 68, 76, 78, 105, 108, 117, 118, 154, 155, 156, 119, 176, 177, 178, 108,
+    26, 38, 139, 141, 63, 75, 148, 150, 92, 191, 196, 197, 110, 186, 209, 162, 31, 40, 140, 142, 67, 77, 149, 151, 145, 192, 198, 199, 165, 137, 210, 98,
+    58, 93, 145, 152, 107, 112, 166, 168, 133, 201, 202, 203, 171, 185, 211, 135, 68, 95, 147, 101, 108, 113, 167, 89, 155, 161, 168, 97, 177, 126, 165, 59,
+    30, 139, 139, 189, 86, 148, 196, 198, 86, 196, 148, 198, 114, 209, 209, 169, 39, 140, 188, 190, 96, 149, 197, 199, 148, 198, 214, 215, 166, 210, 204, 149,
+    66, 145, 146, 193, 114, 166, 209, 210, 130, 202, 156, 168, 172, 211, 174, 115, 76, 147, 163, 102, 117, 167, 162, 98, 156, 168, 159, 90, 178, 165, 132, 67,
+    33, 141, 189, 194, 88, 150, 198, 200, 96, 197, 198, 216, 117, 162, 169, 100, 41, 142, 190, 195, 98, 151, 199, 142, 149, 199, 215, 190, 167, 98, 149, 41,
+    70, 152, 193, 208, 115, 168, 210, 193, 135, 203, 168, 152, 173, 135, 115, 70, 78, 101, 102, 82, 118, 89, 98, 34, 119, 97, 90, 35, 108, 59, 67, 14,
+    10, 27, 31, 34, 52, 65, 87, 89, 66, 94, 88, 98, 106, 111, 115, 118, 27, 32, 40, 42, 59, 69, 97, 99, 146, 147, 150, 151, 165, 116, 168, 89,
+    52, 59, 67, 71, 106, 108, 115, 116, 130, 135, 132, 137, 172, 173, 174, 111, 65, 69, 77, 79, 108, 109, 119, 69, 156, 119, 157, 77, 178, 108, 156, 65,
+    31, 40, 140, 142, 67, 77, 149, 151, 145, 192, 198, 199, 165, 137, 210, 98, 34, 42, 142, 143, 71, 79, 153, 42, 193, 153, 200, 142, 207, 71, 193, 34,
+    87, 97, 149, 153, 115, 119, 169, 147, 202, 203, 204, 192, 211, 135, 209, 94, 89, 99, 151, 42, 116, 69, 147, 32, 168, 97, 150, 40, 165, 59, 146, 27,
+    66, 146, 145, 193, 130, 156, 202, 168, 114, 209, 166, 210, 172, 174, 211, 115, 94, 147, 192, 153, 135, 119, 203, 97, 209, 169, 204, 149, 211, 115, 202, 87,
+    106, 165, 165, 207, 172, 178, 211, 165, 172, 211, 178, 165, 217, 172, 172, 106, 111, 116, 137, 71, 173, 108, 135, 59, 174, 115, 132, 67, 172, 106, 130, 52,
+    88, 150, 198, 200, 132, 157, 204, 150, 166, 204, 218, 198, 178, 132, 166, 88, 98, 151, 199, 142, 137, 77, 192, 40, 210, 149, 198, 140, 165, 67, 145, 31,
+    115, 168, 210, 193, 174, 156, 209, 146, 211, 202, 166, 145, 172, 130, 114, 66, 118, 89, 98, 34, 111, 65, 94, 27, 115, 87, 88, 31, 106, 52, 66, 10,
+    11, 28, 31, 35, 63, 84, 88, 90, 58, 93, 87, 97, 107, 112, 115, 119, 31, 35, 41, 43, 88, 90, 100, 102, 145, 152, 149, 153, 166, 168, 169, 147,
+    50, 60, 68, 72, 110, 112, 117, 119, 124, 134, 131, 136, 171, 175, 173, 131, 68, 72, 78, 80, 117, 119, 120, 78, 155, 158, 119, 72, 179, 155, 117, 68,
+    58, 93, 145, 152, 107, 112, 166, 168, 133, 201, 202, 203, 171, 185, 211, 135, 87, 97, 149, 153, 115, 119, 169, 147, 202, 203, 204, 192, 211, 135, 209, 94,
+    124, 134, 155, 158, 171, 175, 179, 155, 183, 205, 175, 134, 212, 183, 171, 124, 131, 136, 119, 72, 173, 131, 117, 68, 175, 134, 112, 60, 171, 124, 110, 50,
+    39, 188, 140, 190, 148, 214, 198, 215, 96, 197, 149, 199, 166, 204, 210, 149, 140, 190, 190, 213, 198, 215, 216, 190, 198, 216, 215, 190, 218, 198, 198, 140,
+    94, 192, 147, 153, 209, 204, 169, 149, 135, 203, 119, 97, 211, 202, 115, 87, 147, 153, 102, 43, 169, 149, 100, 41, 168, 152, 90, 35, 166, 145, 88, 31,
+    96, 197, 198, 216, 166, 204, 218, 198, 160, 219, 204, 197, 179, 160, 166, 96, 149, 199, 215, 190, 210, 149, 198, 140, 204, 197, 214, 188, 166, 96, 148, 39,
+    135, 203, 168, 152, 211, 202, 166, 145, 185, 201, 112, 93, 171, 133, 107, 58, 119, 97, 90, 35, 115, 87, 88, 31, 112, 93, 84, 28, 107, 58, 63, 11,
+    12, 29, 32, 36, 65, 85, 89, 91, 68, 95, 89, 99, 108, 113, 116, 69, 32, 36, 42, 44, 89, 91, 101, 36, 147, 101, 151, 42, 167, 89, 147, 32,
+    53, 61, 69, 73, 111, 113, 118, 69, 131, 136, 113, 61, 173, 131, 111, 53, 69, 73, 79, 20, 118, 69, 78, 15, 119, 72, 77, 18, 117, 68, 76, 12,
+    68, 95, 147, 101, 108, 113, 167, 89, 155, 161, 168, 97, 177, 126, 165, 59, 89, 99, 151, 42, 116, 69, 147, 32, 168, 97, 150, 40, 165, 59, 146, 27,
+    131, 136, 119, 72, 173, 131, 117, 68, 175, 134, 112, 60, 171, 124, 110, 50, 113, 61, 77, 18, 111, 53, 76, 12, 112, 60, 75, 17, 110, 50, 74, 7,
+    76, 163, 147, 102, 156, 159, 168, 90, 117, 162, 167, 98, 178, 132, 165, 67, 147, 102, 153, 43, 168, 90, 152, 35, 169, 100, 149, 41, 166, 88, 145, 31,
+    111, 137, 116, 71, 174, 132, 115, 67, 173, 135, 108, 59, 172, 130, 106, 52, 116, 71, 71, 19, 115, 67, 70, 14, 115, 70, 67, 14, 114, 66, 66, 10,
+    117, 162, 169, 100, 178, 132, 166, 88, 179, 160, 166, 96, 176, 125, 164, 57, 167, 98, 149, 41, 165, 67, 145, 31, 166, 96, 148, 39, 164, 57, 144, 25,
+    173, 135, 115, 70, 172, 130, 114, 66, 171, 133, 107, 58, 170, 123, 104, 48, 108, 59, 67, 14, 106, 52, 66, 10, 107, 58, 63, 11, 104, 48, 62, 4,
+    9, 30, 26, 33, 56, 86, 92, 96, 51, 86, 63, 88, 104, 114, 110, 117, 48, 66, 58, 70, 123, 130, 133, 135, 104, 114, 107, 115, 170, 172, 171, 173,
+    25, 39, 31, 41, 144, 148, 145, 149, 57, 96, 67, 98, 164, 166, 165, 167, 64, 76, 68, 78, 154, 156, 155, 119, 105, 117, 108, 118, 176, 178, 177, 108,
+    30, 139, 139, 189, 86, 148, 196, 198, 86, 196, 148, 198, 114, 209, 209, 169, 66, 146, 145, 193, 130, 156, 202, 168, 114, 209, 166, 210, 172, 174, 211, 115,
+    39, 188, 140, 190, 148, 214, 198, 215, 96, 197, 149, 199, 166, 204, 210, 149, 76, 163, 147, 102, 156, 159, 168, 90, 117, 162, 167, 98, 178, 132, 165, 67,
+    26, 139, 38, 141, 92, 196, 191, 197, 63, 148, 75, 150, 110, 209, 186, 162, 58, 145, 93, 152, 133, 202, 201, 203, 107, 166, 112, 168, 171, 211, 185, 135,
+    31, 140, 40, 142, 145, 198, 192, 199, 67, 149, 77, 151, 165, 210, 137, 98, 68, 147, 95, 101, 155, 168, 161, 97, 108, 167, 113, 89, 177, 165, 126, 59,
+    33, 189, 141, 194, 96, 198, 197, 216, 88, 198, 150, 200, 117, 169, 162, 100, 70, 193, 152, 208, 135, 168, 203, 152, 115, 210, 168, 193, 173, 115, 135, 70,
+    41, 190, 142, 195, 149, 215, 199, 190, 98, 199, 151, 142, 167, 149, 98, 41, 78, 102, 101, 82, 119, 90, 97, 35, 118, 98, 89, 34, 108, 67, 59, 14,
+    11, 31, 28, 35, 58, 87, 93, 97, 63, 88, 84, 90, 107, 115, 112, 119, 50, 68, 60, 72, 124, 131, 134, 136, 110, 117, 112, 119, 171, 173, 175, 131,
+    31, 41, 35, 43, 145, 149, 152, 153, 88, 100, 90, 102, 166, 169, 168, 147, 68, 78, 72, 80, 155, 119, 158, 72, 117, 120, 119, 78, 179, 117, 155, 68,
+    39, 140, 188, 190, 96, 149, 197, 199, 148, 198, 214, 215, 166, 210, 204, 149, 94, 147, 192, 153, 135, 119, 203, 97, 209, 169, 204, 149, 211, 115, 202, 87,
+    140, 190, 190, 213, 198, 215, 216, 190, 198, 216, 215, 190, 218, 198, 198, 140, 147, 102, 153, 43, 168, 90, 152, 35, 169, 100, 149, 41, 166, 88, 145, 31,
+    58, 145, 93, 152, 133, 202, 201, 203, 107, 166, 112, 168, 171, 211, 185, 135, 124, 155, 134, 158, 183, 175, 205, 134, 171, 179, 175, 155, 212, 171, 183, 124,
+    87, 149, 97, 153, 202, 204, 203, 192, 115, 169, 119, 147, 211, 209, 135, 94, 131, 119, 136, 72, 175, 112, 134, 60, 173, 117, 131, 68, 171, 110, 124, 50,
+    96, 198, 197, 216, 160, 204, 219, 197, 166, 218, 204, 198, 179, 166, 160, 96, 135, 168, 203, 152, 185, 112, 201, 93, 211, 166, 202, 145, 171, 107, 133, 58,
+    149, 215, 199, 190, 204, 214, 197, 188, 210, 198, 149, 140, 166, 148, 96, 39, 119, 90, 97, 35, 112, 84, 93, 28, 115, 88, 87, 31, 107, 63, 58, 11,
+    10, 31, 27, 34, 66, 88, 94, 98, 52, 87, 65, 89, 106, 115, 111, 118, 52, 67, 59, 71, 130, 132, 135, 137, 106, 115, 108, 116, 172, 174, 173, 111,
+    27, 40, 32, 42, 146, 150, 147, 151, 59, 97, 69, 99, 165, 168, 116, 89, 65, 77, 69, 79, 156, 157, 119, 77, 108, 119, 109, 69, 178, 156, 108, 65,
+    66, 145, 146, 193, 114, 166, 209, 210, 130, 202, 156, 168, 172, 211, 174, 115, 106, 165, 165, 207, 172, 178, 211, 165, 172, 211, 178, 165, 217, 172, 172, 106,
+    94, 192, 147, 153, 209, 204, 169, 149, 135, 203, 119, 97, 211, 202, 115, 87, 111, 137, 116, 71, 174, 132, 115, 67, 173, 135, 108, 59, 172, 130, 106, 52,
+    31, 140, 40, 142, 145, 198, 192, 199, 67, 149, 77, 151, 165, 210, 137, 98, 87, 149, 97, 153, 202, 204, 203, 192, 115, 169, 119, 147, 211, 209, 135, 94,
+    34, 142, 42, 143, 193, 200, 153, 142, 71, 153, 79, 42, 207, 193, 71, 34, 89, 151, 99, 42, 168, 150, 97, 40, 116, 147, 69, 32, 165, 146, 59, 27,
+    88, 198, 150, 200, 166, 218, 204, 198, 132, 204, 157, 150, 178, 166, 132, 88, 115, 210, 168, 193, 211, 166, 202, 145, 174, 209, 156, 146, 172, 114, 130, 66,
+    98, 199, 151, 142, 210, 198, 149, 140, 137, 192, 77, 40, 165, 145, 67, 31, 118, 98, 89, 34, 115, 88, 87, 31, 111, 94, 65, 27, 106, 66, 52, 10,
+    12, 32, 29, 36, 68, 89, 95, 99, 65, 89, 85, 91, 108, 116, 113, 69, 53, 69, 61, 73, 131, 113, 136, 61, 111, 118, 113, 69, 173, 111, 131, 53,
+    32, 42, 36, 44, 147, 151, 101, 42, 89, 101, 91, 36, 167, 147, 89, 32, 69, 79, 73, 20, 119, 77, 72, 18, 118, 78, 69, 15, 117, 76, 68, 12,
+    76, 147, 163, 102, 117, 167, 162, 98, 156, 168, 159, 90, 178, 165, 132, 67, 111, 116, 137, 71, 173, 108, 135, 59, 174, 115, 132, 67, 172, 106, 130, 52,
+    147, 153, 102, 43, 169, 149, 100, 41, 168, 152, 90, 35, 166, 145, 88, 31, 116, 71, 71, 19, 115, 67, 70, 14, 115, 70, 67, 14, 114, 66, 66, 10,
+    68, 147, 95, 101, 155, 168, 161, 97, 108, 167, 113, 89, 177, 165, 126, 59, 131, 119, 136, 72, 175, 112, 134, 60, 173, 117, 131, 68, 171, 110, 124, 50,
+    89, 151, 99, 42, 168, 150, 97, 40, 116, 147, 69, 32, 165, 146, 59, 27, 113, 77, 61, 18, 112, 75, 60, 17, 111, 76, 53, 12, 110, 74, 50, 7,
+    117, 169, 162, 100, 179, 166, 160, 96, 178, 166, 132, 88, 176, 164, 125, 57, 173, 115, 135, 70, 171, 107, 133, 58, 172, 114, 130, 66, 170, 104, 123, 48,
+    167, 149, 98, 41, 166, 148, 96, 39, 165, 145, 67, 31, 164, 144, 57, 25, 108, 67, 59, 14, 107, 63, 58, 11, 106, 66, 52, 10, 104, 62, 48, 4,
+    13, 33, 33, 81, 57, 88, 96, 100, 57, 96, 88, 100, 105, 117, 117, 120, 57, 88, 96, 100, 125, 132, 160, 162, 164, 166, 166, 169, 176, 178, 179, 117,
+    57, 96, 88, 100, 164, 166, 166, 169, 125, 160, 132, 162, 176, 179, 178, 117, 105, 117, 117, 120, 176, 178, 179, 117, 176, 179, 178, 117, 180, 176, 176, 105,
+    33, 141, 189, 194, 88, 150, 198, 200, 96, 197, 198, 216, 117, 162, 169, 100, 88, 150, 198, 200, 132, 157, 204, 150, 166, 204, 218, 198, 178, 132, 166, 88,
+    96, 197, 198, 216, 166, 204, 218, 198, 160, 219, 204, 197, 179, 160, 166, 96, 117, 162, 169, 100, 178, 132, 166, 88, 179, 160, 166, 96, 176, 125, 164, 57,
+    33, 189, 141, 194, 96, 198, 197, 216, 88, 198, 150, 200, 117, 169, 162, 100, 96, 198, 197, 216, 160, 204, 219, 197, 166, 218, 204, 198, 179, 166, 160, 96,
+    88, 198, 150, 200, 166, 218, 204, 198, 132, 204, 157, 150, 178, 166, 132, 88, 117, 169, 162, 100, 179, 166, 160, 96, 178, 166, 132, 88, 176, 164, 125, 57,
+    81, 194, 194, 220, 100, 200, 216, 194, 100, 216, 200, 194, 120, 100, 100, 81, 100, 200, 216, 194, 162, 150, 197, 141, 169, 198, 198, 189, 117, 88, 96, 33,
+    100, 216, 200, 194, 169, 198, 198, 189, 162, 197, 150, 141, 117, 96, 88, 33, 120, 100, 100, 81, 117, 88, 96, 33, 117, 96, 88, 33, 105, 57, 57, 13,
+    14, 34, 35, 82, 59, 89, 97, 101, 67, 98, 90, 102, 108, 118, 119, 78, 59, 89, 97, 101, 126, 113, 161, 95, 165, 167, 168, 147, 177, 108, 155, 68,
+    67, 98, 90, 102, 165, 167, 168, 147, 132, 162, 159, 163, 178, 117, 156, 76, 108, 118, 119, 78, 177, 108, 155, 68, 178, 117, 156, 76, 176, 105, 154, 64,
+    41, 142, 190, 195, 98, 151, 199, 142, 149, 199, 215, 190, 167, 98, 149, 41, 98, 151, 199, 142, 137, 77, 192, 40, 210, 149, 198, 140, 165, 67, 145, 31,
+    149, 199, 215, 190, 210, 149, 198, 140, 204, 197, 214, 188, 166, 96, 148, 39, 167, 98, 149, 41, 165, 67, 145, 31, 166, 96, 148, 39, 164, 57, 144, 25,
+    70, 193, 152, 208, 135, 168, 203, 152, 115, 210, 168, 193, 173, 115, 135, 70, 135, 168, 203, 152, 185, 112, 201, 93, 211, 166, 202, 145, 171, 107, 133, 58,
+    115, 210, 168, 193, 211, 166, 202, 145, 174, 209, 156, 146, 172, 114, 130, 66, 173, 115, 135, 70, 171, 107, 133, 58, 172, 114, 130, 66, 170, 104, 123, 48,
+    100, 200, 216, 194, 162, 150, 197, 141, 169, 198, 198, 189, 117, 88, 96, 33, 162, 150, 197, 141, 186, 75, 191, 38, 209, 148, 196, 139, 110, 63, 92, 26,
+    169, 198, 198, 189, 209, 148, 196, 139, 209, 196, 148, 139, 114, 86, 86, 30, 117, 88, 96, 33, 110, 63, 92, 26, 114, 86, 86, 30, 104, 51, 56, 9,
+    14, 35, 34, 82, 67, 90, 98, 102, 59, 97, 89, 101, 108, 119, 118, 78, 67, 90, 98, 102, 132, 159, 162, 163, 165, 168, 167, 147, 178, 156, 117, 76,
+    59, 97, 89, 101, 165, 168, 167, 147, 126, 161, 113, 95, 177, 155, 108, 68, 108, 119, 118, 78, 178, 156, 117, 76, 177, 155, 108, 68, 176, 154, 105, 64,
+    70, 152, 193, 208, 115, 168, 210, 193, 135, 203, 168, 152, 173, 135, 115, 70, 115, 168, 210, 193, 174, 156, 209, 146, 211, 202, 166, 145, 172, 130, 114, 66,
+    135, 203, 168, 152, 211, 202, 166, 145, 185, 201, 112, 93, 171, 133, 107, 58, 173, 135, 115, 70, 172, 130, 114, 66, 171, 133, 107, 58, 170, 123, 104, 48,
+    41, 190, 142, 195, 149, 215, 199, 190, 98, 199, 151, 142, 167, 149, 98, 41, 149, 215, 199, 190, 204, 214, 197, 188, 210, 198, 149, 140, 166, 148, 96, 39,
+    98, 199, 151, 142, 210, 198, 149, 140, 137, 192, 77, 40, 165, 145, 67, 31, 167, 149, 98, 41, 166, 148, 96, 39, 165, 145, 67, 31, 164, 144, 57, 25,
+    100, 216, 200, 194, 169, 198, 198, 189, 162, 197, 150, 141, 117, 96, 88, 33, 169, 198, 198, 189, 209, 148, 196, 139, 209, 196, 148, 139, 114, 86, 86, 30,
+    162, 197, 150, 141, 209, 196, 148, 139, 186, 191, 75, 38, 110, 92, 63, 26, 117, 96, 88, 33, 114, 86, 86, 30, 110, 92, 63, 26, 104, 56, 51, 9,
+    15, 36, 36, 83, 69, 91, 99, 36, 69, 99, 91, 36, 109, 69, 69, 15, 69, 91, 99, 36, 113, 85, 95, 29, 116, 89, 89, 32, 108, 65, 68, 12,
+    69, 99, 91, 36, 116, 89, 89, 32, 113, 95, 85, 29, 108, 68, 65, 12, 109, 69, 69, 15, 108, 65, 68, 12, 108, 68, 65, 12, 105, 64, 64, 5,
+    78, 101, 102, 82, 118, 89, 98, 34, 119, 97, 90, 35, 108, 59, 67, 14, 118, 89, 98, 34, 111, 65, 94, 27, 115, 87, 88, 31, 106, 52, 66, 10,
+    119, 97, 90, 35, 115, 87, 88, 31, 112, 93, 84, 28, 107, 58, 63, 11, 108, 59, 67, 14, 106, 52, 66, 10, 107, 58, 63, 11, 104, 48, 62, 4,
+    78, 102, 101, 82, 119, 90, 97, 35, 118, 98, 89, 34, 108, 67, 59, 14, 119, 90, 97, 35, 112, 84, 93, 28, 115, 88, 87, 31, 107, 63, 58, 11,
+    118, 98, 89, 34, 115, 88, 87, 31, 111, 94, 65, 27, 106, 66, 52, 10, 108, 67, 59, 14, 107, 63, 58, 11, 106, 66, 52, 10, 104, 62, 48, 4,
+    120, 100, 100, 81, 117, 88, 96, 33, 117, 96, 88, 33, 105, 57, 57, 13, 117, 88, 96, 33, 110, 63, 92, 26, 114, 86, 86, 30, 104, 51, 56, 9,
+    117, 96, 88, 33, 114, 86, 86, 30, 110, 92, 63, 26, 104, 56, 51, 9, 105, 57, 57, 13, 104, 51, 56, 9, 104, 56, 51, 9, 103, 46, 46, 2,
+    1, 8, 45, 46, 3, 9, 47, 48, 8, 24, 46, 62, 9, 25, 48, 64, 3, 9, 47, 48, 6, 11, 49, 50, 24, 30, 56, 66, 26, 31, 58, 68,
+    8, 24, 46, 62, 24, 30, 56, 66, 24, 37, 62, 74, 30, 39, 66, 76, 9, 25, 48, 64, 26, 31, 58, 68, 30, 39, 66, 76, 33, 41, 70, 78,
+    2, 9, 46, 51, 4, 10, 48, 52, 9, 26, 51, 63, 10, 27, 52, 65, 4, 10, 48, 52, 7, 12, 50, 53, 25, 31, 57, 67, 27, 32, 59, 69,
+    9, 26, 51, 63, 25, 31, 57, 67, 26, 38, 63, 75, 31, 40, 67, 77, 10, 27, 52, 65, 27, 32, 59, 69, 31, 40, 67, 77, 34, 42, 71, 79,
+    3, 24, 47, 56, 6, 26, 49, 58, 9, 30, 48, 66, 11, 31, 50, 68, 6, 26, 49, 58, 22, 28, 54, 60, 26, 33, 58, 70, 28, 35, 60, 72,
+    9, 30, 48, 66, 26, 33, 58, 70, 25, 39, 64, 76, 31, 41, 68, 78, 11, 31, 50, 68, 28, 35, 60, 72, 31, 41, 68, 78, 35, 43, 72, 80,
+    4, 25, 48, 57, 7, 27, 50, 59, 10, 31, 52, 67, 12, 32, 53, 69, 7, 27, 50, 59, 23, 29, 55, 61, 27, 34, 59, 71, 29, 36, 61, 73,
+    10, 31, 52, 67, 27, 34, 59, 71, 27, 40, 65, 77, 32, 42, 69, 79, 12, 32, 53, 69, 29, 36, 61, 73, 32, 42, 69, 79, 36, 44, 73, 20,
+    3, 9, 47, 48, 6, 11, 49, 50, 24, 30, 56, 66, 26, 31, 58, 68, 6, 11, 49, 50, 16, 17, 54, 55, 37, 39, 92, 94, 38, 40, 93, 95,
+    24, 30, 56, 66, 37, 39, 92, 94, 138, 139, 144, 146, 139, 140, 145, 147, 26, 31, 58, 68, 38, 40, 93, 95, 139, 140, 145, 147, 141, 142, 152, 101,
+    9, 13, 56, 57, 11, 14, 58, 59, 30, 33, 86, 88, 31, 34, 87, 89, 11, 14, 58, 59, 17, 18, 60, 61, 39, 41, 96, 98, 40, 42, 97, 99,
+    30, 33, 86, 88, 39, 41, 96, 98, 139, 141, 148, 150, 140, 142, 149, 151, 31, 34, 87, 89, 40, 42, 97, 99, 140, 142, 149, 151, 142, 143, 153, 42,
+    47, 56, 121, 123, 49, 58, 122, 124, 56, 86, 123, 130, 58, 87, 124, 131, 49, 58, 122, 124, 54, 60, 127, 128, 92, 96, 133, 135, 93, 97, 134, 136,
+    56, 86, 123, 130, 92, 96, 133, 135, 144, 148, 154, 156, 145, 149, 155, 119, 58, 87, 124, 131, 93, 97, 134, 136, 145, 149, 155, 119, 152, 153, 158, 72,
+    48, 57, 123, 125, 50, 59, 124, 126, 66, 88, 130, 132, 68, 89, 131, 113, 50, 59, 124, 126, 55, 61, 128, 129, 94, 98, 135, 137, 95, 99, 136, 61,
+    66, 88, 130, 132, 94, 98, 135, 137, 146, 150, 156, 157, 147, 151, 119, 77, 68, 89, 131, 113, 95, 99, 136, 61, 147, 151, 119, 77, 101, 42, 72, 18,
+    8, 24, 46, 62, 24, 30, 56, 66, 24, 37, 62, 74, 30, 39, 66, 76, 24, 30, 56, 66, 37, 39, 92, 94, 138, 139, 144, 146, 139, 140, 145, 147,
+    24, 37, 62, 74, 138, 139, 144, 146, 37, 187, 74, 206, 139, 188, 146, 163, 30, 39, 66, 76, 139, 140, 145, 147, 139, 188, 146, 163, 189, 190, 193, 102,
+    46, 56, 103, 104, 62, 66, 104, 106, 56, 92, 104, 110, 66, 94, 106, 111, 62, 66, 104, 106, 74, 76, 110, 111, 144, 145, 164, 165, 146, 147, 165, 116,
+    56, 92, 104, 110, 144, 145, 164, 165, 92, 191, 110, 186, 145, 192, 165, 137, 66, 94, 106, 111, 146, 147, 165, 116, 145, 192, 165, 137, 193, 153, 207, 71,
+    24, 138, 56, 144, 37, 139, 92, 145, 30, 139, 66, 146, 39, 140, 94, 147, 37, 139, 92, 145, 187, 188, 191, 192, 139, 189, 145, 193, 188, 190, 192, 153,
+    30, 139, 66, 146, 139, 189, 145, 193, 39, 188, 76, 163, 140, 190, 147, 102, 39, 140, 94, 147, 188, 190, 192, 153, 140, 190, 147, 102, 190, 213, 153, 43,
+    62, 144, 104, 164, 74, 146, 110, 165, 66, 145, 106, 165, 76, 147, 111, 116, 74, 146, 110, 165, 206, 163, 186, 137, 146, 193, 165, 207, 163, 102, 137, 71,
+    66, 145, 106, 165, 146, 193, 165, 207, 94, 192, 111, 137, 147, 153, 116, 71, 76, 147, 111, 116, 163, 102, 137, 71, 147, 153, 116, 71, 102, 43, 71, 19,
+    9, 25, 48, 64, 26, 31, 58, 68, 30, 39, 66, 76, 33, 41, 70, 78, 26, 31, 58, 68, 38, 40, 93, 95, 139, 140, 145, 147, 141, 142, 152, 101,
+    30, 39, 66, 76, 139, 140, 145, 147, 139, 188, 146, 163, 189, 190, 193, 102, 33, 41, 70, 78, 141, 142, 152, 101, 189, 190, 193, 102, 194, 195, 208, 82,
+    51, 57, 104, 105, 63, 67, 107, 108, 86, 96, 114, 117, 88, 98, 115, 118, 63, 67, 107, 108, 75, 77, 112, 113, 148, 149, 166, 167, 150, 151, 168, 89,
+    86, 96, 114, 117, 148, 149, 166, 167, 196, 197, 209, 162, 198, 199, 210, 98, 88, 98, 115, 118, 150, 151, 168, 89, 198, 199, 210, 98, 200, 142, 193, 34,
+    56, 144, 123, 154, 92, 145, 133, 155, 86, 148, 130, 156, 96, 149, 135, 119, 92, 145, 133, 155, 191, 192, 201, 161, 196, 198, 202, 168, 197, 199, 203, 97,
+    86, 148, 130, 156, 196, 198, 202, 168, 148, 214, 156, 159, 198, 215, 168, 90, 96, 149, 135, 119, 197, 199, 203, 97, 198, 215, 168, 90, 216, 190, 152, 35,
+    104, 164, 170, 176, 110, 165, 171, 177, 114, 166, 172, 178, 117, 167, 173, 108, 110, 165, 171, 177, 186, 137, 185, 126, 209, 210, 211, 165, 162, 98, 135, 59,
+    114, 166, 172, 178, 209, 210, 211, 165, 209, 204, 174, 132, 169, 149, 115, 67, 117, 167, 173, 108, 162, 98, 135, 59, 169, 149, 115, 67, 100, 41, 70, 14,
+    2, 9, 46, 51, 4, 10, 48, 52, 9, 26, 51, 63, 10, 27, 52, 65, 9, 13, 56, 57, 11, 14, 58, 59, 30, 33, 86, 88, 31, 34, 87, 89,
+    46, 56, 103, 104, 62, 66, 104, 106, 56, 92, 104, 110, 66, 94, 106, 111, 51, 57, 104, 105, 63, 67, 107, 108, 86, 96, 114, 117, 88, 98, 115, 118,
+    4, 11, 62, 63, 5, 12, 64, 65, 11, 28, 63, 84, 12, 29, 65, 85, 10, 14, 66, 67, 12, 15, 68, 69, 31, 35, 88, 90, 32, 36, 89, 91,
+    48, 58, 104, 107, 64, 68, 105, 108, 58, 93, 107, 112, 68, 95, 108, 113, 52, 59, 106, 108, 65, 69, 108, 109, 87, 97, 115, 119, 89, 99, 116, 69,
+    9, 30, 56, 86, 11, 31, 58, 87, 13, 33, 57, 88, 14, 34, 59, 89, 26, 33, 92, 96, 28, 35, 93, 97, 33, 81, 96, 100, 35, 82, 97, 101,
+    51, 86, 104, 114, 63, 88, 107, 115, 57, 96, 105, 117, 67, 98, 108, 118, 63, 88, 110, 117, 84, 90, 112, 119, 88, 100, 117, 120, 90, 102, 119, 78,
+    10, 31, 66, 88, 12, 32, 68, 89, 14, 35, 67, 90, 15, 36, 69, 91, 27, 34, 94, 98, 29, 36, 95, 99, 34, 82, 98, 102, 36, 83, 99, 36,
+    52, 87, 106, 115, 65, 89, 108, 116, 59, 97, 108, 119, 69, 99, 109, 69, 65, 89, 111, 118, 85, 91, 113, 69, 89, 101, 118, 78, 91, 36, 69, 15,
+    4, 10, 48, 52, 7, 12, 50, 53, 25, 31, 57, 67, 27, 32, 59, 69, 11, 14, 58, 59, 17, 18, 60, 61, 39, 41, 96, 98, 40, 42, 97, 99,
+    62, 66, 104, 106, 74, 76, 110, 111, 144, 145, 164, 165, 146, 147, 165, 116, 63, 67, 107, 108, 75, 77, 112, 113, 148, 149, 166, 167, 150, 151, 168, 89,
+    10, 14, 66, 67, 12, 15, 68, 69, 31, 35, 88, 90, 32, 36, 89, 91, 14, 19, 70, 71, 18, 20, 72, 73, 41, 43, 100, 102, 42, 44, 101, 36,
+    66, 70, 114, 115, 76, 78, 117, 118, 145, 152, 166, 168, 147, 101, 167, 89, 67, 71, 115, 116, 77, 79, 119, 69, 149, 153, 169, 147, 151, 42, 147, 32,
+    48, 66, 123, 130, 50, 68, 124, 131, 57, 88, 125, 132, 59, 89, 126, 113, 58, 70, 133, 135, 60, 72, 134, 136, 96, 100, 160, 162, 97, 101, 161, 95,
+    104, 114, 170, 172, 110, 117, 171, 173, 164, 166, 176, 178, 165, 167, 177, 108, 107, 115, 171, 173, 112, 119, 175, 131, 166, 169, 179, 117, 168, 147, 155, 68,
+    52, 67, 130, 132, 53, 69, 131, 113, 67, 90, 132, 159, 69, 91, 113, 85, 59, 71, 135, 137, 61, 73, 136, 61, 98, 102, 162, 163, 99, 36, 95, 29,
+    106, 115, 172, 174, 111, 118, 173, 111, 165, 168, 178, 156, 116, 89, 108, 65, 108, 116, 173, 111, 113, 69, 131, 53, 167, 147, 117, 76, 89, 32, 68, 12,
+    9, 26, 51, 63, 25, 31, 57, 67, 26, 38, 63, 75, 31, 40, 67, 77, 30, 33, 86, 88, 39, 41, 96, 98, 139, 141, 148, 150, 140, 142, 149, 151,
+    56, 92, 104, 110, 144, 145, 164, 165, 92, 191, 110, 186, 145, 192, 165, 137, 86, 96, 114, 117, 148, 149, 166, 167, 196, 197, 209, 162, 198, 199, 210, 98,
+    48, 58, 104, 107, 64, 68, 105, 108, 58, 93, 107, 112, 68, 95, 108, 113, 66, 70, 114, 115, 76, 78, 117, 118, 145, 152, 166, 168, 147, 101, 167, 89,
+    123, 133, 170, 171, 154, 155, 176, 177, 133, 201, 171, 185, 155, 161, 177, 126, 130, 135, 172, 173, 156, 119, 178, 108, 202, 203, 211, 135, 168, 97, 165, 59,
+    30, 139, 86, 148, 39, 140, 96, 149, 33, 141, 88, 150, 41, 142, 98, 151, 139, 189, 196, 198, 188, 190, 197, 199, 189, 194, 198, 200, 190, 195, 199, 142,
+    86, 196, 114, 209, 148, 198, 166, 210, 96, 197, 117, 162, 149, 199, 167, 98, 148, 198, 209, 169, 214, 215, 204, 149, 198, 216, 169, 100, 215, 190, 149, 41,
+    66, 145, 114, 166, 76, 147, 117, 167, 70, 152, 115, 168, 78, 101, 118, 89, 146, 193, 209, 210, 163, 102, 162, 98, 193, 208, 210, 193, 102, 82, 98, 34,
+    130, 202, 172, 211, 156, 168, 178, 165, 135, 203, 173, 135, 119, 97, 108, 59, 156, 168, 174, 115, 159, 90, 132, 67, 168, 152, 115, 70, 90, 35, 67, 14,
+    10, 27, 52, 65, 27, 32, 59, 69, 31, 40, 67, 77, 34, 42, 71, 79, 31, 34, 87, 89, 40, 42, 97, 99, 140, 142, 149, 151, 142, 143, 153, 42,
+    66, 94, 106, 111, 146, 147, 165, 116, 145, 192, 165, 137, 193, 153, 207, 71, 88, 98, 115, 118, 150, 151, 168, 89, 198, 199, 210, 98, 200, 142, 193, 34,
+    52, 59, 106, 108, 65, 69, 108, 109, 87, 97, 115, 119, 89, 99, 116, 69, 67, 71, 115, 116, 77, 79, 119, 69, 149, 153, 169, 147, 151, 42, 147, 32,
+    130, 135, 172, 173, 156, 119, 178, 108, 202, 203, 211, 135, 168, 97, 165, 59, 132, 137, 174, 111, 157, 77, 156, 65, 204, 192, 209, 94, 150, 40, 146, 27,
+    66, 146, 130, 156, 94, 147, 135, 119, 88, 150, 132, 157, 98, 151, 137, 77, 145, 193, 202, 168, 192, 153, 203, 97, 198, 200, 204, 150, 199, 142, 192, 40,
+    114, 209, 172, 174, 209, 169, 211, 115, 166, 204, 178, 132, 210, 149, 165, 67, 166, 210, 211, 115, 204, 149, 202, 87, 218, 198, 166, 88, 198, 140, 145, 31,
+    106, 165, 172, 178, 111, 116, 173, 108, 115, 168, 174, 156, 118, 89, 111, 65, 165, 207, 211, 165, 137, 71, 135, 59, 210, 193, 209, 146, 98, 34, 94, 27,
+    172, 211, 217, 172, 174, 115, 172, 106, 211, 202, 172, 130, 115, 87, 106, 52, 178, 165, 172, 106, 132, 67, 130, 52, 166, 145, 114, 66, 88, 31, 66, 10,
+    3, 24, 47, 56, 6, 26, 49, 58, 9, 30, 48, 66, 11, 31, 50, 68, 47, 56, 121, 123, 49, 58, 122, 124, 56, 86, 123, 130, 58, 87, 124, 131,
+    24, 138, 56, 144, 37, 139, 92, 145, 30, 139, 66, 146, 39, 140, 94, 147, 56, 144, 123, 154, 92, 145, 133, 155, 86, 148, 130, 156, 96, 149, 135, 119,
+    9, 30, 56, 86, 11, 31, 58, 87, 13, 33, 57, 88, 14, 34, 59, 89, 48, 66, 123, 130, 50, 68, 124, 131, 57, 88, 125, 132, 59, 89, 126, 113,
+    30, 139, 86, 148, 39, 140, 96, 149, 33, 141, 88, 150, 41, 142, 98, 151, 66, 146, 130, 156, 94, 147, 135, 119, 88, 150, 132, 157, 98, 151, 137, 77,
+    6, 37, 49, 92, 16, 38, 54, 93, 11, 39, 50, 94, 17, 40, 55, 95, 49, 92, 122, 133, 54, 93, 127, 134, 58, 96, 124, 135, 60, 97, 128, 136,
+    26, 139, 58, 145, 38, 141, 93, 152, 31, 140, 68, 147, 40, 142, 95, 101, 58, 145, 124, 155, 93, 152, 134, 158, 87, 149, 131, 119, 97, 153, 136, 72,
+    11, 39, 58, 96, 17, 40, 60, 97, 14, 41, 59, 98, 18, 42, 61, 99, 50, 94, 124, 135, 55, 95, 128, 136, 59, 98, 126, 137, 61, 99, 129, 61,
+    31, 140, 87, 149, 40, 142, 97, 153, 34, 142, 89, 151, 42, 143, 99, 42, 68, 147, 131, 119, 95, 101, 136, 72, 89, 151, 113, 77, 99, 42, 61, 18,
+    6, 26, 49, 58, 22, 28, 54, 60, 26, 33, 58, 70, 28, 35, 60, 72, 49, 58, 122, 124, 54, 60, 127, 128, 92, 96, 133, 135, 93, 97, 134, 136,
+    37, 139, 92, 145, 187, 188, 191, 192, 139, 189, 145, 193, 188, 190, 192, 153, 92, 145, 133, 155, 191, 192, 201, 161, 196, 198, 202, 168, 197, 199, 203, 97,
+    26, 33, 92, 96, 28, 35, 93, 97, 33, 81, 96, 100, 35, 82, 97, 101, 58, 70, 133, 135, 60, 72, 134, 136, 96, 100, 160, 162, 97, 101, 161, 95,
+    139, 189, 196, 198, 188, 190, 197, 199, 189, 194, 198, 200, 190, 195, 199, 142, 145, 193, 202, 168, 192, 153, 203, 97, 198, 200, 204, 150, 199, 142, 192, 40,
+    49, 92, 122, 133, 54, 93, 127, 134, 58, 96, 124, 135, 60, 97, 128, 136, 122, 133, 181, 183, 127, 134, 182, 184, 133, 160, 183, 185, 134, 161, 184, 128,
+    92, 196, 133, 202, 191, 197, 201, 203, 145, 198, 155, 168, 192, 199, 161, 97, 133, 202, 183, 175, 201, 203, 205, 134, 202, 204, 175, 112, 203, 192, 134, 60,
+    58, 96, 133, 160, 60, 97, 134, 161, 70, 100, 135, 162, 72, 101, 136, 95, 124, 135, 183, 185, 128, 136, 184, 128, 135, 162, 185, 186, 136, 95, 128, 55,
+    145, 198, 202, 204, 192, 199, 203, 192, 193, 200, 168, 150, 153, 142, 97, 40, 155, 168, 175, 112, 161, 97, 134, 60, 168, 150, 112, 75, 97, 40, 60, 17,
+    9, 30, 48, 66, 26, 33, 58, 70, 25, 39, 64, 76, 31, 41, 68, 78, 56, 86, 123, 130, 92, 96, 133, 135, 144, 148, 154, 156, 145, 149, 155, 119,
+    30, 139, 66, 146, 139, 189, 145, 193, 39, 188, 76, 163, 140, 190, 147, 102, 86, 148, 130, 156, 196, 198, 202, 168, 148, 214, 156, 159, 198, 215, 168, 90,
+    51, 86, 104, 114, 63, 88, 107, 115, 57, 96, 105, 117, 67, 98, 108, 118, 104, 114, 170, 172, 110, 117, 171, 173, 164, 166, 176, 178, 165, 167, 177, 108,
+    86, 196, 114, 209, 148, 198, 166, 210, 96, 197, 117, 162, 149, 199, 167, 98, 114, 209, 172, 174, 209, 169, 211, 115, 166, 204, 178, 132, 210, 149, 165, 67,
+    26, 139, 58, 145, 38, 141, 93, 152, 31, 140, 68, 147, 40, 142, 95, 101, 92, 196, 133, 202, 191, 197, 201, 203, 145, 198, 155, 168, 192, 199, 161, 97,
+    33, 189, 70, 193, 141, 194, 152, 208, 41, 190, 78, 102, 142, 195, 101, 82, 96, 198, 135, 168, 197, 216, 203, 152, 149, 215, 119, 90, 199, 190, 97, 35,
+    63, 148, 107, 166, 75, 150, 112, 168, 67, 149, 108, 167, 77, 151, 113, 89, 110, 209, 171, 211, 186, 162, 185, 135, 165, 210, 177, 165, 137, 98, 126, 59,
+    88, 198, 115, 210, 150, 200, 168, 193, 98, 199, 118, 98, 151, 142, 89, 34, 117, 169, 173, 115, 162, 100, 135, 70, 167, 149, 108, 67, 98, 41, 59, 14,
+    11, 31, 50, 68, 28, 35, 60, 72, 31, 41, 68, 78, 35, 43, 72, 80, 58, 87, 124, 131, 93, 97, 134, 136, 145, 149, 155, 119, 152, 153, 158, 72,
+    39, 140, 94, 147, 188, 190, 192, 153, 140, 190, 147, 102, 190, 213, 153, 43, 96, 149, 135, 119, 197, 199, 203, 97, 198, 215, 168, 90, 216, 190, 152, 35,
+    63, 88, 110, 117, 84, 90, 112, 119, 88, 100, 117, 120, 90, 102, 119, 78, 107, 115, 171, 173, 112, 119, 175, 131, 166, 169, 179, 117, 168, 147, 155, 68,
+    148, 198, 209, 169, 214, 215, 204, 149, 198, 216, 169, 100, 215, 190, 149, 41, 166, 210, 211, 115, 204, 149, 202, 87, 218, 198, 166, 88, 198, 140, 145, 31,
+    58, 145, 124, 155, 93, 152, 134, 158, 87, 149, 131, 119, 97, 153, 136, 72, 133, 202, 183, 175, 201, 203, 205, 134, 202, 204, 175, 112, 203, 192, 134, 60,
+    96, 198, 135, 168, 197, 216, 203, 152, 149, 215, 119, 90, 199, 190, 97, 35, 160, 204, 185, 112, 219, 197, 201, 93, 204, 214, 112, 84, 197, 188, 93, 28,
+    107, 166, 171, 179, 112, 168, 175, 155, 115, 169, 173, 117, 119, 147, 131, 68, 171, 211, 212, 171, 185, 135, 183, 124, 211, 209, 171, 110, 135, 94, 124, 50,
+    166, 218, 211, 166, 204, 198, 202, 145, 210, 198, 115, 88, 149, 140, 87, 31, 179, 166, 171, 107, 160, 96, 133, 58, 166, 148, 107, 63, 96, 39, 58, 11,
+    4, 25, 48, 57, 7, 27, 50, 59, 10, 31, 52, 67, 12, 32, 53, 69, 48, 57, 123, 125, 50, 59, 124, 126, 66, 88, 130, 132, 68, 89, 131, 113,
+    62, 144, 104, 164, 74, 146, 110, 165, 66, 145, 106, 165, 76, 147, 111, 116, 104, 164, 170, 176, 110, 165, 171, 177, 114, 166, 172, 178, 117, 167, 173, 108,
+    10, 31, 66, 88, 12, 32, 68, 89, 14, 35, 67, 90, 15, 36, 69, 91, 52, 67, 130, 132, 53, 69, 131, 113, 67, 90, 132, 159, 69, 91, 113, 85,
+    66, 145, 114, 166, 76, 147, 117, 167, 70, 152, 115, 168, 78, 101, 118, 89, 106, 165, 172, 178, 111, 116, 173, 108, 115, 168, 174, 156, 118, 89, 111, 65,
+    11, 39, 58, 96, 17, 40, 60, 97, 14, 41, 59, 98, 18, 42, 61, 99, 58, 96, 133, 160, 60, 97, 134, 161, 70, 100, 135, 162, 72, 101, 136, 95,
+    63, 148, 107, 166, 75, 150, 112, 168, 67, 149, 108, 167, 77, 151, 113, 89, 107, 166, 171, 179, 112, 168, 175, 155, 115, 169, 173, 117, 119, 147, 131, 68,
+    14, 41, 70, 100, 18, 42, 72, 101, 19, 43, 71, 102, 20, 44, 73, 36, 59, 98, 135, 162, 61, 99, 136, 95, 71, 102, 137, 163, 73, 36, 61, 29,
+    67, 149, 115, 169, 77, 151, 119, 147, 71, 153, 116, 147, 79, 42, 69, 32, 108, 167, 173, 117, 113, 89, 131, 68, 116, 147, 111, 76, 69, 32, 53, 12,
+    7, 27, 50, 59, 23, 29, 55, 61, 27, 34, 59, 71, 29, 36, 61, 73, 50, 59, 124, 126, 55, 61, 128, 129, 94, 98, 135, 137, 95, 99, 136, 61,
+    74, 146, 110, 165, 206, 163, 186, 137, 146, 193, 165, 207, 163, 102, 137, 71, 110, 165, 171, 177, 186, 137, 185, 126, 209, 210, 211, 165, 162, 98, 135, 59,
+    27, 34, 94, 98, 29, 36, 95, 99, 34, 82, 98, 102, 36, 83, 99, 36, 59, 71, 135, 137, 61, 73, 136, 61, 98, 102, 162, 163, 99, 36, 95, 29,
+    146, 193, 209, 210, 163, 102, 162, 98, 193, 208, 210, 193, 102, 82, 98, 34, 165, 207, 211, 165, 137, 71, 135, 59, 210, 193, 209, 146, 98, 34, 94, 27,
+    50, 94, 124, 135, 55, 95, 128, 136, 59, 98, 126, 137, 61, 99, 129, 61, 124, 135, 183, 185, 128, 136, 184, 128, 135, 162, 185, 186, 136, 95, 128, 55,
+    110, 209, 171, 211, 186, 162, 185, 135, 165, 210, 177, 165, 137, 98, 126, 59, 171, 211, 212, 171, 185, 135, 183, 124, 211, 209, 171, 110, 135, 94, 124, 50,
+    59, 98, 135, 162, 61, 99, 136, 95, 71, 102, 137, 163, 73, 36, 61, 29, 126, 137, 185, 186, 129, 61, 128, 55, 137, 163, 186, 206, 61, 29, 55, 23,
+    165, 210, 211, 209, 137, 98, 135, 94, 207, 193, 165, 146, 71, 34, 59, 27, 177, 165, 171, 110, 126, 59, 124, 50, 165, 146, 110, 74, 59, 27, 50, 7,
+    10, 31, 52, 67, 27, 34, 59, 71, 27, 40, 65, 77, 32, 42, 69, 79, 66, 88, 130, 132, 94, 98, 135, 137, 146, 150, 156, 157, 147, 151, 119, 77,
+    66, 145, 106, 165, 146, 193, 165, 207, 94, 192, 111, 137, 147, 153, 116, 71, 114, 166, 172, 178, 209, 210, 211, 165, 209, 204, 174, 132, 169, 149, 115, 67,
+    52, 87, 106, 115, 65, 89, 108, 116, 59, 97, 108, 119, 69, 99, 109, 69, 106, 115, 172, 174, 111, 118, 173, 111, 165, 168, 178, 156, 116, 89, 108, 65,
+    130, 202, 172, 211, 156, 168, 178, 165, 135, 203, 173, 135, 119, 97, 108, 59, 172, 211, 217, 172, 174, 115, 172, 106, 211, 202, 172, 130, 115, 87, 106, 52,
+    31, 140, 87, 149, 40, 142, 97, 153, 34, 142, 89, 151, 42, 143, 99, 42, 145, 198, 202, 204, 192, 199, 203, 192, 193, 200, 168, 150, 153, 142, 97, 40,
+    88, 198, 115, 210, 150, 200, 168, 193, 98, 199, 118, 98, 151, 142, 89, 34, 166, 218, 211, 166, 204, 198, 202, 145, 210, 198, 115, 88, 149, 140, 87, 31,
+    67, 149, 115, 169, 77, 151, 119, 147, 71, 153, 116, 147, 79, 42, 69, 32, 165, 210, 211, 209, 137, 98, 135, 94, 207, 193, 165, 146, 71, 34, 59, 27,
+    132, 204, 174, 209, 157, 150, 156, 146, 137, 192, 111, 94, 77, 40, 65, 27, 178, 166, 172, 114, 132, 88, 130, 66, 165, 145, 106, 66, 67, 31, 52, 10,
+    12, 32, 53, 69, 29, 36, 61, 73, 32, 42, 69, 79, 36, 44, 73, 20, 68, 89, 131, 113, 95, 99, 136, 61, 147, 151, 119, 77, 101, 42, 72, 18,
+    76, 147, 111, 116, 163, 102, 137, 71, 147, 153, 116, 71, 102, 43, 71, 19, 117, 167, 173, 108, 162, 98, 135, 59, 169, 149, 115, 67, 100, 41, 70, 14,
+    65, 89, 111, 118, 85, 91, 113, 69, 89, 101, 118, 78, 91, 36, 69, 15, 108, 116, 173, 111, 113, 69, 131, 53, 167, 147, 117, 76, 89, 32, 68, 12,
+    156, 168, 174, 115, 159, 90, 132, 67, 168, 152, 115, 70, 90, 35, 67, 14, 178, 165, 172, 106, 132, 67, 130, 52, 166, 145, 114, 66, 88, 31, 66, 10,
+    68, 147, 131, 119, 95, 101, 136, 72, 89, 151, 113, 77, 99, 42, 61, 18, 155, 168, 175, 112, 161, 97, 134, 60, 168, 150, 112, 75, 97, 40, 60, 17,
+    117, 169, 173, 115, 162, 100, 135, 70, 167, 149, 108, 67, 98, 41, 59, 14, 179, 166, 171, 107, 160, 96, 133, 58, 166, 148, 107, 63, 96, 39, 58, 11,
+    108, 167, 173, 117, 113, 89, 131, 68, 116, 147, 111, 76, 69, 32, 53, 12, 177, 165, 171, 110, 126, 59, 124, 50, 165, 146, 110, 74, 59, 27, 50, 7,
+    178, 166, 172, 114, 132, 88, 130, 66, 165, 145, 106, 66, 67, 31, 52, 10, 176, 164, 170, 104, 125, 57, 123, 48, 164, 144, 104, 62, 57, 25, 48, 4,
+    2, 9, 46, 51, 9, 13, 56, 57, 46, 56, 103, 104, 51, 57, 104, 105, 4, 10, 48, 52, 11, 14, 58, 59, 62, 66, 104, 106, 63, 67, 107, 108,
+    9, 26, 51, 63, 30, 33, 86, 88, 56, 92, 104, 110, 86, 96, 114, 117, 10, 27, 52, 65, 31, 34, 87, 89, 66, 94, 106, 111, 88, 98, 115, 118,
+    4, 11, 62, 63, 10, 14, 66, 67, 48, 58, 104, 107, 52, 59, 106, 108, 5, 12, 64, 65, 12, 15, 68, 69, 64, 68, 105, 108, 65, 69, 108, 109,
+    11, 28, 63, 84, 31, 35, 88, 90, 58, 93, 107, 112, 87, 97, 115, 119, 12, 29, 65, 85, 32, 36, 89, 91, 68, 95, 108, 113, 89, 99, 116, 69,
+    9, 30, 56, 86, 26, 33, 92, 96, 51, 86, 104, 114, 63, 88, 110, 117, 11, 31, 58, 87, 28, 35, 93, 97, 63, 88, 107, 115, 84, 90, 112, 119,
+    13, 33, 57, 88, 33, 81, 96, 100, 57, 96, 105, 117, 88, 100, 117, 120, 14, 34, 59, 89, 35, 82, 97, 101, 67, 98, 108, 118, 90, 102, 119, 78,
+    10, 31, 66, 88, 27, 34, 94, 98, 52, 87, 106, 115, 65, 89, 111, 118, 12, 32, 68, 89, 29, 36, 95, 99, 65, 89, 108, 116, 85, 91, 113, 69,
+    14, 35, 67, 90, 34, 82, 98, 102, 59, 97, 108, 119, 89, 101, 118, 78, 15, 36, 69, 91, 36, 83, 99, 36, 69, 99, 109, 69, 91, 36, 69, 15,
+    4, 10, 48, 52, 11, 14, 58, 59, 62, 66, 104, 106, 63, 67, 107, 108, 7, 12, 50, 53, 17, 18, 60, 61, 74, 76, 110, 111, 75, 77, 112, 113,
+    25, 31, 57, 67, 39, 41, 96, 98, 144, 145, 164, 165, 148, 149, 166, 167, 27, 32, 59, 69, 40, 42, 97, 99, 146, 147, 165, 116, 150, 151, 168, 89,
+    10, 14, 66, 67, 14, 19, 70, 71, 66, 70, 114, 115, 67, 71, 115, 116, 12, 15, 68, 69, 18, 20, 72, 73, 76, 78, 117, 118, 77, 79, 119, 69,
+    31, 35, 88, 90, 41, 43, 100, 102, 145, 152, 166, 168, 149, 153, 169, 147, 32, 36, 89, 91, 42, 44, 101, 36, 147, 101, 167, 89, 151, 42, 147, 32,
+    48, 66, 123, 130, 58, 70, 133, 135, 104, 114, 170, 172, 107, 115, 171, 173, 50, 68, 124, 131, 60, 72, 134, 136, 110, 117, 171, 173, 112, 119, 175, 131,
+    57, 88, 125, 132, 96, 100, 160, 162, 164, 166, 176, 178, 166, 169, 179, 117, 59, 89, 126, 113, 97, 101, 161, 95, 165, 167, 177, 108, 168, 147, 155, 68,
+    52, 67, 130, 132, 59, 71, 135, 137, 106, 115, 172, 174, 108, 116, 173, 111, 53, 69, 131, 113, 61, 73, 136, 61, 111, 118, 173, 111, 113, 69, 131, 53,
+    67, 90, 132, 159, 98, 102, 162, 163, 165, 168, 178, 156, 167, 147, 117, 76, 69, 91, 113, 85, 99, 36, 95, 29, 116, 89, 108, 65, 89, 32, 68, 12,
+    9, 26, 51, 63, 30, 33, 86, 88, 56, 92, 104, 110, 86, 96, 114, 117, 25, 31, 57, 67, 39, 41, 96, 98, 144, 145, 164, 165, 148, 149, 166, 167,
+    26, 38, 63, 75, 139, 141, 148, 150, 92, 191, 110, 186, 196, 197, 209, 162, 31, 40, 67, 77, 140, 142, 149, 151, 145, 192, 165, 137, 198, 199, 210, 98,
+    48, 58, 104, 107, 66, 70, 114, 115, 123, 133, 170, 171, 130, 135, 172, 173, 64, 68, 105, 108, 76, 78, 117, 118, 154, 155, 176, 177, 156, 119, 178, 108,
+    58, 93, 107, 112, 145, 152, 166, 168, 133, 201, 171, 185, 202, 203, 211, 135, 68, 95, 108, 113, 147, 101, 167, 89, 155, 161, 177, 126, 168, 97, 165, 59,
+    30, 139, 86, 148, 139, 189, 196, 198, 86, 196, 114, 209, 148, 198, 209, 169, 39, 140, 96, 149, 188, 190, 197, 199, 148, 198, 166, 210, 214, 215, 204, 149,
+    33, 141, 88, 150, 189, 194, 198, 200, 96, 197, 117, 162, 198, 216, 169, 100, 41, 142, 98, 151, 190, 195, 199, 142, 149, 199, 167, 98, 215, 190, 149, 41,
+    66, 145, 114, 166, 146, 193, 209, 210, 130, 202, 172, 211, 156, 168, 174, 115, 76, 147, 117, 167, 163, 102, 162, 98, 156, 168, 178, 165, 159, 90, 132, 67,
+    70, 152, 115, 168, 193, 208, 210, 193, 135, 203, 173, 135, 168, 152, 115, 70, 78, 101, 118, 89, 102, 82, 98, 34, 119, 97, 108, 59, 90, 35, 67, 14,
+    10, 27, 52, 65, 31, 34, 87, 89, 66, 94, 106, 111, 88, 98, 115, 118, 27, 32, 59, 69, 40, 42, 97, 99, 146, 147, 165, 116, 150, 151, 168, 89,
+    31, 40, 67, 77, 140, 142, 149, 151, 145, 192, 165, 137, 198, 199, 210, 98, 34, 42, 71, 79, 142, 143, 153, 42, 193, 153, 207, 71, 200, 142, 193, 34,
+    52, 59, 106, 108, 67, 71, 115, 116, 130, 135, 172, 173, 132, 137, 174, 111, 65, 69, 108, 109, 77, 79, 119, 69, 156, 119, 178, 108, 157, 77, 156, 65,
+    87, 97, 115, 119, 149, 153, 169, 147, 202, 203, 211, 135, 204, 192, 209, 94, 89, 99, 116, 69, 151, 42, 147, 32, 168, 97, 165, 59, 150, 40, 146, 27,
+    66, 146, 130, 156, 145, 193, 202, 168, 114, 209, 172, 174, 166, 210, 211, 115, 94, 147, 135, 119, 192, 153, 203, 97, 209, 169, 211, 115, 204, 149, 202, 87,
+    88, 150, 132, 157, 198, 200, 204, 150, 166, 204, 178, 132, 218, 198, 166, 88, 98, 151, 137, 77, 199, 142, 192, 40, 210, 149, 165, 67, 198, 140, 145, 31,
+    106, 165, 172, 178, 165, 207, 211, 165, 172, 211, 217, 172, 178, 165, 172, 106, 111, 116, 173, 108, 137, 71, 135, 59, 174, 115, 172, 106, 132, 67, 130, 52,
+    115, 168, 174, 156, 210, 193, 209, 146, 211, 202, 172, 130, 166, 145, 114, 66, 118, 89, 111, 65, 98, 34, 94, 27, 115, 87, 106, 52, 88, 31, 66, 10,
+    4, 11, 62, 63, 10, 14, 66, 67, 48, 58, 104, 107, 52, 59, 106, 108, 10, 14, 66, 67, 14, 19, 70, 71, 66, 70, 114, 115, 67, 71, 115, 116,
+    48, 58, 104, 107, 66, 70, 114, 115, 123, 133, 170, 171, 130, 135, 172, 173, 52, 59, 106, 108, 67, 71, 115, 116, 130, 135, 172, 173, 132, 137, 174, 111,
+    7, 17, 74, 75, 12, 18, 76, 77, 50, 60, 110, 112, 53, 61, 111, 113, 12, 18, 76, 77, 15, 20, 78, 79, 68, 72, 117, 119, 69, 73, 118, 69,
+    50, 60, 110, 112, 68, 72, 117, 119, 124, 134, 171, 175, 131, 136, 173, 131, 53, 61, 111, 113, 69, 73, 118, 69, 131, 136, 173, 131, 113, 61, 111, 53,
+    25, 39, 144, 148, 31, 41, 145, 149, 57, 96, 164, 166, 67, 98, 165, 167, 31, 41, 145, 149, 35, 43, 152, 153, 88, 100, 166, 169, 90, 102, 168, 147,
+    57, 96, 164, 166, 88, 100, 166, 169, 125, 160, 176, 179, 132, 162, 178, 117, 67, 98, 165, 167, 90, 102, 168, 147, 132, 162, 178, 117, 159, 163, 156, 76,
+    27, 40, 146, 150, 32, 42, 147, 151, 59, 97, 165, 168, 69, 99, 116, 89, 32, 42, 147, 151, 36, 44, 101, 42, 89, 101, 167, 147, 91, 36, 89, 32,
+    59, 97, 165, 168, 89, 101, 167, 147, 126, 161, 177, 155, 113, 95, 108, 68, 69, 99, 116, 89, 91, 36, 89, 32, 113, 95, 108, 68, 85, 29, 65, 12,
+    5, 12, 64, 65, 12, 15, 68, 69, 64, 68, 105, 108, 65, 69, 108, 109, 12, 15, 68, 69, 18, 20, 72, 73, 76, 78, 117, 118, 77, 79, 119, 69,
+    64, 68, 105, 108, 76, 78, 117, 118, 154, 155, 176, 177, 156, 119, 178, 108, 65, 69, 108, 109, 77, 79, 119, 69, 156, 119, 178, 108, 157, 77, 156, 65,
+    12, 18, 76, 77, 15, 20, 78, 79, 68, 72, 117, 119, 69, 73, 118, 69, 15, 20, 78, 79, 20, 21, 80, 20, 78, 80, 120, 78, 79, 20, 78, 15,
+    68, 72, 117, 119, 78, 80, 120, 78, 155, 158, 179, 155, 119, 72, 117, 68, 69, 73, 118, 69, 79, 20, 78, 15, 119, 72, 117, 68, 77, 18, 76, 12,
+    64, 76, 154, 156, 68, 78, 155, 119, 105, 117, 176, 178, 108, 118, 177, 108, 68, 78, 155, 119, 72, 80, 158, 72, 117, 120, 179, 117, 119, 78, 155, 68,
+    105, 117, 176, 178, 117, 120, 179, 117, 176, 179, 180, 176, 178, 117, 176, 105, 108, 118, 177, 108, 119, 78, 155, 68, 178, 117, 176, 105, 156, 76, 154, 64,
+    65, 77, 156, 157, 69, 79, 119, 77, 108, 119, 178, 156, 109, 69, 108, 65, 69, 79, 119, 77, 73, 20, 72, 18, 118, 78, 117, 76, 69, 15, 68, 12,
+    108, 119, 178, 156, 118, 78, 117, 76, 177, 155, 176, 154, 108, 68, 105, 64, 109, 69, 108, 65, 69, 15, 68, 12, 108, 68, 105, 64, 65, 12, 64, 5,
+    11, 28, 63, 84, 31, 35, 88, 90, 58, 93, 107, 112, 87, 97, 115, 119, 31, 35, 88, 90, 41, 43, 100, 102, 145, 152, 166, 168, 149, 153, 169, 147,
+    58, 93, 107, 112, 145, 152, 166, 168, 133, 201, 171, 185, 202, 203, 211, 135, 87, 97, 115, 119, 149, 153, 169, 147, 202, 203, 211, 135, 204, 192, 209, 94,
+    50, 60, 110, 112, 68, 72, 117, 119, 124, 134, 171, 175, 131, 136, 173, 131, 68, 72, 117, 119, 78, 80, 120, 78, 155, 158, 179, 155, 119, 72, 117, 68,
+    124, 134, 171, 175, 155, 158, 179, 155, 183, 205, 212, 183, 175, 134, 171, 124, 131, 136, 173, 131, 119, 72, 117, 68, 175, 134, 171, 124, 112, 60, 110, 50,
+    39, 188, 148, 214, 140, 190, 198, 215, 96, 197, 166, 204, 149, 199, 210, 149, 140, 190, 198, 215, 190, 213, 216, 190, 198, 216, 218, 198, 215, 190, 198, 140,
+    96, 197, 166, 204, 198, 216, 218, 198, 160, 219, 179, 160, 204, 197, 166, 96, 149, 199, 210, 149, 215, 190, 198, 140, 204, 197, 166, 96, 214, 188, 148, 39,
+    94, 192, 209, 204, 147, 153, 169, 149, 135, 203, 211, 202, 119, 97, 115, 87, 147, 153, 169, 149, 102, 43, 100, 41, 168, 152, 166, 145, 90, 35, 88, 31,
+    135, 203, 211, 202, 168, 152, 166, 145, 185, 201, 171, 133, 112, 93, 107, 58, 119, 97, 115, 87, 90, 35, 88, 31, 112, 93, 107, 58, 84, 28, 63, 11,
+    12, 29, 65, 85, 32, 36, 89, 91, 68, 95, 108, 113, 89, 99, 116, 69, 32, 36, 89, 91, 42, 44, 101, 36, 147, 101, 167, 89, 151, 42, 147, 32,
+    68, 95, 108, 113, 147, 101, 167, 89, 155, 161, 177, 126, 168, 97, 165, 59, 89, 99, 116, 69, 151, 42, 147, 32, 168, 97, 165, 59, 150, 40, 146, 27,
+    53, 61, 111, 113, 69, 73, 118, 69, 131, 136, 173, 131, 113, 61, 111, 53, 69, 73, 118, 69, 79, 20, 78, 15, 119, 72, 117, 68, 77, 18, 76, 12,
+    131, 136, 173, 131, 119, 72, 117, 68, 175, 134, 171, 124, 112, 60, 110, 50, 113, 61, 111, 53, 77, 18, 76, 12, 112, 60, 110, 50, 75, 17, 74, 7,
+    76, 163, 156, 159, 147, 102, 168, 90, 117, 162, 178, 132, 167, 98, 165, 67, 147, 102, 168, 90, 153, 43, 152, 35, 169, 100, 166, 88, 149, 41, 145, 31,
+    117, 162, 178, 132, 169, 100, 166, 88, 179, 160, 176, 125, 166, 96, 164, 57, 167, 98, 165, 67, 149, 41, 145, 31, 166, 96, 164, 57, 148, 39, 144, 25,
+    111, 137, 174, 132, 116, 71, 115, 67, 173, 135, 172, 130, 108, 59, 106, 52, 116, 71, 115, 67, 71, 19, 70, 14, 115, 70, 114, 66, 67, 14, 66, 10,
+    173, 135, 172, 130, 115, 70, 114, 66, 171, 133, 170, 123, 107, 58, 104, 48, 108, 59, 106, 52, 67, 14, 66, 10, 107, 58, 104, 48, 63, 11, 62, 4,
+    9, 30, 56, 86, 26, 33, 92, 96, 51, 86, 104, 114, 63, 88, 110, 117, 48, 66, 123, 130, 58, 70, 133, 135, 104, 114, 170, 172, 107, 115, 171, 173,
+    30, 139, 86, 148, 139, 189, 196, 198, 86, 196, 114, 209, 148, 198, 209, 169, 66, 146, 130, 156, 145, 193, 202, 168, 114, 209, 172, 174, 166, 210, 211, 115,
+    25, 39, 144, 148, 31, 41, 145, 149, 57, 96, 164, 166, 67, 98, 165, 167, 64, 76, 154, 156, 68, 78, 155, 119, 105, 117, 176, 178, 108, 118, 177, 108,
+    39, 188, 148, 214, 140, 190, 198, 215, 96, 197, 166, 204, 149, 199, 210, 149, 76, 163, 156, 159, 147, 102, 168, 90, 117, 162, 178, 132, 167, 98, 165, 67,
+    26, 139, 92, 196, 38, 141, 191, 197, 63, 148, 110, 209, 75, 150, 186, 162, 58, 145, 133, 202, 93, 152, 201, 203, 107, 166, 171, 211, 112, 168, 185, 135,
+    33, 189, 96, 198, 141, 194, 197, 216, 88, 198, 117, 169, 150, 200, 162, 100, 70, 193, 135, 168, 152, 208, 203, 152, 115, 210, 173, 115, 168, 193, 135, 70,
+    31, 140, 145, 198, 40, 142, 192, 199, 67, 149, 165, 210, 77, 151, 137, 98, 68, 147, 155, 168, 95, 101, 161, 97, 108, 167, 177, 165, 113, 89, 126, 59,
+    41, 190, 149, 215, 142, 195, 199, 190, 98, 199, 167, 149, 151, 142, 98, 41, 78, 102, 119, 90, 101, 82, 97, 35, 118, 98, 108, 67, 89, 34, 59, 14,
+    11, 31, 58, 87, 28, 35, 93, 97, 63, 88, 107, 115, 84, 90, 112, 119, 50, 68, 124, 131, 60, 72, 134, 136, 110, 117, 171, 173, 112, 119, 175, 131,
+    39, 140, 96, 149, 188, 190, 197, 199, 148, 198, 166, 210, 214, 215, 204, 149, 94, 147, 135, 119, 192, 153, 203, 97, 209, 169, 211, 115, 204, 149, 202, 87,
+    31, 41, 145, 149, 35, 43, 152, 153, 88, 100, 166, 169, 90, 102, 168, 147, 68, 78, 155, 119, 72, 80, 158, 72, 117, 120, 179, 117, 119, 78, 155, 68,
+    140, 190, 198, 215, 190, 213, 216, 190, 198, 216, 218, 198, 215, 190, 198, 140, 147, 102, 168, 90, 153, 43, 152, 35, 169, 100, 166, 88, 149, 41, 145, 31,
+    58, 145, 133, 202, 93, 152, 201, 203, 107, 166, 171, 211, 112, 168, 185, 135, 124, 155, 183, 175, 134, 158, 205, 134, 171, 179, 212, 171, 175, 155, 183, 124,
+    96, 198, 160, 204, 197, 216, 219, 197, 166, 218, 179, 166, 204, 198, 160, 96, 135, 168, 185, 112, 203, 152, 201, 93, 211, 166, 171, 107, 202, 145, 133, 58,
+    87, 149, 202, 204, 97, 153, 203, 192, 115, 169, 211, 209, 119, 147, 135, 94, 131, 119, 175, 112, 136, 72, 134, 60, 173, 117, 171, 110, 131, 68, 124, 50,
+    149, 215, 204, 214, 199, 190, 197, 188, 210, 198, 166, 148, 149, 140, 96, 39, 119, 90, 112, 84, 97, 35, 93, 28, 115, 88, 107, 63, 87, 31, 58, 11,
+    13, 33, 57, 88, 33, 81, 96, 100, 57, 96, 105, 117, 88, 100, 117, 120, 57, 88, 125, 132, 96, 100, 160, 162, 164, 166, 176, 178, 166, 169, 179, 117,
+    33, 141, 88, 150, 189, 194, 198, 200, 96, 197, 117, 162, 198, 216, 169, 100, 88, 150, 132, 157, 198, 200, 204, 150, 166, 204, 178, 132, 218, 198, 166, 88,
+    57, 96, 164, 166, 88, 100, 166, 169, 125, 160, 176, 179, 132, 162, 178, 117, 105, 117, 176, 178, 117, 120, 179, 117, 176, 179, 180, 176, 178, 117, 176, 105,
+    96, 197, 166, 204, 198, 216, 218, 198, 160, 219, 179, 160, 204, 197, 166, 96, 117, 162, 178, 132, 169, 100, 166, 88, 179, 160, 176, 125, 166, 96, 164, 57,
+    33, 189, 96, 198, 141, 194, 197, 216, 88, 198, 117, 169, 150, 200, 162, 100, 96, 198, 160, 204, 197, 216, 219, 197, 166, 218, 179, 166, 204, 198, 160, 96,
+    81, 194, 100, 200, 194, 220, 216, 194, 100, 216, 120, 100, 200, 194, 100, 81, 100, 200, 162, 150, 216, 194, 197, 141, 169, 198, 117, 88, 198, 189, 96, 33,
+    88, 198, 166, 218, 150, 200, 204, 198, 132, 204, 178, 166, 157, 150, 132, 88, 117, 169, 179, 166, 162, 100, 160, 96, 178, 166, 176, 164, 132, 88, 125, 57,
+    100, 216, 169, 198, 200, 194, 198, 189, 162, 197, 117, 96, 150, 141, 88, 33, 120, 100, 117, 88, 100, 81, 96, 33, 117, 96, 105, 57, 88, 33, 57, 13,
+    14, 34, 59, 89, 35, 82, 97, 101, 67, 98, 108, 118, 90, 102, 119, 78, 59, 89, 126, 113, 97, 101, 161, 95, 165, 167, 177, 108, 168, 147, 155, 68,
+    41, 142, 98, 151, 190, 195, 199, 142, 149, 199, 167, 98, 215, 190, 149, 41, 98, 151, 137, 77, 199, 142, 192, 40, 210, 149, 165, 67, 198, 140, 145, 31,
+    67, 98, 165, 167, 90, 102, 168, 147, 132, 162, 178, 117, 159, 163, 156, 76, 108, 118, 177, 108, 119, 78, 155, 68, 178, 117, 176, 105, 156, 76, 154, 64,
+    149, 199, 210, 149, 215, 190, 198, 140, 204, 197, 166, 96, 214, 188, 148, 39, 167, 98, 165, 67, 149, 41, 145, 31, 166, 96, 164, 57, 148, 39, 144, 25,
+    70, 193, 135, 168, 152, 208, 203, 152, 115, 210, 173, 115, 168, 193, 135, 70, 135, 168, 185, 112, 203, 152, 201, 93, 211, 166, 171, 107, 202, 145, 133, 58,
+    100, 200, 162, 150, 216, 194, 197, 141, 169, 198, 117, 88, 198, 189, 96, 33, 162, 150, 186, 75, 197, 141, 191, 38, 209, 148, 110, 63, 196, 139, 92, 26,
+    115, 210, 211, 166, 168, 193, 202, 145, 174, 209, 172, 114, 156, 146, 130, 66, 173, 115, 171, 107, 135, 70, 133, 58, 172, 114, 170, 104, 130, 66, 123, 48,
+    169, 198, 209, 148, 198, 189, 196, 139, 209, 196, 114, 86, 148, 139, 86, 30, 117, 88, 110, 63, 96, 33, 92, 26, 114, 86, 104, 51, 86, 30, 56, 9,
+    10, 31, 66, 88, 27, 34, 94, 98, 52, 87, 106, 115, 65, 89, 111, 118, 52, 67, 130, 132, 59, 71, 135, 137, 106, 115, 172, 174, 108, 116, 173, 111,
+    66, 145, 114, 166, 146, 193, 209, 210, 130, 202, 172, 211, 156, 168, 174, 115, 106, 165, 172, 178, 165, 207, 211, 165, 172, 211, 217, 172, 178, 165, 172, 106,
+    27, 40, 146, 150, 32, 42, 147, 151, 59, 97, 165, 168, 69, 99, 116, 89, 65, 77, 156, 157, 69, 79, 119, 77, 108, 119, 178, 156, 109, 69, 108, 65,
+    94, 192, 209, 204, 147, 153, 169, 149, 135, 203, 211, 202, 119, 97, 115, 87, 111, 137, 174, 132, 116, 71, 115, 67, 173, 135, 172, 130, 108, 59, 106, 52,
+    31, 140, 145, 198, 40, 142, 192, 199, 67, 149, 165, 210, 77, 151, 137, 98, 87, 149, 202, 204, 97, 153, 203, 192, 115, 169, 211, 209, 119, 147, 135, 94,
+    88, 198, 166, 218, 150, 200, 204, 198, 132, 204, 178, 166, 157, 150, 132, 88, 115, 210, 211, 166, 168, 193, 202, 145, 174, 209, 172, 114, 156, 146, 130, 66,
+    34, 142, 193, 200, 42, 143, 153, 142, 71, 153, 207, 193, 79, 42, 71, 34, 89, 151, 168, 150, 99, 42, 97, 40, 116, 147, 165, 146, 69, 32, 59, 27,
+    98, 199, 210, 198, 151, 142, 149, 140, 137, 192, 165, 145, 77, 40, 67, 31, 118, 98, 115, 88, 89, 34, 87, 31, 111, 94, 106, 66, 65, 27, 52, 10,
+    12, 32, 68, 89, 29, 36, 95, 99, 65, 89, 108, 116, 85, 91, 113, 69, 53, 69, 131, 113, 61, 73, 136, 61, 111, 118, 173, 111, 113, 69, 131, 53,
+    76, 147, 117, 167, 163, 102, 162, 98, 156, 168, 178, 165, 159, 90, 132, 67, 111, 116, 173, 108, 137, 71, 135, 59, 174, 115, 172, 106, 132, 67, 130, 52,
+    32, 42, 147, 151, 36, 44, 101, 42, 89, 101, 167, 147, 91, 36, 89, 32, 69, 79, 119, 77, 73, 20, 72, 18, 118, 78, 117, 76, 69, 15, 68, 12,
+    147, 153, 169, 149, 102, 43, 100, 41, 168, 152, 166, 145, 90, 35, 88, 31, 116, 71, 115, 67, 71, 19, 70, 14, 115, 70, 114, 66, 67, 14, 66, 10,
+    68, 147, 155, 168, 95, 101, 161, 97, 108, 167, 177, 165, 113, 89, 126, 59, 131, 119, 175, 112, 136, 72, 134, 60, 173, 117, 171, 110, 131, 68, 124, 50,
+    117, 169, 179, 166, 162, 100, 160, 96, 178, 166, 176, 164, 132, 88, 125, 57, 173, 115, 171, 107, 135, 70, 133, 58, 172, 114, 170, 104, 130, 66, 123, 48,
+    89, 151, 168, 150, 99, 42, 97, 40, 116, 147, 165, 146, 69, 32, 59, 27, 113, 77, 112, 75, 61, 18, 60, 17, 111, 76, 110, 74, 53, 12, 50, 7,
+    167, 149, 166, 148, 98, 41, 96, 39, 165, 145, 164, 144, 67, 31, 57, 25, 108, 67, 107, 63, 59, 14, 58, 11, 106, 66, 104, 62, 52, 10, 48, 4,
+    14, 35, 67, 90, 34, 82, 98, 102, 59, 97, 108, 119, 89, 101, 118, 78, 67, 90, 132, 159, 98, 102, 162, 163, 165, 168, 178, 156, 167, 147, 117, 76,
+    70, 152, 115, 168, 193, 208, 210, 193, 135, 203, 173, 135, 168, 152, 115, 70, 115, 168, 174, 156, 210, 193, 209, 146, 211, 202, 172, 130, 166, 145, 114, 66,
+    59, 97, 165, 168, 89, 101, 167, 147, 126, 161, 177, 155, 113, 95, 108, 68, 108, 119, 178, 156, 118, 78, 117, 76, 177, 155, 176, 154, 108, 68, 105, 64,
+    135, 203, 211, 202, 168, 152, 166, 145, 185, 201, 171, 133, 112, 93, 107, 58, 173, 135, 172, 130, 115, 70, 114, 66, 171, 133, 170, 123, 107, 58, 104, 48,
+    41, 190, 149, 215, 142, 195, 199, 190, 98, 199, 167, 149, 151, 142, 98, 41, 149, 215, 204, 214, 199, 190, 197, 188, 210, 198, 166, 148, 149, 140, 96, 39,
+    100, 216, 169, 198, 200, 194, 198, 189, 162, 197, 117, 96, 150, 141, 88, 33, 169, 198, 209, 148, 198, 189, 196, 139, 209, 196, 114, 86, 148, 139, 86, 30,
+    98, 199, 210, 198, 151, 142, 149, 140, 137, 192, 165, 145, 77, 40, 67, 31, 167, 149, 166, 148, 98, 41, 96, 39, 165, 145, 164, 144, 67, 31, 57, 25,
+    162, 197, 209, 196, 150, 141, 148, 139, 186, 191, 110, 92, 75, 38, 63, 26, 117, 96, 114, 86, 88, 33, 86, 30, 110, 92, 104, 56, 63, 26, 51, 9,
+    15, 36, 69, 91, 36, 83, 99, 36, 69, 99, 109, 69, 91, 36, 69, 15, 69, 91, 113, 85, 99, 36, 95, 29, 116, 89, 108, 65, 89, 32, 68, 12,
+    78, 101, 118, 89, 102, 82, 98, 34, 119, 97, 108, 59, 90, 35, 67, 14, 118, 89, 111, 65, 98, 34, 94, 27, 115, 87, 106, 52, 88, 31, 66, 10,
+    69, 99, 116, 89, 91, 36, 89, 32, 113, 95, 108, 68, 85, 29, 65, 12, 109, 69, 108, 65, 69, 15, 68, 12, 108, 68, 105, 64, 65, 12, 64, 5,
+    119, 97, 115, 87, 90, 35, 88, 31, 112, 93, 107, 58, 84, 28, 63, 11, 108, 59, 106, 52, 67, 14, 66, 10, 107, 58, 104, 48, 63, 11, 62, 4,
+    78, 102, 119, 90, 101, 82, 97, 35, 118, 98, 108, 67, 89, 34, 59, 14, 119, 90, 112, 84, 97, 35, 93, 28, 115, 88, 107, 63, 87, 31, 58, 11,
+    120, 100, 117, 88, 100, 81, 96, 33, 117, 96, 105, 57, 88, 33, 57, 13, 117, 88, 110, 63, 96, 33, 92, 26, 114, 86, 104, 51, 86, 30, 56, 9,
+    118, 98, 115, 88, 89, 34, 87, 31, 111, 94, 106, 66, 65, 27, 52, 10, 108, 67, 107, 63, 59, 14, 58, 11, 106, 66, 104, 62, 52, 10, 48, 4,
+    117, 96, 114, 86, 88, 33, 86, 30, 110, 92, 104, 56, 63, 26, 51, 9, 105, 57, 104, 51, 57, 13, 56, 9, 104, 56, 103, 46, 51, 9, 46, 2,
+    3, 24, 47, 56, 47, 56, 121, 123, 24, 138, 56, 144, 56, 144, 123, 154, 6, 26, 49, 58, 49, 58, 122, 124, 37, 139, 92, 145, 92, 145, 133, 155,
+    9, 30, 48, 66, 56, 86, 123, 130, 30, 139, 66, 146, 86, 148, 130, 156, 11, 31, 50, 68, 58, 87, 124, 131, 39, 140, 94, 147, 96, 149, 135, 119,
+    9, 30, 56, 86, 48, 66, 123, 130, 30, 139, 86, 148, 66, 146, 130, 156, 11, 31, 58, 87, 50, 68, 124, 131, 39, 140, 96, 149, 94, 147, 135, 119,
+    13, 33, 57, 88, 57, 88, 125, 132, 33, 141, 88, 150, 88, 150, 132, 157, 14, 34, 59, 89, 59, 89, 126, 113, 41, 142, 98, 151, 98, 151, 137, 77,
+    6, 37, 49, 92, 49, 92, 122, 133, 26, 139, 58, 145, 58, 145, 124, 155, 16, 38, 54, 93, 54, 93, 127, 134, 38, 141, 93, 152, 93, 152, 134, 158,
+    11, 39, 50, 94, 58, 96, 124, 135, 31, 140, 68, 147, 87, 149, 131, 119, 17, 40, 55, 95, 60, 97, 128, 136, 40, 142, 95, 101, 97, 153, 136, 72,
+    11, 39, 58, 96, 50, 94, 124, 135, 31, 140, 87, 149, 68, 147, 131, 119, 17, 40, 60, 97, 55, 95, 128, 136, 40, 142, 97, 153, 95, 101, 136, 72,
+    14, 41, 59, 98, 59, 98, 126, 137, 34, 142, 89, 151, 89, 151, 113, 77, 18, 42, 61, 99, 61, 99, 129, 61, 42, 143, 99, 42, 99, 42, 61, 18,
+    6, 26, 49, 58, 49, 58, 122, 124, 37, 139, 92, 145, 92, 145, 133, 155, 22, 28, 54, 60, 54, 60, 127, 128, 187, 188, 191, 192, 191, 192, 201, 161,
+    26, 33, 58, 70, 92, 96, 133, 135, 139, 189, 145, 193, 196, 198, 202, 168, 28, 35, 60, 72, 93, 97, 134, 136, 188, 190, 192, 153, 197, 199, 203, 97,
+    26, 33, 92, 96, 58, 70, 133, 135, 139, 189, 196, 198, 145, 193, 202, 168, 28, 35, 93, 97, 60, 72, 134, 136, 188, 190, 197, 199, 192, 153, 203, 97,
+    33, 81, 96, 100, 96, 100, 160, 162, 189, 194, 198, 200, 198, 200, 204, 150, 35, 82, 97, 101, 97, 101, 161, 95, 190, 195, 199, 142, 199, 142, 192, 40,
+    49, 92, 122, 133, 122, 133, 181, 183, 92, 196, 133, 202, 133, 202, 183, 175, 54, 93, 127, 134, 127, 134, 182, 184, 191, 197, 201, 203, 201, 203, 205, 134,
+    58, 96, 124, 135, 133, 160, 183, 185, 145, 198, 155, 168, 202, 204, 175, 112, 60, 97, 128, 136, 134, 161, 184, 128, 192, 199, 161, 97, 203, 192, 134, 60,
+    58, 96, 133, 160, 124, 135, 183, 185, 145, 198, 202, 204, 155, 168, 175, 112, 60, 97, 134, 161, 128, 136, 184, 128, 192, 199, 203, 192, 161, 97, 134, 60,
+    70, 100, 135, 162, 135, 162, 185, 186, 193, 200, 168, 150, 168, 150, 112, 75, 72, 101, 136, 95, 136, 95, 128, 55, 153, 142, 97, 40, 97, 40, 60, 17,
+    9, 30, 48, 66, 56, 86, 123, 130, 30, 139, 66, 146, 86, 148, 130, 156, 26, 33, 58, 70, 92, 96, 133, 135, 139, 189, 145, 193, 196, 198, 202, 168,
+    25, 39, 64, 76, 144, 148, 154, 156, 39, 188, 76, 163, 148, 214, 156, 159, 31, 41, 68, 78, 145, 149, 155, 119, 140, 190, 147, 102, 198, 215, 168, 90,
+    51, 86, 104, 114, 104, 114, 170, 172, 86, 196, 114, 209, 114, 209, 172, 174, 63, 88, 107, 115, 110, 117, 171, 173, 148, 198, 166, 210, 209, 169, 211, 115,
+    57, 96, 105, 117, 164, 166, 176, 178, 96, 197, 117, 162, 166, 204, 178, 132, 67, 98, 108, 118, 165, 167, 177, 108, 149, 199, 167, 98, 210, 149, 165, 67,
+    26, 139, 58, 145, 92, 196, 133, 202, 33, 189, 70, 193, 96, 198, 135, 168, 38, 141, 93, 152, 191, 197, 201, 203, 141, 194, 152, 208, 197, 216, 203, 152,
+    31, 140, 68, 147, 145, 198, 155, 168, 41, 190, 78, 102, 149, 215, 119, 90, 40, 142, 95, 101, 192, 199, 161, 97, 142, 195, 101, 82, 199, 190, 97, 35,
+    63, 148, 107, 166, 110, 209, 171, 211, 88, 198, 115, 210, 117, 169, 173, 115, 75, 150, 112, 168, 186, 162, 185, 135, 150, 200, 168, 193, 162, 100, 135, 70,
+    67, 149, 108, 167, 165, 210, 177, 165, 98, 199, 118, 98, 167, 149, 108, 67, 77, 151, 113, 89, 137, 98, 126, 59, 151, 142, 89, 34, 98, 41, 59, 14,
+    11, 31, 50, 68, 58, 87, 124, 131, 39, 140, 94, 147, 96, 149, 135, 119, 28, 35, 60, 72, 93, 97, 134, 136, 188, 190, 192, 153, 197, 199, 203, 97,
+    31, 41, 68, 78, 145, 149, 155, 119, 140, 190, 147, 102, 198, 215, 168, 90, 35, 43, 72, 80, 152, 153, 158, 72, 190, 213, 153, 43, 216, 190, 152, 35,
+    63, 88, 110, 117, 107, 115, 171, 173, 148, 198, 209, 169, 166, 210, 211, 115, 84, 90, 112, 119, 112, 119, 175, 131, 214, 215, 204, 149, 204, 149, 202, 87,
+    88, 100, 117, 120, 166, 169, 179, 117, 198, 216, 169, 100, 218, 198, 166, 88, 90, 102, 119, 78, 168, 147, 155, 68, 215, 190, 149, 41, 198, 140, 145, 31,
+    58, 145, 124, 155, 133, 202, 183, 175, 96, 198, 135, 168, 160, 204, 185, 112, 93, 152, 134, 158, 201, 203, 205, 134, 197, 216, 203, 152, 219, 197, 201, 93,
+    87, 149, 131, 119, 202, 204, 175, 112, 149, 215, 119, 90, 204, 214, 112, 84, 97, 153, 136, 72, 203, 192, 134, 60, 199, 190, 97, 35, 197, 188, 93, 28,
+    107, 166, 171, 179, 171, 211, 212, 171, 166, 218, 211, 166, 179, 166, 171, 107, 112, 168, 175, 155, 185, 135, 183, 124, 204, 198, 202, 145, 160, 96, 133, 58,
+    115, 169, 173, 117, 211, 209, 171, 110, 210, 198, 115, 88, 166, 148, 107, 63, 119, 147, 131, 68, 135, 94, 124, 50, 149, 140, 87, 31, 96, 39, 58, 11,
+    9, 30, 56, 86, 48, 66, 123, 130, 30, 139, 86, 148, 66, 146, 130, 156, 26, 33, 92, 96, 58, 70, 133, 135, 139, 189, 196, 198, 145, 193, 202, 168,
+    51, 86, 104, 114, 104, 114, 170, 172, 86, 196, 114, 209, 114, 209, 172, 174, 63, 88, 110, 117, 107, 115, 171, 173, 148, 198, 209, 169, 166, 210, 211, 115,
+    25, 39, 144, 148, 64, 76, 154, 156, 39, 188, 148, 214, 76, 163, 156, 159, 31, 41, 145, 149, 68, 78, 155, 119, 140, 190, 198, 215, 147, 102, 168, 90,
+    57, 96, 164, 166, 105, 117, 176, 178, 96, 197, 166, 204, 117, 162, 178, 132, 67, 98, 165, 167, 108, 118, 177, 108, 149, 199, 210, 149, 167, 98, 165, 67,
+    26, 139, 92, 196, 58, 145, 133, 202, 33, 189, 96, 198, 70, 193, 135, 168, 38, 141, 191, 197, 93, 152, 201, 203, 141, 194, 197, 216, 152, 208, 203, 152,
+    63, 148, 110, 209, 107, 166, 171, 211, 88, 198, 117, 169, 115, 210, 173, 115, 75, 150, 186, 162, 112, 168, 185, 135, 150, 200, 162, 100, 168, 193, 135, 70,
+    31, 140, 145, 198, 68, 147, 155, 168, 41, 190, 149, 215, 78, 102, 119, 90, 40, 142, 192, 199, 95, 101, 161, 97, 142, 195, 199, 190, 101, 82, 97, 35,
+    67, 149, 165, 210, 108, 167, 177, 165, 98, 199, 167, 149, 118, 98, 108, 67, 77, 151, 137, 98, 113, 89, 126, 59, 151, 142, 98, 41, 89, 34, 59, 14,
+    11, 31, 58, 87, 50, 68, 124, 131, 39, 140, 96, 149, 94, 147, 135, 119, 28, 35, 93, 97, 60, 72, 134, 136, 188, 190, 197, 199, 192, 153, 203, 97,
+    63, 88, 107, 115, 110, 117, 171, 173, 148, 198, 166, 210, 209, 169, 211, 115, 84, 90, 112, 119, 112, 119, 175, 131, 214, 215, 204, 149, 204, 149, 202, 87,
+    31, 41, 145, 149, 68, 78, 155, 119, 140, 190, 198, 215, 147, 102, 168, 90, 35, 43, 152, 153, 72, 80, 158, 72, 190, 213, 216, 190, 153, 43, 152, 35,
+    88, 100, 166, 169, 117, 120, 179, 117, 198, 216, 218, 198, 169, 100, 166, 88, 90, 102, 168, 147, 119, 78, 155, 68, 215, 190, 198, 140, 149, 41, 145, 31,
+    58, 145, 133, 202, 124, 155, 183, 175, 96, 198, 160, 204, 135, 168, 185, 112, 93, 152, 201, 203, 134, 158, 205, 134, 197, 216, 219, 197, 203, 152, 201, 93,
+    107, 166, 171, 211, 171, 179, 212, 171, 166, 218, 179, 166, 211, 166, 171, 107, 112, 168, 185, 135, 175, 155, 183, 124, 204, 198, 160, 96, 202, 145, 133, 58,
+    87, 149, 202, 204, 131, 119, 175, 112, 149, 215, 204, 214, 119, 90, 112, 84, 97, 153, 203, 192, 136, 72, 134, 60, 199, 190, 197, 188, 97, 35, 93, 28,
+    115, 169, 211, 209, 173, 117, 171, 110, 210, 198, 166, 148, 115, 88, 107, 63, 119, 147, 135, 94, 131, 68, 124, 50, 149, 140, 96, 39, 87, 31, 58, 11,
+    13, 33, 57, 88, 57, 88, 125, 132, 33, 141, 88, 150, 88, 150, 132, 157, 33, 81, 96, 100, 96, 100, 160, 162, 189, 194, 198, 200, 198, 200, 204, 150,
+    57, 96, 105, 117, 164, 166, 176, 178, 96, 197, 117, 162, 166, 204, 178, 132, 88, 100, 117, 120, 166, 169, 179, 117, 198, 216, 169, 100, 218, 198, 166, 88,
+    57, 96, 164, 166, 105, 117, 176, 178, 96, 197, 166, 204, 117, 162, 178, 132, 88, 100, 166, 169, 117, 120, 179, 117, 198, 216, 218, 198, 169, 100, 166, 88,
+    125, 160, 176, 179, 176, 179, 180, 176, 160, 219, 179, 160, 179, 160, 176, 125, 132, 162, 178, 117, 178, 117, 176, 105, 204, 197, 166, 96, 166, 96, 164, 57,
+    33, 189, 96, 198, 96, 198, 160, 204, 81, 194, 100, 200, 100, 200, 162, 150, 141, 194, 197, 216, 197, 216, 219, 197, 194, 220, 216, 194, 216, 194, 197, 141,
+    88, 198, 117, 169, 166, 218, 179, 166, 100, 216, 120, 100, 169, 198, 117, 88, 150, 200, 162, 100, 204, 198, 160, 96, 200, 194, 100, 81, 198, 189, 96, 33,
+    88, 198, 166, 218, 117, 169, 179, 166, 100, 216, 169, 198, 120, 100, 117, 88, 150, 200, 204, 198, 162, 100, 160, 96, 200, 194, 198, 189, 100, 81, 96, 33,
+    132, 204, 178, 166, 178, 166, 176, 164, 162, 197, 117, 96, 117, 96, 105, 57, 157, 150, 132, 88, 132, 88, 125, 57, 150, 141, 88, 33, 88, 33, 57, 13,
+    14, 34, 59, 89, 59, 89, 126, 113, 41, 142, 98, 151, 98, 151, 137, 77, 35, 82, 97, 101, 97, 101, 161, 95, 190, 195, 199, 142, 199, 142, 192, 40,
+    67, 98, 108, 118, 165, 167, 177, 108, 149, 199, 167, 98, 210, 149, 165, 67, 90, 102, 119, 78, 168, 147, 155, 68, 215, 190, 149, 41, 198, 140, 145, 31,
+    67, 98, 165, 167, 108, 118, 177, 108, 149, 199, 210, 149, 167, 98, 165, 67, 90, 102, 168, 147, 119, 78, 155, 68, 215, 190, 198, 140, 149, 41, 145, 31,
+    132, 162, 178, 117, 178, 117, 176, 105, 204, 197, 166, 96, 166, 96, 164, 57, 159, 163, 156, 76, 156, 76, 154, 64, 214, 188, 148, 39, 148, 39, 144, 25,
+    70, 193, 135, 168, 135, 168, 185, 112, 100, 200, 162, 150, 162, 150, 186, 75, 152, 208, 203, 152, 203, 152, 201, 93, 216, 194, 197, 141, 197, 141, 191, 38,
+    115, 210, 173, 115, 211, 166, 171, 107, 169, 198, 117, 88, 209, 148, 110, 63, 168, 193, 135, 70, 202, 145, 133, 58, 198, 189, 96, 33, 196, 139, 92, 26,
+    115, 210, 211, 166, 173, 115, 171, 107, 169, 198, 209, 148, 117, 88, 110, 63, 168, 193, 202, 145, 135, 70, 133, 58, 198, 189, 196, 139, 96, 33, 92, 26,
+    174, 209, 172, 114, 172, 114, 170, 104, 209, 196, 114, 86, 114, 86, 104, 51, 156, 146, 130, 66, 130, 66, 123, 48, 148, 139, 86, 30, 86, 30, 56, 9,
+    6, 37, 49, 92, 49, 92, 122, 133, 26, 139, 58, 145, 58, 145, 124, 155, 49, 92, 122, 133, 122, 133, 181, 183, 92, 196, 133, 202, 133, 202, 183, 175,
+    26, 139, 58, 145, 92, 196, 133, 202, 33, 189, 70, 193, 96, 198, 135, 168, 58, 145, 124, 155, 133, 202, 183, 175, 96, 198, 135, 168, 160, 204, 185, 112,
+    26, 139, 92, 196, 58, 145, 133, 202, 33, 189, 96, 198, 70, 193, 135, 168, 58, 145, 133, 202, 124, 155, 183, 175, 96, 198, 160, 204, 135, 168, 185, 112,
+    33, 189, 96, 198, 96, 198, 160, 204, 81, 194, 100, 200, 100, 200, 162, 150, 70, 193, 135, 168, 135, 168, 185, 112, 100, 200, 162, 150, 162, 150, 186, 75,
+    22, 187, 54, 191, 54, 191, 127, 201, 28, 188, 60, 192, 60, 192, 128, 161, 54, 191, 127, 201, 127, 201, 182, 205, 93, 197, 134, 203, 134, 203, 184, 134,
+    28, 188, 60, 192, 93, 197, 134, 203, 35, 190, 72, 153, 97, 199, 136, 97, 60, 192, 128, 161, 134, 203, 184, 134, 97, 199, 136, 97, 161, 192, 128, 60,
+    28, 188, 93, 197, 60, 192, 134, 203, 35, 190, 97, 199, 72, 153, 136, 97, 60, 192, 134, 203, 128, 161, 184, 134, 97, 199, 161, 192, 136, 97, 128, 60,
+    35, 190, 97, 199, 97, 199, 161, 192, 82, 195, 101, 142, 101, 142, 95, 40, 72, 153, 136, 97, 136, 97, 128, 60, 101, 142, 95, 40, 95, 40, 55, 17,
+    16, 38, 54, 93, 54, 93, 127, 134, 38, 141, 93, 152, 93, 152, 134, 158, 54, 93, 127, 134, 127, 134, 182, 184, 191, 197, 201, 203, 201, 203, 205, 134,
+    38, 141, 93, 152, 191, 197, 201, 203, 141, 194, 152, 208, 197, 216, 203, 152, 93, 152, 134, 158, 201, 203, 205, 134, 197, 216, 203, 152, 219, 197, 201, 93,
+    38, 141, 191, 197, 93, 152, 201, 203, 141, 194, 197, 216, 152, 208, 203, 152, 93, 152, 201, 203, 134, 158, 205, 134, 197, 216, 219, 197, 203, 152, 201, 93,
+    141, 194, 197, 216, 197, 216, 219, 197, 194, 220, 216, 194, 216, 194, 197, 141, 152, 208, 203, 152, 203, 152, 201, 93, 216, 194, 197, 141, 197, 141, 191, 38,
+    54, 191, 127, 201, 127, 201, 182, 205, 93, 197, 134, 203, 134, 203, 184, 134, 127, 201, 182, 205, 182, 205, 221, 182, 201, 219, 205, 201, 205, 201, 182, 127,
+    93, 197, 134, 203, 201, 219, 205, 201, 152, 216, 158, 152, 203, 197, 134, 93, 134, 203, 184, 134, 205, 201, 182, 127, 203, 197, 134, 93, 201, 191, 127, 54,
+    93, 197, 201, 219, 134, 203, 205, 201, 152, 216, 203, 197, 158, 152, 134, 93, 134, 203, 205, 201, 184, 134, 182, 127, 203, 197, 201, 191, 134, 93, 127, 54,
+    152, 216, 203, 197, 203, 197, 201, 191, 208, 194, 152, 141, 152, 141, 93, 38, 158, 152, 134, 93, 134, 93, 127, 54, 152, 141, 93, 38, 93, 38, 54, 16,
+    11, 39, 50, 94, 58, 96, 124, 135, 31, 140, 68, 147, 87, 149, 131, 119, 58, 96, 124, 135, 133, 160, 183, 185, 145, 198, 155, 168, 202, 204, 175, 112,
+    31, 140, 68, 147, 145, 198, 155, 168, 41, 190, 78, 102, 149, 215, 119, 90, 87, 149, 131, 119, 202, 204, 175, 112, 149, 215, 119, 90, 204, 214, 112, 84,
+    63, 148, 110, 209, 107, 166, 171, 211, 88, 198, 117, 169, 115, 210, 173, 115, 107, 166, 171, 211, 171, 179, 212, 171, 166, 218, 179, 166, 211, 166, 171, 107,
+    88, 198, 117, 169, 166, 218, 179, 166, 100, 216, 120, 100, 169, 198, 117, 88, 115, 210, 173, 115, 211, 166, 171, 107, 169, 198, 117, 88, 209, 148, 110, 63,
+    28, 188, 60, 192, 93, 197, 134, 203, 35, 190, 72, 153, 97, 199, 136, 97, 93, 197, 134, 203, 201, 219, 205, 201, 152, 216, 158, 152, 203, 197, 134, 93,
+    35, 190, 72, 153, 152, 216, 158, 152, 43, 213, 80, 43, 153, 190, 72, 35, 97, 199, 136, 97, 203, 197, 134, 93, 153, 190, 72, 35, 192, 188, 60, 28,
+    84, 214, 112, 204, 112, 204, 175, 202, 90, 215, 119, 149, 119, 149, 131, 87, 112, 204, 175, 202, 185, 160, 183, 133, 168, 198, 155, 145, 135, 96, 124, 58,
+    90, 215, 119, 149, 168, 198, 155, 145, 102, 190, 78, 41, 147, 140, 68, 31, 119, 149, 131, 87, 135, 96, 124, 58, 147, 140, 68, 31, 94, 39, 50, 11,
+    17, 40, 55, 95, 60, 97, 128, 136, 40, 142, 95, 101, 97, 153, 136, 72, 60, 97, 128, 136, 134, 161, 184, 128, 192, 199, 161, 97, 203, 192, 134, 60,
+    40, 142, 95, 101, 192, 199, 161, 97, 142, 195, 101, 82, 199, 190, 97, 35, 97, 153, 136, 72, 203, 192, 134, 60, 199, 190, 97, 35, 197, 188, 93, 28,
+    75, 150, 186, 162, 112, 168, 185, 135, 150, 200, 162, 100, 168, 193, 135, 70, 112, 168, 185, 135, 175, 155, 183, 124, 204, 198, 160, 96, 202, 145, 133, 58,
+    150, 200, 162, 100, 204, 198, 160, 96, 200, 194, 100, 81, 198, 189, 96, 33, 168, 193, 135, 70, 202, 145, 133, 58, 198, 189, 96, 33, 196, 139, 92, 26,
+    60, 192, 128, 161, 134, 203, 184, 134, 97, 199, 136, 97, 161, 192, 128, 60, 134, 203, 184, 134, 205, 201, 182, 127, 203, 197, 134, 93, 201, 191, 127, 54,
+    97, 199, 136, 97, 203, 197, 134, 93, 153, 190, 72, 35, 192, 188, 60, 28, 161, 192, 128, 60, 201, 191, 127, 54, 192, 188, 60, 28, 191, 187, 54, 22,
+    112, 204, 185, 160, 175, 202, 183, 133, 168, 198, 135, 96, 155, 145, 124, 58, 175, 202, 183, 133, 183, 133, 181, 122, 202, 196, 133, 92, 133, 92, 122, 49,
+    168, 198, 135, 96, 202, 196, 133, 92, 193, 189, 70, 33, 145, 139, 58, 26, 155, 145, 124, 58, 133, 92, 122, 49, 145, 139, 58, 26, 92, 37, 49, 6,
+    11, 39, 58, 96, 50, 94, 124, 135, 31, 140, 87, 149, 68, 147, 131, 119, 58, 96, 133, 160, 124, 135, 183, 185, 145, 198, 202, 204, 155, 168, 175, 112,
+    63, 148, 107, 166, 110, 209, 171, 211, 88, 198, 115, 210, 117, 169, 173, 115, 107, 166, 171, 179, 171, 211, 212, 171, 166, 218, 211, 166, 179, 166, 171, 107,
+    31, 140, 145, 198, 68, 147, 155, 168, 41, 190, 149, 215, 78, 102, 119, 90, 87, 149, 202, 204, 131, 119, 175, 112, 149, 215, 204, 214, 119, 90, 112, 84,
+    88, 198, 166, 218, 117, 169, 179, 166, 100, 216, 169, 198, 120, 100, 117, 88, 115, 210, 211, 166, 173, 115, 171, 107, 169, 198, 209, 148, 117, 88, 110, 63,
+    28, 188, 93, 197, 60, 192, 134, 203, 35, 190, 97, 199, 72, 153, 136, 97, 93, 197, 201, 219, 134, 203, 205, 201, 152, 216, 203, 197, 158, 152, 134, 93,
+    84, 214, 112, 204, 112, 204, 175, 202, 90, 215, 119, 149, 119, 149, 131, 87, 112, 204, 185, 160, 175, 202, 183, 133, 168, 198, 135, 96, 155, 145, 124, 58,
+    35, 190, 152, 216, 72, 153, 158, 152, 43, 213, 153, 190, 80, 43, 72, 35, 97, 199, 203, 197, 136, 97, 134, 93, 153, 190, 192, 188, 72, 35, 60, 28,
+    90, 215, 168, 198, 119, 149, 155, 145, 102, 190, 147, 140, 78, 41, 68, 31, 119, 149, 135, 96, 131, 87, 124, 58, 147, 140, 94, 39, 68, 31, 50, 11,
+    17, 40, 60, 97, 55, 95, 128, 136, 40, 142, 97, 153, 95, 101, 136, 72, 60, 97, 134, 161, 128, 136, 184, 128, 192, 199, 203, 192, 161, 97, 134, 60,
+    75, 150, 112, 168, 186, 162, 185, 135, 150, 200, 168, 193, 162, 100, 135, 70, 112, 168, 175, 155, 185, 135, 183, 124, 204, 198, 202, 145, 160, 96, 133, 58,
+    40, 142, 192, 199, 95, 101, 161, 97, 142, 195, 199, 190, 101, 82, 97, 35, 97, 153, 203, 192, 136, 72, 134, 60, 199, 190, 197, 188, 97, 35, 93, 28,
+    150, 200, 204, 198, 162, 100, 160, 96, 200, 194, 198, 189, 100, 81, 96, 33, 168, 193, 202, 145, 135, 70, 133, 58, 198, 189, 196, 139, 96, 33, 92, 26,
+    60, 192, 134, 203, 128, 161, 184, 134, 97, 199, 161, 192, 136, 97, 128, 60, 134, 203, 205, 201, 184, 134, 182, 127, 203, 197, 201, 191, 134, 93, 127, 54,
+    112, 204, 175, 202, 185, 160, 183, 133, 168, 198, 155, 145, 135, 96, 124, 58, 175, 202, 183, 133, 183, 133, 181, 122, 202, 196, 133, 92, 133, 92, 122, 49,
+    97, 199, 203, 197, 136, 97, 134, 93, 153, 190, 192, 188, 72, 35, 60, 28, 161, 192, 201, 191, 128, 60, 127, 54, 192, 188, 191, 187, 60, 28, 54, 22,
+    168, 198, 202, 196, 135, 96, 133, 92, 193, 189, 145, 139, 70, 33, 58, 26, 155, 145, 133, 92, 124, 58, 122, 49, 145, 139, 92, 37, 58, 26, 49, 6,
+    14, 41, 59, 98, 59, 98, 126, 137, 34, 142, 89, 151, 89, 151, 113, 77, 70, 100, 135, 162, 135, 162, 185, 186, 193, 200, 168, 150, 168, 150, 112, 75,
+    67, 149, 108, 167, 165, 210, 177, 165, 98, 199, 118, 98, 167, 149, 108, 67, 115, 169, 173, 117, 211, 209, 171, 110, 210, 198, 115, 88, 166, 148, 107, 63,
+    67, 149, 165, 210, 108, 167, 177, 165, 98, 199, 167, 149, 118, 98, 108, 67, 115, 169, 211, 209, 173, 117, 171, 110, 210, 198, 166, 148, 115, 88, 107, 63,
+    132, 204, 178, 166, 178, 166, 176, 164, 162, 197, 117, 96, 117, 96, 105, 57, 174, 209, 172, 114, 172, 114, 170, 104, 209, 196, 114, 86, 114, 86, 104, 51,
+    35, 190, 97, 199, 97, 199, 161, 192, 82, 195, 101, 142, 101, 142, 95, 40, 152, 216, 203, 197, 203, 197, 201, 191, 208, 194, 152, 141, 152, 141, 93, 38,
+    90, 215, 119, 149, 168, 198, 155, 145, 102, 190, 78, 41, 147, 140, 68, 31, 168, 198, 135, 96, 202, 196, 133, 92, 193, 189, 70, 33, 145, 139, 58, 26,
+    90, 215, 168, 198, 119, 149, 155, 145, 102, 190, 147, 140, 78, 41, 68, 31, 168, 198, 202, 196, 135, 96, 133, 92, 193, 189, 145, 139, 70, 33, 58, 26,
+    159, 214, 156, 148, 156, 148, 154, 144, 163, 188, 76, 39, 76, 39, 64, 25, 156, 148, 130, 86, 130, 86, 123, 56, 146, 139, 66, 30, 66, 30, 48, 9,
+    18, 42, 61, 99, 61, 99, 129, 61, 42, 143, 99, 42, 99, 42, 61, 18, 72, 101, 136, 95, 136, 95, 128, 55, 153, 142, 97, 40, 97, 40, 60, 17,
+    77, 151, 113, 89, 137, 98, 126, 59, 151, 142, 89, 34, 98, 41, 59, 14, 119, 147, 131, 68, 135, 94, 124, 50, 149, 140, 87, 31, 96, 39, 58, 11,
+    77, 151, 137, 98, 113, 89, 126, 59, 151, 142, 98, 41, 89, 34, 59, 14, 119, 147, 135, 94, 131, 68, 124, 50, 149, 140, 96, 39, 87, 31, 58, 11,
+    157, 150, 132, 88, 132, 88, 125, 57, 150, 141, 88, 33, 88, 33, 57, 13, 156, 146, 130, 66, 130, 66, 123, 48, 148, 139, 86, 30, 86, 30, 56, 9,
+    72, 153, 136, 97, 136, 97, 128, 60, 101, 142, 95, 40, 95, 40, 55, 17, 158, 152, 134, 93, 134, 93, 127, 54, 152, 141, 93, 38, 93, 38, 54, 16,
+    119, 149, 131, 87, 135, 96, 124, 58, 147, 140, 68, 31, 94, 39, 50, 11, 155, 145, 124, 58, 133, 92, 122, 49, 145, 139, 58, 26, 92, 37, 49, 6,
+    119, 149, 135, 96, 131, 87, 124, 58, 147, 140, 94, 39, 68, 31, 50, 11, 155, 145, 133, 92, 124, 58, 122, 49, 145, 139, 92, 37, 58, 26, 49, 6,
+    156, 148, 130, 86, 130, 86, 123, 56, 146, 139, 66, 30, 66, 30, 48, 9, 154, 144, 123, 56, 123, 56, 121, 47, 144, 138, 56, 24, 56, 24, 47, 3,
+    4, 25, 48, 57, 48, 57, 123, 125, 62, 144, 104, 164, 104, 164, 170, 176, 7, 27, 50, 59, 50, 59, 124, 126, 74, 146, 110, 165, 110, 165, 171, 177,
+    10, 31, 52, 67, 66, 88, 130, 132, 66, 145, 106, 165, 114, 166, 172, 178, 12, 32, 53, 69, 68, 89, 131, 113, 76, 147, 111, 116, 117, 167, 173, 108,
+    10, 31, 66, 88, 52, 67, 130, 132, 66, 145, 114, 166, 106, 165, 172, 178, 12, 32, 68, 89, 53, 69, 131, 113, 76, 147, 117, 167, 111, 116, 173, 108,
+    14, 35, 67, 90, 67, 90, 132, 159, 70, 152, 115, 168, 115, 168, 174, 156, 15, 36, 69, 91, 69, 91, 113, 85, 78, 101, 118, 89, 118, 89, 111, 65,
+    11, 39, 58, 96, 58, 96, 133, 160, 63, 148, 107, 166, 107, 166, 171, 179, 17, 40, 60, 97, 60, 97, 134, 161, 75, 150, 112, 168, 112, 168, 175, 155,
+    14, 41, 59, 98, 70, 100, 135, 162, 67, 149, 108, 167, 115, 169, 173, 117, 18, 42, 61, 99, 72, 101, 136, 95, 77, 151, 113, 89, 119, 147, 131, 68,
+    14, 41, 70, 100, 59, 98, 135, 162, 67, 149, 115, 169, 108, 167, 173, 117, 18, 42, 72, 101, 61, 99, 136, 95, 77, 151, 119, 147, 113, 89, 131, 68,
+    19, 43, 71, 102, 71, 102, 137, 163, 71, 153, 116, 147, 116, 147, 111, 76, 20, 44, 73, 36, 73, 36, 61, 29, 79, 42, 69, 32, 69, 32, 53, 12,
+    7, 27, 50, 59, 50, 59, 124, 126, 74, 146, 110, 165, 110, 165, 171, 177, 23, 29, 55, 61, 55, 61, 128, 129, 206, 163, 186, 137, 186, 137, 185, 126,
+    27, 34, 59, 71, 94, 98, 135, 137, 146, 193, 165, 207, 209, 210, 211, 165, 29, 36, 61, 73, 95, 99, 136, 61, 163, 102, 137, 71, 162, 98, 135, 59,
+    27, 34, 94, 98, 59, 71, 135, 137, 146, 193, 209, 210, 165, 207, 211, 165, 29, 36, 95, 99, 61, 73, 136, 61, 163, 102, 162, 98, 137, 71, 135, 59,
+    34, 82, 98, 102, 98, 102, 162, 163, 193, 208, 210, 193, 210, 193, 209, 146, 36, 83, 99, 36, 99, 36, 95, 29, 102, 82, 98, 34, 98, 34, 94, 27,
+    50, 94, 124, 135, 124, 135, 183, 185, 110, 209, 171, 211, 171, 211, 212, 171, 55, 95, 128, 136, 128, 136, 184, 128, 186, 162, 185, 135, 185, 135, 183, 124,
+    59, 98, 126, 137, 135, 162, 185, 186, 165, 210, 177, 165, 211, 209, 171, 110, 61, 99, 129, 61, 136, 95, 128, 55, 137, 98, 126, 59, 135, 94, 124, 50,
+    59, 98, 135, 162, 126, 137, 185, 186, 165, 210, 211, 209, 177, 165, 171, 110, 61, 99, 136, 95, 129, 61, 128, 55, 137, 98, 135, 94, 126, 59, 124, 50,
+    71, 102, 137, 163, 137, 163, 186, 206, 207, 193, 165, 146, 165, 146, 110, 74, 73, 36, 61, 29, 61, 29, 55, 23, 71, 34, 59, 27, 59, 27, 50, 7,
+    10, 31, 52, 67, 66, 88, 130, 132, 66, 145, 106, 165, 114, 166, 172, 178, 27, 34, 59, 71, 94, 98, 135, 137, 146, 193, 165, 207, 209, 210, 211, 165,
+    27, 40, 65, 77, 146, 150, 156, 157, 94, 192, 111, 137, 209, 204, 174, 132, 32, 42, 69, 79, 147, 151, 119, 77, 147, 153, 116, 71, 169, 149, 115, 67,
+    52, 87, 106, 115, 106, 115, 172, 174, 130, 202, 172, 211, 172, 211, 217, 172, 65, 89, 108, 116, 111, 118, 173, 111, 156, 168, 178, 165, 174, 115, 172, 106,
+    59, 97, 108, 119, 165, 168, 178, 156, 135, 203, 173, 135, 211, 202, 172, 130, 69, 99, 109, 69, 116, 89, 108, 65, 119, 97, 108, 59, 115, 87, 106, 52,
+    31, 140, 87, 149, 145, 198, 202, 204, 88, 198, 115, 210, 166, 218, 211, 166, 40, 142, 97, 153, 192, 199, 203, 192, 150, 200, 168, 193, 204, 198, 202, 145,
+    34, 142, 89, 151, 193, 200, 168, 150, 98, 199, 118, 98, 210, 198, 115, 88, 42, 143, 99, 42, 153, 142, 97, 40, 151, 142, 89, 34, 149, 140, 87, 31,
+    67, 149, 115, 169, 165, 210, 211, 209, 132, 204, 174, 209, 178, 166, 172, 114, 77, 151, 119, 147, 137, 98, 135, 94, 157, 150, 156, 146, 132, 88, 130, 66,
+    71, 153, 116, 147, 207, 193, 165, 146, 137, 192, 111, 94, 165, 145, 106, 66, 79, 42, 69, 32, 71, 34, 59, 27, 77, 40, 65, 27, 67, 31, 52, 10,
+    12, 32, 53, 69, 68, 89, 131, 113, 76, 147, 111, 116, 117, 167, 173, 108, 29, 36, 61, 73, 95, 99, 136, 61, 163, 102, 137, 71, 162, 98, 135, 59,
+    32, 42, 69, 79, 147, 151, 119, 77, 147, 153, 116, 71, 169, 149, 115, 67, 36, 44, 73, 20, 101, 42, 72, 18, 102, 43, 71, 19, 100, 41, 70, 14,
+    65, 89, 111, 118, 108, 116, 173, 111, 156, 168, 174, 115, 178, 165, 172, 106, 85, 91, 113, 69, 113, 69, 131, 53, 159, 90, 132, 67, 132, 67, 130, 52,
+    89, 101, 118, 78, 167, 147, 117, 76, 168, 152, 115, 70, 166, 145, 114, 66, 91, 36, 69, 15, 89, 32, 68, 12, 90, 35, 67, 14, 88, 31, 66, 10,
+    68, 147, 131, 119, 155, 168, 175, 112, 117, 169, 173, 115, 179, 166, 171, 107, 95, 101, 136, 72, 161, 97, 134, 60, 162, 100, 135, 70, 160, 96, 133, 58,
+    89, 151, 113, 77, 168, 150, 112, 75, 167, 149, 108, 67, 166, 148, 107, 63, 99, 42, 61, 18, 97, 40, 60, 17, 98, 41, 59, 14, 96, 39, 58, 11,
+    108, 167, 173, 117, 177, 165, 171, 110, 178, 166, 172, 114, 176, 164, 170, 104, 113, 89, 131, 68, 126, 59, 124, 50, 132, 88, 130, 66, 125, 57, 123, 48,
+    116, 147, 111, 76, 165, 146, 110, 74, 165, 145, 106, 66, 164, 144, 104, 62, 69, 32, 53, 12, 59, 27, 50, 7, 67, 31, 52, 10, 57, 25, 48, 4,
+    10, 31, 66, 88, 52, 67, 130, 132, 66, 145, 114, 166, 106, 165, 172, 178, 27, 34, 94, 98, 59, 71, 135, 137, 146, 193, 209, 210, 165, 207, 211, 165,
+    52, 87, 106, 115, 106, 115, 172, 174, 130, 202, 172, 211, 172, 211, 217, 172, 65, 89, 111, 118, 108, 116, 173, 111, 156, 168, 174, 115, 178, 165, 172, 106,
+    27, 40, 146, 150, 65, 77, 156, 157, 94, 192, 209, 204, 111, 137, 174, 132, 32, 42, 147, 151, 69, 79, 119, 77, 147, 153, 169, 149, 116, 71, 115, 67,
+    59, 97, 165, 168, 108, 119, 178, 156, 135, 203, 211, 202, 173, 135, 172, 130, 69, 99, 116, 89, 109, 69, 108, 65, 119, 97, 115, 87, 108, 59, 106, 52,
+    31, 140, 145, 198, 87, 149, 202, 204, 88, 198, 166, 218, 115, 210, 211, 166, 40, 142, 192, 199, 97, 153, 203, 192, 150, 200, 204, 198, 168, 193, 202, 145,
+    67, 149, 165, 210, 115, 169, 211, 209, 132, 204, 178, 166, 174, 209, 172, 114, 77, 151, 137, 98, 119, 147, 135, 94, 157, 150, 132, 88, 156, 146, 130, 66,
+    34, 142, 193, 200, 89, 151, 168, 150, 98, 199, 210, 198, 118, 98, 115, 88, 42, 143, 153, 142, 99, 42, 97, 40, 151, 142, 149, 140, 89, 34, 87, 31,
+    71, 153, 207, 193, 116, 147, 165, 146, 137, 192, 165, 145, 111, 94, 106, 66, 79, 42, 71, 34, 69, 32, 59, 27, 77, 40, 67, 31, 65, 27, 52, 10,
+    12, 32, 68, 89, 53, 69, 131, 113, 76, 147, 117, 167, 111, 116, 173, 108, 29, 36, 95, 99, 61, 73, 136, 61, 163, 102, 162, 98, 137, 71, 135, 59,
+    65, 89, 108, 116, 111, 118, 173, 111, 156, 168, 178, 165, 174, 115, 172, 106, 85, 91, 113, 69, 113, 69, 131, 53, 159, 90, 132, 67, 132, 67, 130, 52,
+    32, 42, 147, 151, 69, 79, 119, 77, 147, 153, 169, 149, 116, 71, 115, 67, 36, 44, 101, 42, 73, 20, 72, 18, 102, 43, 100, 41, 71, 19, 70, 14,
+    89, 101, 167, 147, 118, 78, 117, 76, 168, 152, 166, 145, 115, 70, 114, 66, 91, 36, 89, 32, 69, 15, 68, 12, 90, 35, 88, 31, 67, 14, 66, 10,
+    68, 147, 155, 168, 131, 119, 175, 112, 117, 169, 179, 166, 173, 115, 171, 107, 95, 101, 161, 97, 136, 72, 134, 60, 162, 100, 160, 96, 135, 70, 133, 58,
+    108, 167, 177, 165, 173, 117, 171, 110, 178, 166, 176, 164, 172, 114, 170, 104, 113, 89, 126, 59, 131, 68, 124, 50, 132, 88, 125, 57, 130, 66, 123, 48,
+    89, 151, 168, 150, 113, 77, 112, 75, 167, 149, 166, 148, 108, 67, 107, 63, 99, 42, 97, 40, 61, 18, 60, 17, 98, 41, 96, 39, 59, 14, 58, 11,
+    116, 147, 165, 146, 111, 76, 110, 74, 165, 145, 164, 144, 106, 66, 104, 62, 69, 32, 59, 27, 53, 12, 50, 7, 67, 31, 57, 25, 52, 10, 48, 4,
+    14, 35, 67, 90, 67, 90, 132, 159, 70, 152, 115, 168, 115, 168, 174, 156, 34, 82, 98, 102, 98, 102, 162, 163, 193, 208, 210, 193, 210, 193, 209, 146,
+    59, 97, 108, 119, 165, 168, 178, 156, 135, 203, 173, 135, 211, 202, 172, 130, 89, 101, 118, 78, 167, 147, 117, 76, 168, 152, 115, 70, 166, 145, 114, 66,
+    59, 97, 165, 168, 108, 119, 178, 156, 135, 203, 211, 202, 173, 135, 172, 130, 89, 101, 167, 147, 118, 78, 117, 76, 168, 152, 166, 145, 115, 70, 114, 66,
+    126, 161, 177, 155, 177, 155, 176, 154, 185, 201, 171, 133, 171, 133, 170, 123, 113, 95, 108, 68, 108, 68, 105, 64, 112, 93, 107, 58, 107, 58, 104, 48,
+    41, 190, 149, 215, 149, 215, 204, 214, 100, 216, 169, 198, 169, 198, 209, 148, 142, 195, 199, 190, 199, 190, 197, 188, 200, 194, 198, 189, 198, 189, 196, 139,
+    98, 199, 167, 149, 210, 198, 166, 148, 162, 197, 117, 96, 209, 196, 114, 86, 151, 142, 98, 41, 149, 140, 96, 39, 150, 141, 88, 33, 148, 139, 86, 30,
+    98, 199, 210, 198, 167, 149, 166, 148, 162, 197, 209, 196, 117, 96, 114, 86, 151, 142, 149, 140, 98, 41, 96, 39, 150, 141, 148, 139, 88, 33, 86, 30,
+    137, 192, 165, 145, 165, 145, 164, 144, 186, 191, 110, 92, 110, 92, 104, 56, 77, 40, 67, 31, 67, 31, 57, 25, 75, 38, 63, 26, 63, 26, 51, 9,
+    15, 36, 69, 91, 69, 91, 113, 85, 78, 101, 118, 89, 118, 89, 111, 65, 36, 83, 99, 36, 99, 36, 95, 29, 102, 82, 98, 34, 98, 34, 94, 27,
+    69, 99, 109, 69, 116, 89, 108, 65, 119, 97, 108, 59, 115, 87, 106, 52, 91, 36, 69, 15, 89, 32, 68, 12, 90, 35, 67, 14, 88, 31, 66, 10,
+    69, 99, 116, 89, 109, 69, 108, 65, 119, 97, 115, 87, 108, 59, 106, 52, 91, 36, 89, 32, 69, 15, 68, 12, 90, 35, 88, 31, 67, 14, 66, 10,
+    113, 95, 108, 68, 108, 68, 105, 64, 112, 93, 107, 58, 107, 58, 104, 48, 85, 29, 65, 12, 65, 12, 64, 5, 84, 28, 63, 11, 63, 11, 62, 4,
+    78, 102, 119, 90, 119, 90, 112, 84, 120, 100, 117, 88, 117, 88, 110, 63, 101, 82, 97, 35, 97, 35, 93, 28, 100, 81, 96, 33, 96, 33, 92, 26,
+    118, 98, 108, 67, 115, 88, 107, 63, 117, 96, 105, 57, 114, 86, 104, 51, 89, 34, 59, 14, 87, 31, 58, 11, 88, 33, 57, 13, 86, 30, 56, 9,
+    118, 98, 115, 88, 108, 67, 107, 63, 117, 96, 114, 86, 105, 57, 104, 51, 89, 34, 87, 31, 59, 14, 58, 11, 88, 33, 86, 30, 57, 13, 56, 9,
+    111, 94, 106, 66, 106, 66, 104, 62, 110, 92, 104, 56, 104, 56, 103, 46, 65, 27, 52, 10, 52, 10, 48, 4, 63, 26, 51, 9, 51, 9, 46, 2,
+    11, 39, 58, 96, 58, 96, 133, 160, 63, 148, 107, 166, 107, 166, 171, 179, 50, 94, 124, 135, 124, 135, 183, 185, 110, 209, 171, 211, 171, 211, 212, 171,
+    31, 140, 87, 149, 145, 198, 202, 204, 88, 198, 115, 210, 166, 218, 211, 166, 68, 147, 131, 119, 155, 168, 175, 112, 117, 169, 173, 115, 179, 166, 171, 107,
+    31, 140, 145, 198, 87, 149, 202, 204, 88, 198, 166, 218, 115, 210, 211, 166, 68, 147, 155, 168, 131, 119, 175, 112, 117, 169, 179, 166, 173, 115, 171, 107,
+    41, 190, 149, 215, 149, 215, 204, 214, 100, 216, 169, 198, 169, 198, 209, 148, 78, 102, 119, 90, 119, 90, 112, 84, 120, 100, 117, 88, 117, 88, 110, 63,
+    28, 188, 93, 197, 93, 197, 201, 219, 84, 214, 112, 204, 112, 204, 185, 160, 60, 192, 134, 203, 134, 203, 205, 201, 112, 204, 175, 202, 175, 202, 183, 133,
+    35, 190, 97, 199, 152, 216, 203, 197, 90, 215, 119, 149, 168, 198, 135, 96, 72, 153, 136, 97, 158, 152, 134, 93, 119, 149, 131, 87, 155, 145, 124, 58,
+    35, 190, 152, 216, 97, 199, 203, 197, 90, 215, 168, 198, 119, 149, 135, 96, 72, 153, 158, 152, 136, 97, 134, 93, 119, 149, 155, 145, 131, 87, 124, 58,
+    43, 213, 153, 190, 153, 190, 192, 188, 102, 190, 147, 140, 147, 140, 94, 39, 80, 43, 72, 35, 72, 35, 60, 28, 78, 41, 68, 31, 68, 31, 50, 11,
+    17, 40, 60, 97, 60, 97, 134, 161, 75, 150, 112, 168, 112, 168, 175, 155, 55, 95, 128, 136, 128, 136, 184, 128, 186, 162, 185, 135, 185, 135, 183, 124,
+    40, 142, 97, 153, 192, 199, 203, 192, 150, 200, 168, 193, 204, 198, 202, 145, 95, 101, 136, 72, 161, 97, 134, 60, 162, 100, 135, 70, 160, 96, 133, 58,
+    40, 142, 192, 199, 97, 153, 203, 192, 150, 200, 204, 198, 168, 193, 202, 145, 95, 101, 161, 97, 136, 72, 134, 60, 162, 100, 160, 96, 135, 70, 133, 58,
+    142, 195, 199, 190, 199, 190, 197, 188, 200, 194, 198, 189, 198, 189, 196, 139, 101, 82, 97, 35, 97, 35, 93, 28, 100, 81, 96, 33, 96, 33, 92, 26,
+    60, 192, 134, 203, 134, 203, 205, 201, 112, 204, 175, 202, 175, 202, 183, 133, 128, 161, 184, 134, 184, 134, 182, 127, 185, 160, 183, 133, 183, 133, 181, 122,
+    97, 199, 161, 192, 203, 197, 201, 191, 168, 198, 155, 145, 202, 196, 133, 92, 136, 97, 128, 60, 134, 93, 127, 54, 135, 96, 124, 58, 133, 92, 122, 49,
+    97, 199, 203, 197, 161, 192, 201, 191, 168, 198, 202, 196, 155, 145, 133, 92, 136, 97, 134, 93, 128, 60, 127, 54, 135, 96, 133, 92, 124, 58, 122, 49,
+    153, 190, 192, 188, 192, 188, 191, 187, 193, 189, 145, 139, 145, 139, 92, 37, 72, 35, 60, 28, 60, 28, 54, 22, 70, 33, 58, 26, 58, 26, 49, 6,
+    14, 41, 59, 98, 70, 100, 135, 162, 67, 149, 108, 167, 115, 169, 173, 117, 59, 98, 126, 137, 135, 162, 185, 186, 165, 210, 177, 165, 211, 209, 171, 110,
+    34, 142, 89, 151, 193, 200, 168, 150, 98, 199, 118, 98, 210, 198, 115, 88, 89, 151, 113, 77, 168, 150, 112, 75, 167, 149, 108, 67, 166, 148, 107, 63,
+    67, 149, 165, 210, 115, 169, 211, 209, 132, 204, 178, 166, 174, 209, 172, 114, 108, 167, 177, 165, 173, 117, 171, 110, 178, 166, 176, 164, 172, 114, 170, 104,
+    98, 199, 167, 149, 210, 198, 166, 148, 162, 197, 117, 96, 209, 196, 114, 86, 118, 98, 108, 67, 115, 88, 107, 63, 117, 96, 105, 57, 114, 86, 104, 51,
+    35, 190, 97, 199, 152, 216, 203, 197, 90, 215, 119, 149, 168, 198, 135, 96, 97, 199, 161, 192, 203, 197, 201, 191, 168, 198, 155, 145, 202, 196, 133, 92,
+    82, 195, 101, 142, 208, 194, 152, 141, 102, 190, 78, 41, 193, 189, 70, 33, 101, 142, 95, 40, 152, 141, 93, 38, 147, 140, 68, 31, 145, 139, 58, 26,
+    90, 215, 168, 198, 168, 198, 202, 196, 159, 214, 156, 148, 156, 148, 130, 86, 119, 149, 155, 145, 135, 96, 133, 92, 156, 148, 154, 144, 130, 86, 123, 56,
+    102, 190, 147, 140, 193, 189, 145, 139, 163, 188, 76, 39, 146, 139, 66, 30, 78, 41, 68, 31, 70, 33, 58, 26, 76, 39, 64, 25, 66, 30, 48, 9,
+    18, 42, 61, 99, 72, 101, 136, 95, 77, 151, 113, 89, 119, 147, 131, 68, 61, 99, 129, 61, 136, 95, 128, 55, 137, 98, 126, 59, 135, 94, 124, 50,
+    42, 143, 99, 42, 153, 142, 97, 40, 151, 142, 89, 34, 149, 140, 87, 31, 99, 42, 61, 18, 97, 40, 60, 17, 98, 41, 59, 14, 96, 39, 58, 11,
+    77, 151, 137, 98, 119, 147, 135, 94, 157, 150, 132, 88, 156, 146, 130, 66, 113, 89, 126, 59, 131, 68, 124, 50, 132, 88, 125, 57, 130, 66, 123, 48,
+    151, 142, 98, 41, 149, 140, 96, 39, 150, 141, 88, 33, 148, 139, 86, 30, 89, 34, 59, 14, 87, 31, 58, 11, 88, 33, 57, 13, 86, 30, 56, 9,
+    72, 153, 136, 97, 158, 152, 134, 93, 119, 149, 131, 87, 155, 145, 124, 58, 136, 97, 128, 60, 134, 93, 127, 54, 135, 96, 124, 58, 133, 92, 122, 49,
+    101, 142, 95, 40, 152, 141, 93, 38, 147, 140, 68, 31, 145, 139, 58, 26, 95, 40, 55, 17, 93, 38, 54, 16, 94, 39, 50, 11, 92, 37, 49, 6,
+    119, 149, 135, 96, 155, 145, 133, 92, 156, 148, 130, 86, 154, 144, 123, 56, 131, 87, 124, 58, 124, 58, 122, 49, 130, 86, 123, 56, 123, 56, 121, 47,
+    147, 140, 94, 39, 145, 139, 92, 37, 146, 139, 66, 30, 144, 138, 56, 24, 68, 31, 50, 11, 58, 26, 49, 6, 66, 30, 48, 9, 56, 24, 47, 3,
+    14, 41, 70, 100, 59, 98, 135, 162, 67, 149, 115, 169, 108, 167, 173, 117, 59, 98, 135, 162, 126, 137, 185, 186, 165, 210, 211, 209, 177, 165, 171, 110,
+    67, 149, 115, 169, 165, 210, 211, 209, 132, 204, 174, 209, 178, 166, 172, 114, 108, 167, 173, 117, 177, 165, 171, 110, 178, 166, 172, 114, 176, 164, 170, 104,
+    34, 142, 193, 200, 89, 151, 168, 150, 98, 199, 210, 198, 118, 98, 115, 88, 89, 151, 168, 150, 113, 77, 112, 75, 167, 149, 166, 148, 108, 67, 107, 63,
+    98, 199, 210, 198, 167, 149, 166, 148, 162, 197, 209, 196, 117, 96, 114, 86, 118, 98, 115, 88, 108, 67, 107, 63, 117, 96, 114, 86, 105, 57, 104, 51,
+    35, 190, 152, 216, 97, 199, 203, 197, 90, 215, 168, 198, 119, 149, 135, 96, 97, 199, 203, 197, 161, 192, 201, 191, 168, 198, 202, 196, 155, 145, 133, 92,
+    90, 215, 168, 198, 168, 198, 202, 196, 159, 214, 156, 148, 156, 148, 130, 86, 119, 149, 135, 96, 155, 145, 133, 92, 156, 148, 130, 86, 154, 144, 123, 56,
+    82, 195, 208, 194, 101, 142, 152, 141, 102, 190, 193, 189, 78, 41, 70, 33, 101, 142, 152, 141, 95, 40, 93, 38, 147, 140, 145, 139, 68, 31, 58, 26,
+    102, 190, 193, 189, 147, 140, 145, 139, 163, 188, 146, 139, 76, 39, 66, 30, 78, 41, 70, 33, 68, 31, 58, 26, 76, 39, 66, 30, 64, 25, 48, 9,
+    18, 42, 72, 101, 61, 99, 136, 95, 77, 151, 119, 147, 113, 89, 131, 68, 61, 99, 136, 95, 129, 61, 128, 55, 137, 98, 135, 94, 126, 59, 124, 50,
+    77, 151, 119, 147, 137, 98, 135, 94, 157, 150, 156, 146, 132, 88, 130, 66, 113, 89, 131, 68, 126, 59, 124, 50, 132, 88, 130, 66, 125, 57, 123, 48,
+    42, 143, 153, 142, 99, 42, 97, 40, 151, 142, 149, 140, 89, 34, 87, 31, 99, 42, 97, 40, 61, 18, 60, 17, 98, 41, 96, 39, 59, 14, 58, 11,
+    151, 142, 149, 140, 98, 41, 96, 39, 150, 141, 148, 139, 88, 33, 86, 30, 89, 34, 87, 31, 59, 14, 58, 11, 88, 33, 86, 30, 57, 13, 56, 9,
+    72, 153, 158, 152, 136, 97, 134, 93, 119, 149, 155, 145, 131, 87, 124, 58, 136, 97, 134, 93, 128, 60, 127, 54, 135, 96, 133, 92, 124, 58, 122, 49,
+    119, 149, 155, 145, 135, 96, 133, 92, 156, 148, 154, 144, 130, 86, 123, 56, 131, 87, 124, 58, 124, 58, 122, 49, 130, 86, 123, 56, 123, 56, 121, 47,
+    101, 142, 152, 141, 95, 40, 93, 38, 147, 140, 145, 139, 68, 31, 58, 26, 95, 40, 93, 38, 55, 17, 54, 16, 94, 39, 92, 37, 50, 11, 49, 6,
+    147, 140, 145, 139, 94, 39, 92, 37, 146, 139, 144, 138, 66, 30, 56, 24, 68, 31, 58, 26, 50, 11, 49, 6, 66, 30, 56, 24, 48, 9, 47, 3,
+    19, 43, 71, 102, 71, 102, 137, 163, 71, 153, 116, 147, 116, 147, 111, 76, 71, 102, 137, 163, 137, 163, 186, 206, 207, 193, 165, 146, 165, 146, 110, 74,
+    71, 153, 116, 147, 207, 193, 165, 146, 137, 192, 111, 94, 165, 145, 106, 66, 116, 147, 111, 76, 165, 146, 110, 74, 165, 145, 106, 66, 164, 144, 104, 62,
+    71, 153, 207, 193, 116, 147, 165, 146, 137, 192, 165, 145, 111, 94, 106, 66, 116, 147, 165, 146, 111, 76, 110, 74, 165, 145, 164, 144, 106, 66, 104, 62,
+    137, 192, 165, 145, 165, 145, 164, 144, 186, 191, 110, 92, 110, 92, 104, 56, 111, 94, 106, 66, 106, 66, 104, 62, 110, 92, 104, 56, 104, 56, 103, 46,
+    43, 213, 153, 190, 153, 190, 192, 188, 102, 190, 147, 140, 147, 140, 94, 39, 153, 190, 192, 188, 192, 188, 191, 187, 193, 189, 145, 139, 145, 139, 92, 37,
+    102, 190, 147, 140, 193, 189, 145, 139, 163, 188, 76, 39, 146, 139, 66, 30, 147, 140, 94, 39, 145, 139, 92, 37, 146, 139, 66, 30, 144, 138, 56, 24,
+    102, 190, 193, 189, 147, 140, 145, 139, 163, 188, 146, 139, 76, 39, 66, 30, 147, 140, 145, 139, 94, 39, 92, 37, 146, 139, 144, 138, 66, 30, 56, 24,
+    163, 188, 146, 139, 146, 139, 144, 138, 206, 187, 74, 37, 74, 37, 62, 24, 76, 39, 66, 30, 66, 30, 56, 24, 74, 37, 62, 24, 62, 24, 46, 8,
+    20, 44, 73, 36, 73, 36, 61, 29, 79, 42, 69, 32, 69, 32, 53, 12, 73, 36, 61, 29, 61, 29, 55, 23, 71, 34, 59, 27, 59, 27, 50, 7,
+    79, 42, 69, 32, 71, 34, 59, 27, 77, 40, 65, 27, 67, 31, 52, 10, 69, 32, 53, 12, 59, 27, 50, 7, 67, 31, 52, 10, 57, 25, 48, 4,
+    79, 42, 71, 34, 69, 32, 59, 27, 77, 40, 67, 31, 65, 27, 52, 10, 69, 32, 59, 27, 53, 12, 50, 7, 67, 31, 57, 25, 52, 10, 48, 4,
+    77, 40, 67, 31, 67, 31, 57, 25, 75, 38, 63, 26, 63, 26, 51, 9, 65, 27, 52, 10, 52, 10, 48, 4, 63, 26, 51, 9, 51, 9, 46, 2,
+    80, 43, 72, 35, 72, 35, 60, 28, 78, 41, 68, 31, 68, 31, 50, 11, 72, 35, 60, 28, 60, 28, 54, 22, 70, 33, 58, 26, 58, 26, 49, 6,
+    78, 41, 68, 31, 70, 33, 58, 26, 76, 39, 64, 25, 66, 30, 48, 9, 68, 31, 50, 11, 58, 26, 49, 6, 66, 30, 48, 9, 56, 24, 47, 3,
+    78, 41, 70, 33, 68, 31, 58, 26, 76, 39, 66, 30, 64, 25, 48, 9, 68, 31, 58, 26, 50, 11, 49, 6, 66, 30, 56, 24, 48, 9, 47, 3,
+    76, 39, 66, 30, 66, 30, 56, 24, 74, 37, 62, 24, 62, 24, 46, 8, 64, 25, 48, 9, 48, 9, 47, 3, 62, 24, 46, 8, 46, 8, 45, 1,
+    1, 45, 8, 46, 8, 46, 24, 62, 3, 47, 9, 48, 9, 48, 25, 64, 8, 46, 24, 62, 24, 62, 37, 74, 24, 56, 30, 66, 30, 66, 39, 76,
+    3, 47, 9, 48, 24, 56, 30, 66, 6, 49, 11, 50, 26, 58, 31, 68, 9, 48, 25, 64, 30, 66, 39, 76, 26, 58, 31, 68, 33, 70, 41, 78,
+    3, 47, 24, 56, 9, 48, 30, 66, 6, 49, 26, 58, 11, 50, 31, 68, 9, 48, 30, 66, 25, 64, 39, 76, 26, 58, 33, 70, 31, 68, 41, 78,
+    6, 49, 26, 58, 26, 58, 33, 70, 22, 54, 28, 60, 28, 60, 35, 72, 11, 50, 31, 68, 31, 68, 41, 78, 28, 60, 35, 72, 35, 72, 43, 80,
+    2, 46, 9, 51, 9, 51, 26, 63, 4, 48, 10, 52, 10, 52, 27, 65, 9, 51, 26, 63, 26, 63, 38, 75, 25, 57, 31, 67, 31, 67, 40, 77,
+    4, 48, 10, 52, 25, 57, 31, 67, 7, 50, 12, 53, 27, 59, 32, 69, 10, 52, 27, 65, 31, 67, 40, 77, 27, 59, 32, 69, 34, 71, 42, 79,
+    4, 48, 25, 57, 10, 52, 31, 67, 7, 50, 27, 59, 12, 53, 32, 69, 10, 52, 31, 67, 27, 65, 40, 77, 27, 59, 34, 71, 32, 69, 42, 79,
+    7, 50, 27, 59, 27, 59, 34, 71, 23, 55, 29, 61, 29, 61, 36, 73, 12, 53, 32, 69, 32, 69, 42, 79, 29, 61, 36, 73, 36, 73, 44, 20,
+    8, 46, 24, 62, 24, 62, 37, 74, 24, 56, 30, 66, 30, 66, 39, 76, 24, 62, 37, 74, 37, 74, 187, 206, 138, 144, 139, 146, 139, 146, 188, 163,
+    24, 56, 30, 66, 138, 144, 139, 146, 37, 92, 39, 94, 139, 145, 140, 147, 30, 66, 39, 76, 139, 146, 188, 163, 139, 145, 140, 147, 189, 193, 190, 102,
+    24, 56, 138, 144, 30, 66, 139, 146, 37, 92, 139, 145, 39, 94, 140, 147, 30, 66, 139, 146, 39, 76, 188, 163, 139, 145, 189, 193, 140, 147, 190, 102,
+    37, 92, 139, 145, 139, 145, 189, 193, 187, 191, 188, 192, 188, 192, 190, 153, 39, 94, 140, 147, 140, 147, 190, 102, 188, 192, 190, 153, 190, 153, 213, 43,
+    46, 103, 56, 104, 56, 104, 92, 110, 62, 104, 66, 106, 66, 106, 94, 111, 56, 104, 92, 110, 92, 110, 191, 186, 144, 164, 145, 165, 145, 165, 192, 137,
+    62, 104, 66, 106, 144, 164, 145, 165, 74, 110, 76, 111, 146, 165, 147, 116, 66, 106, 94, 111, 145, 165, 192, 137, 146, 165, 147, 116, 193, 207, 153, 71,
+    62, 104, 144, 164, 66, 106, 145, 165, 74, 110, 146, 165, 76, 111, 147, 116, 66, 106, 145, 165, 94, 111, 192, 137, 146, 165, 193, 207, 147, 116, 153, 71,
+    74, 110, 146, 165, 146, 165, 193, 207, 206, 186, 163, 137, 163, 137, 102, 71, 76, 111, 147, 116, 147, 116, 153, 71, 163, 137, 102, 71, 102, 71, 43, 19,
+    3, 47, 9, 48, 24, 56, 30, 66, 6, 49, 11, 50, 26, 58, 31, 68, 24, 56, 30, 66, 138, 144, 139, 146, 37, 92, 39, 94, 139, 145, 140, 147,
+    6, 49, 11, 50, 37, 92, 39, 94, 16, 54, 17, 55, 38, 93, 40, 95, 26, 58, 31, 68, 139, 145, 140, 147, 38, 93, 40, 95, 141, 152, 142, 101,
+    47, 121, 56, 123, 56, 123, 86, 130, 49, 122, 58, 124, 58, 124, 87, 131, 56, 123, 86, 130, 144, 154, 148, 156, 92, 133, 96, 135, 145, 155, 149, 119,
+    49, 122, 58, 124, 92, 133, 96, 135, 54, 127, 60, 128, 93, 134, 97, 136, 58, 124, 87, 131, 145, 155, 149, 119, 93, 134, 97, 136, 152, 158, 153, 72,
+    9, 56, 13, 57, 30, 86, 33, 88, 11, 58, 14, 59, 31, 87, 34, 89, 30, 86, 33, 88, 139, 148, 141, 150, 39, 96, 41, 98, 140, 149, 142, 151,
+    11, 58, 14, 59, 39, 96, 41, 98, 17, 60, 18, 61, 40, 97, 42, 99, 31, 87, 34, 89, 140, 149, 142, 151, 40, 97, 42, 99, 142, 153, 143, 42,
+    48, 123, 57, 125, 66, 130, 88, 132, 50, 124, 59, 126, 68, 131, 89, 113, 66, 130, 88, 132, 146, 156, 150, 157, 94, 135, 98, 137, 147, 119, 151, 77,
+    50, 124, 59, 126, 94, 135, 98, 137, 55, 128, 61, 129, 95, 136, 99, 61, 68, 131, 89, 113, 147, 119, 151, 77, 95, 136, 99, 61, 101, 72, 42, 18,
+    9, 48, 25, 64, 30, 66, 39, 76, 26, 58, 31, 68, 33, 70, 41, 78, 30, 66, 39, 76, 139, 146, 188, 163, 139, 145, 140, 147, 189, 193, 190, 102,
+    26, 58, 31, 68, 139, 145, 140, 147, 38, 93, 40, 95, 141, 152, 142, 101, 33, 70, 41, 78, 189, 193, 190, 102, 141, 152, 142, 101, 194, 208, 195, 82,
+    56, 123, 144, 154, 86, 130, 148, 156, 92, 133, 145, 155, 96, 135, 149, 119, 86, 130, 148, 156, 148, 156, 214, 159, 196, 202, 198, 168, 198, 168, 215, 90,
+    92, 133, 145, 155, 196, 202, 198, 168, 191, 201, 192, 161, 197, 203, 199, 97, 96, 135, 149, 119, 198, 168, 215, 90, 197, 203, 199, 97, 216, 152, 190, 35,
+    51, 104, 57, 105, 86, 114, 96, 117, 63, 107, 67, 108, 88, 115, 98, 118, 86, 114, 96, 117, 196, 209, 197, 162, 148, 166, 149, 167, 198, 210, 199, 98,
+    63, 107, 67, 108, 148, 166, 149, 167, 75, 112, 77, 113, 150, 168, 151, 89, 88, 115, 98, 118, 198, 210, 199, 98, 150, 168, 151, 89, 200, 193, 142, 34,
+    104, 170, 164, 176, 114, 172, 166, 178, 110, 171, 165, 177, 117, 173, 167, 108, 114, 172, 166, 178, 209, 174, 204, 132, 209, 211, 210, 165, 169, 115, 149, 67,
+    110, 171, 165, 177, 209, 211, 210, 165, 186, 185, 137, 126, 162, 135, 98, 59, 117, 173, 167, 108, 169, 115, 149, 67, 162, 135, 98, 59, 100, 70, 41, 14,
+    3, 47, 24, 56, 9, 48, 30, 66, 6, 49, 26, 58, 11, 50, 31, 68, 24, 56, 138, 144, 30, 66, 139, 146, 37, 92, 139, 145, 39, 94, 140, 147,
+    47, 121, 56, 123, 56, 123, 86, 130, 49, 122, 58, 124, 58, 124, 87, 131, 56, 123, 144, 154, 86, 130, 148, 156, 92, 133, 145, 155, 96, 135, 149, 119,
+    6, 49, 37, 92, 11, 50, 39, 94, 16, 54, 38, 93, 17, 55, 40, 95, 26, 58, 139, 145, 31, 68, 140, 147, 38, 93, 141, 152, 40, 95, 142, 101,
+    49, 122, 92, 133, 58, 124, 96, 135, 54, 127, 93, 134, 60, 128, 97, 136, 58, 124, 145, 155, 87, 131, 149, 119, 93, 134, 152, 158, 97, 136, 153, 72,
+    9, 56, 30, 86, 13, 57, 33, 88, 11, 58, 31, 87, 14, 59, 34, 89, 30, 86, 139, 148, 33, 88, 141, 150, 39, 96, 140, 149, 41, 98, 142, 151,
+    48, 123, 66, 130, 57, 125, 88, 132, 50, 124, 68, 131, 59, 126, 89, 113, 66, 130, 146, 156, 88, 132, 150, 157, 94, 135, 147, 119, 98, 137, 151, 77,
+    11, 58, 39, 96, 14, 59, 41, 98, 17, 60, 40, 97, 18, 61, 42, 99, 31, 87, 140, 149, 34, 89, 142, 151, 40, 97, 142, 153, 42, 99, 143, 42,
+    50, 124, 94, 135, 59, 126, 98, 137, 55, 128, 95, 136, 61, 129, 99, 61, 68, 131, 147, 119, 89, 113, 151, 77, 95, 136, 101, 72, 99, 61, 42, 18,
+    9, 48, 30, 66, 25, 64, 39, 76, 26, 58, 33, 70, 31, 68, 41, 78, 30, 66, 139, 146, 39, 76, 188, 163, 139, 145, 189, 193, 140, 147, 190, 102,
+    56, 123, 86, 130, 144, 154, 148, 156, 92, 133, 96, 135, 145, 155, 149, 119, 86, 130, 148, 156, 148, 156, 214, 159, 196, 202, 198, 168, 198, 168, 215, 90,
+    26, 58, 139, 145, 31, 68, 140, 147, 38, 93, 141, 152, 40, 95, 142, 101, 33, 70, 189, 193, 41, 78, 190, 102, 141, 152, 194, 208, 142, 101, 195, 82,
+    92, 133, 196, 202, 145, 155, 198, 168, 191, 201, 197, 203, 192, 161, 199, 97, 96, 135, 198, 168, 149, 119, 215, 90, 197, 203, 216, 152, 199, 97, 190, 35,
+    51, 104, 86, 114, 57, 105, 96, 117, 63, 107, 88, 115, 67, 108, 98, 118, 86, 114, 196, 209, 96, 117, 197, 162, 148, 166, 198, 210, 149, 167, 199, 98,
+    104, 170, 114, 172, 164, 176, 166, 178, 110, 171, 117, 173, 165, 177, 167, 108, 114, 172, 209, 174, 166, 178, 204, 132, 209, 211, 169, 115, 210, 165, 149, 67,
+    63, 107, 148, 166, 67, 108, 149, 167, 75, 112, 150, 168, 77, 113, 151, 89, 88, 115, 198, 210, 98, 118, 199, 98, 150, 168, 200, 193, 151, 89, 142, 34,
+    110, 171, 209, 211, 165, 177, 210, 165, 186, 185, 162, 135, 137, 126, 98, 59, 117, 173, 169, 115, 167, 108, 149, 67, 162, 135, 100, 70, 98, 59, 41, 14,
+    6, 49, 26, 58, 26, 58, 33, 70, 22, 54, 28, 60, 28, 60, 35, 72, 37, 92, 139, 145, 139, 145, 189, 193, 187, 191, 188, 192, 188, 192, 190, 153,
+    49, 122, 58, 124, 92, 133, 96, 135, 54, 127, 60, 128, 93, 134, 97, 136, 92, 133, 145, 155, 196, 202, 198, 168, 191, 201, 192, 161, 197, 203, 199, 97,
+    49, 122, 92, 133, 58, 124, 96, 135, 54, 127, 93, 134, 60, 128, 97, 136, 92, 133, 196, 202, 145, 155, 198, 168, 191, 201, 197, 203, 192, 161, 199, 97,
+    122, 181, 133, 183, 133, 183, 160, 185, 127, 182, 134, 184, 134, 184, 161, 128, 133, 183, 202, 175, 202, 175, 204, 112, 201, 205, 203, 134, 203, 134, 192, 60,
+    26, 92, 33, 96, 33, 96, 81, 100, 28, 93, 35, 97, 35, 97, 82, 101, 139, 196, 189, 198, 189, 198, 194, 200, 188, 197, 190, 199, 190, 199, 195, 142,
+    58, 133, 70, 135, 96, 160, 100, 162, 60, 134, 72, 136, 97, 161, 101, 95, 145, 202, 193, 168, 198, 204, 200, 150, 192, 203, 153, 97, 199, 192, 142, 40,
+    58, 133, 96, 160, 70, 135, 100, 162, 60, 134, 97, 161, 72, 136, 101, 95, 145, 202, 198, 204, 193, 168, 200, 150, 192, 203, 199, 192, 153, 97, 142, 40,
+    124, 183, 135, 185, 135, 185, 162, 186, 128, 184, 136, 128, 136, 128, 95, 55, 155, 175, 168, 112, 168, 112, 150, 75, 161, 134, 97, 60, 97, 60, 40, 17,
+    11, 50, 31, 68, 31, 68, 41, 78, 28, 60, 35, 72, 35, 72, 43, 80, 39, 94, 140, 147, 140, 147, 190, 102, 188, 192, 190, 153, 190, 153, 213, 43,
+    58, 124, 87, 131, 145, 155, 149, 119, 93, 134, 97, 136, 152, 158, 153, 72, 96, 135, 149, 119, 198, 168, 215, 90, 197, 203, 199, 97, 216, 152, 190, 35,
+    58, 124, 145, 155, 87, 131, 149, 119, 93, 134, 152, 158, 97, 136, 153, 72, 96, 135, 198, 168, 149, 119, 215, 90, 197, 203, 216, 152, 199, 97, 190, 35,
+    133, 183, 202, 175, 202, 175, 204, 112, 201, 205, 203, 134, 203, 134, 192, 60, 160, 185, 204, 112, 204, 112, 214, 84, 219, 201, 197, 93, 197, 93, 188, 28,
+    63, 110, 88, 117, 88, 117, 100, 120, 84, 112, 90, 119, 90, 119, 102, 78, 148, 209, 198, 169, 198, 169, 216, 100, 214, 204, 215, 149, 215, 149, 190, 41,
+    107, 171, 115, 173, 166, 179, 169, 117, 112, 175, 119, 131, 168, 155, 147, 68, 166, 211, 210, 115, 218, 166, 198, 88, 204, 202, 149, 87, 198, 145, 140, 31,
+    107, 171, 166, 179, 115, 173, 169, 117, 112, 175, 168, 155, 119, 131, 147, 68, 166, 211, 218, 166, 210, 115, 198, 88, 204, 202, 198, 145, 149, 87, 140, 31,
+    171, 212, 211, 171, 211, 171, 209, 110, 185, 183, 135, 124, 135, 124, 94, 50, 179, 171, 166, 107, 166, 107, 148, 63, 160, 133, 96, 58, 96, 58, 39, 11,
+    2, 46, 9, 51, 9, 51, 26, 63, 4, 48, 10, 52, 10, 52, 27, 65, 46, 103, 56, 104, 56, 104, 92, 110, 62, 104, 66, 106, 66, 106, 94, 111,
+    9, 56, 13, 57, 30, 86, 33, 88, 11, 58, 14, 59, 31, 87, 34, 89, 51, 104, 57, 105, 86, 114, 96, 117, 63, 107, 67, 108, 88, 115, 98, 118,
+    9, 56, 30, 86, 13, 57, 33, 88, 11, 58, 31, 87, 14, 59, 34, 89, 51, 104, 86, 114, 57, 105, 96, 117, 63, 107, 88, 115, 67, 108, 98, 118,
+    26, 92, 33, 96, 33, 96, 81, 100, 28, 93, 35, 97, 35, 97, 82, 101, 63, 110, 88, 117, 88, 117, 100, 120, 84, 112, 90, 119, 90, 119, 102, 78,
+    4, 62, 11, 63, 11, 63, 28, 84, 5, 64, 12, 65, 12, 65, 29, 85, 48, 104, 58, 107, 58, 107, 93, 112, 64, 105, 68, 108, 68, 108, 95, 113,
+    10, 66, 14, 67, 31, 88, 35, 90, 12, 68, 15, 69, 32, 89, 36, 91, 52, 106, 59, 108, 87, 115, 97, 119, 65, 108, 69, 109, 89, 116, 99, 69,
+    10, 66, 31, 88, 14, 67, 35, 90, 12, 68, 32, 89, 15, 69, 36, 91, 52, 106, 87, 115, 59, 108, 97, 119, 65, 108, 89, 116, 69, 109, 99, 69,
+    27, 94, 34, 98, 34, 98, 82, 102, 29, 95, 36, 99, 36, 99, 83, 36, 65, 111, 89, 118, 89, 118, 101, 78, 85, 113, 91, 69, 91, 69, 36, 15,
+    9, 51, 26, 63, 26, 63, 38, 75, 25, 57, 31, 67, 31, 67, 40, 77, 56, 104, 92, 110, 92, 110, 191, 186, 144, 164, 145, 165, 145, 165, 192, 137,
+    30, 86, 33, 88, 139, 148, 141, 150, 39, 96, 41, 98, 140, 149, 142, 151, 86, 114, 96, 117, 196, 209, 197, 162, 148, 166, 149, 167, 198, 210, 199, 98,
+    30, 86, 139, 148, 33, 88, 141, 150, 39, 96, 140, 149, 41, 98, 142, 151, 86, 114, 196, 209, 96, 117, 197, 162, 148, 166, 198, 210, 149, 167, 199, 98,
+    139, 196, 189, 198, 189, 198, 194, 200, 188, 197, 190, 199, 190, 199, 195, 142, 148, 209, 198, 169, 198, 169, 216, 100, 214, 204, 215, 149, 215, 149, 190, 41,
+    48, 104, 58, 107, 58, 107, 93, 112, 64, 105, 68, 108, 68, 108, 95, 113, 123, 170, 133, 171, 133, 171, 201, 185, 154, 176, 155, 177, 155, 177, 161, 126,
+    66, 114, 70, 115, 145, 166, 152, 168, 76, 117, 78, 118, 147, 167, 101, 89, 130, 172, 135, 173, 202, 211, 203, 135, 156, 178, 119, 108, 168, 165, 97, 59,
+    66, 114, 145, 166, 70, 115, 152, 168, 76, 117, 147, 167, 78, 118, 101, 89, 130, 172, 202, 211, 135, 173, 203, 135, 156, 178, 168, 165, 119, 108, 97, 59,
+    146, 209, 193, 210, 193, 210, 208, 193, 163, 162, 102, 98, 102, 98, 82, 34, 156, 174, 168, 115, 168, 115, 152, 70, 159, 132, 90, 67, 90, 67, 35, 14,
+    4, 48, 10, 52, 25, 57, 31, 67, 7, 50, 12, 53, 27, 59, 32, 69, 62, 104, 66, 106, 144, 164, 145, 165, 74, 110, 76, 111, 146, 165, 147, 116,
+    11, 58, 14, 59, 39, 96, 41, 98, 17, 60, 18, 61, 40, 97, 42, 99, 63, 107, 67, 108, 148, 166, 149, 167, 75, 112, 77, 113, 150, 168, 151, 89,
+    48, 123, 66, 130, 57, 125, 88, 132, 50, 124, 68, 131, 59, 126, 89, 113, 104, 170, 114, 172, 164, 176, 166, 178, 110, 171, 117, 173, 165, 177, 167, 108,
+    58, 133, 70, 135, 96, 160, 100, 162, 60, 134, 72, 136, 97, 161, 101, 95, 107, 171, 115, 173, 166, 179, 169, 117, 112, 175, 119, 131, 168, 155, 147, 68,
+    10, 66, 14, 67, 31, 88, 35, 90, 12, 68, 15, 69, 32, 89, 36, 91, 66, 114, 70, 115, 145, 166, 152, 168, 76, 117, 78, 118, 147, 167, 101, 89,
+    14, 70, 19, 71, 41, 100, 43, 102, 18, 72, 20, 73, 42, 101, 44, 36, 67, 115, 71, 116, 149, 169, 153, 147, 77, 119, 79, 69, 151, 147, 42, 32,
+    52, 130, 67, 132, 67, 132, 90, 159, 53, 131, 69, 113, 69, 113, 91, 85, 106, 172, 115, 174, 165, 178, 168, 156, 111, 173, 118, 111, 116, 108, 89, 65,
+    59, 135, 71, 137, 98, 162, 102, 163, 61, 136, 73, 61, 99, 95, 36, 29, 108, 173, 116, 111, 167, 117, 147, 76, 113, 131, 69, 53, 89, 68, 32, 12,
+    10, 52, 27, 65, 31, 67, 40, 77, 27, 59, 32, 69, 34, 71, 42, 79, 66, 106, 94, 111, 145, 165, 192, 137, 146, 165, 147, 116, 193, 207, 153, 71,
+    31, 87, 34, 89, 140, 149, 142, 151, 40, 97, 42, 99, 142, 153, 143, 42, 88, 115, 98, 118, 198, 210, 199, 98, 150, 168, 151, 89, 200, 193, 142, 34,
+    66, 130, 146, 156, 88, 132, 150, 157, 94, 135, 147, 119, 98, 137, 151, 77, 114, 172, 209, 174, 166, 178, 204, 132, 209, 211, 169, 115, 210, 165, 149, 67,
+    145, 202, 193, 168, 198, 204, 200, 150, 192, 203, 153, 97, 199, 192, 142, 40, 166, 211, 210, 115, 218, 166, 198, 88, 204, 202, 149, 87, 198, 145, 140, 31,
+    52, 106, 59, 108, 87, 115, 97, 119, 65, 108, 69, 109, 89, 116, 99, 69, 130, 172, 135, 173, 202, 211, 203, 135, 156, 178, 119, 108, 168, 165, 97, 59,
+    67, 115, 71, 116, 149, 169, 153, 147, 77, 119, 79, 69, 151, 147, 42, 32, 132, 174, 137, 111, 204, 209, 192, 94, 157, 156, 77, 65, 150, 146, 40, 27,
+    106, 172, 165, 178, 115, 174, 168, 156, 111, 173, 116, 108, 118, 111, 89, 65, 172, 217, 211, 172, 211, 172, 202, 130, 174, 172, 115, 106, 115, 106, 87, 52,
+    165, 211, 207, 165, 210, 209, 193, 146, 137, 135, 71, 59, 98, 94, 34, 27, 178, 172, 165, 106, 166, 114, 145, 66, 132, 130, 67, 52, 88, 66, 31, 10,
+    4, 48, 25, 57, 10, 52, 31, 67, 7, 50, 27, 59, 12, 53, 32, 69, 62, 104, 144, 164, 66, 106, 145, 165, 74, 110, 146, 165, 76, 111, 147, 116,
+    48, 123, 57, 125, 66, 130, 88, 132, 50, 124, 59, 126, 68, 131, 89, 113, 104, 170, 164, 176, 114, 172, 166, 178, 110, 171, 165, 177, 117, 173, 167, 108,
+    11, 58, 39, 96, 14, 59, 41, 98, 17, 60, 40, 97, 18, 61, 42, 99, 63, 107, 148, 166, 67, 108, 149, 167, 75, 112, 150, 168, 77, 113, 151, 89,
+    58, 133, 96, 160, 70, 135, 100, 162, 60, 134, 97, 161, 72, 136, 101, 95, 107, 171, 166, 179, 115, 173, 169, 117, 112, 175, 168, 155, 119, 131, 147, 68,
+    10, 66, 31, 88, 14, 67, 35, 90, 12, 68, 32, 89, 15, 69, 36, 91, 66, 114, 145, 166, 70, 115, 152, 168, 76, 117, 147, 167, 78, 118, 101, 89,
+    52, 130, 67, 132, 67, 132, 90, 159, 53, 131, 69, 113, 69, 113, 91, 85, 106, 172, 165, 178, 115, 174, 168, 156, 111, 173, 116, 108, 118, 111, 89, 65,
+    14, 70, 41, 100, 19, 71, 43, 102, 18, 72, 42, 101, 20, 73, 44, 36, 67, 115, 149, 169, 71, 116, 153, 147, 77, 119, 151, 147, 79, 69, 42, 32,
+    59, 135, 98, 162, 71, 137, 102, 163, 61, 136, 99, 95, 73, 61, 36, 29, 108, 173, 167, 117, 116, 111, 147, 76, 113, 131, 89, 68, 69, 53, 32, 12,
+    10, 52, 31, 67, 27, 65, 40, 77, 27, 59, 34, 71, 32, 69, 42, 79, 66, 106, 145, 165, 94, 111, 192, 137, 146, 165, 193, 207, 147, 116, 153, 71,
+    66, 130, 88, 132, 146, 156, 150, 157, 94, 135, 98, 137, 147, 119, 151, 77, 114, 172, 166, 178, 209, 174, 204, 132, 209, 211, 210, 165, 169, 115, 149, 67,
+    31, 87, 140, 149, 34, 89, 142, 151, 40, 97, 142, 153, 42, 99, 143, 42, 88, 115, 198, 210, 98, 118, 199, 98, 150, 168, 200, 193, 151, 89, 142, 34,
+    145, 202, 198, 204, 193, 168, 200, 150, 192, 203, 199, 192, 153, 97, 142, 40, 166, 211, 218, 166, 210, 115, 198, 88, 204, 202, 198, 145, 149, 87, 140, 31,
+    52, 106, 87, 115, 59, 108, 97, 119, 65, 108, 89, 116, 69, 109, 99, 69, 130, 172, 202, 211, 135, 173, 203, 135, 156, 178, 168, 165, 119, 108, 97, 59,
+    106, 172, 115, 174, 165, 178, 168, 156, 111, 173, 118, 111, 116, 108, 89, 65, 172, 217, 211, 172, 211, 172, 202, 130, 174, 172, 115, 106, 115, 106, 87, 52,
+    67, 115, 149, 169, 71, 116, 153, 147, 77, 119, 151, 147, 79, 69, 42, 32, 132, 174, 204, 209, 137, 111, 192, 94, 157, 156, 150, 146, 77, 65, 40, 27,
+    165, 211, 210, 209, 207, 165, 193, 146, 137, 135, 98, 94, 71, 59, 34, 27, 178, 172, 166, 114, 165, 106, 145, 66, 132, 130, 88, 66, 67, 52, 31, 10,
+    7, 50, 27, 59, 27, 59, 34, 71, 23, 55, 29, 61, 29, 61, 36, 73, 74, 110, 146, 165, 146, 165, 193, 207, 206, 186, 163, 137, 163, 137, 102, 71,
+    50, 124, 59, 126, 94, 135, 98, 137, 55, 128, 61, 129, 95, 136, 99, 61, 110, 171, 165, 177, 209, 211, 210, 165, 186, 185, 137, 126, 162, 135, 98, 59,
+    50, 124, 94, 135, 59, 126, 98, 137, 55, 128, 95, 136, 61, 129, 99, 61, 110, 171, 209, 211, 165, 177, 210, 165, 186, 185, 162, 135, 137, 126, 98, 59,
+    124, 183, 135, 185, 135, 185, 162, 186, 128, 184, 136, 128, 136, 128, 95, 55, 171, 212, 211, 171, 211, 171, 209, 110, 185, 183, 135, 124, 135, 124, 94, 50,
+    27, 94, 34, 98, 34, 98, 82, 102, 29, 95, 36, 99, 36, 99, 83, 36, 146, 209, 193, 210, 193, 210, 208, 193, 163, 162, 102, 98, 102, 98, 82, 34,
+    59, 135, 71, 137, 98, 162, 102, 163, 61, 136, 73, 61, 99, 95, 36, 29, 165, 211, 207, 165, 210, 209, 193, 146, 137, 135, 71, 59, 98, 94, 34, 27,
+    59, 135, 98, 162, 71, 137, 102, 163, 61, 136, 99, 95, 73, 61, 36, 29, 165, 211, 210, 209, 207, 165, 193, 146, 137, 135, 98, 94, 71, 59, 34, 27,
+    126, 185, 137, 186, 137, 186, 163, 206, 129, 128, 61, 55, 61, 55, 29, 23, 177, 171, 165, 110, 165, 110, 146, 74, 126, 124, 59, 50, 59, 50, 27, 7,
+    12, 53, 32, 69, 32, 69, 42, 79, 29, 61, 36, 73, 36, 73, 44, 20, 76, 111, 147, 116, 147, 116, 153, 71, 163, 137, 102, 71, 102, 71, 43, 19,
+    68, 131, 89, 113, 147, 119, 151, 77, 95, 136, 99, 61, 101, 72, 42, 18, 117, 173, 167, 108, 169, 115, 149, 67, 162, 135, 98, 59, 100, 70, 41, 14,
+    68, 131, 147, 119, 89, 113, 151, 77, 95, 136, 101, 72, 99, 61, 42, 18, 117, 173, 169, 115, 167, 108, 149, 67, 162, 135, 100, 70, 98, 59, 41, 14,
+    155, 175, 168, 112, 168, 112, 150, 75, 161, 134, 97, 60, 97, 60, 40, 17, 179, 171, 166, 107, 166, 107, 148, 63, 160, 133, 96, 58, 96, 58, 39, 11,
+    65, 111, 89, 118, 89, 118, 101, 78, 85, 113, 91, 69, 91, 69, 36, 15, 156, 174, 168, 115, 168, 115, 152, 70, 159, 132, 90, 67, 90, 67, 35, 14,
+    108, 173, 116, 111, 167, 117, 147, 76, 113, 131, 69, 53, 89, 68, 32, 12, 178, 172, 165, 106, 166, 114, 145, 66, 132, 130, 67, 52, 88, 66, 31, 10,
+    108, 173, 167, 117, 116, 111, 147, 76, 113, 131, 89, 68, 69, 53, 32, 12, 178, 172, 166, 114, 165, 106, 145, 66, 132, 130, 88, 66, 67, 52, 31, 10,
+    177, 171, 165, 110, 165, 110, 146, 74, 126, 124, 59, 50, 59, 50, 27, 7, 176, 170, 164, 104, 164, 104, 144, 62, 125, 123, 57, 48, 57, 48, 25, 4,
+    3, 47, 24, 56, 24, 56, 138, 144, 47, 121, 56, 123, 56, 123, 144, 154, 9, 48, 30, 66, 30, 66, 139, 146, 56, 123, 86, 130, 86, 130, 148, 156,
+    6, 49, 26, 58, 37, 92, 139, 145, 49, 122, 58, 124, 92, 133, 145, 155, 11, 50, 31, 68, 39, 94, 140, 147, 58, 124, 87, 131, 96, 135, 149, 119,
+    6, 49, 37, 92, 26, 58, 139, 145, 49, 122, 92, 133, 58, 124, 145, 155, 11, 50, 39, 94, 31, 68, 140, 147, 58, 124, 96, 135, 87, 131, 149, 119,
+    16, 54, 38, 93, 38, 93, 141, 152, 54, 127, 93, 134, 93, 134, 152, 158, 17, 55, 40, 95, 40, 95, 142, 101, 60, 128, 97, 136, 97, 136, 153, 72,
+    9, 56, 30, 86, 30, 86, 139, 148, 48, 123, 66, 130, 66, 130, 146, 156, 13, 57, 33, 88, 33, 88, 141, 150, 57, 125, 88, 132, 88, 132, 150, 157,
+    11, 58, 31, 87, 39, 96, 140, 149, 50, 124, 68, 131, 94, 135, 147, 119, 14, 59, 34, 89, 41, 98, 142, 151, 59, 126, 89, 113, 98, 137, 151, 77,
+    11, 58, 39, 96, 31, 87, 140, 149, 50, 124, 94, 135, 68, 131, 147, 119, 14, 59, 41, 98, 34, 89, 142, 151, 59, 126, 98, 137, 89, 113, 151, 77,
+    17, 60, 40, 97, 40, 97, 142, 153, 55, 128, 95, 136, 95, 136, 101, 72, 18, 61, 42, 99, 42, 99, 143, 42, 61, 129, 99, 61, 99, 61, 42, 18,
+    9, 48, 30, 66, 30, 66, 139, 146, 56, 123, 86, 130, 86, 130, 148, 156, 25, 64, 39, 76, 39, 76, 188, 163, 144, 154, 148, 156, 148, 156, 214, 159,
+    26, 58, 33, 70, 139, 145, 189, 193, 92, 133, 96, 135, 196, 202, 198, 168, 31, 68, 41, 78, 140, 147, 190, 102, 145, 155, 149, 119, 198, 168, 215, 90,
+    26, 58, 139, 145, 33, 70, 189, 193, 92, 133, 196, 202, 96, 135, 198, 168, 31, 68, 140, 147, 41, 78, 190, 102, 145, 155, 198, 168, 149, 119, 215, 90,
+    38, 93, 141, 152, 141, 152, 194, 208, 191, 201, 197, 203, 197, 203, 216, 152, 40, 95, 142, 101, 142, 101, 195, 82, 192, 161, 199, 97, 199, 97, 190, 35,
+    51, 104, 86, 114, 86, 114, 196, 209, 104, 170, 114, 172, 114, 172, 209, 174, 57, 105, 96, 117, 96, 117, 197, 162, 164, 176, 166, 178, 166, 178, 204, 132,
+    63, 107, 88, 115, 148, 166, 198, 210, 110, 171, 117, 173, 209, 211, 169, 115, 67, 108, 98, 118, 149, 167, 199, 98, 165, 177, 167, 108, 210, 165, 149, 67,
+    63, 107, 148, 166, 88, 115, 198, 210, 110, 171, 209, 211, 117, 173, 169, 115, 67, 108, 149, 167, 98, 118, 199, 98, 165, 177, 210, 165, 167, 108, 149, 67,
+    75, 112, 150, 168, 150, 168, 200, 193, 186, 185, 162, 135, 162, 135, 100, 70, 77, 113, 151, 89, 151, 89, 142, 34, 137, 126, 98, 59, 98, 59, 41, 14,
+    6, 49, 26, 58, 37, 92, 139, 145, 49, 122, 58, 124, 92, 133, 145, 155, 26, 58, 33, 70, 139, 145, 189, 193, 92, 133, 96, 135, 196, 202, 198, 168,
+    22, 54, 28, 60, 187, 191, 188, 192, 54, 127, 60, 128, 191, 201, 192, 161, 28, 60, 35, 72, 188, 192, 190, 153, 93, 134, 97, 136, 197, 203, 199, 97,
+    49, 122, 92, 133, 92, 133, 196, 202, 122, 181, 133, 183, 133, 183, 202, 175, 58, 124, 96, 135, 145, 155, 198, 168, 133, 183, 160, 185, 202, 175, 204, 112,
+    54, 127, 93, 134, 191, 201, 197, 203, 127, 182, 134, 184, 201, 205, 203, 134, 60, 128, 97, 136, 192, 161, 199, 97, 134, 184, 161, 128, 203, 134, 192, 60,
+    26, 92, 33, 96, 139, 196, 189, 198, 58, 133, 70, 135, 145, 202, 193, 168, 33, 96, 81, 100, 189, 198, 194, 200, 96, 160, 100, 162, 198, 204, 200, 150,
+    28, 93, 35, 97, 188, 197, 190, 199, 60, 134, 72, 136, 192, 203, 153, 97, 35, 97, 82, 101, 190, 199, 195, 142, 97, 161, 101, 95, 199, 192, 142, 40,
+    58, 133, 96, 160, 145, 202, 198, 204, 124, 183, 135, 185, 155, 175, 168, 112, 70, 135, 100, 162, 193, 168, 200, 150, 135, 185, 162, 186, 168, 112, 150, 75,
+    60, 134, 97, 161, 192, 203, 199, 192, 128, 184, 136, 128, 161, 134, 97, 60, 72, 136, 101, 95, 153, 97, 142, 40, 136, 128, 95, 55, 97, 60, 40, 17,
+    11, 50, 31, 68, 39, 94, 140, 147, 58, 124, 87, 131, 96, 135, 149, 119, 31, 68, 41, 78, 140, 147, 190, 102, 145, 155, 149, 119, 198, 168, 215, 90,
+    28, 60, 35, 72, 188, 192, 190, 153, 93, 134, 97, 136, 197, 203, 199, 97, 35, 72, 43, 80, 190, 153, 213, 43, 152, 158, 153, 72, 216, 152, 190, 35,
+    58, 124, 145, 155, 96, 135, 198, 168, 133, 183, 202, 175, 160, 185, 204, 112, 87, 131, 149, 119, 149, 119, 215, 90, 202, 175, 204, 112, 204, 112, 214, 84,
+    93, 134, 152, 158, 197, 203, 216, 152, 201, 205, 203, 134, 219, 201, 197, 93, 97, 136, 153, 72, 199, 97, 190, 35, 203, 134, 192, 60, 197, 93, 188, 28,
+    63, 110, 88, 117, 148, 209, 198, 169, 107, 171, 115, 173, 166, 211, 210, 115, 88, 117, 100, 120, 198, 169, 216, 100, 166, 179, 169, 117, 218, 166, 198, 88,
+    84, 112, 90, 119, 214, 204, 215, 149, 112, 175, 119, 131, 204, 202, 149, 87, 90, 119, 102, 78, 215, 149, 190, 41, 168, 155, 147, 68, 198, 145, 140, 31,
+    107, 171, 166, 179, 166, 211, 218, 166, 171, 212, 211, 171, 179, 171, 166, 107, 115, 173, 169, 117, 210, 115, 198, 88, 211, 171, 209, 110, 166, 107, 148, 63,
+    112, 175, 168, 155, 204, 202, 198, 145, 185, 183, 135, 124, 160, 133, 96, 58, 119, 131, 147, 68, 149, 87, 140, 31, 135, 124, 94, 50, 96, 58, 39, 11,
+    6, 49, 37, 92, 26, 58, 139, 145, 49, 122, 92, 133, 58, 124, 145, 155, 26, 58, 139, 145, 33, 70, 189, 193, 92, 133, 196, 202, 96, 135, 198, 168,
+    49, 122, 92, 133, 92, 133, 196, 202, 122, 181, 133, 183, 133, 183, 202, 175, 58, 124, 145, 155, 96, 135, 198, 168, 133, 183, 202, 175, 160, 185, 204, 112,
+    22, 54, 187, 191, 28, 60, 188, 192, 54, 127, 191, 201, 60, 128, 192, 161, 28, 60, 188, 192, 35, 72, 190, 153, 93, 134, 197, 203, 97, 136, 199, 97,
+    54, 127, 191, 201, 93, 134, 197, 203, 127, 182, 201, 205, 134, 184, 203, 134, 60, 128, 192, 161, 97, 136, 199, 97, 134, 184, 203, 134, 161, 128, 192, 60,
+    26, 92, 139, 196, 33, 96, 189, 198, 58, 133, 145, 202, 70, 135, 193, 168, 33, 96, 189, 198, 81, 100, 194, 200, 96, 160, 198, 204, 100, 162, 200, 150,
+    58, 133, 145, 202, 96, 160, 198, 204, 124, 183, 155, 175, 135, 185, 168, 112, 70, 135, 193, 168, 100, 162, 200, 150, 135, 185, 168, 112, 162, 186, 150, 75,
+    28, 93, 188, 197, 35, 97, 190, 199, 60, 134, 192, 203, 72, 136, 153, 97, 35, 97, 190, 199, 82, 101, 195, 142, 97, 161, 199, 192, 101, 95, 142, 40,
+    60, 134, 192, 203, 97, 161, 199, 192, 128, 184, 161, 134, 136, 128, 97, 60, 72, 136, 153, 97, 101, 95, 142, 40, 136, 128, 97, 60, 95, 55, 40, 17,
+    11, 50, 39, 94, 31, 68, 140, 147, 58, 124, 96, 135, 87, 131, 149, 119, 31, 68, 140, 147, 41, 78, 190, 102, 145, 155, 198, 168, 149, 119, 215, 90,
+    58, 124, 96, 135, 145, 155, 198, 168, 133, 183, 160, 185, 202, 175, 204, 112, 87, 131, 149, 119, 149, 119, 215, 90, 202, 175, 204, 112, 204, 112, 214, 84,
+    28, 60, 188, 192, 35, 72, 190, 153, 93, 134, 197, 203, 97, 136, 199, 97, 35, 72, 190, 153, 43, 80, 213, 43, 152, 158, 216, 152, 153, 72, 190, 35,
+    93, 134, 197, 203, 152, 158, 216, 152, 201, 205, 219, 201, 203, 134, 197, 93, 97, 136, 199, 97, 153, 72, 190, 35, 203, 134, 197, 93, 192, 60, 188, 28,
+    63, 110, 148, 209, 88, 117, 198, 169, 107, 171, 166, 211, 115, 173, 210, 115, 88, 117, 198, 169, 100, 120, 216, 100, 166, 179, 218, 166, 169, 117, 198, 88,
+    107, 171, 166, 211, 166, 179, 218, 166, 171, 212, 179, 171, 211, 171, 166, 107, 115, 173, 210, 115, 169, 117, 198, 88, 211, 171, 166, 107, 209, 110, 148, 63,
+    84, 112, 214, 204, 90, 119, 215, 149, 112, 175, 204, 202, 119, 131, 149, 87, 90, 119, 215, 149, 102, 78, 190, 41, 168, 155, 198, 145, 147, 68, 140, 31,
+    112, 175, 204, 202, 168, 155, 198, 145, 185, 183, 160, 133, 135, 124, 96, 58, 119, 131, 149, 87, 147, 68, 140, 31, 135, 124, 96, 58, 94, 50, 39, 11,
+    16, 54, 38, 93, 38, 93, 141, 152, 54, 127, 93, 134, 93, 134, 152, 158, 38, 93, 141, 152, 141, 152, 194, 208, 191, 201, 197, 203, 197, 203, 216, 152,
+    54, 127, 93, 134, 191, 201, 197, 203, 127, 182, 134, 184, 201, 205, 203, 134, 93, 134, 152, 158, 197, 203, 216, 152, 201, 205, 203, 134, 219, 201, 197, 93,
+    54, 127, 191, 201, 93, 134, 197, 203, 127, 182, 201, 205, 134, 184, 203, 134, 93, 134, 197, 203, 152, 158, 216, 152, 201, 205, 219, 201, 203, 134, 197, 93,
+    127, 182, 201, 205, 201, 205, 219, 201, 182, 0, 205, 182, 205, 182, 201, 127, 134, 184, 203, 134, 203, 134, 197, 93, 205, 182, 201, 127, 201, 127, 191, 54,
+    38, 191, 141, 197, 141, 197, 194, 216, 93, 201, 152, 203, 152, 203, 208, 152, 141, 197, 194, 216, 194, 216, 220, 194, 197, 219, 216, 197, 216, 197, 194, 141,
+    93, 201, 152, 203, 197, 219, 216, 197, 134, 205, 158, 134, 203, 201, 152, 93, 152, 203, 208, 152, 216, 197, 194, 141, 203, 201, 152, 93, 197, 191, 141, 38,
+    93, 201, 197, 219, 152, 203, 216, 197, 134, 205, 203, 201, 158, 134, 152, 93, 152, 203, 216, 197, 208, 152, 194, 141, 203, 201, 197, 191, 152, 93, 141, 38,
+    134, 205, 203, 201, 203, 201, 197, 191, 184, 182, 134, 127, 134, 127, 93, 54, 158, 134, 152, 93, 152, 93, 141, 38, 134, 127, 93, 54, 93, 54, 38, 16,
+    17, 55, 40, 95, 40, 95, 142, 101, 60, 128, 97, 136, 97, 136, 153, 72, 40, 95, 142, 101, 142, 101, 195, 82, 192, 161, 199, 97, 199, 97, 190, 35,
+    60, 128, 97, 136, 192, 161, 199, 97, 134, 184, 161, 128, 203, 134, 192, 60, 97, 136, 153, 72, 199, 97, 190, 35, 203, 134, 192, 60, 197, 93, 188, 28,
+    60, 128, 192, 161, 97, 136, 199, 97, 134, 184, 203, 134, 161, 128, 192, 60, 97, 136, 199, 97, 153, 72, 190, 35, 203, 134, 197, 93, 192, 60, 188, 28,
+    134, 184, 203, 134, 203, 134, 197, 93, 205, 182, 201, 127, 201, 127, 191, 54, 161, 128, 192, 60, 192, 60, 188, 28, 201, 127, 191, 54, 191, 54, 187, 22,
+    75, 186, 150, 162, 150, 162, 200, 100, 112, 185, 168, 135, 168, 135, 193, 70, 150, 162, 200, 100, 200, 100, 194, 81, 204, 160, 198, 96, 198, 96, 189, 33,
+    112, 185, 168, 135, 204, 160, 198, 96, 175, 183, 155, 124, 202, 133, 145, 58, 168, 135, 193, 70, 198, 96, 189, 33, 202, 133, 145, 58, 196, 92, 139, 26,
+    112, 185, 204, 160, 168, 135, 198, 96, 175, 183, 202, 133, 155, 124, 145, 58, 168, 135, 198, 96, 193, 70, 189, 33, 202, 133, 196, 92, 145, 58, 139, 26,
+    175, 183, 202, 133, 202, 133, 196, 92, 183, 181, 133, 122, 133, 122, 92, 49, 155, 124, 145, 58, 145, 58, 139, 26, 133, 122, 92, 49, 92, 49, 37, 6,
+    9, 56, 30, 86, 30, 86, 139, 148, 48, 123, 66, 130, 66, 130, 146, 156, 51, 104, 86, 114, 86, 114, 196, 209, 104, 170, 114, 172, 114, 172, 209, 174,
+    26, 92, 33, 96, 139, 196, 189, 198, 58, 133, 70, 135, 145, 202, 193, 168, 63, 110, 88, 117, 148, 209, 198, 169, 107, 171, 115, 173, 166, 211, 210, 115,
+    26, 92, 139, 196, 33, 96, 189, 198, 58, 133, 145, 202, 70, 135, 193, 168, 63, 110, 148, 209, 88, 117, 198, 169, 107, 171, 166, 211, 115, 173, 210, 115,
+    38, 191, 141, 197, 141, 197, 194, 216, 93, 201, 152, 203, 152, 203, 208, 152, 75, 186, 150, 162, 150, 162, 200, 100, 112, 185, 168, 135, 168, 135, 193, 70,
+    25, 144, 39, 148, 39, 148, 188, 214, 64, 154, 76, 156, 76, 156, 163, 159, 57, 164, 96, 166, 96, 166, 197, 204, 105, 176, 117, 178, 117, 178, 162, 132,
+    31, 145, 41, 149, 140, 198, 190, 215, 68, 155, 78, 119, 147, 168, 102, 90, 67, 165, 98, 167, 149, 210, 199, 149, 108, 177, 118, 108, 167, 165, 98, 67,
+    31, 145, 140, 198, 41, 149, 190, 215, 68, 155, 147, 168, 78, 119, 102, 90, 67, 165, 149, 210, 98, 167, 199, 149, 108, 177, 167, 165, 118, 108, 98, 67,
+    40, 192, 142, 199, 142, 199, 195, 190, 95, 161, 101, 97, 101, 97, 82, 35, 77, 137, 151, 98, 151, 98, 142, 41, 113, 126, 89, 59, 89, 59, 34, 14,
+    13, 57, 33, 88, 33, 88, 141, 150, 57, 125, 88, 132, 88, 132, 150, 157, 57, 105, 96, 117, 96, 117, 197, 162, 164, 176, 166, 178, 166, 178, 204, 132,
+    33, 96, 81, 100, 189, 198, 194, 200, 96, 160, 100, 162, 198, 204, 200, 150, 88, 117, 100, 120, 198, 169, 216, 100, 166, 179, 169, 117, 218, 166, 198, 88,
+    33, 96, 189, 198, 81, 100, 194, 200, 96, 160, 198, 204, 100, 162, 200, 150, 88, 117, 198, 169, 100, 120, 216, 100, 166, 179, 218, 166, 169, 117, 198, 88,
+    141, 197, 194, 216, 194, 216, 220, 194, 197, 219, 216, 197, 216, 197, 194, 141, 150, 162, 200, 100, 200, 100, 194, 81, 204, 160, 198, 96, 198, 96, 189, 33,
+    57, 164, 96, 166, 96, 166, 197, 204, 105, 176, 117, 178, 117, 178, 162, 132, 125, 176, 160, 179, 160, 179, 219, 160, 176, 180, 179, 176, 179, 176, 160, 125,
+    88, 166, 100, 169, 198, 218, 216, 198, 117, 179, 120, 117, 169, 166, 100, 88, 132, 178, 162, 117, 204, 166, 197, 96, 178, 176, 117, 105, 166, 164, 96, 57,
+    88, 166, 198, 218, 100, 169, 216, 198, 117, 179, 169, 166, 120, 117, 100, 88, 132, 178, 204, 166, 162, 117, 197, 96, 178, 176, 166, 164, 117, 105, 96, 57,
+    150, 204, 200, 198, 200, 198, 194, 189, 162, 160, 100, 96, 100, 96, 81, 33, 157, 132, 150, 88, 150, 88, 141, 33, 132, 125, 88, 57, 88, 57, 33, 13,
+    11, 58, 31, 87, 39, 96, 140, 149, 50, 124, 68, 131, 94, 135, 147, 119, 63, 107, 88, 115, 148, 166, 198, 210, 110, 171, 117, 173, 209, 211, 169, 115,
+    28, 93, 35, 97, 188, 197, 190, 199, 60, 134, 72, 136, 192, 203, 153, 97, 84, 112, 90, 119, 214, 204, 215, 149, 112, 175, 119, 131, 204, 202, 149, 87,
+    58, 133, 145, 202, 96, 160, 198, 204, 124, 183, 155, 175, 135, 185, 168, 112, 107, 171, 166, 211, 166, 179, 218, 166, 171, 212, 179, 171, 211, 171, 166, 107,
+    93, 201, 152, 203, 197, 219, 216, 197, 134, 205, 158, 134, 203, 201, 152, 93, 112, 185, 168, 135, 204, 160, 198, 96, 175, 183, 155, 124, 202, 133, 145, 58,
+    31, 145, 41, 149, 140, 198, 190, 215, 68, 155, 78, 119, 147, 168, 102, 90, 88, 166, 100, 169, 198, 218, 216, 198, 117, 179, 120, 117, 169, 166, 100, 88,
+    35, 152, 43, 153, 190, 216, 213, 190, 72, 158, 80, 72, 153, 152, 43, 35, 90, 168, 102, 147, 215, 198, 190, 140, 119, 155, 78, 68, 149, 145, 41, 31,
+    87, 202, 149, 204, 149, 204, 215, 214, 131, 175, 119, 112, 119, 112, 90, 84, 115, 211, 169, 209, 210, 166, 198, 148, 173, 171, 117, 110, 115, 107, 88, 63,
+    97, 203, 153, 192, 199, 197, 190, 188, 136, 134, 72, 60, 97, 93, 35, 28, 119, 135, 147, 94, 149, 96, 140, 39, 131, 124, 68, 50, 87, 58, 31, 11,
+    14, 59, 34, 89, 41, 98, 142, 151, 59, 126, 89, 113, 98, 137, 151, 77, 67, 108, 98, 118, 149, 167, 199, 98, 165, 177, 167, 108, 210, 165, 149, 67,
+    35, 97, 82, 101, 190, 199, 195, 142, 97, 161, 101, 95, 199, 192, 142, 40, 90, 119, 102, 78, 215, 149, 190, 41, 168, 155, 147, 68, 198, 145, 140, 31,
+    70, 135, 193, 168, 100, 162, 200, 150, 135, 185, 168, 112, 162, 186, 150, 75, 115, 173, 210, 115, 169, 117, 198, 88, 211, 171, 166, 107, 209, 110, 148, 63,
+    152, 203, 208, 152, 216, 197, 194, 141, 203, 201, 152, 93, 197, 191, 141, 38, 168, 135, 193, 70, 198, 96, 189, 33, 202, 133, 145, 58, 196, 92, 139, 26,
+    67, 165, 98, 167, 149, 210, 199, 149, 108, 177, 118, 108, 167, 165, 98, 67, 132, 178, 162, 117, 204, 166, 197, 96, 178, 176, 117, 105, 166, 164, 96, 57,
+    90, 168, 102, 147, 215, 198, 190, 140, 119, 155, 78, 68, 149, 145, 41, 31, 159, 156, 163, 76, 214, 148, 188, 39, 156, 154, 76, 64, 148, 144, 39, 25,
+    115, 211, 210, 166, 169, 209, 198, 148, 173, 171, 115, 107, 117, 110, 88, 63, 174, 172, 209, 114, 209, 114, 196, 86, 172, 170, 114, 104, 114, 104, 86, 51,
+    168, 202, 193, 145, 198, 196, 189, 139, 135, 133, 70, 58, 96, 92, 33, 26, 156, 130, 146, 66, 148, 86, 139, 30, 130, 123, 66, 48, 86, 56, 30, 9,
+    11, 58, 39, 96, 31, 87, 140, 149, 50, 124, 94, 135, 68, 131, 147, 119, 63, 107, 148, 166, 88, 115, 198, 210, 110, 171, 209, 211, 117, 173, 169, 115,
+    58, 133, 96, 160, 145, 202, 198, 204, 124, 183, 135, 185, 155, 175, 168, 112, 107, 171, 166, 179, 166, 211, 218, 166, 171, 212, 211, 171, 179, 171, 166, 107,
+    28, 93, 188, 197, 35, 97, 190, 199, 60, 134, 192, 203, 72, 136, 153, 97, 84, 112, 214, 204, 90, 119, 215, 149, 112, 175, 204, 202, 119, 131, 149, 87,
+    93, 201, 197, 219, 152, 203, 216, 197, 134, 205, 203, 201, 158, 134, 152, 93, 112, 185, 204, 160, 168, 135, 198, 96, 175, 183, 202, 133, 155, 124, 145, 58,
+    31, 145, 140, 198, 41, 149, 190, 215, 68, 155, 147, 168, 78, 119, 102, 90, 88, 166, 198, 218, 100, 169, 216, 198, 117, 179, 169, 166, 120, 117, 100, 88,
+    87, 202, 149, 204, 149, 204, 215, 214, 131, 175, 119, 112, 119, 112, 90, 84, 115, 211, 210, 166, 169, 209, 198, 148, 173, 171, 115, 107, 117, 110, 88, 63,
+    35, 152, 190, 216, 43, 153, 213, 190, 72, 158, 153, 152, 80, 72, 43, 35, 90, 168, 215, 198, 102, 147, 190, 140, 119, 155, 149, 145, 78, 68, 41, 31,
+    97, 203, 199, 197, 153, 192, 190, 188, 136, 134, 97, 93, 72, 60, 35, 28, 119, 135, 149, 96, 147, 94, 140, 39, 131, 124, 87, 58, 68, 50, 31, 11,
+    14, 59, 41, 98, 34, 89, 142, 151, 59, 126, 98, 137, 89, 113, 151, 77, 67, 108, 149, 167, 98, 118, 199, 98, 165, 177, 210, 165, 167, 108, 149, 67,
+    70, 135, 100, 162, 193, 168, 200, 150, 135, 185, 162, 186, 168, 112, 150, 75, 115, 173, 169, 117, 210, 115, 198, 88, 211, 171, 209, 110, 166, 107, 148, 63,
+    35, 97, 190, 199, 82, 101, 195, 142, 97, 161, 199, 192, 101, 95, 142, 40, 90, 119, 215, 149, 102, 78, 190, 41, 168, 155, 198, 145, 147, 68, 140, 31,
+    152, 203, 216, 197, 208, 152, 194, 141, 203, 201, 197, 191, 152, 93, 141, 38, 168, 135, 198, 96, 193, 70, 189, 33, 202, 133, 196, 92, 145, 58, 139, 26,
+    67, 165, 149, 210, 98, 167, 199, 149, 108, 177, 167, 165, 118, 108, 98, 67, 132, 178, 204, 166, 162, 117, 197, 96, 178, 176, 166, 164, 117, 105, 96, 57,
+    115, 211, 169, 209, 210, 166, 198, 148, 173, 171, 117, 110, 115, 107, 88, 63, 174, 172, 209, 114, 209, 114, 196, 86, 172, 170, 114, 104, 114, 104, 86, 51,
+    90, 168, 215, 198, 102, 147, 190, 140, 119, 155, 149, 145, 78, 68, 41, 31, 159, 156, 214, 148, 163, 76, 188, 39, 156, 154, 148, 144, 76, 64, 39, 25,
+    168, 202, 198, 196, 193, 145, 189, 139, 135, 133, 96, 92, 70, 58, 33, 26, 156, 130, 148, 86, 146, 66, 139, 30, 130, 123, 86, 56, 66, 48, 30, 9,
+    17, 60, 40, 97, 40, 97, 142, 153, 55, 128, 95, 136, 95, 136, 101, 72, 75, 112, 150, 168, 150, 168, 200, 193, 186, 185, 162, 135, 162, 135, 100, 70,
+    60, 134, 97, 161, 192, 203, 199, 192, 128, 184, 136, 128, 161, 134, 97, 60, 112, 175, 168, 155, 204, 202, 198, 145, 185, 183, 135, 124, 160, 133, 96, 58,
+    60, 134, 192, 203, 97, 161, 199, 192, 128, 184, 161, 134, 136, 128, 97, 60, 112, 175, 204, 202, 168, 155, 198, 145, 185, 183, 160, 133, 135, 124, 96, 58,
+    134, 205, 203, 201, 203, 201, 197, 191, 184, 182, 134, 127, 134, 127, 93, 54, 175, 183, 202, 133, 202, 133, 196, 92, 183, 181, 133, 122, 133, 122, 92, 49,
+    40, 192, 142, 199, 142, 199, 195, 190, 95, 161, 101, 97, 101, 97, 82, 35, 150, 204, 200, 198, 200, 198, 194, 189, 162, 160, 100, 96, 100, 96, 81, 33,
+    97, 203, 153, 192, 199, 197, 190, 188, 136, 134, 72, 60, 97, 93, 35, 28, 168, 202, 193, 145, 198, 196, 189, 139, 135, 133, 70, 58, 96, 92, 33, 26,
+    97, 203, 199, 197, 153, 192, 190, 188, 136, 134, 97, 93, 72, 60, 35, 28, 168, 202, 198, 196, 193, 145, 189, 139, 135, 133, 96, 92, 70, 58, 33, 26,
+    161, 201, 192, 191, 192, 191, 188, 187, 128, 127, 60, 54, 60, 54, 28, 22, 155, 133, 145, 92, 145, 92, 139, 37, 124, 122, 58, 49, 58, 49, 26, 6,
+    18, 61, 42, 99, 42, 99, 143, 42, 61, 129, 99, 61, 99, 61, 42, 18, 77, 113, 151, 89, 151, 89, 142, 34, 137, 126, 98, 59, 98, 59, 41, 14,
+    72, 136, 101, 95, 153, 97, 142, 40, 136, 128, 95, 55, 97, 60, 40, 17, 119, 131, 147, 68, 149, 87, 140, 31, 135, 124, 94, 50, 96, 58, 39, 11,
+    72, 136, 153, 97, 101, 95, 142, 40, 136, 128, 97, 60, 95, 55, 40, 17, 119, 131, 149, 87, 147, 68, 140, 31, 135, 124, 96, 58, 94, 50, 39, 11,
+    158, 134, 152, 93, 152, 93, 141, 38, 134, 127, 93, 54, 93, 54, 38, 16, 155, 124, 145, 58, 145, 58, 139, 26, 133, 122, 92, 49, 92, 49, 37, 6,
+    77, 137, 151, 98, 151, 98, 142, 41, 113, 126, 89, 59, 89, 59, 34, 14, 157, 132, 150, 88, 150, 88, 141, 33, 132, 125, 88, 57, 88, 57, 33, 13,
+    119, 135, 147, 94, 149, 96, 140, 39, 131, 124, 68, 50, 87, 58, 31, 11, 156, 130, 146, 66, 148, 86, 139, 30, 130, 123, 66, 48, 86, 56, 30, 9,
+    119, 135, 149, 96, 147, 94, 140, 39, 131, 124, 87, 58, 68, 50, 31, 11, 156, 130, 148, 86, 146, 66, 139, 30, 130, 123, 86, 56, 66, 48, 30, 9,
+    155, 133, 145, 92, 145, 92, 139, 37, 124, 122, 58, 49, 58, 49, 26, 6, 154, 123, 144, 56, 144, 56, 138, 24, 123, 121, 56, 47, 56, 47, 24, 3,
+    2, 46, 9, 51, 46, 103, 56, 104, 9, 56, 13, 57, 51, 104, 57, 105, 9, 51, 26, 63, 56, 104, 92, 110, 30, 86, 33, 88, 86, 114, 96, 117,
+    4, 48, 10, 52, 62, 104, 66, 106, 11, 58, 14, 59, 63, 107, 67, 108, 10, 52, 27, 65, 66, 106, 94, 111, 31, 87, 34, 89, 88, 115, 98, 118,
+    9, 56, 30, 86, 51, 104, 86, 114, 26, 92, 33, 96, 63, 110, 88, 117, 13, 57, 33, 88, 57, 105, 96, 117, 33, 96, 81, 100, 88, 117, 100, 120,
+    11, 58, 31, 87, 63, 107, 88, 115, 28, 93, 35, 97, 84, 112, 90, 119, 14, 59, 34, 89, 67, 108, 98, 118, 35, 97, 82, 101, 90, 119, 102, 78,
+    4, 62, 11, 63, 48, 104, 58, 107, 10, 66, 14, 67, 52, 106, 59, 108, 11, 63, 28, 84, 58, 107, 93, 112, 31, 88, 35, 90, 87, 115, 97, 119,
+    5, 64, 12, 65, 64, 105, 68, 108, 12, 68, 15, 69, 65, 108, 69, 109, 12, 65, 29, 85, 68, 108, 95, 113, 32, 89, 36, 91, 89, 116, 99, 69,
+    10, 66, 31, 88, 52, 106, 87, 115, 27, 94, 34, 98, 65, 111, 89, 118, 14, 67, 35, 90, 59, 108, 97, 119, 34, 98, 82, 102, 89, 118, 101, 78,
+    12, 68, 32, 89, 65, 108, 89, 116, 29, 95, 36, 99, 85, 113, 91, 69, 15, 69, 36, 91, 69, 109, 99, 69, 36, 99, 83, 36, 91, 69, 36, 15,
+    9, 51, 26, 63, 56, 104, 92, 110, 30, 86, 33, 88, 86, 114, 96, 117, 26, 63, 38, 75, 92, 110, 191, 186, 139, 148, 141, 150, 196, 209, 197, 162,
+    25, 57, 31, 67, 144, 164, 145, 165, 39, 96, 41, 98, 148, 166, 149, 167, 31, 67, 40, 77, 145, 165, 192, 137, 140, 149, 142, 151, 198, 210, 199, 98,
+    30, 86, 139, 148, 86, 114, 196, 209, 139, 196, 189, 198, 148, 209, 198, 169, 33, 88, 141, 150, 96, 117, 197, 162, 189, 198, 194, 200, 198, 169, 216, 100,
+    39, 96, 140, 149, 148, 166, 198, 210, 188, 197, 190, 199, 214, 204, 215, 149, 41, 98, 142, 151, 149, 167, 199, 98, 190, 199, 195, 142, 215, 149, 190, 41,
+    48, 104, 58, 107, 123, 170, 133, 171, 66, 114, 70, 115, 130, 172, 135, 173, 58, 107, 93, 112, 133, 171, 201, 185, 145, 166, 152, 168, 202, 211, 203, 135,
+    64, 105, 68, 108, 154, 176, 155, 177, 76, 117, 78, 118, 156, 178, 119, 108, 68, 108, 95, 113, 155, 177, 161, 126, 147, 167, 101, 89, 168, 165, 97, 59,
+    66, 114, 145, 166, 130, 172, 202, 211, 146, 209, 193, 210, 156, 174, 168, 115, 70, 115, 152, 168, 135, 173, 203, 135, 193, 210, 208, 193, 168, 115, 152, 70,
+    76, 117, 147, 167, 156, 178, 168, 165, 163, 162, 102, 98, 159, 132, 90, 67, 78, 118, 101, 89, 119, 108, 97, 59, 102, 98, 82, 34, 90, 67, 35, 14,
+    4, 48, 10, 52, 62, 104, 66, 106, 11, 58, 14, 59, 63, 107, 67, 108, 25, 57, 31, 67, 144, 164, 145, 165, 39, 96, 41, 98, 148, 166, 149, 167,
+    7, 50, 12, 53, 74, 110, 76, 111, 17, 60, 18, 61, 75, 112, 77, 113, 27, 59, 32, 69, 146, 165, 147, 116, 40, 97, 42, 99, 150, 168, 151, 89,
+    48, 123, 66, 130, 104, 170, 114, 172, 58, 133, 70, 135, 107, 171, 115, 173, 57, 125, 88, 132, 164, 176, 166, 178, 96, 160, 100, 162, 166, 179, 169, 117,
+    50, 124, 68, 131, 110, 171, 117, 173, 60, 134, 72, 136, 112, 175, 119, 131, 59, 126, 89, 113, 165, 177, 167, 108, 97, 161, 101, 95, 168, 155, 147, 68,
+    10, 66, 14, 67, 66, 114, 70, 115, 14, 70, 19, 71, 67, 115, 71, 116, 31, 88, 35, 90, 145, 166, 152, 168, 41, 100, 43, 102, 149, 169, 153, 147,
+    12, 68, 15, 69, 76, 117, 78, 118, 18, 72, 20, 73, 77, 119, 79, 69, 32, 89, 36, 91, 147, 167, 101, 89, 42, 101, 44, 36, 151, 147, 42, 32,
+    52, 130, 67, 132, 106, 172, 115, 174, 59, 135, 71, 137, 108, 173, 116, 111, 67, 132, 90, 159, 165, 178, 168, 156, 98, 162, 102, 163, 167, 117, 147, 76,
+    53, 131, 69, 113, 111, 173, 118, 111, 61, 136, 73, 61, 113, 131, 69, 53, 69, 113, 91, 85, 116, 108, 89, 65, 99, 95, 36, 29, 89, 68, 32, 12,
+    10, 52, 27, 65, 66, 106, 94, 111, 31, 87, 34, 89, 88, 115, 98, 118, 31, 67, 40, 77, 145, 165, 192, 137, 140, 149, 142, 151, 198, 210, 199, 98,
+    27, 59, 32, 69, 146, 165, 147, 116, 40, 97, 42, 99, 150, 168, 151, 89, 34, 71, 42, 79, 193, 207, 153, 71, 142, 153, 143, 42, 200, 193, 142, 34,
+    66, 130, 146, 156, 114, 172, 209, 174, 145, 202, 193, 168, 166, 211, 210, 115, 88, 132, 150, 157, 166, 178, 204, 132, 198, 204, 200, 150, 218, 166, 198, 88,
+    94, 135, 147, 119, 209, 211, 169, 115, 192, 203, 153, 97, 204, 202, 149, 87, 98, 137, 151, 77, 210, 165, 149, 67, 199, 192, 142, 40, 198, 145, 140, 31,
+    52, 106, 59, 108, 130, 172, 135, 173, 67, 115, 71, 116, 132, 174, 137, 111, 87, 115, 97, 119, 202, 211, 203, 135, 149, 169, 153, 147, 204, 209, 192, 94,
+    65, 108, 69, 109, 156, 178, 119, 108, 77, 119, 79, 69, 157, 156, 77, 65, 89, 116, 99, 69, 168, 165, 97, 59, 151, 147, 42, 32, 150, 146, 40, 27,
+    106, 172, 165, 178, 172, 217, 211, 172, 165, 211, 207, 165, 178, 172, 165, 106, 115, 174, 168, 156, 211, 172, 202, 130, 210, 209, 193, 146, 166, 114, 145, 66,
+    111, 173, 116, 108, 174, 172, 115, 106, 137, 135, 71, 59, 132, 130, 67, 52, 118, 111, 89, 65, 115, 106, 87, 52, 98, 94, 34, 27, 88, 66, 31, 10,
+    9, 56, 30, 86, 51, 104, 86, 114, 26, 92, 33, 96, 63, 110, 88, 117, 30, 86, 139, 148, 86, 114, 196, 209, 139, 196, 189, 198, 148, 209, 198, 169,
+    48, 123, 66, 130, 104, 170, 114, 172, 58, 133, 70, 135, 107, 171, 115, 173, 66, 130, 146, 156, 114, 172, 209, 174, 145, 202, 193, 168, 166, 211, 210, 115,
+    26, 92, 139, 196, 63, 110, 148, 209, 38, 191, 141, 197, 75, 186, 150, 162, 33, 96, 189, 198, 88, 117, 198, 169, 141, 197, 194, 216, 150, 162, 200, 100,
+    58, 133, 145, 202, 107, 171, 166, 211, 93, 201, 152, 203, 112, 185, 168, 135, 70, 135, 193, 168, 115, 173, 210, 115, 152, 203, 208, 152, 168, 135, 193, 70,
+    25, 144, 39, 148, 57, 164, 96, 166, 31, 145, 41, 149, 67, 165, 98, 167, 39, 148, 188, 214, 96, 166, 197, 204, 140, 198, 190, 215, 149, 210, 199, 149,
+    64, 154, 76, 156, 105, 176, 117, 178, 68, 155, 78, 119, 108, 177, 118, 108, 76, 156, 163, 159, 117, 178, 162, 132, 147, 168, 102, 90, 167, 165, 98, 67,
+    31, 145, 140, 198, 67, 165, 149, 210, 40, 192, 142, 199, 77, 137, 151, 98, 41, 149, 190, 215, 98, 167, 199, 149, 142, 199, 195, 190, 151, 98, 142, 41,
+    68, 155, 147, 168, 108, 177, 167, 165, 95, 161, 101, 97, 113, 126, 89, 59, 78, 119, 102, 90, 118, 108, 98, 67, 101, 97, 82, 35, 89, 59, 34, 14,
+    13, 57, 33, 88, 57, 105, 96, 117, 33, 96, 81, 100, 88, 117, 100, 120, 33, 88, 141, 150, 96, 117, 197, 162, 189, 198, 194, 200, 198, 169, 216, 100,
+    57, 125, 88, 132, 164, 176, 166, 178, 96, 160, 100, 162, 166, 179, 169, 117, 88, 132, 150, 157, 166, 178, 204, 132, 198, 204, 200, 150, 218, 166, 198, 88,
+    33, 96, 189, 198, 88, 117, 198, 169, 141, 197, 194, 216, 150, 162, 200, 100, 81, 100, 194, 200, 100, 120, 216, 100, 194, 216, 220, 194, 200, 100, 194, 81,
+    96, 160, 198, 204, 166, 179, 218, 166, 197, 219, 216, 197, 204, 160, 198, 96, 100, 162, 200, 150, 169, 117, 198, 88, 216, 197, 194, 141, 198, 96, 189, 33,
+    57, 164, 96, 166, 125, 176, 160, 179, 88, 166, 100, 169, 132, 178, 162, 117, 96, 166, 197, 204, 160, 179, 219, 160, 198, 218, 216, 198, 204, 166, 197, 96,
+    105, 176, 117, 178, 176, 180, 179, 176, 117, 179, 120, 117, 178, 176, 117, 105, 117, 178, 162, 132, 179, 176, 160, 125, 169, 166, 100, 88, 166, 164, 96, 57,
+    88, 166, 198, 218, 132, 178, 204, 166, 150, 204, 200, 198, 157, 132, 150, 88, 100, 169, 216, 198, 162, 117, 197, 96, 200, 198, 194, 189, 150, 88, 141, 33,
+    117, 179, 169, 166, 178, 176, 166, 164, 162, 160, 100, 96, 132, 125, 88, 57, 120, 117, 100, 88, 117, 105, 96, 57, 100, 96, 81, 33, 88, 57, 33, 13,
+    11, 58, 31, 87, 63, 107, 88, 115, 28, 93, 35, 97, 84, 112, 90, 119, 39, 96, 140, 149, 148, 166, 198, 210, 188, 197, 190, 199, 214, 204, 215, 149,
+    50, 124, 68, 131, 110, 171, 117, 173, 60, 134, 72, 136, 112, 175, 119, 131, 94, 135, 147, 119, 209, 211, 169, 115, 192, 203, 153, 97, 204, 202, 149, 87,
+    58, 133, 145, 202, 107, 171, 166, 211, 93, 201, 152, 203, 112, 185, 168, 135, 96, 160, 198, 204, 166, 179, 218, 166, 197, 219, 216, 197, 204, 160, 198, 96,
+    124, 183, 155, 175, 171, 212, 179, 171, 134, 205, 158, 134, 175, 183, 155, 124, 135, 185, 168, 112, 211, 171, 166, 107, 203, 201, 152, 93, 202, 133, 145, 58,
+    31, 145, 41, 149, 88, 166, 100, 169, 35, 152, 43, 153, 90, 168, 102, 147, 140, 198, 190, 215, 198, 218, 216, 198, 190, 216, 213, 190, 215, 198, 190, 140,
+    68, 155, 78, 119, 117, 179, 120, 117, 72, 158, 80, 72, 119, 155, 78, 68, 147, 168, 102, 90, 169, 166, 100, 88, 153, 152, 43, 35, 149, 145, 41, 31,
+    87, 202, 149, 204, 115, 211, 169, 209, 97, 203, 153, 192, 119, 135, 147, 94, 149, 204, 215, 214, 210, 166, 198, 148, 199, 197, 190, 188, 149, 96, 140, 39,
+    131, 175, 119, 112, 173, 171, 117, 110, 136, 134, 72, 60, 131, 124, 68, 50, 119, 112, 90, 84, 115, 107, 88, 63, 97, 93, 35, 28, 87, 58, 31, 11,
+    14, 59, 34, 89, 67, 108, 98, 118, 35, 97, 82, 101, 90, 119, 102, 78, 41, 98, 142, 151, 149, 167, 199, 98, 190, 199, 195, 142, 215, 149, 190, 41,
+    59, 126, 89, 113, 165, 177, 167, 108, 97, 161, 101, 95, 168, 155, 147, 68, 98, 137, 151, 77, 210, 165, 149, 67, 199, 192, 142, 40, 198, 145, 140, 31,
+    70, 135, 193, 168, 115, 173, 210, 115, 152, 203, 208, 152, 168, 135, 193, 70, 100, 162, 200, 150, 169, 117, 198, 88, 216, 197, 194, 141, 198, 96, 189, 33,
+    135, 185, 168, 112, 211, 171, 166, 107, 203, 201, 152, 93, 202, 133, 145, 58, 162, 186, 150, 75, 209, 110, 148, 63, 197, 191, 141, 38, 196, 92, 139, 26,
+    67, 165, 98, 167, 132, 178, 162, 117, 90, 168, 102, 147, 159, 156, 163, 76, 149, 210, 199, 149, 204, 166, 197, 96, 215, 198, 190, 140, 214, 148, 188, 39,
+    108, 177, 118, 108, 178, 176, 117, 105, 119, 155, 78, 68, 156, 154, 76, 64, 167, 165, 98, 67, 166, 164, 96, 57, 149, 145, 41, 31, 148, 144, 39, 25,
+    115, 211, 210, 166, 174, 172, 209, 114, 168, 202, 193, 145, 156, 130, 146, 66, 169, 209, 198, 148, 209, 114, 196, 86, 198, 196, 189, 139, 148, 86, 139, 30,
+    173, 171, 115, 107, 172, 170, 114, 104, 135, 133, 70, 58, 130, 123, 66, 48, 117, 110, 88, 63, 114, 104, 86, 51, 96, 92, 33, 26, 86, 56, 30, 9,
+    4, 62, 11, 63, 48, 104, 58, 107, 10, 66, 14, 67, 52, 106, 59, 108, 48, 104, 58, 107, 123, 170, 133, 171, 66, 114, 70, 115, 130, 172, 135, 173,
+    10, 66, 14, 67, 66, 114, 70, 115, 14, 70, 19, 71, 67, 115, 71, 116, 52, 106, 59, 108, 130, 172, 135, 173, 67, 115, 71, 116, 132, 174, 137, 111,
+    25, 144, 39, 148, 57, 164, 96, 166, 31, 145, 41, 149, 67, 165, 98, 167, 57, 164, 96, 166, 125, 176, 160, 179, 88, 166, 100, 169, 132, 178, 162, 117,
+    31, 145, 41, 149, 88, 166, 100, 169, 35, 152, 43, 153, 90, 168, 102, 147, 67, 165, 98, 167, 132, 178, 162, 117, 90, 168, 102, 147, 159, 156, 163, 76,
+    7, 74, 17, 75, 50, 110, 60, 112, 12, 76, 18, 77, 53, 111, 61, 113, 50, 110, 60, 112, 124, 171, 134, 175, 68, 117, 72, 119, 131, 173, 136, 131,
+    12, 76, 18, 77, 68, 117, 72, 119, 15, 78, 20, 79, 69, 118, 73, 69, 53, 111, 61, 113, 131, 173, 136, 131, 69, 118, 73, 69, 113, 111, 61, 53,
+    27, 146, 40, 150, 59, 165, 97, 168, 32, 147, 42, 151, 69, 116, 99, 89, 59, 165, 97, 168, 126, 177, 161, 155, 89, 167, 101, 147, 113, 108, 95, 68,
+    32, 147, 42, 151, 89, 167, 101, 147, 36, 101, 44, 42, 91, 89, 36, 32, 69, 116, 99, 89, 113, 108, 95, 68, 91, 89, 36, 32, 85, 65, 29, 12,
+    11, 63, 28, 84, 58, 107, 93, 112, 31, 88, 35, 90, 87, 115, 97, 119, 58, 107, 93, 112, 133, 171, 201, 185, 145, 166, 152, 168, 202, 211, 203, 135,
+    31, 88, 35, 90, 145, 166, 152, 168, 41, 100, 43, 102, 149, 169, 153, 147, 87, 115, 97, 119, 202, 211, 203, 135, 149, 169, 153, 147, 204, 209, 192, 94,
+    39, 148, 188, 214, 96, 166, 197, 204, 140, 198, 190, 215, 149, 210, 199, 149, 96, 166, 197, 204, 160, 179, 219, 160, 198, 218, 216, 198, 204, 166, 197, 96,
+    140, 198, 190, 215, 198, 218, 216, 198, 190, 216, 213, 190, 215, 198, 190, 140, 149, 210, 199, 149, 204, 166, 197, 96, 215, 198, 190, 140, 214, 148, 188, 39,
+    50, 110, 60, 112, 124, 171, 134, 175, 68, 117, 72, 119, 131, 173, 136, 131, 124, 171, 134, 175, 183, 212, 205, 183, 155, 179, 158, 155, 175, 171, 134, 124,
+    68, 117, 72, 119, 155, 179, 158, 155, 78, 120, 80, 78, 119, 117, 72, 68, 131, 173, 136, 131, 175, 171, 134, 124, 119, 117, 72, 68, 112, 110, 60, 50,
+    94, 209, 192, 204, 135, 211, 203, 202, 147, 169, 153, 149, 119, 115, 97, 87, 135, 211, 203, 202, 185, 171, 201, 133, 168, 166, 152, 145, 112, 107, 93, 58,
+    147, 169, 153, 149, 168, 166, 152, 145, 102, 100, 43, 41, 90, 88, 35, 31, 119, 115, 97, 87, 112, 107, 93, 58, 90, 88, 35, 31, 84, 63, 28, 11,
+    5, 64, 12, 65, 64, 105, 68, 108, 12, 68, 15, 69, 65, 108, 69, 109, 64, 105, 68, 108, 154, 176, 155, 177, 76, 117, 78, 118, 156, 178, 119, 108,
+    12, 68, 15, 69, 76, 117, 78, 118, 18, 72, 20, 73, 77, 119, 79, 69, 65, 108, 69, 109, 156, 178, 119, 108, 77, 119, 79, 69, 157, 156, 77, 65,
+    64, 154, 76, 156, 105, 176, 117, 178, 68, 155, 78, 119, 108, 177, 118, 108, 105, 176, 117, 178, 176, 180, 179, 176, 117, 179, 120, 117, 178, 176, 117, 105,
+    68, 155, 78, 119, 117, 179, 120, 117, 72, 158, 80, 72, 119, 155, 78, 68, 108, 177, 118, 108, 178, 176, 117, 105, 119, 155, 78, 68, 156, 154, 76, 64,
+    12, 76, 18, 77, 68, 117, 72, 119, 15, 78, 20, 79, 69, 118, 73, 69, 68, 117, 72, 119, 155, 179, 158, 155, 78, 120, 80, 78, 119, 117, 72, 68,
+    15, 78, 20, 79, 78, 120, 80, 78, 20, 80, 21, 20, 79, 78, 20, 15, 69, 118, 73, 69, 119, 117, 72, 68, 79, 78, 20, 15, 77, 76, 18, 12,
+    65, 156, 77, 157, 108, 178, 119, 156, 69, 119, 79, 77, 109, 108, 69, 65, 108, 178, 119, 156, 177, 176, 155, 154, 118, 117, 78, 76, 108, 105, 68, 64,
+    69, 119, 79, 77, 118, 117, 78, 76, 73, 72, 20, 18, 69, 68, 15, 12, 109, 108, 69, 65, 108, 105, 68, 64, 69, 68, 15, 12, 65, 64, 12, 5,
+    12, 65, 29, 85, 68, 108, 95, 113, 32, 89, 36, 91, 89, 116, 99, 69, 68, 108, 95, 113, 155, 177, 161, 126, 147, 167, 101, 89, 168, 165, 97, 59,
+    32, 89, 36, 91, 147, 167, 101, 89, 42, 101, 44, 36, 151, 147, 42, 32, 89, 116, 99, 69, 168, 165, 97, 59, 151, 147, 42, 32, 150, 146, 40, 27,
+    76, 156, 163, 159, 117, 178, 162, 132, 147, 168, 102, 90, 167, 165, 98, 67, 117, 178, 162, 132, 179, 176, 160, 125, 169, 166, 100, 88, 166, 164, 96, 57,
+    147, 168, 102, 90, 169, 166, 100, 88, 153, 152, 43, 35, 149, 145, 41, 31, 167, 165, 98, 67, 166, 164, 96, 57, 149, 145, 41, 31, 148, 144, 39, 25,
+    53, 111, 61, 113, 131, 173, 136, 131, 69, 118, 73, 69, 113, 111, 61, 53, 131, 173, 136, 131, 175, 171, 134, 124, 119, 117, 72, 68, 112, 110, 60, 50,
+    69, 118, 73, 69, 119, 117, 72, 68, 79, 78, 20, 15, 77, 76, 18, 12, 113, 111, 61, 53, 112, 110, 60, 50, 77, 76, 18, 12, 75, 74, 17, 7,
+    111, 174, 137, 132, 173, 172, 135, 130, 116, 115, 71, 67, 108, 106, 59, 52, 173, 172, 135, 130, 171, 170, 133, 123, 115, 114, 70, 66, 107, 104, 58, 48,
+    116, 115, 71, 67, 115, 114, 70, 66, 71, 70, 19, 14, 67, 66, 14, 10, 108, 106, 59, 52, 107, 104, 58, 48, 67, 66, 14, 10, 63, 62, 11, 4,
+    10, 66, 31, 88, 52, 106, 87, 115, 27, 94, 34, 98, 65, 111, 89, 118, 66, 114, 145, 166, 130, 172, 202, 211, 146, 209, 193, 210, 156, 174, 168, 115,
+    52, 130, 67, 132, 106, 172, 115, 174, 59, 135, 71, 137, 108, 173, 116, 111, 106, 172, 165, 178, 172, 217, 211, 172, 165, 211, 207, 165, 178, 172, 165, 106,
+    31, 145, 140, 198, 67, 165, 149, 210, 40, 192, 142, 199, 77, 137, 151, 98, 88, 166, 198, 218, 132, 178, 204, 166, 150, 204, 200, 198, 157, 132, 150, 88,
+    87, 202, 149, 204, 115, 211, 169, 209, 97, 203, 153, 192, 119, 135, 147, 94, 115, 211, 210, 166, 174, 172, 209, 114, 168, 202, 193, 145, 156, 130, 146, 66,
+    27, 146, 40, 150, 59, 165, 97, 168, 32, 147, 42, 151, 69, 116, 99, 89, 94, 209, 192, 204, 135, 211, 203, 202, 147, 169, 153, 149, 119, 115, 97, 87,
+    65, 156, 77, 157, 108, 178, 119, 156, 69, 119, 79, 77, 109, 108, 69, 65, 111, 174, 137, 132, 173, 172, 135, 130, 116, 115, 71, 67, 108, 106, 59, 52,
+    34, 193, 142, 200, 71, 207, 153, 193, 42, 153, 143, 142, 79, 71, 42, 34, 98, 210, 199, 198, 137, 165, 192, 145, 151, 149, 142, 140, 77, 67, 40, 31,
+    89, 168, 151, 150, 116, 165, 147, 146, 99, 97, 42, 40, 69, 59, 32, 27, 118, 115, 98, 88, 111, 106, 94, 66, 89, 87, 34, 31, 65, 52, 27, 10,
+    14, 67, 35, 90, 59, 108, 97, 119, 34, 98, 82, 102, 89, 118, 101, 78, 70, 115, 152, 168, 135, 173, 203, 135, 193, 210, 208, 193, 168, 115, 152, 70,
+    67, 132, 90, 159, 165, 178, 168, 156, 98, 162, 102, 163, 167, 117, 147, 76, 115, 174, 168, 156, 211, 172, 202, 130, 210, 209, 193, 146, 166, 114, 145, 66,
+    41, 149, 190, 215, 98, 167, 199, 149, 142, 199, 195, 190, 151, 98, 142, 41, 100, 169, 216, 198, 162, 117, 197, 96, 200, 198, 194, 189, 150, 88, 141, 33,
+    149, 204, 215, 214, 210, 166, 198, 148, 199, 197, 190, 188, 149, 96, 140, 39, 169, 209, 198, 148, 209, 114, 196, 86, 198, 196, 189, 139, 148, 86, 139, 30,
+    59, 165, 97, 168, 126, 177, 161, 155, 89, 167, 101, 147, 113, 108, 95, 68, 135, 211, 203, 202, 185, 171, 201, 133, 168, 166, 152, 145, 112, 107, 93, 58,
+    108, 178, 119, 156, 177, 176, 155, 154, 118, 117, 78, 76, 108, 105, 68, 64, 173, 172, 135, 130, 171, 170, 133, 123, 115, 114, 70, 66, 107, 104, 58, 48,
+    98, 210, 199, 198, 137, 165, 192, 145, 151, 149, 142, 140, 77, 67, 40, 31, 162, 209, 197, 196, 186, 110, 191, 92, 150, 148, 141, 139, 75, 63, 38, 26,
+    167, 166, 149, 148, 165, 164, 145, 144, 98, 96, 41, 39, 67, 57, 31, 25, 117, 114, 96, 86, 110, 104, 92, 56, 88, 86, 33, 30, 63, 51, 26, 9,
+    12, 68, 32, 89, 65, 108, 89, 116, 29, 95, 36, 99, 85, 113, 91, 69, 76, 117, 147, 167, 156, 178, 168, 165, 163, 162, 102, 98, 159, 132, 90, 67,
+    53, 131, 69, 113, 111, 173, 118, 111, 61, 136, 73, 61, 113, 131, 69, 53, 111, 173, 116, 108, 174, 172, 115, 106, 137, 135, 71, 59, 132, 130, 67, 52,
+    68, 155, 147, 168, 108, 177, 167, 165, 95, 161, 101, 97, 113, 126, 89, 59, 117, 179, 169, 166, 178, 176, 166, 164, 162, 160, 100, 96, 132, 125, 88, 57,
+    131, 175, 119, 112, 173, 171, 117, 110, 136, 134, 72, 60, 131, 124, 68, 50, 173, 171, 115, 107, 172, 170, 114, 104, 135, 133, 70, 58, 130, 123, 66, 48,
+    32, 147, 42, 151, 89, 167, 101, 147, 36, 101, 44, 42, 91, 89, 36, 32, 147, 169, 153, 149, 168, 166, 152, 145, 102, 100, 43, 41, 90, 88, 35, 31,
+    69, 119, 79, 77, 118, 117, 78, 76, 73, 72, 20, 18, 69, 68, 15, 12, 116, 115, 71, 67, 115, 114, 70, 66, 71, 70, 19, 14, 67, 66, 14, 10,
+    89, 168, 151, 150, 116, 165, 147, 146, 99, 97, 42, 40, 69, 59, 32, 27, 167, 166, 149, 148, 165, 164, 145, 144, 98, 96, 41, 39, 67, 57, 31, 25,
+    113, 112, 77, 75, 111, 110, 76, 74, 61, 60, 18, 17, 53, 50, 12, 7, 108, 107, 67, 63, 106, 104, 66, 62, 59, 58, 14, 11, 52, 48, 10, 4,
+    15, 69, 36, 91, 69, 109, 99, 69, 36, 99, 83, 36, 91, 69, 36, 15, 78, 118, 101, 89, 119, 108, 97, 59, 102, 98, 82, 34, 90, 67, 35, 14,
+    69, 113, 91, 85, 116, 108, 89, 65, 99, 95, 36, 29, 89, 68, 32, 12, 118, 111, 89, 65, 115, 106, 87, 52, 98, 94, 34, 27, 88, 66, 31, 10,
+    78, 119, 102, 90, 118, 108, 98, 67, 101, 97, 82, 35, 89, 59, 34, 14, 120, 117, 100, 88, 117, 105, 96, 57, 100, 96, 81, 33, 88, 57, 33, 13,
+    119, 112, 90, 84, 115, 107, 88, 63, 97, 93, 35, 28, 87, 58, 31, 11, 117, 110, 88, 63, 114, 104, 86, 51, 96, 92, 33, 26, 86, 56, 30, 9,
+    69, 116, 99, 89, 113, 108, 95, 68, 91, 89, 36, 32, 85, 65, 29, 12, 119, 115, 97, 87, 112, 107, 93, 58, 90, 88, 35, 31, 84, 63, 28, 11,
+    109, 108, 69, 65, 108, 105, 68, 64, 69, 68, 15, 12, 65, 64, 12, 5, 108, 106, 59, 52, 107, 104, 58, 48, 67, 66, 14, 10, 63, 62, 11, 4,
+    118, 115, 98, 88, 111, 106, 94, 66, 89, 87, 34, 31, 65, 52, 27, 10, 117, 114, 96, 86, 110, 104, 92, 56, 88, 86, 33, 30, 63, 51, 26, 9,
+    108, 107, 67, 63, 106, 104, 66, 62, 59, 58, 14, 11, 52, 48, 10, 4, 105, 104, 57, 51, 104, 103, 56, 46, 57, 56, 13, 9, 51, 46, 9, 2,
+    4, 48, 25, 57, 62, 104, 144, 164, 48, 123, 57, 125, 104, 170, 164, 176, 10, 52, 31, 67, 66, 106, 145, 165, 66, 130, 88, 132, 114, 172, 166, 178,
+    7, 50, 27, 59, 74, 110, 146, 165, 50, 124, 59, 126, 110, 171, 165, 177, 12, 53, 32, 69, 76, 111, 147, 116, 68, 131, 89, 113, 117, 173, 167, 108,
+    11, 58, 39, 96, 63, 107, 148, 166, 58, 133, 96, 160, 107, 171, 166, 179, 14, 59, 41, 98, 67, 108, 149, 167, 70, 135, 100, 162, 115, 173, 169, 117,
+    17, 60, 40, 97, 75, 112, 150, 168, 60, 134, 97, 161, 112, 175, 168, 155, 18, 61, 42, 99, 77, 113, 151, 89, 72, 136, 101, 95, 119, 131, 147, 68,
+    10, 66, 31, 88, 66, 114, 145, 166, 52, 130, 67, 132, 106, 172, 165, 178, 14, 67, 35, 90, 70, 115, 152, 168, 67, 132, 90, 159, 115, 174, 168, 156,
+    12, 68, 32, 89, 76, 117, 147, 167, 53, 131, 69, 113, 111, 173, 116, 108, 15, 69, 36, 91, 78, 118, 101, 89, 69, 113, 91, 85, 118, 111, 89, 65,
+    14, 70, 41, 100, 67, 115, 149, 169, 59, 135, 98, 162, 108, 173, 167, 117, 19, 71, 43, 102, 71, 116, 153, 147, 71, 137, 102, 163, 116, 111, 147, 76,
+    18, 72, 42, 101, 77, 119, 151, 147, 61, 136, 99, 95, 113, 131, 89, 68, 20, 73, 44, 36, 79, 69, 42, 32, 73, 61, 36, 29, 69, 53, 32, 12,
+    10, 52, 31, 67, 66, 106, 145, 165, 66, 130, 88, 132, 114, 172, 166, 178, 27, 65, 40, 77, 94, 111, 192, 137, 146, 156, 150, 157, 209, 174, 204, 132,
+    27, 59, 34, 71, 146, 165, 193, 207, 94, 135, 98, 137, 209, 211, 210, 165, 32, 69, 42, 79, 147, 116, 153, 71, 147, 119, 151, 77, 169, 115, 149, 67,
+    31, 87, 140, 149, 88, 115, 198, 210, 145, 202, 198, 204, 166, 211, 218, 166, 34, 89, 142, 151, 98, 118, 199, 98, 193, 168, 200, 150, 210, 115, 198, 88,
+    40, 97, 142, 153, 150, 168, 200, 193, 192, 203, 199, 192, 204, 202, 198, 145, 42, 99, 143, 42, 151, 89, 142, 34, 153, 97, 142, 40, 149, 87, 140, 31,
+    52, 106, 87, 115, 130, 172, 202, 211, 106, 172, 115, 174, 172, 217, 211, 172, 59, 108, 97, 119, 135, 173, 203, 135, 165, 178, 168, 156, 211, 172, 202, 130,
+    65, 108, 89, 116, 156, 178, 168, 165, 111, 173, 118, 111, 174, 172, 115, 106, 69, 109, 99, 69, 119, 108, 97, 59, 116, 108, 89, 65, 115, 106, 87, 52,
+    67, 115, 149, 169, 132, 174, 204, 209, 165, 211, 210, 209, 178, 172, 166, 114, 71, 116, 153, 147, 137, 111, 192, 94, 207, 165, 193, 146, 165, 106, 145, 66,
+    77, 119, 151, 147, 157, 156, 150, 146, 137, 135, 98, 94, 132, 130, 88, 66, 79, 69, 42, 32, 77, 65, 40, 27, 71, 59, 34, 27, 67, 52, 31, 10,
+    7, 50, 27, 59, 74, 110, 146, 165, 50, 124, 59, 126, 110, 171, 165, 177, 27, 59, 34, 71, 146, 165, 193, 207, 94, 135, 98, 137, 209, 211, 210, 165,
+    23, 55, 29, 61, 206, 186, 163, 137, 55, 128, 61, 129, 186, 185, 137, 126, 29, 61, 36, 73, 163, 137, 102, 71, 95, 136, 99, 61, 162, 135, 98, 59,
+    50, 124, 94, 135, 110, 171, 209, 211, 124, 183, 135, 185, 171, 212, 211, 171, 59, 126, 98, 137, 165, 177, 210, 165, 135, 185, 162, 186, 211, 171, 209, 110,
+    55, 128, 95, 136, 186, 185, 162, 135, 128, 184, 136, 128, 185, 183, 135, 124, 61, 129, 99, 61, 137, 126, 98, 59, 136, 128, 95, 55, 135, 124, 94, 50,
+    27, 94, 34, 98, 146, 209, 193, 210, 59, 135, 71, 137, 165, 211, 207, 165, 34, 98, 82, 102, 193, 210, 208, 193, 98, 162, 102, 163, 210, 209, 193, 146,
+    29, 95, 36, 99, 163, 162, 102, 98, 61, 136, 73, 61, 137, 135, 71, 59, 36, 99, 83, 36, 102, 98, 82, 34, 99, 95, 36, 29, 98, 94, 34, 27,
+    59, 135, 98, 162, 165, 211, 210, 209, 126, 185, 137, 186, 177, 171, 165, 110, 71, 137, 102, 163, 207, 165, 193, 146, 137, 186, 163, 206, 165, 110, 146, 74,
+    61, 136, 99, 95, 137, 135, 98, 94, 129, 128, 61, 55, 126, 124, 59, 50, 73, 61, 36, 29, 71, 59, 34, 27, 61, 55, 29, 23, 59, 50, 27, 7,
+    12, 53, 32, 69, 76, 111, 147, 116, 68, 131, 89, 113, 117, 173, 167, 108, 32, 69, 42, 79, 147, 116, 153, 71, 147, 119, 151, 77, 169, 115, 149, 67,
+    29, 61, 36, 73, 163, 137, 102, 71, 95, 136, 99, 61, 162, 135, 98, 59, 36, 73, 44, 20, 102, 71, 43, 19, 101, 72, 42, 18, 100, 70, 41, 14,
+    68, 131, 147, 119, 117, 173, 169, 115, 155, 175, 168, 112, 179, 171, 166, 107, 89, 113, 151, 77, 167, 108, 149, 67, 168, 112, 150, 75, 166, 107, 148, 63,
+    95, 136, 101, 72, 162, 135, 100, 70, 161, 134, 97, 60, 160, 133, 96, 58, 99, 61, 42, 18, 98, 59, 41, 14, 97, 60, 40, 17, 96, 58, 39, 11,
+    65, 111, 89, 118, 156, 174, 168, 115, 108, 173, 116, 111, 178, 172, 165, 106, 89, 118, 101, 78, 168, 115, 152, 70, 167, 117, 147, 76, 166, 114, 145, 66,
+    85, 113, 91, 69, 159, 132, 90, 67, 113, 131, 69, 53, 132, 130, 67, 52, 91, 69, 36, 15, 90, 67, 35, 14, 89, 68, 32, 12, 88, 66, 31, 10,
+    108, 173, 167, 117, 178, 172, 166, 114, 177, 171, 165, 110, 176, 170, 164, 104, 116, 111, 147, 76, 165, 106, 145, 66, 165, 110, 146, 74, 164, 104, 144, 62,
+    113, 131, 89, 68, 132, 130, 88, 66, 126, 124, 59, 50, 125, 123, 57, 48, 69, 53, 32, 12, 67, 52, 31, 10, 59, 50, 27, 7, 57, 48, 25, 4,
+    11, 58, 39, 96, 63, 107, 148, 166, 58, 133, 96, 160, 107, 171, 166, 179, 31, 87, 140, 149, 88, 115, 198, 210, 145, 202, 198, 204, 166, 211, 218, 166,
+    50, 124, 94, 135, 110, 171, 209, 211, 124, 183, 135, 185, 171, 212, 211, 171, 68, 131, 147, 119, 117, 173, 169, 115, 155, 175, 168, 112, 179, 171, 166, 107,
+    28, 93, 188, 197, 84, 112, 214, 204, 93, 201, 197, 219, 112, 185, 204, 160, 35, 97, 190, 199, 90, 119, 215, 149, 152, 203, 216, 197, 168, 135, 198, 96,
+    60, 134, 192, 203, 112, 175, 204, 202, 134, 205, 203, 201, 175, 183, 202, 133, 72, 136, 153, 97, 119, 131, 149, 87, 158, 134, 152, 93, 155, 124, 145, 58,
+    31, 145, 140, 198, 88, 166, 198, 218, 87, 202, 149, 204, 115, 211, 210, 166, 41, 149, 190, 215, 100, 169, 216, 198, 149, 204, 215, 214, 169, 209, 198, 148,
+    68, 155, 147, 168, 117, 179, 169, 166, 131, 175, 119, 112, 173, 171, 115, 107, 78, 119, 102, 90, 120, 117, 100, 88, 119, 112, 90, 84, 117, 110, 88, 63,
+    35, 152, 190, 216, 90, 168, 215, 198, 97, 203, 199, 197, 119, 135, 149, 96, 43, 153, 213, 190, 102, 147, 190, 140, 153, 192, 190, 188, 147, 94, 140, 39,
+    72, 158, 153, 152, 119, 155, 149, 145, 136, 134, 97, 93, 131, 124, 87, 58, 80, 72, 43, 35, 78, 68, 41, 31, 72, 60, 35, 28, 68, 50, 31, 11,
+    14, 59, 41, 98, 67, 108, 149, 167, 70, 135, 100, 162, 115, 173, 169, 117, 34, 89, 142, 151, 98, 118, 199, 98, 193, 168, 200, 150, 210, 115, 198, 88,
+    59, 126, 98, 137, 165, 177, 210, 165, 135, 185, 162, 186, 211, 171, 209, 110, 89, 113, 151, 77, 167, 108, 149, 67, 168, 112, 150, 75, 166, 107, 148, 63,
+    35, 97, 190, 199, 90, 119, 215, 149, 152, 203, 216, 197, 168, 135, 198, 96, 82, 101, 195, 142, 102, 78, 190, 41, 208, 152, 194, 141, 193, 70, 189, 33,
+    97, 161, 199, 192, 168, 155, 198, 145, 203, 201, 197, 191, 202, 133, 196, 92, 101, 95, 142, 40, 147, 68, 140, 31, 152, 93, 141, 38, 145, 58, 139, 26,
+    67, 165, 149, 210, 132, 178, 204, 166, 115, 211, 169, 209, 174, 172, 209, 114, 98, 167, 199, 149, 162, 117, 197, 96, 210, 166, 198, 148, 209, 114, 196, 86,
+    108, 177, 167, 165, 178, 176, 166, 164, 173, 171, 117, 110, 172, 170, 114, 104, 118, 108, 98, 67, 117, 105, 96, 57, 115, 107, 88, 63, 114, 104, 86, 51,
+    90, 168, 215, 198, 159, 156, 214, 148, 168, 202, 198, 196, 156, 130, 148, 86, 102, 147, 190, 140, 163, 76, 188, 39, 193, 145, 189, 139, 146, 66, 139, 30,
+    119, 155, 149, 145, 156, 154, 148, 144, 135, 133, 96, 92, 130, 123, 86, 56, 78, 68, 41, 31, 76, 64, 39, 25, 70, 58, 33, 26, 66, 48, 30, 9,
+    17, 60, 40, 97, 75, 112, 150, 168, 60, 134, 97, 161, 112, 175, 168, 155, 40, 97, 142, 153, 150, 168, 200, 193, 192, 203, 199, 192, 204, 202, 198, 145,
+    55, 128, 95, 136, 186, 185, 162, 135, 128, 184, 136, 128, 185, 183, 135, 124, 95, 136, 101, 72, 162, 135, 100, 70, 161, 134, 97, 60, 160, 133, 96, 58,
+    60, 134, 192, 203, 112, 175, 204, 202, 134, 205, 203, 201, 175, 183, 202, 133, 97, 161, 199, 192, 168, 155, 198, 145, 203, 201, 197, 191, 202, 133, 196, 92,
+    128, 184, 161, 134, 185, 183, 160, 133, 184, 182, 134, 127, 183, 181, 133, 122, 136, 128, 97, 60, 135, 124, 96, 58, 134, 127, 93, 54, 133, 122, 92, 49,
+    40, 192, 142, 199, 150, 204, 200, 198, 97, 203, 153, 192, 168, 202, 193, 145, 142, 199, 195, 190, 200, 198, 194, 189, 199, 197, 190, 188, 198, 196, 189, 139,
+    95, 161, 101, 97, 162, 160, 100, 96, 136, 134, 72, 60, 135, 133, 70, 58, 101, 97, 82, 35, 100, 96, 81, 33, 97, 93, 35, 28, 96, 92, 33, 26,
+    97, 203, 199, 197, 168, 202, 198, 196, 161, 201, 192, 191, 155, 133, 145, 92, 153, 192, 190, 188, 193, 145, 189, 139, 192, 191, 188, 187, 145, 92, 139, 37,
+    136, 134, 97, 93, 135, 133, 96, 92, 128, 127, 60, 54, 124, 122, 58, 49, 72, 60, 35, 28, 70, 58, 33, 26, 60, 54, 28, 22, 58, 49, 26, 6,
+    18, 61, 42, 99, 77, 113, 151, 89, 72, 136, 101, 95, 119, 131, 147, 68, 42, 99, 143, 42, 151, 89, 142, 34, 153, 97, 142, 40, 149, 87, 140, 31,
+    61, 129, 99, 61, 137, 126, 98, 59, 136, 128, 95, 55, 135, 124, 94, 50, 99, 61, 42, 18, 98, 59, 41, 14, 97, 60, 40, 17, 96, 58, 39, 11,
+    72, 136, 153, 97, 119, 131, 149, 87, 158, 134, 152, 93, 155, 124, 145, 58, 101, 95, 142, 40, 147, 68, 140, 31, 152, 93, 141, 38, 145, 58, 139, 26,
+    136, 128, 97, 60, 135, 124, 96, 58, 134, 127, 93, 54, 133, 122, 92, 49, 95, 55, 40, 17, 94, 50, 39, 11, 93, 54, 38, 16, 92, 49, 37, 6,
+    77, 137, 151, 98, 157, 132, 150, 88, 119, 135, 147, 94, 156, 130, 146, 66, 151, 98, 142, 41, 150, 88, 141, 33, 149, 96, 140, 39, 148, 86, 139, 30,
+    113, 126, 89, 59, 132, 125, 88, 57, 131, 124, 68, 50, 130, 123, 66, 48, 89, 59, 34, 14, 88, 57, 33, 13, 87, 58, 31, 11, 86, 56, 30, 9,
+    119, 135, 149, 96, 156, 130, 148, 86, 155, 133, 145, 92, 154, 123, 144, 56, 147, 94, 140, 39, 146, 66, 139, 30, 145, 92, 139, 37, 144, 56, 138, 24,
+    131, 124, 87, 58, 130, 123, 86, 56, 124, 122, 58, 49, 123, 121, 56, 47, 68, 50, 31, 11, 66, 48, 30, 9, 58, 49, 26, 6, 56, 47, 24, 3,
+    10, 66, 31, 88, 66, 114, 145, 166, 52, 130, 67, 132, 106, 172, 165, 178, 52, 106, 87, 115, 130, 172, 202, 211, 106, 172, 115, 174, 172, 217, 211, 172,
+    27, 94, 34, 98, 146, 209, 193, 210, 59, 135, 71, 137, 165, 211, 207, 165, 65, 111, 89, 118, 156, 174, 168, 115, 108, 173, 116, 111, 178, 172, 165, 106,
+    31, 145, 140, 198, 88, 166, 198, 218, 87, 202, 149, 204, 115, 211, 210, 166, 67, 165, 149, 210, 132, 178, 204, 166, 115, 211, 169, 209, 174, 172, 209, 114,
+    40, 192, 142, 199, 150, 204, 200, 198, 97, 203, 153, 192, 168, 202, 193, 145, 77, 137, 151, 98, 157, 132, 150, 88, 119, 135, 147, 94, 156, 130, 146, 66,
+    27, 146, 40, 150, 94, 209, 192, 204, 65, 156, 77, 157, 111, 174, 137, 132, 59, 165, 97, 168, 135, 211, 203, 202, 108, 178, 119, 156, 173, 172, 135, 130,
+    32, 147, 42, 151, 147, 169, 153, 149, 69, 119, 79, 77, 116, 115, 71, 67, 69, 116, 99, 89, 119, 115, 97, 87, 109, 108, 69, 65, 108, 106, 59, 52,
+    34, 193, 142, 200, 98, 210, 199, 198, 89, 168, 151, 150, 118, 115, 98, 88, 71, 207, 153, 193, 137, 165, 192, 145, 116, 165, 147, 146, 111, 106, 94, 66,
+    42, 153, 143, 142, 151, 149, 142, 140, 99, 97, 42, 40, 89, 87, 34, 31, 79, 71, 42, 34, 77, 67, 40, 31, 69, 59, 32, 27, 65, 52, 27, 10,
+    14, 67, 35, 90, 70, 115, 152, 168, 67, 132, 90, 159, 115, 174, 168, 156, 59, 108, 97, 119, 135, 173, 203, 135, 165, 178, 168, 156, 211, 172, 202, 130,
+    34, 98, 82, 102, 193, 210, 208, 193, 98, 162, 102, 163, 210, 209, 193, 146, 89, 118, 101, 78, 168, 115, 152, 70, 167, 117, 147, 76, 166, 114, 145, 66,
+    41, 149, 190, 215, 100, 169, 216, 198, 149, 204, 215, 214, 169, 209, 198, 148, 98, 167, 199, 149, 162, 117, 197, 96, 210, 166, 198, 148, 209, 114, 196, 86,
+    142, 199, 195, 190, 200, 198, 194, 189, 199, 197, 190, 188, 198, 196, 189, 139, 151, 98, 142, 41, 150, 88, 141, 33, 149, 96, 140, 39, 148, 86, 139, 30,
+    59, 165, 97, 168, 135, 211, 203, 202, 108, 178, 119, 156, 173, 172, 135, 130, 126, 177, 161, 155, 185, 171, 201, 133, 177, 176, 155, 154, 171, 170, 133, 123,
+    89, 167, 101, 147, 168, 166, 152, 145, 118, 117, 78, 76, 115, 114, 70, 66, 113, 108, 95, 68, 112, 107, 93, 58, 108, 105, 68, 64, 107, 104, 58, 48,
+    98, 210, 199, 198, 162, 209, 197, 196, 167, 166, 149, 148, 117, 114, 96, 86, 137, 165, 192, 145, 186, 110, 191, 92, 165, 164, 145, 144, 110, 104, 92, 56,
+    151, 149, 142, 140, 150, 148, 141, 139, 98, 96, 41, 39, 88, 86, 33, 30, 77, 67, 40, 31, 75, 63, 38, 26, 67, 57, 31, 25, 63, 51, 26, 9,
+    12, 68, 32, 89, 76, 117, 147, 167, 53, 131, 69, 113, 111, 173, 116, 108, 65, 108, 89, 116, 156, 178, 168, 165, 111, 173, 118, 111, 174, 172, 115, 106,
+    29, 95, 36, 99, 163, 162, 102, 98, 61, 136, 73, 61, 137, 135, 71, 59, 85, 113, 91, 69, 159, 132, 90, 67, 113, 131, 69, 53, 132, 130, 67, 52,
+    68, 155, 147, 168, 117, 179, 169, 166, 131, 175, 119, 112, 173, 171, 115, 107, 108, 177, 167, 165, 178, 176, 166, 164, 173, 171, 117, 110, 172, 170, 114, 104,
+    95, 161, 101, 97, 162, 160, 100, 96, 136, 134, 72, 60, 135, 133, 70, 58, 113, 126, 89, 59, 132, 125, 88, 57, 131, 124, 68, 50, 130, 123, 66, 48,
+    32, 147, 42, 151, 147, 169, 153, 149, 69, 119, 79, 77, 116, 115, 71, 67, 89, 167, 101, 147, 168, 166, 152, 145, 118, 117, 78, 76, 115, 114, 70, 66,
+    36, 101, 44, 42, 102, 100, 43, 41, 73, 72, 20, 18, 71, 70, 19, 14, 91, 89, 36, 32, 90, 88, 35, 31, 69, 68, 15, 12, 67, 66, 14, 10,
+    89, 168, 151, 150, 167, 166, 149, 148, 113, 112, 77, 75, 108, 107, 67, 63, 116, 165, 147, 146, 165, 164, 145, 144, 111, 110, 76, 74, 106, 104, 66, 62,
+    99, 97, 42, 40, 98, 96, 41, 39, 61, 60, 18, 17, 59, 58, 14, 11, 69, 59, 32, 27, 67, 57, 31, 25, 53, 50, 12, 7, 52, 48, 10, 4,
+    15, 69, 36, 91, 78, 118, 101, 89, 69, 113, 91, 85, 118, 111, 89, 65, 69, 109, 99, 69, 119, 108, 97, 59, 116, 108, 89, 65, 115, 106, 87, 52,
+    36, 99, 83, 36, 102, 98, 82, 34, 99, 95, 36, 29, 98, 94, 34, 27, 91, 69, 36, 15, 90, 67, 35, 14, 89, 68, 32, 12, 88, 66, 31, 10,
+    78, 119, 102, 90, 120, 117, 100, 88, 119, 112, 90, 84, 117, 110, 88, 63, 118, 108, 98, 67, 117, 105, 96, 57, 115, 107, 88, 63, 114, 104, 86, 51,
+    101, 97, 82, 35, 100, 96, 81, 33, 97, 93, 35, 28, 96, 92, 33, 26, 89, 59, 34, 14, 88, 57, 33, 13, 87, 58, 31, 11, 86, 56, 30, 9,
+    69, 116, 99, 89, 119, 115, 97, 87, 109, 108, 69, 65, 108, 106, 59, 52, 113, 108, 95, 68, 112, 107, 93, 58, 108, 105, 68, 64, 107, 104, 58, 48,
+    91, 89, 36, 32, 90, 88, 35, 31, 69, 68, 15, 12, 67, 66, 14, 10, 85, 65, 29, 12, 84, 63, 28, 11, 65, 64, 12, 5, 63, 62, 11, 4,
+    118, 115, 98, 88, 117, 114, 96, 86, 108, 107, 67, 63, 105, 104, 57, 51, 111, 106, 94, 66, 110, 104, 92, 56, 106, 104, 66, 62, 104, 103, 56, 46,
+    89, 87, 34, 31, 88, 86, 33, 30, 59, 58, 14, 11, 57, 56, 13, 9, 65, 52, 27, 10, 63, 51, 26, 9, 52, 48, 10, 4, 51, 46, 9, 2,
+    14, 70, 41, 100, 67, 115, 149, 169, 59, 135, 98, 162, 108, 173, 167, 117, 67, 115, 149, 169, 132, 174, 204, 209, 165, 211, 210, 209, 178, 172, 166, 114,
+    59, 135, 98, 162, 165, 211, 210, 209, 126, 185, 137, 186, 177, 171, 165, 110, 108, 173, 167, 117, 178, 172, 166, 114, 177, 171, 165, 110, 176, 170, 164, 104,
+    35, 152, 190, 216, 90, 168, 215, 198, 97, 203, 199, 197, 119, 135, 149, 96, 90, 168, 215, 198, 159, 156, 214, 148, 168, 202, 198, 196, 156, 130, 148, 86,
+    97, 203, 199, 197, 168, 202, 198, 196, 161, 201, 192, 191, 155, 133, 145, 92, 119, 135, 149, 96, 156, 130, 148, 86, 155, 133, 145, 92, 154, 123, 144, 56,
+    34, 193, 142, 200, 98, 210, 199, 198, 89, 168, 151, 150, 118, 115, 98, 88, 98, 210, 199, 198, 162, 209, 197, 196, 167, 166, 149, 148, 117, 114, 96, 86,
+    89, 168, 151, 150, 167, 166, 149, 148, 113, 112, 77, 75, 108, 107, 67, 63, 118, 115, 98, 88, 117, 114, 96, 86, 108, 107, 67, 63, 105, 104, 57, 51,
+    82, 208, 195, 194, 102, 193, 190, 189, 101, 152, 142, 141, 78, 70, 41, 33, 102, 193, 190, 189, 163, 146, 188, 139, 147, 145, 140, 139, 76, 66, 39, 30,
+    101, 152, 142, 141, 147, 145, 140, 139, 95, 93, 40, 38, 68, 58, 31, 26, 78, 70, 41, 33, 76, 66, 39, 30, 68, 58, 31, 26, 64, 48, 25, 9,
+    19, 71, 43, 102, 71, 116, 153, 147, 71, 137, 102, 163, 116, 111, 147, 76, 71, 116, 153, 147, 137, 111, 192, 94, 207, 165, 193, 146, 165, 106, 145, 66,
+    71, 137, 102, 163, 207, 165, 193, 146, 137, 186, 163, 206, 165, 110, 146, 74, 116, 111, 147, 76, 165, 106, 145, 66, 165, 110, 146, 74, 164, 104, 144, 62,
+    43, 153, 213, 190, 102, 147, 190, 140, 153, 192, 190, 188, 147, 94, 140, 39, 102, 147, 190, 140, 163, 76, 188, 39, 193, 145, 189, 139, 146, 66, 139, 30,
+    153, 192, 190, 188, 193, 145, 189, 139, 192, 191, 188, 187, 145, 92, 139, 37, 147, 94, 140, 39, 146, 66, 139, 30, 145, 92, 139, 37, 144, 56, 138, 24,
+    71, 207, 153, 193, 137, 165, 192, 145, 116, 165, 147, 146, 111, 106, 94, 66, 137, 165, 192, 145, 186, 110, 191, 92, 165, 164, 145, 144, 110, 104, 92, 56,
+    116, 165, 147, 146, 165, 164, 145, 144, 111, 110, 76, 74, 106, 104, 66, 62, 111, 106, 94, 66, 110, 104, 92, 56, 106, 104, 66, 62, 104, 103, 56, 46,
+    102, 193, 190, 189, 163, 146, 188, 139, 147, 145, 140, 139, 76, 66, 39, 30, 163, 146, 188, 139, 206, 74, 187, 37, 146, 144, 139, 138, 74, 62, 37, 24,
+    147, 145, 140, 139, 146, 144, 139, 138, 94, 92, 39, 37, 66, 56, 30, 24, 76, 66, 39, 30, 74, 62, 37, 24, 66, 56, 30, 24, 62, 46, 24, 8,
+    18, 72, 42, 101, 77, 119, 151, 147, 61, 136, 99, 95, 113, 131, 89, 68, 77, 119, 151, 147, 157, 156, 150, 146, 137, 135, 98, 94, 132, 130, 88, 66,
+    61, 136, 99, 95, 137, 135, 98, 94, 129, 128, 61, 55, 126, 124, 59, 50, 113, 131, 89, 68, 132, 130, 88, 66, 126, 124, 59, 50, 125, 123, 57, 48,
+    72, 158, 153, 152, 119, 155, 149, 145, 136, 134, 97, 93, 131, 124, 87, 58, 119, 155, 149, 145, 156, 154, 148, 144, 135, 133, 96, 92, 130, 123, 86, 56,
+    136, 134, 97, 93, 135, 133, 96, 92, 128, 127, 60, 54, 124, 122, 58, 49, 131, 124, 87, 58, 130, 123, 86, 56, 124, 122, 58, 49, 123, 121, 56, 47,
+    42, 153, 143, 142, 151, 149, 142, 140, 99, 97, 42, 40, 89, 87, 34, 31, 151, 149, 142, 140, 150, 148, 141, 139, 98, 96, 41, 39, 88, 86, 33, 30,
+    99, 97, 42, 40, 98, 96, 41, 39, 61, 60, 18, 17, 59, 58, 14, 11, 89, 87, 34, 31, 88, 86, 33, 30, 59, 58, 14, 11, 57, 56, 13, 9,
+    101, 152, 142, 141, 147, 145, 140, 139, 95, 93, 40, 38, 68, 58, 31, 26, 147, 145, 140, 139, 146, 144, 139, 138, 94, 92, 39, 37, 66, 56, 30, 24,
+    95, 93, 40, 38, 94, 92, 39, 37, 55, 54, 17, 16, 50, 49, 11, 6, 68, 58, 31, 26, 66, 56, 30, 24, 50, 49, 11, 6, 48, 47, 9, 3,
+    20, 73, 44, 36, 79, 69, 42, 32, 73, 61, 36, 29, 69, 53, 32, 12, 79, 69, 42, 32, 77, 65, 40, 27, 71, 59, 34, 27, 67, 52, 31, 10,
+    73, 61, 36, 29, 71, 59, 34, 27, 61, 55, 29, 23, 59, 50, 27, 7, 69, 53, 32, 12, 67, 52, 31, 10, 59, 50, 27, 7, 57, 48, 25, 4,
+    80, 72, 43, 35, 78, 68, 41, 31, 72, 60, 35, 28, 68, 50, 31, 11, 78, 68, 41, 31, 76, 64, 39, 25, 70, 58, 33, 26, 66, 48, 30, 9,
+    72, 60, 35, 28, 70, 58, 33, 26, 60, 54, 28, 22, 58, 49, 26, 6, 68, 50, 31, 11, 66, 48, 30, 9, 58, 49, 26, 6, 56, 47, 24, 3,
+    79, 71, 42, 34, 77, 67, 40, 31, 69, 59, 32, 27, 65, 52, 27, 10, 77, 67, 40, 31, 75, 63, 38, 26, 67, 57, 31, 25, 63, 51, 26, 9,
+    69, 59, 32, 27, 67, 57, 31, 25, 53, 50, 12, 7, 52, 48, 10, 4, 65, 52, 27, 10, 63, 51, 26, 9, 52, 48, 10, 4, 51, 46, 9, 2,
+    78, 70, 41, 33, 76, 66, 39, 30, 68, 58, 31, 26, 64, 48, 25, 9, 76, 66, 39, 30, 74, 62, 37, 24, 66, 56, 30, 24, 62, 46, 24, 8,
+    68, 58, 31, 26, 66, 56, 30, 24, 50, 49, 11, 6, 48, 47, 9, 3, 64, 48, 25, 9, 62, 46, 24, 8, 48, 47, 9, 3, 46, 45, 8, 1,
+    2, 46, 46, 103, 9, 51, 56, 104, 9, 56, 51, 104, 13, 57, 57, 105, 9, 51, 56, 104, 26, 63, 92, 110, 30, 86, 86, 114, 33, 88, 96, 117,
+    9, 56, 51, 104, 30, 86, 86, 114, 26, 92, 63, 110, 33, 96, 88, 117, 13, 57, 57, 105, 33, 88, 96, 117, 33, 96, 88, 117, 81, 100, 100, 120,
+    4, 48, 62, 104, 10, 52, 66, 106, 11, 58, 63, 107, 14, 59, 67, 108, 10, 52, 66, 106, 27, 65, 94, 111, 31, 87, 88, 115, 34, 89, 98, 118,
+    11, 58, 63, 107, 31, 87, 88, 115, 28, 93, 84, 112, 35, 97, 90, 119, 14, 59, 67, 108, 34, 89, 98, 118, 35, 97, 90, 119, 82, 101, 102, 78,
+    4, 62, 48, 104, 11, 63, 58, 107, 10, 66, 52, 106, 14, 67, 59, 108, 11, 63, 58, 107, 28, 84, 93, 112, 31, 88, 87, 115, 35, 90, 97, 119,
+    10, 66, 52, 106, 31, 88, 87, 115, 27, 94, 65, 111, 34, 98, 89, 118, 14, 67, 59, 108, 35, 90, 97, 119, 34, 98, 89, 118, 82, 102, 101, 78,
+    5, 64, 64, 105, 12, 65, 68, 108, 12, 68, 65, 108, 15, 69, 69, 109, 12, 65, 68, 108, 29, 85, 95, 113, 32, 89, 89, 116, 36, 91, 99, 69,
+    12, 68, 65, 108, 32, 89, 89, 116, 29, 95, 85, 113, 36, 99, 91, 69, 15, 69, 69, 109, 36, 91, 99, 69, 36, 99, 91, 69, 83, 36, 36, 15,
+    9, 51, 56, 104, 26, 63, 92, 110, 30, 86, 86, 114, 33, 88, 96, 117, 26, 63, 92, 110, 38, 75, 191, 186, 139, 148, 196, 209, 141, 150, 197, 162,
+    30, 86, 86, 114, 139, 148, 196, 209, 139, 196, 148, 209, 189, 198, 198, 169, 33, 88, 96, 117, 141, 150, 197, 162, 189, 198, 198, 169, 194, 200, 216, 100,
+    25, 57, 144, 164, 31, 67, 145, 165, 39, 96, 148, 166, 41, 98, 149, 167, 31, 67, 145, 165, 40, 77, 192, 137, 140, 149, 198, 210, 142, 151, 199, 98,
+    39, 96, 148, 166, 140, 149, 198, 210, 188, 197, 214, 204, 190, 199, 215, 149, 41, 98, 149, 167, 142, 151, 199, 98, 190, 199, 215, 149, 195, 142, 190, 41,
+    48, 104, 123, 170, 58, 107, 133, 171, 66, 114, 130, 172, 70, 115, 135, 173, 58, 107, 133, 171, 93, 112, 201, 185, 145, 166, 202, 211, 152, 168, 203, 135,
+    66, 114, 130, 172, 145, 166, 202, 211, 146, 209, 156, 174, 193, 210, 168, 115, 70, 115, 135, 173, 152, 168, 203, 135, 193, 210, 168, 115, 208, 193, 152, 70,
+    64, 105, 154, 176, 68, 108, 155, 177, 76, 117, 156, 178, 78, 118, 119, 108, 68, 108, 155, 177, 95, 113, 161, 126, 147, 167, 168, 165, 101, 89, 97, 59,
+    76, 117, 156, 178, 147, 167, 168, 165, 163, 162, 159, 132, 102, 98, 90, 67, 78, 118, 119, 108, 101, 89, 97, 59, 102, 98, 90, 67, 82, 34, 35, 14,
+    9, 56, 51, 104, 30, 86, 86, 114, 26, 92, 63, 110, 33, 96, 88, 117, 30, 86, 86, 114, 139, 148, 196, 209, 139, 196, 148, 209, 189, 198, 198, 169,
+    26, 92, 63, 110, 139, 196, 148, 209, 38, 191, 75, 186, 141, 197, 150, 162, 33, 96, 88, 117, 189, 198, 198, 169, 141, 197, 150, 162, 194, 216, 200, 100,
+    48, 123, 104, 170, 66, 130, 114, 172, 58, 133, 107, 171, 70, 135, 115, 173, 66, 130, 114, 172, 146, 156, 209, 174, 145, 202, 166, 211, 193, 168, 210, 115,
+    58, 133, 107, 171, 145, 202, 166, 211, 93, 201, 112, 185, 152, 203, 168, 135, 70, 135, 115, 173, 193, 168, 210, 115, 152, 203, 168, 135, 208, 152, 193, 70,
+    25, 144, 57, 164, 39, 148, 96, 166, 31, 145, 67, 165, 41, 149, 98, 167, 39, 148, 96, 166, 188, 214, 197, 204, 140, 198, 149, 210, 190, 215, 199, 149,
+    31, 145, 67, 165, 140, 198, 149, 210, 40, 192, 77, 137, 142, 199, 151, 98, 41, 149, 98, 167, 190, 215, 199, 149, 142, 199, 151, 98, 195, 190, 142, 41,
+    64, 154, 105, 176, 76, 156, 117, 178, 68, 155, 108, 177, 78, 119, 118, 108, 76, 156, 117, 178, 163, 159, 162, 132, 147, 168, 167, 165, 102, 90, 98, 67,
+    68, 155, 108, 177, 147, 168, 167, 165, 95, 161, 113, 126, 101, 97, 89, 59, 78, 119, 118, 108, 102, 90, 98, 67, 101, 97, 89, 59, 82, 35, 34, 14,
+    13, 57, 57, 105, 33, 88, 96, 117, 33, 96, 88, 117, 81, 100, 100, 120, 33, 88, 96, 117, 141, 150, 197, 162, 189, 198, 198, 169, 194, 200, 216, 100,
+    33, 96, 88, 117, 189, 198, 198, 169, 141, 197, 150, 162, 194, 216, 200, 100, 81, 100, 100, 120, 194, 200, 216, 100, 194, 216, 200, 100, 0, 194, 194, 81,
+    57, 125, 164, 176, 88, 132, 166, 178, 96, 160, 166, 179, 100, 162, 169, 117, 88, 132, 166, 178, 150, 157, 204, 132, 198, 204, 218, 166, 200, 150, 198, 88,
+    96, 160, 166, 179, 198, 204, 218, 166, 197, 219, 204, 160, 216, 197, 198, 96, 100, 162, 169, 117, 200, 150, 198, 88, 216, 197, 198, 96, 194, 141, 189, 33,
+    57, 164, 125, 176, 96, 166, 160, 179, 88, 166, 132, 178, 100, 169, 162, 117, 96, 166, 160, 179, 197, 204, 219, 160, 198, 218, 204, 166, 216, 198, 197, 96,
+    88, 166, 132, 178, 198, 218, 204, 166, 150, 204, 157, 132, 200, 198, 150, 88, 100, 169, 162, 117, 216, 198, 197, 96, 200, 198, 150, 88, 194, 189, 141, 33,
+    105, 176, 176, 180, 117, 178, 179, 176, 117, 179, 178, 176, 120, 117, 117, 105, 117, 178, 179, 176, 162, 132, 160, 125, 169, 166, 166, 164, 100, 88, 96, 57,
+    117, 179, 178, 176, 169, 166, 166, 164, 162, 160, 132, 125, 100, 96, 88, 57, 120, 117, 117, 105, 100, 88, 96, 57, 100, 96, 88, 57, 81, 33, 33, 13,
+    4, 48, 62, 104, 10, 52, 66, 106, 11, 58, 63, 107, 14, 59, 67, 108, 25, 57, 144, 164, 31, 67, 145, 165, 39, 96, 148, 166, 41, 98, 149, 167,
+    48, 123, 104, 170, 66, 130, 114, 172, 58, 133, 107, 171, 70, 135, 115, 173, 57, 125, 164, 176, 88, 132, 166, 178, 96, 160, 166, 179, 100, 162, 169, 117,
+    7, 50, 74, 110, 12, 53, 76, 111, 17, 60, 75, 112, 18, 61, 77, 113, 27, 59, 146, 165, 32, 69, 147, 116, 40, 97, 150, 168, 42, 99, 151, 89,
+    50, 124, 110, 171, 68, 131, 117, 173, 60, 134, 112, 175, 72, 136, 119, 131, 59, 126, 165, 177, 89, 113, 167, 108, 97, 161, 168, 155, 101, 95, 147, 68,
+    10, 66, 66, 114, 14, 67, 70, 115, 14, 70, 67, 115, 19, 71, 71, 116, 31, 88, 145, 166, 35, 90, 152, 168, 41, 100, 149, 169, 43, 102, 153, 147,
+    52, 130, 106, 172, 67, 132, 115, 174, 59, 135, 108, 173, 71, 137, 116, 111, 67, 132, 165, 178, 90, 159, 168, 156, 98, 162, 167, 117, 102, 163, 147, 76,
+    12, 68, 76, 117, 15, 69, 78, 118, 18, 72, 77, 119, 20, 73, 79, 69, 32, 89, 147, 167, 36, 91, 101, 89, 42, 101, 151, 147, 44, 36, 42, 32,
+    53, 131, 111, 173, 69, 113, 118, 111, 61, 136, 113, 131, 73, 61, 69, 53, 69, 113, 116, 108, 91, 85, 89, 65, 99, 95, 89, 68, 36, 29, 32, 12,
+    10, 52, 66, 106, 27, 65, 94, 111, 31, 87, 88, 115, 34, 89, 98, 118, 31, 67, 145, 165, 40, 77, 192, 137, 140, 149, 198, 210, 142, 151, 199, 98,
+    66, 130, 114, 172, 146, 156, 209, 174, 145, 202, 166, 211, 193, 168, 210, 115, 88, 132, 166, 178, 150, 157, 204, 132, 198, 204, 218, 166, 200, 150, 198, 88,
+    27, 59, 146, 165, 32, 69, 147, 116, 40, 97, 150, 168, 42, 99, 151, 89, 34, 71, 193, 207, 42, 79, 153, 71, 142, 153, 200, 193, 143, 42, 142, 34,
+    94, 135, 209, 211, 147, 119, 169, 115, 192, 203, 204, 202, 153, 97, 149, 87, 98, 137, 210, 165, 151, 77, 149, 67, 199, 192, 198, 145, 142, 40, 140, 31,
+    52, 106, 130, 172, 59, 108, 135, 173, 67, 115, 132, 174, 71, 116, 137, 111, 87, 115, 202, 211, 97, 119, 203, 135, 149, 169, 204, 209, 153, 147, 192, 94,
+    106, 172, 172, 217, 165, 178, 211, 172, 165, 211, 178, 172, 207, 165, 165, 106, 115, 174, 211, 172, 168, 156, 202, 130, 210, 209, 166, 114, 193, 146, 145, 66,
+    65, 108, 156, 178, 69, 109, 119, 108, 77, 119, 157, 156, 79, 69, 77, 65, 89, 116, 168, 165, 99, 69, 97, 59, 151, 147, 150, 146, 42, 32, 40, 27,
+    111, 173, 174, 172, 116, 108, 115, 106, 137, 135, 132, 130, 71, 59, 67, 52, 118, 111, 115, 106, 89, 65, 87, 52, 98, 94, 88, 66, 34, 27, 31, 10,
+    11, 58, 63, 107, 31, 87, 88, 115, 28, 93, 84, 112, 35, 97, 90, 119, 39, 96, 148, 166, 140, 149, 198, 210, 188, 197, 214, 204, 190, 199, 215, 149,
+    58, 133, 107, 171, 145, 202, 166, 211, 93, 201, 112, 185, 152, 203, 168, 135, 96, 160, 166, 179, 198, 204, 218, 166, 197, 219, 204, 160, 216, 197, 198, 96,
+    50, 124, 110, 171, 68, 131, 117, 173, 60, 134, 112, 175, 72, 136, 119, 131, 94, 135, 209, 211, 147, 119, 169, 115, 192, 203, 204, 202, 153, 97, 149, 87,
+    124, 183, 171, 212, 155, 175, 179, 171, 134, 205, 175, 183, 158, 134, 155, 124, 135, 185, 211, 171, 168, 112, 166, 107, 203, 201, 202, 133, 152, 93, 145, 58,
+    31, 145, 88, 166, 41, 149, 100, 169, 35, 152, 90, 168, 43, 153, 102, 147, 140, 198, 198, 218, 190, 215, 216, 198, 190, 216, 215, 198, 213, 190, 190, 140,
+    87, 202, 115, 211, 149, 204, 169, 209, 97, 203, 119, 135, 153, 192, 147, 94, 149, 204, 210, 166, 215, 214, 198, 148, 199, 197, 149, 96, 190, 188, 140, 39,
+    68, 155, 117, 179, 78, 119, 120, 117, 72, 158, 119, 155, 80, 72, 78, 68, 147, 168, 169, 166, 102, 90, 100, 88, 153, 152, 149, 145, 43, 35, 41, 31,
+    131, 175, 173, 171, 119, 112, 117, 110, 136, 134, 131, 124, 72, 60, 68, 50, 119, 112, 115, 107, 90, 84, 88, 63, 97, 93, 87, 58, 35, 28, 31, 11,
+    14, 59, 67, 108, 34, 89, 98, 118, 35, 97, 90, 119, 82, 101, 102, 78, 41, 98, 149, 167, 142, 151, 199, 98, 190, 199, 215, 149, 195, 142, 190, 41,
+    70, 135, 115, 173, 193, 168, 210, 115, 152, 203, 168, 135, 208, 152, 193, 70, 100, 162, 169, 117, 200, 150, 198, 88, 216, 197, 198, 96, 194, 141, 189, 33,
+    59, 126, 165, 177, 89, 113, 167, 108, 97, 161, 168, 155, 101, 95, 147, 68, 98, 137, 210, 165, 151, 77, 149, 67, 199, 192, 198, 145, 142, 40, 140, 31,
+    135, 185, 211, 171, 168, 112, 166, 107, 203, 201, 202, 133, 152, 93, 145, 58, 162, 186, 209, 110, 150, 75, 148, 63, 197, 191, 196, 92, 141, 38, 139, 26,
+    67, 165, 132, 178, 98, 167, 162, 117, 90, 168, 159, 156, 102, 147, 163, 76, 149, 210, 204, 166, 199, 149, 197, 96, 215, 198, 214, 148, 190, 140, 188, 39,
+    115, 211, 174, 172, 210, 166, 209, 114, 168, 202, 156, 130, 193, 145, 146, 66, 169, 209, 209, 114, 198, 148, 196, 86, 198, 196, 148, 86, 189, 139, 139, 30,
+    108, 177, 178, 176, 118, 108, 117, 105, 119, 155, 156, 154, 78, 68, 76, 64, 167, 165, 166, 164, 98, 67, 96, 57, 149, 145, 148, 144, 41, 31, 39, 25,
+    173, 171, 172, 170, 115, 107, 114, 104, 135, 133, 130, 123, 70, 58, 66, 48, 117, 110, 114, 104, 88, 63, 86, 51, 96, 92, 86, 56, 33, 26, 30, 9,
+    4, 62, 48, 104, 11, 63, 58, 107, 10, 66, 52, 106, 14, 67, 59, 108, 48, 104, 123, 170, 58, 107, 133, 171, 66, 114, 130, 172, 70, 115, 135, 173,
+    25, 144, 57, 164, 39, 148, 96, 166, 31, 145, 67, 165, 41, 149, 98, 167, 57, 164, 125, 176, 96, 166, 160, 179, 88, 166, 132, 178, 100, 169, 162, 117,
+    10, 66, 66, 114, 14, 67, 70, 115, 14, 70, 67, 115, 19, 71, 71, 116, 52, 106, 130, 172, 59, 108, 135, 173, 67, 115, 132, 174, 71, 116, 137, 111,
+    31, 145, 88, 166, 41, 149, 100, 169, 35, 152, 90, 168, 43, 153, 102, 147, 67, 165, 132, 178, 98, 167, 162, 117, 90, 168, 159, 156, 102, 147, 163, 76,
+    7, 74, 50, 110, 17, 75, 60, 112, 12, 76, 53, 111, 18, 77, 61, 113, 50, 110, 124, 171, 60, 112, 134, 175, 68, 117, 131, 173, 72, 119, 136, 131,
+    27, 146, 59, 165, 40, 150, 97, 168, 32, 147, 69, 116, 42, 151, 99, 89, 59, 165, 126, 177, 97, 168, 161, 155, 89, 167, 113, 108, 101, 147, 95, 68,
+    12, 76, 68, 117, 18, 77, 72, 119, 15, 78, 69, 118, 20, 79, 73, 69, 53, 111, 131, 173, 61, 113, 136, 131, 69, 118, 113, 111, 73, 69, 61, 53,
+    32, 147, 89, 167, 42, 151, 101, 147, 36, 101, 91, 89, 44, 42, 36, 32, 69, 116, 113, 108, 99, 89, 95, 68, 91, 89, 85, 65, 36, 32, 29, 12,
+    11, 63, 58, 107, 28, 84, 93, 112, 31, 88, 87, 115, 35, 90, 97, 119, 58, 107, 133, 171, 93, 112, 201, 185, 145, 166, 202, 211, 152, 168, 203, 135,
+    39, 148, 96, 166, 188, 214, 197, 204, 140, 198, 149, 210, 190, 215, 199, 149, 96, 166, 160, 179, 197, 204, 219, 160, 198, 218, 204, 166, 216, 198, 197, 96,
+    31, 88, 145, 166, 35, 90, 152, 168, 41, 100, 149, 169, 43, 102, 153, 147, 87, 115, 202, 211, 97, 119, 203, 135, 149, 169, 204, 209, 153, 147, 192, 94,
+    140, 198, 198, 218, 190, 215, 216, 198, 190, 216, 215, 198, 213, 190, 190, 140, 149, 210, 204, 166, 199, 149, 197, 96, 215, 198, 214, 148, 190, 140, 188, 39,
+    50, 110, 124, 171, 60, 112, 134, 175, 68, 117, 131, 173, 72, 119, 136, 131, 124, 171, 183, 212, 134, 175, 205, 183, 155, 179, 175, 171, 158, 155, 134, 124,
+    94, 209, 135, 211, 192, 204, 203, 202, 147, 169, 119, 115, 153, 149, 97, 87, 135, 211, 185, 171, 203, 202, 201, 133, 168, 166, 112, 107, 152, 145, 93, 58,
+    68, 117, 155, 179, 72, 119, 158, 155, 78, 120, 119, 117, 80, 78, 72, 68, 131, 173, 175, 171, 136, 131, 134, 124, 119, 117, 112, 110, 72, 68, 60, 50,
+    147, 169, 168, 166, 153, 149, 152, 145, 102, 100, 90, 88, 43, 41, 35, 31, 119, 115, 112, 107, 97, 87, 93, 58, 90, 88, 84, 63, 35, 31, 28, 11,
+    10, 66, 52, 106, 31, 88, 87, 115, 27, 94, 65, 111, 34, 98, 89, 118, 66, 114, 130, 172, 145, 166, 202, 211, 146, 209, 156, 174, 193, 210, 168, 115,
+    31, 145, 67, 165, 140, 198, 149, 210, 40, 192, 77, 137, 142, 199, 151, 98, 88, 166, 132, 178, 198, 218, 204, 166, 150, 204, 157, 132, 200, 198, 150, 88,
+    52, 130, 106, 172, 67, 132, 115, 174, 59, 135, 108, 173, 71, 137, 116, 111, 106, 172, 172, 217, 165, 178, 211, 172, 165, 211, 178, 172, 207, 165, 165, 106,
+    87, 202, 115, 211, 149, 204, 169, 209, 97, 203, 119, 135, 153, 192, 147, 94, 115, 211, 174, 172, 210, 166, 209, 114, 168, 202, 156, 130, 193, 145, 146, 66,
+    27, 146, 59, 165, 40, 150, 97, 168, 32, 147, 69, 116, 42, 151, 99, 89, 94, 209, 135, 211, 192, 204, 203, 202, 147, 169, 119, 115, 153, 149, 97, 87,
+    34, 193, 71, 207, 142, 200, 153, 193, 42, 153, 79, 71, 143, 142, 42, 34, 98, 210, 137, 165, 199, 198, 192, 145, 151, 149, 77, 67, 142, 140, 40, 31,
+    65, 156, 108, 178, 77, 157, 119, 156, 69, 119, 109, 108, 79, 77, 69, 65, 111, 174, 173, 172, 137, 132, 135, 130, 116, 115, 108, 106, 71, 67, 59, 52,
+    89, 168, 116, 165, 151, 150, 147, 146, 99, 97, 69, 59, 42, 40, 32, 27, 118, 115, 111, 106, 98, 88, 94, 66, 89, 87, 65, 52, 34, 31, 27, 10,
+    14, 67, 59, 108, 35, 90, 97, 119, 34, 98, 89, 118, 82, 102, 101, 78, 70, 115, 135, 173, 152, 168, 203, 135, 193, 210, 168, 115, 208, 193, 152, 70,
+    41, 149, 98, 167, 190, 215, 199, 149, 142, 199, 151, 98, 195, 190, 142, 41, 100, 169, 162, 117, 216, 198, 197, 96, 200, 198, 150, 88, 194, 189, 141, 33,
+    67, 132, 165, 178, 90, 159, 168, 156, 98, 162, 167, 117, 102, 163, 147, 76, 115, 174, 211, 172, 168, 156, 202, 130, 210, 209, 166, 114, 193, 146, 145, 66,
+    149, 204, 210, 166, 215, 214, 198, 148, 199, 197, 149, 96, 190, 188, 140, 39, 169, 209, 209, 114, 198, 148, 196, 86, 198, 196, 148, 86, 189, 139, 139, 30,
+    59, 165, 126, 177, 97, 168, 161, 155, 89, 167, 113, 108, 101, 147, 95, 68, 135, 211, 185, 171, 203, 202, 201, 133, 168, 166, 112, 107, 152, 145, 93, 58,
+    98, 210, 137, 165, 199, 198, 192, 145, 151, 149, 77, 67, 142, 140, 40, 31, 162, 209, 186, 110, 197, 196, 191, 92, 150, 148, 75, 63, 141, 139, 38, 26,
+    108, 178, 177, 176, 119, 156, 155, 154, 118, 117, 108, 105, 78, 76, 68, 64, 173, 172, 171, 170, 135, 130, 133, 123, 115, 114, 107, 104, 70, 66, 58, 48,
+    167, 166, 165, 164, 149, 148, 145, 144, 98, 96, 67, 57, 41, 39, 31, 25, 117, 114, 110, 104, 96, 86, 92, 56, 88, 86, 63, 51, 33, 30, 26, 9,
+    5, 64, 64, 105, 12, 65, 68, 108, 12, 68, 65, 108, 15, 69, 69, 109, 64, 105, 154, 176, 68, 108, 155, 177, 76, 117, 156, 178, 78, 118, 119, 108,
+    64, 154, 105, 176, 76, 156, 117, 178, 68, 155, 108, 177, 78, 119, 118, 108, 105, 176, 176, 180, 117, 178, 179, 176, 117, 179, 178, 176, 120, 117, 117, 105,
+    12, 68, 76, 117, 15, 69, 78, 118, 18, 72, 77, 119, 20, 73, 79, 69, 65, 108, 156, 178, 69, 109, 119, 108, 77, 119, 157, 156, 79, 69, 77, 65,
+    68, 155, 117, 179, 78, 119, 120, 117, 72, 158, 119, 155, 80, 72, 78, 68, 108, 177, 178, 176, 118, 108, 117, 105, 119, 155, 156, 154, 78, 68, 76, 64,
+    12, 76, 68, 117, 18, 77, 72, 119, 15, 78, 69, 118, 20, 79, 73, 69, 68, 117, 155, 179, 72, 119, 158, 155, 78, 120, 119, 117, 80, 78, 72, 68,
+    65, 156, 108, 178, 77, 157, 119, 156, 69, 119, 109, 108, 79, 77, 69, 65, 108, 178, 177, 176, 119, 156, 155, 154, 118, 117, 108, 105, 78, 76, 68, 64,
+    15, 78, 78, 120, 20, 79, 80, 78, 20, 80, 79, 78, 21, 20, 20, 15, 69, 118, 119, 117, 73, 69, 72, 68, 79, 78, 77, 76, 20, 15, 18, 12,
+    69, 119, 118, 117, 79, 77, 78, 76, 73, 72, 69, 68, 20, 18, 15, 12, 109, 108, 108, 105, 69, 65, 68, 64, 69, 68, 65, 64, 15, 12, 12, 5,
+    12, 65, 68, 108, 29, 85, 95, 113, 32, 89, 89, 116, 36, 91, 99, 69, 68, 108, 155, 177, 95, 113, 161, 126, 147, 167, 168, 165, 101, 89, 97, 59,
+    76, 156, 117, 178, 163, 159, 162, 132, 147, 168, 167, 165, 102, 90, 98, 67, 117, 178, 179, 176, 162, 132, 160, 125, 169, 166, 166, 164, 100, 88, 96, 57,
+    32, 89, 147, 167, 36, 91, 101, 89, 42, 101, 151, 147, 44, 36, 42, 32, 89, 116, 168, 165, 99, 69, 97, 59, 151, 147, 150, 146, 42, 32, 40, 27,
+    147, 168, 169, 166, 102, 90, 100, 88, 153, 152, 149, 145, 43, 35, 41, 31, 167, 165, 166, 164, 98, 67, 96, 57, 149, 145, 148, 144, 41, 31, 39, 25,
+    53, 111, 131, 173, 61, 113, 136, 131, 69, 118, 113, 111, 73, 69, 61, 53, 131, 173, 175, 171, 136, 131, 134, 124, 119, 117, 112, 110, 72, 68, 60, 50,
+    111, 174, 173, 172, 137, 132, 135, 130, 116, 115, 108, 106, 71, 67, 59, 52, 173, 172, 171, 170, 135, 130, 133, 123, 115, 114, 107, 104, 70, 66, 58, 48,
+    69, 118, 119, 117, 73, 69, 72, 68, 79, 78, 77, 76, 20, 15, 18, 12, 113, 111, 112, 110, 61, 53, 60, 50, 77, 76, 75, 74, 18, 12, 17, 7,
+    116, 115, 115, 114, 71, 67, 70, 66, 71, 70, 67, 66, 19, 14, 14, 10, 108, 106, 107, 104, 59, 52, 58, 48, 67, 66, 63, 62, 14, 10, 11, 4,
+    12, 68, 65, 108, 32, 89, 89, 116, 29, 95, 85, 113, 36, 99, 91, 69, 76, 117, 156, 178, 147, 167, 168, 165, 163, 162, 159, 132, 102, 98, 90, 67,
+    68, 155, 108, 177, 147, 168, 167, 165, 95, 161, 113, 126, 101, 97, 89, 59, 117, 179, 178, 176, 169, 166, 166, 164, 162, 160, 132, 125, 100, 96, 88, 57,
+    53, 131, 111, 173, 69, 113, 118, 111, 61, 136, 113, 131, 73, 61, 69, 53, 111, 173, 174, 172, 116, 108, 115, 106, 137, 135, 132, 130, 71, 59, 67, 52,
+    131, 175, 173, 171, 119, 112, 117, 110, 136, 134, 131, 124, 72, 60, 68, 50, 173, 171, 172, 170, 115, 107, 114, 104, 135, 133, 130, 123, 70, 58, 66, 48,
+    32, 147, 89, 167, 42, 151, 101, 147, 36, 101, 91, 89, 44, 42, 36, 32, 147, 169, 168, 166, 153, 149, 152, 145, 102, 100, 90, 88, 43, 41, 35, 31,
+    89, 168, 116, 165, 151, 150, 147, 146, 99, 97, 69, 59, 42, 40, 32, 27, 167, 166, 165, 164, 149, 148, 145, 144, 98, 96, 67, 57, 41, 39, 31, 25,
+    69, 119, 118, 117, 79, 77, 78, 76, 73, 72, 69, 68, 20, 18, 15, 12, 116, 115, 115, 114, 71, 67, 70, 66, 71, 70, 67, 66, 19, 14, 14, 10,
+    113, 112, 111, 110, 77, 75, 76, 74, 61, 60, 53, 50, 18, 17, 12, 7, 108, 107, 106, 104, 67, 63, 66, 62, 59, 58, 52, 48, 14, 11, 10, 4,
+    15, 69, 69, 109, 36, 91, 99, 69, 36, 99, 91, 69, 83, 36, 36, 15, 78, 118, 119, 108, 101, 89, 97, 59, 102, 98, 90, 67, 82, 34, 35, 14,
+    78, 119, 118, 108, 102, 90, 98, 67, 101, 97, 89, 59, 82, 35, 34, 14, 120, 117, 117, 105, 100, 88, 96, 57, 100, 96, 88, 57, 81, 33, 33, 13,
+    69, 113, 116, 108, 91, 85, 89, 65, 99, 95, 89, 68, 36, 29, 32, 12, 118, 111, 115, 106, 89, 65, 87, 52, 98, 94, 88, 66, 34, 27, 31, 10,
+    119, 112, 115, 107, 90, 84, 88, 63, 97, 93, 87, 58, 35, 28, 31, 11, 117, 110, 114, 104, 88, 63, 86, 51, 96, 92, 86, 56, 33, 26, 30, 9,
+    69, 116, 113, 108, 99, 89, 95, 68, 91, 89, 85, 65, 36, 32, 29, 12, 119, 115, 112, 107, 97, 87, 93, 58, 90, 88, 84, 63, 35, 31, 28, 11,
+    118, 115, 111, 106, 98, 88, 94, 66, 89, 87, 65, 52, 34, 31, 27, 10, 117, 114, 110, 104, 96, 86, 92, 56, 88, 86, 63, 51, 33, 30, 26, 9,
+    109, 108, 108, 105, 69, 65, 68, 64, 69, 68, 65, 64, 15, 12, 12, 5, 108, 106, 107, 104, 59, 52, 58, 48, 67, 66, 63, 62, 14, 10, 11, 4,
+    108, 107, 106, 104, 67, 63, 66, 62, 59, 58, 52, 48, 14, 11, 10, 4, 105, 104, 104, 103, 57, 51, 56, 46, 57, 56, 51, 46, 13, 9, 9, 2,
+    4, 48, 62, 104, 25, 57, 144, 164, 48, 123, 104, 170, 57, 125, 164, 176, 10, 52, 66, 106, 31, 67, 145, 165, 66, 130, 114, 172, 88, 132, 166, 178,
+    11, 58, 63, 107, 39, 96, 148, 166, 58, 133, 107, 171, 96, 160, 166, 179, 14, 59, 67, 108, 41, 98, 149, 167, 70, 135, 115, 173, 100, 162, 169, 117,
+    7, 50, 74, 110, 27, 59, 146, 165, 50, 124, 110, 171, 59, 126, 165, 177, 12, 53, 76, 111, 32, 69, 147, 116, 68, 131, 117, 173, 89, 113, 167, 108,
+    17, 60, 75, 112, 40, 97, 150, 168, 60, 134, 112, 175, 97, 161, 168, 155, 18, 61, 77, 113, 42, 99, 151, 89, 72, 136, 119, 131, 101, 95, 147, 68,
+    10, 66, 66, 114, 31, 88, 145, 166, 52, 130, 106, 172, 67, 132, 165, 178, 14, 67, 70, 115, 35, 90, 152, 168, 67, 132, 115, 174, 90, 159, 168, 156,
+    14, 70, 67, 115, 41, 100, 149, 169, 59, 135, 108, 173, 98, 162, 167, 117, 19, 71, 71, 116, 43, 102, 153, 147, 71, 137, 116, 111, 102, 163, 147, 76,
+    12, 68, 76, 117, 32, 89, 147, 167, 53, 131, 111, 173, 69, 113, 116, 108, 15, 69, 78, 118, 36, 91, 101, 89, 69, 113, 118, 111, 91, 85, 89, 65,
+    18, 72, 77, 119, 42, 101, 151, 147, 61, 136, 113, 131, 99, 95, 89, 68, 20, 73, 79, 69, 44, 36, 42, 32, 73, 61, 69, 53, 36, 29, 32, 12,
+    10, 52, 66, 106, 31, 67, 145, 165, 66, 130, 114, 172, 88, 132, 166, 178, 27, 65, 94, 111, 40, 77, 192, 137, 146, 156, 209, 174, 150, 157, 204, 132,
+    31, 87, 88, 115, 140, 149, 198, 210, 145, 202, 166, 211, 198, 204, 218, 166, 34, 89, 98, 118, 142, 151, 199, 98, 193, 168, 210, 115, 200, 150, 198, 88,
+    27, 59, 146, 165, 34, 71, 193, 207, 94, 135, 209, 211, 98, 137, 210, 165, 32, 69, 147, 116, 42, 79, 153, 71, 147, 119, 169, 115, 151, 77, 149, 67,
+    40, 97, 150, 168, 142, 153, 200, 193, 192, 203, 204, 202, 199, 192, 198, 145, 42, 99, 151, 89, 143, 42, 142, 34, 153, 97, 149, 87, 142, 40, 140, 31,
+    52, 106, 130, 172, 87, 115, 202, 211, 106, 172, 172, 217, 115, 174, 211, 172, 59, 108, 135, 173, 97, 119, 203, 135, 165, 178, 211, 172, 168, 156, 202, 130,
+    67, 115, 132, 174, 149, 169, 204, 209, 165, 211, 178, 172, 210, 209, 166, 114, 71, 116, 137, 111, 153, 147, 192, 94, 207, 165, 165, 106, 193, 146, 145, 66,
+    65, 108, 156, 178, 89, 116, 168, 165, 111, 173, 174, 172, 118, 111, 115, 106, 69, 109, 119, 108, 99, 69, 97, 59, 116, 108, 115, 106, 89, 65, 87, 52,
+    77, 119, 157, 156, 151, 147, 150, 146, 137, 135, 132, 130, 98, 94, 88, 66, 79, 69, 77, 65, 42, 32, 40, 27, 71, 59, 67, 52, 34, 27, 31, 10,
+    11, 58, 63, 107, 39, 96, 148, 166, 58, 133, 107, 171, 96, 160, 166, 179, 31, 87, 88, 115, 140, 149, 198, 210, 145, 202, 166, 211, 198, 204, 218, 166,
+    28, 93, 84, 112, 188, 197, 214, 204, 93, 201, 112, 185, 197, 219, 204, 160, 35, 97, 90, 119, 190, 199, 215, 149, 152, 203, 168, 135, 216, 197, 198, 96,
+    50, 124, 110, 171, 94, 135, 209, 211, 124, 183, 171, 212, 135, 185, 211, 171, 68, 131, 117, 173, 147, 119, 169, 115, 155, 175, 179, 171, 168, 112, 166, 107,
+    60, 134, 112, 175, 192, 203, 204, 202, 134, 205, 175, 183, 203, 201, 202, 133, 72, 136, 119, 131, 153, 97, 149, 87, 158, 134, 155, 124, 152, 93, 145, 58,
+    31, 145, 88, 166, 140, 198, 198, 218, 87, 202, 115, 211, 149, 204, 210, 166, 41, 149, 100, 169, 190, 215, 216, 198, 149, 204, 169, 209, 215, 214, 198, 148,
+    35, 152, 90, 168, 190, 216, 215, 198, 97, 203, 119, 135, 199, 197, 149, 96, 43, 153, 102, 147, 213, 190, 190, 140, 153, 192, 147, 94, 190, 188, 140, 39,
+    68, 155, 117, 179, 147, 168, 169, 166, 131, 175, 173, 171, 119, 112, 115, 107, 78, 119, 120, 117, 102, 90, 100, 88, 119, 112, 117, 110, 90, 84, 88, 63,
+    72, 158, 119, 155, 153, 152, 149, 145, 136, 134, 131, 124, 97, 93, 87, 58, 80, 72, 78, 68, 43, 35, 41, 31, 72, 60, 68, 50, 35, 28, 31, 11,
+    14, 59, 67, 108, 41, 98, 149, 167, 70, 135, 115, 173, 100, 162, 169, 117, 34, 89, 98, 118, 142, 151, 199, 98, 193, 168, 210, 115, 200, 150, 198, 88,
+    35, 97, 90, 119, 190, 199, 215, 149, 152, 203, 168, 135, 216, 197, 198, 96, 82, 101, 102, 78, 195, 142, 190, 41, 208, 152, 193, 70, 194, 141, 189, 33,
+    59, 126, 165, 177, 98, 137, 210, 165, 135, 185, 211, 171, 162, 186, 209, 110, 89, 113, 167, 108, 151, 77, 149, 67, 168, 112, 166, 107, 150, 75, 148, 63,
+    97, 161, 168, 155, 199, 192, 198, 145, 203, 201, 202, 133, 197, 191, 196, 92, 101, 95, 147, 68, 142, 40, 140, 31, 152, 93, 145, 58, 141, 38, 139, 26,
+    67, 165, 132, 178, 149, 210, 204, 166, 115, 211, 174, 172, 169, 209, 209, 114, 98, 167, 162, 117, 199, 149, 197, 96, 210, 166, 209, 114, 198, 148, 196, 86,
+    90, 168, 159, 156, 215, 198, 214, 148, 168, 202, 156, 130, 198, 196, 148, 86, 102, 147, 163, 76, 190, 140, 188, 39, 193, 145, 146, 66, 189, 139, 139, 30,
+    108, 177, 178, 176, 167, 165, 166, 164, 173, 171, 172, 170, 117, 110, 114, 104, 118, 108, 117, 105, 98, 67, 96, 57, 115, 107, 114, 104, 88, 63, 86, 51,
+    119, 155, 156, 154, 149, 145, 148, 144, 135, 133, 130, 123, 96, 92, 86, 56, 78, 68, 76, 64, 41, 31, 39, 25, 70, 58, 66, 48, 33, 26, 30, 9,
+    7, 50, 74, 110, 27, 59, 146, 165, 50, 124, 110, 171, 59, 126, 165, 177, 27, 59, 146, 165, 34, 71, 193, 207, 94, 135, 209, 211, 98, 137, 210, 165,
+    50, 124, 110, 171, 94, 135, 209, 211, 124, 183, 171, 212, 135, 185, 211, 171, 59, 126, 165, 177, 98, 137, 210, 165, 135, 185, 211, 171, 162, 186, 209, 110,
+    23, 55, 206, 186, 29, 61, 163, 137, 55, 128, 186, 185, 61, 129, 137, 126, 29, 61, 163, 137, 36, 73, 102, 71, 95, 136, 162, 135, 99, 61, 98, 59,
+    55, 128, 186, 185, 95, 136, 162, 135, 128, 184, 185, 183, 136, 128, 135, 124, 61, 129, 137, 126, 99, 61, 98, 59, 136, 128, 135, 124, 95, 55, 94, 50,
+    27, 94, 146, 209, 34, 98, 193, 210, 59, 135, 165, 211, 71, 137, 207, 165, 34, 98, 193, 210, 82, 102, 208, 193, 98, 162, 210, 209, 102, 163, 193, 146,
+    59, 135, 165, 211, 98, 162, 210, 209, 126, 185, 177, 171, 137, 186, 165, 110, 71, 137, 207, 165, 102, 163, 193, 146, 137, 186, 165, 110, 163, 206, 146, 74,
+    29, 95, 163, 162, 36, 99, 102, 98, 61, 136, 137, 135, 73, 61, 71, 59, 36, 99, 102, 98, 83, 36, 82, 34, 99, 95, 98, 94, 36, 29, 34, 27,
+    61, 136, 137, 135, 99, 95, 98, 94, 129, 128, 126, 124, 61, 55, 59, 50, 73, 61, 71, 59, 36, 29, 34, 27, 61, 55, 59, 50, 29, 23, 27, 7,
+    12, 53, 76, 111, 32, 69, 147, 116, 68, 131, 117, 173, 89, 113, 167, 108, 32, 69, 147, 116, 42, 79, 153, 71, 147, 119, 169, 115, 151, 77, 149, 67,
+    68, 131, 117, 173, 147, 119, 169, 115, 155, 175, 179, 171, 168, 112, 166, 107, 89, 113, 167, 108, 151, 77, 149, 67, 168, 112, 166, 107, 150, 75, 148, 63,
+    29, 61, 163, 137, 36, 73, 102, 71, 95, 136, 162, 135, 99, 61, 98, 59, 36, 73, 102, 71, 44, 20, 43, 19, 101, 72, 100, 70, 42, 18, 41, 14,
+    95, 136, 162, 135, 101, 72, 100, 70, 161, 134, 160, 133, 97, 60, 96, 58, 99, 61, 98, 59, 42, 18, 41, 14, 97, 60, 96, 58, 40, 17, 39, 11,
+    65, 111, 156, 174, 89, 118, 168, 115, 108, 173, 178, 172, 116, 111, 165, 106, 89, 118, 168, 115, 101, 78, 152, 70, 167, 117, 166, 114, 147, 76, 145, 66,
+    108, 173, 178, 172, 167, 117, 166, 114, 177, 171, 176, 170, 165, 110, 164, 104, 116, 111, 165, 106, 147, 76, 145, 66, 165, 110, 164, 104, 146, 74, 144, 62,
+    85, 113, 159, 132, 91, 69, 90, 67, 113, 131, 132, 130, 69, 53, 67, 52, 91, 69, 90, 67, 36, 15, 35, 14, 89, 68, 88, 66, 32, 12, 31, 10,
+    113, 131, 132, 130, 89, 68, 88, 66, 126, 124, 125, 123, 59, 50, 57, 48, 69, 53, 67, 52, 32, 12, 31, 10, 59, 50, 57, 48, 27, 7, 25, 4,
+    17, 60, 75, 112, 40, 97, 150, 168, 60, 134, 112, 175, 97, 161, 168, 155, 40, 97, 150, 168, 142, 153, 200, 193, 192, 203, 204, 202, 199, 192, 198, 145,
+    60, 134, 112, 175, 192, 203, 204, 202, 134, 205, 175, 183, 203, 201, 202, 133, 97, 161, 168, 155, 199, 192, 198, 145, 203, 201, 202, 133, 197, 191, 196, 92,
+    55, 128, 186, 185, 95, 136, 162, 135, 128, 184, 185, 183, 136, 128, 135, 124, 95, 136, 162, 135, 101, 72, 100, 70, 161, 134, 160, 133, 97, 60, 96, 58,
+    128, 184, 185, 183, 161, 134, 160, 133, 184, 182, 183, 181, 134, 127, 133, 122, 136, 128, 135, 124, 97, 60, 96, 58, 134, 127, 133, 122, 93, 54, 92, 49,
+    40, 192, 150, 204, 142, 199, 200, 198, 97, 203, 168, 202, 153, 192, 193, 145, 142, 199, 200, 198, 195, 190, 194, 189, 199, 197, 198, 196, 190, 188, 189, 139,
+    97, 203, 168, 202, 199, 197, 198, 196, 161, 201, 155, 133, 192, 191, 145, 92, 153, 192, 193, 145, 190, 188, 189, 139, 192, 191, 145, 92, 188, 187, 139, 37,
+    95, 161, 162, 160, 101, 97, 100, 96, 136, 134, 135, 133, 72, 60, 70, 58, 101, 97, 100, 96, 82, 35, 81, 33, 97, 93, 96, 92, 35, 28, 33, 26,
+    136, 134, 135, 133, 97, 93, 96, 92, 128, 127, 124, 122, 60, 54, 58, 49, 72, 60, 70, 58, 35, 28, 33, 26, 60, 54, 58, 49, 28, 22, 26, 6,
+    18, 61, 77, 113, 42, 99, 151, 89, 72, 136, 119, 131, 101, 95, 147, 68, 42, 99, 151, 89, 143, 42, 142, 34, 153, 97, 149, 87, 142, 40, 140, 31,
+    72, 136, 119, 131, 153, 97, 149, 87, 158, 134, 155, 124, 152, 93, 145, 58, 101, 95, 147, 68, 142, 40, 140, 31, 152, 93, 145, 58, 141, 38, 139, 26,
+    61, 129, 137, 126, 99, 61, 98, 59, 136, 128, 135, 124, 95, 55, 94, 50, 99, 61, 98, 59, 42, 18, 41, 14, 97, 60, 96, 58, 40, 17, 39, 11,
+    136, 128, 135, 124, 97, 60, 96, 58, 134, 127, 133, 122, 93, 54, 92, 49, 95, 55, 94, 50, 40, 17, 39, 11, 93, 54, 92, 49, 38, 16, 37, 6,
+    77, 137, 157, 132, 151, 98, 150, 88, 119, 135, 156, 130, 147, 94, 146, 66, 151, 98, 150, 88, 142, 41, 141, 33, 149, 96, 148, 86, 140, 39, 139, 30,
+    119, 135, 156, 130, 149, 96, 148, 86, 155, 133, 154, 123, 145, 92, 144, 56, 147, 94, 146, 66, 140, 39, 139, 30, 145, 92, 144, 56, 139, 37, 138, 24,
+    113, 126, 132, 125, 89, 59, 88, 57, 131, 124, 130, 123, 68, 50, 66, 48, 89, 59, 88, 57, 34, 14, 33, 13, 87, 58, 86, 56, 31, 11, 30, 9,
+    131, 124, 130, 123, 87, 58, 86, 56, 124, 122, 123, 121, 58, 49, 56, 47, 68, 50, 66, 48, 31, 11, 30, 9, 58, 49, 56, 47, 26, 6, 24, 3,
+    10, 66, 66, 114, 31, 88, 145, 166, 52, 130, 106, 172, 67, 132, 165, 178, 52, 106, 130, 172, 87, 115, 202, 211, 106, 172, 172, 217, 115, 174, 211, 172,
+    31, 145, 88, 166, 140, 198, 198, 218, 87, 202, 115, 211, 149, 204, 210, 166, 67, 165, 132, 178, 149, 210, 204, 166, 115, 211, 174, 172, 169, 209, 209, 114,
+    27, 94, 146, 209, 34, 98, 193, 210, 59, 135, 165, 211, 71, 137, 207, 165, 65, 111, 156, 174, 89, 118, 168, 115, 108, 173, 178, 172, 116, 111, 165, 106,
+    40, 192, 150, 204, 142, 199, 200, 198, 97, 203, 168, 202, 153, 192, 193, 145, 77, 137, 157, 132, 151, 98, 150, 88, 119, 135, 156, 130, 147, 94, 146, 66,
+    27, 146, 94, 209, 40, 150, 192, 204, 65, 156, 111, 174, 77, 157, 137, 132, 59, 165, 135, 211, 97, 168, 203, 202, 108, 178, 173, 172, 119, 156, 135, 130,
+    34, 193, 98, 210, 142, 200, 199, 198, 89, 168, 118, 115, 151, 150, 98, 88, 71, 207, 137, 165, 153, 193, 192, 145, 116, 165, 111, 106, 147, 146, 94, 66,
+    32, 147, 147, 169, 42, 151, 153, 149, 69, 119, 116, 115, 79, 77, 71, 67, 69, 116, 119, 115, 99, 89, 97, 87, 109, 108, 108, 106, 69, 65, 59, 52,
+    42, 153, 151, 149, 143, 142, 142, 140, 99, 97, 89, 87, 42, 40, 34, 31, 79, 71, 77, 67, 42, 34, 40, 31, 69, 59, 65, 52, 32, 27, 27, 10,
+    14, 67, 70, 115, 35, 90, 152, 168, 67, 132, 115, 174, 90, 159, 168, 156, 59, 108, 135, 173, 97, 119, 203, 135, 165, 178, 211, 172, 168, 156, 202, 130,
+    41, 149, 100, 169, 190, 215, 216, 198, 149, 204, 169, 209, 215, 214, 198, 148, 98, 167, 162, 117, 199, 149, 197, 96, 210, 166, 209, 114, 198, 148, 196, 86,
+    34, 98, 193, 210, 82, 102, 208, 193, 98, 162, 210, 209, 102, 163, 193, 146, 89, 118, 168, 115, 101, 78, 152, 70, 167, 117, 166, 114, 147, 76, 145, 66,
+    142, 199, 200, 198, 195, 190, 194, 189, 199, 197, 198, 196, 190, 188, 189, 139, 151, 98, 150, 88, 142, 41, 141, 33, 149, 96, 148, 86, 140, 39, 139, 30,
+    59, 165, 135, 211, 97, 168, 203, 202, 108, 178, 173, 172, 119, 156, 135, 130, 126, 177, 185, 171, 161, 155, 201, 133, 177, 176, 171, 170, 155, 154, 133, 123,
+    98, 210, 162, 209, 199, 198, 197, 196, 167, 166, 117, 114, 149, 148, 96, 86, 137, 165, 186, 110, 192, 145, 191, 92, 165, 164, 110, 104, 145, 144, 92, 56,
+    89, 167, 168, 166, 101, 147, 152, 145, 118, 117, 115, 114, 78, 76, 70, 66, 113, 108, 112, 107, 95, 68, 93, 58, 108, 105, 107, 104, 68, 64, 58, 48,
+    151, 149, 150, 148, 142, 140, 141, 139, 98, 96, 88, 86, 41, 39, 33, 30, 77, 67, 75, 63, 40, 31, 38, 26, 67, 57, 63, 51, 31, 25, 26, 9,
+    14, 70, 67, 115, 41, 100, 149, 169, 59, 135, 108, 173, 98, 162, 167, 117, 67, 115, 132, 174, 149, 169, 204, 209, 165, 211, 178, 172, 210, 209, 166, 114,
+    35, 152, 90, 168, 190, 216, 215, 198, 97, 203, 119, 135, 199, 197, 149, 96, 90, 168, 159, 156, 215, 198, 214, 148, 168, 202, 156, 130, 198, 196, 148, 86,
+    59, 135, 165, 211, 98, 162, 210, 209, 126, 185, 177, 171, 137, 186, 165, 110, 108, 173, 178, 172, 167, 117, 166, 114, 177, 171, 176, 170, 165, 110, 164, 104,
+    97, 203, 168, 202, 199, 197, 198, 196, 161, 201, 155, 133, 192, 191, 145, 92, 119, 135, 156, 130, 149, 96, 148, 86, 155, 133, 154, 123, 145, 92, 144, 56,
+    34, 193, 98, 210, 142, 200, 199, 198, 89, 168, 118, 115, 151, 150, 98, 88, 98, 210, 162, 209, 199, 198, 197, 196, 167, 166, 117, 114, 149, 148, 96, 86,
+    82, 208, 102, 193, 195, 194, 190, 189, 101, 152, 78, 70, 142, 141, 41, 33, 102, 193, 163, 146, 190, 189, 188, 139, 147, 145, 76, 66, 140, 139, 39, 30,
+    89, 168, 167, 166, 151, 150, 149, 148, 113, 112, 108, 107, 77, 75, 67, 63, 118, 115, 117, 114, 98, 88, 96, 86, 108, 107, 105, 104, 67, 63, 57, 51,
+    101, 152, 147, 145, 142, 141, 140, 139, 95, 93, 68, 58, 40, 38, 31, 26, 78, 70, 76, 66, 41, 33, 39, 30, 68, 58, 64, 48, 31, 26, 25, 9,
+    19, 71, 71, 116, 43, 102, 153, 147, 71, 137, 116, 111, 102, 163, 147, 76, 71, 116, 137, 111, 153, 147, 192, 94, 207, 165, 165, 106, 193, 146, 145, 66,
+    43, 153, 102, 147, 213, 190, 190, 140, 153, 192, 147, 94, 190, 188, 140, 39, 102, 147, 163, 76, 190, 140, 188, 39, 193, 145, 146, 66, 189, 139, 139, 30,
+    71, 137, 207, 165, 102, 163, 193, 146, 137, 186, 165, 110, 163, 206, 146, 74, 116, 111, 165, 106, 147, 76, 145, 66, 165, 110, 164, 104, 146, 74, 144, 62,
+    153, 192, 193, 145, 190, 188, 189, 139, 192, 191, 145, 92, 188, 187, 139, 37, 147, 94, 146, 66, 140, 39, 139, 30, 145, 92, 144, 56, 139, 37, 138, 24,
+    71, 207, 137, 165, 153, 193, 192, 145, 116, 165, 111, 106, 147, 146, 94, 66, 137, 165, 186, 110, 192, 145, 191, 92, 165, 164, 110, 104, 145, 144, 92, 56,
+    102, 193, 163, 146, 190, 189, 188, 139, 147, 145, 76, 66, 140, 139, 39, 30, 163, 146, 206, 74, 188, 139, 187, 37, 146, 144, 74, 62, 139, 138, 37, 24,
+    116, 165, 165, 164, 147, 146, 145, 144, 111, 110, 106, 104, 76, 74, 66, 62, 111, 106, 110, 104, 94, 66, 92, 56, 106, 104, 104, 103, 66, 62, 56, 46,
+    147, 145, 146, 144, 140, 139, 139, 138, 94, 92, 66, 56, 39, 37, 30, 24, 76, 66, 74, 62, 39, 30, 37, 24, 66, 56, 62, 46, 30, 24, 24, 8,
+    12, 68, 76, 117, 32, 89, 147, 167, 53, 131, 111, 173, 69, 113, 116, 108, 65, 108, 156, 178, 89, 116, 168, 165, 111, 173, 174, 172, 118, 111, 115, 106,
+    68, 155, 117, 179, 147, 168, 169, 166, 131, 175, 173, 171, 119, 112, 115, 107, 108, 177, 178, 176, 167, 165, 166, 164, 173, 171, 172, 170, 117, 110, 114, 104,
+    29, 95, 163, 162, 36, 99, 102, 98, 61, 136, 137, 135, 73, 61, 71, 59, 85, 113, 159, 132, 91, 69, 90, 67, 113, 131, 132, 130, 69, 53, 67, 52,
+    95, 161, 162, 160, 101, 97, 100, 96, 136, 134, 135, 133, 72, 60, 70, 58, 113, 126, 132, 125, 89, 59, 88, 57, 131, 124, 130, 123, 68, 50, 66, 48,
+    32, 147, 147, 169, 42, 151, 153, 149, 69, 119, 116, 115, 79, 77, 71, 67, 89, 167, 168, 166, 101, 147, 152, 145, 118, 117, 115, 114, 78, 76, 70, 66,
+    89, 168, 167, 166, 151, 150, 149, 148, 113, 112, 108, 107, 77, 75, 67, 63, 116, 165, 165, 164, 147, 146, 145, 144, 111, 110, 106, 104, 76, 74, 66, 62,
+    36, 101, 102, 100, 44, 42, 43, 41, 73, 72, 71, 70, 20, 18, 19, 14, 91, 89, 90, 88, 36, 32, 35, 31, 69, 68, 67, 66, 15, 12, 14, 10,
+    99, 97, 98, 96, 42, 40, 41, 39, 61, 60, 59, 58, 18, 17, 14, 11, 69, 59, 67, 57, 32, 27, 31, 25, 53, 50, 52, 48, 12, 7, 10, 4,
+    15, 69, 78, 118, 36, 91, 101, 89, 69, 113, 118, 111, 91, 85, 89, 65, 69, 109, 119, 108, 99, 69, 97, 59, 116, 108, 115, 106, 89, 65, 87, 52,
+    78, 119, 120, 117, 102, 90, 100, 88, 119, 112, 117, 110, 90, 84, 88, 63, 118, 108, 117, 105, 98, 67, 96, 57, 115, 107, 114, 104, 88, 63, 86, 51,
+    36, 99, 102, 98, 83, 36, 82, 34, 99, 95, 98, 94, 36, 29, 34, 27, 91, 69, 90, 67, 36, 15, 35, 14, 89, 68, 88, 66, 32, 12, 31, 10,
+    101, 97, 100, 96, 82, 35, 81, 33, 97, 93, 96, 92, 35, 28, 33, 26, 89, 59, 88, 57, 34, 14, 33, 13, 87, 58, 86, 56, 31, 11, 30, 9,
+    69, 116, 119, 115, 99, 89, 97, 87, 109, 108, 108, 106, 69, 65, 59, 52, 113, 108, 112, 107, 95, 68, 93, 58, 108, 105, 107, 104, 68, 64, 58, 48,
+    118, 115, 117, 114, 98, 88, 96, 86, 108, 107, 105, 104, 67, 63, 57, 51, 111, 106, 110, 104, 94, 66, 92, 56, 106, 104, 104, 103, 66, 62, 56, 46,
+    91, 89, 90, 88, 36, 32, 35, 31, 69, 68, 67, 66, 15, 12, 14, 10, 85, 65, 84, 63, 29, 12, 28, 11, 65, 64, 63, 62, 12, 5, 11, 4,
+    89, 87, 88, 86, 34, 31, 33, 30, 59, 58, 57, 56, 14, 11, 13, 9, 65, 52, 63, 51, 27, 10, 26, 9, 52, 48, 51, 46, 10, 4, 9, 2,
+    18, 72, 77, 119, 42, 101, 151, 147, 61, 136, 113, 131, 99, 95, 89, 68, 77, 119, 157, 156, 151, 147, 150, 146, 137, 135, 132, 130, 98, 94, 88, 66,
+    72, 158, 119, 155, 153, 152, 149, 145, 136, 134, 131, 124, 97, 93, 87, 58, 119, 155, 156, 154, 149, 145, 148, 144, 135, 133, 130, 123, 96, 92, 86, 56,
+    61, 136, 137, 135, 99, 95, 98, 94, 129, 128, 126, 124, 61, 55, 59, 50, 113, 131, 132, 130, 89, 68, 88, 66, 126, 124, 125, 123, 59, 50, 57, 48,
+    136, 134, 135, 133, 97, 93, 96, 92, 128, 127, 124, 122, 60, 54, 58, 49, 131, 124, 130, 123, 87, 58, 86, 56, 124, 122, 123, 121, 58, 49, 56, 47,
+    42, 153, 151, 149, 143, 142, 142, 140, 99, 97, 89, 87, 42, 40, 34, 31, 151, 149, 150, 148, 142, 140, 141, 139, 98, 96, 88, 86, 41, 39, 33, 30,
+    101, 152, 147, 145, 142, 141, 140, 139, 95, 93, 68, 58, 40, 38, 31, 26, 147, 145, 146, 144, 140, 139, 139, 138, 94, 92, 66, 56, 39, 37, 30, 24,
+    99, 97, 98, 96, 42, 40, 41, 39, 61, 60, 59, 58, 18, 17, 14, 11, 89, 87, 88, 86, 34, 31, 33, 30, 59, 58, 57, 56, 14, 11, 13, 9,
+    95, 93, 94, 92, 40, 38, 39, 37, 55, 54, 50, 49, 17, 16, 11, 6, 68, 58, 66, 56, 31, 26, 30, 24, 50, 49, 48, 47, 11, 6, 9, 3,
+    20, 73, 79, 69, 44, 36, 42, 32, 73, 61, 69, 53, 36, 29, 32, 12, 79, 69, 77, 65, 42, 32, 40, 27, 71, 59, 67, 52, 34, 27, 31, 10,
+    80, 72, 78, 68, 43, 35, 41, 31, 72, 60, 68, 50, 35, 28, 31, 11, 78, 68, 76, 64, 41, 31, 39, 25, 70, 58, 66, 48, 33, 26, 30, 9,
+    73, 61, 71, 59, 36, 29, 34, 27, 61, 55, 59, 50, 29, 23, 27, 7, 69, 53, 67, 52, 32, 12, 31, 10, 59, 50, 57, 48, 27, 7, 25, 4,
+    72, 60, 70, 58, 35, 28, 33, 26, 60, 54, 58, 49, 28, 22, 26, 6, 68, 50, 66, 48, 31, 11, 30, 9, 58, 49, 56, 47, 26, 6, 24, 3,
+    79, 71, 77, 67, 42, 34, 40, 31, 69, 59, 65, 52, 32, 27, 27, 10, 77, 67, 75, 63, 40, 31, 38, 26, 67, 57, 63, 51, 31, 25, 26, 9,
+    78, 70, 76, 66, 41, 33, 39, 30, 68, 58, 64, 48, 31, 26, 25, 9, 76, 66, 74, 62, 39, 30, 37, 24, 66, 56, 62, 46, 30, 24, 24, 8,
+    69, 59, 67, 57, 32, 27, 31, 25, 53, 50, 52, 48, 12, 7, 10, 4, 65, 52, 63, 51, 27, 10, 26, 9, 52, 48, 51, 46, 10, 4, 9, 2,
+    68, 58, 66, 56, 31, 26, 30, 24, 50, 49, 48, 47, 11, 6, 9, 3, 64, 48, 62, 46, 25, 9, 24, 8, 48, 47, 46, 45, 9, 3, 8, 1,
+    4, 62, 48, 104, 48, 104, 123, 170, 25, 144, 57, 164, 57, 164, 125, 176, 11, 63, 58, 107, 58, 107, 133, 171, 39, 148, 96, 166, 96, 166, 160, 179,
+    10, 66, 52, 106, 66, 114, 130, 172, 31, 145, 67, 165, 88, 166, 132, 178, 14, 67, 59, 108, 70, 115, 135, 173, 41, 149, 98, 167, 100, 169, 162, 117,
+    10, 66, 66, 114, 52, 106, 130, 172, 31, 145, 88, 166, 67, 165, 132, 178, 14, 67, 70, 115, 59, 108, 135, 173, 41, 149, 100, 169, 98, 167, 162, 117,
+    14, 70, 67, 115, 67, 115, 132, 174, 35, 152, 90, 168, 90, 168, 159, 156, 19, 71, 71, 116, 71, 116, 137, 111, 43, 153, 102, 147, 102, 147, 163, 76,
+    7, 74, 50, 110, 50, 110, 124, 171, 27, 146, 59, 165, 59, 165, 126, 177, 17, 75, 60, 112, 60, 112, 134, 175, 40, 150, 97, 168, 97, 168, 161, 155,
+    12, 76, 53, 111, 68, 117, 131, 173, 32, 147, 69, 116, 89, 167, 113, 108, 18, 77, 61, 113, 72, 119, 136, 131, 42, 151, 99, 89, 101, 147, 95, 68,
+    12, 76, 68, 117, 53, 111, 131, 173, 32, 147, 89, 167, 69, 116, 113, 108, 18, 77, 72, 119, 61, 113, 136, 131, 42, 151, 101, 147, 99, 89, 95, 68,
+    15, 78, 69, 118, 69, 118, 113, 111, 36, 101, 91, 89, 91, 89, 85, 65, 20, 79, 73, 69, 73, 69, 61, 53, 44, 42, 36, 32, 36, 32, 29, 12,
+    11, 63, 58, 107, 58, 107, 133, 171, 39, 148, 96, 166, 96, 166, 160, 179, 28, 84, 93, 112, 93, 112, 201, 185, 188, 214, 197, 204, 197, 204, 0, 160,
+    31, 88, 87, 115, 145, 166, 202, 211, 140, 198, 149, 210, 198, 218, 204, 166, 35, 90, 97, 119, 152, 168, 203, 135, 190, 215, 199, 149, 216, 198, 197, 96,
+    31, 88, 145, 166, 87, 115, 202, 211, 140, 198, 198, 218, 149, 210, 204, 166, 35, 90, 152, 168, 97, 119, 203, 135, 190, 215, 216, 198, 199, 149, 197, 96,
+    41, 100, 149, 169, 149, 169, 204, 209, 190, 216, 215, 198, 215, 198, 214, 148, 43, 102, 153, 147, 153, 147, 192, 94, 213, 190, 190, 140, 190, 140, 188, 39,
+    50, 110, 124, 171, 124, 171, 183, 212, 94, 209, 135, 211, 135, 211, 185, 171, 60, 112, 134, 175, 134, 175, 205, 183, 192, 204, 203, 202, 203, 202, 201, 133,
+    68, 117, 131, 173, 155, 179, 175, 171, 147, 169, 119, 115, 168, 166, 112, 107, 72, 119, 136, 131, 158, 155, 134, 124, 153, 149, 97, 87, 152, 145, 93, 58,
+    68, 117, 155, 179, 131, 173, 175, 171, 147, 169, 168, 166, 119, 115, 112, 107, 72, 119, 158, 155, 136, 131, 134, 124, 153, 149, 152, 145, 97, 87, 93, 58,
+    78, 120, 119, 117, 119, 117, 112, 110, 102, 100, 90, 88, 90, 88, 84, 63, 80, 78, 72, 68, 72, 68, 60, 50, 43, 41, 35, 31, 35, 31, 28, 11,
+    10, 66, 52, 106, 66, 114, 130, 172, 31, 145, 67, 165, 88, 166, 132, 178, 31, 88, 87, 115, 145, 166, 202, 211, 140, 198, 149, 210, 198, 218, 204, 166,
+    27, 94, 65, 111, 146, 209, 156, 174, 40, 192, 77, 137, 150, 204, 157, 132, 34, 98, 89, 118, 193, 210, 168, 115, 142, 199, 151, 98, 200, 198, 150, 88,
+    52, 130, 106, 172, 106, 172, 172, 217, 87, 202, 115, 211, 115, 211, 174, 172, 67, 132, 115, 174, 165, 178, 211, 172, 149, 204, 169, 209, 210, 166, 209, 114,
+    59, 135, 108, 173, 165, 211, 178, 172, 97, 203, 119, 135, 168, 202, 156, 130, 71, 137, 116, 111, 207, 165, 165, 106, 153, 192, 147, 94, 193, 145, 146, 66,
+    27, 146, 59, 165, 94, 209, 135, 211, 34, 193, 71, 207, 98, 210, 137, 165, 40, 150, 97, 168, 192, 204, 203, 202, 142, 200, 153, 193, 199, 198, 192, 145,
+    32, 147, 69, 116, 147, 169, 119, 115, 42, 153, 79, 71, 151, 149, 77, 67, 42, 151, 99, 89, 153, 149, 97, 87, 143, 142, 42, 34, 142, 140, 40, 31,
+    65, 156, 108, 178, 111, 174, 173, 172, 89, 168, 116, 165, 118, 115, 111, 106, 77, 157, 119, 156, 137, 132, 135, 130, 151, 150, 147, 146, 98, 88, 94, 66,
+    69, 119, 109, 108, 116, 115, 108, 106, 99, 97, 69, 59, 89, 87, 65, 52, 79, 77, 69, 65, 71, 67, 59, 52, 42, 40, 32, 27, 34, 31, 27, 10,
+    14, 67, 59, 108, 70, 115, 135, 173, 41, 149, 98, 167, 100, 169, 162, 117, 35, 90, 97, 119, 152, 168, 203, 135, 190, 215, 199, 149, 216, 198, 197, 96,
+    34, 98, 89, 118, 193, 210, 168, 115, 142, 199, 151, 98, 200, 198, 150, 88, 82, 102, 101, 78, 208, 193, 152, 70, 195, 190, 142, 41, 194, 189, 141, 33,
+    67, 132, 165, 178, 115, 174, 211, 172, 149, 204, 210, 166, 169, 209, 209, 114, 90, 159, 168, 156, 168, 156, 202, 130, 215, 214, 198, 148, 198, 148, 196, 86,
+    98, 162, 167, 117, 210, 209, 166, 114, 199, 197, 149, 96, 198, 196, 148, 86, 102, 163, 147, 76, 193, 146, 145, 66, 190, 188, 140, 39, 189, 139, 139, 30,
+    59, 165, 126, 177, 135, 211, 185, 171, 98, 210, 137, 165, 162, 209, 186, 110, 97, 168, 161, 155, 203, 202, 201, 133, 199, 198, 192, 145, 197, 196, 191, 92,
+    89, 167, 113, 108, 168, 166, 112, 107, 151, 149, 77, 67, 150, 148, 75, 63, 101, 147, 95, 68, 152, 145, 93, 58, 142, 140, 40, 31, 141, 139, 38, 26,
+    108, 178, 177, 176, 173, 172, 171, 170, 167, 166, 165, 164, 117, 114, 110, 104, 119, 156, 155, 154, 135, 130, 133, 123, 149, 148, 145, 144, 96, 86, 92, 56,
+    118, 117, 108, 105, 115, 114, 107, 104, 98, 96, 67, 57, 88, 86, 63, 51, 78, 76, 68, 64, 70, 66, 58, 48, 41, 39, 31, 25, 33, 30, 26, 9,
+    10, 66, 66, 114, 52, 106, 130, 172, 31, 145, 88, 166, 67, 165, 132, 178, 31, 88, 145, 166, 87, 115, 202, 211, 140, 198, 198, 0, 149, 210, 204, 166,
+    52, 130, 106, 172, 106, 172, 172, 0, 87, 202, 115, 211, 115, 211, 174, 172, 67, 132, 165, 178, 115, 174, 211, 172, 149, 204, 210, 166, 169, 209, 209, 114,
+    27, 94, 146, 209, 65, 111, 156, 174, 40, 192, 150, 204, 77, 137, 157, 132, 34, 98, 193, 210, 89, 118, 168, 115, 142, 199, 200, 198, 151, 98, 150, 88,
+    59, 135, 165, 211, 108, 173, 178, 172, 97, 203, 168, 202, 119, 135, 156, 130, 71, 137, 207, 165, 116, 111, 165, 106, 153, 192, 193, 145, 147, 94, 146, 66,
+    27, 146, 94, 209, 59, 165, 135, 211, 34, 193, 98, 210, 71, 207, 137, 165, 40, 150, 192, 204, 97, 168, 203, 202, 142, 200, 199, 198, 153, 193, 192, 145,
+    65, 156, 111, 174, 108, 178, 173, 172, 89, 168, 118, 115, 116, 165, 111, 106, 77, 157, 137, 132, 119, 156, 135, 130, 151, 150, 98, 88, 147, 146, 94, 66,
+    32, 147, 147, 169, 69, 116, 119, 115, 42, 153, 151, 149, 79, 71, 77, 67, 42, 151, 153, 149, 99, 89, 97, 87, 143, 142, 142, 140, 42, 34, 40, 31,
+    69, 119, 116, 115, 109, 108, 108, 106, 99, 97, 89, 87, 69, 59, 65, 52, 79, 77, 71, 67, 69, 65, 59, 52, 42, 40, 34, 31, 32, 27, 27, 10,
+    14, 67, 70, 115, 59, 108, 135, 173, 41, 149, 100, 169, 98, 167, 162, 117, 35, 90, 152, 168, 97, 119, 203, 135, 190, 215, 216, 198, 199, 149, 197, 96,
+    67, 132, 115, 174, 165, 178, 211, 172, 149, 204, 169, 209, 210, 166, 209, 114, 90, 159, 168, 156, 168, 156, 202, 130, 215, 214, 198, 148, 198, 148, 196, 86,
+    34, 98, 193, 210, 89, 118, 168, 115, 142, 199, 200, 198, 151, 98, 150, 88, 82, 102, 208, 193, 101, 78, 152, 70, 195, 190, 194, 189, 142, 41, 141, 33,
+    98, 162, 210, 209, 167, 117, 166, 114, 199, 197, 198, 196, 149, 96, 148, 86, 102, 163, 193, 146, 147, 76, 145, 66, 190, 188, 189, 139, 140, 39, 139, 30,
+    59, 165, 135, 211, 126, 177, 185, 171, 98, 210, 162, 209, 137, 165, 186, 110, 97, 168, 203, 202, 161, 155, 201, 133, 199, 198, 197, 196, 192, 145, 191, 92,
+    108, 178, 173, 172, 177, 176, 171, 170, 167, 166, 117, 114, 165, 164, 110, 104, 119, 156, 135, 130, 155, 154, 133, 123, 149, 148, 96, 86, 145, 144, 92, 56,
+    89, 167, 168, 166, 113, 108, 112, 107, 151, 149, 150, 148, 77, 67, 75, 63, 101, 147, 152, 145, 95, 68, 93, 58, 142, 140, 141, 139, 40, 31, 38, 26,
+    118, 117, 115, 114, 108, 105, 107, 104, 98, 96, 88, 86, 67, 57, 63, 51, 78, 76, 70, 66, 68, 64, 58, 48, 41, 39, 33, 30, 31, 25, 26, 9,
+    14, 70, 67, 115, 67, 115, 132, 174, 35, 152, 90, 168, 90, 168, 159, 156, 41, 100, 149, 169, 149, 169, 204, 209, 190, 0, 215, 198, 0, 198, 0, 148,
+    59, 135, 108, 173, 165, 211, 178, 172, 97, 203, 119, 135, 168, 202, 156, 130, 98, 162, 167, 117, 210, 209, 166, 114, 199, 197, 149, 96, 198, 196, 148, 86,
+    59, 135, 165, 211, 108, 173, 178, 172, 97, 203, 168, 202, 119, 135, 156, 130, 98, 162, 210, 209, 167, 117, 166, 114, 199, 197, 198, 196, 149, 96, 148, 86,
+    126, 185, 177, 171, 177, 171, 176, 170, 161, 201, 155, 133, 155, 133, 154, 123, 137, 186, 165, 110, 165, 110, 164, 104, 192, 191, 145, 92, 145, 92, 144, 56,
+    34, 193, 98, 210, 98, 210, 162, 209, 82, 208, 102, 193, 102, 193, 163, 146, 142, 200, 199, 198, 199, 198, 197, 196, 195, 194, 190, 189, 190, 189, 188, 139,
+    89, 168, 118, 115, 167, 166, 117, 114, 101, 152, 78, 70, 147, 145, 76, 66, 151, 150, 98, 88, 149, 148, 96, 86, 142, 141, 41, 33, 140, 139, 39, 30,
+    89, 168, 167, 166, 118, 115, 117, 114, 101, 152, 147, 145, 78, 70, 76, 66, 151, 150, 149, 148, 98, 88, 96, 86, 142, 141, 140, 139, 41, 33, 39, 30,
+    113, 112, 108, 107, 108, 107, 105, 104, 95, 93, 68, 58, 68, 58, 64, 48, 77, 75, 67, 63, 67, 63, 57, 51, 40, 38, 31, 26, 31, 26, 25, 9,
+    19, 71, 71, 116, 71, 116, 137, 111, 43, 153, 102, 147, 102, 147, 163, 76, 43, 102, 153, 147, 153, 147, 192, 94, 0, 190, 190, 140, 190, 140, 188, 39,
+    71, 137, 116, 111, 207, 165, 165, 106, 153, 192, 147, 94, 193, 145, 146, 66, 102, 163, 147, 76, 193, 146, 145, 66, 190, 188, 140, 39, 189, 139, 139, 30,
+    71, 137, 207, 165, 116, 111, 165, 106, 153, 192, 193, 145, 147, 94, 146, 66, 102, 163, 193, 146, 147, 76, 145, 66, 190, 188, 189, 139, 140, 39, 139, 30,
+    137, 186, 165, 110, 165, 110, 164, 104, 192, 191, 145, 92, 145, 92, 144, 56, 163, 206, 146, 74, 146, 74, 144, 62, 188, 187, 139, 37, 139, 37, 138, 24,
+    71, 207, 137, 165, 137, 165, 186, 110, 102, 193, 163, 146, 163, 146, 206, 74, 153, 193, 192, 145, 192, 145, 191, 92, 190, 189, 188, 139, 188, 139, 187, 37,
+    116, 165, 111, 106, 165, 164, 110, 104, 147, 145, 76, 66, 146, 144, 74, 62, 147, 146, 94, 66, 145, 144, 92, 56, 140, 139, 39, 30, 139, 138, 37, 24,
+    116, 165, 165, 164, 111, 106, 110, 104, 147, 145, 146, 144, 76, 66, 74, 62, 147, 146, 145, 144, 94, 66, 92, 56, 140, 139, 139, 138, 39, 30, 37, 24,
+    111, 110, 106, 104, 106, 104, 104, 103, 94, 92, 66, 56, 66, 56, 62, 46, 76, 74, 66, 62, 66, 62, 56, 46, 39, 37, 30, 24, 30, 24, 24, 8,
+    7, 74, 50, 110, 50, 110, 124, 171, 27, 146, 59, 165, 59, 165, 126, 177, 50, 110, 124, 171, 124, 171, 183, 0, 94, 209, 135, 211, 135, 211, 185, 171,
+    27, 146, 59, 165, 94, 209, 135, 211, 34, 193, 71, 207, 98, 210, 137, 165, 59, 165, 126, 177, 135, 211, 185, 171, 98, 210, 137, 165, 162, 209, 186, 110,
+    27, 146, 94, 209, 59, 165, 135, 211, 34, 193, 98, 210, 71, 207, 137, 165, 59, 165, 135, 0, 126, 177, 185, 171, 98, 210, 162, 209, 137, 165, 186, 110,
+    34, 193, 98, 210, 98, 0, 162, 0, 82, 0, 102, 193, 102, 193, 163, 146, 71, 0, 137, 165, 137, 165, 186, 110, 102, 193, 163, 146, 163, 146, 206, 74,
+    23, 0, 55, 186, 55, 186, 128, 185, 29, 163, 61, 137, 61, 137, 129, 126, 55, 186, 128, 185, 128, 185, 184, 183, 95, 162, 136, 135, 136, 135, 128, 124,
+    29, 163, 61, 137, 95, 162, 136, 135, 36, 102, 73, 71, 99, 98, 61, 59, 61, 137, 129, 126, 136, 135, 128, 124, 99, 98, 61, 59, 95, 94, 55, 50,
+    29, 163, 95, 162, 61, 137, 136, 135, 36, 102, 99, 98, 73, 71, 61, 59, 61, 137, 136, 135, 129, 126, 128, 124, 99, 98, 95, 94, 61, 59, 55, 50,
+    36, 102, 99, 98, 99, 98, 95, 94, 83, 82, 36, 34, 36, 34, 29, 27, 73, 71, 61, 59, 61, 59, 55, 50, 36, 34, 29, 27, 29, 27, 23, 7,
+    17, 75, 60, 112, 60, 112, 134, 175, 40, 150, 97, 168, 97, 168, 161, 155, 60, 112, 134, 175, 134, 175, 0, 183, 192, 204, 203, 202, 203, 202, 201, 133,
+    40, 150, 97, 168, 192, 204, 203, 202, 142, 200, 153, 193, 199, 198, 192, 145, 97, 168, 161, 155, 203, 202, 201, 133, 199, 198, 192, 145, 197, 196, 191, 92,
+    40, 150, 192, 0, 97, 168, 203, 202, 142, 200, 199, 198, 153, 193, 192, 145, 97, 168, 0, 0, 161, 155, 0, 133, 199, 198, 197, 196, 192, 145, 191, 92,
+    142, 0, 199, 198, 0, 0, 0, 0, 0, 0, 190, 189, 190, 189, 188, 139, 153, 0, 192, 145, 0, 145, 0, 92, 0, 0, 188, 139, 0, 139, 0, 37,
+    55, 0, 128, 185, 128, 185, 184, 183, 95, 162, 136, 135, 136, 135, 128, 124, 128, 0, 184, 183, 0, 0, 0, 0, 161, 160, 134, 133, 134, 133, 127, 122,
+    95, 162, 136, 135, 161, 160, 134, 133, 101, 100, 72, 70, 97, 96, 60, 58, 136, 135, 128, 124, 134, 133, 127, 122, 97, 96, 60, 58, 93, 92, 54, 49,
+    95, 162, 161, 160, 136, 135, 134, 133, 101, 100, 97, 96, 72, 70, 60, 58, 136, 135, 134, 133, 128, 124, 127, 122, 97, 96, 93, 92, 60, 58, 54, 49,
+    101, 100, 97, 96, 97, 96, 93, 92, 82, 81, 35, 33, 35, 33, 28, 26, 72, 70, 60, 58, 60, 58, 54, 49, 35, 33, 28, 26, 28, 26, 22, 6,
+    12, 76, 53, 111, 68, 117, 131, 173, 32, 147, 69, 116, 89, 167, 113, 108, 68, 117, 131, 173, 155, 179, 175, 171, 147, 169, 119, 115, 168, 166, 112, 107,
+    32, 147, 69, 116, 147, 169, 119, 115, 42, 153, 79, 71, 151, 149, 77, 67, 89, 167, 113, 108, 168, 166, 112, 107, 151, 149, 77, 67, 150, 148, 75, 63,
+    65, 156, 111, 174, 108, 178, 173, 172, 89, 168, 118, 115, 116, 165, 111, 106, 108, 178, 173, 172, 177, 176, 171, 170, 167, 166, 117, 114, 165, 164, 110, 104,
+    89, 168, 118, 115, 167, 166, 117, 114, 101, 152, 78, 70, 147, 145, 76, 66, 116, 165, 111, 106, 165, 164, 110, 104, 147, 145, 76, 66, 146, 144, 74, 62,
+    29, 163, 61, 137, 95, 162, 136, 135, 36, 102, 73, 71, 99, 98, 61, 59, 95, 162, 136, 135, 161, 160, 134, 133, 101, 100, 72, 70, 97, 96, 60, 58,
+    36, 102, 73, 71, 101, 100, 72, 70, 44, 43, 20, 19, 42, 41, 18, 14, 99, 98, 61, 59, 97, 96, 60, 58, 42, 41, 18, 14, 40, 39, 17, 11,
+    85, 159, 113, 132, 113, 132, 131, 130, 91, 90, 69, 67, 69, 67, 53, 52, 113, 132, 131, 130, 126, 125, 124, 123, 89, 88, 68, 66, 59, 57, 50, 48,
+    91, 90, 69, 67, 89, 88, 68, 66, 36, 35, 15, 14, 32, 31, 12, 10, 69, 67, 53, 52, 59, 57, 50, 48, 32, 31, 12, 10, 27, 25, 7, 4,
+    18, 77, 61, 113, 72, 119, 136, 131, 42, 151, 99, 89, 101, 147, 95, 68, 72, 119, 136, 131, 158, 155, 134, 124, 153, 149, 97, 87, 152, 145, 93, 58,
+    42, 151, 99, 89, 153, 149, 97, 87, 143, 142, 42, 34, 142, 140, 40, 31, 101, 147, 95, 68, 152, 145, 93, 58, 142, 140, 40, 31, 141, 139, 38, 26,
+    77, 157, 137, 132, 119, 156, 135, 130, 151, 150, 98, 88, 147, 146, 94, 66, 119, 156, 135, 130, 155, 154, 133, 123, 149, 148, 96, 86, 145, 144, 92, 56,
+    151, 150, 98, 88, 149, 148, 96, 86, 142, 141, 41, 33, 140, 139, 39, 30, 147, 146, 94, 66, 145, 144, 92, 56, 140, 139, 39, 30, 139, 138, 37, 24,
+    61, 137, 129, 126, 136, 135, 128, 124, 99, 98, 61, 59, 95, 94, 55, 50, 136, 135, 128, 124, 134, 133, 127, 122, 97, 96, 60, 58, 93, 92, 54, 49,
+    99, 98, 61, 59, 97, 96, 60, 58, 42, 41, 18, 14, 40, 39, 17, 11, 95, 94, 55, 50, 93, 92, 54, 49, 40, 39, 17, 11, 38, 37, 16, 6,
+    113, 132, 126, 125, 131, 130, 124, 123, 89, 88, 59, 57, 68, 66, 50, 48, 131, 130, 124, 123, 124, 123, 122, 121, 87, 86, 58, 56, 58, 56, 49, 47,
+    89, 88, 59, 57, 87, 86, 58, 56, 34, 33, 14, 13, 31, 30, 11, 9, 68, 66, 50, 48, 58, 56, 49, 47, 31, 30, 11, 9, 26, 24, 6, 3,
+    12, 76, 68, 117, 53, 111, 131, 173, 32, 147, 89, 167, 69, 116, 113, 108, 68, 117, 155, 179, 131, 173, 175, 171, 147, 169, 168, 166, 119, 115, 112, 107,
+    65, 156, 108, 178, 111, 174, 173, 172, 89, 168, 116, 165, 118, 115, 111, 106, 108, 178, 177, 176, 173, 172, 171, 170, 167, 166, 165, 164, 117, 114, 110, 104,
+    32, 147, 147, 169, 69, 116, 119, 115, 42, 153, 151, 149, 79, 71, 77, 67, 89, 167, 168, 166, 113, 108, 112, 107, 151, 149, 150, 148, 77, 67, 75, 63,
+    89, 168, 167, 166, 118, 115, 117, 114, 101, 152, 147, 145, 78, 70, 76, 66, 116, 165, 165, 164, 111, 106, 110, 104, 147, 145, 146, 144, 76, 66, 74, 62,
+    29, 163, 95, 162, 61, 137, 136, 135, 36, 102, 99, 98, 73, 71, 61, 59, 95, 162, 161, 160, 136, 135, 134, 133, 101, 100, 97, 96, 72, 70, 60, 58,
+    85, 159, 113, 132, 113, 132, 131, 130, 91, 90, 69, 67, 69, 67, 53, 52, 113, 132, 126, 125, 131, 130, 124, 123, 89, 88, 59, 57, 68, 66, 50, 48,
+    36, 102, 101, 100, 73, 71, 72, 70, 44, 43, 42, 41, 20, 19, 18, 14, 99, 98, 97, 96, 61, 59, 60, 58, 42, 41, 40, 39, 18, 14, 17, 11,
+    91, 90, 89, 88, 69, 67, 68, 66, 36, 35, 32, 31, 15, 14, 12, 10, 69, 67, 59, 57, 53, 52, 50, 48, 32, 31, 27, 25, 12, 10, 7, 4,
+    18, 77, 72, 119, 61, 113, 136, 131, 42, 151, 101, 147, 99, 89, 95, 68, 72, 119, 158, 155, 136, 131, 134, 124, 153, 149, 152, 145, 97, 87, 93, 58,
+    77, 157, 119, 156, 137, 132, 135, 130, 151, 150, 147, 146, 98, 88, 94, 66, 119, 156, 155, 154, 135, 130, 133, 123, 149, 148, 145, 144, 96, 86, 92, 56,
+    42, 151, 153, 149, 99, 89, 97, 87, 143, 142, 142, 140, 42, 34, 40, 31, 101, 147, 152, 145, 95, 68, 93, 58, 142, 140, 141, 139, 40, 31, 38, 26,
+    151, 150, 149, 148, 98, 88, 96, 86, 142, 141, 140, 139, 41, 33, 39, 30, 147, 146, 145, 144, 94, 66, 92, 56, 140, 139, 139, 138, 39, 30, 37, 24,
+    61, 137, 136, 135, 129, 126, 128, 124, 99, 98, 95, 94, 61, 59, 55, 50, 136, 135, 134, 133, 128, 124, 127, 122, 97, 96, 93, 92, 60, 58, 54, 49,
+    113, 132, 131, 130, 126, 125, 124, 123, 89, 88, 68, 66, 59, 57, 50, 48, 131, 130, 124, 123, 124, 123, 122, 121, 87, 86, 58, 56, 58, 56, 49, 47,
+    99, 98, 97, 96, 61, 59, 60, 58, 42, 41, 40, 39, 18, 14, 17, 11, 95, 94, 93, 92, 55, 50, 54, 49, 40, 39, 38, 37, 17, 11, 16, 6,
+    89, 88, 87, 86, 59, 57, 58, 56, 34, 33, 31, 30, 14, 13, 11, 9, 68, 66, 58, 56, 50, 48, 49, 47, 31, 30, 26, 24, 11, 9, 6, 3,
+    15, 78, 69, 118, 69, 118, 113, 111, 36, 101, 91, 89, 91, 89, 85, 65, 78, 120, 119, 117, 119, 117, 112, 110, 102, 100, 90, 88, 90, 88, 84, 63,
+    69, 119, 109, 108, 116, 115, 108, 106, 99, 97, 69, 59, 89, 87, 65, 52, 118, 117, 108, 105, 115, 114, 107, 104, 98, 96, 67, 57, 88, 86, 63, 51,
+    69, 119, 116, 115, 109, 108, 108, 106, 99, 97, 89, 87, 69, 59, 65, 52, 118, 117, 115, 114, 108, 105, 107, 104, 98, 96, 88, 86, 67, 57, 63, 51,
+    113, 112, 108, 107, 108, 107, 105, 104, 95, 93, 68, 58, 68, 58, 64, 48, 111, 110, 106, 104, 106, 104, 104, 103, 94, 92, 66, 56, 66, 56, 62, 46,
+    36, 102, 99, 98, 99, 98, 95, 94, 83, 82, 36, 34, 36, 34, 29, 27, 101, 100, 97, 96, 97, 96, 93, 92, 82, 81, 35, 33, 35, 33, 28, 26,
+    91, 90, 69, 67, 89, 88, 68, 66, 36, 35, 15, 14, 32, 31, 12, 10, 89, 88, 59, 57, 87, 86, 58, 56, 34, 33, 14, 13, 31, 30, 11, 9,
+    91, 90, 89, 88, 69, 67, 68, 66, 36, 35, 32, 31, 15, 14, 12, 10, 89, 88, 87, 86, 59, 57, 58, 56, 34, 33, 31, 30, 14, 13, 11, 9,
+    85, 84, 65, 63, 65, 63, 64, 62, 29, 28, 12, 11, 12, 11, 5, 4, 65, 63, 52, 51, 52, 51, 48, 46, 27, 26, 10, 9, 10, 9, 4, 2,
+    20, 79, 73, 69, 73, 69, 61, 53, 44, 42, 36, 32, 36, 32, 29, 12, 80, 78, 72, 68, 72, 68, 60, 50, 43, 41, 35, 31, 35, 31, 28, 11,
+    79, 77, 69, 65, 71, 67, 59, 52, 42, 40, 32, 27, 34, 31, 27, 10, 78, 76, 68, 64, 70, 66, 58, 48, 41, 39, 31, 25, 33, 30, 26, 9,
+    79, 77, 71, 67, 69, 65, 59, 52, 42, 40, 34, 31, 32, 27, 27, 10, 78, 76, 70, 66, 68, 64, 58, 48, 41, 39, 33, 30, 31, 25, 26, 9,
+    77, 75, 67, 63, 67, 63, 57, 51, 40, 38, 31, 26, 31, 26, 25, 9, 76, 74, 66, 62, 66, 62, 56, 46, 39, 37, 30, 24, 30, 24, 24, 8,
+    73, 71, 61, 59, 61, 59, 55, 50, 36, 34, 29, 27, 29, 27, 23, 7, 72, 70, 60, 58, 60, 58, 54, 49, 35, 33, 28, 26, 28, 26, 22, 6,
+    69, 67, 53, 52, 59, 57, 50, 48, 32, 31, 12, 10, 27, 25, 7, 4, 68, 66, 50, 48, 58, 56, 49, 47, 31, 30, 11, 9, 26, 24, 6, 3,
+    69, 67, 59, 57, 53, 52, 50, 48, 32, 31, 27, 25, 12, 10, 7, 4, 68, 66, 58, 56, 50, 48, 49, 47, 31, 30, 26, 24, 11, 9, 6, 3,
+    65, 63, 52, 51, 52, 51, 48, 46, 27, 26, 10, 9, 10, 9, 4, 2, 64, 62, 48, 46, 48, 46, 47, 45, 25, 24, 9, 8, 9, 8, 3, 1,
+    5, 64, 64, 105, 64, 105, 154, 176, 64, 154, 105, 176, 105, 176, 176, 0, 12, 65, 68, 108, 68, 108, 155, 177, 76, 156, 117, 178, 117, 178, 179, 176,
+    12, 68, 65, 108, 76, 117, 156, 178, 68, 155, 108, 177, 117, 179, 178, 176, 15, 69, 69, 109, 78, 118, 119, 108, 78, 119, 118, 108, 120, 117, 117, 105,
+    12, 68, 76, 117, 65, 108, 156, 178, 68, 155, 117, 179, 108, 177, 178, 176, 15, 69, 78, 118, 69, 109, 119, 108, 78, 119, 120, 117, 118, 108, 117, 105,
+    18, 72, 77, 119, 77, 119, 157, 156, 72, 158, 119, 155, 119, 155, 156, 154, 20, 73, 79, 69, 79, 69, 77, 65, 80, 72, 78, 68, 78, 68, 76, 64,
+    12, 76, 68, 117, 68, 117, 155, 179, 65, 156, 108, 178, 108, 178, 177, 176, 18, 77, 72, 119, 72, 119, 158, 155, 77, 157, 119, 156, 119, 156, 155, 154,
+    15, 78, 69, 118, 78, 120, 119, 117, 69, 119, 109, 108, 118, 117, 108, 105, 20, 79, 73, 69, 80, 78, 72, 68, 79, 77, 69, 65, 78, 76, 68, 64,
+    15, 78, 78, 120, 69, 118, 119, 117, 69, 119, 118, 117, 109, 108, 108, 105, 20, 79, 80, 78, 73, 69, 72, 68, 79, 77, 78, 76, 69, 65, 68, 64,
+    20, 80, 79, 78, 79, 78, 77, 76, 73, 72, 69, 68, 69, 68, 65, 64, 21, 20, 20, 15, 20, 15, 18, 12, 20, 18, 15, 12, 15, 12, 12, 5,
+    12, 65, 68, 108, 68, 108, 155, 177, 76, 156, 117, 178, 117, 178, 179, 176, 29, 85, 95, 113, 95, 113, 161, 126, 163, 159, 162, 132, 162, 132, 160, 125,
+    32, 89, 89, 116, 147, 167, 168, 165, 147, 168, 167, 165, 169, 166, 166, 164, 36, 91, 99, 69, 101, 89, 97, 59, 102, 90, 98, 67, 100, 88, 96, 57,
+    32, 89, 147, 167, 89, 116, 168, 165, 147, 168, 169, 166, 167, 165, 166, 164, 36, 91, 101, 89, 99, 69, 97, 59, 102, 90, 100, 88, 98, 67, 96, 57,
+    42, 101, 151, 147, 151, 147, 150, 146, 153, 152, 149, 145, 149, 145, 148, 144, 44, 36, 42, 32, 42, 32, 40, 27, 43, 35, 41, 31, 41, 31, 39, 25,
+    53, 111, 131, 173, 131, 173, 175, 171, 111, 174, 173, 172, 173, 172, 171, 170, 61, 113, 136, 131, 136, 131, 134, 124, 137, 132, 135, 130, 135, 130, 133, 123,
+    69, 118, 113, 111, 119, 117, 112, 110, 116, 115, 108, 106, 115, 114, 107, 104, 73, 69, 61, 53, 72, 68, 60, 50, 71, 67, 59, 52, 70, 66, 58, 48,
+    69, 118, 119, 117, 113, 111, 112, 110, 116, 115, 115, 114, 108, 106, 107, 104, 73, 69, 72, 68, 61, 53, 60, 50, 71, 67, 70, 66, 59, 52, 58, 48,
+    79, 78, 77, 76, 77, 76, 75, 74, 71, 70, 67, 66, 67, 66, 63, 62, 20, 15, 18, 12, 18, 12, 17, 7, 19, 14, 14, 10, 14, 10, 11, 4,
+    12, 68, 65, 108, 76, 117, 156, 178, 68, 155, 108, 177, 117, 179, 178, 176, 32, 89, 89, 116, 147, 167, 168, 165, 147, 168, 167, 165, 169, 166, 166, 164,
+    29, 95, 85, 113, 163, 162, 159, 132, 95, 161, 113, 126, 162, 160, 132, 125, 36, 99, 91, 69, 102, 98, 90, 67, 101, 97, 89, 59, 100, 96, 88, 57,
+    53, 131, 111, 173, 111, 173, 174, 172, 131, 175, 173, 171, 173, 171, 172, 170, 69, 113, 118, 111, 116, 108, 115, 106, 119, 112, 117, 110, 115, 107, 114, 104,
+    61, 136, 113, 131, 137, 135, 132, 130, 136, 134, 131, 124, 135, 133, 130, 123, 73, 61, 69, 53, 71, 59, 67, 52, 72, 60, 68, 50, 70, 58, 66, 48,
+    32, 147, 89, 167, 147, 169, 168, 166, 89, 168, 116, 165, 167, 166, 165, 164, 42, 151, 101, 147, 153, 149, 152, 145, 151, 150, 147, 146, 149, 148, 145, 144,
+    36, 101, 91, 89, 102, 100, 90, 88, 99, 97, 69, 59, 98, 96, 67, 57, 44, 42, 36, 32, 43, 41, 35, 31, 42, 40, 32, 27, 41, 39, 31, 25,
+    69, 119, 118, 117, 116, 115, 115, 114, 113, 112, 111, 110, 108, 107, 106, 104, 79, 77, 78, 76, 71, 67, 70, 66, 77, 75, 76, 74, 67, 63, 66, 62,
+    73, 72, 69, 68, 71, 70, 67, 66, 61, 60, 53, 50, 59, 58, 52, 48, 20, 18, 15, 12, 19, 14, 14, 10, 18, 17, 12, 7, 14, 11, 10, 4,
+    15, 69, 69, 109, 78, 118, 119, 108, 78, 119, 118, 108, 120, 117, 117, 105, 36, 91, 99, 69, 101, 89, 97, 59, 102, 90, 98, 67, 100, 88, 96, 57,
+    36, 99, 91, 69, 102, 98, 90, 67, 101, 97, 89, 59, 100, 96, 88, 57, 83, 36, 36, 15, 82, 34, 35, 14, 82, 35, 34, 14, 81, 33, 33, 13,
+    69, 113, 116, 108, 118, 111, 115, 106, 119, 112, 115, 107, 117, 110, 114, 104, 91, 85, 89, 65, 89, 65, 87, 52, 90, 84, 88, 63, 88, 63, 86, 51,
+    99, 95, 89, 68, 98, 94, 88, 66, 97, 93, 87, 58, 96, 92, 86, 56, 36, 29, 32, 12, 34, 27, 31, 10, 35, 28, 31, 11, 33, 26, 30, 9,
+    69, 116, 113, 108, 119, 115, 112, 107, 118, 115, 111, 106, 117, 114, 110, 104, 99, 89, 95, 68, 97, 87, 93, 58, 98, 88, 94, 66, 96, 86, 92, 56,
+    91, 89, 85, 65, 90, 88, 84, 63, 89, 87, 65, 52, 88, 86, 63, 51, 36, 32, 29, 12, 35, 31, 28, 11, 34, 31, 27, 10, 33, 30, 26, 9,
+    109, 108, 108, 105, 108, 106, 107, 104, 108, 107, 106, 104, 105, 104, 104, 103, 69, 65, 68, 64, 59, 52, 58, 48, 67, 63, 66, 62, 57, 51, 56, 46,
+    69, 68, 65, 64, 67, 66, 63, 62, 59, 58, 52, 48, 57, 56, 51, 46, 15, 12, 12, 5, 14, 10, 11, 4, 14, 11, 10, 4, 13, 9, 9, 2,
+    12, 68, 76, 117, 65, 108, 156, 178, 68, 155, 117, 179, 108, 177, 178, 176, 32, 89, 147, 167, 89, 116, 168, 165, 147, 168, 169, 166, 167, 165, 166, 164,
+    53, 131, 111, 173, 111, 173, 174, 172, 131, 175, 173, 171, 173, 171, 172, 170, 69, 113, 116, 108, 118, 111, 115, 106, 119, 112, 115, 107, 117, 110, 114, 104,
+    29, 95, 163, 162, 85, 113, 159, 132, 95, 161, 162, 160, 113, 126, 132, 125, 36, 99, 102, 98, 91, 69, 90, 67, 101, 97, 100, 96, 89, 59, 88, 57,
+    61, 136, 137, 135, 113, 131, 132, 130, 136, 134, 135, 133, 131, 124, 130, 123, 73, 61, 71, 59, 69, 53, 67, 52, 72, 60, 70, 58, 68, 50, 66, 48,
+    32, 147, 147, 169, 89, 167, 168, 166, 89, 168, 167, 166, 116, 165, 165, 164, 42, 151, 153, 149, 101, 147, 152, 145, 151, 150, 149, 148, 147, 146, 145, 144,
+    69, 119, 116, 115, 118, 117, 115, 114, 113, 112, 108, 107, 111, 110, 106, 104, 79, 77, 71, 67, 78, 76, 70, 66, 77, 75, 67, 63, 76, 74, 66, 62,
+    36, 101, 102, 100, 91, 89, 90, 88, 99, 97, 98, 96, 69, 59, 67, 57, 44, 42, 43, 41, 36, 32, 35, 31, 42, 40, 41, 39, 32, 27, 31, 25,
+    73, 72, 71, 70, 69, 68, 67, 66, 61, 60, 59, 58, 53, 50, 52, 48, 20, 18, 19, 14, 15, 12, 14, 10, 18, 17, 14, 11, 12, 7, 10, 4,
+    15, 69, 78, 118, 69, 109, 119, 108, 78, 119, 120, 117, 118, 108, 117, 105, 36, 91, 101, 89, 99, 69, 97, 59, 102, 90, 100, 88, 98, 67, 96, 57,
+    69, 113, 118, 111, 116, 108, 115, 106, 119, 112, 117, 110, 115, 107, 114, 104, 91, 85, 89, 65, 89, 65, 87, 52, 90, 84, 88, 63, 88, 63, 86, 51,
+    36, 99, 102, 98, 91, 69, 90, 67, 101, 97, 100, 96, 89, 59, 88, 57, 83, 36, 82, 34, 36, 15, 35, 14, 82, 35, 81, 33, 34, 14, 33, 13,
+    99, 95, 98, 94, 89, 68, 88, 66, 97, 93, 96, 92, 87, 58, 86, 56, 36, 29, 34, 27, 32, 12, 31, 10, 35, 28, 33, 26, 31, 11, 30, 9,
+    69, 116, 119, 115, 113, 108, 112, 107, 118, 115, 117, 114, 111, 106, 110, 104, 99, 89, 97, 87, 95, 68, 93, 58, 98, 88, 96, 86, 94, 66, 92, 56,
+    109, 108, 108, 106, 108, 105, 107, 104, 108, 107, 105, 104, 106, 104, 104, 103, 69, 65, 59, 52, 68, 64, 58, 48, 67, 63, 57, 51, 66, 62, 56, 46,
+    91, 89, 90, 88, 85, 65, 84, 63, 89, 87, 88, 86, 65, 52, 63, 51, 36, 32, 35, 31, 29, 12, 28, 11, 34, 31, 33, 30, 27, 10, 26, 9,
+    69, 68, 67, 66, 65, 64, 63, 62, 59, 58, 57, 56, 52, 48, 51, 46, 15, 12, 14, 10, 12, 5, 11, 4, 14, 11, 13, 9, 10, 4, 9, 2,
+    18, 72, 77, 119, 77, 119, 157, 156, 72, 158, 119, 155, 119, 155, 156, 154, 42, 101, 151, 147, 151, 147, 150, 146, 153, 152, 149, 145, 149, 145, 148, 144,
+    61, 136, 113, 131, 137, 135, 132, 130, 136, 134, 131, 124, 135, 133, 130, 123, 99, 95, 89, 68, 98, 94, 88, 66, 97, 93, 87, 58, 96, 92, 86, 56,
+    61, 136, 137, 135, 113, 131, 132, 130, 136, 134, 135, 133, 131, 124, 130, 123, 99, 95, 98, 94, 89, 68, 88, 66, 97, 93, 96, 92, 87, 58, 86, 56,
+    129, 128, 126, 124, 126, 124, 125, 123, 128, 127, 124, 122, 124, 122, 123, 121, 61, 55, 59, 50, 59, 50, 57, 48, 60, 54, 58, 49, 58, 49, 56, 47,
+    42, 153, 151, 149, 151, 149, 150, 148, 101, 152, 147, 145, 147, 145, 146, 144, 143, 142, 142, 140, 142, 140, 141, 139, 142, 141, 140, 139, 140, 139, 139, 138,
+    99, 97, 89, 87, 98, 96, 88, 86, 95, 93, 68, 58, 94, 92, 66, 56, 42, 40, 34, 31, 41, 39, 33, 30, 40, 38, 31, 26, 39, 37, 30, 24,
+    99, 97, 98, 96, 89, 87, 88, 86, 95, 93, 94, 92, 68, 58, 66, 56, 42, 40, 41, 39, 34, 31, 33, 30, 40, 38, 39, 37, 31, 26, 30, 24,
+    61, 60, 59, 58, 59, 58, 57, 56, 55, 54, 50, 49, 50, 49, 48, 47, 18, 17, 14, 11, 14, 11, 13, 9, 17, 16, 11, 6, 11, 6, 9, 3,
+    20, 73, 79, 69, 79, 69, 77, 65, 80, 72, 78, 68, 78, 68, 76, 64, 44, 36, 42, 32, 42, 32, 40, 27, 43, 35, 41, 31, 41, 31, 39, 25,
+    73, 61, 69, 53, 71, 59, 67, 52, 72, 60, 68, 50, 70, 58, 66, 48, 36, 29, 32, 12, 34, 27, 31, 10, 35, 28, 31, 11, 33, 26, 30, 9,
+    73, 61, 71, 59, 69, 53, 67, 52, 72, 60, 70, 58, 68, 50, 66, 48, 36, 29, 34, 27, 32, 12, 31, 10, 35, 28, 33, 26, 31, 11, 30, 9,
+    61, 55, 59, 50, 59, 50, 57, 48, 60, 54, 58, 49, 58, 49, 56, 47, 29, 23, 27, 7, 27, 7, 25, 4, 28, 22, 26, 6, 26, 6, 24, 3,
+    79, 71, 77, 67, 77, 67, 75, 63, 78, 70, 76, 66, 76, 66, 74, 62, 42, 34, 40, 31, 40, 31, 38, 26, 41, 33, 39, 30, 39, 30, 37, 24,
+    69, 59, 65, 52, 67, 57, 63, 51, 68, 58, 64, 48, 66, 56, 62, 46, 32, 27, 27, 10, 31, 25, 26, 9, 31, 26, 25, 9, 30, 24, 24, 8,
+    69, 59, 67, 57, 65, 52, 63, 51, 68, 58, 66, 56, 64, 48, 62, 46, 32, 27, 31, 25, 27, 10, 26, 9, 31, 26, 30, 24, 25, 9, 24, 8,
+    53, 50, 52, 48, 52, 48, 51, 46, 50, 49, 48, 47, 48, 47, 46, 45, 12, 7, 10, 4, 10, 4, 9, 2, 11, 6, 9, 3, 9, 3, 8, 1,
+    12, 76, 68, 117, 68, 117, 155, 0, 65, 156, 108, 178, 108, 0, 0, 0, 53, 111, 131, 173, 131, 173, 0, 171, 111, 0, 173, 172, 0, 0, 0, 0,
+    32, 147, 89, 167, 147, 169, 168, 166, 89, 168, 116, 165, 167, 166, 165, 164, 69, 116, 113, 108, 119, 115, 112, 107, 118, 115, 111, 106, 117, 114, 110, 104,
+    32, 147, 147, 0, 89, 167, 168, 166, 89, 0, 0, 0, 116, 165, 0, 0, 69, 116, 119, 115, 113, 108, 112, 107, 118, 115, 117, 114, 111, 106, 110, 104,
+    42, 153, 151, 149, 151, 149, 150, 148, 101, 152, 147, 145, 147, 145, 146, 144, 79, 71, 77, 67, 77, 67, 75, 63, 78, 70, 76, 66, 76, 66, 74, 62,
+    29, 0, 95, 162, 95, 0, 0, 0, 85, 0, 113, 132, 113, 132, 126, 125, 61, 137, 136, 135, 136, 135, 134, 133, 113, 132, 131, 130, 131, 130, 124, 123,
+    36, 102, 99, 98, 101, 100, 97, 96, 91, 90, 69, 67, 89, 88, 59, 57, 73, 71, 61, 59, 72, 70, 60, 58, 69, 67, 53, 52, 68, 66, 50, 48,
+    36, 102, 101, 100, 99, 98, 97, 96, 91, 90, 89, 88, 69, 67, 59, 57, 73, 71, 72, 70, 61, 59, 60, 58, 69, 67, 68, 66, 53, 52, 50, 48,
+    44, 43, 42, 41, 42, 41, 40, 39, 36, 35, 32, 31, 32, 31, 27, 25, 20, 19, 18, 14, 18, 14, 17, 11, 15, 14, 12, 10, 12, 10, 7, 4,
+    18, 77, 72, 119, 72, 119, 0, 155, 77, 0, 119, 156, 119, 0, 0, 0, 61, 113, 136, 131, 136, 131, 134, 124, 137, 132, 135, 130, 135, 130, 133, 123,
+    42, 151, 101, 147, 153, 149, 152, 145, 151, 150, 147, 146, 149, 148, 145, 144, 99, 89, 95, 68, 97, 87, 93, 58, 98, 88, 94, 66, 96, 86, 92, 56,
+    42, 151, 0, 149, 101, 147, 0, 145, 0, 0, 0, 0, 0, 0, 0, 0, 99, 89, 97, 87, 95, 68, 93, 58, 98, 88, 96, 86, 94, 66, 92, 56,
+    0, 142, 142, 140, 142, 140, 141, 139, 0, 0, 140, 139, 0, 139, 0, 0, 42, 34, 40, 31, 40, 31, 38, 26, 41, 33, 39, 30, 39, 30, 37, 24,
+    61, 0, 136, 135, 0, 0, 0, 0, 113, 0, 131, 130, 0, 0, 124, 123, 0, 126, 128, 124, 0, 124, 0, 122, 0, 0, 124, 123, 0, 0, 0, 0,
+    99, 98, 95, 94, 97, 96, 93, 92, 89, 88, 68, 66, 87, 86, 58, 56, 61, 59, 55, 50, 60, 58, 54, 49, 59, 57, 50, 48, 58, 56, 49, 47,
+    99, 98, 97, 96, 95, 94, 93, 92, 89, 88, 87, 86, 68, 66, 58, 56, 61, 59, 60, 58, 55, 50, 54, 49, 59, 57, 58, 56, 50, 48, 49, 47,
+    42, 41, 40, 39, 40, 39, 38, 37, 34, 33, 31, 30, 31, 30, 26, 24, 18, 14, 17, 11, 17, 11, 16, 6, 14, 13, 11, 9, 11, 9, 6, 3,
+    15, 78, 69, 118, 78, 120, 119, 117, 69, 119, 109, 108, 118, 117, 108, 105, 69, 118, 113, 111, 119, 117, 112, 110, 116, 115, 108, 106, 115, 114, 107, 104,
+    36, 101, 91, 89, 102, 100, 90, 88, 99, 97, 69, 59, 98, 96, 67, 57, 91, 89, 85, 65, 90, 88, 84, 63, 89, 87, 65, 52, 88, 86, 63, 51,
+    69, 119, 116, 115, 118, 117, 115, 114, 113, 112, 108, 107, 111, 110, 106, 104, 109, 108, 108, 106, 108, 105, 107, 104, 108, 107, 105, 104, 106, 104, 104, 103,
+    99, 97, 89, 87, 98, 96, 88, 86, 95, 93, 68, 58, 94, 92, 66, 56, 69, 59, 65, 52, 67, 57, 63, 51, 68, 58, 64, 48, 66, 56, 62, 46,
+    36, 102, 99, 98, 101, 100, 97, 96, 91, 90, 69, 67, 89, 88, 59, 57, 99, 98, 95, 94, 97, 96, 93, 92, 89, 88, 68, 66, 87, 86, 58, 56,
+    83, 82, 36, 34, 82, 81, 35, 33, 36, 35, 15, 14, 34, 33, 14, 13, 36, 34, 29, 27, 35, 33, 28, 26, 32, 31, 12, 10, 31, 30, 11, 9,
+    91, 90, 89, 88, 89, 88, 87, 86, 85, 84, 65, 63, 65, 63, 52, 51, 69, 67, 68, 66, 59, 57, 58, 56, 65, 63, 64, 62, 52, 51, 48, 46,
+    36, 35, 32, 31, 34, 33, 31, 30, 29, 28, 12, 11, 27, 26, 10, 9, 15, 14, 12, 10, 14, 13, 11, 9, 12, 11, 5, 4, 10, 9, 4, 2,
+    20, 79, 73, 69, 80, 78, 72, 68, 79, 77, 69, 65, 78, 76, 68, 64, 73, 69, 61, 53, 72, 68, 60, 50, 71, 67, 59, 52, 70, 66, 58, 48,
+    44, 42, 36, 32, 43, 41, 35, 31, 42, 40, 32, 27, 41, 39, 31, 25, 36, 32, 29, 12, 35, 31, 28, 11, 34, 31, 27, 10, 33, 30, 26, 9,
+    79, 77, 71, 67, 78, 76, 70, 66, 77, 75, 67, 63, 76, 74, 66, 62, 69, 65, 59, 52, 68, 64, 58, 48, 67, 63, 57, 51, 66, 62, 56, 46,
+    42, 40, 34, 31, 41, 39, 33, 30, 40, 38, 31, 26, 39, 37, 30, 24, 32, 27, 27, 10, 31, 25, 26, 9, 31, 26, 25, 9, 30, 24, 24, 8,
+    73, 71, 61, 59, 72, 70, 60, 58, 69, 67, 53, 52, 68, 66, 50, 48, 61, 59, 55, 50, 60, 58, 54, 49, 59, 57, 50, 48, 58, 56, 49, 47,
+    36, 34, 29, 27, 35, 33, 28, 26, 32, 31, 12, 10, 31, 30, 11, 9, 29, 27, 23, 7, 28, 26, 22, 6, 27, 25, 7, 4, 26, 24, 6, 3,
+    69, 67, 59, 57, 68, 66, 58, 56, 65, 63, 52, 51, 64, 62, 48, 46, 53, 52, 50, 48, 50, 48, 49, 47, 52, 51, 48, 46, 48, 46, 47, 45,
+    32, 31, 27, 25, 31, 30, 26, 24, 27, 26, 10, 9, 25, 24, 9, 8, 12, 10, 7, 4, 11, 9, 6, 3, 10, 9, 4, 2, 9, 8, 3, 1,
+    15, 78, 78, 0, 69, 118, 119, 117, 69, 119, 118, 117, 109, 108, 108, 105, 69, 118, 119, 117, 113, 111, 112, 110, 116, 115, 115, 114, 108, 106, 107, 104,
+    69, 0, 0, 0, 0, 115, 0, 0, 0, 0, 0, 0, 108, 107, 106, 104, 0, 108, 108, 105, 108, 106, 107, 104, 0, 0, 0, 104, 0, 104, 0, 0,
+    36, 101, 102, 100, 91, 89, 90, 88, 99, 97, 98, 96, 69, 59, 67, 57, 91, 89, 90, 88, 85, 65, 84, 63, 89, 87, 88, 86, 65, 52, 63, 51,
+    99, 97, 98, 96, 89, 87, 88, 86, 95, 93, 94, 92, 68, 58, 66, 56, 69, 59, 67, 57, 65, 52, 63, 51, 68, 58, 66, 56, 64, 48, 62, 46,
+    36, 0, 0, 0, 99, 98, 97, 96, 91, 90, 89, 88, 69, 67, 59, 57, 0, 0, 0, 0, 0, 0, 0, 0, 89, 88, 87, 86, 68, 66, 58, 56,
+    0, 0, 89, 88, 0, 0, 0, 0, 0, 0, 65, 63, 65, 63, 52, 51, 69, 67, 59, 57, 68, 66, 58, 56, 65, 63, 52, 51, 64, 62, 48, 46,
+    0, 82, 0, 0, 36, 34, 35, 33, 36, 35, 34, 33, 15, 14, 14, 13, 36, 34, 35, 33, 29, 27, 28, 26, 32, 31, 31, 30, 12, 10, 11, 9,
+    36, 35, 34, 33, 32, 31, 31, 30, 29, 28, 27, 26, 12, 11, 10, 9, 15, 14, 14, 13, 12, 10, 11, 9, 12, 11, 10, 9, 5, 4, 4, 2,
+    20, 79, 80, 78, 73, 69, 72, 68, 79, 77, 78, 76, 69, 65, 68, 64, 73, 69, 72, 68, 61, 53, 60, 50, 71, 67, 70, 66, 59, 52, 58, 48,
+    79, 77, 78, 76, 71, 67, 70, 66, 77, 75, 76, 74, 67, 63, 66, 62, 69, 65, 68, 64, 59, 52, 58, 48, 67, 63, 66, 62, 57, 51, 56, 46,
+    44, 42, 43, 41, 36, 32, 35, 31, 42, 40, 41, 39, 32, 27, 31, 25, 36, 32, 35, 31, 29, 12, 28, 11, 34, 31, 33, 30, 27, 10, 26, 9,
+    42, 40, 41, 39, 34, 31, 33, 30, 40, 38, 39, 37, 31, 26, 30, 24, 32, 27, 31, 25, 27, 10, 26, 9, 31, 26, 30, 24, 25, 9, 24, 8,
+    73, 71, 72, 70, 61, 59, 60, 58, 69, 67, 68, 66, 53, 52, 50, 48, 61, 59, 60, 58, 55, 50, 54, 49, 59, 57, 58, 56, 50, 48, 49, 47,
+    69, 67, 68, 66, 59, 57, 58, 56, 65, 63, 64, 62, 52, 51, 48, 46, 53, 52, 50, 48, 50, 48, 49, 47, 52, 51, 48, 46, 48, 46, 47, 45,
+    36, 34, 35, 33, 29, 27, 28, 26, 32, 31, 31, 30, 12, 10, 11, 9, 29, 27, 28, 26, 23, 7, 22, 6, 27, 25, 26, 24, 7, 4, 6, 3,
+    32, 31, 31, 30, 27, 25, 26, 24, 27, 26, 25, 24, 10, 9, 9, 8, 12, 10, 11, 9, 7, 4, 6, 3, 10, 9, 9, 8, 4, 2, 3, 1,
+    20, 0, 79, 78, 79, 78, 77, 76, 73, 72, 69, 68, 69, 68, 65, 64, 0, 0, 77, 76, 0, 0, 0, 0, 71, 70, 67, 66, 67, 66, 63, 62,
+    73, 72, 69, 68, 71, 70, 67, 66, 61, 60, 53, 50, 59, 58, 52, 48, 69, 68, 65, 64, 67, 66, 63, 62, 59, 58, 52, 48, 57, 56, 51, 46,
+    0, 0, 0, 0, 69, 68, 67, 66, 61, 60, 59, 58, 53, 50, 52, 48, 0, 0, 0, 0, 0, 0, 0, 0, 59, 58, 57, 56, 52, 48, 51, 46,
+    0, 0, 59, 58, 0, 0, 0, 0, 0, 0, 50, 49, 50, 49, 48, 47, 0, 50, 52, 48, 0, 48, 0, 46, 0, 0, 48, 47, 0, 0, 0, 0,
+    0, 0, 42, 41, 42, 41, 40, 39, 36, 35, 32, 31, 32, 31, 27, 25, 0, 0, 40, 39, 0, 0, 0, 0, 34, 33, 31, 30, 31, 30, 26, 24,
+    36, 35, 32, 31, 34, 33, 31, 30, 29, 28, 12, 11, 27, 26, 10, 9, 32, 31, 27, 25, 31, 30, 26, 24, 27, 26, 10, 9, 25, 24, 9, 8,
+    0, 0, 0, 0, 32, 31, 31, 30, 29, 28, 27, 26, 12, 11, 10, 9, 0, 31, 0, 0, 27, 25, 26, 24, 27, 26, 25, 24, 10, 9, 9, 8,
+    0, 0, 27, 26, 0, 0, 0, 0, 0, 0, 7, 6, 7, 6, 4, 3, 12, 11, 10, 9, 10, 9, 9, 8, 7, 6, 4, 3, 4, 3, 2, 1,
+    0, 20, 20, 15, 20, 15, 18, 12, 20, 18, 15, 12, 15, 12, 12, 5, 20, 15, 18, 12, 18, 12, 17, 7, 19, 14, 14, 10, 14, 10, 11, 4,
+    20, 18, 15, 12, 19, 14, 14, 10, 18, 17, 12, 7, 14, 11, 10, 4, 15, 12, 12, 5, 14, 10, 11, 4, 14, 11, 10, 4, 13, 9, 9, 2,
+    20, 18, 19, 14, 15, 12, 14, 10, 18, 17, 14, 11, 12, 7, 10, 4, 15, 12, 14, 10, 12, 5, 11, 4, 14, 11, 13, 9, 10, 4, 9, 2,
+    18, 17, 14, 11, 14, 11, 13, 9, 17, 16, 11, 6, 11, 6, 9, 3, 12, 7, 10, 4, 10, 4, 9, 2, 11, 6, 9, 3, 9, 3, 8, 1,
+    0, 0, 18, 14, 18, 14, 17, 11, 15, 14, 12, 10, 12, 10, 7, 4, 0, 14, 17, 11, 0, 11, 0, 6, 14, 13, 11, 9, 11, 9, 6, 3,
+    15, 14, 12, 10, 14, 13, 11, 9, 12, 11, 5, 4, 10, 9, 4, 2, 12, 10, 7, 4, 11, 9, 6, 3, 10, 9, 4, 2, 9, 8, 3, 1,
+    0, 14, 0, 0, 12, 10, 11, 9, 12, 11, 10, 9, 5, 4, 4, 2, 12, 10, 11, 9, 7, 4, 6, 3, 10, 9, 9, 8, 4, 2, 3, 1,
+    0, 0, 10, 9, 0, 9, 0, 0, 0, 0, 4, 3, 4, 3, 2, 1, 0, 4, 4, 2, 4, 2, 3, 1, 0, 0, 2, 1, 0, 1, 0, 0
+};
+
+static const char s_Npn4Phases[65536] = {
+    0, 0, 1, 0, 1, 0, 0, 0, 3, 1, 2, 1, 2, 1, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0,
+    3, 1, 2, 1, 0, 0, 1, 0, 4, 1, 4, 1, 5, 1, 2, 1, 2, 1, 3, 0, 1, 0, 0, 0, 5, 1, 2, 1, 0, 0, 1, 0,
+    3, 1, 0, 0, 2, 1, 1, 0, 4, 1, 5, 1, 4, 1, 2, 1, 2, 1, 1, 0, 3, 0, 0, 0, 5, 1, 0, 0, 2, 1, 1, 0,
+    4, 1, 5, 1, 5, 1, 0, 0, 7, 0, 7, 0, 7, 0, 6, 0, 4, 1, 2, 1, 2, 1, 1, 0, 7, 0, 6, 0, 6, 0, 0, 0,
+    7, 3, 5, 4, 5, 4, 3, 3, 6, 3, 5, 3, 5, 3, 3, 3, 5, 4, 3, 3, 3, 3, 1, 1, 7, 2, 5, 2, 5, 2, 2, 1,
+    6, 3, 5, 3, 7, 2, 5, 2, 7, 4, 4, 4, 6, 3, 5, 2, 5, 3, 3, 3, 5, 2, 2, 1, 6, 3, 5, 2, 7, 1, 4, 1,
+    6, 3, 7, 2, 5, 3, 5, 2, 7, 4, 6, 3, 4, 4, 5, 2, 5, 3, 5, 2, 3, 3, 2, 1, 6, 3, 7, 1, 5, 2, 4, 1,
+    7, 4, 6, 3, 6, 3, 7, 1, 7, 6, 7, 5, 7, 5, 6, 3, 4, 4, 5, 2, 5, 2, 4, 1, 7, 5, 6, 3, 6, 3, 7, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    3, 1, 2, 1, 0, 0, 1, 0, 4, 1, 4, 1, 5, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 0,
+    4, 1, 4, 1, 1, 1, 1, 1, 8, 1, 8, 1, 2, 1, 2, 1, 5, 1, 2, 1, 0, 0, 1, 0, 2, 1, 2, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 1, 2, 1, 1, 1, 1, 1, 4, 1, 4, 1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1,
+    8, 4, 8, 4, 5, 2, 5, 2, 9, 4, 8, 4, 5, 3, 5, 2, 5, 2, 5, 2, 1, 1, 1, 1, 4, 2, 4, 2, 2, 1, 2, 1,
+    9, 4, 8, 4, 4, 2, 4, 2, 8, 4, 8, 4, 9, 2, 4, 2, 5, 3, 5, 2, 2, 1, 2, 1, 9, 2, 4, 2, 4, 1, 4, 1,
+    11, 4, 4, 4, 2, 2, 2, 2, 11, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 4, 2, 4, 2, 2, 1, 2, 1,
+    11, 4, 4, 4, 4, 2, 4, 2, 11, 4, 4, 4, 4, 2, 4, 2, 2, 2, 2, 2, 2, 1, 2, 1, 4, 2, 4, 2, 4, 1, 4, 27,
+    2, 1, 3, 0, 1, 0, 0, 0, 5, 1, 2, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    5, 1, 2, 1, 0, 0, 1, 0, 2, 1, 2, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    9, 3, 9, 3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    5, 3, 5, 3, 1, 1, 1, 1, 9, 1, 9, 1, 2, 1, 2, 1, 5, 3, 5, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 30,
+    0, 0, 1, 0, 2, 0, 0, 0, 3, 1, 1, 1, 2, 2, 3, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 30,
+    3, 1, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 28, 2, 2, 3, 0, 0, 0, 0, 30, 1, 1, 1, 28, 0, 28, 24, 30,
+    3, 1, 0, 0, 2, 1, 1, 0, 4, 1, 5, 1, 4, 1, 2, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    4, 1, 1, 1, 4, 1, 1, 1, 8, 1, 2, 1, 8, 1, 2, 1, 5, 1, 0, 0, 2, 1, 1, 0, 2, 1, 1, 1, 2, 1, 1, 1,
+    2, 1, 1, 1, 2, 1, 1, 1, 4, 1, 2, 1, 4, 1, 2, 1, 2, 1, 1, 1, 2, 1, 1, 1, 2, 1, 1, 1, 2, 1, 1, 1,
+    8, 4, 5, 2, 8, 4, 5, 2, 9, 4, 5, 3, 8, 4, 5, 2, 5, 2, 1, 1, 5, 2, 1, 1, 4, 2, 2, 1, 4, 2, 2, 1,
+    11, 4, 2, 2, 4, 4, 2, 2, 11, 4, 2, 2, 4, 4, 2, 2, 2, 2, 1, 1, 2, 2, 1, 1, 4, 2, 2, 1, 4, 2, 2, 1,
+    9, 4, 4, 2, 8, 4, 4, 2, 8, 4, 9, 2, 8, 4, 4, 2, 5, 3, 2, 1, 5, 2, 2, 1, 9, 2, 4, 1, 4, 2, 4, 1,
+    11, 4, 4, 2, 4, 4, 4, 2, 11, 4, 4, 2, 4, 4, 4, 2, 2, 2, 2, 1, 2, 2, 2, 1, 4, 2, 4, 1, 4, 2, 4, 27,
+    2, 1, 1, 0, 3, 0, 0, 0, 5, 1, 0, 0, 2, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 1, 0, 0, 2, 1, 1, 0, 2, 1, 1, 1, 2, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 0,
+    1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    9, 3, 5, 3, 9, 3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 3, 1, 1, 5, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 2, 0, 1, 0, 0, 0, 3, 1, 2, 2, 1, 1, 3, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 30,
+    5, 3, 1, 1, 5, 3, 1, 1, 9, 1, 2, 1, 9, 1, 2, 1, 5, 3, 1, 1, 5, 3, 1, 1, 2, 1, 1, 1, 2, 1, 1, 30,
+    3, 1, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 28, 2, 2, 0, 0, 3, 0, 0, 30, 1, 1, 0, 28, 1, 28, 24, 30,
+    4, 1, 5, 1, 5, 1, 0, 0, 7, 0, 7, 0, 7, 0, 6, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 1, 2, 1, 1, 1, 1, 1, 4, 1, 4, 1, 2, 1, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 1, 1, 1, 2, 1, 1, 1, 4, 1, 2, 1, 4, 1, 2, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 31,
+    13, 3, 6, 3, 6, 3, 6, 3, 13, 3, 6, 3, 6, 3, 6, 3, 0, 0, 1, 0, 1, 0, 0, 0, 3, 1, 2, 1, 2, 1, 3, 0,
+    13, 3, 11, 3, 5, 3, 5, 3, 13, 3, 11, 3, 5, 3, 5, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 27, 3, 0, 3, 29,
+    13, 3, 5, 3, 11, 3, 5, 3, 13, 3, 5, 3, 11, 3, 5, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 27, 3, 29,
+    12, 3, 3, 3, 3, 3, 3, 3, 12, 3, 3, 3, 3, 3, 25, 28, 0, 0, 0, 28, 0, 28, 0, 30, 3, 0, 25, 26, 25, 26, 24, 29,
+    4, 1, 2, 1, 2, 1, 1, 0, 7, 0, 6, 0, 6, 0, 0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 1, 2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    2, 1, 1, 1, 2, 1, 1, 1, 2, 1, 1, 1, 2, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 31, 0, 31, 0, 31, 0, 0, 0, 30, 0, 30, 0, 31,
+    6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 1, 1, 1, 1, 1, 1, 1, 31, 1, 1, 1, 1, 1, 1, 1, 31,
+    10, 2, 4, 2, 2, 2, 2, 2, 4, 2, 4, 2, 5, 2, 2, 31, 0, 0, 1, 30, 0, 0, 0, 31, 1, 1, 1, 30, 0, 30, 26, 30,
+    10, 2, 2, 2, 4, 2, 2, 2, 4, 2, 5, 2, 4, 2, 2, 31, 0, 0, 0, 0, 1, 30, 0, 31, 1, 1, 0, 30, 1, 30, 26, 30,
+    0, 0, 0, 0, 0, 0, 0, 31, 3, 0, 3, 27, 3, 27, 25, 28, 0, 0, 0, 31, 0, 31, 26, 30, 0, 27, 25, 28, 25, 28, 24, 31,
+    7, 3, 5, 4, 5, 4, 3, 3, 6, 3, 5, 3, 5, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    8, 4, 8, 4, 5, 2, 5, 2, 9, 4, 8, 4, 5, 3, 5, 2, 9, 3, 9, 3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 3,
+    8, 4, 5, 2, 8, 4, 5, 2, 9, 4, 5, 3, 8, 4, 5, 2, 9, 3, 5, 3, 9, 3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 3,
+    13, 3, 6, 3, 6, 3, 6, 3, 13, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3,
+    12, 3, 9, 3, 9, 3, 3, 3, 12, 3, 9, 3, 9, 3, 3, 3, 6, 3, 5, 3, 5, 3, 3, 3, 6, 3, 5, 3, 5, 3, 3, 3,
+    13, 5, 9, 8, 6, 3, 5, 3, 10, 5, 9, 5, 6, 3, 5, 3, 10, 5, 9, 5, 6, 3, 5, 3, 6, 5, 5, 5, 6, 3, 5, 3,
+    13, 5, 6, 3, 9, 8, 5, 3, 10, 5, 6, 3, 9, 5, 5, 3, 10, 5, 6, 3, 9, 5, 5, 3, 6, 5, 6, 3, 5, 5, 5, 3,
+    13, 6, 11, 5, 11, 5, 6, 3, 13, 6, 6, 5, 6, 5, 6, 3, 6, 6, 6, 5, 6, 5, 6, 3, 6, 6, 6, 5, 6, 5, 6, 25,
+    5, 4, 3, 3, 3, 3, 1, 1, 7, 2, 5, 2, 5, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 2, 5, 2, 1, 1, 1, 1, 4, 2, 4, 2, 2, 1, 2, 1, 5, 3, 5, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    5, 2, 1, 1, 5, 2, 1, 1, 4, 2, 2, 1, 4, 2, 2, 1, 5, 3, 1, 1, 5, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 1, 0, 1, 0, 0, 0, 3, 1, 2, 1, 2, 1, 3, 0, 1, 1, 1, 1, 1, 1, 1, 31, 1, 1, 1, 1, 1, 1, 1, 31,
+    6, 3, 5, 3, 5, 3, 3, 3, 6, 3, 5, 3, 5, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    9, 4, 9, 4, 2, 2, 2, 2, 9, 4, 9, 4, 2, 2, 2, 2, 4, 1, 4, 1, 1, 1, 1, 1, 2, 1, 2, 27, 2, 1, 2, 29,
+    9, 4, 2, 2, 9, 4, 2, 2, 9, 4, 2, 2, 9, 4, 2, 2, 4, 1, 1, 1, 4, 1, 1, 1, 2, 1, 2, 1, 2, 27, 2, 29,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 25, 28, 1, 1, 1, 29, 1, 29, 1, 30, 2, 1, 24, 26, 24, 26, 24, 28,
+    6, 3, 5, 3, 7, 2, 5, 2, 7, 4, 4, 4, 6, 3, 5, 2, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 4, 8, 4, 4, 2, 4, 2, 8, 4, 8, 4, 9, 2, 4, 2, 5, 3, 5, 3, 1, 1, 1, 1, 9, 1, 9, 1, 2, 1, 2, 1,
+    11, 4, 2, 2, 4, 4, 2, 2, 11, 4, 2, 2, 4, 4, 2, 2, 0, 0, 2, 0, 1, 0, 0, 0, 3, 1, 2, 2, 1, 1, 3, 0,
+    13, 3, 11, 3, 5, 3, 5, 3, 13, 3, 11, 3, 5, 3, 5, 3, 10, 2, 4, 2, 2, 2, 2, 2, 4, 2, 4, 2, 5, 2, 2, 31,
+    13, 5, 9, 8, 6, 3, 5, 3, 10, 5, 9, 5, 6, 3, 5, 3, 9, 4, 9, 4, 2, 2, 2, 2, 9, 4, 9, 4, 2, 2, 2, 2,
+    8, 8, 8, 8, 9, 2, 9, 2, 9, 8, 8, 8, 9, 3, 9, 2, 9, 8, 9, 8, 4, 2, 4, 2, 9, 4, 9, 4, 4, 2, 4, 27,
+    13, 3, 11, 3, 11, 3, 3, 3, 13, 3, 11, 3, 11, 3, 3, 3, 11, 3, 5, 4, 3, 3, 3, 3, 5, 3, 5, 3, 3, 3, 3, 29,
+    13, 5, 11, 5, 10, 3, 5, 3, 13, 5, 11, 5, 10, 3, 5, 26, 10, 4, 10, 4, 5, 2, 5, 29, 11, 4, 4, 26, 5, 25, 24, 26,
+    5, 3, 3, 3, 5, 2, 2, 1, 6, 3, 5, 2, 7, 1, 4, 1, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 3, 5, 2, 2, 1, 2, 1, 9, 2, 4, 2, 4, 1, 4, 1, 5, 3, 5, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 30,
+    2, 2, 1, 1, 2, 2, 1, 1, 4, 2, 2, 1, 4, 2, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 30,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 27, 3, 0, 3, 29, 0, 0, 1, 30, 0, 0, 0, 31, 1, 1, 1, 30, 0, 30, 26, 30,
+    10, 5, 9, 5, 6, 3, 5, 3, 6, 5, 5, 5, 6, 3, 5, 3, 4, 1, 4, 1, 1, 1, 1, 1, 2, 1, 2, 27, 2, 1, 2, 29,
+    9, 8, 9, 8, 4, 2, 4, 2, 9, 4, 9, 4, 4, 2, 4, 27, 4, 4, 4, 30, 1, 1, 1, 31, 8, 1, 23, 23, 2, 1, 22, 29,
+    11, 3, 3, 3, 5, 4, 3, 3, 5, 3, 3, 3, 5, 3, 3, 29, 1, 1, 1, 1, 1, 1, 1, 31, 2, 1, 2, 27, 2, 27, 26, 29,
+    2, 2, 2, 2, 3, 2, 3, 31, 3, 2, 22, 23, 3, 27, 22, 28, 1, 1, 1, 30, 1, 29, 25, 30, 2, 24, 23, 26, 24, 26, 24, 29,
+    6, 3, 7, 2, 5, 3, 5, 2, 7, 4, 6, 3, 4, 4, 5, 2, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 4, 4, 4, 2, 2, 2, 2, 11, 4, 4, 4, 2, 2, 2, 2, 0, 0, 1, 0, 2, 0, 0, 0, 3, 1, 1, 1, 2, 2, 3, 0,
+    9, 4, 4, 2, 8, 4, 4, 2, 8, 4, 9, 2, 8, 4, 4, 2, 5, 3, 1, 1, 5, 3, 1, 1, 9, 1, 2, 1, 9, 1, 2, 1,
+    13, 3, 5, 3, 11, 3, 5, 3, 13, 3, 5, 3, 11, 3, 5, 3, 10, 2, 2, 2, 4, 2, 2, 2, 4, 2, 5, 2, 4, 2, 2, 31,
+    13, 5, 6, 3, 9, 8, 5, 3, 10, 5, 6, 3, 9, 5, 5, 3, 9, 4, 2, 2, 9, 4, 2, 2, 9, 4, 2, 2, 9, 4, 2, 2,
+    13, 3, 11, 3, 11, 3, 3, 3, 13, 3, 11, 3, 11, 3, 3, 3, 11, 3, 3, 3, 5, 4, 3, 3, 5, 3, 3, 3, 5, 3, 3, 29,
+    8, 8, 9, 2, 8, 8, 9, 2, 9, 8, 9, 3, 8, 8, 9, 2, 9, 8, 4, 2, 9, 8, 4, 2, 9, 4, 4, 2, 9, 4, 4, 27,
+    13, 5, 10, 3, 11, 5, 5, 3, 13, 5, 10, 3, 11, 5, 5, 26, 10, 4, 5, 2, 10, 4, 5, 29, 11, 4, 5, 25, 4, 26, 24, 26,
+    5, 3, 5, 2, 3, 3, 2, 1, 6, 3, 7, 1, 5, 2, 4, 1, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 1, 1, 1, 1, 4, 2, 4, 2, 2, 1, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 30,
+    5, 3, 2, 1, 5, 2, 2, 1, 9, 2, 4, 1, 4, 2, 4, 1, 5, 3, 1, 1, 5, 3, 1, 1, 2, 1, 1, 1, 2, 1, 1, 30,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 27, 3, 29, 0, 0, 0, 0, 1, 30, 0, 31, 1, 1, 0, 30, 1, 30, 26, 30,
+    10, 5, 6, 3, 9, 5, 5, 3, 6, 5, 6, 3, 5, 5, 5, 3, 4, 1, 1, 1, 4, 1, 1, 1, 2, 1, 2, 1, 2, 27, 2, 29,
+    11, 3, 5, 4, 3, 3, 3, 3, 5, 3, 5, 3, 3, 3, 3, 29, 1, 1, 1, 1, 1, 1, 1, 31, 2, 1, 2, 27, 2, 27, 26, 29,
+    9, 8, 4, 2, 9, 8, 4, 2, 9, 4, 4, 2, 9, 4, 4, 27, 4, 4, 1, 1, 4, 30, 1, 31, 8, 1, 2, 1, 23, 23, 22, 29,
+    2, 2, 3, 2, 2, 2, 3, 31, 3, 2, 3, 27, 22, 23, 22, 28, 1, 1, 1, 29, 1, 30, 25, 30, 2, 24, 24, 26, 23, 26, 24, 29,
+    7, 4, 6, 3, 6, 3, 7, 1, 7, 6, 7, 5, 7, 5, 6, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 4, 4, 4, 4, 2, 4, 2, 11, 4, 4, 4, 4, 2, 4, 2, 3, 1, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 28,
+    11, 4, 4, 2, 4, 4, 4, 2, 11, 4, 4, 2, 4, 4, 4, 2, 3, 1, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 28,
+    12, 3, 3, 3, 3, 3, 3, 3, 12, 3, 3, 3, 3, 3, 25, 28, 0, 0, 0, 0, 0, 0, 0, 31, 3, 0, 3, 27, 3, 27, 25, 28,
+    13, 6, 11, 5, 11, 5, 6, 3, 13, 6, 6, 5, 6, 5, 6, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 25, 28,
+    13, 5, 11, 5, 10, 3, 5, 3, 13, 5, 11, 5, 10, 3, 5, 26, 2, 2, 2, 2, 3, 2, 3, 31, 3, 2, 22, 23, 3, 27, 22, 28,
+    13, 5, 10, 3, 11, 5, 5, 3, 13, 5, 10, 3, 11, 5, 5, 26, 2, 2, 3, 2, 2, 2, 3, 31, 3, 2, 3, 27, 22, 23, 22, 28,
+    12, 3, 12, 3, 12, 3, 3, 3, 12, 3, 22, 23, 22, 23, 22, 28, 3, 3, 3, 28, 3, 28, 25, 30, 3, 24, 22, 26, 22, 26, 24, 28,
+    4, 4, 5, 2, 5, 2, 4, 1, 7, 5, 6, 3, 6, 3, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    2, 2, 2, 2, 2, 1, 2, 1, 4, 2, 4, 2, 4, 1, 4, 27, 2, 2, 3, 0, 0, 0, 0, 30, 1, 1, 1, 28, 0, 28, 24, 30,
+    2, 2, 2, 1, 2, 2, 2, 1, 4, 2, 4, 1, 4, 2, 4, 27, 2, 2, 0, 0, 3, 0, 0, 30, 1, 1, 0, 28, 1, 28, 24, 30,
+    0, 0, 0, 28, 0, 28, 0, 30, 3, 0, 25, 26, 25, 26, 24, 29, 0, 0, 0, 31, 0, 31, 26, 30, 0, 27, 25, 28, 25, 28, 24, 31,
+    6, 6, 6, 5, 6, 5, 6, 3, 6, 6, 6, 5, 6, 5, 6, 25, 1, 1, 1, 29, 1, 29, 1, 30, 2, 1, 24, 26, 24, 26, 24, 28,
+    10, 4, 10, 4, 5, 2, 5, 29, 11, 4, 4, 26, 5, 25, 24, 26, 1, 1, 1, 30, 1, 29, 25, 30, 2, 24, 23, 26, 24, 26, 24, 29,
+    10, 4, 5, 2, 10, 4, 5, 29, 11, 4, 5, 25, 4, 26, 24, 26, 1, 1, 1, 29, 1, 30, 25, 30, 2, 24, 24, 26, 23, 26, 24, 29,
+    3, 3, 3, 28, 3, 28, 25, 30, 3, 24, 22, 26, 22, 26, 24, 28, 0, 27, 25, 30, 25, 30, 25, 30, 24, 24, 22, 26, 22, 26, 24, 28,
+    3, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    4, 1, 5, 1, 1, 1, 0, 0, 2, 1, 2, 1, 1, 1, 1, 1, 4, 1, 2, 1, 1, 1, 1, 0, 2, 1, 2, 1, 1, 1, 1, 1,
+    4, 1, 1, 1, 5, 1, 0, 0, 2, 1, 1, 1, 2, 1, 1, 1, 4, 1, 1, 1, 2, 1, 1, 0, 2, 1, 1, 1, 2, 1, 1, 1,
+    8, 1, 2, 1, 2, 1, 1, 1, 4, 1, 2, 1, 2, 1, 1, 1, 8, 1, 2, 1, 2, 1, 1, 1, 4, 1, 2, 1, 2, 1, 1, 1,
+    8, 4, 5, 2, 5, 2, 1, 1, 11, 4, 2, 2, 2, 2, 1, 1, 8, 4, 5, 2, 5, 2, 1, 1, 4, 4, 2, 2, 2, 2, 1, 1,
+    9, 4, 5, 3, 4, 2, 2, 1, 11, 4, 2, 2, 4, 2, 2, 1, 8, 4, 5, 2, 4, 2, 2, 1, 4, 4, 2, 2, 4, 2, 2, 1,
+    9, 4, 4, 2, 5, 3, 2, 1, 11, 4, 4, 2, 2, 2, 2, 1, 8, 4, 4, 2, 5, 2, 2, 1, 4, 4, 4, 2, 2, 2, 2, 1,
+    8, 4, 9, 2, 9, 2, 4, 1, 11, 4, 4, 2, 4, 2, 4, 1, 8, 4, 4, 2, 4, 2, 4, 1, 4, 4, 4, 2, 4, 2, 4, 27,
+    2, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 3, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    5, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 2, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    5, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 1, 1, 0, 1, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0,
+    2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    9, 3, 5, 3, 5, 3, 1, 1, 0, 0, 2, 0, 2, 0, 0, 0, 9, 3, 5, 3, 5, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    5, 3, 5, 3, 1, 1, 1, 1, 3, 1, 2, 2, 0, 0, 0, 0, 5, 3, 5, 3, 1, 1, 1, 1, 1, 1, 3, 0, 1, 0, 0, 30,
+    5, 3, 1, 1, 5, 3, 1, 1, 3, 1, 0, 0, 2, 2, 0, 0, 5, 3, 1, 1, 5, 3, 1, 1, 1, 1, 1, 0, 3, 0, 0, 30,
+    9, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 28, 9, 1, 2, 1, 2, 1, 1, 30, 1, 1, 1, 28, 1, 28, 24, 30,
+    4, 1, 5, 1, 1, 1, 0, 0, 2, 1, 2, 1, 1, 1, 1, 1, 5, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    7, 0, 7, 0, 0, 0, 0, 0, 4, 1, 4, 1, 0, 0, 0, 0, 7, 0, 6, 0, 0, 0, 0, 0, 2, 1, 2, 1, 0, 0, 0, 0,
+    2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    4, 1, 2, 1, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 4, 1, 2, 1, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 31,
+    13, 3, 6, 3, 0, 0, 1, 0, 13, 3, 11, 3, 0, 0, 0, 0, 6, 3, 6, 3, 1, 0, 0, 0, 5, 3, 5, 3, 0, 0, 0, 0,
+    13, 3, 6, 3, 3, 1, 2, 1, 13, 3, 11, 3, 3, 0, 3, 27, 6, 3, 6, 3, 2, 1, 3, 0, 5, 3, 5, 3, 3, 0, 3, 29,
+    13, 3, 5, 3, 0, 0, 0, 0, 12, 3, 3, 3, 0, 0, 0, 28, 11, 3, 5, 3, 0, 0, 0, 0, 3, 3, 3, 3, 0, 28, 0, 30,
+    13, 3, 5, 3, 3, 0, 3, 0, 12, 3, 3, 3, 3, 0, 25, 26, 11, 3, 5, 3, 3, 27, 3, 29, 3, 3, 25, 28, 25, 26, 24, 29,
+    4, 1, 2, 1, 1, 1, 1, 0, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    7, 0, 6, 0, 0, 0, 0, 0, 2, 1, 2, 1, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 31,
+    2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 31, 0, 31, 0, 31,
+    2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 2, 1, 1, 1, 0, 0, 0, 31, 0, 0, 0, 31, 0, 30, 0, 31,
+    6, 3, 6, 3, 1, 1, 1, 1, 10, 2, 4, 2, 0, 0, 1, 30, 6, 3, 6, 3, 1, 1, 1, 31, 2, 2, 2, 2, 0, 0, 0, 31,
+    6, 3, 6, 3, 1, 1, 1, 1, 4, 2, 4, 2, 1, 1, 1, 30, 6, 3, 6, 3, 1, 1, 1, 31, 5, 2, 2, 31, 0, 30, 26, 30,
+    10, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 4, 2, 2, 2, 1, 30, 0, 31, 0, 0, 0, 31, 0, 31, 26, 30,
+    4, 2, 5, 2, 1, 1, 0, 30, 3, 0, 3, 27, 0, 27, 25, 28, 4, 2, 2, 31, 1, 30, 26, 30, 3, 27, 25, 28, 25, 28, 24, 31,
+    4, 1, 1, 1, 5, 1, 0, 0, 2, 1, 1, 1, 2, 1, 1, 1, 5, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0,
+    2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    7, 0, 0, 0, 7, 0, 0, 0, 4, 1, 0, 0, 4, 1, 0, 0, 7, 0, 0, 0, 6, 0, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0,
+    4, 1, 0, 0, 2, 1, 0, 0, 3, 0, 0, 0, 3, 0, 0, 0, 4, 1, 0, 0, 2, 1, 0, 0, 3, 0, 0, 0, 3, 0, 0, 31,
+    13, 3, 0, 0, 6, 3, 1, 0, 13, 3, 0, 0, 11, 3, 0, 0, 6, 3, 1, 0, 6, 3, 0, 0, 5, 3, 0, 0, 5, 3, 0, 0,
+    13, 3, 0, 0, 5, 3, 0, 0, 12, 3, 0, 0, 3, 3, 0, 28, 11, 3, 0, 0, 5, 3, 0, 0, 3, 3, 0, 28, 3, 3, 0, 30,
+    13, 3, 3, 1, 6, 3, 2, 1, 13, 3, 3, 0, 11, 3, 3, 27, 6, 3, 2, 1, 6, 3, 3, 0, 5, 3, 3, 0, 5, 3, 3, 29,
+    13, 3, 3, 0, 5, 3, 3, 0, 12, 3, 3, 0, 3, 3, 25, 26, 11, 3, 3, 27, 5, 3, 3, 29, 3, 3, 25, 26, 25, 28, 24, 29,
+    4, 1, 1, 1, 2, 1, 1, 0, 2, 1, 1, 1, 2, 1, 1, 1, 2, 1, 1, 0, 1, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0,
+    2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 31, 0, 31, 0, 31,
+    7, 0, 0, 0, 6, 0, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 31,
+    2, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 2, 1, 0, 0, 1, 1, 0, 31, 0, 0, 0, 30, 0, 31, 0, 31,
+    6, 3, 1, 1, 6, 3, 1, 1, 10, 2, 0, 0, 4, 2, 1, 30, 6, 3, 1, 1, 6, 3, 1, 31, 2, 2, 0, 0, 2, 2, 0, 31,
+    10, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 4, 2, 1, 30, 2, 2, 0, 31, 0, 0, 0, 31, 0, 31, 26, 30,
+    6, 3, 1, 1, 6, 3, 1, 1, 4, 2, 1, 1, 4, 2, 1, 30, 6, 3, 1, 1, 6, 3, 1, 31, 5, 2, 0, 30, 2, 31, 26, 30,
+    4, 2, 1, 1, 5, 2, 0, 30, 3, 0, 0, 27, 3, 27, 25, 28, 4, 2, 1, 30, 2, 31, 26, 30, 3, 27, 25, 28, 25, 28, 24, 31,
+    8, 1, 2, 1, 2, 1, 1, 1, 4, 1, 2, 1, 2, 1, 1, 1, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 1, 2, 1, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30,
+    4, 1, 0, 0, 2, 1, 0, 0, 3, 0, 0, 0, 3, 0, 0, 0, 2, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 3, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 30, 0, 30, 0, 31,
+    15, 0, 12, 0, 12, 0, 0, 0, 15, 0, 12, 0, 12, 0, 0, 29, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    15, 0, 12, 0, 0, 0, 0, 0, 15, 0, 12, 23, 0, 0, 26, 29, 12, 0, 0, 29, 0, 0, 0, 31, 0, 0, 26, 29, 0, 30, 26, 30,
+    15, 0, 0, 0, 12, 0, 0, 0, 15, 0, 0, 0, 12, 23, 26, 29, 12, 0, 0, 0, 0, 29, 0, 31, 0, 0, 0, 30, 26, 29, 26, 30,
+    15, 0, 0, 0, 0, 0, 0, 30, 15, 0, 23, 27, 23, 27, 25, 28, 12, 23, 26, 29, 26, 29, 26, 30, 23, 27, 25, 28, 25, 28, 24, 30,
+    8, 1, 2, 1, 2, 1, 1, 1, 4, 1, 2, 1, 2, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    4, 1, 2, 1, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 31, 2, 1, 1, 1, 0, 0, 0, 31, 0, 0, 0, 31, 0, 30, 0, 31,
+    4, 1, 0, 0, 2, 1, 0, 0, 3, 0, 0, 0, 3, 0, 0, 31, 2, 1, 0, 0, 1, 1, 0, 31, 0, 0, 0, 30, 0, 31, 0, 31,
+    3, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 30, 0, 30, 0, 31, 3, 0, 0, 31, 0, 31, 0, 31, 0, 30, 0, 31, 0, 31, 0, 31,
+    15, 23, 13, 29, 13, 29, 11, 30, 14, 27, 12, 29, 12, 29, 0, 31, 13, 29, 11, 30, 11, 30, 0, 31, 0, 30, 0, 30, 0, 30, 28, 31,
+    14, 27, 12, 29, 0, 30, 0, 30, 12, 29, 23, 29, 0, 30, 23, 31, 12, 29, 0, 31, 0, 30, 28, 31, 0, 30, 23, 31, 23, 30, 26, 31,
+    14, 27, 0, 30, 12, 29, 0, 30, 12, 29, 0, 30, 23, 29, 23, 31, 12, 29, 0, 30, 0, 31, 28, 31, 0, 30, 23, 30, 23, 31, 26, 31,
+    12, 29, 0, 30, 0, 30, 23, 30, 0, 30, 23, 30, 23, 30, 25, 31, 23, 29, 23, 31, 23, 31, 26, 31, 23, 30, 25, 31, 25, 31, 24, 31,
+    8, 4, 5, 2, 5, 2, 1, 1, 11, 4, 2, 2, 2, 2, 1, 1, 9, 3, 5, 3, 5, 3, 1, 1, 0, 0, 2, 0, 2, 0, 0, 0,
+    13, 3, 6, 3, 0, 0, 1, 0, 13, 3, 11, 3, 0, 0, 0, 0, 6, 3, 6, 3, 1, 1, 1, 1, 10, 2, 4, 2, 0, 0, 1, 30,
+    13, 3, 0, 0, 6, 3, 1, 0, 13, 3, 0, 0, 11, 3, 0, 0, 6, 3, 1, 1, 6, 3, 1, 1, 10, 2, 0, 0, 4, 2, 1, 30,
+    15, 0, 12, 0, 12, 0, 0, 0, 15, 0, 12, 0, 12, 0, 0, 29, 15, 23, 13, 29, 13, 29, 11, 30, 14, 27, 12, 29, 12, 29, 0, 31,
+    15, 4, 11, 4, 11, 4, 1, 1, 14, 9, 11, 9, 11, 9, 19, 28, 15, 4, 11, 4, 11, 4, 1, 1, 14, 4, 10, 4, 10, 4, 25, 28,
+    14, 9, 11, 4, 13, 1, 2, 1, 14, 9, 11, 9, 12, 9, 21, 26, 15, 4, 11, 4, 13, 1, 2, 28, 12, 9, 10, 27, 13, 1, 25, 27,
+    14, 9, 13, 1, 11, 4, 2, 1, 14, 9, 12, 9, 11, 9, 21, 26, 15, 4, 13, 1, 11, 4, 2, 28, 12, 9, 13, 1, 10, 27, 25, 27,
+    15, 10, 12, 9, 12, 9, 11, 0, 15, 10, 12, 24, 12, 24, 25, 25, 15, 23, 13, 27, 13, 27, 26, 27, 14, 27, 24, 26, 24, 26, 24, 25,
+    8, 4, 5, 2, 5, 2, 1, 1, 4, 4, 2, 2, 2, 2, 1, 1, 9, 3, 5, 3, 5, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    6, 3, 6, 3, 1, 0, 0, 0, 5, 3, 5, 3, 0, 0, 0, 0, 6, 3, 6, 3, 1, 1, 1, 31, 2, 2, 2, 2, 0, 0, 0, 31,
+    6, 3, 1, 0, 6, 3, 0, 0, 5, 3, 0, 0, 5, 3, 0, 0, 6, 3, 1, 1, 6, 3, 1, 31, 2, 2, 0, 0, 2, 2, 0, 31,
+    12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 13, 29, 11, 30, 11, 30, 0, 31, 0, 30, 0, 30, 0, 30, 28, 31,
+    15, 4, 11, 4, 11, 4, 1, 1, 14, 4, 10, 4, 10, 4, 25, 28, 13, 4, 7, 4, 7, 4, 1, 31, 4, 4, 4, 4, 4, 4, 28, 31,
+    13, 4, 11, 4, 1, 1, 1, 1, 10, 4, 10, 4, 1, 1, 22, 28, 7, 4, 7, 30, 1, 30, 1, 31, 4, 4, 4, 29, 1, 31, 26, 30,
+    13, 4, 1, 1, 11, 4, 1, 1, 10, 4, 1, 1, 10, 4, 22, 28, 7, 4, 1, 30, 7, 30, 1, 31, 4, 4, 1, 31, 4, 29, 26, 30,
+    14, 0, 13, 0, 13, 0, 0, 31, 15, 24, 21, 27, 21, 27, 25, 28, 13, 23, 23, 29, 23, 29, 26, 30, 23, 27, 25, 28, 25, 28, 24, 31,
+    9, 4, 5, 3, 4, 2, 2, 1, 11, 4, 2, 2, 4, 2, 2, 1, 5, 3, 5, 3, 1, 1, 1, 1, 3, 1, 2, 2, 0, 0, 0, 0,
+    13, 3, 6, 3, 3, 1, 2, 1, 13, 3, 11, 3, 3, 0, 3, 27, 6, 3, 6, 3, 1, 1, 1, 1, 4, 2, 4, 2, 1, 1, 1, 30,
+    13, 3, 0, 0, 5, 3, 0, 0, 12, 3, 0, 0, 3, 3, 0, 28, 10, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    15, 0, 12, 0, 0, 0, 0, 0, 15, 0, 12, 23, 0, 0, 26, 29, 14, 27, 12, 29, 0, 30, 0, 30, 12, 29, 23, 29, 0, 30, 23, 31,
+    14, 9, 11, 4, 13, 1, 2, 1, 14, 9, 11, 9, 12, 9, 21, 26, 13, 4, 11, 4, 1, 1, 1, 1, 10, 4, 10, 4, 1, 1, 22, 28,
+    14, 4, 11, 4, 4, 1, 4, 1, 14, 9, 11, 23, 15, 1, 22, 23, 13, 4, 11, 4, 2, 1, 2, 29, 10, 4, 23, 27, 2, 29, 22, 27,
+    15, 9, 12, 9, 12, 9, 1, 1, 15, 9, 12, 22, 12, 22, 21, 28, 14, 9, 12, 9, 13, 28, 26, 31, 12, 9, 22, 27, 21, 27, 25, 29,
+    15, 9, 12, 9, 15, 1, 2, 29, 15, 24, 22, 23, 21, 24, 22, 26, 14, 23, 26, 29, 23, 27, 26, 29, 24, 27, 25, 28, 24, 26, 24, 27,
+    8, 4, 5, 2, 4, 2, 2, 1, 4, 4, 2, 2, 4, 2, 2, 1, 5, 3, 5, 3, 1, 1, 1, 1, 1, 1, 3, 0, 1, 0, 0, 30,
+    6, 3, 6, 3, 2, 1, 3, 0, 5, 3, 5, 3, 3, 0, 3, 29, 6, 3, 6, 3, 1, 1, 1, 31, 5, 2, 2, 31, 0, 30, 26, 30,
+    11, 3, 0, 0, 5, 3, 0, 0, 3, 3, 0, 28, 3, 3, 0, 30, 4, 2, 1, 30, 2, 2, 0, 31, 0, 0, 0, 31, 0, 31, 26, 30,
+    12, 0, 0, 29, 0, 0, 0, 31, 0, 0, 26, 29, 0, 30, 26, 30, 12, 29, 0, 31, 0, 30, 28, 31, 0, 30, 23, 31, 23, 30, 26, 31,
+    15, 4, 11, 4, 13, 1, 2, 28, 12, 9, 10, 27, 13, 1, 25, 27, 7, 4, 7, 30, 1, 30, 1, 31, 4, 4, 4, 29, 1, 31, 26, 30,
+    13, 4, 11, 4, 2, 1, 2, 29, 10, 4, 23, 27, 2, 29, 22, 27, 7, 4, 7, 31, 1, 30, 28, 31, 4, 30, 23, 31, 19, 30, 22, 30,
+    14, 9, 13, 28, 12, 9, 26, 31, 12, 9, 21, 27, 22, 27, 25, 29, 13, 29, 11, 31, 11, 31, 28, 31, 0, 30, 22, 29, 22, 29, 26, 30,
+    14, 27, 28, 29, 0, 30, 28, 30, 24, 24, 23, 23, 21, 27, 22, 29, 23, 29, 26, 31, 23, 30, 26, 31, 23, 27, 23, 28, 24, 28, 24, 30,
+    9, 4, 4, 2, 5, 3, 2, 1, 11, 4, 4, 2, 2, 2, 2, 1, 5, 3, 1, 1, 5, 3, 1, 1, 3, 1, 0, 0, 2, 2, 0, 0,
+    13, 3, 5, 3, 0, 0, 0, 0, 12, 3, 3, 3, 0, 0, 0, 28, 10, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    13, 3, 3, 1, 6, 3, 2, 1, 13, 3, 3, 0, 11, 3, 3, 27, 6, 3, 1, 1, 6, 3, 1, 1, 4, 2, 1, 1, 4, 2, 1, 30,
+    15, 0, 0, 0, 12, 0, 0, 0, 15, 0, 0, 0, 12, 23, 26, 29, 14, 27, 0, 30, 12, 29, 0, 30, 12, 29, 0, 30, 23, 29, 23, 31,
+    14, 9, 13, 1, 11, 4, 2, 1, 14, 9, 12, 9, 11, 9, 21, 26, 13, 4, 1, 1, 11, 4, 1, 1, 10, 4, 1, 1, 10, 4, 22, 28,
+    15, 9, 12, 9, 12, 9, 1, 1, 15, 9, 12, 22, 12, 22, 21, 28, 14, 9, 13, 28, 12, 9, 26, 31, 12, 9, 21, 27, 22, 27, 25, 29,
+    14, 4, 4, 1, 11, 4, 4, 1, 14, 9, 15, 1, 11, 23, 22, 23, 13, 4, 2, 1, 11, 4, 2, 29, 10, 4, 2, 29, 23, 27, 22, 27,
+    15, 9, 15, 1, 12, 9, 2, 29, 15, 24, 21, 24, 22, 23, 22, 26, 14, 23, 23, 27, 26, 29, 26, 29, 24, 27, 24, 26, 25, 28, 24, 27,
+    8, 4, 4, 2, 5, 2, 2, 1, 4, 4, 4, 2, 2, 2, 2, 1, 5, 3, 1, 1, 5, 3, 1, 1, 1, 1, 1, 0, 3, 0, 0, 30,
+    11, 3, 5, 3, 0, 0, 0, 0, 3, 3, 3, 3, 0, 28, 0, 30, 4, 2, 2, 2, 1, 30, 0, 31, 0, 0, 0, 31, 0, 31, 26, 30,
+    6, 3, 2, 1, 6, 3, 3, 0, 5, 3, 3, 0, 5, 3, 3, 29, 6, 3, 1, 1, 6, 3, 1, 31, 5, 2, 0, 30, 2, 31, 26, 30,
+    12, 0, 0, 0, 0, 29, 0, 31, 0, 0, 0, 30, 26, 29, 26, 30, 12, 29, 0, 30, 0, 31, 28, 31, 0, 30, 23, 30, 23, 31, 26, 31,
+    15, 4, 13, 1, 11, 4, 2, 28, 12, 9, 13, 1, 10, 27, 25, 27, 7, 4, 1, 30, 7, 30, 1, 31, 4, 4, 1, 31, 4, 29, 26, 30,
+    14, 9, 12, 9, 13, 28, 26, 31, 12, 9, 22, 27, 21, 27, 25, 29, 13, 29, 11, 31, 11, 31, 28, 31, 0, 30, 22, 29, 22, 29, 26, 30,
+    13, 4, 2, 1, 11, 4, 2, 29, 10, 4, 2, 29, 23, 27, 22, 27, 7, 4, 1, 30, 7, 31, 28, 31, 4, 30, 19, 30, 23, 31, 22, 30,
+    14, 27, 0, 30, 28, 29, 28, 30, 24, 24, 21, 27, 23, 23, 22, 29, 23, 29, 23, 30, 26, 31, 26, 31, 23, 27, 24, 28, 23, 28, 24, 30,
+    8, 4, 9, 2, 9, 2, 4, 1, 11, 4, 4, 2, 4, 2, 4, 1, 9, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 28,
+    13, 3, 5, 3, 3, 0, 3, 0, 12, 3, 3, 3, 3, 0, 25, 26, 4, 2, 5, 2, 1, 1, 0, 30, 3, 0, 3, 27, 0, 27, 25, 28,
+    13, 3, 3, 0, 5, 3, 3, 0, 12, 3, 3, 0, 3, 3, 25, 26, 4, 2, 1, 1, 5, 2, 0, 30, 3, 0, 0, 27, 3, 27, 25, 28,
+    15, 0, 0, 0, 0, 0, 0, 30, 15, 0, 23, 27, 23, 27, 25, 28, 12, 29, 0, 30, 0, 30, 23, 30, 0, 30, 23, 30, 23, 30, 25, 31,
+    15, 10, 12, 9, 12, 9, 11, 0, 15, 10, 12, 24, 12, 24, 25, 25, 14, 0, 13, 0, 13, 0, 0, 31, 15, 24, 21, 27, 21, 27, 25, 28,
+    15, 9, 12, 9, 15, 1, 2, 29, 15, 24, 22, 23, 21, 24, 22, 26, 14, 27, 28, 29, 0, 30, 28, 30, 24, 24, 23, 23, 21, 27, 22, 29,
+    15, 9, 15, 1, 12, 9, 2, 29, 15, 24, 21, 24, 22, 23, 22, 26, 14, 27, 0, 30, 28, 29, 28, 30, 24, 24, 21, 27, 23, 23, 22, 29,
+    15, 0, 15, 27, 15, 27, 23, 30, 15, 24, 22, 23, 22, 23, 22, 28, 23, 23, 26, 29, 26, 29, 26, 30, 24, 27, 22, 28, 22, 28, 24, 28,
+    8, 4, 4, 2, 4, 2, 4, 1, 4, 4, 4, 2, 4, 2, 4, 27, 9, 1, 2, 1, 2, 1, 1, 30, 1, 1, 1, 28, 1, 28, 24, 30,
+    11, 3, 5, 3, 3, 27, 3, 29, 3, 3, 25, 28, 25, 26, 24, 29, 4, 2, 2, 31, 1, 30, 26, 30, 3, 27, 25, 28, 25, 28, 24, 31,
+    11, 3, 3, 27, 5, 3, 3, 29, 3, 3, 25, 26, 25, 28, 24, 29, 4, 2, 1, 30, 2, 31, 26, 30, 3, 27, 25, 28, 25, 28, 24, 31,
+    12, 23, 26, 29, 26, 29, 26, 30, 23, 27, 25, 28, 25, 28, 24, 30, 23, 29, 23, 31, 23, 31, 26, 31, 23, 30, 25, 31, 25, 31, 24, 31,
+    15, 23, 13, 27, 13, 27, 26, 27, 14, 27, 24, 26, 24, 26, 24, 25, 13, 23, 23, 29, 23, 29, 26, 30, 23, 27, 25, 28, 25, 28, 24, 31,
+    14, 23, 26, 29, 23, 27, 26, 29, 24, 27, 25, 28, 24, 26, 24, 27, 23, 29, 26, 31, 23, 30, 26, 31, 23, 27, 23, 28, 24, 28, 24, 30,
+    14, 23, 23, 27, 26, 29, 26, 29, 24, 27, 24, 26, 25, 28, 24, 27, 23, 29, 23, 30, 26, 31, 26, 31, 23, 27, 24, 28, 23, 28, 24, 30,
+    23, 23, 26, 29, 26, 29, 26, 30, 24, 27, 22, 28, 22, 28, 24, 28, 23, 29, 23, 31, 23, 31, 26, 31, 23, 30, 23, 31, 23, 31, 24, 31,
+    7, 3, 5, 4, 0, 0, 0, 0, 8, 4, 8, 4, 9, 3, 9, 3, 5, 4, 3, 3, 0, 0, 0, 0, 5, 2, 5, 2, 5, 3, 5, 3,
+    6, 3, 5, 3, 3, 0, 3, 0, 9, 4, 8, 4, 5, 3, 5, 3, 5, 3, 3, 3, 3, 0, 3, 0, 5, 3, 5, 2, 5, 3, 5, 3,
+    8, 4, 5, 2, 9, 3, 5, 3, 13, 3, 6, 3, 6, 3, 6, 3, 8, 4, 5, 2, 9, 3, 5, 3, 6, 3, 6, 3, 6, 3, 6, 3,
+    9, 4, 5, 3, 5, 3, 5, 3, 13, 3, 6, 3, 6, 3, 6, 3, 8, 4, 5, 2, 5, 3, 5, 3, 6, 3, 6, 3, 6, 3, 6, 3,
+    12, 3, 9, 3, 6, 3, 5, 3, 13, 5, 9, 8, 10, 5, 9, 5, 9, 3, 3, 3, 5, 3, 3, 3, 6, 3, 5, 3, 6, 3, 5, 3,
+    12, 3, 9, 3, 6, 3, 5, 3, 10, 5, 9, 5, 6, 5, 5, 5, 9, 3, 3, 3, 5, 3, 3, 3, 6, 3, 5, 3, 6, 3, 5, 3,
+    13, 5, 6, 3, 10, 5, 6, 3, 13, 6, 11, 5, 6, 6, 6, 5, 9, 8, 5, 3, 9, 5, 5, 3, 11, 5, 6, 3, 6, 5, 6, 3,
+    10, 5, 6, 3, 6, 5, 6, 3, 13, 6, 6, 5, 6, 6, 6, 5, 9, 5, 5, 3, 5, 5, 5, 3, 6, 5, 6, 3, 6, 5, 6, 25,
+    5, 4, 3, 3, 0, 0, 0, 0, 5, 2, 5, 2, 5, 3, 5, 3, 3, 3, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    7, 2, 5, 2, 0, 0, 0, 0, 4, 2, 4, 2, 1, 1, 1, 1, 5, 2, 2, 1, 0, 0, 0, 0, 2, 1, 2, 1, 1, 1, 1, 1,
+    5, 2, 1, 1, 5, 3, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 5, 2, 1, 1, 5, 3, 1, 1, 1, 0, 0, 0, 1, 1, 1, 31,
+    4, 2, 2, 1, 1, 1, 1, 1, 3, 1, 2, 1, 1, 1, 1, 1, 4, 2, 2, 1, 1, 1, 1, 1, 2, 1, 3, 0, 1, 1, 1, 31,
+    6, 3, 5, 3, 1, 1, 1, 1, 9, 4, 9, 4, 4, 1, 4, 1, 5, 3, 3, 3, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1,
+    6, 3, 5, 3, 2, 1, 2, 1, 9, 4, 9, 4, 2, 1, 2, 27, 5, 3, 3, 3, 2, 1, 2, 1, 2, 2, 2, 2, 2, 1, 2, 29,
+    9, 4, 2, 2, 4, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 29, 9, 4, 2, 2, 4, 1, 1, 1, 2, 2, 2, 2, 1, 29, 1, 30,
+    9, 4, 2, 2, 2, 1, 2, 1, 2, 2, 2, 2, 2, 1, 24, 26, 9, 4, 2, 2, 2, 27, 2, 29, 2, 2, 25, 28, 24, 26, 24, 28,
+    6, 3, 5, 3, 3, 0, 3, 0, 9, 4, 8, 4, 5, 3, 5, 3, 7, 2, 5, 2, 0, 0, 0, 0, 4, 2, 4, 2, 1, 1, 1, 1,
+    7, 4, 4, 4, 0, 0, 0, 0, 8, 4, 8, 4, 9, 1, 9, 1, 6, 3, 5, 2, 0, 0, 0, 0, 9, 2, 4, 2, 2, 1, 2, 1,
+    11, 4, 2, 2, 0, 0, 2, 0, 13, 3, 11, 3, 10, 2, 4, 2, 4, 4, 2, 2, 1, 0, 0, 0, 5, 3, 5, 3, 2, 2, 2, 2,
+    11, 4, 2, 2, 3, 1, 2, 2, 13, 3, 11, 3, 4, 2, 4, 2, 4, 4, 2, 2, 1, 1, 3, 0, 5, 3, 5, 3, 5, 2, 2, 31,
+    13, 5, 9, 8, 9, 4, 9, 4, 8, 8, 8, 8, 9, 8, 9, 8, 6, 3, 5, 3, 2, 2, 2, 2, 9, 2, 9, 2, 4, 2, 4, 2,
+    10, 5, 9, 5, 9, 4, 9, 4, 9, 8, 8, 8, 9, 4, 9, 4, 6, 3, 5, 3, 2, 2, 2, 2, 9, 3, 9, 2, 4, 2, 4, 27,
+    13, 3, 11, 3, 11, 3, 5, 4, 13, 5, 11, 5, 10, 4, 10, 4, 11, 3, 3, 3, 3, 3, 3, 3, 10, 3, 5, 3, 5, 2, 5, 29,
+    13, 3, 11, 3, 5, 3, 5, 3, 13, 5, 11, 5, 11, 4, 4, 26, 11, 3, 3, 3, 3, 3, 3, 29, 10, 3, 5, 26, 5, 25, 24, 26,
+    5, 3, 3, 3, 3, 0, 3, 0, 5, 3, 5, 2, 5, 3, 5, 3, 5, 2, 2, 1, 0, 0, 0, 0, 2, 1, 2, 1, 1, 1, 1, 1,
+    6, 3, 5, 2, 0, 0, 0, 0, 9, 2, 4, 2, 2, 1, 2, 1, 7, 1, 4, 1, 0, 0, 0, 0, 4, 1, 4, 1, 1, 1, 1, 30,
+    2, 2, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 30, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    4, 2, 2, 1, 0, 0, 0, 0, 3, 0, 3, 27, 1, 1, 1, 30, 4, 2, 2, 1, 1, 0, 0, 30, 3, 0, 3, 29, 0, 30, 26, 30,
+    10, 5, 9, 5, 4, 1, 4, 1, 9, 8, 9, 8, 4, 4, 4, 30, 6, 3, 5, 3, 1, 1, 1, 1, 4, 2, 4, 2, 1, 1, 1, 31,
+    6, 5, 5, 5, 2, 1, 2, 27, 9, 4, 9, 4, 8, 1, 23, 23, 6, 3, 5, 3, 2, 1, 2, 29, 4, 2, 4, 27, 2, 1, 22, 29,
+    11, 3, 3, 3, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 30, 5, 4, 3, 3, 1, 1, 1, 31, 3, 2, 3, 31, 1, 29, 25, 30,
+    5, 3, 3, 3, 2, 1, 2, 27, 3, 2, 22, 23, 2, 24, 23, 26, 5, 3, 3, 29, 2, 27, 26, 29, 3, 27, 22, 28, 24, 26, 24, 29,
+    8, 4, 5, 2, 9, 3, 5, 3, 13, 3, 6, 3, 6, 3, 6, 3, 5, 2, 1, 1, 5, 3, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1,
+    11, 4, 2, 2, 0, 0, 2, 0, 13, 3, 11, 3, 10, 2, 4, 2, 2, 2, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 30,
+    13, 3, 0, 0, 6, 3, 1, 1, 15, 0, 12, 0, 15, 23, 13, 29, 6, 3, 1, 0, 6, 3, 1, 1, 12, 0, 0, 0, 13, 29, 11, 30,
+    13, 3, 0, 0, 10, 2, 0, 0, 15, 0, 12, 0, 14, 27, 12, 29, 11, 3, 0, 0, 4, 2, 1, 30, 12, 0, 0, 29, 12, 29, 0, 31,
+    15, 4, 11, 4, 15, 4, 11, 4, 14, 9, 11, 4, 15, 4, 11, 4, 11, 4, 1, 1, 11, 4, 1, 1, 13, 1, 2, 1, 13, 1, 2, 28,
+    14, 9, 11, 9, 14, 4, 10, 4, 14, 9, 11, 9, 12, 9, 10, 27, 11, 9, 19, 28, 10, 4, 25, 28, 12, 9, 21, 26, 13, 1, 25, 27,
+    14, 9, 13, 1, 15, 4, 13, 1, 15, 10, 12, 9, 15, 23, 13, 27, 11, 4, 2, 1, 11, 4, 2, 28, 12, 9, 11, 0, 13, 27, 26, 27,
+    14, 9, 12, 9, 12, 9, 13, 1, 15, 10, 12, 24, 14, 27, 24, 26, 11, 9, 21, 26, 10, 27, 25, 27, 12, 24, 25, 25, 24, 26, 24, 25,
+    8, 4, 5, 2, 9, 3, 5, 3, 6, 3, 6, 3, 6, 3, 6, 3, 5, 2, 1, 1, 5, 3, 1, 1, 1, 0, 0, 0, 1, 1, 1, 31,
+    4, 4, 2, 2, 1, 0, 0, 0, 5, 3, 5, 3, 2, 2, 2, 2, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    6, 3, 1, 0, 6, 3, 1, 1, 12, 0, 0, 0, 13, 29, 11, 30, 6, 3, 0, 0, 6, 3, 1, 31, 0, 0, 0, 0, 11, 30, 0, 31,
+    5, 3, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 30, 0, 30, 5, 3, 0, 0, 2, 2, 0, 31, 0, 0, 0, 31, 0, 30, 28, 31,
+    15, 4, 11, 4, 13, 4, 7, 4, 13, 4, 11, 4, 7, 4, 7, 30, 11, 4, 1, 1, 7, 4, 1, 31, 1, 1, 1, 1, 1, 30, 1, 31,
+    14, 4, 10, 4, 4, 4, 4, 4, 10, 4, 10, 4, 4, 4, 4, 29, 10, 4, 25, 28, 4, 4, 28, 31, 1, 1, 22, 28, 1, 31, 26, 30,
+    13, 4, 1, 1, 7, 4, 1, 30, 14, 0, 13, 0, 13, 23, 23, 29, 11, 4, 1, 1, 7, 30, 1, 31, 13, 0, 0, 31, 23, 29, 26, 30,
+    10, 4, 1, 1, 4, 4, 1, 31, 15, 24, 21, 27, 23, 27, 25, 28, 10, 4, 22, 28, 4, 29, 26, 30, 21, 27, 25, 28, 25, 28, 24, 31,
+    9, 4, 5, 3, 5, 3, 5, 3, 13, 3, 6, 3, 6, 3, 6, 3, 4, 2, 2, 1, 1, 1, 1, 1, 3, 1, 2, 1, 1, 1, 1, 1,
+    11, 4, 2, 2, 3, 1, 2, 2, 13, 3, 11, 3, 4, 2, 4, 2, 4, 2, 2, 1, 0, 0, 0, 0, 3, 0, 3, 27, 1, 1, 1, 30,
+    13, 3, 0, 0, 10, 2, 0, 0, 15, 0, 12, 0, 14, 27, 12, 29, 5, 3, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 30, 0, 30,
+    12, 3, 0, 0, 0, 0, 0, 0, 15, 0, 12, 23, 12, 29, 23, 29, 3, 3, 0, 28, 0, 0, 0, 31, 0, 0, 26, 29, 0, 30, 23, 31,
+    14, 9, 11, 4, 13, 4, 11, 4, 14, 4, 11, 4, 13, 4, 11, 4, 13, 1, 2, 1, 1, 1, 1, 1, 4, 1, 4, 1, 2, 1, 2, 29,
+    14, 9, 11, 9, 10, 4, 10, 4, 14, 9, 11, 23, 10, 4, 23, 27, 12, 9, 21, 26, 1, 1, 22, 28, 15, 1, 22, 23, 2, 29, 22, 27,
+    15, 9, 12, 9, 14, 9, 12, 9, 15, 9, 12, 9, 14, 23, 26, 29, 12, 9, 1, 1, 13, 28, 26, 31, 15, 1, 2, 29, 23, 27, 26, 29,
+    15, 9, 12, 22, 12, 9, 22, 27, 15, 24, 22, 23, 24, 27, 25, 28, 12, 22, 21, 28, 21, 27, 25, 29, 21, 24, 22, 26, 24, 26, 24, 27,
+    8, 4, 5, 2, 5, 3, 5, 3, 6, 3, 6, 3, 6, 3, 6, 3, 4, 2, 2, 1, 1, 1, 1, 1, 2, 1, 3, 0, 1, 1, 1, 31,
+    4, 4, 2, 2, 1, 1, 3, 0, 5, 3, 5, 3, 5, 2, 2, 31, 4, 2, 2, 1, 1, 0, 0, 30, 3, 0, 3, 29, 0, 30, 26, 30,
+    11, 3, 0, 0, 4, 2, 1, 30, 12, 0, 0, 29, 12, 29, 0, 31, 5, 3, 0, 0, 2, 2, 0, 31, 0, 0, 0, 31, 0, 30, 28, 31,
+    3, 3, 0, 28, 0, 0, 0, 31, 0, 0, 26, 29, 0, 30, 23, 31, 3, 3, 0, 30, 0, 31, 26, 30, 0, 30, 26, 30, 23, 30, 26, 31,
+    15, 4, 11, 4, 7, 4, 7, 30, 13, 4, 11, 4, 7, 4, 7, 31, 13, 1, 2, 28, 1, 30, 1, 31, 2, 1, 2, 29, 1, 30, 28, 31,
+    12, 9, 10, 27, 4, 4, 4, 29, 10, 4, 23, 27, 4, 30, 23, 31, 13, 1, 25, 27, 1, 31, 26, 30, 2, 29, 22, 27, 19, 30, 22, 30,
+    14, 9, 13, 28, 13, 29, 11, 31, 14, 27, 28, 29, 23, 29, 26, 31, 12, 9, 26, 31, 11, 31, 28, 31, 0, 30, 28, 30, 23, 30, 26, 31,
+    12, 9, 21, 27, 0, 30, 22, 29, 24, 24, 23, 23, 23, 27, 23, 28, 22, 27, 25, 29, 22, 29, 26, 30, 21, 27, 22, 29, 24, 28, 24, 30,
+    12, 3, 9, 3, 6, 3, 5, 3, 13, 5, 9, 8, 10, 5, 9, 5, 6, 3, 5, 3, 1, 1, 1, 1, 9, 4, 9, 4, 4, 1, 4, 1,
+    13, 5, 9, 8, 9, 4, 9, 4, 8, 8, 8, 8, 9, 8, 9, 8, 10, 5, 9, 5, 4, 1, 4, 1, 9, 8, 9, 8, 4, 4, 4, 30,
+    15, 4, 11, 4, 15, 4, 11, 4, 14, 9, 11, 4, 15, 4, 11, 4, 15, 4, 11, 4, 13, 4, 7, 4, 13, 4, 11, 4, 7, 4, 7, 30,
+    14, 9, 11, 4, 13, 4, 11, 4, 14, 4, 11, 4, 13, 4, 11, 4, 15, 4, 11, 4, 7, 4, 7, 30, 13, 4, 11, 4, 7, 4, 7, 31,
+    15, 8, 8, 8, 12, 8, 9, 8, 15, 8, 8, 8, 12, 8, 9, 8, 12, 8, 9, 8, 7, 4, 4, 4, 10, 8, 9, 8, 7, 4, 4, 4,
+    15, 8, 8, 8, 10, 8, 9, 8, 14, 8, 8, 8, 10, 8, 9, 8, 12, 8, 9, 8, 7, 4, 4, 4, 10, 8, 9, 8, 7, 4, 4, 27,
+    15, 7, 11, 9, 15, 7, 11, 4, 14, 7, 11, 9, 15, 7, 11, 26, 15, 7, 11, 4, 13, 7, 7, 4, 13, 7, 11, 4, 7, 27, 7, 27,
+    14, 7, 11, 9, 13, 7, 11, 4, 14, 7, 11, 4, 13, 7, 25, 25, 15, 7, 11, 26, 7, 27, 7, 27, 13, 7, 25, 25, 24, 25, 24, 25,
+    9, 3, 3, 3, 5, 3, 3, 3, 6, 3, 5, 3, 6, 3, 5, 3, 5, 3, 3, 3, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1,
+    6, 3, 5, 3, 2, 2, 2, 2, 9, 2, 9, 2, 4, 2, 4, 2, 6, 3, 5, 3, 1, 1, 1, 1, 4, 2, 4, 2, 1, 1, 1, 31,
+    11, 4, 1, 1, 11, 4, 1, 1, 13, 1, 2, 1, 13, 1, 2, 28, 11, 4, 1, 1, 7, 4, 1, 31, 1, 1, 1, 1, 1, 30, 1, 31,
+    13, 1, 2, 1, 1, 1, 1, 1, 4, 1, 4, 1, 2, 1, 2, 29, 13, 1, 2, 28, 1, 30, 1, 31, 2, 1, 2, 29, 1, 30, 28, 31,
+    12, 8, 9, 8, 7, 4, 4, 4, 10, 8, 9, 8, 7, 4, 4, 4, 7, 4, 4, 4, 1, 1, 1, 1, 8, 4, 8, 4, 2, 1, 2, 28,
+    10, 8, 9, 8, 8, 4, 8, 4, 9, 8, 9, 8, 8, 4, 22, 26, 7, 4, 4, 4, 2, 1, 2, 28, 8, 4, 22, 26, 4, 1, 22, 27,
+    14, 4, 4, 4, 13, 2, 2, 2, 14, 4, 4, 4, 13, 27, 21, 28, 13, 2, 2, 2, 7, 28, 1, 31, 4, 2, 4, 22, 21, 27, 25, 29,
+    14, 4, 4, 4, 4, 2, 4, 22, 4, 4, 21, 27, 24, 24, 25, 26, 13, 27, 21, 28, 21, 27, 25, 29, 24, 24, 25, 26, 24, 25, 24, 26,
+    12, 3, 9, 3, 6, 3, 5, 3, 10, 5, 9, 5, 6, 5, 5, 5, 6, 3, 5, 3, 2, 1, 2, 1, 9, 4, 9, 4, 2, 1, 2, 27,
+    10, 5, 9, 5, 9, 4, 9, 4, 9, 8, 8, 8, 9, 4, 9, 4, 6, 5, 5, 5, 2, 1, 2, 27, 9, 4, 9, 4, 8, 1, 23, 23,
+    14, 9, 11, 9, 14, 4, 10, 4, 14, 9, 11, 9, 12, 9, 10, 27, 14, 4, 10, 4, 4, 4, 4, 4, 10, 4, 10, 4, 4, 4, 4, 29,
+    14, 9, 11, 9, 10, 4, 10, 4, 14, 9, 11, 23, 10, 4, 23, 27, 12, 9, 10, 27, 4, 4, 4, 29, 10, 4, 23, 27, 4, 30, 23, 31,
+    15, 8, 8, 8, 10, 8, 9, 8, 14, 8, 8, 8, 10, 8, 9, 8, 10, 8, 9, 8, 8, 4, 8, 4, 9, 8, 9, 8, 8, 4, 22, 26,
+    14, 8, 8, 8, 9, 8, 9, 8, 8, 8, 8, 23, 9, 8, 23, 23, 10, 8, 9, 8, 8, 4, 22, 26, 9, 8, 23, 23, 8, 4, 23, 23,
+    14, 9, 11, 9, 12, 9, 10, 9, 14, 9, 11, 22, 12, 22, 10, 28, 12, 9, 10, 9, 11, 4, 4, 31, 13, 4, 10, 22, 21, 27, 22, 29,
+    14, 9, 11, 22, 13, 4, 10, 22, 14, 9, 23, 23, 10, 24, 23, 23, 12, 22, 10, 28, 21, 27, 22, 29, 10, 24, 23, 23, 24, 25, 23, 27,
+    9, 3, 3, 3, 5, 3, 3, 3, 6, 3, 5, 3, 6, 3, 5, 3, 5, 3, 3, 3, 2, 1, 2, 1, 2, 2, 2, 2, 2, 1, 2, 29,
+    6, 3, 5, 3, 2, 2, 2, 2, 9, 3, 9, 2, 4, 2, 4, 27, 6, 3, 5, 3, 2, 1, 2, 29, 4, 2, 4, 27, 2, 1, 22, 29,
+    11, 9, 19, 28, 10, 4, 25, 28, 12, 9, 21, 26, 13, 1, 25, 27, 10, 4, 25, 28, 4, 4, 28, 31, 1, 1, 22, 28, 1, 31, 26, 30,
+    12, 9, 21, 26, 1, 1, 22, 28, 15, 1, 22, 23, 2, 29, 22, 27, 13, 1, 25, 27, 1, 31, 26, 30, 2, 29, 22, 27, 19, 30, 22, 30,
+    12, 8, 9, 8, 7, 4, 4, 4, 10, 8, 9, 8, 7, 4, 4, 27, 7, 4, 4, 4, 2, 1, 2, 28, 8, 4, 22, 26, 4, 1, 22, 27,
+    10, 8, 9, 8, 8, 4, 22, 26, 9, 8, 23, 23, 8, 4, 23, 23, 7, 4, 4, 27, 4, 1, 22, 27, 8, 4, 23, 23, 8, 1, 23, 23,
+    15, 4, 19, 28, 13, 2, 21, 28, 14, 4, 21, 26, 21, 22, 21, 27, 13, 2, 21, 28, 1, 31, 22, 31, 19, 21, 22, 26, 21, 27, 22, 29,
+    14, 4, 21, 26, 19, 21, 22, 26, 19, 24, 23, 23, 21, 24, 23, 23, 21, 22, 21, 27, 21, 27, 22, 29, 21, 24, 23, 23, 24, 25, 23, 27,
+    13, 5, 6, 3, 10, 5, 6, 3, 13, 6, 11, 5, 6, 6, 6, 5, 9, 4, 2, 2, 4, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 29,
+    13, 3, 11, 3, 11, 3, 5, 4, 13, 5, 11, 5, 10, 4, 10, 4, 11, 3, 3, 3, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 30,
+    14, 9, 13, 1, 15, 4, 13, 1, 15, 10, 12, 9, 15, 23, 13, 27, 13, 4, 1, 1, 7, 4, 1, 30, 14, 0, 13, 0, 13, 23, 23, 29,
+    15, 9, 12, 9, 14, 9, 12, 9, 15, 9, 12, 9, 14, 23, 26, 29, 14, 9, 13, 28, 13, 29, 11, 31, 14, 27, 28, 29, 23, 29, 26, 31,
+    15, 7, 11, 9, 15, 7, 11, 4, 14, 7, 11, 9, 15, 7, 11, 26, 14, 4, 4, 4, 13, 2, 2, 2, 14, 4, 4, 4, 13, 27, 21, 28,
+    14, 9, 11, 9, 12, 9, 10, 9, 14, 9, 11, 22, 12, 22, 10, 28, 15, 4, 19, 28, 13, 2, 21, 28, 14, 4, 21, 26, 21, 22, 21, 27,
+    15, 7, 12, 9, 15, 7, 13, 9, 15, 12, 12, 19, 15, 23, 22, 22, 14, 7, 13, 5, 13, 29, 26, 28, 14, 19, 19, 21, 23, 23, 22, 27,
+    15, 10, 12, 21, 14, 10, 12, 21, 15, 24, 21, 21, 22, 23, 25, 26, 15, 22, 21, 26, 25, 28, 25, 27, 24, 24, 25, 25, 24, 26, 24, 26,
+    9, 8, 5, 3, 9, 5, 5, 3, 11, 5, 6, 3, 6, 5, 6, 3, 9, 4, 2, 2, 4, 1, 1, 1, 2, 2, 2, 2, 1, 29, 1, 30,
+    11, 3, 3, 3, 3, 3, 3, 3, 10, 3, 5, 3, 5, 2, 5, 29, 5, 4, 3, 3, 1, 1, 1, 31, 3, 2, 3, 31, 1, 29, 25, 30,
+    11, 4, 2, 1, 11, 4, 2, 28, 12, 9, 11, 0, 13, 27, 26, 27, 11, 4, 1, 1, 7, 30, 1, 31, 13, 0, 0, 31, 23, 29, 26, 30,
+    12, 9, 1, 1, 13, 28, 26, 31, 15, 1, 2, 29, 23, 27, 26, 29, 12, 9, 26, 31, 11, 31, 28, 31, 0, 30, 28, 30, 23, 30, 26, 31,
+    15, 7, 11, 4, 13, 7, 7, 4, 13, 7, 11, 4, 7, 27, 7, 27, 13, 2, 2, 2, 7, 28, 1, 31, 4, 2, 4, 22, 21, 27, 25, 29,
+    12, 9, 10, 9, 11, 4, 4, 31, 13, 4, 10, 22, 21, 27, 22, 29, 13, 2, 21, 28, 1, 31, 22, 31, 19, 21, 22, 26, 21, 27, 22, 29,
+    14, 7, 13, 5, 13, 29, 26, 28, 14, 19, 19, 21, 23, 23, 22, 27, 13, 7, 1, 31, 7, 30, 26, 31, 14, 19, 19, 22, 23, 23, 22, 29,
+    15, 2, 19, 22, 26, 29, 21, 31, 24, 24, 21, 22, 22, 23, 22, 28, 21, 27, 21, 28, 25, 29, 25, 30, 24, 24, 25, 26, 23, 26, 24, 29,
+    10, 5, 6, 3, 6, 5, 6, 3, 13, 6, 6, 5, 6, 6, 6, 5, 9, 4, 2, 2, 2, 1, 2, 1, 2, 2, 2, 2, 2, 1, 24, 26,
+    13, 3, 11, 3, 5, 3, 5, 3, 13, 5, 11, 5, 11, 4, 4, 26, 5, 3, 3, 3, 2, 1, 2, 27, 3, 2, 22, 23, 2, 24, 23, 26,
+    14, 9, 12, 9, 12, 9, 13, 1, 15, 10, 12, 24, 14, 27, 24, 26, 10, 4, 1, 1, 4, 4, 1, 31, 15, 24, 21, 27, 23, 27, 25, 28,
+    15, 9, 12, 22, 12, 9, 22, 27, 15, 24, 22, 23, 24, 27, 25, 28, 12, 9, 21, 27, 0, 30, 22, 29, 24, 24, 23, 23, 23, 27, 23, 28,
+    14, 7, 11, 9, 13, 7, 11, 4, 14, 7, 11, 4, 13, 7, 25, 25, 14, 4, 4, 4, 4, 2, 4, 22, 4, 4, 21, 27, 24, 24, 25, 26,
+    14, 9, 11, 22, 13, 4, 10, 22, 14, 9, 23, 23, 10, 24, 23, 23, 14, 4, 21, 26, 19, 21, 22, 26, 19, 24, 23, 23, 21, 24, 23, 23,
+    15, 10, 12, 21, 14, 10, 12, 21, 15, 24, 21, 21, 22, 23, 25, 26, 15, 2, 19, 22, 26, 29, 21, 31, 24, 24, 21, 22, 22, 23, 22, 28,
+    15, 9, 21, 22, 12, 27, 22, 22, 15, 24, 23, 23, 22, 23, 23, 28, 21, 22, 21, 28, 21, 27, 22, 29, 24, 24, 23, 23, 22, 26, 23, 27,
+    9, 5, 5, 3, 5, 5, 5, 3, 6, 5, 6, 3, 6, 5, 6, 25, 9, 4, 2, 2, 2, 27, 2, 29, 2, 2, 25, 28, 24, 26, 24, 28,
+    11, 3, 3, 3, 3, 3, 3, 29, 10, 3, 5, 26, 5, 25, 24, 26, 5, 3, 3, 29, 2, 27, 26, 29, 3, 27, 22, 28, 24, 26, 24, 29,
+    11, 9, 21, 26, 10, 27, 25, 27, 12, 24, 25, 25, 24, 26, 24, 25, 10, 4, 22, 28, 4, 29, 26, 30, 21, 27, 25, 28, 25, 28, 24, 31,
+    12, 22, 21, 28, 21, 27, 25, 29, 21, 24, 22, 26, 24, 26, 24, 27, 22, 27, 25, 29, 22, 29, 26, 30, 21, 27, 22, 29, 24, 28, 24, 30,
+    15, 7, 11, 26, 7, 27, 7, 27, 13, 7, 25, 25, 24, 25, 24, 25, 13, 27, 21, 28, 21, 27, 25, 29, 24, 24, 25, 26, 24, 25, 24, 26,
+    12, 22, 10, 28, 21, 27, 22, 29, 10, 24, 23, 23, 24, 25, 23, 27, 21, 22, 21, 27, 21, 27, 22, 29, 21, 24, 23, 23, 24, 25, 23, 27,
+    15, 22, 21, 26, 25, 28, 25, 27, 24, 24, 25, 25, 24, 26, 24, 26, 21, 27, 21, 28, 25, 29, 25, 30, 24, 24, 25, 26, 23, 26, 24, 29,
+    21, 22, 21, 28, 21, 27, 22, 29, 24, 24, 23, 23, 22, 26, 23, 27, 21, 22, 21, 27, 21, 31, 22, 30, 21, 24, 23, 23, 22, 26, 23, 29,
+    6, 3, 7, 2, 3, 0, 0, 0, 11, 4, 4, 4, 0, 0, 1, 0, 5, 3, 5, 2, 3, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0,
+    7, 4, 6, 3, 0, 0, 0, 0, 11, 4, 4, 4, 3, 1, 1, 1, 4, 4, 5, 2, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 3, 0,
+    9, 4, 4, 2, 5, 3, 1, 1, 13, 3, 5, 3, 10, 2, 2, 2, 8, 4, 4, 2, 5, 3, 1, 1, 11, 3, 5, 3, 4, 2, 2, 2,
+    8, 4, 9, 2, 9, 1, 2, 1, 13, 3, 5, 3, 4, 2, 5, 2, 8, 4, 4, 2, 9, 1, 2, 1, 11, 3, 5, 3, 4, 2, 2, 31,
+    13, 5, 6, 3, 9, 4, 2, 2, 13, 3, 11, 3, 11, 3, 3, 3, 9, 8, 5, 3, 9, 4, 2, 2, 11, 3, 3, 3, 5, 4, 3, 3,
+    10, 5, 6, 3, 9, 4, 2, 2, 13, 3, 11, 3, 5, 3, 3, 3, 9, 5, 5, 3, 9, 4, 2, 2, 11, 3, 3, 3, 5, 3, 3, 29,
+    8, 8, 9, 2, 9, 8, 4, 2, 13, 5, 10, 3, 10, 4, 5, 2, 8, 8, 9, 2, 9, 8, 4, 2, 11, 5, 5, 3, 10, 4, 5, 29,
+    9, 8, 9, 3, 9, 4, 4, 2, 13, 5, 10, 3, 11, 4, 5, 25, 8, 8, 9, 2, 9, 4, 4, 27, 11, 5, 5, 26, 4, 26, 24, 26,
+    5, 3, 5, 2, 3, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 3, 3, 2, 1, 3, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    6, 3, 7, 1, 0, 0, 0, 0, 4, 2, 4, 2, 0, 0, 1, 0, 5, 2, 4, 1, 0, 0, 0, 0, 2, 1, 2, 1, 0, 0, 0, 30,
+    5, 3, 2, 1, 5, 3, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 5, 2, 2, 1, 5, 3, 1, 1, 0, 0, 0, 0, 1, 30, 0, 31,
+    9, 2, 4, 1, 2, 1, 1, 1, 3, 0, 3, 0, 1, 1, 0, 30, 4, 2, 4, 1, 2, 1, 1, 30, 3, 27, 3, 29, 1, 30, 26, 30,
+    10, 5, 6, 3, 4, 1, 1, 1, 11, 3, 5, 4, 1, 1, 1, 1, 9, 5, 5, 3, 4, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 31,
+    6, 5, 6, 3, 2, 1, 2, 1, 5, 3, 5, 3, 2, 1, 2, 27, 5, 5, 5, 3, 2, 27, 2, 29, 3, 3, 3, 29, 2, 27, 26, 29,
+    9, 8, 4, 2, 4, 4, 1, 1, 2, 2, 3, 2, 1, 1, 1, 29, 9, 8, 4, 2, 4, 30, 1, 31, 2, 2, 3, 31, 1, 30, 25, 30,
+    9, 4, 4, 2, 8, 1, 2, 1, 3, 2, 3, 27, 2, 24, 24, 26, 9, 4, 4, 27, 23, 23, 22, 29, 22, 23, 22, 28, 23, 26, 24, 29,
+    7, 4, 6, 3, 0, 0, 0, 0, 11, 4, 4, 4, 3, 1, 1, 1, 6, 3, 7, 1, 0, 0, 0, 0, 4, 2, 4, 2, 0, 0, 1, 0,
+    7, 6, 7, 5, 0, 0, 0, 0, 11, 4, 4, 4, 1, 1, 1, 1, 7, 5, 6, 3, 0, 0, 0, 0, 4, 2, 4, 2, 1, 1, 1, 28,
+    11, 4, 4, 2, 3, 1, 0, 0, 12, 3, 3, 3, 0, 0, 0, 0, 4, 4, 4, 2, 1, 1, 1, 0, 3, 3, 3, 3, 0, 0, 0, 31,
+    11, 4, 4, 2, 1, 1, 1, 1, 12, 3, 3, 3, 3, 0, 3, 27, 4, 4, 4, 2, 1, 1, 1, 28, 3, 3, 25, 28, 3, 27, 25, 28,
+    13, 6, 11, 5, 2, 2, 2, 2, 13, 5, 11, 5, 2, 2, 2, 2, 11, 5, 6, 3, 2, 2, 2, 2, 10, 3, 5, 3, 3, 2, 3, 31,
+    13, 6, 6, 5, 2, 2, 2, 2, 13, 5, 11, 5, 3, 2, 22, 23, 6, 5, 6, 3, 2, 2, 25, 28, 10, 3, 5, 26, 3, 27, 22, 28,
+    13, 5, 10, 3, 2, 2, 3, 2, 12, 3, 12, 3, 3, 3, 3, 28, 11, 5, 5, 3, 2, 2, 3, 31, 12, 3, 3, 3, 3, 28, 25, 30,
+    13, 5, 10, 3, 3, 2, 3, 27, 12, 3, 22, 23, 3, 24, 22, 26, 11, 5, 5, 26, 22, 23, 22, 28, 22, 23, 22, 28, 22, 26, 24, 28,
+    4, 4, 5, 2, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 3, 0, 5, 2, 4, 1, 0, 0, 0, 0, 2, 1, 2, 1, 0, 0, 0, 30,
+    7, 5, 6, 3, 0, 0, 0, 0, 4, 2, 4, 2, 1, 1, 1, 28, 6, 3, 7, 0, 0, 0, 0, 31, 4, 1, 4, 27, 0, 28, 24, 30,
+    2, 2, 2, 1, 2, 2, 0, 0, 0, 0, 0, 28, 0, 0, 0, 31, 2, 2, 2, 1, 3, 0, 0, 30, 0, 28, 0, 30, 0, 31, 26, 30,
+    4, 2, 4, 1, 1, 1, 0, 28, 3, 0, 25, 26, 0, 27, 25, 28, 4, 2, 4, 27, 1, 28, 24, 30, 25, 26, 24, 29, 25, 28, 24, 31,
+    6, 6, 6, 5, 1, 1, 1, 29, 10, 4, 10, 4, 1, 1, 1, 30, 6, 5, 6, 3, 1, 29, 1, 30, 5, 2, 5, 29, 1, 29, 25, 30,
+    6, 6, 6, 5, 2, 1, 24, 26, 11, 4, 4, 26, 2, 24, 23, 26, 6, 5, 6, 25, 24, 26, 24, 28, 5, 25, 24, 26, 24, 26, 24, 29,
+    10, 4, 5, 2, 1, 1, 1, 29, 3, 3, 3, 28, 0, 27, 25, 30, 10, 4, 5, 29, 1, 30, 25, 30, 3, 28, 25, 30, 25, 30, 25, 30,
+    11, 4, 5, 25, 2, 24, 24, 26, 3, 24, 22, 26, 24, 24, 22, 26, 4, 26, 24, 26, 23, 26, 24, 29, 22, 26, 24, 28, 22, 26, 24, 28,
+    9, 4, 4, 2, 5, 3, 1, 1, 13, 3, 5, 3, 10, 2, 2, 2, 5, 3, 2, 1, 5, 3, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 4, 4, 2, 3, 1, 0, 0, 12, 3, 3, 3, 0, 0, 0, 0, 2, 2, 2, 1, 2, 2, 0, 0, 0, 0, 0, 28, 0, 0, 0, 31,
+    13, 3, 3, 1, 6, 3, 1, 1, 15, 0, 0, 0, 14, 27, 0, 30, 6, 3, 2, 1, 6, 3, 1, 1, 12, 0, 0, 0, 12, 29, 0, 30,
+    13, 3, 3, 0, 4, 2, 1, 1, 15, 0, 0, 0, 12, 29, 0, 30, 11, 3, 3, 27, 4, 2, 1, 30, 12, 23, 26, 29, 23, 29, 23, 31,
+    14, 9, 13, 1, 13, 4, 1, 1, 15, 9, 12, 9, 14, 9, 13, 28, 11, 4, 2, 1, 11, 4, 1, 1, 12, 9, 1, 1, 12, 9, 26, 31,
+    14, 9, 12, 9, 10, 4, 1, 1, 15, 9, 12, 22, 12, 9, 21, 27, 11, 9, 21, 26, 10, 4, 22, 28, 12, 22, 21, 28, 22, 27, 25, 29,
+    14, 4, 4, 1, 13, 4, 2, 1, 15, 9, 15, 1, 14, 23, 23, 27, 11, 4, 4, 1, 11, 4, 2, 29, 12, 9, 2, 29, 26, 29, 26, 29,
+    14, 9, 15, 1, 10, 4, 2, 29, 15, 24, 21, 24, 24, 27, 24, 26, 11, 23, 22, 23, 23, 27, 22, 27, 22, 23, 22, 26, 25, 28, 24, 27,
+    8, 4, 4, 2, 5, 3, 1, 1, 11, 3, 5, 3, 4, 2, 2, 2, 5, 2, 2, 1, 5, 3, 1, 1, 0, 0, 0, 0, 1, 30, 0, 31,
+    4, 4, 4, 2, 1, 1, 1, 0, 3, 3, 3, 3, 0, 0, 0, 31, 2, 2, 2, 1, 3, 0, 0, 30, 0, 28, 0, 30, 0, 31, 26, 30,
+    6, 3, 2, 1, 6, 3, 1, 1, 12, 0, 0, 0, 12, 29, 0, 30, 6, 3, 3, 0, 6, 3, 1, 31, 0, 29, 0, 31, 0, 31, 28, 31,
+    5, 3, 3, 0, 5, 2, 0, 30, 0, 0, 0, 30, 0, 30, 23, 30, 5, 3, 3, 29, 2, 31, 26, 30, 26, 29, 26, 30, 23, 31, 26, 31,
+    15, 4, 13, 1, 7, 4, 1, 30, 14, 9, 12, 9, 13, 29, 11, 31, 11, 4, 2, 28, 7, 30, 1, 31, 13, 28, 26, 31, 11, 31, 28, 31,
+    12, 9, 13, 1, 4, 4, 1, 31, 12, 9, 22, 27, 0, 30, 22, 29, 10, 27, 25, 27, 4, 29, 26, 30, 21, 27, 25, 29, 22, 29, 26, 30,
+    13, 4, 2, 1, 7, 4, 1, 30, 14, 27, 0, 30, 23, 29, 23, 30, 11, 4, 2, 29, 7, 31, 28, 31, 28, 29, 28, 30, 26, 31, 26, 31,
+    10, 4, 2, 29, 4, 30, 19, 30, 24, 24, 21, 27, 23, 27, 24, 28, 23, 27, 22, 27, 23, 31, 22, 30, 23, 23, 22, 29, 23, 28, 24, 30,
+    8, 4, 9, 2, 9, 1, 2, 1, 13, 3, 5, 3, 4, 2, 5, 2, 9, 2, 4, 1, 2, 1, 1, 1, 3, 0, 3, 0, 1, 1, 0, 30,
+    11, 4, 4, 2, 1, 1, 1, 1, 12, 3, 3, 3, 3, 0, 3, 27, 4, 2, 4, 1, 1, 1, 0, 28, 3, 0, 25, 26, 0, 27, 25, 28,
+    13, 3, 3, 0, 4, 2, 1, 1, 15, 0, 0, 0, 12, 29, 0, 30, 5, 3, 3, 0, 5, 2, 0, 30, 0, 0, 0, 30, 0, 30, 23, 30,
+    12, 3, 3, 0, 3, 0, 0, 27, 15, 0, 23, 27, 0, 30, 23, 30, 3, 3, 25, 26, 3, 27, 25, 28, 23, 27, 25, 28, 23, 30, 25, 31,
+    15, 10, 12, 9, 14, 0, 13, 0, 15, 9, 12, 9, 14, 27, 28, 29, 12, 9, 11, 0, 13, 0, 0, 31, 15, 1, 2, 29, 0, 30, 28, 30,
+    15, 10, 12, 24, 15, 24, 21, 27, 15, 24, 22, 23, 24, 24, 23, 23, 12, 24, 25, 25, 21, 27, 25, 28, 21, 24, 22, 26, 21, 27, 22, 29,
+    15, 9, 15, 1, 14, 27, 0, 30, 15, 0, 15, 27, 23, 23, 26, 29, 12, 9, 2, 29, 28, 29, 28, 30, 15, 27, 23, 30, 26, 29, 26, 30,
+    15, 24, 21, 24, 24, 24, 21, 27, 15, 24, 22, 23, 24, 27, 22, 28, 22, 23, 22, 26, 23, 23, 22, 29, 22, 23, 22, 28, 22, 28, 24, 28,
+    8, 4, 4, 2, 9, 1, 2, 1, 11, 3, 5, 3, 4, 2, 2, 31, 4, 2, 4, 1, 2, 1, 1, 30, 3, 27, 3, 29, 1, 30, 26, 30,
+    4, 4, 4, 2, 1, 1, 1, 28, 3, 3, 25, 28, 3, 27, 25, 28, 4, 2, 4, 27, 1, 28, 24, 30, 25, 26, 24, 29, 25, 28, 24, 31,
+    11, 3, 3, 27, 4, 2, 1, 30, 12, 23, 26, 29, 23, 29, 23, 31, 5, 3, 3, 29, 2, 31, 26, 30, 26, 29, 26, 30, 23, 31, 26, 31,
+    3, 3, 25, 26, 3, 27, 25, 28, 23, 27, 25, 28, 23, 30, 25, 31, 25, 28, 24, 29, 25, 28, 24, 31, 25, 28, 24, 30, 25, 31, 24, 31,
+    15, 23, 13, 27, 13, 23, 23, 29, 14, 23, 26, 29, 23, 29, 26, 31, 13, 27, 26, 27, 23, 29, 26, 30, 23, 27, 26, 29, 23, 30, 26, 31,
+    14, 27, 24, 26, 23, 27, 25, 28, 24, 27, 25, 28, 23, 27, 23, 28, 24, 26, 24, 25, 25, 28, 24, 31, 24, 26, 24, 27, 24, 28, 24, 30,
+    14, 23, 23, 27, 23, 29, 23, 30, 23, 23, 26, 29, 23, 29, 23, 31, 26, 29, 26, 29, 26, 31, 26, 31, 26, 29, 26, 30, 23, 31, 26, 31,
+    24, 27, 24, 26, 23, 27, 24, 28, 24, 27, 22, 28, 23, 30, 23, 31, 25, 28, 24, 27, 23, 28, 24, 30, 22, 28, 24, 28, 23, 31, 24, 31,
+    13, 5, 6, 3, 9, 4, 2, 2, 13, 3, 11, 3, 11, 3, 3, 3, 10, 5, 6, 3, 4, 1, 1, 1, 11, 3, 5, 4, 1, 1, 1, 1,
+    13, 6, 11, 5, 2, 2, 2, 2, 13, 5, 11, 5, 2, 2, 2, 2, 6, 6, 6, 5, 1, 1, 1, 29, 10, 4, 10, 4, 1, 1, 1, 30,
+    14, 9, 13, 1, 13, 4, 1, 1, 15, 9, 12, 9, 14, 9, 13, 28, 15, 4, 13, 1, 7, 4, 1, 30, 14, 9, 12, 9, 13, 29, 11, 31,
+    15, 10, 12, 9, 14, 0, 13, 0, 15, 9, 12, 9, 14, 27, 28, 29, 15, 23, 13, 27, 13, 23, 23, 29, 14, 23, 26, 29, 23, 29, 26, 31,
+    15, 7, 11, 9, 14, 4, 4, 4, 14, 9, 11, 9, 15, 4, 19, 28, 15, 7, 11, 4, 13, 2, 2, 2, 12, 9, 10, 9, 13, 2, 21, 28,
+    14, 7, 11, 9, 14, 4, 4, 4, 14, 9, 11, 22, 14, 4, 21, 26, 15, 7, 11, 26, 13, 27, 21, 28, 12, 22, 10, 28, 21, 22, 21, 27,
+    15, 7, 12, 9, 14, 7, 13, 5, 15, 10, 12, 21, 15, 22, 21, 26, 15, 7, 13, 9, 13, 29, 26, 28, 14, 10, 12, 21, 25, 28, 25, 27,
+    15, 12, 12, 19, 14, 19, 19, 21, 15, 24, 21, 21, 24, 24, 25, 25, 15, 23, 22, 22, 23, 23, 22, 27, 22, 23, 25, 26, 24, 26, 24, 26,
+    9, 8, 5, 3, 9, 4, 2, 2, 11, 3, 3, 3, 5, 4, 3, 3, 9, 5, 5, 3, 4, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 31,
+    11, 5, 6, 3, 2, 2, 2, 2, 10, 3, 5, 3, 3, 2, 3, 31, 6, 5, 6, 3, 1, 29, 1, 30, 5, 2, 5, 29, 1, 29, 25, 30,
+    11, 4, 2, 1, 11, 4, 1, 1, 12, 9, 1, 1, 12, 9, 26, 31, 11, 4, 2, 28, 7, 30, 1, 31, 13, 28, 26, 31, 11, 31, 28, 31,
+    12, 9, 11, 0, 13, 0, 0, 31, 15, 1, 2, 29, 0, 30, 28, 30, 13, 27, 26, 27, 23, 29, 26, 30, 23, 27, 26, 29, 23, 30, 26, 31,
+    15, 7, 11, 4, 13, 2, 2, 2, 12, 9, 10, 9, 13, 2, 21, 28, 13, 7, 7, 4, 7, 28, 1, 31, 11, 4, 4, 31, 1, 31, 22, 31,
+    13, 7, 11, 4, 4, 2, 4, 22, 13, 4, 10, 22, 19, 21, 22, 26, 7, 27, 7, 27, 21, 27, 25, 29, 21, 27, 22, 29, 21, 27, 22, 29,
+    14, 7, 13, 5, 13, 7, 1, 31, 15, 2, 19, 22, 21, 27, 21, 28, 13, 29, 26, 28, 7, 30, 26, 31, 26, 29, 21, 31, 25, 29, 25, 30,
+    14, 19, 19, 21, 14, 19, 19, 22, 24, 24, 21, 22, 24, 24, 25, 26, 23, 23, 22, 27, 23, 23, 22, 29, 22, 23, 22, 28, 23, 26, 24, 29,
+    10, 5, 6, 3, 9, 4, 2, 2, 13, 3, 11, 3, 5, 3, 3, 3, 6, 5, 6, 3, 2, 1, 2, 1, 5, 3, 5, 3, 2, 1, 2, 27,
+    13, 6, 6, 5, 2, 2, 2, 2, 13, 5, 11, 5, 3, 2, 22, 23, 6, 6, 6, 5, 2, 1, 24, 26, 11, 4, 4, 26, 2, 24, 23, 26,
+    14, 9, 12, 9, 10, 4, 1, 1, 15, 9, 12, 22, 12, 9, 21, 27, 12, 9, 13, 1, 4, 4, 1, 31, 12, 9, 22, 27, 0, 30, 22, 29,
+    15, 10, 12, 24, 15, 24, 21, 27, 15, 24, 22, 23, 24, 24, 23, 23, 14, 27, 24, 26, 23, 27, 25, 28, 24, 27, 25, 28, 23, 27, 23, 28,
+    14, 7, 11, 9, 14, 4, 4, 4, 14, 9, 11, 22, 14, 4, 21, 26, 13, 7, 11, 4, 4, 2, 4, 22, 13, 4, 10, 22, 19, 21, 22, 26,
+    14, 7, 11, 4, 4, 4, 21, 27, 14, 9, 23, 23, 19, 24, 23, 23, 13, 7, 25, 25, 24, 24, 25, 26, 10, 24, 23, 23, 21, 24, 23, 23,
+    15, 10, 12, 21, 15, 2, 19, 22, 15, 9, 21, 22, 21, 22, 21, 28, 14, 10, 12, 21, 26, 29, 21, 31, 12, 27, 22, 22, 21, 27, 22, 29,
+    15, 24, 21, 21, 24, 24, 21, 22, 15, 24, 23, 23, 24, 24, 23, 23, 22, 23, 25, 26, 22, 23, 22, 28, 22, 23, 23, 28, 22, 26, 23, 27,
+    9, 5, 5, 3, 9, 4, 2, 2, 11, 3, 3, 3, 5, 3, 3, 29, 5, 5, 5, 3, 2, 27, 2, 29, 3, 3, 3, 29, 2, 27, 26, 29,
+    6, 5, 6, 3, 2, 2, 25, 28, 10, 3, 5, 26, 3, 27, 22, 28, 6, 5, 6, 25, 24, 26, 24, 28, 5, 25, 24, 26, 24, 26, 24, 29,
+    11, 9, 21, 26, 10, 4, 22, 28, 12, 22, 21, 28, 22, 27, 25, 29, 10, 27, 25, 27, 4, 29, 26, 30, 21, 27, 25, 29, 22, 29, 26, 30,
+    12, 24, 25, 25, 21, 27, 25, 28, 21, 24, 22, 26, 21, 27, 22, 29, 24, 26, 24, 25, 25, 28, 24, 31, 24, 26, 24, 27, 24, 28, 24, 30,
+    15, 7, 11, 26, 13, 27, 21, 28, 12, 22, 10, 28, 21, 22, 21, 27, 7, 27, 7, 27, 21, 27, 25, 29, 21, 27, 22, 29, 21, 27, 22, 29,
+    13, 7, 25, 25, 24, 24, 25, 26, 10, 24, 23, 23, 21, 24, 23, 23, 24, 25, 24, 25, 24, 25, 24, 26, 24, 25, 23, 27, 24, 25, 23, 27,
+    15, 22, 21, 26, 21, 27, 21, 28, 21, 22, 21, 28, 21, 22, 21, 27, 25, 28, 25, 27, 25, 29, 25, 30, 21, 27, 22, 29, 21, 31, 22, 30,
+    24, 24, 25, 25, 24, 24, 25, 26, 24, 24, 23, 23, 21, 24, 23, 23, 24, 26, 24, 26, 23, 26, 24, 29, 22, 26, 23, 27, 22, 26, 23, 29,
+    8, 8, 9, 2, 9, 8, 4, 2, 13, 5, 10, 3, 10, 4, 5, 2, 9, 8, 4, 2, 4, 4, 1, 1, 2, 2, 3, 2, 1, 1, 1, 29,
+    13, 5, 10, 3, 2, 2, 3, 2, 12, 3, 12, 3, 3, 3, 3, 28, 10, 4, 5, 2, 1, 1, 1, 29, 3, 3, 3, 28, 0, 27, 25, 30,
+    14, 4, 4, 1, 13, 4, 2, 1, 15, 9, 15, 1, 14, 23, 23, 27, 13, 4, 2, 1, 7, 4, 1, 30, 14, 27, 0, 30, 23, 29, 23, 30,
+    15, 9, 15, 1, 14, 27, 0, 30, 15, 0, 15, 27, 23, 23, 26, 29, 14, 23, 23, 27, 23, 29, 23, 30, 23, 23, 26, 29, 23, 29, 23, 31,
+    15, 7, 12, 9, 14, 7, 13, 5, 15, 10, 12, 21, 15, 22, 21, 26, 14, 7, 13, 5, 13, 7, 1, 31, 15, 2, 19, 22, 21, 27, 21, 28,
+    15, 10, 12, 21, 15, 2, 19, 22, 15, 9, 21, 22, 21, 22, 21, 28, 15, 22, 21, 26, 21, 27, 21, 28, 21, 22, 21, 28, 21, 22, 21, 27,
+    14, 7, 15, 0, 14, 7, 23, 27, 15, 19, 19, 19, 22, 23, 22, 22, 14, 7, 23, 27, 13, 29, 28, 29, 14, 27, 19, 21, 23, 27, 22, 27,
+    15, 19, 19, 19, 14, 27, 19, 21, 15, 24, 21, 21, 22, 23, 25, 26, 22, 23, 22, 22, 23, 27, 22, 27, 22, 23, 25, 26, 24, 28, 24, 26,
+    8, 8, 9, 2, 9, 8, 4, 2, 11, 5, 5, 3, 10, 4, 5, 29, 9, 8, 4, 2, 4, 30, 1, 31, 2, 2, 3, 31, 1, 30, 25, 30,
+    11, 5, 5, 3, 2, 2, 3, 31, 12, 3, 3, 3, 3, 28, 25, 30, 10, 4, 5, 29, 1, 30, 25, 30, 3, 28, 25, 30, 25, 30, 25, 30,
+    11, 4, 4, 1, 11, 4, 2, 29, 12, 9, 2, 29, 26, 29, 26, 29, 11, 4, 2, 29, 7, 31, 28, 31, 28, 29, 28, 30, 26, 31, 26, 31,
+    12, 9, 2, 29, 28, 29, 28, 30, 15, 27, 23, 30, 26, 29, 26, 30, 26, 29, 26, 29, 26, 31, 26, 31, 26, 29, 26, 30, 23, 31, 26, 31,
+    15, 7, 13, 9, 13, 29, 26, 28, 14, 10, 12, 21, 25, 28, 25, 27, 13, 29, 26, 28, 7, 30, 26, 31, 26, 29, 21, 31, 25, 29, 25, 30,
+    14, 10, 12, 21, 26, 29, 21, 31, 12, 27, 22, 22, 21, 27, 22, 29, 25, 28, 25, 27, 25, 29, 25, 30, 21, 27, 22, 29, 21, 31, 22, 30,
+    14, 7, 23, 27, 13, 29, 28, 29, 14, 27, 19, 21, 23, 27, 22, 27, 13, 29, 28, 29, 7, 31, 28, 31, 28, 29, 19, 31, 23, 31, 22, 30,
+    14, 27, 19, 21, 28, 29, 19, 31, 24, 24, 21, 27, 22, 23, 22, 28, 23, 27, 22, 27, 23, 31, 22, 30, 22, 23, 22, 28, 25, 28, 24, 31,
+    9, 8, 9, 3, 9, 4, 4, 2, 13, 5, 10, 3, 11, 4, 5, 25, 9, 4, 4, 2, 8, 1, 2, 1, 3, 2, 3, 27, 2, 24, 24, 26,
+    13, 5, 10, 3, 3, 2, 3, 27, 12, 3, 22, 23, 3, 24, 22, 26, 11, 4, 5, 25, 2, 24, 24, 26, 3, 24, 22, 26, 24, 24, 22, 26,
+    14, 9, 15, 1, 10, 4, 2, 29, 15, 24, 21, 24, 24, 27, 24, 26, 10, 4, 2, 29, 4, 30, 19, 30, 24, 24, 21, 27, 23, 27, 24, 28,
+    15, 24, 21, 24, 24, 24, 21, 27, 15, 24, 22, 23, 24, 27, 22, 28, 24, 27, 24, 26, 23, 27, 24, 28, 24, 27, 22, 28, 23, 30, 23, 31,
+    15, 12, 12, 19, 14, 19, 19, 21, 15, 24, 21, 21, 24, 24, 25, 25, 14, 19, 19, 21, 14, 19, 19, 22, 24, 24, 21, 22, 24, 24, 25, 26,
+    15, 24, 21, 21, 24, 24, 21, 22, 15, 24, 23, 23, 24, 24, 23, 23, 24, 24, 25, 25, 24, 24, 25, 26, 24, 24, 23, 23, 21, 24, 23, 23,
+    15, 19, 19, 19, 14, 27, 19, 21, 15, 24, 21, 21, 22, 23, 25, 26, 14, 27, 19, 21, 28, 29, 19, 31, 24, 24, 21, 27, 22, 23, 22, 28,
+    15, 24, 21, 21, 24, 24, 21, 27, 15, 24, 23, 23, 22, 23, 23, 28, 22, 23, 25, 26, 22, 23, 22, 28, 22, 23, 23, 28, 24, 28, 23, 27,
+    8, 8, 9, 2, 9, 4, 4, 27, 11, 5, 5, 26, 4, 26, 24, 26, 9, 4, 4, 27, 23, 23, 22, 29, 22, 23, 22, 28, 23, 26, 24, 29,
+    11, 5, 5, 26, 22, 23, 22, 28, 22, 23, 22, 28, 22, 26, 24, 28, 4, 26, 24, 26, 23, 26, 24, 29, 22, 26, 24, 28, 22, 26, 24, 28,
+    11, 23, 22, 23, 23, 27, 22, 27, 22, 23, 22, 26, 25, 28, 24, 27, 23, 27, 22, 27, 23, 31, 22, 30, 23, 23, 22, 29, 23, 28, 24, 30,
+    22, 23, 22, 26, 23, 23, 22, 29, 22, 23, 22, 28, 22, 28, 24, 28, 25, 28, 24, 27, 23, 28, 24, 30, 22, 28, 24, 28, 23, 31, 24, 31,
+    15, 23, 22, 22, 23, 23, 22, 27, 22, 23, 25, 26, 24, 26, 24, 26, 23, 23, 22, 27, 23, 23, 22, 29, 22, 23, 22, 28, 23, 26, 24, 29,
+    22, 23, 25, 26, 22, 23, 22, 28, 22, 23, 23, 28, 22, 26, 23, 27, 24, 26, 24, 26, 23, 26, 24, 29, 22, 26, 23, 27, 22, 26, 23, 29,
+    22, 23, 22, 22, 23, 27, 22, 27, 22, 23, 25, 26, 24, 28, 24, 26, 23, 27, 22, 27, 23, 31, 22, 30, 22, 23, 22, 28, 25, 28, 24, 31,
+    22, 23, 25, 26, 22, 23, 22, 28, 22, 23, 23, 28, 24, 28, 23, 27, 24, 28, 24, 26, 25, 28, 24, 31, 24, 28, 23, 27, 22, 31, 23, 30,
+    7, 3, 0, 0, 5, 4, 0, 0, 8, 4, 9, 3, 8, 4, 9, 3, 5, 4, 0, 0, 3, 3, 0, 0, 5, 2, 5, 3, 5, 2, 5, 3,
+    8, 4, 9, 3, 5, 2, 5, 3, 13, 3, 6, 3, 6, 3, 6, 3, 8, 4, 9, 3, 5, 2, 5, 3, 6, 3, 6, 3, 6, 3, 6, 3,
+    6, 3, 3, 0, 5, 3, 3, 0, 9, 4, 5, 3, 8, 4, 5, 3, 5, 3, 3, 0, 3, 3, 3, 0, 5, 3, 5, 3, 5, 2, 5, 3,
+    9, 4, 5, 3, 5, 3, 5, 3, 13, 3, 6, 3, 6, 3, 6, 3, 8, 4, 5, 3, 5, 2, 5, 3, 6, 3, 6, 3, 6, 3, 6, 3,
+    12, 3, 6, 3, 9, 3, 5, 3, 13, 5, 10, 5, 9, 8, 9, 5, 9, 3, 5, 3, 3, 3, 3, 3, 6, 3, 6, 3, 5, 3, 5, 3,
+    13, 5, 10, 5, 6, 3, 6, 3, 13, 6, 6, 6, 11, 5, 6, 5, 9, 8, 9, 5, 5, 3, 5, 3, 11, 5, 6, 5, 6, 3, 6, 3,
+    12, 3, 6, 3, 9, 3, 5, 3, 10, 5, 6, 5, 9, 5, 5, 5, 9, 3, 5, 3, 3, 3, 3, 3, 6, 3, 6, 3, 5, 3, 5, 3,
+    10, 5, 6, 5, 6, 3, 6, 3, 13, 6, 6, 6, 6, 5, 6, 5, 9, 5, 5, 5, 5, 3, 5, 3, 6, 5, 6, 5, 6, 3, 6, 25,
+    5, 4, 0, 0, 3, 3, 0, 0, 5, 2, 5, 3, 5, 2, 5, 3, 3, 3, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    5, 2, 5, 3, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 1, 1, 5, 2, 5, 3, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 1, 31,
+    7, 2, 0, 0, 5, 2, 0, 0, 4, 2, 1, 1, 4, 2, 1, 1, 5, 2, 0, 0, 2, 1, 0, 0, 2, 1, 1, 1, 2, 1, 1, 1,
+    4, 2, 1, 1, 2, 1, 1, 1, 3, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 2, 1, 1, 1, 2, 1, 1, 1, 3, 0, 1, 31,
+    6, 3, 1, 1, 5, 3, 1, 1, 9, 4, 4, 1, 9, 4, 4, 1, 5, 3, 1, 1, 3, 3, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1,
+    9, 4, 4, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 29, 9, 4, 4, 1, 2, 2, 1, 1, 2, 2, 1, 29, 2, 2, 1, 30,
+    6, 3, 2, 1, 5, 3, 2, 1, 9, 4, 2, 1, 9, 4, 2, 27, 5, 3, 2, 1, 3, 3, 2, 1, 2, 2, 2, 1, 2, 2, 2, 29,
+    9, 4, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 24, 26, 9, 4, 2, 27, 2, 2, 2, 29, 2, 2, 24, 26, 25, 28, 24, 28,
+    8, 4, 9, 3, 5, 2, 5, 3, 13, 3, 6, 3, 6, 3, 6, 3, 5, 2, 5, 3, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 1, 1,
+    13, 3, 6, 3, 0, 0, 1, 1, 15, 0, 15, 23, 12, 0, 13, 29, 6, 3, 6, 3, 1, 0, 1, 1, 12, 0, 13, 29, 0, 0, 11, 30,
+    11, 4, 0, 0, 2, 2, 2, 0, 13, 3, 10, 2, 11, 3, 4, 2, 2, 2, 2, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 30,
+    13, 3, 10, 2, 0, 0, 0, 0, 15, 0, 14, 27, 12, 0, 12, 29, 11, 3, 4, 2, 0, 0, 1, 30, 12, 0, 12, 29, 0, 29, 0, 31,
+    15, 4, 15, 4, 11, 4, 11, 4, 14, 9, 15, 4, 11, 4, 11, 4, 11, 4, 11, 4, 1, 1, 1, 1, 13, 1, 13, 1, 2, 1, 2, 28,
+    14, 9, 15, 4, 13, 1, 13, 1, 15, 10, 15, 23, 12, 9, 13, 27, 11, 4, 11, 4, 2, 1, 2, 28, 12, 9, 13, 27, 11, 0, 26, 27,
+    14, 9, 14, 4, 11, 9, 10, 4, 14, 9, 12, 9, 11, 9, 10, 27, 11, 9, 10, 4, 19, 28, 25, 28, 12, 9, 13, 1, 21, 26, 25, 27,
+    14, 9, 12, 9, 12, 9, 13, 1, 15, 10, 14, 27, 12, 24, 24, 26, 11, 9, 10, 27, 21, 26, 25, 27, 12, 24, 24, 26, 25, 25, 24, 25,
+    8, 4, 9, 3, 5, 2, 5, 3, 6, 3, 6, 3, 6, 3, 6, 3, 5, 2, 5, 3, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 1, 31,
+    6, 3, 6, 3, 1, 0, 1, 1, 12, 0, 13, 29, 0, 0, 11, 30, 6, 3, 6, 3, 0, 0, 1, 31, 0, 0, 11, 30, 0, 0, 0, 31,
+    4, 4, 1, 0, 2, 2, 0, 0, 5, 3, 2, 2, 5, 3, 2, 2, 2, 2, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    5, 3, 2, 2, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 30, 5, 3, 2, 2, 0, 0, 0, 31, 0, 0, 0, 30, 0, 31, 28, 31,
+    15, 4, 13, 4, 11, 4, 7, 4, 13, 4, 7, 4, 11, 4, 7, 30, 11, 4, 7, 4, 1, 1, 1, 31, 1, 1, 1, 30, 1, 1, 1, 31,
+    13, 4, 7, 4, 1, 1, 1, 30, 14, 0, 13, 23, 13, 0, 23, 29, 11, 4, 7, 30, 1, 1, 1, 31, 13, 0, 23, 29, 0, 31, 26, 30,
+    14, 4, 4, 4, 10, 4, 4, 4, 10, 4, 4, 4, 10, 4, 4, 29, 10, 4, 4, 4, 25, 28, 28, 31, 1, 1, 1, 31, 22, 28, 26, 30,
+    10, 4, 4, 4, 1, 1, 1, 31, 15, 24, 23, 27, 21, 27, 25, 28, 10, 4, 4, 29, 22, 28, 26, 30, 21, 27, 25, 28, 25, 28, 24, 31,
+    6, 3, 3, 0, 5, 3, 3, 0, 9, 4, 5, 3, 8, 4, 5, 3, 7, 2, 0, 0, 5, 2, 0, 0, 4, 2, 1, 1, 4, 2, 1, 1,
+    11, 4, 0, 0, 2, 2, 2, 0, 13, 3, 10, 2, 11, 3, 4, 2, 4, 4, 1, 0, 2, 2, 0, 0, 5, 3, 2, 2, 5, 3, 2, 2,
+    7, 4, 0, 0, 4, 4, 0, 0, 8, 4, 9, 1, 8, 4, 9, 1, 6, 3, 0, 0, 5, 2, 0, 0, 9, 2, 2, 1, 4, 2, 2, 1,
+    11, 4, 3, 1, 2, 2, 2, 2, 13, 3, 4, 2, 11, 3, 4, 2, 4, 4, 1, 1, 2, 2, 3, 0, 5, 3, 5, 2, 5, 3, 2, 31,
+    13, 5, 9, 4, 9, 8, 9, 4, 8, 8, 9, 8, 8, 8, 9, 8, 6, 3, 2, 2, 5, 3, 2, 2, 9, 2, 4, 2, 9, 2, 4, 2,
+    13, 3, 11, 3, 11, 3, 5, 4, 13, 5, 10, 4, 11, 5, 10, 4, 11, 3, 3, 3, 3, 3, 3, 3, 10, 3, 5, 2, 5, 3, 5, 29,
+    10, 5, 9, 4, 9, 5, 9, 4, 9, 8, 9, 4, 8, 8, 9, 4, 6, 3, 2, 2, 5, 3, 2, 2, 9, 3, 4, 2, 9, 2, 4, 27,
+    13, 3, 5, 3, 11, 3, 5, 3, 13, 5, 11, 4, 11, 5, 4, 26, 11, 3, 3, 3, 3, 3, 3, 29, 10, 3, 5, 25, 5, 26, 24, 26,
+    5, 3, 3, 0, 3, 3, 3, 0, 5, 3, 5, 3, 5, 2, 5, 3, 5, 2, 0, 0, 2, 1, 0, 0, 2, 1, 1, 1, 2, 1, 1, 1,
+    2, 2, 2, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 30, 2, 2, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    6, 3, 0, 0, 5, 2, 0, 0, 9, 2, 2, 1, 4, 2, 2, 1, 7, 1, 0, 0, 4, 1, 0, 0, 4, 1, 1, 1, 4, 1, 1, 30,
+    4, 2, 0, 0, 2, 1, 0, 0, 3, 0, 1, 1, 3, 27, 1, 30, 4, 2, 1, 0, 2, 1, 0, 30, 3, 0, 0, 30, 3, 29, 26, 30,
+    10, 5, 4, 1, 9, 5, 4, 1, 9, 8, 4, 4, 9, 8, 4, 30, 6, 3, 1, 1, 5, 3, 1, 1, 4, 2, 1, 1, 4, 2, 1, 31,
+    11, 3, 1, 1, 3, 3, 1, 1, 2, 2, 1, 1, 2, 2, 1, 30, 5, 4, 1, 1, 3, 3, 1, 31, 3, 2, 1, 29, 3, 31, 25, 30,
+    6, 5, 2, 1, 5, 5, 2, 27, 9, 4, 8, 1, 9, 4, 23, 23, 6, 3, 2, 1, 5, 3, 2, 29, 4, 2, 2, 1, 4, 27, 22, 29,
+    5, 3, 2, 1, 3, 3, 2, 27, 3, 2, 2, 24, 22, 23, 23, 26, 5, 3, 2, 27, 3, 29, 26, 29, 3, 27, 24, 26, 22, 28, 24, 29,
+    9, 4, 5, 3, 5, 3, 5, 3, 13, 3, 6, 3, 6, 3, 6, 3, 4, 2, 1, 1, 2, 1, 1, 1, 3, 1, 1, 1, 2, 1, 1, 1,
+    13, 3, 10, 2, 0, 0, 0, 0, 15, 0, 14, 27, 12, 0, 12, 29, 5, 3, 2, 2, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 30,
+    11, 4, 3, 1, 2, 2, 2, 2, 13, 3, 4, 2, 11, 3, 4, 2, 4, 2, 0, 0, 2, 1, 0, 0, 3, 0, 1, 1, 3, 27, 1, 30,
+    12, 3, 0, 0, 0, 0, 0, 0, 15, 0, 12, 29, 12, 23, 23, 29, 3, 3, 0, 0, 0, 28, 0, 31, 0, 0, 0, 30, 26, 29, 23, 31,
+    14, 9, 13, 4, 11, 4, 11, 4, 14, 4, 13, 4, 11, 4, 11, 4, 13, 1, 1, 1, 2, 1, 1, 1, 4, 1, 2, 1, 4, 1, 2, 29,
+    15, 9, 14, 9, 12, 9, 12, 9, 15, 9, 14, 23, 12, 9, 26, 29, 12, 9, 13, 28, 1, 1, 26, 31, 15, 1, 23, 27, 2, 29, 26, 29,
+    14, 9, 10, 4, 11, 9, 10, 4, 14, 9, 10, 4, 11, 23, 23, 27, 12, 9, 1, 1, 21, 26, 22, 28, 15, 1, 2, 29, 22, 23, 22, 27,
+    15, 9, 12, 9, 12, 22, 22, 27, 15, 24, 24, 27, 22, 23, 25, 28, 12, 22, 21, 27, 21, 28, 25, 29, 21, 24, 24, 26, 22, 26, 24, 27,
+    8, 4, 5, 3, 5, 2, 5, 3, 6, 3, 6, 3, 6, 3, 6, 3, 4, 2, 1, 1, 2, 1, 1, 1, 2, 1, 1, 1, 3, 0, 1, 31,
+    11, 3, 4, 2, 0, 0, 1, 30, 12, 0, 12, 29, 0, 29, 0, 31, 5, 3, 2, 2, 0, 0, 0, 31, 0, 0, 0, 30, 0, 31, 28, 31,
+    4, 4, 1, 1, 2, 2, 3, 0, 5, 3, 5, 2, 5, 3, 2, 31, 4, 2, 1, 0, 2, 1, 0, 30, 3, 0, 0, 30, 3, 29, 26, 30,
+    3, 3, 0, 0, 0, 28, 0, 31, 0, 0, 0, 30, 26, 29, 23, 31, 3, 3, 0, 31, 0, 30, 26, 30, 0, 30, 23, 30, 26, 30, 26, 31,
+    15, 4, 7, 4, 11, 4, 7, 30, 13, 4, 7, 4, 11, 4, 7, 31, 13, 1, 1, 30, 2, 28, 1, 31, 2, 1, 1, 30, 2, 29, 28, 31,
+    14, 9, 13, 29, 13, 28, 11, 31, 14, 27, 23, 29, 28, 29, 26, 31, 12, 9, 11, 31, 26, 31, 28, 31, 0, 30, 23, 30, 28, 30, 26, 31,
+    12, 9, 4, 4, 10, 27, 4, 29, 10, 4, 4, 30, 23, 27, 23, 31, 13, 1, 1, 31, 25, 27, 26, 30, 2, 29, 19, 30, 22, 27, 22, 30,
+    12, 9, 0, 30, 21, 27, 22, 29, 24, 24, 23, 27, 23, 23, 23, 28, 22, 27, 22, 29, 25, 29, 26, 30, 21, 27, 24, 28, 22, 29, 24, 30,
+    12, 3, 6, 3, 9, 3, 5, 3, 13, 5, 10, 5, 9, 8, 9, 5, 6, 3, 1, 1, 5, 3, 1, 1, 9, 4, 4, 1, 9, 4, 4, 1,
+    15, 4, 15, 4, 11, 4, 11, 4, 14, 9, 15, 4, 11, 4, 11, 4, 15, 4, 13, 4, 11, 4, 7, 4, 13, 4, 7, 4, 11, 4, 7, 30,
+    13, 5, 9, 4, 9, 8, 9, 4, 8, 8, 9, 8, 8, 8, 9, 8, 10, 5, 4, 1, 9, 5, 4, 1, 9, 8, 4, 4, 9, 8, 4, 30,
+    14, 9, 13, 4, 11, 4, 11, 4, 14, 4, 13, 4, 11, 4, 11, 4, 15, 4, 7, 4, 11, 4, 7, 30, 13, 4, 7, 4, 11, 4, 7, 31,
+    15, 8, 12, 8, 8, 8, 9, 8, 15, 8, 12, 8, 8, 8, 9, 8, 12, 8, 7, 4, 9, 8, 4, 4, 10, 8, 7, 4, 9, 8, 4, 4,
+    15, 7, 15, 7, 11, 9, 11, 4, 14, 7, 15, 7, 11, 9, 11, 26, 15, 7, 13, 7, 11, 4, 7, 4, 13, 7, 7, 27, 11, 4, 7, 27,
+    15, 8, 10, 8, 8, 8, 9, 8, 14, 8, 10, 8, 8, 8, 9, 8, 12, 8, 7, 4, 9, 8, 4, 4, 10, 8, 7, 4, 9, 8, 4, 27,
+    14, 7, 13, 7, 11, 9, 11, 4, 14, 7, 13, 7, 11, 4, 25, 25, 15, 7, 7, 27, 11, 26, 7, 27, 13, 7, 24, 25, 25, 25, 24, 25,
+    9, 3, 5, 3, 3, 3, 3, 3, 6, 3, 6, 3, 5, 3, 5, 3, 5, 3, 1, 1, 3, 3, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1,
+    11, 4, 11, 4, 1, 1, 1, 1, 13, 1, 13, 1, 2, 1, 2, 28, 11, 4, 7, 4, 1, 1, 1, 31, 1, 1, 1, 30, 1, 1, 1, 31,
+    6, 3, 2, 2, 5, 3, 2, 2, 9, 2, 4, 2, 9, 2, 4, 2, 6, 3, 1, 1, 5, 3, 1, 1, 4, 2, 1, 1, 4, 2, 1, 31,
+    13, 1, 1, 1, 2, 1, 1, 1, 4, 1, 2, 1, 4, 1, 2, 29, 13, 1, 1, 30, 2, 28, 1, 31, 2, 1, 1, 30, 2, 29, 28, 31,
+    12, 8, 7, 4, 9, 8, 4, 4, 10, 8, 7, 4, 9, 8, 4, 4, 7, 4, 1, 1, 4, 4, 1, 1, 8, 4, 2, 1, 8, 4, 2, 28,
+    14, 4, 13, 2, 4, 4, 2, 2, 14, 4, 13, 27, 4, 4, 21, 28, 13, 2, 7, 28, 2, 2, 1, 31, 4, 2, 21, 27, 4, 22, 25, 29,
+    10, 8, 8, 4, 9, 8, 8, 4, 9, 8, 8, 4, 9, 8, 22, 26, 7, 4, 2, 1, 4, 4, 2, 28, 8, 4, 4, 1, 22, 26, 22, 27,
+    14, 4, 4, 2, 4, 4, 4, 22, 4, 4, 24, 24, 21, 27, 25, 26, 13, 27, 21, 27, 21, 28, 25, 29, 24, 24, 24, 25, 25, 26, 24, 26,
+    13, 5, 10, 5, 6, 3, 6, 3, 13, 6, 6, 6, 11, 5, 6, 5, 9, 4, 4, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 29,
+    14, 9, 15, 4, 13, 1, 13, 1, 15, 10, 15, 23, 12, 9, 13, 27, 13, 4, 7, 4, 1, 1, 1, 30, 14, 0, 13, 23, 13, 0, 23, 29,
+    13, 3, 11, 3, 11, 3, 5, 4, 13, 5, 10, 4, 11, 5, 10, 4, 11, 3, 1, 1, 3, 3, 1, 1, 2, 2, 1, 1, 2, 2, 1, 30,
+    15, 9, 14, 9, 12, 9, 12, 9, 15, 9, 14, 23, 12, 9, 26, 29, 14, 9, 13, 29, 13, 28, 11, 31, 14, 27, 23, 29, 28, 29, 26, 31,
+    15, 7, 15, 7, 11, 9, 11, 4, 14, 7, 15, 7, 11, 9, 11, 26, 14, 4, 13, 2, 4, 4, 2, 2, 14, 4, 13, 27, 4, 4, 21, 28,
+    15, 7, 15, 7, 12, 9, 13, 9, 15, 12, 15, 23, 12, 19, 22, 22, 14, 7, 13, 29, 13, 5, 26, 28, 14, 19, 23, 23, 19, 21, 22, 27,
+    14, 9, 12, 9, 11, 9, 10, 9, 14, 9, 12, 22, 11, 22, 10, 28, 15, 4, 13, 2, 19, 28, 21, 28, 14, 4, 21, 22, 21, 26, 21, 27,
+    15, 10, 14, 10, 12, 21, 12, 21, 15, 24, 22, 23, 21, 21, 25, 26, 15, 22, 25, 28, 21, 26, 25, 27, 24, 24, 24, 26, 25, 25, 24, 26,
+    9, 8, 9, 5, 5, 3, 5, 3, 11, 5, 6, 5, 6, 3, 6, 3, 9, 4, 4, 1, 2, 2, 1, 1, 2, 2, 1, 29, 2, 2, 1, 30,
+    11, 4, 11, 4, 2, 1, 2, 28, 12, 9, 13, 27, 11, 0, 26, 27, 11, 4, 7, 30, 1, 1, 1, 31, 13, 0, 23, 29, 0, 31, 26, 30,
+    11, 3, 3, 3, 3, 3, 3, 3, 10, 3, 5, 2, 5, 3, 5, 29, 5, 4, 1, 1, 3, 3, 1, 31, 3, 2, 1, 29, 3, 31, 25, 30,
+    12, 9, 13, 28, 1, 1, 26, 31, 15, 1, 23, 27, 2, 29, 26, 29, 12, 9, 11, 31, 26, 31, 28, 31, 0, 30, 23, 30, 28, 30, 26, 31,
+    15, 7, 13, 7, 11, 4, 7, 4, 13, 7, 7, 27, 11, 4, 7, 27, 13, 2, 7, 28, 2, 2, 1, 31, 4, 2, 21, 27, 4, 22, 25, 29,
+    14, 7, 13, 29, 13, 5, 26, 28, 14, 19, 23, 23, 19, 21, 22, 27, 13, 7, 7, 30, 1, 31, 26, 31, 14, 19, 23, 23, 19, 22, 22, 29,
+    12, 9, 11, 4, 10, 9, 4, 31, 13, 4, 21, 27, 10, 22, 22, 29, 13, 2, 1, 31, 21, 28, 22, 31, 19, 21, 21, 27, 22, 26, 22, 29,
+    15, 2, 26, 29, 19, 22, 21, 31, 24, 24, 22, 23, 21, 22, 22, 28, 21, 27, 25, 29, 21, 28, 25, 30, 24, 24, 23, 26, 25, 26, 24, 29,
+    12, 3, 6, 3, 9, 3, 5, 3, 10, 5, 6, 5, 9, 5, 5, 5, 6, 3, 2, 1, 5, 3, 2, 1, 9, 4, 2, 1, 9, 4, 2, 27,
+    14, 9, 14, 4, 11, 9, 10, 4, 14, 9, 12, 9, 11, 9, 10, 27, 14, 4, 4, 4, 10, 4, 4, 4, 10, 4, 4, 4, 10, 4, 4, 29,
+    10, 5, 9, 4, 9, 5, 9, 4, 9, 8, 9, 4, 8, 8, 9, 4, 6, 5, 2, 1, 5, 5, 2, 27, 9, 4, 8, 1, 9, 4, 23, 23,
+    14, 9, 10, 4, 11, 9, 10, 4, 14, 9, 10, 4, 11, 23, 23, 27, 12, 9, 4, 4, 10, 27, 4, 29, 10, 4, 4, 30, 23, 27, 23, 31,
+    15, 8, 10, 8, 8, 8, 9, 8, 14, 8, 10, 8, 8, 8, 9, 8, 10, 8, 8, 4, 9, 8, 8, 4, 9, 8, 8, 4, 9, 8, 22, 26,
+    14, 9, 12, 9, 11, 9, 10, 9, 14, 9, 12, 22, 11, 22, 10, 28, 12, 9, 11, 4, 10, 9, 4, 31, 13, 4, 21, 27, 10, 22, 22, 29,
+    14, 8, 9, 8, 8, 8, 9, 8, 8, 8, 9, 8, 8, 23, 23, 23, 10, 8, 8, 4, 9, 8, 22, 26, 9, 8, 8, 4, 23, 23, 23, 23,
+    14, 9, 13, 4, 11, 22, 10, 22, 14, 9, 10, 24, 23, 23, 23, 23, 12, 22, 21, 27, 10, 28, 22, 29, 10, 24, 24, 25, 23, 23, 23, 27,
+    9, 3, 5, 3, 3, 3, 3, 3, 6, 3, 6, 3, 5, 3, 5, 3, 5, 3, 2, 1, 3, 3, 2, 1, 2, 2, 2, 1, 2, 2, 2, 29,
+    11, 9, 10, 4, 19, 28, 25, 28, 12, 9, 13, 1, 21, 26, 25, 27, 10, 4, 4, 4, 25, 28, 28, 31, 1, 1, 1, 31, 22, 28, 26, 30,
+    6, 3, 2, 2, 5, 3, 2, 2, 9, 3, 4, 2, 9, 2, 4, 27, 6, 3, 2, 1, 5, 3, 2, 29, 4, 2, 2, 1, 4, 27, 22, 29,
+    12, 9, 1, 1, 21, 26, 22, 28, 15, 1, 2, 29, 22, 23, 22, 27, 13, 1, 1, 31, 25, 27, 26, 30, 2, 29, 19, 30, 22, 27, 22, 30,
+    12, 8, 7, 4, 9, 8, 4, 4, 10, 8, 7, 4, 9, 8, 4, 27, 7, 4, 2, 1, 4, 4, 2, 28, 8, 4, 4, 1, 22, 26, 22, 27,
+    15, 4, 13, 2, 19, 28, 21, 28, 14, 4, 21, 22, 21, 26, 21, 27, 13, 2, 1, 31, 21, 28, 22, 31, 19, 21, 21, 27, 22, 26, 22, 29,
+    10, 8, 8, 4, 9, 8, 22, 26, 9, 8, 8, 4, 23, 23, 23, 23, 7, 4, 4, 1, 4, 27, 22, 27, 8, 4, 8, 1, 23, 23, 23, 23,
+    14, 4, 19, 21, 21, 26, 22, 26, 19, 24, 21, 24, 23, 23, 23, 23, 21, 22, 21, 27, 21, 27, 22, 29, 21, 24, 24, 25, 23, 23, 23, 27,
+    10, 5, 6, 5, 6, 3, 6, 3, 13, 6, 6, 6, 6, 5, 6, 5, 9, 4, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 24, 26,
+    14, 9, 12, 9, 12, 9, 13, 1, 15, 10, 14, 27, 12, 24, 24, 26, 10, 4, 4, 4, 1, 1, 1, 31, 15, 24, 23, 27, 21, 27, 25, 28,
+    13, 3, 5, 3, 11, 3, 5, 3, 13, 5, 11, 4, 11, 5, 4, 26, 5, 3, 2, 1, 3, 3, 2, 27, 3, 2, 2, 24, 22, 23, 23, 26,
+    15, 9, 12, 9, 12, 22, 22, 27, 15, 24, 24, 27, 22, 23, 25, 28, 12, 9, 0, 30, 21, 27, 22, 29, 24, 24, 23, 27, 23, 23, 23, 28,
+    14, 7, 13, 7, 11, 9, 11, 4, 14, 7, 13, 7, 11, 4, 25, 25, 14, 4, 4, 2, 4, 4, 4, 22, 4, 4, 24, 24, 21, 27, 25, 26,
+    15, 10, 14, 10, 12, 21, 12, 21, 15, 24, 22, 23, 21, 21, 25, 26, 15, 2, 26, 29, 19, 22, 21, 31, 24, 24, 22, 23, 21, 22, 22, 28,
+    14, 9, 13, 4, 11, 22, 10, 22, 14, 9, 10, 24, 23, 23, 23, 23, 14, 4, 19, 21, 21, 26, 22, 26, 19, 24, 21, 24, 23, 23, 23, 23,
+    15, 9, 12, 27, 21, 22, 22, 22, 15, 24, 22, 23, 23, 23, 23, 28, 21, 22, 21, 27, 21, 28, 22, 29, 24, 24, 22, 26, 23, 23, 23, 27,
+    9, 5, 5, 5, 5, 3, 5, 3, 6, 5, 6, 5, 6, 3, 6, 25, 9, 4, 2, 27, 2, 2, 2, 29, 2, 2, 24, 26, 25, 28, 24, 28,
+    11, 9, 10, 27, 21, 26, 25, 27, 12, 24, 24, 26, 25, 25, 24, 25, 10, 4, 4, 29, 22, 28, 26, 30, 21, 27, 25, 28, 25, 28, 24, 31,
+    11, 3, 3, 3, 3, 3, 3, 29, 10, 3, 5, 25, 5, 26, 24, 26, 5, 3, 2, 27, 3, 29, 26, 29, 3, 27, 24, 26, 22, 28, 24, 29,
+    12, 22, 21, 27, 21, 28, 25, 29, 21, 24, 24, 26, 22, 26, 24, 27, 22, 27, 22, 29, 25, 29, 26, 30, 21, 27, 24, 28, 22, 29, 24, 30,
+    15, 7, 7, 27, 11, 26, 7, 27, 13, 7, 24, 25, 25, 25, 24, 25, 13, 27, 21, 27, 21, 28, 25, 29, 24, 24, 24, 25, 25, 26, 24, 26,
+    15, 22, 25, 28, 21, 26, 25, 27, 24, 24, 24, 26, 25, 25, 24, 26, 21, 27, 25, 29, 21, 28, 25, 30, 24, 24, 23, 26, 25, 26, 24, 29,
+    12, 22, 21, 27, 10, 28, 22, 29, 10, 24, 24, 25, 23, 23, 23, 27, 21, 22, 21, 27, 21, 27, 22, 29, 21, 24, 24, 25, 23, 23, 23, 27,
+    21, 22, 21, 27, 21, 28, 22, 29, 24, 24, 22, 26, 23, 23, 23, 27, 21, 22, 21, 31, 21, 27, 22, 30, 21, 24, 22, 26, 23, 23, 23, 29,
+    6, 3, 3, 0, 7, 2, 0, 0, 11, 4, 0, 0, 4, 4, 1, 0, 5, 3, 3, 0, 5, 2, 0, 0, 2, 2, 2, 0, 2, 2, 0, 0,
+    9, 4, 5, 3, 4, 2, 1, 1, 13, 3, 10, 2, 5, 3, 2, 2, 8, 4, 5, 3, 4, 2, 1, 1, 11, 3, 4, 2, 5, 3, 2, 2,
+    7, 4, 0, 0, 6, 3, 0, 0, 11, 4, 3, 1, 4, 4, 1, 1, 4, 4, 0, 0, 5, 2, 0, 0, 2, 2, 2, 2, 2, 2, 3, 0,
+    8, 4, 9, 1, 9, 2, 2, 1, 13, 3, 4, 2, 5, 3, 5, 2, 8, 4, 9, 1, 4, 2, 2, 1, 11, 3, 4, 2, 5, 3, 2, 31,
+    13, 5, 9, 4, 6, 3, 2, 2, 13, 3, 11, 3, 11, 3, 3, 3, 9, 8, 9, 4, 5, 3, 2, 2, 11, 3, 5, 4, 3, 3, 3, 3,
+    8, 8, 9, 8, 9, 2, 4, 2, 13, 5, 10, 4, 10, 3, 5, 2, 8, 8, 9, 8, 9, 2, 4, 2, 11, 5, 10, 4, 5, 3, 5, 29,
+    10, 5, 9, 4, 6, 3, 2, 2, 13, 3, 5, 3, 11, 3, 3, 3, 9, 5, 9, 4, 5, 3, 2, 2, 11, 3, 5, 3, 3, 3, 3, 29,
+    9, 8, 9, 4, 9, 3, 4, 2, 13, 5, 11, 4, 10, 3, 5, 25, 8, 8, 9, 4, 9, 2, 4, 27, 11, 5, 4, 26, 5, 26, 24, 26,
+    5, 3, 3, 0, 5, 2, 0, 0, 2, 2, 2, 0, 2, 2, 0, 0, 3, 3, 3, 0, 2, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0,
+    5, 3, 5, 3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 5, 2, 5, 3, 2, 1, 1, 1, 0, 0, 1, 30, 0, 0, 0, 31,
+    6, 3, 0, 0, 7, 1, 0, 0, 4, 2, 0, 0, 4, 2, 1, 0, 5, 2, 0, 0, 4, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 30,
+    9, 2, 2, 1, 4, 1, 1, 1, 3, 0, 1, 1, 3, 0, 0, 30, 4, 2, 2, 1, 4, 1, 1, 30, 3, 27, 1, 30, 3, 29, 26, 30,
+    10, 5, 4, 1, 6, 3, 1, 1, 11, 3, 1, 1, 5, 4, 1, 1, 9, 5, 4, 1, 5, 3, 1, 1, 3, 3, 1, 1, 3, 3, 1, 31,
+    9, 8, 4, 4, 4, 2, 1, 1, 2, 2, 1, 1, 3, 2, 1, 29, 9, 8, 4, 30, 4, 2, 1, 31, 2, 2, 1, 30, 3, 31, 25, 30,
+    6, 5, 2, 1, 6, 3, 2, 1, 5, 3, 2, 1, 5, 3, 2, 27, 5, 5, 2, 27, 5, 3, 2, 29, 3, 3, 2, 27, 3, 29, 26, 29,
+    9, 4, 8, 1, 4, 2, 2, 1, 3, 2, 2, 24, 3, 27, 24, 26, 9, 4, 23, 23, 4, 27, 22, 29, 22, 23, 23, 26, 22, 28, 24, 29,
+    9, 4, 5, 3, 4, 2, 1, 1, 13, 3, 10, 2, 5, 3, 2, 2, 5, 3, 5, 3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 3, 6, 3, 3, 1, 1, 1, 15, 0, 14, 27, 0, 0, 0, 30, 6, 3, 6, 3, 2, 1, 1, 1, 12, 0, 12, 29, 0, 0, 0, 30,
+    11, 4, 3, 1, 4, 2, 0, 0, 12, 3, 0, 0, 3, 3, 0, 0, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 28, 0, 31,
+    13, 3, 4, 2, 3, 0, 1, 1, 15, 0, 12, 29, 0, 0, 0, 30, 11, 3, 4, 2, 3, 27, 1, 30, 12, 23, 23, 29, 26, 29, 23, 31,
+    14, 9, 13, 4, 13, 1, 1, 1, 15, 9, 14, 9, 12, 9, 13, 28, 11, 4, 11, 4, 2, 1, 1, 1, 12, 9, 12, 9, 1, 1, 26, 31,
+    14, 4, 13, 4, 4, 1, 2, 1, 15, 9, 14, 23, 15, 1, 23, 27, 11, 4, 11, 4, 4, 1, 2, 29, 12, 9, 26, 29, 2, 29, 26, 29,
+    14, 9, 10, 4, 12, 9, 1, 1, 15, 9, 12, 9, 12, 22, 21, 27, 11, 9, 10, 4, 21, 26, 22, 28, 12, 22, 22, 27, 21, 28, 25, 29,
+    14, 9, 10, 4, 15, 1, 2, 29, 15, 24, 24, 27, 21, 24, 24, 26, 11, 23, 23, 27, 22, 23, 22, 27, 22, 23, 25, 28, 22, 26, 24, 27,
+    8, 4, 5, 3, 4, 2, 1, 1, 11, 3, 4, 2, 5, 3, 2, 2, 5, 2, 5, 3, 2, 1, 1, 1, 0, 0, 1, 30, 0, 0, 0, 31,
+    6, 3, 6, 3, 2, 1, 1, 1, 12, 0, 12, 29, 0, 0, 0, 30, 6, 3, 6, 3, 3, 0, 1, 31, 0, 29, 0, 31, 0, 31, 28, 31,
+    4, 4, 1, 1, 4, 2, 1, 0, 3, 3, 0, 0, 3, 3, 0, 31, 2, 2, 3, 0, 2, 1, 0, 30, 0, 28, 0, 31, 0, 30, 26, 30,
+    5, 3, 5, 2, 3, 0, 0, 30, 0, 0, 0, 30, 0, 30, 23, 30, 5, 3, 2, 31, 3, 29, 26, 30, 26, 29, 23, 31, 26, 30, 26, 31,
+    15, 4, 7, 4, 13, 1, 1, 30, 14, 9, 13, 29, 12, 9, 11, 31, 11, 4, 7, 30, 2, 28, 1, 31, 13, 28, 11, 31, 26, 31, 28, 31,
+    13, 4, 7, 4, 2, 1, 1, 30, 14, 27, 23, 29, 0, 30, 23, 30, 11, 4, 7, 31, 2, 29, 28, 31, 28, 29, 26, 31, 28, 30, 26, 31,
+    12, 9, 4, 4, 13, 1, 1, 31, 12, 9, 0, 30, 22, 27, 22, 29, 10, 27, 4, 29, 25, 27, 26, 30, 21, 27, 22, 29, 25, 29, 26, 30,
+    10, 4, 4, 30, 2, 29, 19, 30, 24, 24, 23, 27, 21, 27, 24, 28, 23, 27, 23, 31, 22, 27, 22, 30, 23, 23, 23, 28, 22, 29, 24, 30,
+    7, 4, 0, 0, 6, 3, 0, 0, 11, 4, 3, 1, 4, 4, 1, 1, 6, 3, 0, 0, 7, 1, 0, 0, 4, 2, 0, 0, 4, 2, 1, 0,
+    11, 4, 3, 1, 4, 2, 0, 0, 12, 3, 0, 0, 3, 3, 0, 0, 4, 4, 1, 1, 4, 2, 1, 0, 3, 3, 0, 0, 3, 3, 0, 31,
+    7, 6, 0, 0, 7, 5, 0, 0, 11, 4, 1, 1, 4, 4, 1, 1, 7, 5, 0, 0, 6, 3, 0, 0, 4, 2, 1, 1, 4, 2, 1, 28,
+    11, 4, 1, 1, 4, 2, 1, 1, 12, 3, 3, 0, 3, 3, 3, 27, 4, 4, 1, 1, 4, 2, 1, 28, 3, 3, 3, 27, 25, 28, 25, 28,
+    13, 6, 2, 2, 11, 5, 2, 2, 13, 5, 2, 2, 11, 5, 2, 2, 11, 5, 2, 2, 6, 3, 2, 2, 10, 3, 3, 2, 5, 3, 3, 31,
+    13, 5, 2, 2, 10, 3, 3, 2, 12, 3, 3, 3, 12, 3, 3, 28, 11, 5, 2, 2, 5, 3, 3, 31, 12, 3, 3, 28, 3, 3, 25, 30,
+    13, 6, 2, 2, 6, 5, 2, 2, 13, 5, 3, 2, 11, 5, 22, 23, 6, 5, 2, 2, 6, 3, 25, 28, 10, 3, 3, 27, 5, 26, 22, 28,
+    13, 5, 3, 2, 10, 3, 3, 27, 12, 3, 3, 24, 22, 23, 22, 26, 11, 5, 22, 23, 5, 26, 22, 28, 22, 23, 22, 26, 22, 28, 24, 28,
+    4, 4, 0, 0, 5, 2, 0, 0, 2, 2, 2, 2, 2, 2, 3, 0, 5, 2, 0, 0, 4, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 30,
+    2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 28, 0, 31, 2, 2, 3, 0, 2, 1, 0, 30, 0, 28, 0, 31, 0, 30, 26, 30,
+    7, 5, 0, 0, 6, 3, 0, 0, 4, 2, 1, 1, 4, 2, 1, 28, 6, 3, 0, 0, 7, 0, 0, 31, 4, 1, 0, 28, 4, 27, 24, 30,
+    4, 2, 1, 1, 4, 1, 0, 28, 3, 0, 0, 27, 25, 26, 25, 28, 4, 2, 1, 28, 4, 27, 24, 30, 25, 26, 25, 28, 24, 29, 24, 31,
+    6, 6, 1, 1, 6, 5, 1, 29, 10, 4, 1, 1, 10, 4, 1, 30, 6, 5, 1, 29, 6, 3, 1, 30, 5, 2, 1, 29, 5, 29, 25, 30,
+    10, 4, 1, 1, 5, 2, 1, 29, 3, 3, 0, 27, 3, 28, 25, 30, 10, 4, 1, 30, 5, 29, 25, 30, 3, 28, 25, 30, 25, 30, 25, 30,
+    6, 6, 2, 1, 6, 5, 24, 26, 11, 4, 2, 24, 4, 26, 23, 26, 6, 5, 24, 26, 6, 25, 24, 28, 5, 25, 24, 26, 24, 26, 24, 29,
+    11, 4, 2, 24, 5, 25, 24, 26, 3, 24, 24, 24, 22, 26, 22, 26, 4, 26, 23, 26, 24, 26, 24, 29, 22, 26, 22, 26, 24, 28, 24, 28,
+    8, 4, 9, 1, 9, 2, 2, 1, 13, 3, 4, 2, 5, 3, 5, 2, 9, 2, 2, 1, 4, 1, 1, 1, 3, 0, 1, 1, 3, 0, 0, 30,
+    13, 3, 4, 2, 3, 0, 1, 1, 15, 0, 12, 29, 0, 0, 0, 30, 5, 3, 5, 2, 3, 0, 0, 30, 0, 0, 0, 30, 0, 30, 23, 30,
+    11, 4, 1, 1, 4, 2, 1, 1, 12, 3, 3, 0, 3, 3, 3, 27, 4, 2, 1, 1, 4, 1, 0, 28, 3, 0, 0, 27, 25, 26, 25, 28,
+    12, 3, 3, 0, 3, 0, 0, 27, 15, 0, 0, 30, 23, 27, 23, 30, 3, 3, 3, 27, 25, 26, 25, 28, 23, 27, 23, 30, 25, 28, 25, 31,
+    15, 10, 14, 0, 12, 9, 13, 0, 15, 9, 14, 27, 12, 9, 28, 29, 12, 9, 13, 0, 11, 0, 0, 31, 15, 1, 0, 30, 2, 29, 28, 30,
+    15, 9, 14, 27, 15, 1, 0, 30, 15, 0, 23, 23, 15, 27, 26, 29, 12, 9, 28, 29, 2, 29, 28, 30, 15, 27, 26, 29, 23, 30, 26, 30,
+    15, 10, 15, 24, 12, 24, 21, 27, 15, 24, 24, 24, 22, 23, 23, 23, 12, 24, 21, 27, 25, 25, 25, 28, 21, 24, 21, 27, 22, 26, 22, 29,
+    15, 24, 24, 24, 21, 24, 21, 27, 15, 24, 24, 27, 22, 23, 22, 28, 22, 23, 23, 23, 22, 26, 22, 29, 22, 23, 22, 28, 22, 28, 24, 28,
+    8, 4, 9, 1, 4, 2, 2, 1, 11, 3, 4, 2, 5, 3, 2, 31, 4, 2, 2, 1, 4, 1, 1, 30, 3, 27, 1, 30, 3, 29, 26, 30,
+    11, 3, 4, 2, 3, 27, 1, 30, 12, 23, 23, 29, 26, 29, 23, 31, 5, 3, 2, 31, 3, 29, 26, 30, 26, 29, 23, 31, 26, 30, 26, 31,
+    4, 4, 1, 1, 4, 2, 1, 28, 3, 3, 3, 27, 25, 28, 25, 28, 4, 2, 1, 28, 4, 27, 24, 30, 25, 26, 25, 28, 24, 29, 24, 31,
+    3, 3, 3, 27, 25, 26, 25, 28, 23, 27, 23, 30, 25, 28, 25, 31, 25, 28, 25, 28, 24, 29, 24, 31, 25, 28, 25, 31, 24, 30, 24, 31,
+    15, 23, 13, 23, 13, 27, 23, 29, 14, 23, 23, 29, 26, 29, 26, 31, 13, 27, 23, 29, 26, 27, 26, 30, 23, 27, 23, 30, 26, 29, 26, 31,
+    14, 23, 23, 29, 23, 27, 23, 30, 23, 23, 23, 29, 26, 29, 23, 31, 26, 29, 26, 31, 26, 29, 26, 31, 26, 29, 23, 31, 26, 30, 26, 31,
+    14, 27, 23, 27, 24, 26, 25, 28, 24, 27, 23, 27, 25, 28, 23, 28, 24, 26, 25, 28, 24, 25, 24, 31, 24, 26, 24, 28, 24, 27, 24, 30,
+    24, 27, 23, 27, 24, 26, 24, 28, 24, 27, 23, 30, 22, 28, 23, 31, 25, 28, 23, 28, 24, 27, 24, 30, 22, 28, 23, 31, 24, 28, 24, 31,
+    13, 5, 9, 4, 6, 3, 2, 2, 13, 3, 11, 3, 11, 3, 3, 3, 10, 5, 4, 1, 6, 3, 1, 1, 11, 3, 1, 1, 5, 4, 1, 1,
+    14, 9, 13, 4, 13, 1, 1, 1, 15, 9, 14, 9, 12, 9, 13, 28, 15, 4, 7, 4, 13, 1, 1, 30, 14, 9, 13, 29, 12, 9, 11, 31,
+    13, 6, 2, 2, 11, 5, 2, 2, 13, 5, 2, 2, 11, 5, 2, 2, 6, 6, 1, 1, 6, 5, 1, 29, 10, 4, 1, 1, 10, 4, 1, 30,
+    15, 10, 14, 0, 12, 9, 13, 0, 15, 9, 14, 27, 12, 9, 28, 29, 15, 23, 13, 23, 13, 27, 23, 29, 14, 23, 23, 29, 26, 29, 26, 31,
+    15, 7, 14, 4, 11, 9, 4, 4, 14, 9, 15, 4, 11, 9, 19, 28, 15, 7, 13, 2, 11, 4, 2, 2, 12, 9, 13, 2, 10, 9, 21, 28,
+    15, 7, 14, 7, 12, 9, 13, 5, 15, 10, 15, 22, 12, 21, 21, 26, 15, 7, 13, 29, 13, 9, 26, 28, 14, 10, 25, 28, 12, 21, 25, 27,
+    14, 7, 14, 4, 11, 9, 4, 4, 14, 9, 14, 4, 11, 22, 21, 26, 15, 7, 13, 27, 11, 26, 21, 28, 12, 22, 21, 22, 10, 28, 21, 27,
+    15, 12, 14, 19, 12, 19, 19, 21, 15, 24, 24, 24, 21, 21, 25, 25, 15, 23, 23, 23, 22, 22, 22, 27, 22, 23, 24, 26, 25, 26, 24, 26,
+    9, 8, 9, 4, 5, 3, 2, 2, 11, 3, 5, 4, 3, 3, 3, 3, 9, 5, 4, 1, 5, 3, 1, 1, 3, 3, 1, 1, 3, 3, 1, 31,
+    11, 4, 11, 4, 2, 1, 1, 1, 12, 9, 12, 9, 1, 1, 26, 31, 11, 4, 7, 30, 2, 28, 1, 31, 13, 28, 11, 31, 26, 31, 28, 31,
+    11, 5, 2, 2, 6, 3, 2, 2, 10, 3, 3, 2, 5, 3, 3, 31, 6, 5, 1, 29, 6, 3, 1, 30, 5, 2, 1, 29, 5, 29, 25, 30,
+    12, 9, 13, 0, 11, 0, 0, 31, 15, 1, 0, 30, 2, 29, 28, 30, 13, 27, 23, 29, 26, 27, 26, 30, 23, 27, 23, 30, 26, 29, 26, 31,
+    15, 7, 13, 2, 11, 4, 2, 2, 12, 9, 13, 2, 10, 9, 21, 28, 13, 7, 7, 28, 7, 4, 1, 31, 11, 4, 1, 31, 4, 31, 22, 31,
+    14, 7, 13, 7, 13, 5, 1, 31, 15, 2, 21, 27, 19, 22, 21, 28, 13, 29, 7, 30, 26, 28, 26, 31, 26, 29, 25, 29, 21, 31, 25, 30,
+    13, 7, 4, 2, 11, 4, 4, 22, 13, 4, 19, 21, 10, 22, 22, 26, 7, 27, 21, 27, 7, 27, 25, 29, 21, 27, 21, 27, 22, 29, 22, 29,
+    14, 19, 14, 19, 19, 21, 19, 22, 24, 24, 24, 24, 21, 22, 25, 26, 23, 23, 23, 23, 22, 27, 22, 29, 22, 23, 23, 26, 22, 28, 24, 29,
+    8, 8, 9, 8, 9, 2, 4, 2, 13, 5, 10, 4, 10, 3, 5, 2, 9, 8, 4, 4, 4, 2, 1, 1, 2, 2, 1, 1, 3, 2, 1, 29,
+    14, 4, 13, 4, 4, 1, 2, 1, 15, 9, 14, 23, 15, 1, 23, 27, 13, 4, 7, 4, 2, 1, 1, 30, 14, 27, 23, 29, 0, 30, 23, 30,
+    13, 5, 2, 2, 10, 3, 3, 2, 12, 3, 3, 3, 12, 3, 3, 28, 10, 4, 1, 1, 5, 2, 1, 29, 3, 3, 0, 27, 3, 28, 25, 30,
+    15, 9, 14, 27, 15, 1, 0, 30, 15, 0, 23, 23, 15, 27, 26, 29, 14, 23, 23, 29, 23, 27, 23, 30, 23, 23, 23, 29, 26, 29, 23, 31,
+    15, 7, 14, 7, 12, 9, 13, 5, 15, 10, 15, 22, 12, 21, 21, 26, 14, 7, 13, 7, 13, 5, 1, 31, 15, 2, 21, 27, 19, 22, 21, 28,
+    14, 7, 14, 7, 15, 0, 23, 27, 15, 19, 22, 23, 19, 19, 22, 22, 14, 7, 13, 29, 23, 27, 28, 29, 14, 27, 23, 27, 19, 21, 22, 27,
+    15, 10, 15, 2, 12, 21, 19, 22, 15, 9, 21, 22, 21, 22, 21, 28, 15, 22, 21, 27, 21, 26, 21, 28, 21, 22, 21, 22, 21, 28, 21, 27,
+    15, 19, 14, 27, 19, 19, 19, 21, 15, 24, 22, 23, 21, 21, 25, 26, 22, 23, 23, 27, 22, 22, 22, 27, 22, 23, 24, 28, 25, 26, 24, 26,
+    8, 8, 9, 8, 9, 2, 4, 2, 11, 5, 10, 4, 5, 3, 5, 29, 9, 8, 4, 30, 4, 2, 1, 31, 2, 2, 1, 30, 3, 31, 25, 30,
+    11, 4, 11, 4, 4, 1, 2, 29, 12, 9, 26, 29, 2, 29, 26, 29, 11, 4, 7, 31, 2, 29, 28, 31, 28, 29, 26, 31, 28, 30, 26, 31,
+    11, 5, 2, 2, 5, 3, 3, 31, 12, 3, 3, 28, 3, 3, 25, 30, 10, 4, 1, 30, 5, 29, 25, 30, 3, 28, 25, 30, 25, 30, 25, 30,
+    12, 9, 28, 29, 2, 29, 28, 30, 15, 27, 26, 29, 23, 30, 26, 30, 26, 29, 26, 31, 26, 29, 26, 31, 26, 29, 23, 31, 26, 30, 26, 31,
+    15, 7, 13, 29, 13, 9, 26, 28, 14, 10, 25, 28, 12, 21, 25, 27, 13, 29, 7, 30, 26, 28, 26, 31, 26, 29, 25, 29, 21, 31, 25, 30,
+    14, 7, 13, 29, 23, 27, 28, 29, 14, 27, 23, 27, 19, 21, 22, 27, 13, 29, 7, 31, 28, 29, 28, 31, 28, 29, 23, 31, 19, 31, 22, 30,
+    14, 10, 26, 29, 12, 21, 21, 31, 12, 27, 21, 27, 22, 22, 22, 29, 25, 28, 25, 29, 25, 27, 25, 30, 21, 27, 21, 31, 22, 29, 22, 30,
+    14, 27, 28, 29, 19, 21, 19, 31, 24, 24, 22, 23, 21, 27, 22, 28, 23, 27, 23, 31, 22, 27, 22, 30, 22, 23, 25, 28, 22, 28, 24, 31,
+    10, 5, 9, 4, 6, 3, 2, 2, 13, 3, 5, 3, 11, 3, 3, 3, 6, 5, 2, 1, 6, 3, 2, 1, 5, 3, 2, 1, 5, 3, 2, 27,
+    14, 9, 10, 4, 12, 9, 1, 1, 15, 9, 12, 9, 12, 22, 21, 27, 12, 9, 4, 4, 13, 1, 1, 31, 12, 9, 0, 30, 22, 27, 22, 29,
+    13, 6, 2, 2, 6, 5, 2, 2, 13, 5, 3, 2, 11, 5, 22, 23, 6, 6, 2, 1, 6, 5, 24, 26, 11, 4, 2, 24, 4, 26, 23, 26,
+    15, 10, 15, 24, 12, 24, 21, 27, 15, 24, 24, 24, 22, 23, 23, 23, 14, 27, 23, 27, 24, 26, 25, 28, 24, 27, 23, 27, 25, 28, 23, 28,
+    14, 7, 14, 4, 11, 9, 4, 4, 14, 9, 14, 4, 11, 22, 21, 26, 13, 7, 4, 2, 11, 4, 4, 22, 13, 4, 19, 21, 10, 22, 22, 26,
+    15, 10, 15, 2, 12, 21, 19, 22, 15, 9, 21, 22, 21, 22, 21, 28, 14, 10, 26, 29, 12, 21, 21, 31, 12, 27, 21, 27, 22, 22, 22, 29,
+    14, 7, 4, 4, 11, 4, 21, 27, 14, 9, 19, 24, 23, 23, 23, 23, 13, 7, 24, 24, 25, 25, 25, 26, 10, 24, 21, 24, 23, 23, 23, 23,
+    15, 24, 24, 24, 21, 21, 21, 22, 15, 24, 24, 24, 23, 23, 23, 23, 22, 23, 22, 23, 25, 26, 22, 28, 22, 23, 22, 26, 23, 28, 23, 27,
+    9, 5, 9, 4, 5, 3, 2, 2, 11, 3, 5, 3, 3, 3, 3, 29, 5, 5, 2, 27, 5, 3, 2, 29, 3, 3, 2, 27, 3, 29, 26, 29,
+    11, 9, 10, 4, 21, 26, 22, 28, 12, 22, 22, 27, 21, 28, 25, 29, 10, 27, 4, 29, 25, 27, 26, 30, 21, 27, 22, 29, 25, 29, 26, 30,
+    6, 5, 2, 2, 6, 3, 25, 28, 10, 3, 3, 27, 5, 26, 22, 28, 6, 5, 24, 26, 6, 25, 24, 28, 5, 25, 24, 26, 24, 26, 24, 29,
+    12, 24, 21, 27, 25, 25, 25, 28, 21, 24, 21, 27, 22, 26, 22, 29, 24, 26, 25, 28, 24, 25, 24, 31, 24, 26, 24, 28, 24, 27, 24, 30,
+    15, 7, 13, 27, 11, 26, 21, 28, 12, 22, 21, 22, 10, 28, 21, 27, 7, 27, 21, 27, 7, 27, 25, 29, 21, 27, 21, 27, 22, 29, 22, 29,
+    15, 22, 21, 27, 21, 26, 21, 28, 21, 22, 21, 22, 21, 28, 21, 27, 25, 28, 25, 29, 25, 27, 25, 30, 21, 27, 21, 31, 22, 29, 22, 30,
+    13, 7, 24, 24, 25, 25, 25, 26, 10, 24, 21, 24, 23, 23, 23, 23, 24, 25, 24, 25, 24, 25, 24, 26, 24, 25, 24, 25, 23, 27, 23, 27,
+    24, 24, 24, 24, 25, 25, 25, 26, 24, 24, 21, 24, 23, 23, 23, 23, 24, 26, 23, 26, 24, 26, 24, 29, 22, 26, 22, 26, 23, 27, 23, 29,
+    9, 8, 9, 4, 9, 3, 4, 2, 13, 5, 11, 4, 10, 3, 5, 25, 9, 4, 8, 1, 4, 2, 2, 1, 3, 2, 2, 24, 3, 27, 24, 26,
+    14, 9, 10, 4, 15, 1, 2, 29, 15, 24, 24, 27, 21, 24, 24, 26, 10, 4, 4, 30, 2, 29, 19, 30, 24, 24, 23, 27, 21, 27, 24, 28,
+    13, 5, 3, 2, 10, 3, 3, 27, 12, 3, 3, 24, 22, 23, 22, 26, 11, 4, 2, 24, 5, 25, 24, 26, 3, 24, 24, 24, 22, 26, 22, 26,
+    15, 24, 24, 24, 21, 24, 21, 27, 15, 24, 24, 27, 22, 23, 22, 28, 24, 27, 23, 27, 24, 26, 24, 28, 24, 27, 23, 30, 22, 28, 23, 31,
+    15, 12, 14, 19, 12, 19, 19, 21, 15, 24, 24, 24, 21, 21, 25, 25, 14, 19, 14, 19, 19, 21, 19, 22, 24, 24, 24, 24, 21, 22, 25, 26,
+    15, 19, 14, 27, 19, 19, 19, 21, 15, 24, 22, 23, 21, 21, 25, 26, 14, 27, 28, 29, 19, 21, 19, 31, 24, 24, 22, 23, 21, 27, 22, 28,
+    15, 24, 24, 24, 21, 21, 21, 22, 15, 24, 24, 24, 23, 23, 23, 23, 24, 24, 24, 24, 25, 25, 25, 26, 24, 24, 21, 24, 23, 23, 23, 23,
+    15, 24, 24, 24, 21, 21, 21, 27, 15, 24, 22, 23, 23, 23, 23, 28, 22, 23, 22, 23, 25, 26, 22, 28, 22, 23, 24, 28, 23, 28, 23, 27,
+    8, 8, 9, 4, 9, 2, 4, 27, 11, 5, 4, 26, 5, 26, 24, 26, 9, 4, 23, 23, 4, 27, 22, 29, 22, 23, 23, 26, 22, 28, 24, 29,
+    11, 23, 23, 27, 22, 23, 22, 27, 22, 23, 25, 28, 22, 26, 24, 27, 23, 27, 23, 31, 22, 27, 22, 30, 23, 23, 23, 28, 22, 29, 24, 30,
+    11, 5, 22, 23, 5, 26, 22, 28, 22, 23, 22, 26, 22, 28, 24, 28, 4, 26, 23, 26, 24, 26, 24, 29, 22, 26, 22, 26, 24, 28, 24, 28,
+    22, 23, 23, 23, 22, 26, 22, 29, 22, 23, 22, 28, 22, 28, 24, 28, 25, 28, 23, 28, 24, 27, 24, 30, 22, 28, 23, 31, 24, 28, 24, 31,
+    15, 23, 23, 23, 22, 22, 22, 27, 22, 23, 24, 26, 25, 26, 24, 26, 23, 23, 23, 23, 22, 27, 22, 29, 22, 23, 23, 26, 22, 28, 24, 29,
+    22, 23, 23, 27, 22, 22, 22, 27, 22, 23, 24, 28, 25, 26, 24, 26, 23, 27, 23, 31, 22, 27, 22, 30, 22, 23, 25, 28, 22, 28, 24, 31,
+    22, 23, 22, 23, 25, 26, 22, 28, 22, 23, 22, 26, 23, 28, 23, 27, 24, 26, 23, 26, 24, 26, 24, 29, 22, 26, 22, 26, 23, 27, 23, 29,
+    22, 23, 22, 23, 25, 26, 22, 28, 22, 23, 24, 28, 23, 28, 23, 27, 24, 28, 25, 28, 24, 26, 24, 31, 24, 28, 22, 31, 23, 27, 23, 30,
+    12, 3, 6, 3, 6, 3, 1, 1, 15, 4, 15, 4, 15, 4, 13, 4, 9, 3, 5, 3, 5, 3, 1, 1, 11, 4, 11, 4, 11, 4, 7, 4,
+    13, 5, 10, 5, 9, 4, 4, 1, 14, 9, 15, 4, 13, 4, 7, 4, 9, 8, 9, 5, 9, 4, 4, 1, 11, 4, 11, 4, 11, 4, 7, 30,
+    13, 5, 9, 4, 10, 5, 4, 1, 14, 9, 13, 4, 15, 4, 7, 4, 9, 8, 9, 4, 9, 5, 4, 1, 11, 4, 11, 4, 11, 4, 7, 30,
+    8, 8, 9, 8, 9, 8, 4, 4, 14, 4, 13, 4, 13, 4, 7, 4, 8, 8, 9, 8, 9, 8, 4, 30, 11, 4, 11, 4, 11, 4, 7, 31,
+    15, 8, 12, 8, 12, 8, 7, 4, 15, 7, 15, 7, 15, 7, 13, 7, 8, 8, 9, 8, 9, 8, 4, 4, 11, 9, 11, 4, 11, 4, 7, 4,
+    15, 8, 12, 8, 10, 8, 7, 4, 14, 7, 15, 7, 13, 7, 7, 27, 8, 8, 9, 8, 9, 8, 4, 4, 11, 9, 11, 26, 11, 4, 7, 27,
+    15, 8, 10, 8, 12, 8, 7, 4, 14, 7, 13, 7, 15, 7, 7, 27, 8, 8, 9, 8, 9, 8, 4, 4, 11, 9, 11, 4, 11, 26, 7, 27,
+    14, 8, 10, 8, 10, 8, 7, 4, 14, 7, 13, 7, 13, 7, 24, 25, 8, 8, 9, 8, 9, 8, 4, 27, 11, 4, 25, 25, 25, 25, 24, 25,
+    9, 3, 5, 3, 5, 3, 1, 1, 11, 4, 11, 4, 11, 4, 7, 4, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 31,
+    6, 3, 6, 3, 2, 2, 1, 1, 13, 1, 13, 1, 1, 1, 1, 30, 5, 3, 5, 3, 2, 2, 1, 1, 2, 1, 2, 28, 1, 1, 1, 31,
+    6, 3, 2, 2, 6, 3, 1, 1, 13, 1, 1, 1, 13, 1, 1, 30, 5, 3, 2, 2, 5, 3, 1, 1, 2, 1, 1, 1, 2, 28, 1, 31,
+    9, 2, 4, 2, 4, 2, 1, 1, 4, 1, 2, 1, 2, 1, 1, 30, 9, 2, 4, 2, 4, 2, 1, 31, 4, 1, 2, 29, 2, 29, 28, 31,
+    12, 8, 7, 4, 7, 4, 1, 1, 14, 4, 13, 2, 13, 2, 7, 28, 9, 8, 4, 4, 4, 4, 1, 1, 4, 4, 2, 2, 2, 2, 1, 31,
+    10, 8, 7, 4, 8, 4, 2, 1, 14, 4, 13, 27, 4, 2, 21, 27, 9, 8, 4, 4, 8, 4, 2, 28, 4, 4, 21, 28, 4, 22, 25, 29,
+    10, 8, 8, 4, 7, 4, 2, 1, 14, 4, 4, 2, 13, 27, 21, 27, 9, 8, 8, 4, 4, 4, 2, 28, 4, 4, 4, 22, 21, 28, 25, 29,
+    9, 8, 8, 4, 8, 4, 4, 1, 4, 4, 24, 24, 24, 24, 24, 25, 9, 8, 22, 26, 22, 26, 22, 27, 21, 27, 25, 26, 25, 26, 24, 26,
+    13, 5, 10, 5, 9, 4, 4, 1, 14, 9, 15, 4, 13, 4, 7, 4, 6, 3, 6, 3, 2, 2, 1, 1, 13, 1, 13, 1, 1, 1, 1, 30,
+    13, 6, 6, 6, 2, 2, 1, 1, 15, 10, 15, 23, 14, 0, 13, 23, 11, 5, 6, 5, 2, 2, 1, 29, 12, 9, 13, 27, 13, 0, 23, 29,
+    13, 3, 11, 3, 11, 3, 1, 1, 15, 9, 14, 9, 14, 9, 13, 29, 11, 3, 5, 4, 3, 3, 1, 1, 12, 9, 12, 9, 13, 28, 11, 31,
+    13, 5, 10, 4, 2, 2, 1, 1, 15, 9, 14, 23, 14, 27, 23, 29, 11, 5, 10, 4, 2, 2, 1, 30, 12, 9, 26, 29, 28, 29, 26, 31,
+    15, 7, 15, 7, 14, 4, 13, 2, 15, 7, 15, 7, 14, 7, 13, 29, 11, 9, 11, 4, 4, 4, 2, 2, 12, 9, 13, 9, 13, 5, 26, 28,
+    14, 7, 15, 7, 14, 4, 13, 27, 15, 12, 15, 23, 14, 19, 23, 23, 11, 9, 11, 26, 4, 4, 21, 28, 12, 19, 22, 22, 19, 21, 22, 27,
+    14, 9, 12, 9, 15, 4, 13, 2, 15, 10, 14, 10, 15, 22, 25, 28, 11, 9, 10, 9, 19, 28, 21, 28, 12, 21, 12, 21, 21, 26, 25, 27,
+    14, 9, 12, 22, 14, 4, 21, 22, 15, 24, 22, 23, 24, 24, 24, 26, 11, 22, 10, 28, 21, 26, 21, 27, 21, 21, 25, 26, 25, 25, 24, 26,
+    9, 8, 9, 5, 9, 4, 4, 1, 11, 4, 11, 4, 11, 4, 7, 30, 5, 3, 5, 3, 2, 2, 1, 1, 2, 1, 2, 28, 1, 1, 1, 31,
+    11, 5, 6, 5, 2, 2, 1, 29, 12, 9, 13, 27, 13, 0, 23, 29, 6, 3, 6, 3, 2, 2, 1, 30, 11, 0, 26, 27, 0, 31, 26, 30,
+    11, 3, 3, 3, 5, 4, 1, 1, 12, 9, 13, 28, 12, 9, 11, 31, 3, 3, 3, 3, 3, 3, 1, 31, 1, 1, 26, 31, 26, 31, 28, 31,
+    10, 3, 5, 2, 3, 2, 1, 29, 15, 1, 23, 27, 0, 30, 23, 30, 5, 3, 5, 29, 3, 31, 25, 30, 2, 29, 26, 29, 28, 30, 26, 31,
+    15, 7, 13, 7, 13, 2, 7, 28, 14, 7, 13, 29, 13, 7, 7, 30, 11, 4, 7, 4, 2, 2, 1, 31, 13, 5, 26, 28, 1, 31, 26, 31,
+    13, 7, 7, 27, 4, 2, 21, 27, 14, 19, 23, 23, 14, 19, 23, 23, 11, 4, 7, 27, 4, 22, 25, 29, 19, 21, 22, 27, 19, 22, 22, 29,
+    12, 9, 11, 4, 13, 2, 1, 31, 15, 2, 26, 29, 21, 27, 25, 29, 10, 9, 4, 31, 21, 28, 22, 31, 19, 22, 21, 31, 21, 28, 25, 30,
+    13, 4, 21, 27, 19, 21, 21, 27, 24, 24, 22, 23, 24, 24, 23, 26, 10, 22, 22, 29, 22, 26, 22, 29, 21, 22, 22, 28, 25, 26, 24, 29,
+    13, 5, 9, 4, 10, 5, 4, 1, 14, 9, 13, 4, 15, 4, 7, 4, 6, 3, 2, 2, 6, 3, 1, 1, 13, 1, 1, 1, 13, 1, 1, 30,
+    13, 3, 11, 3, 11, 3, 1, 1, 15, 9, 14, 9, 14, 9, 13, 29, 11, 3, 3, 3, 5, 4, 1, 1, 12, 9, 13, 28, 12, 9, 11, 31,
+    13, 6, 2, 2, 6, 6, 1, 1, 15, 10, 14, 0, 15, 23, 13, 23, 11, 5, 2, 2, 6, 5, 1, 29, 12, 9, 13, 0, 13, 27, 23, 29,
+    13, 5, 2, 2, 10, 4, 1, 1, 15, 9, 14, 27, 14, 23, 23, 29, 11, 5, 2, 2, 10, 4, 1, 30, 12, 9, 28, 29, 26, 29, 26, 31,
+    15, 7, 14, 4, 15, 7, 13, 2, 15, 7, 14, 7, 15, 7, 13, 29, 11, 9, 4, 4, 11, 4, 2, 2, 12, 9, 13, 5, 13, 9, 26, 28,
+    14, 9, 15, 4, 12, 9, 13, 2, 15, 10, 15, 22, 14, 10, 25, 28, 11, 9, 19, 28, 10, 9, 21, 28, 12, 21, 21, 26, 12, 21, 25, 27,
+    14, 7, 14, 4, 15, 7, 13, 27, 15, 12, 14, 19, 15, 23, 23, 23, 11, 9, 4, 4, 11, 26, 21, 28, 12, 19, 19, 21, 22, 22, 22, 27,
+    14, 9, 14, 4, 12, 22, 21, 22, 15, 24, 24, 24, 22, 23, 24, 26, 11, 22, 21, 26, 10, 28, 21, 27, 21, 21, 25, 25, 25, 26, 24, 26,
+    9, 8, 9, 4, 9, 5, 4, 1, 11, 4, 11, 4, 11, 4, 7, 30, 5, 3, 2, 2, 5, 3, 1, 1, 2, 1, 1, 1, 2, 28, 1, 31,
+    11, 3, 5, 4, 3, 3, 1, 1, 12, 9, 12, 9, 13, 28, 11, 31, 3, 3, 3, 3, 3, 3, 1, 31, 1, 1, 26, 31, 26, 31, 28, 31,
+    11, 5, 2, 2, 6, 5, 1, 29, 12, 9, 13, 0, 13, 27, 23, 29, 6, 3, 2, 2, 6, 3, 1, 30, 11, 0, 0, 31, 26, 27, 26, 30,
+    10, 3, 3, 2, 5, 2, 1, 29, 15, 1, 0, 30, 23, 27, 23, 30, 5, 3, 3, 31, 5, 29, 25, 30, 2, 29, 28, 30, 26, 29, 26, 31,
+    15, 7, 13, 2, 13, 7, 7, 28, 14, 7, 13, 7, 13, 29, 7, 30, 11, 4, 2, 2, 7, 4, 1, 31, 13, 5, 1, 31, 26, 28, 26, 31,
+    12, 9, 13, 2, 11, 4, 1, 31, 15, 2, 21, 27, 26, 29, 25, 29, 10, 9, 21, 28, 4, 31, 22, 31, 19, 22, 21, 28, 21, 31, 25, 30,
+    13, 7, 4, 2, 7, 27, 21, 27, 14, 19, 14, 19, 23, 23, 23, 23, 11, 4, 4, 22, 7, 27, 25, 29, 19, 21, 19, 22, 22, 27, 22, 29,
+    13, 4, 19, 21, 21, 27, 21, 27, 24, 24, 24, 24, 22, 23, 23, 26, 10, 22, 22, 26, 22, 29, 22, 29, 21, 22, 25, 26, 22, 28, 24, 29,
+    8, 8, 9, 8, 9, 8, 4, 4, 14, 4, 13, 4, 13, 4, 7, 4, 9, 2, 4, 2, 4, 2, 1, 1, 4, 1, 2, 1, 2, 1, 1, 30,
+    13, 5, 10, 4, 2, 2, 1, 1, 15, 9, 14, 23, 14, 27, 23, 29, 10, 3, 5, 2, 3, 2, 1, 29, 15, 1, 23, 27, 0, 30, 23, 30,
+    13, 5, 2, 2, 10, 4, 1, 1, 15, 9, 14, 27, 14, 23, 23, 29, 10, 3, 3, 2, 5, 2, 1, 29, 15, 1, 0, 30, 23, 27, 23, 30,
+    12, 3, 3, 3, 3, 3, 0, 27, 15, 0, 23, 23, 23, 23, 23, 29, 12, 3, 3, 28, 3, 28, 25, 30, 15, 27, 26, 29, 26, 29, 23, 31,
+    15, 7, 14, 7, 14, 7, 13, 7, 14, 7, 14, 7, 14, 7, 13, 29, 12, 9, 13, 5, 13, 5, 1, 31, 15, 0, 23, 27, 23, 27, 28, 29,
+    15, 10, 15, 22, 15, 2, 21, 27, 15, 19, 22, 23, 14, 27, 23, 27, 12, 21, 21, 26, 19, 22, 21, 28, 19, 19, 22, 22, 19, 21, 22, 27,
+    15, 10, 15, 2, 15, 22, 21, 27, 15, 19, 14, 27, 22, 23, 23, 27, 12, 21, 19, 22, 21, 26, 21, 28, 19, 19, 19, 21, 22, 22, 22, 27,
+    15, 9, 21, 22, 21, 22, 21, 22, 15, 24, 22, 23, 22, 23, 24, 28, 21, 22, 21, 28, 21, 28, 21, 27, 21, 21, 25, 26, 25, 26, 24, 26,
+    8, 8, 9, 8, 9, 8, 4, 30, 11, 4, 11, 4, 11, 4, 7, 31, 9, 2, 4, 2, 4, 2, 1, 31, 4, 1, 2, 29, 2, 29, 28, 31,
+    11, 5, 10, 4, 2, 2, 1, 30, 12, 9, 26, 29, 28, 29, 26, 31, 5, 3, 5, 29, 3, 31, 25, 30, 2, 29, 26, 29, 28, 30, 26, 31,
+    11, 5, 2, 2, 10, 4, 1, 30, 12, 9, 28, 29, 26, 29, 26, 31, 5, 3, 3, 31, 5, 29, 25, 30, 2, 29, 28, 30, 26, 29, 26, 31,
+    12, 3, 3, 28, 3, 28, 25, 30, 15, 27, 26, 29, 26, 29, 23, 31, 3, 3, 25, 30, 25, 30, 25, 30, 23, 30, 26, 30, 26, 30, 26, 31,
+    15, 7, 13, 29, 13, 29, 7, 30, 14, 7, 13, 29, 13, 29, 7, 31, 13, 9, 26, 28, 26, 28, 26, 31, 23, 27, 28, 29, 28, 29, 28, 31,
+    14, 10, 25, 28, 26, 29, 25, 29, 14, 27, 23, 27, 28, 29, 23, 31, 12, 21, 25, 27, 21, 31, 25, 30, 19, 21, 22, 27, 19, 31, 22, 30,
+    14, 10, 26, 29, 25, 28, 25, 29, 14, 27, 28, 29, 23, 27, 23, 31, 12, 21, 21, 31, 25, 27, 25, 30, 19, 21, 19, 31, 22, 27, 22, 30,
+    12, 27, 21, 27, 21, 27, 21, 31, 24, 24, 22, 23, 22, 23, 25, 28, 22, 22, 22, 29, 22, 29, 22, 30, 21, 27, 22, 28, 22, 28, 24, 31,
+    15, 8, 12, 8, 12, 8, 7, 4, 15, 7, 15, 7, 15, 7, 13, 7, 12, 8, 7, 4, 7, 4, 1, 1, 14, 4, 13, 2, 13, 2, 7, 28,
+    15, 7, 15, 7, 14, 4, 13, 2, 15, 7, 15, 7, 14, 7, 13, 29, 15, 7, 13, 7, 13, 2, 7, 28, 14, 7, 13, 29, 13, 7, 7, 30,
+    15, 7, 14, 4, 15, 7, 13, 2, 15, 7, 14, 7, 15, 7, 13, 29, 15, 7, 13, 2, 13, 7, 7, 28, 14, 7, 13, 7, 13, 29, 7, 30,
+    15, 7, 14, 7, 14, 7, 13, 7, 14, 7, 14, 7, 14, 7, 13, 29, 15, 7, 13, 29, 13, 29, 7, 30, 14, 7, 13, 29, 13, 29, 7, 31,
+    15, 7, 15, 7, 15, 7, 13, 7, 15, 7, 15, 7, 15, 7, 13, 28, 15, 7, 13, 7, 13, 7, 7, 7, 14, 7, 13, 22, 13, 22, 19, 28,
+    15, 7, 15, 7, 14, 7, 13, 22, 15, 7, 15, 22, 14, 21, 21, 26, 15, 7, 13, 28, 13, 22, 19, 28, 14, 21, 21, 26, 13, 21, 21, 27,
+    15, 7, 14, 7, 15, 7, 13, 22, 15, 7, 14, 21, 15, 22, 21, 26, 15, 7, 13, 22, 13, 28, 19, 28, 14, 21, 13, 21, 21, 26, 21, 27,
+    15, 7, 14, 21, 14, 21, 13, 21, 14, 7, 14, 24, 14, 24, 25, 25, 15, 22, 21, 26, 21, 26, 21, 27, 14, 24, 25, 25, 25, 25, 24, 25,
+    8, 8, 9, 8, 9, 8, 4, 4, 11, 9, 11, 4, 11, 4, 7, 4, 9, 8, 4, 4, 4, 4, 1, 1, 4, 4, 2, 2, 2, 2, 1, 31,
+    11, 9, 11, 4, 4, 4, 2, 2, 12, 9, 13, 9, 13, 5, 26, 28, 11, 4, 7, 4, 2, 2, 1, 31, 13, 5, 26, 28, 1, 31, 26, 31,
+    11, 9, 4, 4, 11, 4, 2, 2, 12, 9, 13, 5, 13, 9, 26, 28, 11, 4, 2, 2, 7, 4, 1, 31, 13, 5, 1, 31, 26, 28, 26, 31,
+    12, 9, 13, 5, 13, 5, 1, 31, 15, 0, 23, 27, 23, 27, 28, 29, 13, 9, 26, 28, 26, 28, 26, 31, 23, 27, 28, 29, 28, 29, 28, 31,
+    15, 7, 13, 7, 13, 7, 7, 7, 14, 7, 13, 22, 13, 22, 19, 28, 13, 7, 7, 7, 7, 7, 0, 31, 14, 19, 19, 22, 19, 22, 19, 28,
+    14, 7, 13, 22, 14, 19, 19, 22, 14, 20, 21, 22, 19, 21, 21, 26, 13, 22, 19, 28, 19, 22, 19, 28, 19, 21, 21, 26, 19, 21, 21, 27,
+    14, 7, 14, 19, 13, 22, 19, 22, 14, 20, 19, 21, 21, 22, 21, 26, 13, 22, 19, 22, 19, 28, 19, 28, 19, 21, 19, 21, 21, 26, 21, 27,
+    14, 20, 19, 21, 19, 21, 19, 21, 24, 24, 21, 24, 21, 24, 25, 25, 21, 22, 21, 26, 21, 26, 21, 27, 21, 24, 25, 25, 25, 25, 24, 25,
+    15, 8, 12, 8, 10, 8, 7, 4, 14, 7, 15, 7, 13, 7, 7, 27, 10, 8, 7, 4, 8, 4, 2, 1, 14, 4, 13, 27, 4, 2, 21, 27,
+    14, 7, 15, 7, 14, 4, 13, 27, 15, 12, 15, 23, 14, 19, 23, 23, 13, 7, 7, 27, 4, 2, 21, 27, 14, 19, 23, 23, 14, 19, 23, 23,
+    14, 9, 15, 4, 12, 9, 13, 2, 15, 10, 15, 22, 14, 10, 25, 28, 12, 9, 13, 2, 11, 4, 1, 31, 15, 2, 21, 27, 26, 29, 25, 29,
+    15, 10, 15, 22, 15, 2, 21, 27, 15, 19, 22, 23, 14, 27, 23, 27, 14, 10, 25, 28, 26, 29, 25, 29, 14, 27, 23, 27, 28, 29, 23, 31,
+    15, 7, 15, 7, 14, 7, 13, 22, 15, 7, 15, 22, 14, 21, 21, 26, 14, 7, 13, 22, 14, 19, 19, 22, 14, 20, 21, 22, 19, 21, 21, 26,
+    15, 7, 15, 22, 14, 20, 21, 22, 15, 19, 23, 23, 14, 19, 23, 23, 14, 21, 21, 26, 19, 21, 21, 26, 14, 19, 23, 23, 19, 19, 23, 23,
+    15, 11, 15, 22, 15, 22, 13, 22, 15, 20, 15, 22, 15, 22, 21, 28, 15, 22, 13, 22, 19, 28, 19, 28, 15, 21, 21, 22, 21, 26, 21, 27,
+    15, 20, 15, 22, 15, 21, 21, 22, 15, 24, 23, 23, 21, 21, 23, 26, 15, 22, 21, 28, 21, 26, 21, 27, 21, 21, 23, 26, 25, 25, 24, 27,
+    8, 8, 9, 8, 9, 8, 4, 4, 11, 9, 11, 26, 11, 4, 7, 27, 9, 8, 4, 4, 8, 4, 2, 28, 4, 4, 21, 28, 4, 22, 25, 29,
+    11, 9, 11, 26, 4, 4, 21, 28, 12, 19, 22, 22, 19, 21, 22, 27, 11, 4, 7, 27, 4, 22, 25, 29, 19, 21, 22, 27, 19, 22, 22, 29,
+    11, 9, 19, 28, 10, 9, 21, 28, 12, 21, 21, 26, 12, 21, 25, 27, 10, 9, 21, 28, 4, 31, 22, 31, 19, 22, 21, 28, 21, 31, 25, 30,
+    12, 21, 21, 26, 19, 22, 21, 28, 19, 19, 22, 22, 19, 21, 22, 27, 12, 21, 25, 27, 21, 31, 25, 30, 19, 21, 22, 27, 19, 31, 22, 30,
+    15, 7, 13, 28, 13, 22, 19, 28, 14, 21, 21, 26, 13, 21, 21, 27, 13, 22, 19, 28, 19, 22, 19, 28, 19, 21, 21, 26, 19, 21, 21, 27,
+    14, 21, 21, 26, 19, 21, 21, 26, 14, 19, 23, 23, 19, 19, 23, 23, 13, 21, 21, 27, 19, 21, 21, 27, 19, 19, 23, 23, 19, 19, 23, 23,
+    15, 22, 19, 28, 13, 22, 19, 28, 15, 21, 21, 26, 21, 22, 21, 27, 13, 22, 19, 28, 19, 28, 19, 31, 19, 21, 21, 26, 21, 26, 21, 29,
+    15, 21, 21, 26, 19, 21, 21, 26, 19, 19, 23, 23, 21, 21, 23, 23, 21, 22, 21, 27, 21, 26, 21, 29, 21, 21, 23, 23, 25, 25, 23, 27,
+    15, 8, 10, 8, 12, 8, 7, 4, 14, 7, 13, 7, 15, 7, 7, 27, 10, 8, 8, 4, 7, 4, 2, 1, 14, 4, 4, 2, 13, 27, 21, 27,
+    14, 9, 12, 9, 15, 4, 13, 2, 15, 10, 14, 10, 15, 22, 25, 28, 12, 9, 11, 4, 13, 2, 1, 31, 15, 2, 26, 29, 21, 27, 25, 29,
+    14, 7, 14, 4, 15, 7, 13, 27, 15, 12, 14, 19, 15, 23, 23, 23, 13, 7, 4, 2, 7, 27, 21, 27, 14, 19, 14, 19, 23, 23, 23, 23,
+    15, 10, 15, 2, 15, 22, 21, 27, 15, 19, 14, 27, 22, 23, 23, 27, 14, 10, 26, 29, 25, 28, 25, 29, 14, 27, 28, 29, 23, 27, 23, 31,
+    15, 7, 14, 7, 15, 7, 13, 22, 15, 7, 14, 21, 15, 22, 21, 26, 14, 7, 14, 19, 13, 22, 19, 22, 14, 20, 19, 21, 21, 22, 21, 26,
+    15, 11, 15, 22, 15, 22, 13, 22, 15, 20, 15, 22, 15, 22, 21, 28, 15, 22, 19, 28, 13, 22, 19, 28, 15, 21, 21, 26, 21, 22, 21, 27,
+    15, 7, 14, 20, 15, 22, 21, 22, 15, 19, 14, 19, 23, 23, 23, 23, 14, 21, 19, 21, 21, 26, 21, 26, 14, 19, 19, 19, 23, 23, 23, 23,
+    15, 20, 15, 21, 15, 22, 21, 22, 15, 24, 21, 21, 23, 23, 23, 26, 15, 22, 21, 26, 21, 28, 21, 27, 21, 21, 25, 25, 23, 26, 24, 27,
+    8, 8, 9, 8, 9, 8, 4, 4, 11, 9, 11, 4, 11, 26, 7, 27, 9, 8, 8, 4, 4, 4, 2, 28, 4, 4, 4, 22, 21, 28, 25, 29,
+    11, 9, 10, 9, 19, 28, 21, 28, 12, 21, 12, 21, 21, 26, 25, 27, 10, 9, 4, 31, 21, 28, 22, 31, 19, 22, 21, 31, 21, 28, 25, 30,
+    11, 9, 4, 4, 11, 26, 21, 28, 12, 19, 19, 21, 22, 22, 22, 27, 11, 4, 4, 22, 7, 27, 25, 29, 19, 21, 19, 22, 22, 27, 22, 29,
+    12, 21, 19, 22, 21, 26, 21, 28, 19, 19, 19, 21, 22, 22, 22, 27, 12, 21, 21, 31, 25, 27, 25, 30, 19, 21, 19, 31, 22, 27, 22, 30,
+    15, 7, 13, 22, 13, 28, 19, 28, 14, 21, 13, 21, 21, 26, 21, 27, 13, 22, 19, 22, 19, 28, 19, 28, 19, 21, 19, 21, 21, 26, 21, 27,
+    15, 22, 13, 22, 19, 28, 19, 28, 15, 21, 21, 22, 21, 26, 21, 27, 13, 22, 19, 28, 19, 28, 19, 31, 19, 21, 21, 26, 21, 26, 21, 29,
+    14, 21, 19, 21, 21, 26, 21, 26, 14, 19, 19, 19, 23, 23, 23, 23, 13, 21, 19, 21, 21, 27, 21, 27, 19, 19, 19, 19, 23, 23, 23, 23,
+    15, 21, 19, 21, 21, 26, 21, 26, 19, 19, 21, 21, 23, 23, 23, 23, 21, 22, 21, 26, 21, 27, 21, 29, 21, 21, 25, 25, 23, 23, 23, 27,
+    14, 8, 10, 8, 10, 8, 7, 4, 14, 7, 13, 7, 13, 7, 24, 25, 9, 8, 8, 4, 8, 4, 4, 1, 4, 4, 24, 24, 24, 24, 24, 25,
+    14, 9, 12, 22, 14, 4, 21, 22, 15, 24, 22, 23, 24, 24, 24, 26, 13, 4, 21, 27, 19, 21, 21, 27, 24, 24, 22, 23, 24, 24, 23, 26,
+    14, 9, 14, 4, 12, 22, 21, 22, 15, 24, 24, 24, 22, 23, 24, 26, 13, 4, 19, 21, 21, 27, 21, 27, 24, 24, 24, 24, 22, 23, 23, 26,
+    15, 9, 21, 22, 21, 22, 21, 22, 15, 24, 22, 23, 22, 23, 24, 28, 12, 27, 21, 27, 21, 27, 21, 31, 24, 24, 22, 23, 22, 23, 25, 28,
+    15, 7, 14, 21, 14, 21, 13, 21, 14, 7, 14, 24, 14, 24, 25, 25, 14, 20, 19, 21, 19, 21, 19, 21, 24, 24, 21, 24, 21, 24, 25, 25,
+    15, 20, 15, 22, 15, 21, 21, 22, 15, 24, 23, 23, 21, 21, 23, 26, 15, 21, 21, 26, 19, 21, 21, 26, 19, 19, 23, 23, 21, 21, 23, 23,
+    15, 20, 15, 21, 15, 22, 21, 22, 15, 24, 21, 21, 23, 23, 23, 26, 15, 21, 19, 21, 21, 26, 21, 26, 19, 19, 21, 21, 23, 23, 23, 23,
+    15, 20, 21, 22, 21, 22, 21, 22, 15, 24, 23, 23, 23, 23, 23, 28, 21, 22, 21, 28, 21, 28, 21, 27, 21, 24, 23, 23, 23, 23, 24, 28,
+    8, 8, 9, 8, 9, 8, 4, 27, 11, 4, 25, 25, 25, 25, 24, 25, 9, 8, 22, 26, 22, 26, 22, 27, 21, 27, 25, 26, 25, 26, 24, 26,
+    11, 22, 10, 28, 21, 26, 21, 27, 21, 21, 25, 26, 25, 25, 24, 26, 10, 22, 22, 29, 22, 26, 22, 29, 21, 22, 22, 28, 25, 26, 24, 29,
+    11, 22, 21, 26, 10, 28, 21, 27, 21, 21, 25, 25, 25, 26, 24, 26, 10, 22, 22, 26, 22, 29, 22, 29, 21, 22, 25, 26, 22, 28, 24, 29,
+    21, 22, 21, 28, 21, 28, 21, 27, 21, 21, 25, 26, 25, 26, 24, 26, 22, 22, 22, 29, 22, 29, 22, 30, 21, 27, 22, 28, 22, 28, 24, 31,
+    15, 22, 21, 26, 21, 26, 21, 27, 14, 24, 25, 25, 25, 25, 24, 25, 21, 22, 21, 26, 21, 26, 21, 27, 21, 24, 25, 25, 25, 25, 24, 25,
+    15, 22, 21, 28, 21, 26, 21, 27, 21, 21, 23, 26, 25, 25, 24, 27, 21, 22, 21, 27, 21, 26, 21, 29, 21, 21, 23, 23, 25, 25, 23, 27,
+    15, 22, 21, 26, 21, 28, 21, 27, 21, 21, 25, 25, 23, 26, 24, 27, 21, 22, 21, 26, 21, 27, 21, 29, 21, 21, 25, 25, 23, 23, 23, 27,
+    21, 22, 21, 28, 21, 28, 21, 27, 21, 24, 23, 23, 23, 23, 24, 28, 21, 22, 21, 27, 21, 27, 21, 30, 21, 21, 23, 23, 23, 23, 23, 29,
+    12, 3, 6, 3, 6, 3, 2, 1, 14, 9, 14, 4, 14, 4, 4, 4, 9, 3, 5, 3, 5, 3, 2, 1, 11, 9, 10, 4, 10, 4, 4, 4,
+    10, 5, 6, 5, 9, 4, 2, 1, 14, 9, 12, 9, 10, 4, 4, 4, 9, 5, 5, 5, 9, 4, 2, 27, 11, 9, 10, 27, 10, 4, 4, 29,
+    10, 5, 9, 4, 6, 5, 2, 1, 14, 9, 10, 4, 12, 9, 4, 4, 9, 5, 9, 4, 5, 5, 2, 27, 11, 9, 10, 4, 10, 27, 4, 29,
+    9, 8, 9, 4, 9, 4, 8, 1, 14, 9, 10, 4, 10, 4, 4, 30, 8, 8, 9, 4, 9, 4, 23, 23, 11, 23, 23, 27, 23, 27, 23, 31,
+    15, 8, 10, 8, 10, 8, 8, 4, 14, 9, 12, 9, 12, 9, 11, 4, 8, 8, 9, 8, 9, 8, 8, 4, 11, 9, 10, 9, 10, 9, 4, 31,
+    14, 8, 10, 8, 9, 8, 8, 4, 14, 9, 12, 22, 13, 4, 21, 27, 8, 8, 9, 8, 9, 8, 22, 26, 11, 22, 10, 28, 10, 22, 22, 29,
+    14, 8, 9, 8, 10, 8, 8, 4, 14, 9, 13, 4, 12, 22, 21, 27, 8, 8, 9, 8, 9, 8, 22, 26, 11, 22, 10, 22, 10, 28, 22, 29,
+    8, 8, 9, 8, 9, 8, 8, 4, 14, 9, 10, 24, 10, 24, 24, 25, 8, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27,
+    9, 3, 5, 3, 5, 3, 2, 1, 11, 9, 10, 4, 10, 4, 4, 4, 3, 3, 3, 3, 3, 3, 2, 1, 19, 28, 25, 28, 25, 28, 28, 31,
+    6, 3, 6, 3, 2, 2, 2, 1, 12, 9, 13, 1, 1, 1, 1, 31, 5, 3, 5, 3, 2, 2, 2, 29, 21, 26, 25, 27, 22, 28, 26, 30,
+    6, 3, 2, 2, 6, 3, 2, 1, 12, 9, 1, 1, 13, 1, 1, 31, 5, 3, 2, 2, 5, 3, 2, 29, 21, 26, 22, 28, 25, 27, 26, 30,
+    9, 3, 4, 2, 4, 2, 2, 1, 15, 1, 2, 29, 2, 29, 19, 30, 9, 2, 4, 27, 4, 27, 22, 29, 22, 23, 22, 27, 22, 27, 22, 30,
+    12, 8, 7, 4, 7, 4, 2, 1, 15, 4, 13, 2, 13, 2, 1, 31, 9, 8, 4, 4, 4, 4, 2, 28, 19, 28, 21, 28, 21, 28, 22, 31,
+    10, 8, 7, 4, 8, 4, 4, 1, 14, 4, 21, 22, 19, 21, 21, 27, 9, 8, 4, 27, 22, 26, 22, 27, 21, 26, 21, 27, 22, 26, 22, 29,
+    10, 8, 8, 4, 7, 4, 4, 1, 14, 4, 19, 21, 21, 22, 21, 27, 9, 8, 22, 26, 4, 27, 22, 27, 21, 26, 22, 26, 21, 27, 22, 29,
+    9, 8, 8, 4, 8, 4, 8, 1, 19, 24, 21, 24, 21, 24, 24, 25, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27,
+    10, 5, 6, 5, 9, 4, 2, 1, 14, 9, 12, 9, 10, 4, 4, 4, 6, 3, 6, 3, 2, 2, 2, 1, 12, 9, 13, 1, 1, 1, 1, 31,
+    13, 6, 6, 6, 2, 2, 2, 1, 15, 10, 14, 27, 15, 24, 23, 27, 6, 5, 6, 5, 2, 2, 24, 26, 12, 24, 24, 26, 21, 27, 25, 28,
+    13, 3, 5, 3, 5, 3, 2, 1, 15, 9, 12, 9, 12, 9, 0, 30, 11, 3, 5, 3, 3, 3, 2, 27, 12, 22, 22, 27, 21, 27, 22, 29,
+    13, 5, 11, 4, 3, 2, 2, 24, 15, 24, 24, 27, 24, 24, 23, 27, 11, 5, 4, 26, 22, 23, 23, 26, 22, 23, 25, 28, 23, 23, 23, 28,
+    14, 7, 13, 7, 14, 4, 4, 2, 15, 10, 14, 10, 15, 2, 26, 29, 11, 9, 11, 4, 4, 4, 4, 22, 12, 21, 12, 21, 19, 22, 21, 31,
+    14, 7, 13, 7, 4, 4, 24, 24, 15, 24, 22, 23, 24, 24, 22, 23, 11, 4, 25, 25, 21, 27, 25, 26, 21, 21, 25, 26, 21, 22, 22, 28,
+    14, 9, 13, 4, 14, 4, 19, 21, 15, 9, 12, 27, 21, 22, 21, 27, 11, 22, 10, 22, 21, 26, 22, 26, 21, 22, 22, 22, 21, 28, 22, 29,
+    14, 9, 10, 24, 19, 24, 21, 24, 15, 24, 22, 23, 24, 24, 22, 26, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 28, 23, 23, 23, 27,
+    9, 5, 5, 5, 9, 4, 2, 27, 11, 9, 10, 27, 10, 4, 4, 29, 5, 3, 5, 3, 2, 2, 2, 29, 21, 26, 25, 27, 22, 28, 26, 30,
+    6, 5, 6, 5, 2, 2, 24, 26, 12, 24, 24, 26, 21, 27, 25, 28, 6, 3, 6, 25, 25, 28, 24, 28, 25, 25, 24, 25, 25, 28, 24, 31,
+    11, 3, 3, 3, 5, 3, 2, 27, 12, 22, 21, 27, 22, 27, 22, 29, 3, 3, 3, 29, 3, 29, 26, 29, 21, 28, 25, 29, 25, 29, 26, 30,
+    10, 3, 5, 25, 3, 27, 24, 26, 21, 24, 24, 26, 21, 27, 24, 28, 5, 26, 24, 26, 22, 28, 24, 29, 22, 26, 24, 27, 22, 29, 24, 30,
+    15, 7, 7, 27, 13, 27, 21, 27, 15, 22, 25, 28, 21, 27, 25, 29, 11, 26, 7, 27, 21, 28, 25, 29, 21, 26, 25, 27, 21, 28, 25, 30,
+    13, 7, 24, 25, 24, 24, 24, 25, 24, 24, 24, 26, 24, 24, 23, 26, 25, 25, 24, 25, 25, 26, 24, 26, 25, 25, 24, 26, 25, 26, 24, 29,
+    12, 22, 21, 27, 21, 22, 21, 27, 21, 22, 21, 27, 21, 22, 21, 31, 10, 28, 22, 29, 21, 27, 22, 29, 21, 28, 22, 29, 21, 27, 22, 30,
+    10, 24, 24, 25, 21, 24, 24, 25, 24, 24, 22, 26, 21, 24, 22, 26, 23, 23, 23, 27, 23, 23, 23, 27, 23, 23, 23, 27, 23, 23, 23, 29,
+    10, 5, 9, 4, 6, 5, 2, 1, 14, 9, 10, 4, 12, 9, 4, 4, 6, 3, 2, 2, 6, 3, 2, 1, 12, 9, 1, 1, 13, 1, 1, 31,
+    13, 3, 5, 3, 5, 3, 2, 1, 15, 9, 12, 9, 12, 9, 0, 30, 11, 3, 3, 3, 5, 3, 2, 27, 12, 22, 21, 27, 22, 27, 22, 29,
+    13, 6, 2, 2, 6, 6, 2, 1, 15, 10, 15, 24, 14, 27, 23, 27, 6, 5, 2, 2, 6, 5, 24, 26, 12, 24, 21, 27, 24, 26, 25, 28,
+    13, 5, 3, 2, 11, 4, 2, 24, 15, 24, 24, 24, 24, 27, 23, 27, 11, 5, 22, 23, 4, 26, 23, 26, 22, 23, 23, 23, 25, 28, 23, 28,
+    14, 7, 14, 4, 13, 7, 4, 2, 15, 10, 15, 2, 14, 10, 26, 29, 11, 9, 4, 4, 11, 4, 4, 22, 12, 21, 19, 22, 12, 21, 21, 31,
+    14, 9, 14, 4, 13, 4, 19, 21, 15, 9, 21, 22, 12, 27, 21, 27, 11, 22, 21, 26, 10, 22, 22, 26, 21, 22, 21, 28, 22, 22, 22, 29,
+    14, 7, 4, 4, 13, 7, 24, 24, 15, 24, 24, 24, 22, 23, 22, 23, 11, 4, 21, 27, 25, 25, 25, 26, 21, 21, 21, 22, 25, 26, 22, 28,
+    14, 9, 19, 24, 10, 24, 21, 24, 15, 24, 24, 24, 22, 23, 22, 26, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 28, 23, 27,
+    9, 5, 9, 4, 5, 5, 2, 27, 11, 9, 10, 4, 10, 27, 4, 29, 5, 3, 2, 2, 5, 3, 2, 29, 21, 26, 22, 28, 25, 27, 26, 30,
+    11, 3, 5, 3, 3, 3, 2, 27, 12, 22, 22, 27, 21, 27, 22, 29, 3, 3, 3, 29, 3, 29, 26, 29, 21, 28, 25, 29, 25, 29, 26, 30,
+    6, 5, 2, 2, 6, 5, 24, 26, 12, 24, 21, 27, 24, 26, 25, 28, 6, 3, 25, 28, 6, 25, 24, 28, 25, 25, 25, 28, 24, 25, 24, 31,
+    10, 3, 3, 27, 5, 25, 24, 26, 21, 24, 21, 27, 24, 26, 24, 28, 5, 26, 22, 28, 24, 26, 24, 29, 22, 26, 22, 29, 24, 27, 24, 30,
+    15, 7, 13, 27, 7, 27, 21, 27, 15, 22, 21, 27, 25, 28, 25, 29, 11, 26, 21, 28, 7, 27, 25, 29, 21, 26, 21, 28, 25, 27, 25, 30,
+    12, 22, 21, 22, 21, 27, 21, 27, 21, 22, 21, 22, 21, 27, 21, 31, 10, 28, 21, 27, 22, 29, 22, 29, 21, 28, 21, 27, 22, 29, 22, 30,
+    13, 7, 24, 24, 24, 25, 24, 25, 24, 24, 24, 24, 24, 26, 23, 26, 25, 25, 25, 26, 24, 25, 24, 26, 25, 25, 25, 26, 24, 26, 24, 29,
+    10, 24, 21, 24, 24, 25, 24, 25, 24, 24, 21, 24, 22, 26, 22, 26, 23, 23, 23, 23, 23, 27, 23, 27, 23, 23, 23, 23, 23, 27, 23, 29,
+    9, 8, 9, 4, 9, 4, 8, 1, 14, 9, 10, 4, 10, 4, 4, 30, 9, 3, 4, 2, 4, 2, 2, 1, 15, 1, 2, 29, 2, 29, 19, 30,
+    13, 5, 11, 4, 3, 2, 2, 24, 15, 24, 24, 27, 24, 24, 23, 27, 10, 3, 5, 25, 3, 27, 24, 26, 21, 24, 24, 26, 21, 27, 24, 28,
+    13, 5, 3, 2, 11, 4, 2, 24, 15, 24, 24, 24, 24, 27, 23, 27, 10, 3, 3, 27, 5, 25, 24, 26, 21, 24, 21, 27, 24, 26, 24, 28,
+    12, 3, 3, 24, 3, 24, 24, 24, 15, 24, 24, 27, 24, 27, 23, 30, 22, 23, 22, 26, 22, 26, 22, 26, 22, 23, 22, 28, 22, 28, 23, 31,
+    15, 12, 14, 19, 14, 19, 14, 19, 15, 19, 14, 27, 14, 27, 28, 29, 12, 19, 19, 21, 19, 21, 19, 22, 19, 19, 19, 21, 19, 21, 19, 31,
+    15, 24, 24, 24, 24, 24, 24, 24, 15, 24, 22, 23, 24, 24, 22, 23, 21, 21, 25, 25, 21, 22, 25, 26, 21, 21, 25, 26, 21, 27, 22, 28,
+    15, 24, 24, 24, 24, 24, 24, 24, 15, 24, 24, 24, 22, 23, 22, 23, 21, 21, 21, 22, 25, 25, 25, 26, 21, 21, 21, 27, 25, 26, 22, 28,
+    15, 24, 24, 24, 24, 24, 21, 24, 15, 24, 22, 23, 22, 23, 24, 28, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 28, 23, 28, 23, 27,
+    8, 8, 9, 4, 9, 4, 23, 23, 11, 23, 23, 27, 23, 27, 23, 31, 9, 2, 4, 27, 4, 27, 22, 29, 22, 23, 22, 27, 22, 27, 22, 30,
+    11, 5, 4, 26, 22, 23, 23, 26, 22, 23, 25, 28, 23, 23, 23, 28, 5, 26, 24, 26, 22, 28, 24, 29, 22, 26, 24, 27, 22, 29, 24, 30,
+    11, 5, 22, 23, 4, 26, 23, 26, 22, 23, 23, 23, 25, 28, 23, 28, 5, 26, 22, 28, 24, 26, 24, 29, 22, 26, 22, 29, 24, 27, 24, 30,
+    22, 23, 22, 26, 22, 26, 22, 26, 22, 23, 22, 28, 22, 28, 23, 31, 22, 28, 24, 28, 24, 28, 24, 28, 22, 28, 24, 28, 24, 28, 24, 31,
+    15, 23, 23, 23, 23, 23, 23, 23, 22, 23, 23, 27, 23, 27, 23, 31, 22, 22, 22, 27, 22, 27, 22, 29, 22, 22, 22, 27, 22, 27, 22, 30,
+    22, 23, 24, 26, 22, 23, 23, 26, 22, 23, 24, 28, 22, 23, 25, 28, 25, 26, 24, 26, 22, 28, 24, 29, 25, 26, 24, 26, 22, 28, 24, 31,
+    22, 23, 22, 23, 24, 26, 23, 26, 22, 23, 22, 23, 24, 28, 25, 28, 25, 26, 22, 28, 24, 26, 24, 29, 25, 26, 22, 28, 24, 26, 24, 31,
+    22, 23, 22, 26, 22, 26, 22, 26, 22, 23, 24, 28, 24, 28, 22, 31, 23, 28, 23, 27, 23, 27, 23, 29, 23, 28, 23, 27, 23, 27, 23, 30,
+    15, 8, 10, 8, 10, 8, 8, 4, 14, 9, 12, 9, 12, 9, 11, 4, 12, 8, 7, 4, 7, 4, 2, 1, 15, 4, 13, 2, 13, 2, 1, 31,
+    14, 7, 13, 7, 14, 4, 4, 2, 15, 10, 14, 10, 15, 2, 26, 29, 15, 7, 7, 27, 13, 27, 21, 27, 15, 22, 25, 28, 21, 27, 25, 29,
+    14, 7, 14, 4, 13, 7, 4, 2, 15, 10, 15, 2, 14, 10, 26, 29, 15, 7, 13, 27, 7, 27, 21, 27, 15, 22, 21, 27, 25, 28, 25, 29,
+    15, 12, 14, 19, 14, 19, 14, 19, 15, 19, 14, 27, 14, 27, 28, 29, 15, 23, 23, 23, 23, 23, 23, 23, 22, 23, 23, 27, 23, 27, 23, 31,
+    15, 7, 14, 7, 14, 7, 14, 19, 15, 11, 15, 22, 15, 22, 19, 28, 15, 7, 13, 22, 13, 22, 19, 22, 15, 22, 13, 22, 13, 22, 19, 28,
+    15, 7, 14, 21, 14, 20, 19, 21, 15, 20, 15, 22, 15, 21, 21, 26, 15, 22, 21, 26, 21, 22, 21, 26, 15, 22, 21, 28, 21, 22, 21, 27,
+    15, 7, 14, 20, 14, 21, 19, 21, 15, 20, 15, 21, 15, 22, 21, 26, 15, 22, 21, 22, 21, 26, 21, 26, 15, 22, 21, 22, 21, 28, 21, 27,
+    15, 19, 14, 19, 14, 19, 19, 19, 15, 24, 21, 21, 21, 21, 25, 25, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 26, 23, 26, 24, 27,
+    8, 8, 9, 8, 9, 8, 8, 4, 11, 9, 10, 9, 10, 9, 4, 31, 9, 8, 4, 4, 4, 4, 2, 28, 19, 28, 21, 28, 21, 28, 22, 31,
+    11, 9, 11, 4, 4, 4, 4, 22, 12, 21, 12, 21, 19, 22, 21, 31, 11, 26, 7, 27, 21, 28, 25, 29, 21, 26, 25, 27, 21, 28, 25, 30,
+    11, 9, 4, 4, 11, 4, 4, 22, 12, 21, 19, 22, 12, 21, 21, 31, 11, 26, 21, 28, 7, 27, 25, 29, 21, 26, 21, 28, 25, 27, 25, 30,
+    12, 19, 19, 21, 19, 21, 19, 22, 19, 19, 19, 21, 19, 21, 19, 31, 22, 22, 22, 27, 22, 27, 22, 29, 22, 22, 22, 27, 22, 27, 22, 30,
+    15, 7, 13, 22, 13, 22, 19, 22, 15, 22, 13, 22, 13, 22, 19, 28, 13, 28, 19, 28, 19, 28, 19, 28, 19, 28, 19, 28, 19, 28, 19, 31,
+    14, 21, 13, 21, 19, 21, 19, 21, 15, 21, 21, 22, 19, 21, 21, 26, 21, 26, 21, 27, 21, 26, 21, 27, 21, 26, 21, 27, 21, 26, 21, 29,
+    14, 21, 19, 21, 13, 21, 19, 21, 15, 21, 19, 21, 21, 22, 21, 26, 21, 26, 21, 26, 21, 27, 21, 27, 21, 26, 21, 26, 21, 27, 21, 29,
+    14, 19, 19, 19, 19, 19, 19, 19, 19, 19, 21, 21, 21, 21, 25, 25, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27,
+    14, 8, 10, 8, 9, 8, 8, 4, 14, 9, 12, 22, 13, 4, 21, 27, 10, 8, 7, 4, 8, 4, 4, 1, 14, 4, 21, 22, 19, 21, 21, 27,
+    14, 7, 13, 7, 4, 4, 24, 24, 15, 24, 22, 23, 24, 24, 22, 23, 13, 7, 24, 25, 24, 24, 24, 25, 24, 24, 24, 26, 24, 24, 23, 26,
+    14, 9, 14, 4, 13, 4, 19, 21, 15, 9, 21, 22, 12, 27, 21, 27, 12, 22, 21, 22, 21, 27, 21, 27, 21, 22, 21, 22, 21, 27, 21, 31,
+    15, 24, 24, 24, 24, 24, 24, 24, 15, 24, 22, 23, 24, 24, 22, 23, 22, 23, 24, 26, 22, 23, 23, 26, 22, 23, 24, 28, 22, 23, 25, 28,
+    15, 7, 14, 21, 14, 20, 19, 21, 15, 20, 15, 22, 15, 21, 21, 26, 14, 21, 13, 21, 19, 21, 19, 21, 15, 21, 21, 22, 19, 21, 21, 26,
+    14, 7, 14, 24, 24, 24, 21, 24, 15, 24, 23, 23, 19, 19, 23, 23, 14, 24, 25, 25, 21, 24, 25, 25, 21, 21, 23, 26, 21, 21, 23, 23,
+    15, 20, 15, 21, 15, 21, 19, 21, 15, 20, 21, 22, 21, 22, 21, 28, 15, 22, 21, 22, 21, 26, 21, 26, 21, 22, 21, 22, 21, 28, 21, 27,
+    15, 24, 21, 21, 19, 19, 21, 21, 15, 24, 23, 23, 21, 24, 23, 23, 23, 23, 23, 26, 23, 23, 23, 23, 23, 23, 23, 28, 23, 23, 24, 28,
+    8, 8, 9, 8, 9, 8, 22, 26, 11, 22, 10, 28, 10, 22, 22, 29, 9, 8, 4, 27, 22, 26, 22, 27, 21, 26, 21, 27, 22, 26, 22, 29,
+    11, 4, 25, 25, 21, 27, 25, 26, 21, 21, 25, 26, 21, 22, 22, 28, 25, 25, 24, 25, 25, 26, 24, 26, 25, 25, 24, 26, 25, 26, 24, 29,
+    11, 22, 21, 26, 10, 22, 22, 26, 21, 22, 21, 28, 22, 22, 22, 29, 10, 28, 21, 27, 22, 29, 22, 29, 21, 28, 21, 27, 22, 29, 22, 30,
+    21, 21, 25, 25, 21, 22, 25, 26, 21, 21, 25, 26, 21, 27, 22, 28, 25, 26, 24, 26, 22, 28, 24, 29, 25, 26, 24, 26, 22, 28, 24, 31,
+    15, 22, 21, 26, 21, 22, 21, 26, 15, 22, 21, 28, 21, 22, 21, 27, 21, 26, 21, 27, 21, 26, 21, 27, 21, 26, 21, 27, 21, 26, 21, 29,
+    14, 24, 25, 25, 21, 24, 25, 25, 21, 21, 23, 26, 21, 21, 23, 23, 25, 25, 24, 25, 25, 25, 24, 25, 25, 25, 24, 27, 25, 25, 23, 27,
+    15, 22, 21, 26, 21, 22, 21, 26, 21, 22, 21, 28, 21, 22, 21, 27, 21, 28, 21, 27, 21, 27, 21, 29, 21, 28, 21, 27, 21, 27, 21, 30,
+    21, 21, 25, 25, 21, 21, 25, 25, 21, 24, 23, 23, 21, 21, 23, 23, 23, 26, 24, 27, 23, 23, 23, 27, 23, 23, 24, 28, 23, 23, 23, 29,
+    14, 8, 9, 8, 10, 8, 8, 4, 14, 9, 13, 4, 12, 22, 21, 27, 10, 8, 8, 4, 7, 4, 4, 1, 14, 4, 19, 21, 21, 22, 21, 27,
+    14, 9, 13, 4, 14, 4, 19, 21, 15, 9, 12, 27, 21, 22, 21, 27, 12, 22, 21, 27, 21, 22, 21, 27, 21, 22, 21, 27, 21, 22, 21, 31,
+    14, 7, 4, 4, 13, 7, 24, 24, 15, 24, 24, 24, 22, 23, 22, 23, 13, 7, 24, 24, 24, 25, 24, 25, 24, 24, 24, 24, 24, 26, 23, 26,
+    15, 24, 24, 24, 24, 24, 24, 24, 15, 24, 24, 24, 22, 23, 22, 23, 22, 23, 22, 23, 24, 26, 23, 26, 22, 23, 22, 23, 24, 28, 25, 28,
+    15, 7, 14, 20, 14, 21, 19, 21, 15, 20, 15, 21, 15, 22, 21, 26, 14, 21, 19, 21, 13, 21, 19, 21, 15, 21, 19, 21, 21, 22, 21, 26,
+    15, 20, 15, 21, 15, 21, 19, 21, 15, 20, 21, 22, 21, 22, 21, 28, 15, 22, 21, 26, 21, 22, 21, 26, 21, 22, 21, 28, 21, 22, 21, 27,
+    14, 7, 24, 24, 14, 24, 21, 24, 15, 24, 19, 19, 23, 23, 23, 23, 14, 24, 21, 24, 25, 25, 25, 25, 21, 21, 21, 21, 23, 26, 23, 23,
+    15, 24, 19, 19, 21, 21, 21, 21, 15, 24, 21, 24, 23, 23, 23, 23, 23, 23, 23, 23, 23, 26, 23, 23, 23, 23, 23, 23, 23, 28, 24, 28,
+    8, 8, 9, 8, 9, 8, 22, 26, 11, 22, 10, 22, 10, 28, 22, 29, 9, 8, 22, 26, 4, 27, 22, 27, 21, 26, 22, 26, 21, 27, 22, 29,
+    11, 22, 10, 22, 21, 26, 22, 26, 21, 22, 22, 22, 21, 28, 22, 29, 10, 28, 22, 29, 21, 27, 22, 29, 21, 28, 22, 29, 21, 27, 22, 30,
+    11, 4, 21, 27, 25, 25, 25, 26, 21, 21, 21, 22, 25, 26, 22, 28, 25, 25, 25, 26, 24, 25, 24, 26, 25, 25, 25, 26, 24, 26, 24, 29,
+    21, 21, 21, 22, 25, 25, 25, 26, 21, 21, 21, 27, 25, 26, 22, 28, 25, 26, 22, 28, 24, 26, 24, 29, 25, 26, 22, 28, 24, 26, 24, 31,
+    15, 22, 21, 22, 21, 26, 21, 26, 15, 22, 21, 22, 21, 28, 21, 27, 21, 26, 21, 26, 21, 27, 21, 27, 21, 26, 21, 26, 21, 27, 21, 29,
+    15, 22, 21, 22, 21, 26, 21, 26, 21, 22, 21, 22, 21, 28, 21, 27, 21, 28, 21, 27, 21, 27, 21, 29, 21, 28, 21, 27, 21, 27, 21, 30,
+    14, 24, 21, 24, 25, 25, 25, 25, 21, 21, 21, 21, 23, 26, 23, 23, 25, 25, 25, 25, 24, 25, 24, 25, 25, 25, 25, 25, 24, 27, 23, 27,
+    21, 21, 21, 21, 25, 25, 25, 25, 21, 24, 21, 21, 23, 23, 23, 23, 23, 26, 23, 23, 24, 27, 23, 27, 23, 23, 23, 23, 24, 28, 23, 29,
+    8, 8, 9, 8, 9, 8, 8, 4, 14, 9, 10, 24, 10, 24, 24, 25, 9, 8, 8, 4, 8, 4, 8, 1, 19, 24, 21, 24, 21, 24, 24, 25,
+    14, 9, 10, 24, 19, 24, 21, 24, 15, 24, 22, 23, 24, 24, 22, 26, 10, 24, 24, 25, 21, 24, 24, 25, 24, 24, 22, 26, 21, 24, 22, 26,
+    14, 9, 19, 24, 10, 24, 21, 24, 15, 24, 24, 24, 22, 23, 22, 26, 10, 24, 21, 24, 24, 25, 24, 25, 24, 24, 21, 24, 22, 26, 22, 26,
+    15, 24, 24, 24, 24, 24, 21, 24, 15, 24, 22, 23, 22, 23, 24, 28, 22, 23, 22, 26, 22, 26, 22, 26, 22, 23, 24, 28, 24, 28, 22, 31,
+    15, 19, 14, 19, 14, 19, 19, 19, 15, 24, 21, 21, 21, 21, 25, 25, 14, 19, 19, 19, 19, 19, 19, 19, 19, 19, 21, 21, 21, 21, 25, 25,
+    15, 24, 21, 21, 19, 19, 21, 21, 15, 24, 23, 23, 21, 24, 23, 23, 21, 21, 25, 25, 21, 21, 25, 25, 21, 24, 23, 23, 21, 21, 23, 23,
+    15, 24, 19, 19, 21, 21, 21, 21, 15, 24, 21, 24, 23, 23, 23, 23, 21, 21, 21, 21, 25, 25, 25, 25, 21, 24, 21, 21, 23, 23, 23, 23,
+    15, 24, 21, 24, 21, 24, 21, 21, 15, 24, 23, 23, 23, 23, 23, 28, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 28, 23, 28, 24, 27,
+    8, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 28, 23, 23, 23, 27, 23, 23, 23, 27, 23, 23, 23, 27, 23, 23, 23, 27, 23, 23, 23, 29,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 28, 23, 27, 23, 23, 23, 23, 23, 27, 23, 27, 23, 23, 23, 23, 23, 27, 23, 29,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 28, 23, 28, 23, 27, 23, 28, 23, 27, 23, 27, 23, 29, 23, 28, 23, 27, 23, 27, 23, 30,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 26, 23, 26, 24, 27, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27,
+    23, 23, 23, 26, 23, 23, 23, 23, 23, 23, 23, 28, 23, 23, 24, 28, 23, 26, 24, 27, 23, 23, 23, 27, 23, 23, 24, 28, 23, 23, 23, 29,
+    23, 23, 23, 23, 23, 26, 23, 23, 23, 23, 23, 23, 23, 28, 24, 28, 23, 26, 23, 23, 24, 27, 23, 27, 23, 23, 23, 23, 24, 28, 23, 29,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 28, 23, 28, 24, 27, 23, 28, 24, 28, 24, 28, 23, 29, 23, 28, 24, 27, 24, 27, 23, 31,
+    15, 7, 11, 8, 11, 8, 12, 7, 13, 7, 12, 8, 12, 8, 12, 7, 11, 8, 12, 7, 12, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    13, 7, 12, 8, 7, 7, 7, 7, 11, 7, 11, 8, 7, 7, 10, 7, 12, 8, 12, 7, 7, 7, 7, 7, 7, 7, 10, 7, 7, 7, 7, 7,
+    13, 7, 7, 7, 12, 8, 7, 7, 11, 7, 7, 7, 11, 8, 10, 7, 12, 8, 7, 7, 12, 7, 7, 7, 7, 7, 7, 7, 10, 7, 7, 7,
+    11, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 11, 8, 10, 7, 10, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    14, 7, 11, 7, 11, 7, 12, 7, 13, 7, 11, 7, 11, 7, 12, 7, 11, 7, 12, 7, 12, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    13, 7, 11, 7, 7, 7, 7, 7, 11, 7, 11, 7, 7, 7, 7, 7, 11, 7, 12, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    13, 7, 7, 7, 11, 7, 7, 7, 11, 7, 7, 7, 11, 7, 7, 7, 11, 7, 7, 7, 12, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    11, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 11, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 24,
+    11, 8, 12, 7, 12, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 12, 7, 7, 7, 7, 7, 8, 31, 5, 5, 8, 5, 8, 5, 8, 31,
+    7, 7, 7, 7, 5, 5, 8, 5, 9, 9, 9, 9, 5, 5, 5, 5, 7, 7, 7, 7, 8, 5, 8, 31, 5, 5, 5, 5, 3, 3, 8, 31,
+    7, 7, 5, 5, 7, 7, 8, 5, 9, 9, 5, 5, 9, 9, 5, 5, 7, 7, 8, 5, 7, 7, 8, 31, 5, 5, 3, 3, 5, 5, 8, 31,
+    9, 9, 5, 5, 5, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3, 30, 9, 9, 5, 5, 5, 5, 8, 31, 3, 3, 3, 30, 3, 30, 3, 31,
+    15, 6, 12, 8, 12, 8, 7, 6, 10, 6, 10, 6, 10, 6, 7, 6, 12, 8, 7, 6, 7, 6, 8, 31, 8, 5, 8, 8, 8, 8, 8, 31,
+    10, 6, 10, 6, 8, 5, 8, 8, 9, 8, 9, 8, 8, 5, 8, 26, 10, 6, 7, 6, 8, 8, 8, 31, 8, 5, 8, 26, 8, 3, 25, 30,
+    10, 6, 8, 5, 10, 6, 8, 8, 9, 8, 8, 5, 9, 8, 8, 26, 10, 6, 8, 8, 7, 6, 8, 31, 8, 5, 8, 3, 8, 26, 25, 30,
+    9, 8, 8, 5, 8, 5, 8, 3, 17, 24, 20, 24, 20, 24, 24, 25, 9, 8, 8, 26, 8, 26, 25, 30, 20, 24, 24, 25, 24, 25, 24, 24,
+    13, 7, 12, 8, 7, 7, 7, 7, 11, 7, 11, 8, 7, 7, 10, 7, 7, 7, 7, 7, 5, 5, 8, 5, 9, 9, 9, 9, 5, 5, 5, 5,
+    11, 7, 11, 8, 9, 9, 9, 9, 9, 8, 9, 8, 9, 9, 9, 9, 7, 7, 10, 7, 5, 5, 5, 5, 9, 9, 9, 9, 8, 5, 8, 30,
+    14, 5, 11, 5, 11, 5, 12, 5, 13, 5, 11, 5, 11, 5, 12, 5, 11, 5, 12, 5, 6, 5, 6, 5, 10, 5, 10, 5, 6, 5, 6, 31,
+    13, 5, 11, 5, 10, 5, 10, 5, 11, 5, 11, 5, 10, 5, 10, 5, 11, 5, 12, 5, 6, 5, 6, 31, 10, 5, 10, 5, 6, 5, 6, 31,
+    15, 8, 10, 8, 12, 6, 10, 9, 13, 8, 10, 8, 12, 6, 10, 9, 12, 6, 10, 9, 11, 5, 5, 5, 10, 9, 9, 9, 6, 5, 5, 5,
+    13, 8, 10, 8, 10, 9, 9, 9, 10, 8, 9, 8, 10, 9, 9, 9, 12, 6, 10, 9, 6, 5, 5, 5, 10, 9, 9, 9, 11, 5, 20, 27,
+    14, 6, 11, 5, 13, 6, 12, 5, 13, 6, 11, 5, 13, 6, 12, 26, 13, 6, 12, 5, 6, 6, 6, 5, 10, 6, 10, 5, 6, 26, 6, 27,
+    13, 6, 11, 5, 10, 6, 10, 5, 11, 6, 11, 20, 10, 6, 24, 25, 13, 6, 12, 26, 6, 26, 6, 27, 10, 6, 24, 25, 24, 25, 24, 24,
+    12, 8, 12, 7, 7, 7, 7, 7, 7, 7, 10, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 5, 8, 31, 5, 5, 5, 5, 3, 3, 8, 31,
+    7, 7, 10, 7, 5, 5, 5, 5, 9, 9, 9, 9, 8, 5, 8, 30, 7, 7, 7, 7, 3, 3, 8, 31, 8, 5, 8, 30, 8, 8, 23, 30,
+    11, 5, 6, 5, 12, 5, 6, 5, 10, 5, 6, 5, 10, 5, 6, 31, 12, 5, 6, 5, 6, 5, 4, 31, 5, 3, 5, 31, 5, 31, 4, 31,
+    10, 5, 6, 5, 5, 3, 5, 31, 5, 3, 5, 29, 5, 3, 5, 30, 10, 5, 6, 31, 5, 31, 4, 31, 5, 3, 5, 30, 4, 30, 23, 31,
+    12, 9, 12, 8, 7, 6, 7, 6, 10, 7, 10, 8, 7, 6, 7, 6, 7, 6, 7, 6, 8, 8, 8, 31, 8, 8, 8, 8, 8, 8, 8, 31,
+    10, 7, 10, 8, 8, 8, 8, 8, 9, 8, 9, 8, 8, 8, 23, 29, 7, 6, 7, 6, 8, 8, 8, 31, 8, 8, 23, 29, 20, 20, 23, 30,
+    15, 5, 6, 5, 11, 5, 6, 5, 11, 5, 6, 5, 11, 5, 6, 28, 11, 5, 6, 5, 11, 28, 25, 31, 5, 3, 20, 30, 20, 29, 25, 30,
+    11, 5, 6, 5, 5, 3, 20, 30, 17, 20, 20, 23, 20, 24, 24, 26, 11, 5, 6, 28, 20, 29, 25, 30, 20, 24, 24, 26, 24, 25, 24, 30,
+    13, 7, 7, 7, 12, 8, 7, 7, 11, 7, 7, 7, 11, 8, 10, 7, 7, 7, 5, 5, 7, 7, 8, 5, 9, 9, 5, 5, 9, 9, 5, 5,
+    14, 5, 11, 5, 11, 5, 12, 5, 13, 5, 11, 5, 11, 5, 12, 5, 11, 5, 6, 5, 12, 5, 6, 5, 10, 5, 6, 5, 10, 5, 6, 31,
+    11, 7, 9, 9, 11, 8, 9, 9, 9, 8, 9, 9, 9, 8, 9, 9, 7, 7, 5, 5, 10, 7, 5, 5, 9, 9, 8, 5, 9, 9, 8, 30,
+    13, 5, 10, 5, 11, 5, 10, 5, 11, 5, 10, 5, 11, 5, 10, 5, 11, 5, 6, 5, 12, 5, 6, 31, 10, 5, 6, 5, 10, 5, 6, 31,
+    15, 8, 12, 6, 10, 8, 10, 9, 13, 8, 12, 6, 10, 8, 10, 9, 12, 6, 11, 5, 10, 9, 5, 5, 10, 9, 6, 5, 9, 9, 5, 5,
+    14, 6, 13, 6, 11, 5, 12, 5, 13, 6, 13, 6, 11, 5, 12, 26, 13, 6, 6, 6, 12, 5, 6, 5, 10, 6, 6, 26, 10, 5, 6, 27,
+    13, 8, 10, 9, 10, 8, 9, 9, 10, 8, 10, 9, 9, 8, 9, 9, 12, 6, 6, 5, 10, 9, 5, 5, 10, 9, 11, 5, 9, 9, 20, 27,
+    13, 6, 10, 6, 11, 5, 10, 5, 11, 6, 10, 6, 11, 20, 24, 25, 13, 6, 6, 26, 12, 26, 6, 27, 10, 6, 24, 25, 24, 25, 24, 24,
+    12, 8, 7, 7, 12, 7, 7, 7, 7, 7, 7, 7, 10, 7, 7, 7, 7, 7, 8, 5, 7, 7, 8, 31, 5, 5, 3, 3, 5, 5, 8, 31,
+    11, 5, 12, 5, 6, 5, 6, 5, 10, 5, 10, 5, 6, 5, 6, 31, 12, 5, 6, 5, 6, 5, 4, 31, 5, 3, 5, 31, 5, 31, 4, 31,
+    7, 7, 5, 5, 10, 7, 5, 5, 9, 9, 8, 5, 9, 9, 8, 30, 7, 7, 3, 3, 7, 7, 8, 31, 8, 5, 8, 8, 8, 30, 23, 30,
+    10, 5, 5, 3, 6, 5, 5, 31, 5, 3, 5, 3, 5, 29, 5, 30, 10, 5, 5, 31, 6, 31, 4, 31, 5, 3, 4, 30, 5, 30, 23, 31,
+    12, 9, 7, 6, 12, 8, 7, 6, 10, 7, 7, 6, 10, 8, 7, 6, 7, 6, 8, 8, 7, 6, 8, 31, 8, 8, 8, 8, 8, 8, 8, 31,
+    15, 5, 11, 5, 6, 5, 6, 5, 11, 5, 11, 5, 6, 5, 6, 28, 11, 5, 11, 28, 6, 5, 25, 31, 5, 3, 20, 29, 20, 30, 25, 30,
+    10, 7, 8, 8, 10, 8, 8, 8, 9, 8, 8, 8, 9, 8, 23, 29, 7, 6, 8, 8, 7, 6, 8, 31, 8, 8, 20, 20, 23, 29, 23, 30,
+    11, 5, 5, 3, 6, 5, 20, 30, 17, 20, 20, 24, 20, 23, 24, 26, 11, 5, 20, 29, 6, 28, 25, 30, 20, 24, 24, 25, 24, 26, 24, 30,
+    11, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 5, 5, 5, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3, 30,
+    13, 5, 11, 5, 10, 5, 10, 5, 11, 5, 11, 5, 10, 5, 10, 5, 10, 5, 6, 5, 5, 3, 5, 31, 5, 3, 5, 29, 5, 3, 5, 30,
+    13, 5, 10, 5, 11, 5, 10, 5, 11, 5, 10, 5, 11, 5, 10, 5, 10, 5, 5, 3, 6, 5, 5, 31, 5, 3, 5, 3, 5, 29, 5, 30,
+    15, 3, 12, 3, 12, 3, 12, 3, 12, 3, 12, 3, 12, 3, 12, 29, 12, 3, 6, 29, 6, 29, 6, 31, 6, 3, 6, 29, 6, 29, 23, 31,
+    14, 6, 11, 6, 11, 6, 6, 6, 13, 6, 11, 6, 11, 6, 6, 6, 15, 3, 5, 3, 5, 3, 3, 3, 6, 3, 5, 3, 5, 3, 3, 28,
+    14, 9, 11, 9, 12, 5, 10, 5, 13, 9, 11, 23, 12, 5, 10, 27, 15, 5, 5, 28, 6, 3, 5, 28, 6, 20, 20, 27, 20, 20, 25, 27,
+    14, 9, 12, 5, 11, 9, 10, 5, 13, 9, 12, 5, 11, 23, 10, 27, 15, 5, 6, 3, 5, 28, 5, 28, 6, 20, 20, 20, 20, 27, 25, 27,
+    15, 6, 12, 5, 12, 5, 12, 3, 12, 18, 20, 20, 20, 20, 24, 25, 15, 20, 25, 26, 25, 26, 25, 27, 20, 24, 24, 25, 24, 25, 24, 24,
+    11, 8, 10, 7, 10, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 5, 5, 5, 5, 8, 31, 3, 3, 3, 30, 3, 30, 3, 31,
+    11, 5, 12, 5, 6, 5, 6, 31, 10, 5, 10, 5, 6, 5, 6, 31, 10, 5, 6, 31, 5, 31, 4, 31, 5, 3, 5, 30, 4, 30, 23, 31,
+    11, 5, 6, 5, 12, 5, 6, 31, 10, 5, 6, 5, 10, 5, 6, 31, 10, 5, 5, 31, 6, 31, 4, 31, 5, 3, 4, 30, 5, 30, 23, 31,
+    12, 3, 6, 29, 6, 29, 6, 31, 6, 3, 6, 29, 6, 29, 23, 31, 12, 3, 6, 31, 6, 31, 27, 31, 3, 30, 23, 30, 23, 30, 23, 31,
+    15, 7, 11, 7, 11, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 31, 13, 12, 11, 30, 11, 30, 3, 31, 3, 30, 3, 30, 3, 30, 28, 31,
+    13, 9, 12, 9, 11, 5, 6, 31, 11, 5, 11, 23, 11, 29, 23, 31, 13, 10, 26, 30, 18, 31, 26, 31, 18, 20, 23, 29, 20, 30, 23, 30,
+    13, 9, 11, 5, 12, 9, 6, 31, 11, 5, 11, 29, 11, 23, 23, 31, 13, 10, 18, 31, 26, 30, 26, 31, 18, 20, 20, 30, 23, 29, 23, 30,
+    15, 17, 18, 29, 18, 29, 20, 31, 17, 18, 20, 23, 20, 23, 24, 28, 20, 27, 25, 28, 25, 28, 25, 30, 20, 24, 24, 26, 24, 26, 24, 31,
+    14, 7, 11, 7, 11, 7, 12, 7, 13, 7, 11, 7, 11, 7, 12, 7, 15, 6, 12, 8, 12, 8, 7, 6, 10, 6, 10, 6, 10, 6, 7, 6,
+    15, 8, 10, 8, 12, 6, 10, 9, 13, 8, 10, 8, 12, 6, 10, 9, 12, 9, 12, 8, 7, 6, 7, 6, 10, 7, 10, 8, 7, 6, 7, 6,
+    15, 8, 12, 6, 10, 8, 10, 9, 13, 8, 12, 6, 10, 8, 10, 9, 12, 9, 7, 6, 12, 8, 7, 6, 10, 7, 7, 6, 10, 8, 7, 6,
+    14, 6, 11, 6, 11, 6, 6, 6, 13, 6, 11, 6, 11, 6, 6, 6, 15, 7, 11, 7, 11, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 31,
+    15, 8, 12, 8, 12, 8, 12, 6, 12, 8, 12, 8, 12, 8, 12, 6, 15, 7, 12, 6, 12, 6, 7, 6, 10, 6, 10, 6, 10, 6, 7, 6,
+    14, 8, 11, 8, 13, 6, 10, 6, 13, 8, 10, 8, 12, 6, 10, 21, 12, 7, 12, 9, 7, 7, 7, 6, 10, 7, 10, 20, 7, 6, 21, 27,
+    14, 8, 13, 6, 11, 8, 10, 6, 13, 8, 12, 6, 10, 8, 10, 21, 12, 7, 7, 7, 12, 9, 7, 6, 10, 7, 7, 6, 10, 20, 21, 27,
+    14, 6, 11, 6, 11, 6, 7, 6, 13, 6, 11, 20, 11, 20, 18, 25, 15, 7, 11, 7, 11, 7, 7, 27, 7, 7, 20, 25, 20, 25, 24, 24,
+    11, 7, 12, 7, 12, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 12, 8, 7, 6, 7, 6, 8, 31, 8, 5, 8, 8, 8, 8, 8, 31,
+    12, 6, 10, 9, 11, 5, 5, 5, 10, 9, 9, 9, 6, 5, 5, 5, 7, 6, 7, 6, 8, 8, 8, 31, 8, 8, 8, 8, 8, 8, 8, 31,
+    12, 6, 11, 5, 10, 9, 5, 5, 10, 9, 6, 5, 9, 9, 5, 5, 7, 6, 8, 8, 7, 6, 8, 31, 8, 8, 8, 8, 8, 8, 8, 31,
+    15, 3, 5, 3, 5, 3, 3, 3, 6, 3, 5, 3, 5, 3, 3, 28, 13, 12, 11, 30, 11, 30, 3, 31, 3, 30, 3, 30, 3, 30, 28, 31,
+    15, 7, 12, 6, 12, 6, 7, 6, 10, 6, 10, 6, 10, 6, 7, 6, 14, 7, 11, 8, 11, 8, 8, 31, 8, 8, 8, 19, 8, 19, 19, 28,
+    12, 8, 10, 8, 11, 5, 8, 5, 10, 8, 9, 21, 11, 19, 19, 26, 11, 7, 11, 8, 8, 8, 8, 31, 8, 18, 20, 27, 18, 19, 21, 29,
+    12, 8, 11, 5, 10, 8, 8, 5, 10, 8, 11, 19, 9, 21, 19, 26, 11, 7, 8, 8, 11, 8, 8, 31, 8, 18, 18, 19, 20, 27, 21, 29,
+    14, 3, 13, 18, 13, 18, 17, 31, 17, 18, 18, 20, 18, 20, 19, 25, 14, 20, 20, 26, 20, 26, 25, 30, 17, 24, 20, 25, 20, 25, 24, 25,
+    13, 7, 11, 7, 7, 7, 7, 7, 11, 7, 11, 7, 7, 7, 7, 7, 10, 6, 10, 6, 8, 5, 8, 8, 9, 8, 9, 8, 8, 5, 8, 26,
+    13, 8, 10, 8, 10, 9, 9, 9, 10, 8, 9, 8, 10, 9, 9, 9, 10, 7, 10, 8, 8, 8, 8, 8, 9, 8, 9, 8, 8, 8, 23, 29,
+    14, 6, 13, 6, 11, 5, 12, 5, 13, 6, 13, 6, 11, 5, 12, 26, 15, 5, 11, 5, 6, 5, 6, 5, 11, 5, 11, 5, 6, 5, 6, 28,
+    14, 9, 11, 9, 12, 5, 10, 5, 13, 9, 11, 23, 12, 5, 10, 27, 13, 9, 12, 9, 11, 5, 6, 31, 11, 5, 11, 23, 11, 29, 23, 31,
+    14, 8, 11, 8, 13, 6, 10, 6, 13, 8, 10, 8, 12, 6, 10, 21, 12, 8, 10, 8, 11, 5, 8, 5, 10, 8, 9, 21, 11, 19, 19, 26,
+    15, 8, 9, 8, 12, 9, 9, 9, 12, 8, 9, 22, 12, 9, 19, 22, 12, 9, 10, 8, 11, 5, 8, 28, 10, 8, 21, 22, 18, 18, 21, 22,
+    14, 10, 13, 9, 13, 9, 12, 5, 13, 10, 13, 19, 13, 19, 19, 19, 13, 6, 11, 5, 11, 6, 6, 28, 11, 18, 19, 19, 19, 21, 19, 27,
+    14, 10, 11, 9, 12, 6, 10, 5, 13, 18, 19, 21, 18, 18, 19, 21, 13, 20, 11, 26, 20, 26, 25, 27, 11, 18, 21, 21, 20, 25, 21, 25,
+    11, 7, 12, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 10, 6, 7, 6, 8, 8, 8, 31, 8, 5, 8, 26, 8, 3, 25, 30,
+    12, 6, 10, 9, 6, 5, 5, 5, 10, 9, 9, 9, 11, 5, 20, 27, 7, 6, 7, 6, 8, 8, 8, 31, 8, 8, 23, 29, 20, 20, 23, 30,
+    13, 6, 6, 6, 12, 5, 6, 5, 10, 6, 6, 26, 10, 5, 6, 27, 11, 5, 11, 28, 6, 5, 25, 31, 5, 3, 20, 29, 20, 30, 25, 30,
+    15, 5, 5, 28, 6, 3, 5, 28, 6, 20, 20, 27, 20, 20, 25, 27, 13, 10, 26, 30, 18, 31, 26, 31, 18, 20, 23, 29, 20, 30, 23, 30,
+    12, 7, 12, 9, 7, 7, 7, 6, 10, 7, 10, 20, 7, 6, 21, 27, 11, 7, 11, 8, 8, 8, 8, 31, 8, 18, 20, 27, 18, 19, 21, 29,
+    12, 9, 10, 8, 11, 5, 8, 28, 10, 8, 21, 22, 18, 18, 21, 22, 11, 7, 11, 30, 8, 31, 26, 31, 17, 18, 22, 22, 18, 18, 22, 29,
+    13, 6, 11, 6, 11, 5, 6, 28, 11, 18, 19, 21, 19, 19, 19, 27, 14, 16, 25, 28, 25, 28, 25, 31, 17, 18, 19, 21, 19, 21, 19, 29,
+    15, 17, 17, 29, 17, 17, 25, 28, 17, 18, 19, 22, 18, 18, 19, 22, 20, 20, 25, 28, 20, 26, 25, 30, 17, 18, 21, 22, 20, 25, 21, 26,
+    13, 7, 7, 7, 11, 7, 7, 7, 11, 7, 7, 7, 11, 7, 7, 7, 10, 6, 8, 5, 10, 6, 8, 8, 9, 8, 8, 5, 9, 8, 8, 26,
+    14, 6, 11, 5, 13, 6, 12, 5, 13, 6, 11, 5, 13, 6, 12, 26, 15, 5, 6, 5, 11, 5, 6, 5, 11, 5, 6, 5, 11, 5, 6, 28,
+    13, 8, 10, 9, 10, 8, 9, 9, 10, 8, 10, 9, 9, 8, 9, 9, 10, 7, 8, 8, 10, 8, 8, 8, 9, 8, 8, 8, 9, 8, 23, 29,
+    14, 9, 12, 5, 11, 9, 10, 5, 13, 9, 12, 5, 11, 23, 10, 27, 13, 9, 11, 5, 12, 9, 6, 31, 11, 5, 11, 29, 11, 23, 23, 31,
+    14, 8, 13, 6, 11, 8, 10, 6, 13, 8, 12, 6, 10, 8, 10, 21, 12, 8, 11, 5, 10, 8, 8, 5, 10, 8, 11, 19, 9, 21, 19, 26,
+    14, 10, 13, 9, 13, 9, 12, 5, 13, 10, 13, 19, 13, 19, 19, 19, 13, 6, 11, 6, 11, 5, 6, 28, 11, 18, 19, 21, 19, 19, 19, 27,
+    15, 8, 12, 9, 9, 8, 9, 9, 12, 8, 12, 9, 9, 22, 19, 22, 12, 9, 11, 5, 10, 8, 8, 28, 10, 8, 18, 18, 21, 22, 21, 22,
+    14, 10, 12, 6, 11, 9, 10, 5, 13, 18, 18, 18, 19, 21, 19, 21, 13, 20, 20, 26, 11, 26, 25, 27, 11, 18, 20, 25, 21, 21, 21, 25,
+    11, 7, 7, 7, 12, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 10, 6, 8, 8, 7, 6, 8, 31, 8, 5, 8, 3, 8, 26, 25, 30,
+    13, 6, 12, 5, 6, 6, 6, 5, 10, 6, 10, 5, 6, 26, 6, 27, 11, 5, 6, 5, 11, 28, 25, 31, 5, 3, 20, 30, 20, 29, 25, 30,
+    12, 6, 6, 5, 10, 9, 5, 5, 10, 9, 11, 5, 9, 9, 20, 27, 7, 6, 8, 8, 7, 6, 8, 31, 8, 8, 20, 20, 23, 29, 23, 30,
+    15, 5, 6, 3, 5, 28, 5, 28, 6, 20, 20, 20, 20, 27, 25, 27, 13, 10, 18, 31, 26, 30, 26, 31, 18, 20, 20, 30, 23, 29, 23, 30,
+    12, 7, 7, 7, 12, 9, 7, 6, 10, 7, 7, 6, 10, 20, 21, 27, 11, 7, 8, 8, 11, 8, 8, 31, 8, 18, 18, 19, 20, 27, 21, 29,
+    13, 6, 11, 5, 11, 6, 6, 28, 11, 18, 19, 19, 19, 21, 19, 27, 14, 16, 25, 28, 25, 28, 25, 31, 17, 18, 19, 21, 19, 21, 19, 29,
+    12, 9, 11, 5, 10, 8, 8, 28, 10, 8, 18, 18, 21, 22, 21, 22, 11, 7, 8, 31, 11, 30, 26, 31, 17, 18, 18, 18, 22, 22, 22, 29,
+    15, 17, 17, 17, 17, 29, 25, 28, 17, 18, 18, 18, 19, 22, 19, 22, 20, 20, 20, 26, 25, 28, 25, 30, 17, 18, 20, 25, 21, 22, 21, 26,
+    11, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 9, 8, 8, 5, 8, 5, 8, 3, 17, 24, 20, 24, 20, 24, 24, 25,
+    13, 6, 11, 5, 10, 6, 10, 5, 11, 6, 11, 20, 10, 6, 24, 25, 11, 5, 6, 5, 5, 3, 20, 30, 17, 20, 20, 23, 20, 24, 24, 26,
+    13, 6, 10, 6, 11, 5, 10, 5, 11, 6, 10, 6, 11, 20, 24, 25, 11, 5, 5, 3, 6, 5, 20, 30, 17, 20, 20, 24, 20, 23, 24, 26,
+    15, 6, 12, 5, 12, 5, 12, 3, 12, 18, 20, 20, 20, 20, 24, 25, 15, 17, 18, 29, 18, 29, 20, 31, 17, 18, 20, 23, 20, 23, 24, 28,
+    14, 6, 11, 6, 11, 6, 7, 6, 13, 6, 11, 20, 11, 20, 18, 25, 14, 3, 13, 18, 13, 18, 17, 31, 17, 18, 18, 20, 18, 20, 19, 25,
+    14, 10, 11, 9, 12, 6, 10, 5, 13, 18, 19, 21, 18, 18, 19, 21, 15, 17, 17, 29, 17, 17, 25, 28, 17, 18, 19, 22, 18, 18, 19, 22,
+    14, 10, 12, 6, 11, 9, 10, 5, 13, 18, 18, 18, 19, 21, 19, 21, 15, 17, 17, 17, 17, 29, 25, 28, 17, 18, 18, 18, 19, 22, 19, 22,
+    15, 12, 12, 9, 12, 9, 12, 3, 17, 18, 19, 19, 19, 19, 19, 19, 20, 20, 20, 26, 20, 26, 25, 27, 17, 18, 19, 21, 19, 21, 19, 25,
+    11, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 24, 9, 8, 8, 26, 8, 26, 25, 30, 20, 24, 24, 25, 24, 25, 24, 24,
+    13, 6, 12, 26, 6, 26, 6, 27, 10, 6, 24, 25, 24, 25, 24, 24, 11, 5, 6, 28, 20, 29, 25, 30, 20, 24, 24, 26, 24, 25, 24, 30,
+    13, 6, 6, 26, 12, 26, 6, 27, 10, 6, 24, 25, 24, 25, 24, 24, 11, 5, 20, 29, 6, 28, 25, 30, 20, 24, 24, 25, 24, 26, 24, 30,
+    15, 20, 25, 26, 25, 26, 25, 27, 20, 24, 24, 25, 24, 25, 24, 24, 20, 27, 25, 28, 25, 28, 25, 30, 20, 24, 24, 26, 24, 26, 24, 31,
+    15, 7, 11, 7, 11, 7, 7, 27, 7, 7, 20, 25, 20, 25, 24, 24, 14, 20, 20, 26, 20, 26, 25, 30, 17, 24, 20, 25, 20, 25, 24, 25,
+    13, 20, 11, 26, 20, 26, 25, 27, 11, 18, 21, 21, 20, 25, 21, 25, 20, 20, 25, 28, 20, 26, 25, 30, 17, 18, 21, 22, 20, 25, 21, 26,
+    13, 20, 20, 26, 11, 26, 25, 27, 11, 18, 20, 25, 21, 21, 21, 25, 20, 20, 20, 26, 25, 28, 25, 30, 17, 18, 20, 25, 21, 22, 21, 26,
+    20, 20, 20, 26, 20, 26, 25, 27, 17, 18, 19, 21, 19, 21, 19, 25, 20, 20, 20, 30, 20, 30, 25, 30, 17, 18, 19, 22, 19, 22, 19, 28,
+    13, 7, 7, 7, 7, 7, 5, 5, 14, 5, 11, 5, 11, 5, 6, 5, 12, 8, 7, 7, 7, 7, 8, 5, 11, 5, 12, 5, 12, 5, 6, 5,
+    11, 7, 7, 7, 9, 9, 5, 5, 13, 5, 11, 5, 10, 5, 6, 5, 11, 8, 10, 7, 9, 9, 5, 5, 11, 5, 12, 5, 10, 5, 6, 31,
+    11, 7, 9, 9, 7, 7, 5, 5, 13, 5, 10, 5, 11, 5, 6, 5, 11, 8, 9, 9, 10, 7, 5, 5, 11, 5, 10, 5, 12, 5, 6, 31,
+    9, 8, 9, 9, 9, 9, 8, 5, 11, 5, 10, 5, 10, 5, 6, 5, 9, 8, 9, 9, 9, 9, 8, 30, 11, 5, 10, 5, 10, 5, 6, 31,
+    15, 8, 12, 6, 12, 6, 11, 5, 14, 6, 13, 6, 13, 6, 6, 6, 10, 8, 10, 9, 10, 9, 5, 5, 11, 5, 12, 5, 12, 5, 6, 5,
+    13, 8, 12, 6, 10, 9, 6, 5, 13, 6, 13, 6, 10, 6, 6, 26, 10, 8, 10, 9, 9, 9, 5, 5, 11, 5, 12, 26, 10, 5, 6, 27,
+    13, 8, 10, 9, 12, 6, 6, 5, 13, 6, 10, 6, 13, 6, 6, 26, 10, 8, 9, 9, 10, 9, 5, 5, 11, 5, 10, 5, 12, 26, 6, 27,
+    10, 8, 10, 9, 10, 9, 11, 5, 11, 6, 10, 6, 10, 6, 24, 25, 9, 8, 9, 9, 9, 9, 20, 27, 11, 20, 24, 25, 24, 25, 24, 24,
+    12, 8, 7, 7, 7, 7, 8, 5, 11, 5, 12, 5, 12, 5, 6, 5, 12, 7, 7, 7, 7, 7, 8, 31, 6, 5, 6, 5, 6, 5, 4, 31,
+    7, 7, 7, 7, 5, 5, 3, 3, 10, 5, 10, 5, 5, 3, 5, 31, 10, 7, 7, 7, 5, 5, 8, 31, 6, 5, 6, 31, 5, 31, 4, 31,
+    7, 7, 5, 5, 7, 7, 3, 3, 10, 5, 5, 3, 10, 5, 5, 31, 10, 7, 5, 5, 7, 7, 8, 31, 6, 5, 5, 31, 6, 31, 4, 31,
+    9, 9, 8, 5, 8, 5, 8, 8, 5, 3, 5, 3, 5, 3, 4, 30, 9, 9, 8, 30, 8, 30, 23, 30, 5, 29, 5, 30, 5, 30, 23, 31,
+    12, 9, 7, 6, 7, 6, 8, 8, 15, 5, 11, 5, 11, 5, 11, 28, 12, 8, 7, 6, 7, 6, 8, 31, 6, 5, 6, 5, 6, 5, 25, 31,
+    10, 7, 7, 6, 8, 8, 8, 8, 11, 5, 11, 5, 5, 3, 20, 29, 10, 8, 7, 6, 8, 8, 8, 31, 6, 5, 6, 28, 20, 30, 25, 30,
+    10, 7, 8, 8, 7, 6, 8, 8, 11, 5, 5, 3, 11, 5, 20, 29, 10, 8, 8, 8, 7, 6, 8, 31, 6, 5, 20, 30, 6, 28, 25, 30,
+    9, 8, 8, 8, 8, 8, 20, 20, 17, 20, 20, 24, 20, 24, 24, 25, 9, 8, 23, 29, 23, 29, 23, 30, 20, 23, 24, 26, 24, 26, 24, 30,
+    11, 7, 7, 7, 9, 9, 5, 5, 13, 5, 11, 5, 10, 5, 6, 5, 7, 7, 7, 7, 5, 5, 3, 3, 10, 5, 10, 5, 5, 3, 5, 31,
+    7, 7, 7, 7, 3, 3, 3, 3, 11, 5, 11, 5, 5, 3, 5, 29, 7, 7, 7, 7, 3, 3, 3, 30, 10, 5, 10, 5, 5, 3, 5, 30,
+    13, 5, 10, 5, 10, 5, 5, 3, 15, 3, 12, 3, 12, 3, 6, 29, 11, 5, 10, 5, 6, 5, 5, 31, 12, 3, 12, 3, 6, 29, 6, 31,
+    11, 5, 10, 5, 5, 3, 5, 3, 12, 3, 12, 3, 6, 3, 6, 29, 11, 5, 10, 5, 5, 29, 5, 30, 12, 3, 12, 29, 6, 29, 23, 31,
+    14, 6, 11, 6, 15, 3, 5, 3, 14, 9, 11, 9, 15, 5, 5, 28, 11, 6, 6, 6, 5, 3, 3, 3, 12, 5, 10, 5, 6, 3, 5, 28,
+    13, 6, 11, 6, 6, 3, 5, 3, 13, 9, 11, 23, 6, 20, 20, 27, 11, 6, 6, 6, 5, 3, 3, 28, 12, 5, 10, 27, 20, 20, 25, 27,
+    14, 9, 12, 5, 15, 5, 6, 3, 15, 6, 12, 5, 15, 20, 25, 26, 11, 9, 10, 5, 5, 28, 5, 28, 12, 5, 12, 3, 25, 26, 25, 27,
+    13, 9, 12, 5, 6, 20, 20, 20, 12, 18, 20, 20, 20, 24, 24, 25, 11, 23, 10, 27, 20, 27, 25, 27, 20, 20, 24, 25, 24, 25, 24, 24,
+    11, 8, 10, 7, 9, 9, 5, 5, 11, 5, 12, 5, 10, 5, 6, 31, 10, 7, 7, 7, 5, 5, 8, 31, 6, 5, 6, 31, 5, 31, 4, 31,
+    7, 7, 7, 7, 3, 3, 3, 30, 10, 5, 10, 5, 5, 3, 5, 30, 7, 7, 7, 7, 3, 30, 3, 31, 6, 5, 6, 31, 4, 30, 23, 31,
+    11, 5, 6, 5, 10, 5, 5, 31, 12, 3, 6, 29, 12, 3, 6, 31, 12, 5, 6, 31, 6, 31, 4, 31, 6, 29, 6, 31, 6, 31, 27, 31,
+    10, 5, 6, 5, 5, 3, 4, 30, 6, 3, 6, 29, 3, 30, 23, 30, 10, 5, 6, 31, 5, 30, 23, 31, 6, 29, 23, 31, 23, 30, 23, 31,
+    15, 7, 11, 7, 13, 12, 11, 30, 13, 9, 12, 9, 13, 10, 26, 30, 11, 7, 7, 6, 11, 30, 3, 31, 11, 5, 6, 31, 18, 31, 26, 31,
+    7, 7, 7, 7, 3, 30, 3, 30, 11, 5, 11, 23, 18, 20, 23, 29, 7, 7, 7, 31, 3, 30, 28, 31, 11, 29, 23, 31, 20, 30, 23, 30,
+    13, 9, 11, 5, 13, 10, 18, 31, 15, 17, 18, 29, 20, 27, 25, 28, 12, 9, 6, 31, 26, 30, 26, 31, 18, 29, 20, 31, 25, 28, 25, 30,
+    11, 5, 11, 29, 18, 20, 20, 30, 17, 18, 20, 23, 20, 24, 24, 26, 11, 23, 23, 31, 23, 29, 23, 30, 20, 23, 24, 28, 24, 26, 24, 31,
+    11, 7, 9, 9, 7, 7, 5, 5, 13, 5, 10, 5, 11, 5, 6, 5, 7, 7, 5, 5, 7, 7, 3, 3, 10, 5, 5, 3, 10, 5, 5, 31,
+    13, 5, 10, 5, 10, 5, 5, 3, 15, 3, 12, 3, 12, 3, 6, 29, 11, 5, 6, 5, 10, 5, 5, 31, 12, 3, 6, 29, 12, 3, 6, 31,
+    7, 7, 3, 3, 7, 7, 3, 3, 11, 5, 5, 3, 11, 5, 5, 29, 7, 7, 3, 3, 7, 7, 3, 30, 10, 5, 5, 3, 10, 5, 5, 30,
+    11, 5, 5, 3, 10, 5, 5, 3, 12, 3, 6, 3, 12, 3, 6, 29, 11, 5, 5, 29, 10, 5, 5, 30, 12, 3, 6, 29, 12, 29, 23, 31,
+    14, 6, 15, 3, 11, 6, 5, 3, 14, 9, 15, 5, 11, 9, 5, 28, 11, 6, 5, 3, 6, 6, 3, 3, 12, 5, 6, 3, 10, 5, 5, 28,
+    14, 9, 15, 5, 12, 5, 6, 3, 15, 6, 15, 20, 12, 5, 25, 26, 11, 9, 5, 28, 10, 5, 5, 28, 12, 5, 25, 26, 12, 3, 25, 27,
+    13, 6, 6, 3, 11, 6, 5, 3, 13, 9, 6, 20, 11, 23, 20, 27, 11, 6, 5, 3, 6, 6, 3, 28, 12, 5, 20, 20, 10, 27, 25, 27,
+    13, 9, 6, 20, 12, 5, 20, 20, 12, 18, 20, 24, 20, 20, 24, 25, 11, 23, 20, 27, 10, 27, 25, 27, 20, 20, 24, 25, 24, 25, 24, 24,
+    11, 8, 9, 9, 10, 7, 5, 5, 11, 5, 10, 5, 12, 5, 6, 31, 10, 7, 5, 5, 7, 7, 8, 31, 6, 5, 5, 31, 6, 31, 4, 31,
+    11, 5, 10, 5, 6, 5, 5, 31, 12, 3, 12, 3, 6, 29, 6, 31, 12, 5, 6, 31, 6, 31, 4, 31, 6, 29, 6, 31, 6, 31, 27, 31,
+    7, 7, 3, 3, 7, 7, 3, 30, 10, 5, 5, 3, 10, 5, 5, 30, 7, 7, 3, 30, 7, 7, 3, 31, 6, 5, 4, 30, 6, 31, 23, 31,
+    10, 5, 5, 3, 6, 5, 4, 30, 6, 3, 3, 30, 6, 29, 23, 30, 10, 5, 5, 30, 6, 31, 23, 31, 6, 29, 23, 30, 23, 31, 23, 31,
+    15, 7, 13, 12, 11, 7, 11, 30, 13, 9, 13, 10, 12, 9, 26, 30, 11, 7, 11, 30, 7, 6, 3, 31, 11, 5, 18, 31, 6, 31, 26, 31,
+    13, 9, 13, 10, 11, 5, 18, 31, 15, 17, 20, 27, 18, 29, 25, 28, 12, 9, 26, 30, 6, 31, 26, 31, 18, 29, 25, 28, 20, 31, 25, 30,
+    7, 7, 3, 30, 7, 7, 3, 30, 11, 5, 18, 20, 11, 23, 23, 29, 7, 7, 3, 30, 7, 31, 28, 31, 11, 29, 20, 30, 23, 31, 23, 30,
+    11, 5, 18, 20, 11, 29, 20, 30, 17, 18, 20, 24, 20, 23, 24, 26, 11, 23, 23, 29, 23, 31, 23, 30, 20, 23, 24, 26, 24, 28, 24, 31,
+    9, 8, 9, 9, 9, 9, 8, 5, 11, 5, 10, 5, 10, 5, 6, 5, 9, 9, 8, 5, 8, 5, 8, 8, 5, 3, 5, 3, 5, 3, 4, 30,
+    11, 5, 10, 5, 5, 3, 5, 3, 12, 3, 12, 3, 6, 3, 6, 29, 10, 5, 6, 5, 5, 3, 4, 30, 6, 3, 6, 29, 3, 30, 23, 30,
+    11, 5, 5, 3, 10, 5, 5, 3, 12, 3, 6, 3, 12, 3, 6, 29, 10, 5, 5, 3, 6, 5, 4, 30, 6, 3, 3, 30, 6, 29, 23, 30,
+    12, 3, 6, 3, 6, 3, 3, 30, 15, 16, 23, 23, 23, 23, 23, 29, 12, 3, 6, 29, 6, 29, 23, 30, 23, 23, 23, 29, 23, 29, 23, 31,
+    15, 12, 13, 12, 13, 12, 11, 7, 15, 10, 12, 10, 12, 10, 25, 29, 13, 12, 11, 7, 11, 7, 16, 31, 15, 17, 21, 29, 21, 29, 25, 28,
+    15, 10, 12, 10, 15, 17, 21, 29, 15, 17, 20, 23, 18, 18, 20, 27, 12, 10, 25, 29, 21, 29, 25, 28, 18, 18, 20, 27, 20, 20, 25, 27,
+    15, 10, 15, 17, 12, 10, 21, 29, 15, 17, 18, 18, 20, 23, 20, 27, 12, 10, 21, 29, 25, 29, 25, 28, 18, 18, 20, 20, 20, 27, 25, 27,
+    15, 17, 18, 18, 18, 18, 20, 20, 17, 17, 20, 20, 20, 20, 24, 25, 20, 23, 20, 27, 20, 27, 25, 27, 20, 20, 24, 25, 24, 25, 24, 24,
+    9, 8, 9, 9, 9, 9, 8, 30, 11, 5, 10, 5, 10, 5, 6, 31, 9, 9, 8, 30, 8, 30, 23, 30, 5, 29, 5, 30, 5, 30, 23, 31,
+    11, 5, 10, 5, 5, 29, 5, 30, 12, 3, 12, 29, 6, 29, 23, 31, 10, 5, 6, 31, 5, 30, 23, 31, 6, 29, 23, 31, 23, 30, 23, 31,
+    11, 5, 5, 29, 10, 5, 5, 30, 12, 3, 6, 29, 12, 29, 23, 31, 10, 5, 5, 30, 6, 31, 23, 31, 6, 29, 23, 30, 23, 31, 23, 31,
+    12, 3, 6, 29, 6, 29, 23, 30, 23, 23, 23, 29, 23, 29, 23, 31, 12, 29, 23, 31, 23, 31, 23, 31, 23, 29, 23, 31, 23, 31, 23, 31,
+    15, 23, 13, 29, 13, 29, 23, 30, 14, 23, 13, 29, 13, 29, 23, 31, 13, 29, 23, 30, 23, 30, 23, 30, 23, 29, 23, 30, 23, 30, 23, 31,
+    14, 23, 13, 29, 23, 29, 23, 30, 12, 23, 23, 29, 18, 29, 23, 31, 13, 29, 23, 31, 23, 30, 23, 31, 18, 29, 23, 31, 20, 30, 23, 31,
+    14, 23, 23, 29, 13, 29, 23, 30, 12, 23, 18, 29, 23, 29, 23, 31, 13, 29, 23, 30, 23, 31, 23, 31, 18, 29, 20, 30, 23, 31, 23, 31,
+    12, 23, 18, 29, 18, 29, 20, 30, 17, 17, 20, 23, 20, 23, 24, 28, 23, 29, 23, 31, 23, 31, 23, 31, 20, 23, 24, 28, 24, 28, 24, 31,
+    15, 8, 12, 6, 12, 6, 11, 5, 14, 6, 13, 6, 13, 6, 6, 6, 12, 9, 7, 6, 7, 6, 8, 8, 15, 5, 11, 5, 11, 5, 11, 28,
+    14, 6, 11, 6, 15, 3, 5, 3, 14, 9, 11, 9, 15, 5, 5, 28, 15, 7, 11, 7, 13, 12, 11, 30, 13, 9, 12, 9, 13, 10, 26, 30,
+    14, 6, 15, 3, 11, 6, 5, 3, 14, 9, 15, 5, 11, 9, 5, 28, 15, 7, 13, 12, 11, 7, 11, 30, 13, 9, 13, 10, 12, 9, 26, 30,
+    15, 12, 13, 12, 13, 12, 11, 7, 15, 10, 12, 10, 12, 10, 25, 29, 15, 23, 13, 29, 13, 29, 23, 30, 14, 23, 13, 29, 13, 29, 23, 31,
+    15, 10, 14, 10, 14, 10, 14, 7, 14, 9, 14, 9, 14, 9, 19, 19, 15, 7, 13, 10, 13, 10, 11, 31, 14, 9, 12, 19, 12, 19, 19, 28,
+    15, 10, 13, 10, 14, 12, 13, 18, 14, 9, 13, 21, 15, 19, 19, 21, 15, 10, 13, 10, 13, 12, 25, 28, 14, 17, 20, 26, 18, 18, 21, 27,
+    15, 10, 14, 12, 13, 10, 13, 18, 14, 9, 15, 19, 13, 21, 19, 21, 15, 10, 13, 12, 13, 10, 25, 28, 14, 17, 18, 18, 20, 26, 21, 27,
+    15, 12, 13, 18, 13, 18, 17, 20, 15, 17, 18, 20, 18, 20, 18, 25, 15, 23, 20, 27, 20, 27, 20, 27, 14, 20, 24, 25, 24, 25, 24, 24,
+    10, 8, 10, 9, 10, 9, 5, 5, 11, 5, 12, 5, 12, 5, 6, 5, 12, 8, 7, 6, 7, 6, 8, 31, 6, 5, 6, 5, 6, 5, 25, 31,
+    11, 6, 6, 6, 5, 3, 3, 3, 12, 5, 10, 5, 6, 3, 5, 28, 11, 7, 7, 6, 11, 30, 3, 31, 11, 5, 6, 31, 18, 31, 26, 31,
+    11, 6, 5, 3, 6, 6, 3, 3, 12, 5, 6, 3, 10, 5, 5, 28, 11, 7, 11, 30, 7, 6, 3, 31, 11, 5, 18, 31, 6, 31, 26, 31,
+    13, 12, 11, 7, 11, 7, 16, 31, 15, 17, 21, 29, 21, 29, 25, 28, 13, 29, 23, 30, 23, 30, 23, 30, 23, 29, 23, 30, 23, 30, 23, 31,
+    15, 7, 13, 10, 13, 10, 11, 31, 14, 9, 12, 19, 12, 19, 19, 28, 13, 7, 7, 7, 7, 7, 16, 31, 11, 16, 19, 19, 19, 19, 19, 28,
+    14, 7, 11, 7, 14, 16, 17, 31, 13, 17, 18, 21, 18, 19, 19, 26, 13, 7, 7, 30, 11, 30, 25, 31, 17, 17, 20, 26, 18, 18, 21, 29,
+    14, 7, 14, 16, 11, 7, 17, 31, 13, 17, 18, 19, 18, 21, 19, 26, 13, 7, 11, 30, 7, 30, 25, 31, 17, 17, 18, 18, 20, 26, 21, 29,
+    14, 17, 17, 18, 17, 18, 17, 20, 17, 17, 18, 20, 18, 20, 18, 25, 20, 23, 20, 29, 20, 29, 20, 30, 20, 20, 24, 25, 24, 25, 24, 24,
+    13, 8, 12, 6, 10, 9, 6, 5, 13, 6, 13, 6, 10, 6, 6, 26, 10, 7, 7, 6, 8, 8, 8, 8, 11, 5, 11, 5, 5, 3, 20, 29,
+    13, 6, 11, 6, 6, 3, 5, 3, 13, 9, 11, 23, 6, 20, 20, 27, 7, 7, 7, 7, 3, 30, 3, 30, 11, 5, 11, 23, 18, 20, 23, 29,
+    14, 9, 15, 5, 12, 5, 6, 3, 15, 6, 15, 20, 12, 5, 25, 26, 13, 9, 13, 10, 11, 5, 18, 31, 15, 17, 20, 27, 18, 29, 25, 28,
+    15, 10, 12, 10, 15, 17, 21, 29, 15, 17, 20, 23, 18, 18, 20, 27, 14, 23, 13, 29, 23, 29, 23, 30, 12, 23, 23, 29, 18, 29, 23, 31,
+    15, 10, 13, 10, 14, 12, 13, 18, 14, 9, 13, 21, 15, 19, 19, 21, 14, 7, 11, 7, 14, 16, 17, 31, 13, 17, 18, 21, 18, 19, 19, 26,
+    14, 10, 11, 10, 15, 16, 16, 27, 14, 17, 19, 22, 18, 18, 19, 22, 13, 7, 11, 29, 16, 29, 25, 28, 13, 17, 21, 22, 18, 18, 21, 27,
+    15, 12, 15, 10, 15, 10, 17, 17, 15, 17, 19, 19, 19, 19, 19, 19, 15, 27, 12, 29, 25, 28, 25, 28, 17, 17, 19, 19, 20, 21, 19, 27,
+    15, 17, 12, 18, 17, 17, 17, 18, 17, 17, 19, 21, 18, 18, 19, 21, 14, 23, 20, 27, 20, 27, 20, 27, 17, 20, 21, 25, 20, 25, 24, 25,
+    10, 8, 10, 9, 9, 9, 5, 5, 11, 5, 12, 26, 10, 5, 6, 27, 10, 8, 7, 6, 8, 8, 8, 31, 6, 5, 6, 28, 20, 30, 25, 30,
+    11, 6, 6, 6, 5, 3, 3, 28, 12, 5, 10, 27, 20, 20, 25, 27, 7, 7, 7, 31, 3, 30, 28, 31, 11, 29, 23, 31, 20, 30, 23, 30,
+    11, 9, 5, 28, 10, 5, 5, 28, 12, 5, 25, 26, 12, 3, 25, 27, 12, 9, 26, 30, 6, 31, 26, 31, 18, 29, 25, 28, 20, 31, 25, 30,
+    12, 10, 25, 29, 21, 29, 25, 28, 18, 18, 20, 27, 20, 20, 25, 27, 13, 29, 23, 31, 23, 30, 23, 31, 18, 29, 23, 31, 20, 30, 23, 31,
+    15, 10, 13, 10, 13, 12, 25, 28, 14, 17, 20, 26, 18, 18, 21, 27, 13, 7, 7, 30, 11, 30, 25, 31, 17, 17, 20, 26, 18, 18, 21, 29,
+    13, 7, 11, 29, 16, 29, 25, 28, 13, 17, 21, 22, 18, 18, 21, 27, 7, 29, 7, 31, 16, 30, 26, 31, 17, 17, 22, 22, 18, 18, 22, 29,
+    15, 27, 25, 28, 12, 29, 25, 28, 17, 17, 20, 21, 19, 19, 19, 27, 13, 29, 25, 30, 25, 30, 25, 31, 17, 17, 19, 27, 19, 27, 19, 29,
+    14, 17, 17, 29, 17, 17, 17, 29, 17, 17, 19, 22, 18, 18, 19, 22, 20, 23, 20, 31, 20, 29, 25, 30, 17, 20, 21, 26, 20, 25, 21, 29,
+    13, 8, 10, 9, 12, 6, 6, 5, 13, 6, 10, 6, 13, 6, 6, 26, 10, 7, 8, 8, 7, 6, 8, 8, 11, 5, 5, 3, 11, 5, 20, 29,
+    14, 9, 12, 5, 15, 5, 6, 3, 15, 6, 12, 5, 15, 20, 25, 26, 13, 9, 11, 5, 13, 10, 18, 31, 15, 17, 18, 29, 20, 27, 25, 28,
+    13, 6, 6, 3, 11, 6, 5, 3, 13, 9, 6, 20, 11, 23, 20, 27, 7, 7, 3, 30, 7, 7, 3, 30, 11, 5, 18, 20, 11, 23, 23, 29,
+    15, 10, 15, 17, 12, 10, 21, 29, 15, 17, 18, 18, 20, 23, 20, 27, 14, 23, 23, 29, 13, 29, 23, 30, 12, 23, 18, 29, 23, 29, 23, 31,
+    15, 10, 14, 12, 13, 10, 13, 18, 14, 9, 15, 19, 13, 21, 19, 21, 14, 7, 14, 16, 11, 7, 17, 31, 13, 17, 18, 19, 18, 21, 19, 26,
+    15, 12, 15, 10, 15, 10, 17, 17, 15, 17, 19, 19, 19, 19, 19, 19, 15, 27, 25, 28, 12, 29, 25, 28, 17, 17, 20, 21, 19, 19, 19, 27,
+    14, 10, 15, 16, 11, 10, 16, 27, 14, 17, 18, 18, 19, 22, 19, 22, 13, 7, 16, 29, 11, 29, 25, 28, 13, 17, 18, 18, 21, 22, 21, 27,
+    15, 17, 17, 17, 12, 18, 17, 18, 17, 17, 18, 18, 19, 21, 19, 21, 14, 23, 20, 27, 20, 27, 20, 27, 17, 20, 20, 25, 21, 25, 24, 25,
+    10, 8, 9, 9, 10, 9, 5, 5, 11, 5, 10, 5, 12, 26, 6, 27, 10, 8, 8, 8, 7, 6, 8, 31, 6, 5, 20, 30, 6, 28, 25, 30,
+    11, 9, 10, 5, 5, 28, 5, 28, 12, 5, 12, 3, 25, 26, 25, 27, 12, 9, 6, 31, 26, 30, 26, 31, 18, 29, 20, 31, 25, 28, 25, 30,
+    11, 6, 5, 3, 6, 6, 3, 28, 12, 5, 20, 20, 10, 27, 25, 27, 7, 7, 3, 30, 7, 31, 28, 31, 11, 29, 20, 30, 23, 31, 23, 30,
+    12, 10, 21, 29, 25, 29, 25, 28, 18, 18, 20, 20, 20, 27, 25, 27, 13, 29, 23, 30, 23, 31, 23, 31, 18, 29, 20, 30, 23, 31, 23, 31,
+    15, 10, 13, 12, 13, 10, 25, 28, 14, 17, 18, 18, 20, 26, 21, 27, 13, 7, 11, 30, 7, 30, 25, 31, 17, 17, 18, 18, 20, 26, 21, 29,
+    15, 27, 12, 29, 25, 28, 25, 28, 17, 17, 19, 19, 20, 21, 19, 27, 13, 29, 25, 30, 25, 30, 25, 31, 17, 17, 19, 27, 19, 27, 19, 29,
+    13, 7, 16, 29, 11, 29, 25, 28, 13, 17, 18, 18, 21, 22, 21, 27, 7, 29, 16, 30, 7, 31, 26, 31, 17, 17, 18, 18, 22, 22, 22, 29,
+    14, 17, 17, 17, 17, 29, 17, 29, 17, 17, 18, 18, 19, 22, 19, 22, 20, 23, 20, 29, 20, 31, 25, 30, 17, 20, 20, 25, 21, 26, 21, 29,
+    10, 8, 10, 9, 10, 9, 11, 5, 11, 6, 10, 6, 10, 6, 24, 25, 9, 8, 8, 8, 8, 8, 20, 20, 17, 20, 20, 24, 20, 24, 24, 25,
+    13, 9, 12, 5, 6, 20, 20, 20, 12, 18, 20, 20, 20, 24, 24, 25, 11, 5, 11, 29, 18, 20, 20, 30, 17, 18, 20, 23, 20, 24, 24, 26,
+    13, 9, 6, 20, 12, 5, 20, 20, 12, 18, 20, 24, 20, 20, 24, 25, 11, 5, 18, 20, 11, 29, 20, 30, 17, 18, 20, 24, 20, 23, 24, 26,
+    15, 17, 18, 18, 18, 18, 20, 20, 17, 17, 20, 20, 20, 20, 24, 25, 12, 23, 18, 29, 18, 29, 20, 30, 17, 17, 20, 23, 20, 23, 24, 28,
+    15, 12, 13, 18, 13, 18, 17, 20, 15, 17, 18, 20, 18, 20, 18, 25, 14, 17, 17, 18, 17, 18, 17, 20, 17, 17, 18, 20, 18, 20, 18, 25,
+    15, 17, 12, 18, 17, 17, 17, 18, 17, 17, 19, 21, 18, 18, 19, 21, 14, 17, 17, 29, 17, 17, 17, 29, 17, 17, 19, 22, 18, 18, 19, 22,
+    15, 17, 17, 17, 12, 18, 17, 18, 17, 17, 18, 18, 19, 21, 19, 21, 14, 17, 17, 17, 17, 29, 17, 29, 17, 17, 18, 18, 19, 22, 19, 22,
+    15, 17, 17, 17, 17, 17, 17, 17, 17, 17, 19, 19, 19, 19, 19, 19, 20, 23, 20, 27, 20, 27, 20, 27, 17, 17, 19, 21, 19, 21, 19, 25,
+    9, 8, 9, 9, 9, 9, 20, 27, 11, 20, 24, 25, 24, 25, 24, 24, 9, 8, 23, 29, 23, 29, 23, 30, 20, 23, 24, 26, 24, 26, 24, 30,
+    11, 23, 10, 27, 20, 27, 25, 27, 20, 20, 24, 25, 24, 25, 24, 24, 11, 23, 23, 31, 23, 29, 23, 30, 20, 23, 24, 28, 24, 26, 24, 31,
+    11, 23, 20, 27, 10, 27, 25, 27, 20, 20, 24, 25, 24, 25, 24, 24, 11, 23, 23, 29, 23, 31, 23, 30, 20, 23, 24, 26, 24, 28, 24, 31,
+    20, 23, 20, 27, 20, 27, 25, 27, 20, 20, 24, 25, 24, 25, 24, 24, 23, 29, 23, 31, 23, 31, 23, 31, 20, 23, 24, 28, 24, 28, 24, 31,
+    15, 23, 20, 27, 20, 27, 20, 27, 14, 20, 24, 25, 24, 25, 24, 24, 20, 23, 20, 29, 20, 29, 20, 30, 20, 20, 24, 25, 24, 25, 24, 24,
+    14, 23, 20, 27, 20, 27, 20, 27, 17, 20, 21, 25, 20, 25, 24, 25, 20, 23, 20, 31, 20, 29, 25, 30, 17, 20, 21, 26, 20, 25, 21, 29,
+    14, 23, 20, 27, 20, 27, 20, 27, 17, 20, 20, 25, 21, 25, 24, 25, 20, 23, 20, 29, 20, 31, 25, 30, 17, 20, 20, 25, 21, 26, 21, 29,
+    20, 23, 20, 27, 20, 27, 20, 27, 17, 17, 19, 21, 19, 21, 19, 25, 20, 29, 20, 31, 20, 31, 20, 31, 17, 17, 19, 22, 19, 22, 19, 28,
+    14, 7, 11, 7, 15, 6, 12, 8, 15, 8, 10, 8, 12, 9, 12, 8, 11, 7, 12, 7, 12, 8, 7, 6, 12, 6, 10, 9, 7, 6, 7, 6,
+    13, 7, 11, 7, 10, 6, 10, 6, 13, 8, 10, 8, 10, 7, 10, 8, 11, 7, 12, 7, 10, 6, 7, 6, 12, 6, 10, 9, 7, 6, 7, 6,
+    15, 8, 12, 6, 12, 9, 7, 6, 14, 6, 11, 6, 15, 7, 11, 7, 10, 8, 10, 9, 12, 8, 7, 6, 11, 6, 6, 6, 11, 7, 7, 6,
+    13, 8, 12, 6, 10, 7, 7, 6, 13, 6, 11, 6, 7, 7, 7, 7, 10, 8, 10, 9, 10, 8, 7, 6, 11, 6, 6, 6, 7, 7, 7, 31,
+    15, 8, 12, 8, 15, 7, 12, 6, 14, 8, 11, 8, 12, 7, 12, 9, 12, 8, 12, 6, 12, 6, 7, 6, 13, 6, 10, 6, 7, 7, 7, 6,
+    12, 8, 12, 8, 10, 6, 10, 6, 13, 8, 10, 8, 10, 7, 10, 20, 12, 8, 12, 6, 10, 6, 7, 6, 12, 6, 10, 21, 7, 6, 21, 27,
+    14, 8, 13, 6, 12, 7, 7, 7, 14, 6, 11, 6, 15, 7, 11, 7, 11, 8, 10, 6, 12, 9, 7, 6, 11, 6, 7, 6, 11, 7, 7, 27,
+    13, 8, 12, 6, 10, 7, 7, 6, 13, 6, 11, 20, 7, 7, 20, 25, 10, 8, 10, 21, 10, 20, 21, 27, 11, 20, 18, 25, 20, 25, 24, 24,
+    11, 7, 12, 7, 12, 8, 7, 6, 12, 6, 10, 9, 7, 6, 7, 6, 12, 7, 7, 7, 7, 6, 8, 31, 11, 5, 5, 5, 8, 8, 8, 31,
+    7, 7, 7, 7, 8, 5, 8, 8, 10, 9, 9, 9, 8, 8, 8, 8, 7, 7, 7, 7, 8, 8, 8, 31, 6, 5, 5, 5, 8, 8, 8, 31,
+    12, 6, 11, 5, 7, 6, 8, 8, 15, 3, 5, 3, 13, 12, 11, 30, 10, 9, 5, 5, 7, 6, 8, 31, 5, 3, 3, 3, 11, 30, 3, 31,
+    10, 9, 6, 5, 8, 8, 8, 8, 6, 3, 5, 3, 3, 30, 3, 30, 9, 9, 5, 5, 8, 8, 8, 31, 5, 3, 3, 28, 3, 30, 28, 31,
+    15, 7, 12, 6, 14, 7, 11, 8, 12, 8, 10, 8, 11, 7, 11, 8, 12, 6, 7, 6, 11, 8, 8, 31, 11, 5, 8, 5, 8, 8, 8, 31,
+    10, 6, 10, 6, 8, 8, 8, 19, 10, 8, 9, 21, 8, 18, 20, 27, 10, 6, 7, 6, 8, 19, 19, 28, 11, 19, 19, 26, 18, 19, 21, 29,
+    12, 8, 11, 5, 11, 7, 8, 8, 14, 3, 13, 18, 14, 20, 20, 26, 10, 8, 8, 5, 11, 8, 8, 31, 13, 18, 17, 31, 20, 26, 25, 30,
+    10, 8, 11, 19, 8, 18, 18, 19, 17, 18, 18, 20, 17, 24, 20, 25, 9, 21, 19, 26, 20, 27, 21, 29, 18, 20, 19, 25, 20, 25, 24, 25,
+    13, 7, 11, 7, 10, 6, 10, 6, 13, 8, 10, 8, 10, 7, 10, 8, 7, 7, 7, 7, 8, 5, 8, 8, 10, 9, 9, 9, 8, 8, 8, 8,
+    11, 7, 11, 7, 9, 8, 9, 8, 10, 8, 9, 8, 9, 8, 9, 8, 7, 7, 7, 7, 8, 5, 8, 26, 10, 9, 9, 9, 8, 8, 23, 29,
+    14, 6, 13, 6, 15, 5, 11, 5, 14, 9, 11, 9, 13, 9, 12, 9, 11, 5, 12, 5, 6, 5, 6, 5, 12, 5, 10, 5, 11, 5, 6, 31,
+    13, 6, 13, 6, 11, 5, 11, 5, 13, 9, 11, 23, 11, 5, 11, 23, 11, 5, 12, 26, 6, 5, 6, 28, 12, 5, 10, 27, 11, 29, 23, 31,
+    14, 8, 11, 8, 12, 8, 10, 8, 15, 8, 9, 8, 12, 9, 10, 8, 13, 6, 10, 6, 11, 5, 8, 5, 12, 9, 9, 9, 11, 5, 8, 28,
+    13, 8, 10, 8, 10, 8, 9, 21, 12, 8, 9, 22, 10, 8, 21, 22, 12, 6, 10, 21, 11, 19, 19, 26, 12, 9, 19, 22, 18, 18, 21, 22,
+    14, 10, 13, 9, 13, 6, 11, 5, 14, 10, 11, 9, 13, 20, 11, 26, 13, 9, 12, 5, 11, 6, 6, 28, 12, 6, 10, 5, 20, 26, 25, 27,
+    13, 10, 13, 19, 11, 18, 19, 19, 13, 18, 19, 21, 11, 18, 21, 21, 13, 19, 19, 19, 19, 21, 19, 27, 18, 18, 19, 21, 20, 25, 21, 25,
+    11, 7, 12, 7, 10, 6, 7, 6, 12, 6, 10, 9, 7, 6, 7, 6, 7, 7, 7, 7, 8, 8, 8, 31, 6, 5, 5, 5, 8, 8, 8, 31,
+    7, 7, 7, 7, 8, 5, 8, 26, 10, 9, 9, 9, 8, 8, 23, 29, 7, 7, 7, 7, 8, 3, 25, 30, 11, 5, 20, 27, 20, 20, 23, 30,
+    13, 6, 6, 6, 11, 5, 11, 28, 15, 5, 5, 28, 13, 10, 26, 30, 12, 5, 6, 5, 6, 5, 25, 31, 6, 3, 5, 28, 18, 31, 26, 31,
+    10, 6, 6, 26, 5, 3, 20, 29, 6, 20, 20, 27, 18, 20, 23, 29, 10, 5, 6, 27, 20, 30, 25, 30, 20, 20, 25, 27, 20, 30, 23, 30,
+    12, 7, 12, 9, 11, 7, 11, 8, 12, 9, 10, 8, 11, 7, 11, 30, 7, 7, 7, 6, 8, 8, 8, 31, 11, 5, 8, 28, 8, 31, 26, 31,
+    10, 7, 10, 20, 8, 18, 20, 27, 10, 8, 21, 22, 17, 18, 22, 22, 7, 6, 21, 27, 18, 19, 21, 29, 18, 18, 21, 22, 18, 18, 22, 29,
+    13, 6, 11, 6, 14, 16, 25, 28, 15, 17, 17, 29, 20, 20, 25, 28, 11, 5, 6, 28, 25, 28, 25, 31, 17, 17, 25, 28, 20, 26, 25, 30,
+    11, 18, 19, 21, 17, 18, 19, 21, 17, 18, 19, 22, 17, 18, 21, 22, 19, 19, 19, 27, 19, 21, 19, 29, 18, 18, 19, 22, 20, 25, 21, 26,
+    15, 8, 12, 6, 12, 9, 7, 6, 14, 6, 11, 6, 15, 7, 11, 7, 12, 6, 11, 5, 7, 6, 8, 8, 15, 3, 5, 3, 13, 12, 11, 30,
+    14, 6, 13, 6, 15, 5, 11, 5, 14, 9, 11, 9, 13, 9, 12, 9, 13, 6, 6, 6, 11, 5, 11, 28, 15, 5, 5, 28, 13, 10, 26, 30,
+    14, 6, 15, 3, 15, 7, 13, 12, 15, 12, 13, 12, 15, 23, 13, 29, 11, 6, 5, 3, 11, 7, 11, 30, 13, 12, 11, 7, 13, 29, 23, 30,
+    14, 9, 15, 5, 13, 9, 13, 10, 15, 10, 12, 10, 14, 23, 13, 29, 11, 9, 5, 28, 12, 9, 26, 30, 12, 10, 25, 29, 13, 29, 23, 31,
+    15, 10, 14, 10, 15, 7, 13, 10, 15, 10, 13, 10, 15, 10, 13, 10, 14, 10, 14, 7, 13, 10, 11, 31, 14, 12, 13, 18, 13, 12, 25, 28,
+    14, 9, 14, 9, 14, 9, 12, 19, 14, 9, 13, 21, 14, 17, 20, 26, 14, 9, 19, 19, 12, 19, 19, 28, 15, 19, 19, 21, 18, 18, 21, 27,
+    15, 10, 14, 12, 15, 10, 13, 12, 15, 12, 13, 18, 15, 23, 20, 27, 13, 10, 13, 18, 13, 10, 25, 28, 13, 18, 17, 20, 20, 27, 20, 27,
+    14, 9, 15, 19, 14, 17, 18, 18, 15, 17, 18, 20, 14, 20, 24, 25, 13, 21, 19, 21, 20, 26, 21, 27, 18, 20, 18, 25, 24, 25, 24, 24,
+    10, 8, 10, 9, 12, 8, 7, 6, 11, 6, 6, 6, 11, 7, 7, 6, 10, 9, 5, 5, 7, 6, 8, 31, 5, 3, 3, 3, 11, 30, 3, 31,
+    11, 5, 12, 5, 6, 5, 6, 5, 12, 5, 10, 5, 11, 5, 6, 31, 12, 5, 6, 5, 6, 5, 25, 31, 6, 3, 5, 28, 18, 31, 26, 31,
+    11, 6, 5, 3, 11, 7, 11, 30, 13, 12, 11, 7, 13, 29, 23, 30, 6, 6, 3, 3, 7, 6, 3, 31, 11, 7, 16, 31, 23, 30, 23, 30,
+    12, 5, 6, 3, 11, 5, 18, 31, 15, 17, 21, 29, 23, 29, 23, 30, 10, 5, 5, 28, 6, 31, 26, 31, 21, 29, 25, 28, 23, 30, 23, 31,
+    15, 7, 13, 10, 13, 7, 7, 7, 14, 7, 11, 7, 13, 7, 7, 30, 13, 10, 11, 31, 7, 7, 16, 31, 14, 16, 17, 31, 11, 30, 25, 31,
+    14, 9, 12, 19, 11, 16, 19, 19, 13, 17, 18, 21, 17, 17, 20, 26, 12, 19, 19, 28, 19, 19, 19, 28, 18, 19, 19, 26, 18, 18, 21, 29,
+    14, 7, 14, 16, 13, 7, 11, 30, 14, 17, 17, 18, 20, 23, 20, 29, 11, 7, 17, 31, 7, 30, 25, 31, 17, 18, 17, 20, 20, 29, 20, 30,
+    13, 17, 18, 19, 17, 17, 18, 18, 17, 17, 18, 20, 20, 20, 24, 25, 18, 21, 19, 26, 20, 26, 21, 29, 18, 20, 18, 25, 24, 25, 24, 24,
+    13, 8, 12, 6, 10, 7, 7, 6, 13, 6, 11, 6, 7, 7, 7, 7, 10, 9, 6, 5, 8, 8, 8, 8, 6, 3, 5, 3, 3, 30, 3, 30,
+    13, 6, 13, 6, 11, 5, 11, 5, 13, 9, 11, 23, 11, 5, 11, 23, 10, 6, 6, 26, 5, 3, 20, 29, 6, 20, 20, 27, 18, 20, 23, 29,
+    14, 9, 15, 5, 13, 9, 13, 10, 15, 10, 12, 10, 14, 23, 13, 29, 12, 5, 6, 3, 11, 5, 18, 31, 15, 17, 21, 29, 23, 29, 23, 30,
+    15, 6, 15, 20, 15, 17, 20, 27, 15, 17, 20, 23, 12, 23, 23, 29, 12, 5, 25, 26, 18, 29, 25, 28, 18, 18, 20, 27, 18, 29, 23, 31,
+    15, 10, 13, 10, 14, 7, 11, 7, 14, 10, 11, 10, 13, 7, 11, 29, 14, 12, 13, 18, 14, 16, 17, 31, 15, 16, 16, 27, 16, 29, 25, 28,
+    14, 9, 13, 21, 13, 17, 18, 21, 14, 17, 19, 22, 13, 17, 21, 22, 15, 19, 19, 21, 18, 19, 19, 26, 18, 18, 19, 22, 18, 18, 21, 27,
+    15, 12, 15, 10, 15, 27, 12, 29, 15, 17, 12, 18, 14, 23, 20, 27, 15, 10, 17, 17, 25, 28, 25, 28, 17, 17, 17, 18, 20, 27, 20, 27,
+    15, 17, 19, 19, 17, 17, 19, 19, 17, 17, 19, 21, 17, 20, 21, 25, 19, 19, 19, 19, 20, 21, 19, 27, 18, 18, 19, 21, 20, 25, 24, 25,
+    10, 8, 10, 9, 10, 8, 7, 6, 11, 6, 6, 6, 7, 7, 7, 31, 9, 9, 5, 5, 8, 8, 8, 31, 5, 3, 3, 28, 3, 30, 28, 31,
+    11, 5, 12, 26, 6, 5, 6, 28, 12, 5, 10, 27, 11, 29, 23, 31, 10, 5, 6, 27, 20, 30, 25, 30, 20, 20, 25, 27, 20, 30, 23, 30,
+    11, 9, 5, 28, 12, 9, 26, 30, 12, 10, 25, 29, 13, 29, 23, 31, 10, 5, 5, 28, 6, 31, 26, 31, 21, 29, 25, 28, 23, 30, 23, 31,
+    12, 5, 25, 26, 18, 29, 25, 28, 18, 18, 20, 27, 18, 29, 23, 31, 12, 3, 25, 27, 20, 31, 25, 30, 20, 20, 25, 27, 20, 30, 23, 31,
+    15, 10, 13, 10, 13, 7, 7, 30, 13, 7, 11, 29, 7, 29, 7, 31, 13, 12, 25, 28, 11, 30, 25, 31, 16, 29, 25, 28, 16, 30, 26, 31,
+    14, 17, 20, 26, 17, 17, 20, 26, 13, 17, 21, 22, 17, 17, 22, 22, 18, 18, 21, 27, 18, 18, 21, 29, 18, 18, 21, 27, 18, 18, 22, 29,
+    15, 27, 25, 28, 13, 29, 25, 30, 14, 17, 17, 29, 20, 23, 20, 31, 12, 29, 25, 28, 25, 30, 25, 31, 17, 17, 17, 29, 20, 29, 25, 30,
+    17, 17, 20, 21, 17, 17, 19, 27, 17, 17, 19, 22, 17, 20, 21, 26, 19, 19, 19, 27, 19, 27, 19, 29, 18, 18, 19, 22, 20, 25, 21, 29,
+    15, 8, 12, 8, 15, 7, 12, 6, 14, 8, 11, 8, 12, 7, 12, 9, 15, 7, 12, 6, 14, 7, 11, 8, 12, 8, 10, 8, 11, 7, 11, 8,
+    14, 8, 11, 8, 12, 8, 10, 8, 15, 8, 9, 8, 12, 9, 10, 8, 12, 7, 12, 9, 11, 7, 11, 8, 12, 9, 10, 8, 11, 7, 11, 30,
+    15, 10, 14, 10, 15, 7, 13, 10, 15, 10, 13, 10, 15, 10, 13, 10, 15, 7, 13, 10, 13, 7, 7, 7, 14, 7, 11, 7, 13, 7, 7, 30,
+    15, 10, 13, 10, 14, 7, 11, 7, 14, 10, 11, 10, 13, 7, 11, 29, 15, 10, 13, 10, 13, 7, 7, 30, 13, 7, 11, 29, 7, 29, 7, 31,
+    15, 8, 14, 8, 15, 9, 12, 9, 15, 8, 13, 8, 12, 9, 12, 9, 15, 9, 12, 9, 14, 7, 11, 7, 12, 9, 10, 9, 11, 19, 19, 19,
+    15, 8, 13, 8, 12, 9, 10, 9, 14, 8, 11, 20, 12, 17, 18, 20, 12, 9, 12, 9, 11, 19, 19, 19, 12, 17, 18, 20, 17, 17, 20, 20,
+    15, 10, 14, 10, 15, 7, 13, 10, 14, 10, 13, 19, 15, 18, 19, 21, 15, 7, 13, 10, 13, 7, 7, 28, 14, 17, 11, 19, 18, 20, 19, 27,
+    14, 10, 13, 19, 14, 17, 11, 19, 14, 17, 17, 20, 17, 18, 18, 20, 15, 18, 19, 21, 18, 20, 19, 27, 17, 18, 18, 20, 17, 25, 20, 24,
+    12, 8, 12, 6, 12, 6, 7, 6, 13, 6, 10, 6, 7, 7, 7, 6, 12, 6, 7, 6, 11, 8, 8, 31, 11, 5, 8, 5, 8, 8, 8, 31,
+    13, 6, 10, 6, 11, 5, 8, 5, 12, 9, 9, 9, 11, 5, 8, 28, 7, 7, 7, 6, 8, 8, 8, 31, 11, 5, 8, 28, 8, 31, 26, 31,
+    14, 10, 14, 7, 13, 10, 11, 31, 14, 12, 13, 18, 13, 12, 25, 28, 13, 10, 11, 31, 7, 7, 16, 31, 14, 16, 17, 31, 11, 30, 25, 31,
+    14, 12, 13, 18, 14, 16, 17, 31, 15, 16, 16, 27, 16, 29, 25, 28, 13, 12, 25, 28, 11, 30, 25, 31, 16, 29, 25, 28, 16, 30, 26, 31,
+    15, 9, 12, 9, 14, 7, 11, 7, 12, 9, 10, 9, 11, 19, 19, 19, 14, 7, 11, 7, 14, 16, 16, 31, 11, 16, 16, 19, 16, 19, 19, 28,
+    12, 9, 10, 9, 11, 16, 16, 19, 12, 16, 17, 20, 17, 17, 18, 20, 11, 19, 19, 19, 16, 19, 19, 28, 17, 17, 18, 20, 17, 17, 20, 27,
+    14, 7, 14, 16, 14, 16, 16, 16, 14, 16, 16, 19, 18, 21, 19, 21, 14, 16, 16, 16, 13, 28, 16, 31, 17, 17, 16, 19, 18, 20, 19, 29,
+    14, 16, 16, 19, 17, 17, 16, 19, 17, 17, 17, 20, 17, 18, 18, 25, 18, 21, 19, 21, 18, 20, 19, 29, 17, 18, 18, 25, 17, 25, 20, 24,
+    12, 8, 12, 8, 10, 6, 10, 6, 13, 8, 10, 8, 10, 7, 10, 20, 10, 6, 10, 6, 8, 8, 8, 19, 10, 8, 9, 21, 8, 18, 20, 27,
+    13, 8, 10, 8, 10, 8, 9, 21, 12, 8, 9, 22, 10, 8, 21, 22, 10, 7, 10, 20, 8, 18, 20, 27, 10, 8, 21, 22, 17, 18, 22, 22,
+    14, 9, 14, 9, 14, 9, 12, 19, 14, 9, 13, 21, 14, 17, 20, 26, 14, 9, 12, 19, 11, 16, 19, 19, 13, 17, 18, 21, 17, 17, 20, 26,
+    14, 9, 13, 21, 13, 17, 18, 21, 14, 17, 19, 22, 13, 17, 21, 22, 14, 17, 20, 26, 17, 17, 20, 26, 13, 17, 21, 22, 17, 17, 22, 22,
+    15, 8, 13, 8, 12, 9, 10, 9, 14, 8, 11, 20, 12, 17, 18, 20, 12, 9, 10, 9, 11, 16, 16, 19, 12, 16, 17, 20, 17, 17, 18, 20,
+    14, 8, 11, 20, 12, 16, 17, 20, 15, 16, 16, 23, 16, 16, 19, 22, 12, 17, 18, 20, 17, 17, 18, 20, 16, 16, 19, 22, 16, 16, 21, 23,
+    14, 10, 14, 16, 15, 16, 12, 16, 14, 16, 17, 18, 16, 19, 18, 18, 15, 16, 12, 16, 16, 16, 16, 16, 16, 16, 17, 18, 18, 18, 18, 18,
+    14, 16, 17, 18, 16, 16, 17, 18, 16, 16, 17, 20, 16, 16, 18, 21, 16, 19, 18, 18, 18, 18, 18, 18, 16, 16, 18, 21, 16, 16, 20, 20,
+    12, 8, 12, 6, 10, 6, 7, 6, 12, 6, 10, 21, 7, 6, 21, 27, 10, 6, 7, 6, 8, 19, 19, 28, 11, 19, 19, 26, 18, 19, 21, 29,
+    12, 6, 10, 21, 11, 19, 19, 26, 12, 9, 19, 22, 18, 18, 21, 22, 7, 6, 21, 27, 18, 19, 21, 29, 18, 18, 21, 22, 18, 18, 22, 29,
+    14, 9, 19, 19, 12, 19, 19, 28, 15, 19, 19, 21, 18, 18, 21, 27, 12, 19, 19, 28, 19, 19, 19, 28, 18, 19, 19, 26, 18, 18, 21, 29,
+    15, 19, 19, 21, 18, 19, 19, 26, 18, 18, 19, 22, 18, 18, 21, 27, 18, 18, 21, 27, 18, 18, 21, 29, 18, 18, 21, 27, 18, 18, 22, 29,
+    12, 9, 12, 9, 11, 19, 19, 19, 12, 17, 18, 20, 17, 17, 20, 20, 11, 19, 19, 19, 16, 19, 19, 28, 17, 17, 18, 20, 17, 17, 20, 27,
+    12, 17, 18, 20, 17, 17, 18, 20, 16, 16, 19, 22, 16, 16, 21, 23, 17, 17, 20, 20, 17, 17, 20, 27, 16, 16, 21, 23, 16, 16, 22, 23,
+    15, 16, 19, 19, 16, 16, 19, 19, 16, 17, 18, 20, 17, 17, 20, 20, 16, 16, 19, 19, 16, 16, 19, 28, 16, 16, 18, 20, 17, 19, 20, 27,
+    16, 17, 18, 20, 16, 16, 18, 20, 16, 16, 17, 23, 16, 16, 19, 22, 17, 17, 20, 20, 17, 19, 20, 27, 16, 16, 19, 22, 16, 16, 20, 23,
+    14, 8, 13, 6, 12, 7, 7, 7, 14, 6, 11, 6, 15, 7, 11, 7, 12, 8, 11, 5, 11, 7, 8, 8, 14, 3, 13, 18, 14, 20, 20, 26,
+    14, 10, 13, 9, 13, 6, 11, 5, 14, 10, 11, 9, 13, 20, 11, 26, 13, 6, 11, 6, 14, 16, 25, 28, 15, 17, 17, 29, 20, 20, 25, 28,
+    15, 10, 14, 12, 15, 10, 13, 12, 15, 12, 13, 18, 15, 23, 20, 27, 14, 7, 14, 16, 13, 7, 11, 30, 14, 17, 17, 18, 20, 23, 20, 29,
+    15, 12, 15, 10, 15, 27, 12, 29, 15, 17, 12, 18, 14, 23, 20, 27, 15, 27, 25, 28, 13, 29, 25, 30, 14, 17, 17, 29, 20, 23, 20, 31,
+    15, 10, 14, 10, 15, 7, 13, 10, 14, 10, 13, 19, 15, 18, 19, 21, 14, 7, 14, 16, 14, 16, 16, 16, 14, 16, 16, 19, 18, 21, 19, 21,
+    14, 10, 14, 16, 15, 16, 12, 16, 14, 16, 17, 18, 16, 19, 18, 18, 15, 16, 19, 19, 16, 16, 19, 19, 16, 17, 18, 20, 17, 17, 20, 20,
+    15, 12, 15, 16, 15, 16, 13, 16, 15, 17, 16, 19, 19, 22, 19, 22, 14, 16, 16, 16, 13, 28, 16, 28, 17, 17, 17, 18, 19, 22, 19, 22,
+    15, 16, 16, 16, 14, 17, 16, 16, 17, 17, 17, 18, 19, 21, 18, 21, 18, 18, 19, 21, 18, 20, 19, 27, 17, 17, 18, 20, 19, 21, 20, 24,
+    11, 8, 10, 6, 12, 9, 7, 6, 11, 6, 7, 6, 11, 7, 7, 27, 10, 8, 8, 5, 11, 8, 8, 31, 13, 18, 17, 31, 20, 26, 25, 30,
+    13, 9, 12, 5, 11, 6, 6, 28, 12, 6, 10, 5, 20, 26, 25, 27, 11, 5, 6, 28, 25, 28, 25, 31, 17, 17, 25, 28, 20, 26, 25, 30,
+    13, 10, 13, 18, 13, 10, 25, 28, 13, 18, 17, 20, 20, 27, 20, 27, 11, 7, 17, 31, 7, 30, 25, 31, 17, 18, 17, 20, 20, 29, 20, 30,
+    15, 10, 17, 17, 25, 28, 25, 28, 17, 17, 17, 18, 20, 27, 20, 27, 12, 29, 25, 28, 25, 30, 25, 31, 17, 17, 17, 29, 20, 29, 25, 30,
+    15, 7, 13, 10, 13, 7, 7, 28, 14, 17, 11, 19, 18, 20, 19, 27, 14, 16, 16, 16, 13, 28, 16, 31, 17, 17, 16, 19, 18, 20, 19, 29,
+    15, 16, 12, 16, 16, 16, 16, 16, 16, 16, 17, 18, 18, 18, 18, 18, 16, 16, 19, 19, 16, 16, 19, 28, 16, 16, 18, 20, 17, 19, 20, 27,
+    14, 16, 16, 16, 13, 28, 16, 28, 17, 17, 17, 18, 19, 22, 19, 22, 14, 16, 16, 16, 11, 30, 16, 31, 17, 17, 17, 19, 19, 22, 19, 29,
+    16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 18, 19, 21, 19, 21, 18, 18, 19, 21, 18, 26, 19, 29, 17, 17, 18, 20, 19, 21, 20, 25,
+    13, 8, 12, 6, 10, 7, 7, 6, 13, 6, 11, 20, 7, 7, 20, 25, 10, 8, 11, 19, 8, 18, 18, 19, 17, 18, 18, 20, 17, 24, 20, 25,
+    13, 10, 13, 19, 11, 18, 19, 19, 13, 18, 19, 21, 11, 18, 21, 21, 11, 18, 19, 21, 17, 18, 19, 21, 17, 18, 19, 22, 17, 18, 21, 22,
+    14, 9, 15, 19, 14, 17, 18, 18, 15, 17, 18, 20, 14, 20, 24, 25, 13, 17, 18, 19, 17, 17, 18, 18, 17, 17, 18, 20, 20, 20, 24, 25,
+    15, 17, 19, 19, 17, 17, 19, 19, 17, 17, 19, 21, 17, 20, 21, 25, 17, 17, 20, 21, 17, 17, 19, 27, 17, 17, 19, 22, 17, 20, 21, 26,
+    14, 10, 13, 19, 14, 17, 11, 19, 14, 17, 17, 20, 17, 18, 18, 20, 14, 16, 16, 19, 17, 17, 16, 19, 17, 17, 17, 20, 17, 18, 18, 25,
+    14, 16, 17, 18, 16, 16, 17, 18, 16, 16, 17, 20, 16, 16, 18, 21, 16, 17, 18, 20, 16, 16, 18, 20, 16, 16, 17, 23, 16, 16, 19, 22,
+    15, 16, 16, 16, 14, 17, 16, 16, 17, 17, 17, 18, 19, 21, 18, 21, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 18, 19, 21, 19, 21,
+    16, 16, 17, 17, 16, 16, 17, 17, 16, 16, 17, 18, 16, 19, 19, 19, 16, 16, 18, 18, 16, 18, 18, 18, 16, 16, 18, 21, 16, 19, 19, 21,
+    10, 8, 10, 21, 10, 20, 21, 27, 11, 20, 18, 25, 20, 25, 24, 24, 9, 21, 19, 26, 20, 27, 21, 29, 18, 20, 19, 25, 20, 25, 24, 25,
+    13, 19, 19, 19, 19, 21, 19, 27, 18, 18, 19, 21, 20, 25, 21, 25, 19, 19, 19, 27, 19, 21, 19, 29, 18, 18, 19, 22, 20, 25, 21, 26,
+    13, 21, 19, 21, 20, 26, 21, 27, 18, 20, 18, 25, 24, 25, 24, 24, 18, 21, 19, 26, 20, 26, 21, 29, 18, 20, 18, 25, 24, 25, 24, 24,
+    19, 19, 19, 19, 20, 21, 19, 27, 18, 18, 19, 21, 20, 25, 24, 25, 19, 19, 19, 27, 19, 27, 19, 29, 18, 18, 19, 22, 20, 25, 21, 29,
+    15, 18, 19, 21, 18, 20, 19, 27, 17, 18, 18, 20, 17, 25, 20, 24, 18, 21, 19, 21, 18, 20, 19, 29, 17, 18, 18, 25, 17, 25, 20, 24,
+    16, 19, 18, 18, 18, 18, 18, 18, 16, 16, 18, 21, 16, 16, 20, 20, 17, 17, 20, 20, 17, 19, 20, 27, 16, 16, 19, 22, 16, 16, 20, 23,
+    18, 18, 19, 21, 18, 20, 19, 27, 17, 17, 18, 20, 19, 21, 20, 24, 18, 18, 19, 21, 18, 26, 19, 29, 17, 17, 18, 20, 19, 21, 20, 25,
+    16, 16, 18, 18, 16, 18, 18, 18, 16, 16, 18, 21, 16, 19, 19, 21, 16, 17, 20, 20, 16, 16, 20, 27, 16, 16, 18, 23, 16, 19, 19, 22,
+    13, 7, 7, 7, 10, 6, 8, 5, 14, 6, 11, 5, 15, 5, 6, 5, 11, 7, 7, 7, 10, 6, 8, 8, 13, 6, 12, 5, 11, 5, 6, 5,
+    11, 7, 7, 7, 9, 8, 8, 5, 13, 6, 11, 5, 11, 5, 6, 5, 11, 7, 7, 7, 9, 8, 8, 26, 13, 6, 12, 26, 11, 5, 6, 28,
+    13, 8, 10, 9, 10, 7, 8, 8, 14, 9, 12, 5, 13, 9, 11, 5, 10, 8, 9, 9, 10, 8, 8, 8, 11, 9, 10, 5, 12, 9, 6, 31,
+    10, 8, 10, 9, 9, 8, 8, 8, 13, 9, 12, 5, 11, 5, 11, 29, 9, 8, 9, 9, 9, 8, 23, 29, 11, 23, 10, 27, 11, 23, 23, 31,
+    14, 8, 13, 6, 12, 8, 11, 5, 14, 10, 13, 9, 13, 6, 11, 6, 11, 8, 10, 6, 10, 8, 8, 5, 13, 9, 12, 5, 11, 5, 6, 28,
+    13, 8, 12, 6, 10, 8, 11, 19, 13, 10, 13, 19, 11, 18, 19, 21, 10, 8, 10, 21, 9, 21, 19, 26, 13, 19, 19, 19, 19, 19, 19, 27,
+    15, 8, 12, 9, 12, 9, 11, 5, 14, 10, 12, 6, 13, 20, 20, 26, 9, 8, 9, 9, 10, 8, 8, 28, 11, 9, 10, 5, 11, 26, 25, 27,
+    12, 8, 12, 9, 10, 8, 18, 18, 13, 18, 18, 18, 11, 18, 20, 25, 9, 22, 19, 22, 21, 22, 21, 22, 19, 21, 19, 21, 21, 21, 21, 25,
+    11, 7, 7, 7, 10, 6, 8, 8, 13, 6, 12, 5, 11, 5, 6, 5, 12, 7, 7, 7, 7, 6, 8, 31, 6, 6, 6, 5, 11, 28, 25, 31,
+    7, 7, 7, 7, 8, 5, 8, 3, 10, 6, 10, 5, 5, 3, 20, 30, 7, 7, 7, 7, 8, 26, 25, 30, 6, 26, 6, 27, 20, 29, 25, 30,
+    12, 6, 6, 5, 7, 6, 8, 8, 15, 5, 6, 3, 13, 10, 18, 31, 10, 9, 5, 5, 7, 6, 8, 31, 5, 28, 5, 28, 26, 30, 26, 31,
+    10, 9, 11, 5, 8, 8, 20, 20, 6, 20, 20, 20, 18, 20, 20, 30, 9, 9, 20, 27, 23, 29, 23, 30, 20, 27, 25, 27, 23, 29, 23, 30,
+    12, 7, 7, 7, 11, 7, 8, 8, 13, 6, 11, 5, 14, 16, 25, 28, 12, 9, 7, 6, 11, 8, 8, 31, 11, 6, 6, 28, 25, 28, 25, 31,
+    10, 7, 7, 6, 8, 18, 18, 19, 11, 18, 19, 19, 17, 18, 19, 21, 10, 20, 21, 27, 20, 27, 21, 29, 19, 21, 19, 27, 19, 21, 19, 29,
+    12, 9, 11, 5, 11, 7, 8, 31, 15, 17, 17, 17, 20, 20, 20, 26, 10, 8, 8, 28, 11, 30, 26, 31, 17, 29, 25, 28, 25, 28, 25, 30,
+    10, 8, 18, 18, 17, 18, 18, 18, 17, 18, 18, 18, 17, 18, 20, 25, 21, 22, 21, 22, 22, 22, 22, 29, 19, 22, 19, 22, 21, 22, 21, 26,
+    11, 7, 7, 7, 9, 8, 8, 5, 13, 6, 11, 5, 11, 5, 6, 5, 7, 7, 7, 7, 8, 5, 8, 3, 10, 6, 10, 5, 5, 3, 20, 30,
+    7, 7, 7, 7, 17, 24, 20, 24, 11, 6, 11, 20, 17, 20, 20, 23, 7, 7, 7, 7, 20, 24, 24, 25, 10, 6, 24, 25, 20, 24, 24, 26,
+    13, 6, 10, 6, 11, 5, 5, 3, 15, 6, 12, 5, 15, 17, 18, 29, 11, 5, 10, 5, 6, 5, 20, 30, 12, 5, 12, 3, 18, 29, 20, 31,
+    11, 6, 10, 6, 17, 20, 20, 24, 12, 18, 20, 20, 17, 18, 20, 23, 11, 20, 24, 25, 20, 23, 24, 26, 20, 20, 24, 25, 20, 23, 24, 28,
+    14, 6, 11, 6, 14, 3, 13, 18, 14, 10, 11, 9, 15, 17, 17, 29, 11, 6, 7, 6, 13, 18, 17, 31, 12, 6, 10, 5, 17, 17, 25, 28,
+    13, 6, 11, 20, 17, 18, 18, 20, 13, 18, 19, 21, 17, 18, 19, 22, 11, 20, 18, 25, 18, 20, 19, 25, 18, 18, 19, 21, 18, 18, 19, 22,
+    14, 10, 12, 6, 15, 17, 17, 17, 15, 12, 12, 9, 20, 20, 20, 26, 11, 9, 10, 5, 17, 29, 25, 28, 12, 9, 12, 3, 20, 26, 25, 27,
+    13, 18, 18, 18, 17, 18, 18, 18, 17, 18, 19, 19, 17, 18, 19, 21, 19, 21, 19, 21, 19, 22, 19, 22, 19, 19, 19, 19, 19, 21, 19, 25,
+    11, 7, 7, 7, 9, 8, 8, 26, 13, 6, 12, 26, 11, 5, 6, 28, 7, 7, 7, 7, 8, 26, 25, 30, 6, 26, 6, 27, 20, 29, 25, 30,
+    7, 7, 7, 7, 20, 24, 24, 25, 10, 6, 24, 25, 20, 24, 24, 26, 7, 7, 7, 24, 24, 25, 24, 24, 24, 25, 24, 24, 24, 25, 24, 30,
+    13, 6, 6, 26, 11, 5, 20, 29, 15, 20, 25, 26, 20, 27, 25, 28, 12, 26, 6, 27, 6, 28, 25, 30, 25, 26, 25, 27, 25, 28, 25, 30,
+    10, 6, 24, 25, 20, 24, 24, 25, 20, 24, 24, 25, 20, 24, 24, 26, 24, 25, 24, 24, 24, 26, 24, 30, 24, 25, 24, 24, 24, 26, 24, 31,
+    15, 7, 11, 7, 14, 20, 20, 26, 13, 20, 11, 26, 20, 20, 25, 28, 11, 7, 7, 27, 20, 26, 25, 30, 20, 26, 25, 27, 20, 26, 25, 30,
+    7, 7, 20, 25, 17, 24, 20, 25, 11, 18, 21, 21, 17, 18, 21, 22, 20, 25, 24, 24, 20, 25, 24, 25, 20, 25, 21, 25, 20, 25, 21, 26,
+    13, 20, 20, 26, 20, 20, 20, 26, 20, 20, 20, 26, 20, 20, 20, 30, 11, 26, 25, 27, 25, 28, 25, 30, 20, 26, 25, 27, 20, 30, 25, 30,
+    11, 18, 20, 25, 17, 18, 20, 25, 17, 18, 19, 21, 17, 18, 19, 22, 21, 21, 21, 25, 21, 22, 21, 26, 19, 21, 19, 25, 19, 22, 19, 28,
+    13, 8, 10, 9, 10, 7, 8, 8, 14, 9, 12, 5, 13, 9, 11, 5, 12, 6, 6, 5, 7, 6, 8, 8, 15, 5, 6, 3, 13, 10, 18, 31,
+    13, 6, 10, 6, 11, 5, 5, 3, 15, 6, 12, 5, 15, 17, 18, 29, 13, 6, 6, 26, 11, 5, 20, 29, 15, 20, 25, 26, 20, 27, 25, 28,
+    13, 6, 6, 3, 7, 7, 3, 30, 15, 10, 15, 17, 14, 23, 23, 29, 11, 6, 5, 3, 7, 7, 3, 30, 12, 10, 21, 29, 13, 29, 23, 30,
+    13, 9, 6, 20, 11, 5, 18, 20, 15, 17, 18, 18, 12, 23, 18, 29, 11, 23, 20, 27, 11, 23, 23, 29, 20, 23, 20, 27, 23, 29, 23, 31,
+    15, 10, 14, 12, 14, 7, 14, 16, 15, 12, 15, 10, 15, 27, 25, 28, 13, 10, 13, 18, 11, 7, 17, 31, 15, 10, 17, 17, 12, 29, 25, 28,
+    14, 9, 15, 19, 13, 17, 18, 19, 15, 17, 19, 19, 17, 17, 20, 21, 13, 21, 19, 21, 18, 21, 19, 26, 19, 19, 19, 19, 19, 19, 19, 27,
+    14, 10, 15, 16, 13, 7, 16, 29, 15, 17, 17, 17, 14, 23, 20, 27, 11, 10, 16, 27, 11, 29, 25, 28, 12, 18, 17, 18, 20, 27, 20, 27,
+    14, 17, 18, 18, 13, 17, 18, 18, 17, 17, 18, 18, 17, 20, 20, 25, 19, 22, 19, 22, 21, 22, 21, 27, 19, 21, 19, 21, 21, 25, 24, 25,
+    10, 8, 9, 9, 10, 8, 8, 8, 11, 9, 10, 5, 12, 9, 6, 31, 10, 9, 5, 5, 7, 6, 8, 31, 5, 28, 5, 28, 26, 30, 26, 31,
+    11, 5, 10, 5, 6, 5, 20, 30, 12, 5, 12, 3, 18, 29, 20, 31, 12, 26, 6, 27, 6, 28, 25, 30, 25, 26, 25, 27, 25, 28, 25, 30,
+    11, 6, 5, 3, 7, 7, 3, 30, 12, 10, 21, 29, 13, 29, 23, 30, 6, 6, 3, 28, 7, 31, 28, 31, 25, 29, 25, 28, 23, 31, 23, 31,
+    12, 5, 20, 20, 11, 29, 20, 30, 18, 18, 20, 20, 18, 29, 20, 30, 10, 27, 25, 27, 23, 31, 23, 30, 20, 27, 25, 27, 23, 31, 23, 31,
+    15, 10, 13, 12, 13, 7, 11, 30, 15, 27, 12, 29, 13, 29, 25, 30, 13, 10, 25, 28, 7, 30, 25, 31, 25, 28, 25, 28, 25, 30, 25, 31,
+    14, 17, 18, 18, 17, 17, 18, 18, 17, 17, 19, 19, 17, 17, 19, 27, 20, 26, 21, 27, 20, 26, 21, 29, 20, 21, 19, 27, 19, 27, 19, 29,
+    13, 7, 16, 29, 7, 29, 16, 30, 14, 17, 17, 17, 20, 23, 20, 29, 11, 29, 25, 28, 7, 31, 26, 31, 17, 29, 17, 29, 20, 31, 25, 30,
+    13, 17, 18, 18, 17, 17, 18, 18, 17, 17, 18, 18, 17, 20, 20, 25, 21, 22, 21, 27, 22, 22, 22, 29, 19, 22, 19, 22, 21, 26, 21, 29,
+    10, 8, 10, 9, 9, 8, 8, 8, 13, 9, 12, 5, 11, 5, 11, 29, 10, 9, 11, 5, 8, 8, 20, 20, 6, 20, 20, 20, 18, 20, 20, 30,
+    11, 6, 10, 6, 17, 20, 20, 24, 12, 18, 20, 20, 17, 18, 20, 23, 10, 6, 24, 25, 20, 24, 24, 25, 20, 24, 24, 25, 20, 24, 24, 26,
+    13, 9, 6, 20, 11, 5, 18, 20, 15, 17, 18, 18, 12, 23, 18, 29, 12, 5, 20, 20, 11, 29, 20, 30, 18, 18, 20, 20, 18, 29, 20, 30,
+    12, 18, 20, 24, 17, 18, 20, 24, 17, 17, 20, 20, 17, 17, 20, 23, 20, 20, 24, 25, 20, 23, 24, 26, 20, 20, 24, 25, 20, 23, 24, 28,
+    15, 12, 13, 18, 14, 17, 17, 18, 15, 17, 12, 18, 14, 17, 17, 29, 13, 18, 17, 20, 17, 18, 17, 20, 17, 17, 17, 18, 17, 17, 17, 29,
+    15, 17, 18, 20, 17, 17, 18, 20, 17, 17, 19, 21, 17, 17, 19, 22, 18, 20, 18, 25, 18, 20, 18, 25, 18, 18, 19, 21, 18, 18, 19, 22,
+    15, 17, 17, 17, 14, 17, 17, 17, 15, 17, 17, 17, 20, 23, 20, 27, 12, 18, 17, 18, 17, 29, 17, 29, 17, 17, 17, 17, 20, 27, 20, 27,
+    17, 17, 18, 18, 17, 17, 18, 18, 17, 17, 19, 19, 17, 17, 19, 21, 19, 21, 19, 21, 19, 22, 19, 22, 19, 19, 19, 19, 19, 21, 19, 25,
+    9, 8, 9, 9, 9, 8, 23, 29, 11, 23, 10, 27, 11, 23, 23, 31, 9, 9, 20, 27, 23, 29, 23, 30, 20, 27, 25, 27, 23, 29, 23, 30,
+    11, 20, 24, 25, 20, 23, 24, 26, 20, 20, 24, 25, 20, 23, 24, 28, 24, 25, 24, 24, 24, 26, 24, 30, 24, 25, 24, 24, 24, 26, 24, 31,
+    11, 23, 20, 27, 11, 23, 23, 29, 20, 23, 20, 27, 23, 29, 23, 31, 10, 27, 25, 27, 23, 31, 23, 30, 20, 27, 25, 27, 23, 31, 23, 31,
+    20, 20, 24, 25, 20, 23, 24, 26, 20, 20, 24, 25, 20, 23, 24, 28, 24, 25, 24, 24, 24, 28, 24, 31, 24, 25, 24, 24, 24, 28, 24, 31,
+    15, 23, 20, 27, 20, 23, 20, 29, 14, 23, 20, 27, 20, 23, 20, 31, 20, 27, 20, 27, 20, 29, 20, 30, 20, 27, 20, 27, 20, 29, 25, 30,
+    14, 20, 24, 25, 20, 20, 24, 25, 17, 20, 21, 25, 17, 20, 21, 26, 24, 25, 24, 24, 24, 25, 24, 24, 20, 25, 24, 25, 20, 25, 21, 29,
+    14, 23, 20, 27, 20, 23, 20, 29, 20, 23, 20, 27, 20, 29, 20, 31, 20, 27, 20, 27, 20, 31, 25, 30, 20, 27, 20, 27, 20, 31, 20, 31,
+    17, 20, 20, 25, 17, 20, 20, 25, 17, 17, 19, 21, 17, 17, 19, 22, 21, 25, 24, 25, 21, 26, 21, 29, 19, 21, 19, 25, 19, 22, 19, 28,
+    14, 8, 13, 6, 12, 8, 11, 5, 14, 10, 13, 9, 13, 6, 11, 6, 12, 7, 7, 7, 11, 7, 8, 8, 13, 6, 11, 5, 14, 16, 25, 28,
+    14, 6, 11, 6, 14, 3, 13, 18, 14, 10, 11, 9, 15, 17, 17, 29, 15, 7, 11, 7, 14, 20, 20, 26, 13, 20, 11, 26, 20, 20, 25, 28,
+    15, 10, 14, 12, 14, 7, 14, 16, 15, 12, 15, 10, 15, 27, 25, 28, 15, 10, 13, 12, 13, 7, 11, 30, 15, 27, 12, 29, 13, 29, 25, 30,
+    15, 12, 13, 18, 14, 17, 17, 18, 15, 17, 12, 18, 14, 17, 17, 29, 15, 23, 20, 27, 20, 23, 20, 29, 14, 23, 20, 27, 20, 23, 20, 31,
+    15, 10, 14, 10, 14, 7, 14, 16, 14, 10, 14, 16, 15, 16, 19, 19, 15, 7, 13, 10, 14, 16, 16, 16, 15, 16, 12, 16, 16, 16, 19, 19,
+    14, 10, 13, 19, 14, 16, 16, 19, 14, 16, 17, 18, 16, 17, 18, 20, 15, 18, 19, 21, 18, 21, 19, 21, 16, 19, 18, 18, 17, 17, 20, 20,
+    15, 12, 15, 16, 14, 16, 16, 16, 15, 16, 16, 16, 18, 18, 19, 21, 15, 16, 13, 16, 13, 28, 16, 28, 14, 17, 16, 16, 18, 20, 19, 27,
+    15, 17, 16, 19, 17, 17, 17, 18, 17, 17, 17, 18, 17, 17, 18, 20, 19, 22, 19, 22, 19, 22, 19, 22, 19, 21, 18, 21, 19, 21, 20, 24,
+    11, 8, 10, 6, 10, 8, 8, 5, 13, 9, 12, 5, 11, 5, 6, 28, 12, 9, 7, 6, 11, 8, 8, 31, 11, 6, 6, 28, 25, 28, 25, 31,
+    11, 6, 7, 6, 13, 18, 17, 31, 12, 6, 10, 5, 17, 17, 25, 28, 11, 7, 7, 27, 20, 26, 25, 30, 20, 26, 25, 27, 20, 26, 25, 30,
+    13, 10, 13, 18, 11, 7, 17, 31, 15, 10, 17, 17, 12, 29, 25, 28, 13, 10, 25, 28, 7, 30, 25, 31, 25, 28, 25, 28, 25, 30, 25, 31,
+    13, 18, 17, 20, 17, 18, 17, 20, 17, 17, 17, 18, 17, 17, 17, 29, 20, 27, 20, 27, 20, 29, 20, 30, 20, 27, 20, 27, 20, 29, 25, 30,
+    15, 7, 13, 10, 14, 16, 16, 16, 15, 16, 12, 16, 16, 16, 19, 19, 13, 7, 7, 28, 13, 28, 16, 31, 16, 16, 16, 16, 16, 16, 19, 28,
+    14, 17, 11, 19, 17, 17, 16, 19, 16, 16, 17, 18, 16, 16, 18, 20, 18, 20, 19, 27, 18, 20, 19, 29, 18, 18, 18, 18, 17, 19, 20, 27,
+    14, 16, 16, 16, 14, 16, 16, 16, 16, 16, 16, 16, 18, 18, 19, 21, 13, 28, 16, 28, 11, 30, 16, 31, 16, 16, 16, 16, 18, 26, 19, 29,
+    17, 17, 17, 18, 17, 17, 17, 19, 17, 17, 17, 18, 17, 17, 18, 20, 19, 22, 19, 22, 19, 22, 19, 29, 19, 21, 19, 21, 19, 21, 20, 25,
+    13, 8, 12, 6, 10, 8, 11, 19, 13, 10, 13, 19, 11, 18, 19, 21, 10, 7, 7, 6, 8, 18, 18, 19, 11, 18, 19, 19, 17, 18, 19, 21,
+    13, 6, 11, 20, 17, 18, 18, 20, 13, 18, 19, 21, 17, 18, 19, 22, 7, 7, 20, 25, 17, 24, 20, 25, 11, 18, 21, 21, 17, 18, 21, 22,
+    14, 9, 15, 19, 13, 17, 18, 19, 15, 17, 19, 19, 17, 17, 20, 21, 14, 17, 18, 18, 17, 17, 18, 18, 17, 17, 19, 19, 17, 17, 19, 27,
+    15, 17, 18, 20, 17, 17, 18, 20, 17, 17, 19, 21, 17, 17, 19, 22, 14, 20, 24, 25, 20, 20, 24, 25, 17, 20, 21, 25, 17, 20, 21, 26,
+    14, 10, 13, 19, 14, 16, 16, 19, 14, 16, 17, 18, 16, 17, 18, 20, 14, 17, 11, 19, 17, 17, 16, 19, 16, 16, 17, 18, 16, 16, 18, 20,
+    14, 17, 17, 20, 17, 17, 17, 20, 16, 16, 17, 20, 16, 16, 17, 23, 17, 18, 18, 20, 17, 18, 18, 25, 16, 16, 18, 21, 16, 16, 19, 22,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 16, 16, 18, 18, 14, 17, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 16, 18, 18, 18,
+    17, 17, 17, 18, 17, 17, 17, 18, 16, 16, 17, 18, 16, 16, 18, 21, 19, 21, 18, 21, 19, 21, 19, 21, 16, 19, 19, 19, 16, 19, 19, 21,
+    10, 8, 10, 21, 9, 21, 19, 26, 13, 19, 19, 19, 19, 19, 19, 27, 10, 20, 21, 27, 20, 27, 21, 29, 19, 21, 19, 27, 19, 21, 19, 29,
+    11, 20, 18, 25, 18, 20, 19, 25, 18, 18, 19, 21, 18, 18, 19, 22, 20, 25, 24, 24, 20, 25, 24, 25, 20, 25, 21, 25, 20, 25, 21, 26,
+    13, 21, 19, 21, 18, 21, 19, 26, 19, 19, 19, 19, 19, 19, 19, 27, 20, 26, 21, 27, 20, 26, 21, 29, 20, 21, 19, 27, 19, 27, 19, 29,
+    18, 20, 18, 25, 18, 20, 18, 25, 18, 18, 19, 21, 18, 18, 19, 22, 24, 25, 24, 24, 24, 25, 24, 24, 20, 25, 24, 25, 20, 25, 21, 29,
+    15, 18, 19, 21, 18, 21, 19, 21, 16, 19, 18, 18, 17, 17, 20, 20, 18, 20, 19, 27, 18, 20, 19, 29, 18, 18, 18, 18, 17, 19, 20, 27,
+    17, 18, 18, 20, 17, 18, 18, 25, 16, 16, 18, 21, 16, 16, 19, 22, 17, 25, 20, 24, 17, 25, 20, 24, 16, 16, 20, 20, 16, 16, 20, 23,
+    18, 18, 19, 21, 18, 18, 19, 21, 16, 16, 18, 18, 16, 17, 20, 20, 18, 20, 19, 27, 18, 26, 19, 29, 16, 18, 18, 18, 16, 16, 20, 27,
+    17, 17, 18, 20, 17, 17, 18, 20, 16, 16, 18, 21, 16, 16, 18, 23, 19, 21, 20, 24, 19, 21, 20, 25, 16, 19, 19, 21, 16, 19, 19, 22,
+    15, 8, 12, 9, 12, 9, 11, 5, 14, 10, 12, 6, 13, 20, 20, 26, 12, 9, 11, 5, 11, 7, 8, 31, 15, 17, 17, 17, 20, 20, 20, 26,
+    14, 10, 12, 6, 15, 17, 17, 17, 15, 12, 12, 9, 20, 20, 20, 26, 13, 20, 20, 26, 20, 20, 20, 26, 20, 20, 20, 26, 20, 20, 20, 30,
+    14, 10, 15, 16, 13, 7, 16, 29, 15, 17, 17, 17, 14, 23, 20, 27, 13, 7, 16, 29, 7, 29, 16, 30, 14, 17, 17, 17, 20, 23, 20, 29,
+    15, 17, 17, 17, 14, 17, 17, 17, 15, 17, 17, 17, 20, 23, 20, 27, 14, 23, 20, 27, 20, 23, 20, 29, 20, 23, 20, 27, 20, 29, 20, 31,
+    15, 12, 15, 16, 14, 16, 16, 16, 15, 16, 16, 16, 18, 18, 19, 21, 14, 16, 16, 16, 14, 16, 16, 16, 16, 16, 16, 16, 18, 18, 19, 21,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 16, 16, 18, 18, 18, 18, 19, 21, 18, 18, 19, 21, 16, 16, 18, 18, 16, 17, 20, 20,
+    15, 16, 16, 16, 14, 27, 16, 16, 15, 17, 16, 16, 19, 22, 19, 22, 14, 27, 16, 16, 13, 29, 16, 28, 17, 17, 16, 17, 19, 22, 19, 22,
+    15, 17, 16, 16, 17, 17, 16, 17, 17, 17, 17, 17, 19, 21, 18, 21, 19, 22, 19, 22, 19, 22, 19, 22, 19, 21, 18, 21, 19, 25, 20, 24,
+    9, 8, 9, 9, 10, 8, 8, 28, 11, 9, 10, 5, 11, 26, 25, 27, 10, 8, 8, 28, 11, 30, 26, 31, 17, 29, 25, 28, 25, 28, 25, 30,
+    11, 9, 10, 5, 17, 29, 25, 28, 12, 9, 12, 3, 20, 26, 25, 27, 11, 26, 25, 27, 25, 28, 25, 30, 20, 26, 25, 27, 20, 30, 25, 30,
+    11, 10, 16, 27, 11, 29, 25, 28, 12, 18, 17, 18, 20, 27, 20, 27, 11, 29, 25, 28, 7, 31, 26, 31, 17, 29, 17, 29, 20, 31, 25, 30,
+    12, 18, 17, 18, 17, 29, 17, 29, 17, 17, 17, 17, 20, 27, 20, 27, 20, 27, 20, 27, 20, 31, 25, 30, 20, 27, 20, 27, 20, 31, 20, 31,
+    15, 16, 13, 16, 13, 28, 16, 28, 14, 17, 16, 16, 18, 20, 19, 27, 13, 28, 16, 28, 11, 30, 16, 31, 16, 16, 16, 16, 18, 26, 19, 29,
+    14, 17, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 16, 18, 18, 18, 18, 20, 19, 27, 18, 26, 19, 29, 16, 18, 18, 18, 16, 16, 20, 27,
+    14, 27, 16, 16, 13, 29, 16, 28, 17, 17, 16, 17, 19, 22, 19, 22, 13, 29, 16, 28, 7, 31, 16, 31, 17, 17, 16, 16, 19, 22, 19, 29,
+    17, 17, 16, 17, 17, 17, 16, 16, 17, 17, 17, 17, 19, 21, 18, 21, 19, 22, 19, 22, 19, 22, 19, 29, 19, 21, 18, 21, 19, 25, 20, 24,
+    12, 8, 12, 9, 10, 8, 18, 18, 13, 18, 18, 18, 11, 18, 20, 25, 10, 8, 18, 18, 17, 18, 18, 18, 17, 18, 18, 18, 17, 18, 20, 25,
+    13, 18, 18, 18, 17, 18, 18, 18, 17, 18, 19, 19, 17, 18, 19, 21, 11, 18, 20, 25, 17, 18, 20, 25, 17, 18, 19, 21, 17, 18, 19, 22,
+    14, 17, 18, 18, 13, 17, 18, 18, 17, 17, 18, 18, 17, 20, 20, 25, 13, 17, 18, 18, 17, 17, 18, 18, 17, 17, 18, 18, 17, 20, 20, 25,
+    17, 17, 18, 18, 17, 17, 18, 18, 17, 17, 19, 19, 17, 17, 19, 21, 17, 20, 20, 25, 17, 20, 20, 25, 17, 17, 19, 21, 17, 17, 19, 22,
+    15, 17, 16, 19, 17, 17, 17, 18, 17, 17, 17, 18, 17, 17, 18, 20, 17, 17, 17, 18, 17, 17, 17, 19, 17, 17, 17, 18, 17, 17, 18, 20,
+    17, 17, 17, 18, 17, 17, 17, 18, 16, 16, 17, 18, 16, 16, 18, 21, 17, 17, 18, 20, 17, 17, 18, 20, 16, 16, 18, 21, 16, 16, 18, 23,
+    15, 17, 16, 16, 17, 17, 16, 17, 17, 17, 17, 17, 19, 21, 18, 21, 17, 17, 16, 17, 17, 17, 16, 16, 17, 17, 17, 17, 19, 21, 18, 21,
+    17, 17, 17, 17, 17, 17, 17, 17, 16, 16, 17, 17, 16, 16, 19, 19, 19, 21, 18, 21, 19, 21, 18, 21, 16, 16, 19, 19, 16, 16, 20, 21,
+    9, 22, 19, 22, 21, 22, 21, 22, 19, 21, 19, 21, 21, 21, 21, 25, 21, 22, 21, 22, 22, 22, 22, 29, 19, 22, 19, 22, 21, 22, 21, 26,
+    19, 21, 19, 21, 19, 22, 19, 22, 19, 19, 19, 19, 19, 21, 19, 25, 21, 21, 21, 25, 21, 22, 21, 26, 19, 21, 19, 25, 19, 22, 19, 28,
+    19, 22, 19, 22, 21, 22, 21, 27, 19, 21, 19, 21, 21, 25, 24, 25, 21, 22, 21, 27, 22, 22, 22, 29, 19, 22, 19, 22, 21, 26, 21, 29,
+    19, 21, 19, 21, 19, 22, 19, 22, 19, 19, 19, 19, 19, 21, 19, 25, 21, 25, 24, 25, 21, 26, 21, 29, 19, 21, 19, 25, 19, 22, 19, 28,
+    19, 22, 19, 22, 19, 22, 19, 22, 19, 21, 18, 21, 19, 21, 20, 24, 19, 22, 19, 22, 19, 22, 19, 29, 19, 21, 19, 21, 19, 21, 20, 25,
+    19, 21, 18, 21, 19, 21, 19, 21, 16, 19, 19, 19, 16, 19, 19, 21, 19, 21, 20, 24, 19, 21, 20, 25, 16, 19, 19, 21, 16, 19, 19, 22,
+    19, 22, 19, 22, 19, 22, 19, 22, 19, 21, 18, 21, 19, 25, 20, 24, 19, 22, 19, 22, 19, 22, 19, 29, 19, 21, 18, 21, 19, 25, 20, 24,
+    19, 21, 18, 21, 19, 21, 18, 21, 16, 16, 19, 19, 16, 16, 20, 21, 19, 25, 20, 24, 19, 25, 20, 24, 16, 16, 20, 21, 16, 16, 19, 23,
+    14, 7, 15, 6, 11, 7, 12, 8, 15, 8, 12, 9, 10, 8, 12, 8, 11, 7, 12, 8, 12, 7, 7, 6, 12, 6, 7, 6, 10, 9, 7, 6,
+    15, 8, 12, 9, 12, 6, 7, 6, 14, 6, 15, 7, 11, 6, 11, 7, 10, 8, 12, 8, 10, 9, 7, 6, 11, 6, 11, 7, 6, 6, 7, 6,
+    13, 7, 10, 6, 11, 7, 10, 6, 13, 8, 10, 7, 10, 8, 10, 8, 11, 7, 10, 6, 12, 7, 7, 6, 12, 6, 7, 6, 10, 9, 7, 6,
+    13, 8, 10, 7, 12, 6, 7, 6, 13, 6, 7, 7, 11, 6, 7, 7, 10, 8, 10, 8, 10, 9, 7, 6, 11, 6, 7, 7, 6, 6, 7, 31,
+    15, 8, 15, 7, 12, 8, 12, 6, 14, 8, 12, 7, 11, 8, 12, 9, 12, 8, 12, 6, 12, 6, 7, 6, 13, 6, 7, 7, 10, 6, 7, 6,
+    14, 8, 12, 7, 13, 6, 7, 7, 14, 6, 15, 7, 11, 6, 11, 7, 11, 8, 12, 9, 10, 6, 7, 6, 11, 6, 11, 7, 7, 6, 7, 27,
+    12, 8, 10, 6, 12, 8, 10, 6, 13, 8, 10, 7, 10, 8, 10, 20, 12, 8, 10, 6, 12, 6, 7, 6, 12, 6, 7, 6, 10, 21, 21, 27,
+    13, 8, 10, 7, 12, 6, 7, 6, 13, 6, 7, 7, 11, 20, 20, 25, 10, 8, 10, 20, 10, 21, 21, 27, 11, 20, 20, 25, 18, 25, 24, 24,
+    11, 7, 12, 8, 12, 7, 7, 6, 12, 6, 7, 6, 10, 9, 7, 6, 12, 7, 7, 6, 7, 7, 8, 31, 11, 5, 8, 8, 5, 5, 8, 31,
+    12, 6, 7, 6, 11, 5, 8, 8, 15, 3, 13, 12, 5, 3, 11, 30, 10, 9, 7, 6, 5, 5, 8, 31, 5, 3, 11, 30, 3, 3, 3, 31,
+    7, 7, 8, 5, 7, 7, 8, 8, 10, 9, 8, 8, 9, 9, 8, 8, 7, 7, 8, 8, 7, 7, 8, 31, 6, 5, 8, 8, 5, 5, 8, 31,
+    10, 9, 8, 8, 6, 5, 8, 8, 6, 3, 3, 30, 5, 3, 3, 30, 9, 9, 8, 8, 5, 5, 8, 31, 5, 3, 3, 30, 3, 28, 28, 31,
+    15, 7, 14, 7, 12, 6, 11, 8, 12, 8, 11, 7, 10, 8, 11, 8, 12, 6, 11, 8, 7, 6, 8, 31, 11, 5, 8, 8, 8, 5, 8, 31,
+    12, 8, 11, 7, 11, 5, 8, 8, 14, 3, 14, 20, 13, 18, 20, 26, 10, 8, 11, 8, 8, 5, 8, 31, 13, 18, 20, 26, 17, 31, 25, 30,
+    10, 6, 8, 8, 10, 6, 8, 19, 10, 8, 8, 18, 9, 21, 20, 27, 10, 6, 8, 19, 7, 6, 19, 28, 11, 19, 18, 19, 19, 26, 21, 29,
+    10, 8, 8, 18, 11, 19, 18, 19, 17, 18, 17, 24, 18, 20, 20, 25, 9, 21, 20, 27, 19, 26, 21, 29, 18, 20, 20, 25, 19, 25, 24, 25,
+    15, 8, 12, 9, 12, 6, 7, 6, 14, 6, 15, 7, 11, 6, 11, 7, 12, 6, 7, 6, 11, 5, 8, 8, 15, 3, 13, 12, 5, 3, 11, 30,
+    14, 6, 15, 7, 15, 3, 13, 12, 15, 12, 15, 23, 13, 12, 13, 29, 11, 6, 11, 7, 5, 3, 11, 30, 13, 12, 13, 29, 11, 7, 23, 30,
+    14, 6, 15, 5, 13, 6, 11, 5, 14, 9, 13, 9, 11, 9, 12, 9, 13, 6, 11, 5, 6, 6, 11, 28, 15, 5, 13, 10, 5, 28, 26, 30,
+    14, 9, 13, 9, 15, 5, 13, 10, 15, 10, 14, 23, 12, 10, 13, 29, 11, 9, 12, 9, 5, 28, 26, 30, 12, 10, 13, 29, 25, 29, 23, 31,
+    15, 10, 15, 7, 14, 10, 13, 10, 15, 10, 15, 10, 13, 10, 13, 10, 14, 10, 13, 10, 14, 7, 11, 31, 14, 12, 13, 12, 13, 18, 25, 28,
+    15, 10, 15, 10, 14, 12, 13, 12, 15, 12, 15, 23, 13, 18, 20, 27, 13, 10, 13, 10, 13, 18, 25, 28, 13, 18, 20, 27, 17, 20, 20, 27,
+    14, 9, 14, 9, 14, 9, 12, 19, 14, 9, 14, 17, 13, 21, 20, 26, 14, 9, 12, 19, 19, 19, 19, 28, 15, 19, 18, 18, 19, 21, 21, 27,
+    14, 9, 14, 17, 15, 19, 18, 18, 15, 17, 14, 20, 18, 20, 24, 25, 13, 21, 20, 26, 19, 21, 21, 27, 18, 20, 24, 25, 18, 25, 24, 24,
+    10, 8, 12, 8, 10, 9, 7, 6, 11, 6, 11, 7, 6, 6, 7, 6, 10, 9, 7, 6, 5, 5, 8, 31, 5, 3, 11, 30, 3, 3, 3, 31,
+    11, 6, 11, 7, 5, 3, 11, 30, 13, 12, 13, 29, 11, 7, 23, 30, 6, 6, 7, 6, 3, 3, 3, 31, 11, 7, 23, 30, 16, 31, 23, 30,
+    11, 5, 6, 5, 12, 5, 6, 5, 12, 5, 11, 5, 10, 5, 6, 31, 12, 5, 6, 5, 6, 5, 25, 31, 6, 3, 18, 31, 5, 28, 26, 31,
+    12, 5, 11, 5, 6, 3, 18, 31, 15, 17, 23, 29, 21, 29, 23, 30, 10, 5, 6, 31, 5, 28, 26, 31, 21, 29, 23, 30, 25, 28, 23, 31,
+    15, 7, 13, 7, 13, 10, 7, 7, 14, 7, 13, 7, 11, 7, 7, 30, 13, 10, 7, 7, 11, 31, 16, 31, 14, 16, 11, 30, 17, 31, 25, 31,
+    14, 7, 13, 7, 14, 16, 11, 30, 14, 17, 20, 23, 17, 18, 20, 29, 11, 7, 7, 30, 17, 31, 25, 31, 17, 18, 20, 29, 17, 20, 20, 30,
+    14, 9, 11, 16, 12, 19, 19, 19, 13, 17, 17, 17, 18, 21, 20, 26, 12, 19, 19, 19, 19, 28, 19, 28, 18, 19, 18, 18, 19, 26, 21, 29,
+    13, 17, 17, 17, 18, 19, 18, 18, 17, 17, 20, 20, 18, 20, 24, 25, 18, 21, 20, 26, 19, 26, 21, 29, 18, 20, 24, 25, 18, 25, 24, 24,
+    13, 7, 10, 6, 11, 7, 10, 6, 13, 8, 10, 7, 10, 8, 10, 8, 7, 7, 8, 5, 7, 7, 8, 8, 10, 9, 8, 8, 9, 9, 8, 8,
+    14, 6, 15, 5, 13, 6, 11, 5, 14, 9, 13, 9, 11, 9, 12, 9, 11, 5, 6, 5, 12, 5, 6, 5, 12, 5, 11, 5, 10, 5, 6, 31,
+    11, 7, 9, 8, 11, 7, 9, 8, 10, 8, 9, 8, 9, 8, 9, 8, 7, 7, 8, 5, 7, 7, 8, 26, 10, 9, 8, 8, 9, 9, 23, 29,
+    13, 6, 11, 5, 13, 6, 11, 5, 13, 9, 11, 5, 11, 23, 11, 23, 11, 5, 6, 5, 12, 26, 6, 28, 12, 5, 11, 29, 10, 27, 23, 31,
+    14, 8, 12, 8, 11, 8, 10, 8, 15, 8, 12, 9, 9, 8, 10, 8, 13, 6, 11, 5, 10, 6, 8, 5, 12, 9, 11, 5, 9, 9, 8, 28,
+    14, 10, 13, 6, 13, 9, 11, 5, 14, 10, 13, 20, 11, 9, 11, 26, 13, 9, 11, 6, 12, 5, 6, 28, 12, 6, 20, 26, 10, 5, 25, 27,
+    13, 8, 10, 8, 10, 8, 9, 21, 12, 8, 10, 8, 9, 22, 21, 22, 12, 6, 11, 19, 10, 21, 19, 26, 12, 9, 18, 18, 19, 22, 21, 22,
+    13, 10, 11, 18, 13, 19, 19, 19, 13, 18, 11, 18, 19, 21, 21, 21, 13, 19, 19, 21, 19, 19, 19, 27, 18, 18, 20, 25, 19, 21, 21, 25,
+    11, 7, 10, 6, 12, 7, 7, 6, 12, 6, 7, 6, 10, 9, 7, 6, 7, 7, 8, 8, 7, 7, 8, 31, 6, 5, 8, 8, 5, 5, 8, 31,
+    13, 6, 11, 5, 6, 6, 11, 28, 15, 5, 13, 10, 5, 28, 26, 30, 12, 5, 6, 5, 6, 5, 25, 31, 6, 3, 18, 31, 5, 28, 26, 31,
+    7, 7, 8, 5, 7, 7, 8, 26, 10, 9, 8, 8, 9, 9, 23, 29, 7, 7, 8, 3, 7, 7, 25, 30, 11, 5, 20, 20, 20, 27, 23, 30,
+    10, 6, 5, 3, 6, 26, 20, 29, 6, 20, 18, 20, 20, 27, 23, 29, 10, 5, 20, 30, 6, 27, 25, 30, 20, 20, 20, 30, 25, 27, 23, 30,
+    12, 7, 11, 7, 12, 9, 11, 8, 12, 9, 11, 7, 10, 8, 11, 30, 7, 7, 8, 8, 7, 6, 8, 31, 11, 5, 8, 31, 8, 28, 26, 31,
+    13, 6, 14, 16, 11, 6, 25, 28, 15, 17, 20, 20, 17, 29, 25, 28, 11, 5, 25, 28, 6, 28, 25, 31, 17, 17, 20, 26, 25, 28, 25, 30,
+    10, 7, 8, 18, 10, 20, 20, 27, 10, 8, 17, 18, 21, 22, 22, 22, 7, 6, 18, 19, 21, 27, 21, 29, 18, 18, 18, 18, 21, 22, 22, 29,
+    11, 18, 17, 18, 19, 21, 19, 21, 17, 18, 17, 18, 19, 22, 21, 22, 19, 19, 19, 21, 19, 27, 19, 29, 18, 18, 20, 25, 19, 22, 21, 26,
+    13, 8, 10, 7, 12, 6, 7, 6, 13, 6, 7, 7, 11, 6, 7, 7, 10, 9, 8, 8, 6, 5, 8, 8, 6, 3, 3, 30, 5, 3, 3, 30,
+    14, 9, 13, 9, 15, 5, 13, 10, 15, 10, 14, 23, 12, 10, 13, 29, 12, 5, 11, 5, 6, 3, 18, 31, 15, 17, 23, 29, 21, 29, 23, 30,
+    13, 6, 11, 5, 13, 6, 11, 5, 13, 9, 11, 5, 11, 23, 11, 23, 10, 6, 5, 3, 6, 26, 20, 29, 6, 20, 18, 20, 20, 27, 23, 29,
+    15, 6, 15, 17, 15, 20, 20, 27, 15, 17, 12, 23, 20, 23, 23, 29, 12, 5, 18, 29, 25, 26, 25, 28, 18, 18, 18, 29, 20, 27, 23, 31,
+    15, 10, 14, 7, 13, 10, 11, 7, 14, 10, 13, 7, 11, 10, 11, 29, 14, 12, 14, 16, 13, 18, 17, 31, 15, 16, 16, 29, 16, 27, 25, 28,
+    15, 12, 15, 27, 15, 10, 12, 29, 15, 17, 14, 23, 12, 18, 20, 27, 15, 10, 25, 28, 17, 17, 25, 28, 17, 17, 20, 27, 17, 18, 20, 27,
+    14, 9, 13, 17, 13, 21, 18, 21, 14, 17, 13, 17, 19, 22, 21, 22, 15, 19, 18, 19, 19, 21, 19, 26, 18, 18, 18, 18, 19, 22, 21, 27,
+    15, 17, 17, 17, 19, 19, 19, 19, 17, 17, 17, 20, 19, 21, 21, 25, 19, 19, 20, 21, 19, 19, 19, 27, 18, 18, 20, 25, 19, 21, 24, 25,
+    10, 8, 10, 8, 10, 9, 7, 6, 11, 6, 7, 7, 6, 6, 7, 31, 9, 9, 8, 8, 5, 5, 8, 31, 5, 3, 3, 30, 3, 28, 28, 31,
+    11, 9, 12, 9, 5, 28, 26, 30, 12, 10, 13, 29, 25, 29, 23, 31, 10, 5, 6, 31, 5, 28, 26, 31, 21, 29, 23, 30, 25, 28, 23, 31,
+    11, 5, 6, 5, 12, 26, 6, 28, 12, 5, 11, 29, 10, 27, 23, 31, 10, 5, 20, 30, 6, 27, 25, 30, 20, 20, 20, 30, 25, 27, 23, 30,
+    12, 5, 18, 29, 25, 26, 25, 28, 18, 18, 18, 29, 20, 27, 23, 31, 12, 3, 20, 31, 25, 27, 25, 30, 20, 20, 20, 30, 25, 27, 23, 31,
+    15, 10, 13, 7, 13, 10, 7, 30, 13, 7, 7, 29, 11, 29, 7, 31, 13, 12, 11, 30, 25, 28, 25, 31, 16, 29, 16, 30, 25, 28, 26, 31,
+    15, 27, 13, 29, 25, 28, 25, 30, 14, 17, 20, 23, 17, 29, 20, 31, 12, 29, 25, 30, 25, 28, 25, 31, 17, 17, 20, 29, 17, 29, 25, 30,
+    14, 17, 17, 17, 20, 26, 20, 26, 13, 17, 17, 17, 21, 22, 22, 22, 18, 18, 18, 18, 21, 27, 21, 29, 18, 18, 18, 18, 21, 27, 22, 29,
+    17, 17, 17, 17, 20, 21, 19, 27, 17, 17, 17, 20, 19, 22, 21, 26, 19, 19, 19, 27, 19, 27, 19, 29, 18, 18, 20, 25, 19, 22, 21, 29,
+    15, 8, 15, 7, 12, 8, 12, 6, 14, 8, 12, 7, 11, 8, 12, 9, 15, 7, 14, 7, 12, 6, 11, 8, 12, 8, 11, 7, 10, 8, 11, 8,
+    15, 10, 15, 7, 14, 10, 13, 10, 15, 10, 15, 10, 13, 10, 13, 10, 15, 7, 13, 7, 13, 10, 7, 7, 14, 7, 13, 7, 11, 7, 7, 30,
+    14, 8, 12, 8, 11, 8, 10, 8, 15, 8, 12, 9, 9, 8, 10, 8, 12, 7, 11, 7, 12, 9, 11, 8, 12, 9, 11, 7, 10, 8, 11, 30,
+    15, 10, 14, 7, 13, 10, 11, 7, 14, 10, 13, 7, 11, 10, 11, 29, 15, 10, 13, 7, 13, 10, 7, 30, 13, 7, 7, 29, 11, 29, 7, 31,
+    15, 8, 15, 9, 14, 8, 12, 9, 15, 8, 12, 9, 13, 8, 12, 9, 15, 9, 14, 7, 12, 9, 11, 7, 12, 9, 11, 19, 10, 9, 19, 19,
+    15, 10, 15, 7, 14, 10, 13, 10, 14, 10, 15, 18, 13, 19, 19, 21, 15, 7, 13, 7, 13, 10, 7, 28, 14, 17, 18, 20, 11, 19, 19, 27,
+    15, 8, 12, 9, 13, 8, 10, 9, 14, 8, 12, 17, 11, 20, 18, 20, 12, 9, 11, 19, 12, 9, 19, 19, 12, 17, 17, 17, 18, 20, 20, 20,
+    14, 10, 14, 17, 13, 19, 11, 19, 14, 17, 17, 18, 17, 20, 18, 20, 15, 18, 18, 20, 19, 21, 19, 27, 17, 18, 17, 25, 18, 20, 20, 24,
+    12, 8, 12, 6, 12, 6, 7, 6, 13, 6, 7, 7, 10, 6, 7, 6, 12, 6, 11, 8, 7, 6, 8, 31, 11, 5, 8, 8, 8, 5, 8, 31,
+    14, 10, 13, 10, 14, 7, 11, 31, 14, 12, 13, 12, 13, 18, 25, 28, 13, 10, 7, 7, 11, 31, 16, 31, 14, 16, 11, 30, 17, 31, 25, 31,
+    13, 6, 11, 5, 10, 6, 8, 5, 12, 9, 11, 5, 9, 9, 8, 28, 7, 7, 8, 8, 7, 6, 8, 31, 11, 5, 8, 31, 8, 28, 26, 31,
+    14, 12, 14, 16, 13, 18, 17, 31, 15, 16, 16, 29, 16, 27, 25, 28, 13, 12, 11, 30, 25, 28, 25, 31, 16, 29, 16, 30, 25, 28, 26, 31,
+    15, 9, 14, 7, 12, 9, 11, 7, 12, 9, 11, 19, 10, 9, 19, 19, 14, 7, 14, 16, 11, 7, 16, 31, 11, 16, 16, 19, 16, 19, 19, 28,
+    14, 7, 14, 16, 14, 16, 16, 16, 14, 16, 18, 21, 16, 19, 19, 21, 14, 16, 13, 28, 16, 16, 16, 31, 17, 17, 18, 20, 16, 19, 19, 29,
+    12, 9, 11, 16, 10, 9, 16, 19, 12, 16, 17, 17, 17, 20, 18, 20, 11, 19, 16, 19, 19, 19, 19, 28, 17, 17, 17, 17, 18, 20, 20, 27,
+    14, 16, 17, 17, 16, 19, 16, 19, 17, 17, 17, 18, 17, 20, 18, 25, 18, 21, 18, 20, 19, 21, 19, 29, 17, 18, 17, 25, 18, 25, 20, 24,
+    14, 8, 12, 7, 13, 6, 7, 7, 14, 6, 15, 7, 11, 6, 11, 7, 12, 8, 11, 7, 11, 5, 8, 8, 14, 3, 14, 20, 13, 18, 20, 26,
+    15, 10, 15, 10, 14, 12, 13, 12, 15, 12, 15, 23, 13, 18, 20, 27, 14, 7, 13, 7, 14, 16, 11, 30, 14, 17, 20, 23, 17, 18, 20, 29,
+    14, 10, 13, 6, 13, 9, 11, 5, 14, 10, 13, 20, 11, 9, 11, 26, 13, 6, 14, 16, 11, 6, 25, 28, 15, 17, 20, 20, 17, 29, 25, 28,
+    15, 12, 15, 27, 15, 10, 12, 29, 15, 17, 14, 23, 12, 18, 20, 27, 15, 27, 13, 29, 25, 28, 25, 30, 14, 17, 20, 23, 17, 29, 20, 31,
+    15, 10, 15, 7, 14, 10, 13, 10, 14, 10, 15, 18, 13, 19, 19, 21, 14, 7, 14, 16, 14, 16, 16, 16, 14, 16, 18, 21, 16, 19, 19, 21,
+    15, 12, 15, 16, 15, 16, 13, 16, 15, 17, 19, 22, 16, 19, 19, 22, 14, 16, 13, 28, 16, 16, 16, 28, 17, 17, 19, 22, 17, 18, 19, 22,
+    14, 10, 15, 16, 14, 16, 12, 16, 14, 16, 16, 19, 17, 18, 18, 18, 15, 16, 16, 16, 19, 19, 19, 19, 16, 17, 17, 17, 18, 20, 20, 20,
+    15, 16, 14, 17, 16, 16, 16, 16, 17, 17, 19, 21, 17, 18, 18, 21, 18, 18, 18, 20, 19, 21, 19, 27, 17, 17, 19, 21, 18, 20, 20, 24,
+    11, 8, 12, 9, 10, 6, 7, 6, 11, 6, 11, 7, 7, 6, 7, 27, 10, 8, 11, 8, 8, 5, 8, 31, 13, 18, 20, 26, 17, 31, 25, 30,
+    13, 10, 13, 10, 13, 18, 25, 28, 13, 18, 20, 27, 17, 20, 20, 27, 11, 7, 7, 30, 17, 31, 25, 31, 17, 18, 20, 29, 17, 20, 20, 30,
+    13, 9, 11, 6, 12, 5, 6, 28, 12, 6, 20, 26, 10, 5, 25, 27, 11, 5, 25, 28, 6, 28, 25, 31, 17, 17, 20, 26, 25, 28, 25, 30,
+    15, 10, 25, 28, 17, 17, 25, 28, 17, 17, 20, 27, 17, 18, 20, 27, 12, 29, 25, 30, 25, 28, 25, 31, 17, 17, 20, 29, 17, 29, 25, 30,
+    15, 7, 13, 7, 13, 10, 7, 28, 14, 17, 18, 20, 11, 19, 19, 27, 14, 16, 13, 28, 16, 16, 16, 31, 17, 17, 18, 20, 16, 19, 19, 29,
+    14, 16, 13, 28, 16, 16, 16, 28, 17, 17, 19, 22, 17, 18, 19, 22, 14, 16, 11, 30, 16, 16, 16, 31, 17, 17, 19, 22, 17, 19, 19, 29,
+    15, 16, 16, 16, 12, 16, 16, 16, 16, 16, 18, 18, 17, 18, 18, 18, 16, 16, 16, 16, 19, 19, 19, 28, 16, 16, 17, 19, 18, 20, 20, 27,
+    16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 19, 21, 17, 18, 19, 21, 18, 18, 18, 26, 19, 21, 19, 29, 17, 17, 19, 21, 18, 20, 20, 25,
+    12, 8, 10, 6, 12, 8, 10, 6, 13, 8, 10, 7, 10, 8, 10, 20, 10, 6, 8, 8, 10, 6, 8, 19, 10, 8, 8, 18, 9, 21, 20, 27,
+    14, 9, 14, 9, 14, 9, 12, 19, 14, 9, 14, 17, 13, 21, 20, 26, 14, 9, 11, 16, 12, 19, 19, 19, 13, 17, 17, 17, 18, 21, 20, 26,
+    13, 8, 10, 8, 10, 8, 9, 21, 12, 8, 10, 8, 9, 22, 21, 22, 10, 7, 8, 18, 10, 20, 20, 27, 10, 8, 17, 18, 21, 22, 22, 22,
+    14, 9, 13, 17, 13, 21, 18, 21, 14, 17, 13, 17, 19, 22, 21, 22, 14, 17, 17, 17, 20, 26, 20, 26, 13, 17, 17, 17, 21, 22, 22, 22,
+    15, 8, 12, 9, 13, 8, 10, 9, 14, 8, 12, 17, 11, 20, 18, 20, 12, 9, 11, 16, 10, 9, 16, 19, 12, 16, 17, 17, 17, 20, 18, 20,
+    14, 10, 15, 16, 14, 16, 12, 16, 14, 16, 16, 19, 17, 18, 18, 18, 15, 16, 16, 16, 12, 16, 16, 16, 16, 16, 18, 18, 17, 18, 18, 18,
+    14, 8, 12, 16, 11, 20, 17, 20, 15, 16, 16, 16, 16, 23, 19, 22, 12, 17, 17, 17, 18, 20, 18, 20, 16, 16, 16, 16, 19, 22, 21, 23,
+    14, 16, 16, 16, 17, 18, 17, 18, 16, 16, 16, 16, 17, 20, 18, 21, 16, 19, 18, 18, 18, 18, 18, 18, 16, 16, 16, 16, 18, 21, 20, 20,
+    12, 8, 10, 6, 12, 6, 7, 6, 12, 6, 7, 6, 10, 21, 21, 27, 10, 6, 8, 19, 7, 6, 19, 28, 11, 19, 18, 19, 19, 26, 21, 29,
+    14, 9, 12, 19, 19, 19, 19, 28, 15, 19, 18, 18, 19, 21, 21, 27, 12, 19, 19, 19, 19, 28, 19, 28, 18, 19, 18, 18, 19, 26, 21, 29,
+    12, 6, 11, 19, 10, 21, 19, 26, 12, 9, 18, 18, 19, 22, 21, 22, 7, 6, 18, 19, 21, 27, 21, 29, 18, 18, 18, 18, 21, 22, 22, 29,
+    15, 19, 18, 19, 19, 21, 19, 26, 18, 18, 18, 18, 19, 22, 21, 27, 18, 18, 18, 18, 21, 27, 21, 29, 18, 18, 18, 18, 21, 27, 22, 29,
+    12, 9, 11, 19, 12, 9, 19, 19, 12, 17, 17, 17, 18, 20, 20, 20, 11, 19, 16, 19, 19, 19, 19, 28, 17, 17, 17, 17, 18, 20, 20, 27,
+    15, 16, 16, 16, 19, 19, 19, 19, 16, 17, 17, 17, 18, 20, 20, 20, 16, 16, 16, 16, 19, 19, 19, 28, 16, 16, 17, 19, 18, 20, 20, 27,
+    12, 17, 17, 17, 18, 20, 18, 20, 16, 16, 16, 16, 19, 22, 21, 23, 17, 17, 17, 17, 20, 20, 20, 27, 16, 16, 16, 16, 21, 23, 22, 23,
+    16, 17, 16, 16, 18, 20, 18, 20, 16, 16, 16, 16, 17, 23, 19, 22, 17, 17, 17, 19, 20, 20, 20, 27, 16, 16, 16, 16, 19, 22, 20, 23,
+    13, 8, 10, 7, 12, 6, 7, 6, 13, 6, 7, 7, 11, 20, 20, 25, 10, 8, 8, 18, 11, 19, 18, 19, 17, 18, 17, 24, 18, 20, 20, 25,
+    14, 9, 14, 17, 15, 19, 18, 18, 15, 17, 14, 20, 18, 20, 24, 25, 13, 17, 17, 17, 18, 19, 18, 18, 17, 17, 20, 20, 18, 20, 24, 25,
+    13, 10, 11, 18, 13, 19, 19, 19, 13, 18, 11, 18, 19, 21, 21, 21, 11, 18, 17, 18, 19, 21, 19, 21, 17, 18, 17, 18, 19, 22, 21, 22,
+    15, 17, 17, 17, 19, 19, 19, 19, 17, 17, 17, 20, 19, 21, 21, 25, 17, 17, 17, 17, 20, 21, 19, 27, 17, 17, 17, 20, 19, 22, 21, 26,
+    14, 10, 14, 17, 13, 19, 11, 19, 14, 17, 17, 18, 17, 20, 18, 20, 14, 16, 17, 17, 16, 19, 16, 19, 17, 17, 17, 18, 17, 20, 18, 25,
+    15, 16, 14, 17, 16, 16, 16, 16, 17, 17, 19, 21, 17, 18, 18, 21, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 19, 21, 17, 18, 19, 21,
+    14, 16, 16, 16, 17, 18, 17, 18, 16, 16, 16, 16, 17, 20, 18, 21, 16, 17, 16, 16, 18, 20, 18, 20, 16, 16, 16, 16, 17, 23, 19, 22,
+    16, 16, 16, 16, 17, 17, 17, 17, 16, 16, 16, 19, 17, 18, 19, 19, 16, 16, 16, 18, 18, 18, 18, 18, 16, 16, 16, 19, 18, 21, 19, 21,
+    10, 8, 10, 20, 10, 21, 21, 27, 11, 20, 20, 25, 18, 25, 24, 24, 9, 21, 20, 27, 19, 26, 21, 29, 18, 20, 20, 25, 19, 25, 24, 25,
+    13, 21, 20, 26, 19, 21, 21, 27, 18, 20, 24, 25, 18, 25, 24, 24, 18, 21, 20, 26, 19, 26, 21, 29, 18, 20, 24, 25, 18, 25, 24, 24,
+    13, 19, 19, 21, 19, 19, 19, 27, 18, 18, 20, 25, 19, 21, 21, 25, 19, 19, 19, 21, 19, 27, 19, 29, 18, 18, 20, 25, 19, 22, 21, 26,
+    19, 19, 20, 21, 19, 19, 19, 27, 18, 18, 20, 25, 19, 21, 24, 25, 19, 19, 19, 27, 19, 27, 19, 29, 18, 18, 20, 25, 19, 22, 21, 29,
+    15, 18, 18, 20, 19, 21, 19, 27, 17, 18, 17, 25, 18, 20, 20, 24, 18, 21, 18, 20, 19, 21, 19, 29, 17, 18, 17, 25, 18, 25, 20, 24,
+    18, 18, 18, 20, 19, 21, 19, 27, 17, 17, 19, 21, 18, 20, 20, 24, 18, 18, 18, 26, 19, 21, 19, 29, 17, 17, 19, 21, 18, 20, 20, 25,
+    16, 19, 18, 18, 18, 18, 18, 18, 16, 16, 16, 16, 18, 21, 20, 20, 17, 17, 17, 19, 20, 20, 20, 27, 16, 16, 16, 16, 19, 22, 20, 23,
+    16, 16, 16, 18, 18, 18, 18, 18, 16, 16, 16, 19, 18, 21, 19, 21, 16, 17, 16, 16, 20, 20, 20, 27, 16, 16, 16, 19, 18, 23, 19, 22,
+    13, 7, 10, 6, 7, 7, 8, 5, 14, 6, 15, 5, 11, 5, 6, 5, 11, 7, 10, 6, 7, 7, 8, 8, 13, 6, 11, 5, 12, 5, 6, 5,
+    13, 8, 10, 7, 10, 9, 8, 8, 14, 9, 13, 9, 12, 5, 11, 5, 10, 8, 10, 8, 9, 9, 8, 8, 11, 9, 12, 9, 10, 5, 6, 31,
+    11, 7, 9, 8, 7, 7, 8, 5, 13, 6, 11, 5, 11, 5, 6, 5, 11, 7, 9, 8, 7, 7, 8, 26, 13, 6, 11, 5, 12, 26, 6, 28,
+    10, 8, 9, 8, 10, 9, 8, 8, 13, 9, 11, 5, 12, 5, 11, 29, 9, 8, 9, 8, 9, 9, 23, 29, 11, 23, 11, 23, 10, 27, 23, 31,
+    14, 8, 12, 8, 13, 6, 11, 5, 14, 10, 13, 6, 13, 9, 11, 6, 11, 8, 10, 8, 10, 6, 8, 5, 13, 9, 11, 5, 12, 5, 6, 28,
+    15, 8, 12, 9, 12, 9, 11, 5, 14, 10, 13, 20, 12, 6, 20, 26, 9, 8, 10, 8, 9, 9, 8, 28, 11, 9, 11, 26, 10, 5, 25, 27,
+    13, 8, 10, 8, 12, 6, 11, 19, 13, 10, 11, 18, 13, 19, 19, 21, 10, 8, 9, 21, 10, 21, 19, 26, 13, 19, 19, 19, 19, 19, 19, 27,
+    12, 8, 10, 8, 12, 9, 18, 18, 13, 18, 11, 18, 18, 18, 20, 25, 9, 22, 21, 22, 19, 22, 21, 22, 19, 21, 21, 21, 19, 21, 21, 25,
+    11, 7, 10, 6, 7, 7, 8, 8, 13, 6, 11, 5, 12, 5, 6, 5, 12, 7, 7, 6, 7, 7, 8, 31, 6, 6, 11, 28, 6, 5, 25, 31,
+    12, 6, 7, 6, 6, 5, 8, 8, 15, 5, 13, 10, 6, 3, 18, 31, 10, 9, 7, 6, 5, 5, 8, 31, 5, 28, 26, 30, 5, 28, 26, 31,
+    7, 7, 8, 5, 7, 7, 8, 3, 10, 6, 5, 3, 10, 5, 20, 30, 7, 7, 8, 26, 7, 7, 25, 30, 6, 26, 20, 29, 6, 27, 25, 30,
+    10, 9, 8, 8, 11, 5, 20, 20, 6, 20, 18, 20, 20, 20, 20, 30, 9, 9, 23, 29, 20, 27, 23, 30, 20, 27, 23, 29, 25, 27, 23, 30,
+    12, 7, 11, 7, 7, 7, 8, 8, 13, 6, 14, 16, 11, 5, 25, 28, 12, 9, 11, 8, 7, 6, 8, 31, 11, 6, 25, 28, 6, 28, 25, 31,
+    12, 9, 11, 7, 11, 5, 8, 31, 15, 17, 20, 20, 17, 17, 20, 26, 10, 8, 11, 30, 8, 28, 26, 31, 17, 29, 25, 28, 25, 28, 25, 30,
+    10, 7, 8, 18, 7, 6, 18, 19, 11, 18, 17, 18, 19, 19, 19, 21, 10, 20, 20, 27, 21, 27, 21, 29, 19, 21, 19, 21, 19, 27, 19, 29,
+    10, 8, 17, 18, 18, 18, 18, 18, 17, 18, 17, 18, 18, 18, 20, 25, 21, 22, 22, 22, 21, 22, 22, 29, 19, 22, 21, 22, 19, 22, 21, 26,
+    13, 8, 10, 7, 10, 9, 8, 8, 14, 9, 13, 9, 12, 5, 11, 5, 12, 6, 7, 6, 6, 5, 8, 8, 15, 5, 13, 10, 6, 3, 18, 31,
+    13, 6, 7, 7, 6, 3, 3, 30, 15, 10, 14, 23, 15, 17, 23, 29, 11, 6, 7, 7, 5, 3, 3, 30, 12, 10, 13, 29, 21, 29, 23, 30,
+    13, 6, 11, 5, 10, 6, 5, 3, 15, 6, 15, 17, 12, 5, 18, 29, 13, 6, 11, 5, 6, 26, 20, 29, 15, 20, 20, 27, 25, 26, 25, 28,
+    13, 9, 11, 5, 6, 20, 18, 20, 15, 17, 12, 23, 18, 18, 18, 29, 11, 23, 11, 23, 20, 27, 23, 29, 20, 23, 23, 29, 20, 27, 23, 31,
+    15, 10, 14, 7, 14, 12, 14, 16, 15, 12, 15, 27, 15, 10, 25, 28, 13, 10, 11, 7, 13, 18, 17, 31, 15, 10, 12, 29, 17, 17, 25, 28,
+    14, 10, 13, 7, 15, 16, 16, 29, 15, 17, 14, 23, 17, 17, 20, 27, 11, 10, 11, 29, 16, 27, 25, 28, 12, 18, 20, 27, 17, 18, 20, 27,
+    14, 9, 13, 17, 15, 19, 18, 19, 15, 17, 17, 17, 19, 19, 20, 21, 13, 21, 18, 21, 19, 21, 19, 26, 19, 19, 19, 19, 19, 19, 19, 27,
+    14, 17, 13, 17, 18, 18, 18, 18, 17, 17, 17, 20, 18, 18, 20, 25, 19, 22, 21, 22, 19, 22, 21, 27, 19, 21, 21, 25, 19, 21, 24, 25,
+    10, 8, 10, 8, 9, 9, 8, 8, 11, 9, 12, 9, 10, 5, 6, 31, 10, 9, 7, 6, 5, 5, 8, 31, 5, 28, 26, 30, 5, 28, 26, 31,
+    11, 6, 7, 7, 5, 3, 3, 30, 12, 10, 13, 29, 21, 29, 23, 30, 6, 6, 7, 31, 3, 28, 28, 31, 25, 29, 23, 31, 25, 28, 23, 31,
+    11, 5, 6, 5, 10, 5, 20, 30, 12, 5, 18, 29, 12, 3, 20, 31, 12, 26, 6, 28, 6, 27, 25, 30, 25, 26, 25, 28, 25, 27, 25, 30,
+    12, 5, 11, 29, 20, 20, 20, 30, 18, 18, 18, 29, 20, 20, 20, 30, 10, 27, 23, 31, 25, 27, 23, 30, 20, 27, 23, 31, 25, 27, 23, 31,
+    15, 10, 13, 7, 13, 12, 11, 30, 15, 27, 13, 29, 12, 29, 25, 30, 13, 10, 7, 30, 25, 28, 25, 31, 25, 28, 25, 30, 25, 28, 25, 31,
+    13, 7, 7, 29, 16, 29, 16, 30, 14, 17, 20, 23, 17, 17, 20, 29, 11, 29, 7, 31, 25, 28, 26, 31, 17, 29, 20, 31, 17, 29, 25, 30,
+    14, 17, 17, 17, 18, 18, 18, 18, 17, 17, 17, 17, 19, 19, 19, 27, 20, 26, 20, 26, 21, 27, 21, 29, 20, 21, 19, 27, 19, 27, 19, 29,
+    13, 17, 17, 17, 18, 18, 18, 18, 17, 17, 17, 20, 18, 18, 20, 25, 21, 22, 22, 22, 21, 27, 22, 29, 19, 22, 21, 26, 19, 22, 21, 29,
+    11, 7, 9, 8, 7, 7, 8, 5, 13, 6, 11, 5, 11, 5, 6, 5, 7, 7, 8, 5, 7, 7, 8, 3, 10, 6, 5, 3, 10, 5, 20, 30,
+    13, 6, 11, 5, 10, 6, 5, 3, 15, 6, 15, 17, 12, 5, 18, 29, 11, 5, 6, 5, 10, 5, 20, 30, 12, 5, 18, 29, 12, 3, 20, 31,
+    7, 7, 17, 24, 7, 7, 20, 24, 11, 6, 17, 20, 11, 20, 20, 23, 7, 7, 20, 24, 7, 7, 24, 25, 10, 6, 20, 24, 24, 25, 24, 26,
+    11, 6, 17, 20, 10, 6, 20, 24, 12, 18, 17, 18, 20, 20, 20, 23, 11, 20, 20, 23, 24, 25, 24, 26, 20, 20, 20, 23, 24, 25, 24, 28,
+    14, 6, 14, 3, 11, 6, 13, 18, 14, 10, 15, 17, 11, 9, 17, 29, 11, 6, 13, 18, 7, 6, 17, 31, 12, 6, 17, 17, 10, 5, 25, 28,
+    14, 10, 15, 17, 12, 6, 17, 17, 15, 12, 20, 20, 12, 9, 20, 26, 11, 9, 17, 29, 10, 5, 25, 28, 12, 9, 20, 26, 12, 3, 25, 27,
+    13, 6, 17, 18, 11, 20, 18, 20, 13, 18, 17, 18, 19, 21, 19, 22, 11, 20, 18, 20, 18, 25, 19, 25, 18, 18, 18, 18, 19, 21, 19, 22,
+    13, 18, 17, 18, 18, 18, 18, 18, 17, 18, 17, 18, 19, 19, 19, 21, 19, 21, 19, 22, 19, 21, 19, 22, 19, 19, 19, 21, 19, 19, 19, 25,
+    11, 7, 9, 8, 7, 7, 8, 26, 13, 6, 11, 5, 12, 26, 6, 28, 7, 7, 8, 26, 7, 7, 25, 30, 6, 26, 20, 29, 6, 27, 25, 30,
+    13, 6, 11, 5, 6, 26, 20, 29, 15, 20, 20, 27, 25, 26, 25, 28, 12, 26, 6, 28, 6, 27, 25, 30, 25, 26, 25, 28, 25, 27, 25, 30,
+    7, 7, 20, 24, 7, 7, 24, 25, 10, 6, 20, 24, 24, 25, 24, 26, 7, 7, 24, 25, 7, 24, 24, 24, 24, 25, 24, 25, 24, 24, 24, 30,
+    10, 6, 20, 24, 24, 25, 24, 25, 20, 24, 20, 24, 24, 25, 24, 26, 24, 25, 24, 26, 24, 24, 24, 30, 24, 25, 24, 26, 24, 24, 24, 31,
+    15, 7, 14, 20, 11, 7, 20, 26, 13, 20, 20, 20, 11, 26, 25, 28, 11, 7, 20, 26, 7, 27, 25, 30, 20, 26, 20, 26, 25, 27, 25, 30,
+    13, 20, 20, 20, 20, 26, 20, 26, 20, 20, 20, 20, 20, 26, 20, 30, 11, 26, 25, 28, 25, 27, 25, 30, 20, 26, 20, 30, 25, 27, 25, 30,
+    7, 7, 17, 24, 20, 25, 20, 25, 11, 18, 17, 18, 21, 21, 21, 22, 20, 25, 20, 25, 24, 24, 24, 25, 20, 25, 20, 25, 21, 25, 21, 26,
+    11, 18, 17, 18, 20, 25, 20, 25, 17, 18, 17, 18, 19, 21, 19, 22, 21, 21, 21, 22, 21, 25, 21, 26, 19, 21, 19, 22, 19, 25, 19, 28,
+    10, 8, 9, 8, 10, 9, 8, 8, 13, 9, 11, 5, 12, 5, 11, 29, 10, 9, 8, 8, 11, 5, 20, 20, 6, 20, 18, 20, 20, 20, 20, 30,
+    13, 9, 11, 5, 6, 20, 18, 20, 15, 17, 12, 23, 18, 18, 18, 29, 12, 5, 11, 29, 20, 20, 20, 30, 18, 18, 18, 29, 20, 20, 20, 30,
+    11, 6, 17, 20, 10, 6, 20, 24, 12, 18, 17, 18, 20, 20, 20, 23, 10, 6, 20, 24, 24, 25, 24, 25, 20, 24, 20, 24, 24, 25, 24, 26,
+    12, 18, 17, 18, 20, 24, 20, 24, 17, 17, 17, 17, 20, 20, 20, 23, 20, 20, 20, 23, 24, 25, 24, 26, 20, 20, 20, 23, 24, 25, 24, 28,
+    15, 12, 14, 17, 13, 18, 17, 18, 15, 17, 14, 17, 12, 18, 17, 29, 13, 18, 17, 18, 17, 20, 17, 20, 17, 17, 17, 17, 17, 18, 17, 29,
+    15, 17, 14, 17, 17, 17, 17, 17, 15, 17, 20, 23, 17, 17, 20, 27, 12, 18, 17, 29, 17, 18, 17, 29, 17, 17, 20, 27, 17, 17, 20, 27,
+    15, 17, 17, 17, 18, 20, 18, 20, 17, 17, 17, 17, 19, 21, 19, 22, 18, 20, 18, 20, 18, 25, 18, 25, 18, 18, 18, 18, 19, 21, 19, 22,
+    17, 17, 17, 17, 18, 18, 18, 18, 17, 17, 17, 17, 19, 19, 19, 21, 19, 21, 19, 22, 19, 21, 19, 22, 19, 19, 19, 21, 19, 19, 19, 25,
+    9, 8, 9, 8, 9, 9, 23, 29, 11, 23, 11, 23, 10, 27, 23, 31, 9, 9, 23, 29, 20, 27, 23, 30, 20, 27, 23, 29, 25, 27, 23, 30,
+    11, 23, 11, 23, 20, 27, 23, 29, 20, 23, 23, 29, 20, 27, 23, 31, 10, 27, 23, 31, 25, 27, 23, 30, 20, 27, 23, 31, 25, 27, 23, 31,
+    11, 20, 20, 23, 24, 25, 24, 26, 20, 20, 20, 23, 24, 25, 24, 28, 24, 25, 24, 26, 24, 24, 24, 30, 24, 25, 24, 26, 24, 24, 24, 31,
+    20, 20, 20, 23, 24, 25, 24, 26, 20, 20, 20, 23, 24, 25, 24, 28, 24, 25, 24, 28, 24, 24, 24, 31, 24, 25, 24, 28, 24, 24, 24, 31,
+    15, 23, 20, 23, 20, 27, 20, 29, 14, 23, 20, 23, 20, 27, 20, 31, 20, 27, 20, 29, 20, 27, 20, 30, 20, 27, 20, 29, 20, 27, 25, 30,
+    14, 23, 20, 23, 20, 27, 20, 29, 20, 23, 20, 29, 20, 27, 20, 31, 20, 27, 20, 31, 20, 27, 25, 30, 20, 27, 20, 31, 20, 27, 20, 31,
+    14, 20, 20, 20, 24, 25, 24, 25, 17, 20, 17, 20, 21, 25, 21, 26, 24, 25, 24, 25, 24, 24, 24, 24, 20, 25, 20, 25, 24, 25, 21, 29,
+    17, 20, 17, 20, 20, 25, 20, 25, 17, 17, 17, 17, 19, 21, 19, 22, 21, 25, 21, 26, 24, 25, 21, 29, 19, 21, 19, 22, 19, 25, 19, 28,
+    14, 8, 12, 8, 13, 6, 11, 5, 14, 10, 13, 6, 13, 9, 11, 6, 12, 7, 11, 7, 7, 7, 8, 8, 13, 6, 14, 16, 11, 5, 25, 28,
+    15, 10, 14, 7, 14, 12, 14, 16, 15, 12, 15, 27, 15, 10, 25, 28, 15, 10, 13, 7, 13, 12, 11, 30, 15, 27, 13, 29, 12, 29, 25, 30,
+    14, 6, 14, 3, 11, 6, 13, 18, 14, 10, 15, 17, 11, 9, 17, 29, 15, 7, 14, 20, 11, 7, 20, 26, 13, 20, 20, 20, 11, 26, 25, 28,
+    15, 12, 14, 17, 13, 18, 17, 18, 15, 17, 14, 17, 12, 18, 17, 29, 15, 23, 20, 23, 20, 27, 20, 29, 14, 23, 20, 23, 20, 27, 20, 31,
+    15, 10, 14, 7, 14, 10, 14, 16, 14, 10, 15, 16, 14, 16, 19, 19, 15, 7, 14, 16, 13, 10, 16, 16, 15, 16, 16, 16, 12, 16, 19, 19,
+    15, 12, 14, 16, 15, 16, 16, 16, 15, 16, 18, 18, 16, 16, 19, 21, 15, 16, 13, 28, 13, 16, 16, 28, 14, 17, 18, 20, 16, 16, 19, 27,
+    14, 10, 14, 16, 13, 19, 16, 19, 14, 16, 16, 17, 17, 18, 18, 20, 15, 18, 18, 21, 19, 21, 19, 21, 16, 19, 17, 17, 18, 18, 20, 20,
+    15, 17, 17, 17, 16, 19, 17, 18, 17, 17, 17, 17, 17, 18, 18, 20, 19, 22, 19, 22, 19, 22, 19, 22, 19, 21, 19, 21, 18, 21, 20, 24,
+    11, 8, 10, 8, 10, 6, 8, 5, 13, 9, 11, 5, 12, 5, 6, 28, 12, 9, 11, 8, 7, 6, 8, 31, 11, 6, 25, 28, 6, 28, 25, 31,
+    13, 10, 11, 7, 13, 18, 17, 31, 15, 10, 12, 29, 17, 17, 25, 28, 13, 10, 7, 30, 25, 28, 25, 31, 25, 28, 25, 30, 25, 28, 25, 31,
+    11, 6, 13, 18, 7, 6, 17, 31, 12, 6, 17, 17, 10, 5, 25, 28, 11, 7, 20, 26, 7, 27, 25, 30, 20, 26, 20, 26, 25, 27, 25, 30,
+    13, 18, 17, 18, 17, 20, 17, 20, 17, 17, 17, 17, 17, 18, 17, 29, 20, 27, 20, 29, 20, 27, 20, 30, 20, 27, 20, 29, 20, 27, 25, 30,
+    15, 7, 14, 16, 13, 10, 16, 16, 15, 16, 16, 16, 12, 16, 19, 19, 13, 7, 13, 28, 7, 28, 16, 31, 16, 16, 16, 16, 16, 16, 19, 28,
+    14, 16, 14, 16, 16, 16, 16, 16, 16, 16, 18, 18, 16, 16, 19, 21, 13, 28, 11, 30, 16, 28, 16, 31, 16, 16, 18, 26, 16, 16, 19, 29,
+    14, 17, 17, 17, 11, 19, 16, 19, 16, 16, 16, 16, 17, 18, 18, 20, 18, 20, 18, 20, 19, 27, 19, 29, 18, 18, 17, 19, 18, 18, 20, 27,
+    17, 17, 17, 17, 17, 18, 17, 19, 17, 17, 17, 17, 17, 18, 18, 20, 19, 22, 19, 22, 19, 22, 19, 29, 19, 21, 19, 21, 19, 21, 20, 25,
+    15, 8, 12, 9, 12, 9, 11, 5, 14, 10, 13, 20, 12, 6, 20, 26, 12, 9, 11, 7, 11, 5, 8, 31, 15, 17, 20, 20, 17, 17, 20, 26,
+    14, 10, 13, 7, 15, 16, 16, 29, 15, 17, 14, 23, 17, 17, 20, 27, 13, 7, 7, 29, 16, 29, 16, 30, 14, 17, 20, 23, 17, 17, 20, 29,
+    14, 10, 15, 17, 12, 6, 17, 17, 15, 12, 20, 20, 12, 9, 20, 26, 13, 20, 20, 20, 20, 26, 20, 26, 20, 20, 20, 20, 20, 26, 20, 30,
+    15, 17, 14, 17, 17, 17, 17, 17, 15, 17, 20, 23, 17, 17, 20, 27, 14, 23, 20, 23, 20, 27, 20, 29, 20, 23, 20, 29, 20, 27, 20, 31,
+    15, 12, 14, 16, 15, 16, 16, 16, 15, 16, 18, 18, 16, 16, 19, 21, 14, 16, 14, 16, 16, 16, 16, 16, 16, 16, 18, 18, 16, 16, 19, 21,
+    15, 16, 14, 27, 16, 16, 16, 16, 15, 17, 19, 22, 16, 16, 19, 22, 14, 27, 13, 29, 16, 16, 16, 28, 17, 17, 19, 22, 16, 17, 19, 22,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 18, 18, 18, 18, 18, 18, 19, 21, 19, 21, 16, 16, 16, 17, 18, 18, 20, 20,
+    15, 17, 17, 17, 16, 16, 16, 17, 17, 17, 19, 21, 17, 17, 18, 21, 19, 22, 19, 22, 19, 22, 19, 22, 19, 21, 19, 25, 18, 21, 20, 24,
+    9, 8, 10, 8, 9, 9, 8, 28, 11, 9, 11, 26, 10, 5, 25, 27, 10, 8, 11, 30, 8, 28, 26, 31, 17, 29, 25, 28, 25, 28, 25, 30,
+    11, 10, 11, 29, 16, 27, 25, 28, 12, 18, 20, 27, 17, 18, 20, 27, 11, 29, 7, 31, 25, 28, 26, 31, 17, 29, 20, 31, 17, 29, 25, 30,
+    11, 9, 17, 29, 10, 5, 25, 28, 12, 9, 20, 26, 12, 3, 25, 27, 11, 26, 25, 28, 25, 27, 25, 30, 20, 26, 20, 30, 25, 27, 25, 30,
+    12, 18, 17, 29, 17, 18, 17, 29, 17, 17, 20, 27, 17, 17, 20, 27, 20, 27, 20, 31, 20, 27, 25, 30, 20, 27, 20, 31, 20, 27, 20, 31,
+    15, 16, 13, 28, 13, 16, 16, 28, 14, 17, 18, 20, 16, 16, 19, 27, 13, 28, 11, 30, 16, 28, 16, 31, 16, 16, 18, 26, 16, 16, 19, 29,
+    14, 27, 13, 29, 16, 16, 16, 28, 17, 17, 19, 22, 16, 17, 19, 22, 13, 29, 7, 31, 16, 28, 16, 31, 17, 17, 19, 22, 16, 16, 19, 29,
+    14, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 17, 17, 18, 18, 18, 20, 18, 26, 19, 27, 19, 29, 16, 18, 16, 16, 18, 18, 20, 27,
+    17, 17, 17, 17, 16, 17, 16, 16, 17, 17, 19, 21, 17, 17, 18, 21, 19, 22, 19, 22, 19, 22, 19, 29, 19, 21, 19, 25, 18, 21, 20, 24,
+    13, 8, 10, 8, 12, 6, 11, 19, 13, 10, 11, 18, 13, 19, 19, 21, 10, 7, 8, 18, 7, 6, 18, 19, 11, 18, 17, 18, 19, 19, 19, 21,
+    14, 9, 13, 17, 15, 19, 18, 19, 15, 17, 17, 17, 19, 19, 20, 21, 14, 17, 17, 17, 18, 18, 18, 18, 17, 17, 17, 17, 19, 19, 19, 27,
+    13, 6, 17, 18, 11, 20, 18, 20, 13, 18, 17, 18, 19, 21, 19, 22, 7, 7, 17, 24, 20, 25, 20, 25, 11, 18, 17, 18, 21, 21, 21, 22,
+    15, 17, 17, 17, 18, 20, 18, 20, 17, 17, 17, 17, 19, 21, 19, 22, 14, 20, 20, 20, 24, 25, 24, 25, 17, 20, 17, 20, 21, 25, 21, 26,
+    14, 10, 14, 16, 13, 19, 16, 19, 14, 16, 16, 17, 17, 18, 18, 20, 14, 17, 17, 17, 11, 19, 16, 19, 16, 16, 16, 16, 17, 18, 18, 20,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 18, 18, 14, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 17, 17, 18, 18,
+    14, 17, 17, 17, 17, 20, 17, 20, 16, 16, 16, 16, 17, 20, 17, 23, 17, 18, 17, 18, 18, 20, 18, 25, 16, 16, 16, 16, 18, 21, 19, 22,
+    17, 17, 17, 17, 17, 18, 17, 18, 16, 16, 16, 16, 17, 18, 18, 21, 19, 21, 19, 21, 18, 21, 19, 21, 16, 19, 16, 19, 19, 19, 19, 21,
+    10, 8, 9, 21, 10, 21, 19, 26, 13, 19, 19, 19, 19, 19, 19, 27, 10, 20, 20, 27, 21, 27, 21, 29, 19, 21, 19, 21, 19, 27, 19, 29,
+    13, 21, 18, 21, 19, 21, 19, 26, 19, 19, 19, 19, 19, 19, 19, 27, 20, 26, 20, 26, 21, 27, 21, 29, 20, 21, 19, 27, 19, 27, 19, 29,
+    11, 20, 18, 20, 18, 25, 19, 25, 18, 18, 18, 18, 19, 21, 19, 22, 20, 25, 20, 25, 24, 24, 24, 25, 20, 25, 20, 25, 21, 25, 21, 26,
+    18, 20, 18, 20, 18, 25, 18, 25, 18, 18, 18, 18, 19, 21, 19, 22, 24, 25, 24, 25, 24, 24, 24, 24, 20, 25, 20, 25, 24, 25, 21, 29,
+    15, 18, 18, 21, 19, 21, 19, 21, 16, 19, 17, 17, 18, 18, 20, 20, 18, 20, 18, 20, 19, 27, 19, 29, 18, 18, 17, 19, 18, 18, 20, 27,
+    18, 18, 18, 18, 19, 21, 19, 21, 16, 16, 16, 17, 18, 18, 20, 20, 18, 20, 18, 26, 19, 27, 19, 29, 16, 18, 16, 16, 18, 18, 20, 27,
+    17, 18, 17, 18, 18, 20, 18, 25, 16, 16, 16, 16, 18, 21, 19, 22, 17, 25, 17, 25, 20, 24, 20, 24, 16, 16, 16, 16, 20, 20, 20, 23,
+    17, 17, 17, 17, 18, 20, 18, 20, 16, 16, 16, 16, 18, 21, 18, 23, 19, 21, 19, 21, 20, 24, 20, 25, 16, 19, 16, 19, 19, 21, 19, 22,
+    12, 8, 10, 8, 12, 9, 18, 18, 13, 18, 11, 18, 18, 18, 20, 25, 10, 8, 17, 18, 18, 18, 18, 18, 17, 18, 17, 18, 18, 18, 20, 25,
+    14, 17, 13, 17, 18, 18, 18, 18, 17, 17, 17, 20, 18, 18, 20, 25, 13, 17, 17, 17, 18, 18, 18, 18, 17, 17, 17, 20, 18, 18, 20, 25,
+    13, 18, 17, 18, 18, 18, 18, 18, 17, 18, 17, 18, 19, 19, 19, 21, 11, 18, 17, 18, 20, 25, 20, 25, 17, 18, 17, 18, 19, 21, 19, 22,
+    17, 17, 17, 17, 18, 18, 18, 18, 17, 17, 17, 17, 19, 19, 19, 21, 17, 20, 17, 20, 20, 25, 20, 25, 17, 17, 17, 17, 19, 21, 19, 22,
+    15, 17, 17, 17, 16, 19, 17, 18, 17, 17, 17, 17, 17, 18, 18, 20, 17, 17, 17, 17, 17, 18, 17, 19, 17, 17, 17, 17, 17, 18, 18, 20,
+    15, 17, 17, 17, 16, 16, 16, 17, 17, 17, 19, 21, 17, 17, 18, 21, 17, 17, 17, 17, 16, 17, 16, 16, 17, 17, 19, 21, 17, 17, 18, 21,
+    17, 17, 17, 17, 17, 18, 17, 18, 16, 16, 16, 16, 17, 18, 18, 21, 17, 17, 17, 17, 18, 20, 18, 20, 16, 16, 16, 16, 18, 21, 18, 23,
+    17, 17, 17, 17, 17, 17, 17, 17, 16, 16, 16, 16, 17, 17, 19, 19, 19, 21, 19, 21, 18, 21, 18, 21, 16, 16, 16, 16, 19, 19, 20, 21,
+    9, 22, 21, 22, 19, 22, 21, 22, 19, 21, 21, 21, 19, 21, 21, 25, 21, 22, 22, 22, 21, 22, 22, 29, 19, 22, 21, 22, 19, 22, 21, 26,
+    19, 22, 21, 22, 19, 22, 21, 27, 19, 21, 21, 25, 19, 21, 24, 25, 21, 22, 22, 22, 21, 27, 22, 29, 19, 22, 21, 26, 19, 22, 21, 29,
+    19, 21, 19, 22, 19, 21, 19, 22, 19, 19, 19, 21, 19, 19, 19, 25, 21, 21, 21, 22, 21, 25, 21, 26, 19, 21, 19, 22, 19, 25, 19, 28,
+    19, 21, 19, 22, 19, 21, 19, 22, 19, 19, 19, 21, 19, 19, 19, 25, 21, 25, 21, 26, 24, 25, 21, 29, 19, 21, 19, 22, 19, 25, 19, 28,
+    19, 22, 19, 22, 19, 22, 19, 22, 19, 21, 19, 21, 18, 21, 20, 24, 19, 22, 19, 22, 19, 22, 19, 29, 19, 21, 19, 21, 19, 21, 20, 25,
+    19, 22, 19, 22, 19, 22, 19, 22, 19, 21, 19, 25, 18, 21, 20, 24, 19, 22, 19, 22, 19, 22, 19, 29, 19, 21, 19, 25, 18, 21, 20, 24,
+    19, 21, 19, 21, 18, 21, 19, 21, 16, 19, 16, 19, 19, 19, 19, 21, 19, 21, 19, 21, 20, 24, 20, 25, 16, 19, 16, 19, 19, 21, 19, 22,
+    19, 21, 19, 21, 18, 21, 18, 21, 16, 16, 16, 16, 19, 19, 20, 21, 19, 25, 19, 25, 20, 24, 20, 24, 16, 16, 16, 16, 20, 21, 19, 23,
+    15, 8, 15, 7, 15, 7, 14, 7, 15, 10, 15, 7, 15, 7, 13, 7, 12, 8, 12, 6, 12, 6, 11, 8, 14, 10, 13, 10, 13, 10, 7, 7,
+    14, 8, 12, 7, 12, 8, 11, 7, 15, 10, 15, 10, 14, 7, 13, 7, 11, 8, 12, 9, 10, 8, 11, 8, 13, 10, 13, 10, 11, 7, 7, 30,
+    14, 8, 12, 8, 12, 7, 11, 7, 15, 10, 14, 7, 15, 10, 13, 7, 11, 8, 10, 8, 12, 9, 11, 8, 13, 10, 11, 7, 13, 10, 7, 30,
+    15, 8, 12, 9, 12, 9, 11, 7, 14, 10, 13, 7, 13, 7, 7, 29, 9, 8, 10, 8, 10, 8, 11, 30, 11, 10, 11, 29, 11, 29, 7, 31,
+    15, 8, 15, 9, 15, 9, 14, 7, 15, 10, 15, 7, 15, 7, 13, 7, 14, 8, 12, 9, 12, 9, 11, 7, 14, 10, 13, 10, 13, 10, 7, 28,
+    15, 8, 12, 9, 12, 9, 11, 19, 14, 10, 15, 18, 14, 17, 18, 20, 13, 8, 12, 9, 10, 9, 19, 19, 13, 19, 19, 21, 11, 19, 19, 27,
+    15, 8, 12, 9, 12, 9, 11, 19, 14, 10, 14, 17, 15, 18, 18, 20, 13, 8, 10, 9, 12, 9, 19, 19, 13, 19, 11, 19, 19, 21, 19, 27,
+    14, 8, 12, 17, 12, 17, 17, 17, 14, 17, 17, 18, 17, 18, 17, 25, 11, 20, 18, 20, 18, 20, 20, 20, 17, 20, 18, 20, 18, 20, 20, 24,
+    12, 8, 12, 6, 12, 6, 11, 8, 14, 10, 13, 10, 13, 10, 7, 7, 12, 6, 7, 6, 7, 6, 8, 31, 14, 7, 11, 31, 11, 31, 16, 31,
+    13, 6, 7, 7, 11, 5, 8, 8, 14, 12, 13, 12, 14, 16, 11, 30, 10, 6, 7, 6, 8, 5, 8, 31, 13, 18, 25, 28, 17, 31, 25, 31,
+    13, 6, 11, 5, 7, 7, 8, 8, 14, 12, 14, 16, 13, 12, 11, 30, 10, 6, 8, 5, 7, 6, 8, 31, 13, 18, 17, 31, 25, 28, 25, 31,
+    12, 9, 11, 5, 11, 5, 8, 31, 15, 16, 16, 29, 16, 29, 16, 30, 9, 9, 8, 28, 8, 28, 26, 31, 16, 27, 25, 28, 25, 28, 26, 31,
+    15, 9, 14, 7, 14, 7, 14, 16, 14, 7, 14, 16, 14, 16, 13, 28, 12, 9, 11, 7, 11, 7, 16, 31, 14, 16, 16, 16, 16, 16, 16, 31,
+    12, 9, 11, 19, 11, 16, 16, 19, 14, 16, 18, 21, 17, 17, 18, 20, 10, 9, 19, 19, 16, 19, 19, 28, 16, 19, 19, 21, 16, 19, 19, 29,
+    12, 9, 11, 16, 11, 19, 16, 19, 14, 16, 17, 17, 18, 21, 18, 20, 10, 9, 16, 19, 19, 19, 19, 28, 16, 19, 16, 19, 19, 21, 19, 29,
+    12, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 17, 18, 17, 25, 17, 20, 18, 20, 18, 20, 20, 27, 17, 20, 18, 25, 18, 25, 20, 24,
+    14, 8, 12, 7, 12, 8, 11, 7, 15, 10, 15, 10, 14, 7, 13, 7, 13, 6, 7, 7, 11, 5, 8, 8, 14, 12, 13, 12, 14, 16, 11, 30,
+    14, 6, 15, 7, 14, 3, 14, 20, 15, 12, 15, 23, 14, 17, 20, 23, 11, 6, 11, 7, 13, 18, 20, 26, 13, 18, 20, 27, 17, 18, 20, 29,
+    14, 10, 13, 6, 13, 6, 14, 16, 15, 12, 15, 27, 15, 27, 13, 29, 13, 9, 11, 5, 11, 6, 25, 28, 15, 10, 12, 29, 25, 28, 25, 30,
+    14, 10, 13, 20, 15, 17, 20, 20, 15, 17, 14, 23, 14, 17, 20, 23, 11, 9, 11, 26, 17, 29, 25, 28, 12, 18, 20, 27, 17, 29, 20, 31,
+    15, 10, 15, 7, 14, 7, 14, 16, 15, 12, 15, 16, 14, 16, 13, 28, 14, 10, 13, 10, 14, 16, 16, 16, 15, 16, 13, 16, 16, 16, 16, 28,
+    14, 10, 15, 18, 14, 16, 18, 21, 15, 17, 19, 22, 17, 17, 19, 22, 13, 19, 19, 21, 16, 19, 19, 21, 16, 19, 19, 22, 17, 18, 19, 22,
+    14, 10, 15, 16, 15, 16, 16, 16, 15, 16, 14, 17, 18, 18, 18, 20, 14, 16, 12, 16, 19, 19, 19, 19, 16, 16, 16, 16, 19, 21, 19, 27,
+    14, 16, 16, 19, 16, 17, 17, 17, 17, 17, 19, 21, 17, 17, 19, 21, 17, 18, 18, 18, 18, 20, 20, 20, 17, 18, 18, 21, 18, 20, 20, 24,
+    11, 8, 12, 9, 10, 8, 11, 8, 13, 10, 13, 10, 11, 7, 7, 30, 10, 6, 7, 6, 8, 5, 8, 31, 13, 18, 25, 28, 17, 31, 25, 31,
+    11, 6, 11, 7, 13, 18, 20, 26, 13, 18, 20, 27, 17, 18, 20, 29, 7, 6, 7, 27, 17, 31, 25, 30, 17, 20, 20, 27, 17, 20, 20, 30,
+    13, 9, 11, 6, 11, 5, 25, 28, 15, 10, 25, 28, 12, 29, 25, 30, 12, 5, 6, 28, 6, 28, 25, 31, 17, 17, 25, 28, 25, 28, 25, 31,
+    12, 6, 20, 26, 17, 17, 20, 26, 17, 17, 20, 27, 17, 17, 20, 29, 10, 5, 25, 27, 25, 28, 25, 30, 17, 18, 20, 27, 17, 29, 25, 30,
+    15, 7, 13, 7, 14, 16, 13, 28, 14, 16, 13, 28, 14, 16, 11, 30, 13, 10, 7, 28, 16, 16, 16, 31, 16, 16, 16, 28, 16, 16, 16, 31,
+    14, 17, 18, 20, 17, 17, 18, 20, 17, 17, 19, 22, 17, 17, 19, 22, 11, 19, 19, 27, 16, 19, 19, 29, 17, 18, 19, 22, 17, 19, 19, 29,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18, 26, 12, 16, 16, 16, 19, 19, 19, 28, 16, 16, 16, 16, 19, 21, 19, 29,
+    16, 16, 18, 18, 16, 16, 17, 19, 17, 17, 19, 21, 17, 17, 19, 21, 17, 18, 18, 18, 18, 20, 20, 27, 17, 18, 19, 21, 18, 20, 20, 25,
+    14, 8, 12, 8, 12, 7, 11, 7, 15, 10, 14, 7, 15, 10, 13, 7, 13, 6, 11, 5, 7, 7, 8, 8, 14, 12, 14, 16, 13, 12, 11, 30,
+    14, 10, 13, 6, 13, 6, 14, 16, 15, 12, 15, 27, 15, 27, 13, 29, 13, 9, 11, 6, 11, 5, 25, 28, 15, 10, 25, 28, 12, 29, 25, 30,
+    14, 6, 14, 3, 15, 7, 14, 20, 15, 12, 14, 17, 15, 23, 20, 23, 11, 6, 13, 18, 11, 7, 20, 26, 13, 18, 17, 18, 20, 27, 20, 29,
+    14, 10, 15, 17, 13, 20, 20, 20, 15, 17, 14, 17, 14, 23, 20, 23, 11, 9, 17, 29, 11, 26, 25, 28, 12, 18, 17, 29, 20, 27, 20, 31,
+    15, 10, 14, 7, 15, 7, 14, 16, 15, 12, 14, 16, 15, 16, 13, 28, 14, 10, 14, 16, 13, 10, 16, 16, 15, 16, 16, 16, 13, 16, 16, 28,
+    14, 10, 15, 16, 15, 16, 16, 16, 15, 16, 18, 18, 14, 17, 18, 20, 14, 16, 19, 19, 12, 16, 19, 19, 16, 16, 19, 21, 16, 16, 19, 27,
+    14, 10, 14, 16, 15, 18, 18, 21, 15, 17, 17, 17, 19, 22, 19, 22, 13, 19, 16, 19, 19, 21, 19, 21, 16, 19, 17, 18, 19, 22, 19, 22,
+    14, 16, 16, 17, 16, 19, 17, 17, 17, 17, 17, 17, 19, 21, 19, 21, 17, 18, 18, 20, 18, 18, 20, 20, 17, 18, 18, 20, 18, 21, 20, 24,
+    11, 8, 10, 8, 12, 9, 11, 8, 13, 10, 11, 7, 13, 10, 7, 30, 10, 6, 8, 5, 7, 6, 8, 31, 13, 18, 17, 31, 25, 28, 25, 31,
+    13, 9, 11, 5, 11, 6, 25, 28, 15, 10, 12, 29, 25, 28, 25, 30, 12, 5, 6, 28, 6, 28, 25, 31, 17, 17, 25, 28, 25, 28, 25, 31,
+    11, 6, 13, 18, 11, 7, 20, 26, 13, 18, 17, 18, 20, 27, 20, 29, 7, 6, 17, 31, 7, 27, 25, 30, 17, 20, 17, 20, 20, 27, 20, 30,
+    12, 6, 17, 17, 20, 26, 20, 26, 17, 17, 17, 17, 20, 27, 20, 29, 10, 5, 25, 28, 25, 27, 25, 30, 17, 18, 17, 29, 20, 27, 25, 30,
+    15, 7, 14, 16, 13, 7, 13, 28, 14, 16, 14, 16, 13, 28, 11, 30, 13, 10, 16, 16, 7, 28, 16, 31, 16, 16, 16, 16, 16, 28, 16, 31,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 16, 16, 18, 26, 12, 16, 19, 19, 16, 16, 19, 28, 16, 16, 19, 21, 16, 16, 19, 29,
+    14, 17, 17, 17, 18, 20, 18, 20, 17, 17, 17, 17, 19, 22, 19, 22, 11, 19, 16, 19, 19, 27, 19, 29, 17, 18, 17, 19, 19, 22, 19, 29,
+    16, 16, 16, 16, 18, 18, 17, 19, 17, 17, 17, 17, 19, 21, 19, 21, 17, 18, 18, 20, 18, 18, 20, 27, 17, 18, 18, 20, 19, 21, 20, 25,
+    15, 8, 12, 9, 12, 9, 11, 7, 14, 10, 13, 7, 13, 7, 7, 29, 12, 9, 11, 5, 11, 5, 8, 31, 15, 16, 16, 29, 16, 29, 16, 30,
+    14, 10, 13, 20, 15, 17, 20, 20, 15, 17, 14, 23, 14, 17, 20, 23, 12, 6, 20, 26, 17, 17, 20, 26, 17, 17, 20, 27, 17, 17, 20, 29,
+    14, 10, 15, 17, 13, 20, 20, 20, 15, 17, 14, 17, 14, 23, 20, 23, 12, 6, 17, 17, 20, 26, 20, 26, 17, 17, 17, 17, 20, 27, 20, 29,
+    15, 12, 20, 20, 20, 20, 20, 20, 15, 17, 20, 23, 20, 23, 20, 29, 12, 9, 20, 26, 20, 26, 20, 30, 17, 17, 20, 27, 20, 27, 20, 31,
+    15, 12, 14, 16, 14, 16, 14, 16, 15, 16, 14, 27, 14, 27, 13, 29, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 28,
+    15, 16, 18, 18, 16, 16, 18, 18, 15, 17, 19, 22, 17, 17, 19, 22, 16, 16, 19, 21, 16, 16, 19, 21, 16, 16, 19, 22, 16, 17, 19, 22,
+    15, 16, 16, 16, 18, 18, 18, 18, 15, 17, 17, 17, 19, 22, 19, 22, 16, 16, 16, 16, 19, 21, 19, 21, 16, 16, 16, 17, 19, 22, 19, 22,
+    16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 19, 21, 19, 21, 19, 25, 17, 17, 18, 18, 18, 18, 20, 20, 17, 17, 18, 21, 18, 21, 20, 24,
+    9, 8, 10, 8, 10, 8, 11, 30, 11, 10, 11, 29, 11, 29, 7, 31, 9, 9, 8, 28, 8, 28, 26, 31, 16, 27, 25, 28, 25, 28, 26, 31,
+    11, 9, 11, 26, 17, 29, 25, 28, 12, 18, 20, 27, 17, 29, 20, 31, 10, 5, 25, 27, 25, 28, 25, 30, 17, 18, 20, 27, 17, 29, 25, 30,
+    11, 9, 17, 29, 11, 26, 25, 28, 12, 18, 17, 29, 20, 27, 20, 31, 10, 5, 25, 28, 25, 27, 25, 30, 17, 18, 17, 29, 20, 27, 25, 30,
+    12, 9, 20, 26, 20, 26, 20, 30, 17, 17, 20, 27, 20, 27, 20, 31, 12, 3, 25, 27, 25, 27, 25, 30, 17, 17, 20, 27, 20, 27, 20, 31,
+    15, 16, 13, 28, 13, 28, 11, 30, 14, 27, 13, 29, 13, 29, 7, 31, 13, 16, 16, 28, 16, 28, 16, 31, 16, 16, 16, 28, 16, 28, 16, 31,
+    14, 17, 18, 20, 16, 16, 18, 26, 17, 17, 19, 22, 17, 17, 19, 22, 16, 16, 19, 27, 16, 16, 19, 29, 16, 17, 19, 22, 16, 16, 19, 29,
+    14, 17, 16, 16, 18, 20, 18, 26, 17, 17, 17, 17, 19, 22, 19, 22, 16, 16, 16, 16, 19, 27, 19, 29, 16, 17, 16, 16, 19, 22, 19, 29,
+    16, 16, 16, 18, 16, 18, 16, 16, 17, 17, 19, 21, 19, 21, 19, 25, 17, 17, 18, 18, 18, 18, 20, 27, 17, 17, 18, 21, 18, 21, 20, 24,
+    15, 8, 15, 9, 15, 9, 14, 7, 15, 10, 15, 7, 15, 7, 13, 7, 15, 9, 14, 7, 14, 7, 14, 16, 14, 7, 14, 16, 14, 16, 13, 28,
+    15, 10, 15, 7, 14, 7, 14, 16, 15, 12, 15, 16, 14, 16, 13, 28, 15, 7, 13, 7, 14, 16, 13, 28, 14, 16, 13, 28, 14, 16, 11, 30,
+    15, 10, 14, 7, 15, 7, 14, 16, 15, 12, 14, 16, 15, 16, 13, 28, 15, 7, 14, 16, 13, 7, 13, 28, 14, 16, 14, 16, 13, 28, 11, 30,
+    15, 12, 14, 16, 14, 16, 14, 16, 15, 16, 14, 27, 14, 27, 13, 29, 15, 16, 13, 28, 13, 28, 11, 30, 14, 27, 13, 29, 13, 29, 7, 31,
+    15, 16, 15, 16, 15, 16, 14, 16, 15, 16, 15, 16, 15, 16, 16, 19, 15, 16, 14, 16, 14, 16, 16, 16, 14, 16, 16, 16, 16, 16, 16, 19,
+    15, 16, 15, 16, 14, 16, 16, 16, 15, 16, 17, 17, 16, 16, 17, 18, 15, 16, 16, 19, 16, 16, 16, 19, 16, 16, 17, 18, 16, 16, 17, 20,
+    15, 16, 14, 16, 15, 16, 16, 16, 15, 16, 16, 16, 17, 17, 17, 18, 15, 16, 16, 16, 16, 19, 16, 19, 16, 16, 16, 16, 17, 18, 17, 20,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 18, 17, 17, 17, 18, 17, 18, 17, 20, 17, 17, 17, 18, 17, 18, 17, 24,
+    14, 8, 12, 9, 12, 9, 11, 7, 14, 10, 13, 10, 13, 10, 7, 28, 12, 9, 11, 7, 11, 7, 16, 31, 14, 16, 16, 16, 16, 16, 16, 31,
+    14, 10, 13, 10, 14, 16, 16, 16, 15, 16, 13, 16, 16, 16, 16, 28, 13, 10, 7, 28, 16, 16, 16, 31, 16, 16, 16, 28, 16, 16, 16, 31,
+    14, 10, 14, 16, 13, 10, 16, 16, 15, 16, 16, 16, 13, 16, 16, 28, 13, 10, 16, 16, 7, 28, 16, 31, 16, 16, 16, 16, 16, 28, 16, 31,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 28, 13, 16, 16, 28, 16, 28, 16, 31, 16, 16, 16, 28, 16, 28, 16, 31,
+    15, 16, 14, 16, 14, 16, 16, 16, 14, 16, 16, 16, 16, 16, 16, 19, 14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 19,
+    14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 16, 16, 17, 18, 16, 16, 16, 19, 16, 16, 16, 19, 16, 16, 17, 18, 16, 16, 17, 20,
+    14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 18, 16, 16, 16, 16, 16, 19, 16, 19, 16, 16, 16, 16, 17, 18, 17, 20,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18, 17, 17, 17, 18, 17, 18, 17, 20, 17, 17, 17, 18, 17, 18, 17, 24,
+    15, 8, 12, 9, 12, 9, 11, 19, 14, 10, 15, 18, 14, 17, 18, 20, 12, 9, 11, 19, 11, 16, 16, 19, 14, 16, 18, 21, 17, 17, 18, 20,
+    14, 10, 15, 18, 14, 16, 18, 21, 15, 17, 19, 22, 17, 17, 19, 22, 14, 17, 18, 20, 17, 17, 18, 20, 17, 17, 19, 22, 17, 17, 19, 22,
+    14, 10, 15, 16, 15, 16, 16, 16, 15, 16, 18, 18, 14, 17, 18, 20, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 16, 16, 18, 26,
+    15, 16, 18, 18, 16, 16, 18, 18, 15, 17, 19, 22, 17, 17, 19, 22, 14, 17, 18, 20, 16, 16, 18, 26, 17, 17, 19, 22, 17, 17, 19, 22,
+    15, 16, 15, 16, 14, 16, 16, 16, 15, 16, 17, 17, 16, 16, 17, 18, 14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 16, 16, 17, 18,
+    15, 16, 17, 17, 16, 16, 17, 17, 16, 16, 16, 16, 16, 16, 16, 22, 16, 16, 17, 18, 16, 16, 17, 18, 16, 16, 16, 22, 16, 16, 16, 23,
+    15, 16, 15, 16, 15, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18,
+    16, 16, 17, 17, 16, 16, 17, 17, 16, 16, 16, 17, 16, 17, 17, 18, 17, 17, 17, 18, 17, 17, 17, 18, 16, 17, 17, 18, 17, 17, 17, 20,
+    13, 8, 12, 9, 10, 9, 19, 19, 13, 19, 19, 21, 11, 19, 19, 27, 10, 9, 19, 19, 16, 19, 19, 28, 16, 19, 19, 21, 16, 19, 19, 29,
+    13, 19, 19, 21, 16, 19, 19, 21, 16, 19, 19, 22, 17, 18, 19, 22, 11, 19, 19, 27, 16, 19, 19, 29, 17, 18, 19, 22, 17, 19, 19, 29,
+    14, 16, 19, 19, 12, 16, 19, 19, 16, 16, 19, 21, 16, 16, 19, 27, 12, 16, 19, 19, 16, 16, 19, 28, 16, 16, 19, 21, 16, 16, 19, 29,
+    16, 16, 19, 21, 16, 16, 19, 21, 16, 16, 19, 22, 16, 17, 19, 22, 16, 16, 19, 27, 16, 16, 19, 29, 16, 17, 19, 22, 16, 16, 19, 29,
+    15, 16, 16, 19, 16, 16, 16, 19, 16, 16, 17, 18, 16, 16, 17, 20, 16, 16, 16, 19, 16, 16, 16, 19, 16, 16, 17, 18, 16, 16, 17, 20,
+    16, 16, 17, 18, 16, 16, 17, 18, 16, 16, 16, 22, 16, 16, 16, 23, 16, 16, 17, 20, 16, 16, 17, 20, 16, 16, 16, 23, 16, 16, 16, 23,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18,
+    16, 16, 17, 17, 16, 16, 17, 17, 16, 16, 16, 16, 16, 16, 17, 21, 17, 17, 17, 18, 17, 17, 17, 18, 16, 16, 17, 21, 17, 17, 17, 20,
+    15, 8, 12, 9, 12, 9, 11, 19, 14, 10, 14, 17, 15, 18, 18, 20, 12, 9, 11, 16, 11, 19, 16, 19, 14, 16, 17, 17, 18, 21, 18, 20,
+    14, 10, 15, 16, 15, 16, 16, 16, 15, 16, 14, 17, 18, 18, 18, 20, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18, 26,
+    14, 10, 14, 16, 15, 18, 18, 21, 15, 17, 17, 17, 19, 22, 19, 22, 14, 17, 17, 17, 18, 20, 18, 20, 17, 17, 17, 17, 19, 22, 19, 22,
+    15, 16, 16, 16, 18, 18, 18, 18, 15, 17, 17, 17, 19, 22, 19, 22, 14, 17, 16, 16, 18, 20, 18, 26, 17, 17, 17, 17, 19, 22, 19, 22,
+    15, 16, 14, 16, 15, 16, 16, 16, 15, 16, 16, 16, 17, 17, 17, 18, 14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 18,
+    15, 16, 15, 16, 15, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18,
+    15, 16, 16, 16, 17, 17, 17, 17, 16, 16, 16, 16, 16, 16, 16, 22, 16, 16, 16, 16, 17, 18, 17, 18, 16, 16, 16, 16, 16, 22, 16, 23,
+    16, 16, 16, 16, 17, 17, 17, 17, 16, 16, 16, 17, 16, 17, 17, 18, 17, 17, 17, 17, 17, 18, 17, 18, 16, 17, 17, 17, 17, 18, 17, 20,
+    13, 8, 10, 9, 12, 9, 19, 19, 13, 19, 11, 19, 19, 21, 19, 27, 10, 9, 16, 19, 19, 19, 19, 28, 16, 19, 16, 19, 19, 21, 19, 29,
+    14, 16, 12, 16, 19, 19, 19, 19, 16, 16, 16, 16, 19, 21, 19, 27, 12, 16, 16, 16, 19, 19, 19, 28, 16, 16, 16, 16, 19, 21, 19, 29,
+    13, 19, 16, 19, 19, 21, 19, 21, 16, 19, 17, 18, 19, 22, 19, 22, 11, 19, 16, 19, 19, 27, 19, 29, 17, 18, 17, 19, 19, 22, 19, 29,
+    16, 16, 16, 16, 19, 21, 19, 21, 16, 16, 16, 17, 19, 22, 19, 22, 16, 16, 16, 16, 19, 27, 19, 29, 16, 17, 16, 16, 19, 22, 19, 29,
+    15, 16, 16, 16, 16, 19, 16, 19, 16, 16, 16, 16, 17, 18, 17, 20, 16, 16, 16, 16, 16, 19, 16, 19, 16, 16, 16, 16, 17, 18, 17, 20,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18,
+    16, 16, 16, 16, 17, 18, 17, 18, 16, 16, 16, 16, 16, 22, 16, 23, 16, 16, 16, 16, 17, 20, 17, 20, 16, 16, 16, 16, 16, 23, 16, 23,
+    16, 16, 16, 16, 17, 17, 17, 17, 16, 16, 16, 16, 16, 16, 17, 21, 17, 17, 17, 17, 17, 18, 17, 18, 16, 16, 17, 17, 17, 21, 17, 20,
+    14, 8, 12, 17, 12, 17, 17, 17, 14, 17, 17, 18, 17, 18, 17, 25, 12, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 17, 18, 17, 25,
+    14, 16, 16, 19, 16, 17, 17, 17, 17, 17, 19, 21, 17, 17, 19, 21, 16, 16, 18, 18, 16, 16, 17, 19, 17, 17, 19, 21, 17, 17, 19, 21,
+    14, 16, 16, 17, 16, 19, 17, 17, 17, 17, 17, 17, 19, 21, 19, 21, 16, 16, 16, 16, 18, 18, 17, 19, 17, 17, 17, 17, 19, 21, 19, 21,
+    16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 19, 21, 19, 21, 19, 25, 16, 16, 16, 18, 16, 18, 16, 16, 17, 17, 19, 21, 19, 21, 19, 25,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 18, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18,
+    16, 16, 17, 17, 16, 16, 17, 17, 16, 16, 16, 17, 16, 17, 17, 18, 16, 16, 17, 17, 16, 16, 17, 17, 16, 16, 16, 16, 16, 16, 17, 21,
+    16, 16, 16, 16, 17, 17, 17, 17, 16, 16, 16, 17, 16, 17, 17, 18, 16, 16, 16, 16, 17, 17, 17, 17, 16, 16, 16, 16, 16, 16, 17, 21,
+    16, 16, 17, 17, 17, 17, 17, 17, 16, 16, 16, 16, 16, 16, 16, 19, 17, 17, 17, 17, 17, 17, 17, 17, 16, 16, 16, 17, 16, 17, 17, 18,
+    11, 20, 18, 20, 18, 20, 20, 20, 17, 20, 18, 20, 18, 20, 20, 24, 17, 20, 18, 20, 18, 20, 20, 27, 17, 20, 18, 25, 18, 25, 20, 24,
+    17, 18, 18, 18, 18, 20, 20, 20, 17, 18, 18, 21, 18, 20, 20, 24, 17, 18, 18, 18, 18, 20, 20, 27, 17, 18, 19, 21, 18, 20, 20, 25,
+    17, 18, 18, 20, 18, 18, 20, 20, 17, 18, 18, 20, 18, 21, 20, 24, 17, 18, 18, 20, 18, 18, 20, 27, 17, 18, 18, 20, 19, 21, 20, 25,
+    17, 17, 18, 18, 18, 18, 20, 20, 17, 17, 18, 21, 18, 21, 20, 24, 17, 17, 18, 18, 18, 18, 20, 27, 17, 17, 18, 21, 18, 21, 20, 24,
+    17, 17, 17, 18, 17, 18, 17, 20, 17, 17, 17, 18, 17, 18, 17, 24, 17, 17, 17, 18, 17, 18, 17, 20, 17, 17, 17, 18, 17, 18, 17, 24,
+    17, 17, 17, 18, 17, 17, 17, 18, 16, 17, 17, 18, 17, 17, 17, 20, 17, 17, 17, 18, 17, 17, 17, 18, 16, 16, 17, 21, 17, 17, 17, 20,
+    17, 17, 17, 17, 17, 18, 17, 18, 16, 17, 17, 17, 17, 18, 17, 20, 17, 17, 17, 17, 17, 18, 17, 18, 16, 16, 17, 17, 17, 21, 17, 20,
+    17, 17, 17, 17, 17, 17, 17, 17, 16, 16, 16, 17, 16, 17, 17, 18, 17, 17, 17, 17, 17, 17, 17, 17, 16, 16, 16, 16, 16, 16, 17, 19,
+    12, 8, 10, 6, 10, 6, 8, 8, 14, 9, 14, 9, 14, 9, 11, 16, 12, 8, 10, 6, 10, 6, 8, 19, 14, 9, 12, 19, 12, 19, 19, 19,
+    13, 8, 10, 7, 10, 8, 8, 18, 14, 9, 14, 17, 13, 17, 17, 17, 10, 8, 10, 20, 9, 21, 20, 27, 13, 21, 20, 26, 18, 21, 20, 26,
+    13, 8, 10, 8, 10, 7, 8, 18, 14, 9, 13, 17, 14, 17, 17, 17, 10, 8, 9, 21, 10, 20, 20, 27, 13, 21, 18, 21, 20, 26, 20, 26,
+    12, 8, 10, 8, 10, 8, 17, 18, 14, 17, 13, 17, 13, 17, 17, 17, 9, 22, 21, 22, 21, 22, 22, 22, 19, 22, 21, 22, 21, 22, 22, 22,
+    15, 8, 12, 9, 12, 9, 11, 16, 14, 10, 15, 16, 15, 16, 16, 16, 13, 8, 10, 9, 10, 9, 16, 19, 14, 16, 12, 16, 12, 16, 16, 16,
+    14, 8, 12, 17, 12, 16, 17, 17, 14, 16, 16, 19, 16, 16, 18, 18, 11, 20, 18, 20, 17, 20, 18, 20, 17, 18, 18, 18, 17, 18, 18, 18,
+    14, 8, 12, 16, 12, 17, 17, 17, 14, 16, 16, 16, 16, 19, 18, 18, 11, 20, 17, 20, 18, 20, 18, 20, 17, 18, 17, 18, 18, 18, 18, 18,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 23, 19, 22, 19, 22, 21, 23, 17, 20, 18, 21, 18, 21, 20, 20,
+    12, 8, 10, 6, 10, 6, 8, 19, 14, 9, 12, 19, 12, 19, 19, 19, 12, 6, 7, 6, 7, 6, 19, 28, 19, 19, 19, 28, 19, 28, 19, 28,
+    12, 6, 7, 6, 11, 19, 18, 19, 15, 19, 18, 18, 18, 19, 18, 18, 10, 21, 21, 27, 19, 26, 21, 29, 19, 21, 21, 27, 19, 26, 21, 29,
+    12, 6, 11, 19, 7, 6, 18, 19, 15, 19, 18, 19, 18, 18, 18, 18, 10, 21, 19, 26, 21, 27, 21, 29, 19, 21, 19, 26, 21, 27, 21, 29,
+    12, 9, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 22, 21, 22, 21, 22, 22, 29, 19, 22, 21, 27, 21, 27, 22, 29,
+    12, 9, 11, 19, 11, 19, 16, 19, 15, 16, 16, 16, 16, 16, 16, 16, 12, 9, 19, 19, 19, 19, 19, 28, 19, 19, 19, 19, 19, 19, 19, 28,
+    12, 17, 17, 17, 17, 17, 17, 17, 16, 17, 17, 17, 16, 16, 17, 19, 18, 20, 20, 20, 18, 20, 20, 27, 18, 20, 20, 20, 18, 20, 20, 27,
+    12, 17, 17, 17, 17, 17, 17, 17, 16, 17, 16, 16, 17, 17, 17, 19, 18, 20, 18, 20, 20, 20, 20, 27, 18, 20, 18, 20, 20, 20, 20, 27,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 19, 22, 21, 23, 21, 23, 22, 23, 17, 23, 19, 22, 19, 22, 20, 23,
+    13, 8, 10, 7, 10, 8, 8, 18, 14, 9, 14, 17, 13, 17, 17, 17, 12, 6, 7, 6, 11, 19, 18, 19, 15, 19, 18, 18, 18, 19, 18, 18,
+    13, 6, 7, 7, 17, 18, 17, 24, 15, 17, 14, 20, 17, 17, 20, 20, 11, 20, 20, 25, 18, 20, 20, 25, 18, 20, 24, 25, 18, 20, 24, 25,
+    13, 10, 11, 18, 11, 18, 17, 18, 15, 17, 17, 17, 17, 17, 17, 17, 13, 19, 19, 19, 19, 21, 19, 21, 19, 19, 19, 19, 20, 21, 19, 27,
+    13, 18, 11, 18, 17, 18, 17, 18, 17, 17, 17, 20, 17, 17, 17, 20, 19, 21, 21, 21, 19, 22, 21, 22, 19, 21, 21, 25, 19, 22, 21, 26,
+    14, 10, 14, 17, 14, 16, 17, 17, 15, 16, 14, 17, 16, 16, 16, 16, 13, 19, 11, 19, 16, 19, 16, 19, 16, 16, 16, 16, 16, 16, 16, 16,
+    14, 17, 17, 18, 17, 17, 17, 18, 17, 17, 19, 21, 17, 17, 19, 21, 17, 20, 18, 20, 17, 20, 18, 25, 17, 18, 18, 21, 17, 18, 19, 21,
+    14, 16, 16, 16, 16, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 17, 18, 17, 18, 18, 20, 18, 20, 17, 17, 17, 17, 18, 18, 18, 18,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 19, 16, 16, 16, 19, 17, 20, 18, 21, 17, 23, 19, 22, 17, 18, 19, 19, 18, 21, 19, 21,
+    10, 8, 10, 20, 9, 21, 20, 27, 13, 21, 20, 26, 18, 21, 20, 26, 10, 21, 21, 27, 19, 26, 21, 29, 19, 21, 21, 27, 19, 26, 21, 29,
+    11, 20, 20, 25, 18, 20, 20, 25, 18, 20, 24, 25, 18, 20, 24, 25, 18, 25, 24, 24, 19, 25, 24, 25, 18, 25, 24, 24, 18, 25, 24, 24,
+    13, 19, 19, 21, 19, 19, 19, 21, 19, 19, 20, 21, 19, 19, 19, 27, 19, 19, 19, 27, 19, 27, 19, 29, 19, 19, 19, 27, 19, 27, 19, 29,
+    18, 18, 20, 25, 18, 18, 20, 25, 18, 18, 20, 25, 18, 18, 20, 25, 19, 21, 21, 25, 19, 22, 21, 26, 19, 21, 24, 25, 19, 22, 21, 29,
+    15, 18, 18, 20, 18, 21, 18, 20, 18, 18, 18, 20, 18, 18, 18, 26, 19, 21, 19, 27, 19, 21, 19, 29, 19, 21, 19, 27, 19, 21, 19, 29,
+    17, 18, 17, 25, 17, 18, 17, 25, 17, 17, 19, 21, 17, 17, 19, 21, 18, 20, 20, 24, 18, 25, 20, 24, 18, 20, 20, 24, 18, 20, 20, 25,
+    16, 19, 18, 18, 17, 17, 17, 19, 16, 16, 16, 18, 16, 17, 16, 16, 18, 18, 18, 18, 20, 20, 20, 27, 18, 18, 18, 18, 20, 20, 20, 27,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 19, 16, 16, 16, 19, 18, 21, 20, 20, 19, 22, 20, 23, 18, 21, 19, 21, 18, 23, 19, 22,
+    13, 8, 10, 8, 10, 7, 8, 18, 14, 9, 13, 17, 14, 17, 17, 17, 12, 6, 11, 19, 7, 6, 18, 19, 15, 19, 18, 19, 18, 18, 18, 18,
+    13, 10, 11, 18, 11, 18, 17, 18, 15, 17, 17, 17, 17, 17, 17, 17, 13, 19, 19, 21, 19, 19, 19, 21, 19, 19, 20, 21, 19, 19, 19, 27,
+    13, 6, 17, 18, 7, 7, 17, 24, 15, 17, 17, 17, 14, 20, 20, 20, 11, 20, 18, 20, 20, 25, 20, 25, 18, 20, 18, 20, 24, 25, 24, 25,
+    13, 18, 17, 18, 11, 18, 17, 18, 17, 17, 17, 17, 17, 20, 17, 20, 19, 21, 19, 22, 21, 21, 21, 22, 19, 21, 19, 22, 21, 25, 21, 26,
+    14, 10, 14, 16, 14, 17, 17, 17, 15, 16, 16, 16, 14, 17, 16, 16, 13, 19, 16, 19, 11, 19, 16, 19, 16, 16, 16, 16, 16, 16, 16, 16,
+    14, 16, 16, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 17, 18, 18, 20, 17, 18, 18, 20, 17, 17, 18, 18, 17, 17, 18, 18,
+    14, 17, 17, 17, 17, 18, 17, 18, 17, 17, 17, 17, 19, 21, 19, 21, 17, 20, 17, 20, 18, 20, 18, 25, 17, 18, 17, 18, 18, 21, 19, 21,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 19, 16, 19, 17, 20, 17, 23, 18, 21, 19, 22, 17, 18, 18, 21, 19, 19, 19, 21,
+    10, 8, 9, 21, 10, 20, 20, 27, 13, 21, 18, 21, 20, 26, 20, 26, 10, 21, 19, 26, 21, 27, 21, 29, 19, 21, 19, 26, 21, 27, 21, 29,
+    13, 19, 19, 19, 19, 21, 19, 21, 19, 19, 19, 19, 20, 21, 19, 27, 19, 19, 19, 27, 19, 27, 19, 29, 19, 19, 19, 27, 19, 27, 19, 29,
+    11, 20, 18, 20, 20, 25, 20, 25, 18, 20, 18, 20, 24, 25, 24, 25, 18, 25, 19, 25, 24, 24, 24, 25, 18, 25, 18, 25, 24, 24, 24, 24,
+    18, 18, 18, 18, 20, 25, 20, 25, 18, 18, 18, 18, 20, 25, 20, 25, 19, 21, 19, 22, 21, 25, 21, 26, 19, 21, 19, 22, 24, 25, 21, 29,
+    15, 18, 18, 21, 18, 20, 18, 20, 18, 18, 18, 18, 18, 20, 18, 26, 19, 21, 19, 21, 19, 27, 19, 29, 19, 21, 19, 21, 19, 27, 19, 29,
+    16, 19, 17, 17, 18, 18, 17, 19, 16, 16, 16, 17, 16, 18, 16, 16, 18, 18, 20, 20, 18, 18, 20, 27, 18, 18, 20, 20, 18, 18, 20, 27,
+    17, 18, 17, 18, 17, 25, 17, 25, 17, 17, 17, 17, 19, 21, 19, 21, 18, 20, 18, 25, 20, 24, 20, 24, 18, 20, 18, 20, 20, 24, 20, 25,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 19, 16, 19, 18, 21, 19, 22, 20, 20, 20, 23, 18, 21, 18, 23, 19, 21, 19, 22,
+    12, 8, 10, 8, 10, 8, 17, 18, 14, 17, 13, 17, 13, 17, 17, 17, 12, 9, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    13, 18, 11, 18, 17, 18, 17, 18, 17, 17, 17, 20, 17, 17, 17, 20, 18, 18, 20, 25, 18, 18, 20, 25, 18, 18, 20, 25, 18, 18, 20, 25,
+    13, 18, 17, 18, 11, 18, 17, 18, 17, 17, 17, 17, 17, 20, 17, 20, 18, 18, 18, 18, 20, 25, 20, 25, 18, 18, 18, 18, 20, 25, 20, 25,
+    17, 18, 17, 18, 17, 18, 17, 18, 17, 17, 17, 17, 17, 17, 17, 17, 19, 19, 19, 21, 19, 21, 19, 22, 19, 19, 19, 21, 19, 21, 19, 22,
+    15, 17, 17, 17, 17, 17, 17, 17, 15, 17, 17, 17, 17, 17, 17, 17, 16, 19, 17, 18, 17, 18, 17, 19, 16, 16, 16, 17, 16, 17, 16, 16,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 19, 21, 17, 17, 19, 21, 17, 18, 18, 20, 17, 18, 18, 20, 17, 17, 18, 21, 17, 17, 18, 21,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 19, 21, 19, 21, 17, 18, 17, 18, 18, 20, 18, 20, 17, 17, 17, 17, 18, 21, 18, 21,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 18, 18, 21, 18, 21, 18, 23, 17, 17, 19, 19, 19, 19, 20, 21,
+    9, 22, 21, 22, 21, 22, 22, 22, 19, 22, 21, 22, 21, 22, 22, 22, 19, 22, 21, 22, 21, 22, 22, 29, 19, 22, 21, 27, 21, 27, 22, 29,
+    19, 21, 21, 21, 19, 22, 21, 22, 19, 21, 21, 25, 19, 22, 21, 26, 19, 21, 21, 25, 19, 22, 21, 26, 19, 21, 24, 25, 19, 22, 21, 29,
+    19, 21, 19, 22, 21, 21, 21, 22, 19, 21, 19, 22, 21, 25, 21, 26, 19, 21, 19, 22, 21, 25, 21, 26, 19, 21, 19, 22, 24, 25, 21, 29,
+    19, 19, 19, 21, 19, 21, 19, 22, 19, 19, 19, 21, 19, 21, 19, 22, 19, 19, 19, 25, 19, 25, 19, 28, 19, 19, 19, 25, 19, 25, 19, 28,
+    19, 22, 19, 22, 19, 22, 19, 22, 19, 22, 19, 22, 19, 22, 19, 22, 19, 22, 19, 22, 19, 22, 19, 29, 19, 22, 19, 22, 19, 22, 19, 29,
+    19, 21, 19, 21, 19, 21, 19, 21, 19, 21, 19, 25, 19, 21, 19, 25, 18, 21, 20, 24, 19, 21, 20, 25, 18, 21, 20, 24, 18, 21, 20, 24,
+    19, 21, 19, 21, 19, 21, 19, 21, 19, 21, 19, 21, 19, 25, 19, 25, 18, 21, 19, 21, 20, 24, 20, 25, 18, 21, 18, 21, 20, 24, 20, 24,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 16, 16, 16, 16, 16, 16, 16, 19, 19, 19, 21, 19, 21, 19, 22, 19, 19, 20, 21, 20, 21, 19, 23,
+    15, 8, 12, 9, 12, 9, 11, 16, 14, 10, 15, 16, 15, 16, 16, 16, 12, 9, 11, 19, 11, 19, 16, 19, 15, 16, 16, 16, 16, 16, 16, 16,
+    14, 10, 14, 17, 14, 16, 17, 17, 15, 16, 14, 17, 16, 16, 16, 16, 15, 18, 18, 20, 18, 21, 18, 20, 18, 18, 18, 20, 18, 18, 18, 26,
+    14, 10, 14, 16, 14, 17, 17, 17, 15, 16, 16, 16, 14, 17, 16, 16, 15, 18, 18, 21, 18, 20, 18, 20, 18, 18, 18, 18, 18, 20, 18, 26,
+    15, 17, 17, 17, 17, 17, 17, 17, 15, 17, 17, 17, 17, 17, 17, 17, 19, 22, 19, 22, 19, 22, 19, 22, 19, 22, 19, 22, 19, 22, 19, 22,
+    15, 16, 14, 16, 14, 16, 16, 16, 15, 16, 15, 16, 15, 16, 16, 16, 15, 16, 16, 16, 16, 16, 16, 16, 15, 16, 16, 16, 16, 16, 16, 16,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 16, 16, 17, 17, 17, 17, 17, 18, 17, 17, 17, 18, 17, 17, 17, 18, 17, 17, 17, 18,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 17, 18, 17, 17, 17, 17, 17, 18, 17, 18,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 16, 17, 17, 17, 16, 16, 16, 22, 16, 22, 16, 23, 16, 17, 17, 18, 17, 18, 17, 20,
+    13, 8, 10, 9, 10, 9, 16, 19, 14, 16, 12, 16, 12, 16, 16, 16, 12, 9, 19, 19, 19, 19, 19, 28, 19, 19, 19, 19, 19, 19, 19, 28,
+    13, 19, 11, 19, 16, 19, 16, 19, 16, 16, 16, 16, 16, 16, 16, 16, 19, 21, 19, 27, 19, 21, 19, 29, 19, 21, 19, 27, 19, 21, 19, 29,
+    13, 19, 16, 19, 11, 19, 16, 19, 16, 16, 16, 16, 16, 16, 16, 16, 19, 21, 19, 21, 19, 27, 19, 29, 19, 21, 19, 21, 19, 27, 19, 29,
+    16, 19, 17, 18, 17, 18, 17, 19, 16, 16, 16, 17, 16, 17, 16, 16, 19, 22, 19, 22, 19, 22, 19, 29, 19, 22, 19, 22, 19, 22, 19, 29,
+    15, 16, 16, 16, 16, 16, 16, 16, 15, 16, 16, 16, 16, 16, 16, 16, 16, 19, 16, 19, 16, 19, 16, 19, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 16, 16, 17, 17, 17, 18, 17, 20, 17, 18, 17, 20, 17, 17, 17, 18, 17, 17, 17, 18,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18, 17, 18, 17, 20, 17, 20, 17, 17, 17, 17, 17, 18, 17, 18,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 16, 22, 16, 23, 16, 23, 16, 23, 16, 16, 17, 21, 17, 21, 17, 20,
+    14, 8, 12, 17, 12, 16, 17, 17, 14, 16, 16, 19, 16, 16, 18, 18, 12, 17, 17, 17, 17, 17, 17, 17, 16, 17, 17, 17, 16, 16, 17, 19,
+    14, 17, 17, 18, 17, 17, 17, 18, 17, 17, 19, 21, 17, 17, 19, 21, 17, 18, 17, 25, 17, 18, 17, 25, 17, 17, 19, 21, 17, 17, 19, 21,
+    14, 16, 16, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 16, 19, 17, 17, 18, 18, 17, 19, 16, 16, 16, 17, 16, 18, 16, 16,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 19, 21, 17, 17, 19, 21, 19, 21, 19, 21, 19, 21, 19, 21, 19, 21, 19, 25, 19, 21, 19, 25,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 16, 16, 17, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 16, 16, 17, 17,
+    16, 17, 17, 17, 16, 16, 17, 17, 16, 16, 16, 17, 16, 16, 16, 16, 17, 17, 17, 18, 17, 17, 17, 18, 16, 17, 17, 18, 16, 16, 17, 21,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    16, 16, 16, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 16, 17, 17, 18, 16, 16, 17, 21, 16, 16, 16, 19, 16, 17, 17, 18,
+    11, 20, 18, 20, 17, 20, 18, 20, 17, 18, 18, 18, 17, 18, 18, 18, 18, 20, 20, 20, 18, 20, 20, 27, 18, 20, 20, 20, 18, 20, 20, 27,
+    17, 20, 18, 20, 17, 20, 18, 25, 17, 18, 18, 21, 17, 18, 19, 21, 18, 20, 20, 24, 18, 25, 20, 24, 18, 20, 20, 24, 18, 20, 20, 25,
+    17, 18, 18, 20, 17, 18, 18, 20, 17, 17, 18, 18, 17, 17, 18, 18, 18, 18, 20, 20, 18, 18, 20, 27, 18, 18, 20, 20, 18, 18, 20, 27,
+    17, 18, 18, 20, 17, 18, 18, 20, 17, 17, 18, 21, 17, 17, 18, 21, 18, 21, 20, 24, 19, 21, 20, 25, 18, 21, 20, 24, 18, 21, 20, 24,
+    17, 17, 17, 18, 17, 17, 17, 18, 17, 17, 17, 18, 17, 17, 17, 18, 17, 18, 17, 20, 17, 18, 17, 20, 17, 17, 17, 18, 17, 17, 17, 18,
+    17, 17, 17, 18, 17, 17, 17, 18, 16, 17, 17, 18, 16, 16, 17, 21, 17, 18, 17, 24, 17, 18, 17, 24, 17, 17, 17, 20, 17, 17, 17, 20,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 17, 18, 17, 18, 17, 18, 17, 17, 17, 17, 17, 17, 17, 17,
+    16, 17, 17, 17, 16, 16, 17, 17, 16, 16, 16, 17, 16, 16, 16, 16, 17, 18, 17, 20, 17, 21, 17, 20, 16, 17, 17, 18, 16, 16, 17, 19,
+    14, 8, 12, 16, 12, 17, 17, 17, 14, 16, 16, 16, 16, 19, 18, 18, 12, 17, 17, 17, 17, 17, 17, 17, 16, 17, 16, 16, 17, 17, 17, 19,
+    14, 16, 16, 16, 16, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 16, 19, 18, 18, 17, 17, 17, 19, 16, 16, 16, 18, 16, 17, 16, 16,
+    14, 17, 17, 17, 17, 18, 17, 18, 17, 17, 17, 17, 19, 21, 19, 21, 17, 18, 17, 18, 17, 25, 17, 25, 17, 17, 17, 17, 19, 21, 19, 21,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 19, 21, 19, 21, 19, 21, 19, 21, 19, 21, 19, 21, 19, 21, 19, 21, 19, 25, 19, 25,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    16, 17, 16, 16, 17, 17, 17, 17, 16, 16, 16, 16, 16, 17, 16, 16, 17, 17, 17, 17, 17, 18, 17, 18, 16, 17, 16, 16, 17, 18, 17, 21,
+    16, 16, 16, 16, 16, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 16, 17, 16, 16, 17, 18, 17, 21, 16, 16, 16, 17, 16, 19, 17, 18,
+    11, 20, 17, 20, 18, 20, 18, 20, 17, 18, 17, 18, 18, 18, 18, 18, 18, 20, 18, 20, 20, 20, 20, 27, 18, 20, 18, 20, 20, 20, 20, 27,
+    17, 18, 17, 18, 18, 20, 18, 20, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 27, 18, 18, 18, 18, 20, 20, 20, 27,
+    17, 20, 17, 20, 18, 20, 18, 25, 17, 18, 17, 18, 18, 21, 19, 21, 18, 20, 18, 25, 20, 24, 20, 24, 18, 20, 18, 20, 20, 24, 20, 25,
+    17, 18, 17, 18, 18, 20, 18, 20, 17, 17, 17, 17, 18, 21, 18, 21, 18, 21, 19, 21, 20, 24, 20, 25, 18, 21, 18, 21, 20, 24, 20, 24,
+    17, 17, 17, 17, 17, 18, 17, 18, 17, 17, 17, 17, 17, 18, 17, 18, 17, 18, 17, 18, 17, 20, 17, 20, 17, 17, 17, 17, 17, 18, 17, 18,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 17, 18, 17, 18, 17, 18, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 18, 17, 18, 16, 17, 16, 16, 17, 18, 17, 21, 17, 18, 17, 18, 17, 24, 17, 24, 17, 17, 17, 17, 17, 20, 17, 20,
+    16, 17, 16, 16, 17, 17, 17, 17, 16, 16, 16, 16, 16, 17, 16, 16, 17, 18, 17, 21, 17, 20, 17, 20, 16, 17, 16, 16, 17, 18, 17, 19,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 19, 16, 16, 16, 19, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 19, 16, 16, 16, 19,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 19, 16, 19, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 19, 16, 19,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 19, 16, 19, 16, 19, 16, 19, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 16, 17, 17, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17,
+    16, 16, 16, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 16, 17, 17, 17, 16, 16, 17, 17, 16, 16, 16, 17, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 16, 17, 16, 16, 17, 17, 17, 17, 16, 16, 16, 16, 16, 17, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 16, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17,
+    16, 23, 19, 22, 19, 22, 21, 23, 17, 20, 18, 21, 18, 21, 20, 20, 19, 22, 21, 23, 21, 23, 22, 23, 17, 23, 19, 22, 19, 22, 20, 23,
+    17, 20, 18, 21, 17, 23, 19, 22, 17, 18, 19, 19, 18, 21, 19, 21, 18, 21, 20, 20, 19, 22, 20, 23, 18, 21, 19, 21, 18, 23, 19, 22,
+    17, 20, 17, 23, 18, 21, 19, 22, 17, 18, 18, 21, 19, 19, 19, 21, 18, 21, 19, 22, 20, 20, 20, 23, 18, 21, 18, 23, 19, 21, 19, 22,
+    17, 18, 18, 21, 18, 21, 18, 23, 17, 17, 19, 19, 19, 19, 20, 21, 19, 19, 19, 21, 19, 21, 19, 22, 19, 19, 20, 21, 20, 21, 19, 23,
+    16, 16, 16, 22, 16, 22, 16, 23, 16, 17, 17, 18, 17, 18, 17, 20, 16, 22, 16, 23, 16, 23, 16, 23, 16, 16, 17, 21, 17, 21, 17, 20,
+    16, 17, 17, 18, 16, 16, 17, 21, 16, 16, 16, 19, 16, 17, 17, 18, 17, 18, 17, 20, 17, 21, 17, 20, 16, 17, 17, 18, 16, 16, 17, 19,
+    16, 17, 16, 16, 17, 18, 17, 21, 16, 16, 16, 17, 16, 19, 17, 18, 17, 18, 17, 21, 17, 20, 17, 20, 16, 17, 16, 16, 17, 18, 17, 19,
+    16, 16, 16, 17, 16, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 16, 19, 17, 18, 17, 18, 17, 19, 16, 16, 16, 17, 16, 17, 16, 16
+};
+
+static const char s_Npn4Perms[65536] = {
+    0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 3, 3, 2, 2, 4, 4, 0, 0, 0, 0, 2, 0, 5, 1, 0, 0,
+    2, 2, 3, 2, 2, 2, 0, 2, 4, 0, 4, 0, 5, 0, 1, 0, 2, 3, 2, 2, 4, 3, 2, 2, 4, 2, 3, 2, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 5, 1, 5, 2, 1, 2, 1, 2, 1, 0, 1, 5, 4, 3, 4, 4, 4, 4, 4, 3, 5, 1, 1, 4, 5, 1, 1,
+    0, 3, 0, 3, 1, 4, 3, 3, 0, 0, 4, 0, 2, 1, 3, 0, 0, 3, 2, 3, 5, 4, 3, 3, 0, 3, 1, 2, 0, 4, 0, 0,
+    0, 0, 4, 4, 2, 2, 0, 0, 3, 0, 5, 1, 2, 0, 0, 0, 0, 0, 2, 2, 4, 4, 0, 0, 0, 3, 4, 3, 3, 4, 0, 0,
+    1, 2, 4, 3, 2, 1, 5, 1, 4, 4, 4, 4, 4, 1, 5, 1, 0, 2, 2, 2, 1, 5, 2, 2, 5, 3, 4, 3, 0, 0, 4, 0,
+    0, 4, 4, 0, 3, 4, 2, 0, 2, 2, 3, 0, 2, 2, 2, 0, 1, 5, 0, 2, 4, 4, 4, 4, 2, 4, 1, 1, 3, 4, 2, 1,
+    0, 0, 1, 2, 0, 5, 3, 3, 0, 0, 4, 4, 2, 2, 3, 0, 0, 0, 0, 2, 1, 5, 0, 3, 0, 0, 1, 2, 0, 4, 0, 0,
+    9, 9, 8, 8, 10, 10, 6, 6, 6, 6, 8, 6, 11, 7, 6, 6, 16, 16, 12, 12, 18, 18, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+    14, 14, 12, 14, 2, 2, 2, 2, 8, 8, 8, 8, 0, 0, 6, 0, 16, 15, 14, 14, 3, 3, 2, 2, 2, 2, 14, 2, 0, 0, 0, 0,
+    22, 22, 4, 4, 19, 23, 5, 5, 11, 11, 1, 1, 11, 11, 7, 1, 21, 22, 4, 4, 22, 22, 4, 4, 5, 5, 1, 1, 23, 5, 1, 1,
+    16, 16, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 1, 1, 0, 0, 16, 16, 15, 3, 22, 4, 3, 3, 3, 3, 2, 2, 4, 4, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 0, 6, 0, 7, 0, 6, 1, 6, 0, 3, 3, 2, 2, 4, 4, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+    14, 2, 15, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 14, 3, 14, 2, 3, 3, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+    22, 4, 4, 4, 22, 5, 5, 5, 1, 1, 1, 1, 1, 1, 1, 1, 23, 4, 4, 4, 22, 4, 4, 4, 5, 5, 1, 1, 5, 5, 1, 1,
+    3, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 1, 1, 0, 0, 3, 3, 3, 3, 4, 4, 3, 3, 3, 3, 2, 2, 4, 4, 0, 0,
+    8, 8, 9, 8, 8, 8, 6, 8, 10, 6, 10, 6, 11, 6, 7, 6, 12, 12, 14, 12, 8, 8, 8, 8, 2, 2, 2, 2, 6, 6, 0, 6,
+    16, 12, 16, 12, 0, 0, 0, 0, 18, 0, 18, 0, 1, 0, 1, 0, 16, 14, 15, 14, 14, 14, 2, 14, 3, 2, 3, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 7, 0, 0, 1, 0, 1, 0, 6, 7, 1, 0, 15, 15, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0,
+    3, 2, 3, 2, 0, 0, 0, 0, 4, 0, 4, 0, 1, 0, 1, 0, 14, 15, 3, 2, 2, 2, 2, 2, 3, 2, 3, 2, 0, 0, 0, 0,
+    22, 4, 22, 4, 11, 1, 11, 1, 19, 5, 23, 5, 11, 7, 11, 1, 16, 3, 16, 3, 0, 0, 0, 0, 4, 3, 4, 3, 1, 0, 1, 0,
+    21, 4, 22, 4, 5, 1, 5, 1, 22, 4, 22, 4, 23, 1, 5, 1, 16, 15, 16, 3, 3, 2, 3, 2, 22, 3, 4, 3, 4, 0, 4, 0,
+    22, 4, 4, 4, 1, 1, 1, 1, 22, 5, 5, 5, 1, 1, 1, 1, 3, 3, 3, 3, 0, 0, 0, 0, 4, 3, 4, 3, 1, 0, 1, 0,
+    23, 4, 4, 4, 5, 1, 5, 1, 22, 4, 4, 4, 5, 1, 5, 1, 3, 3, 3, 3, 3, 2, 3, 2, 4, 3, 4, 3, 4, 0, 4, 4,
+    8, 9, 8, 8, 10, 9, 8, 8, 10, 8, 9, 8, 6, 6, 6, 6, 17, 13, 12, 12, 9, 9, 8, 8, 8, 8, 12, 8, 6, 6, 6, 6,
+    17, 12, 13, 12, 12, 12, 8, 12, 9, 8, 9, 8, 6, 6, 6, 6, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0,
+    18, 18, 7, 7, 11, 11, 7, 7, 11, 11, 7, 7, 11, 11, 7, 7, 16, 16, 15, 15, 18, 18, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0,
+    16, 16, 15, 15, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 15, 15, 15, 15, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+    18, 7, 18, 7, 11, 7, 11, 7, 11, 7, 11, 7, 11, 7, 11, 7, 16, 15, 16, 15, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0,
+    16, 15, 16, 15, 0, 0, 0, 0, 18, 0, 18, 0, 7, 0, 7, 0, 16, 15, 16, 15, 2, 2, 2, 2, 15, 2, 15, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 6, 6, 6, 0, 14, 2, 2, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1,
+    14, 2, 2, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 14, 14, 14, 2, 2, 2, 2, 3, 2, 2, 2, 3, 0, 4, 4, 0,
+    10, 10, 10, 10, 10, 11, 7, 11, 8, 7, 8, 7, 8, 7, 6, 7, 18, 18, 10, 10, 23, 19, 11, 11, 5, 5, 7, 7, 5, 5, 1, 7,
+    1, 1, 6, 6, 1, 1, 1, 1, 0, 1, 7, 6, 0, 1, 0, 1, 21, 21, 1, 1, 5, 5, 1, 1, 5, 5, 1, 1, 5, 5, 1, 1,
+    20, 19, 1, 1, 20, 19, 1, 1, 12, 1, 0, 1, 12, 1, 0, 1, 21, 23, 23, 23, 22, 23, 5, 23, 4, 5, 1, 1, 4, 5, 1, 1,
+    4, 5, 1, 1, 4, 5, 1, 1, 2, 1, 0, 1, 2, 1, 0, 1, 23, 22, 5, 5, 4, 5, 5, 5, 4, 5, 1, 1, 4, 5, 1, 1,
+    14, 2, 8, 0, 14, 2, 8, 0, 12, 2, 8, 6, 14, 2, 8, 0, 21, 4, 1, 1, 21, 4, 1, 1, 3, 4, 0, 1, 3, 4, 0, 1,
+    14, 2, 0, 0, 2, 2, 0, 0, 15, 2, 0, 0, 2, 2, 0, 0, 4, 4, 1, 1, 4, 4, 1, 1, 3, 4, 0, 1, 3, 4, 0, 1,
+    16, 3, 2, 0, 15, 3, 2, 0, 14, 2, 14, 0, 14, 2, 2, 0, 21, 22, 4, 5, 21, 4, 4, 5, 15, 4, 2, 1, 3, 4, 2, 1,
+    14, 3, 2, 0, 3, 3, 2, 0, 14, 2, 2, 0, 2, 2, 2, 0, 4, 4, 4, 5, 4, 4, 4, 5, 3, 4, 2, 1, 3, 4, 2, 2,
+    11, 10, 9, 10, 10, 10, 10, 10, 9, 11, 7, 7, 10, 11, 7, 7, 20, 18, 10, 10, 18, 18, 10, 10, 11, 11, 7, 7, 19, 11, 7, 7,
+    13, 13, 8, 8, 6, 6, 6, 6, 8, 8, 8, 8, 6, 6, 6, 6, 17, 17, 13, 13, 21, 21, 1, 1, 1, 1, 6, 6, 1, 1, 1, 1,
+    20, 19, 19, 19, 18, 19, 11, 19, 10, 11, 7, 7, 10, 11, 7, 7, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 1, 1, 19, 19, 1, 1,
+    21, 21, 5, 5, 22, 22, 5, 5, 1, 1, 1, 1, 1, 1, 1, 1, 21, 21, 22, 22, 22, 22, 5, 5, 5, 5, 1, 1, 5, 5, 1, 1,
+    13, 6, 8, 6, 13, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 21, 22, 1, 1, 21, 22, 1, 1, 5, 5, 1, 1, 5, 5, 1, 1,
+    1, 1, 7, 1, 1, 1, 1, 1, 7, 1, 7, 7, 1, 1, 7, 1, 23, 5, 1, 1, 5, 5, 1, 1, 1, 1, 1, 1, 5, 1, 1, 0,
+    21, 22, 1, 1, 21, 22, 1, 1, 13, 1, 6, 1, 13, 1, 6, 1, 21, 22, 5, 5, 21, 22, 5, 5, 22, 5, 1, 1, 22, 5, 1, 1,
+    23, 5, 5, 5, 5, 5, 1, 5, 1, 1, 1, 1, 1, 1, 1, 0, 23, 23, 5, 5, 23, 5, 5, 4, 5, 5, 1, 2, 5, 4, 2, 1,
+    6, 9, 6, 9, 7, 10, 9, 9, 6, 6, 10, 6, 8, 7, 9, 6, 17, 17, 9, 9, 10, 10, 9, 9, 6, 6, 6, 6, 7, 7, 6, 6,
+    9, 8, 9, 8, 6, 6, 6, 6, 10, 6, 10, 6, 7, 6, 7, 6, 17, 17, 13, 13, 8, 8, 8, 8, 6, 6, 6, 6, 6, 6, 6, 6,
+    10, 11, 7, 7, 10, 11, 7, 7, 8, 7, 6, 7, 8, 7, 6, 7, 20, 20, 11, 11, 18, 18, 11, 11, 7, 7, 7, 7, 7, 7, 7, 7,
+    0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 16, 16, 0, 0, 1, 1, 0, 3, 0, 0, 0, 0, 1, 1, 0, 0,
+    17, 6, 10, 7, 9, 6, 9, 6, 17, 6, 10, 7, 9, 6, 9, 6, 0, 0, 6, 0, 7, 1, 0, 0, 0, 6, 7, 6, 6, 7, 0, 0,
+    20, 7, 18, 7, 11, 7, 11, 7, 20, 7, 18, 7, 11, 7, 11, 7, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 4, 1, 0, 1, 1,
+    17, 6, 8, 6, 13, 6, 8, 6, 17, 6, 8, 6, 13, 6, 8, 6, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0, 3, 0, 0,
+    16, 0, 1, 1, 0, 0, 0, 0, 16, 0, 1, 1, 0, 0, 3, 0, 0, 0, 0, 2, 1, 5, 0, 3, 0, 0, 5, 4, 2, 3, 3, 0,
+    6, 9, 8, 9, 11, 10, 9, 9, 6, 9, 7, 8, 6, 10, 6, 6, 17, 17, 13, 9, 18, 10, 9, 9, 9, 9, 8, 8, 10, 10, 6, 6,
+    12, 13, 9, 8, 8, 8, 8, 8, 9, 8, 9, 8, 6, 6, 6, 6, 17, 17, 13, 13, 13, 13, 8, 8, 8, 8, 8, 8, 6, 6, 6, 6,
+    19, 18, 11, 11, 10, 11, 11, 11, 10, 11, 7, 7, 10, 11, 7, 7, 20, 20, 18, 18, 18, 18, 11, 11, 11, 11, 7, 7, 11, 11, 7, 7,
+    17, 17, 6, 6, 7, 7, 6, 9, 6, 6, 6, 6, 7, 7, 6, 6, 16, 16, 16, 12, 20, 19, 0, 3, 0, 0, 0, 12, 1, 19, 0, 0,
+    9, 6, 10, 7, 9, 6, 9, 6, 9, 6, 10, 7, 9, 6, 9, 6, 6, 6, 6, 6, 7, 7, 6, 9, 6, 6, 6, 6, 7, 7, 6, 6,
+    19, 7, 11, 7, 7, 7, 7, 7, 11, 7, 11, 7, 11, 7, 7, 6, 0, 0, 6, 14, 0, 0, 0, 12, 6, 6, 6, 14, 0, 11, 5, 0,
+    12, 6, 6, 6, 8, 6, 6, 6, 8, 6, 8, 6, 8, 6, 6, 7, 1, 1, 1, 1, 7, 23, 1, 19, 7, 7, 1, 8, 7, 23, 2, 1,
+    0, 0, 0, 0, 1, 1, 0, 9, 6, 0, 7, 5, 6, 2, 3, 0, 0, 0, 0, 14, 1, 23, 0, 3, 0, 0, 5, 3, 2, 4, 3, 0,
+    6, 6, 10, 10, 8, 8, 6, 6, 9, 6, 11, 7, 8, 6, 6, 6, 6, 6, 6, 6, 7, 7, 6, 6, 0, 6, 1, 6, 0, 7, 0, 6,
+    18, 10, 18, 10, 5, 7, 5, 7, 23, 11, 19, 11, 5, 1, 5, 7, 21, 1, 21, 1, 5, 1, 5, 1, 5, 1, 5, 1, 5, 1, 5, 1,
+    12, 8, 2, 6, 12, 8, 2, 6, 14, 8, 2, 0, 12, 8, 2, 6, 15, 0, 2, 0, 15, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+    16, 0, 4, 1, 3, 0, 3, 0, 16, 0, 4, 1, 3, 0, 3, 0, 3, 0, 4, 1, 3, 0, 3, 0, 3, 0, 4, 1, 3, 0, 3, 0,
+    16, 0, 19, 1, 12, 0, 0, 0, 16, 0, 19, 1, 12, 0, 0, 0, 3, 0, 5, 1, 2, 0, 0, 0, 3, 0, 5, 1, 2, 0, 0, 0,
+    21, 5, 23, 23, 4, 1, 5, 1, 22, 5, 23, 5, 4, 1, 5, 1, 23, 5, 22, 5, 4, 1, 5, 1, 4, 5, 5, 5, 4, 1, 5, 1,
+    16, 2, 3, 0, 14, 14, 2, 0, 15, 2, 3, 0, 14, 2, 2, 0, 14, 2, 3, 0, 15, 2, 2, 0, 3, 2, 3, 0, 2, 2, 2, 0,
+    16, 3, 22, 5, 15, 2, 3, 0, 16, 3, 4, 5, 3, 2, 3, 0, 3, 3, 4, 5, 3, 2, 3, 0, 3, 3, 4, 5, 3, 2, 3, 3,
+    6, 6, 8, 8, 10, 10, 6, 6, 6, 9, 10, 9, 9, 10, 6, 6, 9, 9, 8, 8, 10, 10, 6, 6, 6, 6, 6, 6, 7, 7, 6, 6,
+    17, 9, 17, 9, 6, 6, 6, 6, 10, 9, 10, 9, 7, 6, 7, 6, 17, 13, 17, 13, 6, 6, 6, 6, 8, 8, 8, 8, 6, 6, 6, 6,
+    20, 10, 7, 7, 20, 10, 7, 7, 9, 10, 6, 7, 9, 10, 6, 7, 20, 18, 7, 7, 20, 18, 7, 7, 11, 11, 7, 7, 11, 11, 7, 7,
+    6, 6, 0, 6, 1, 7, 6, 6, 6, 0, 1, 0, 0, 1, 6, 6, 0, 0, 0, 0, 1, 1, 0, 3, 0, 0, 0, 0, 1, 1, 0, 0,
+    9, 6, 11, 7, 8, 6, 6, 6, 9, 6, 11, 7, 8, 6, 6, 6, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    20, 11, 20, 11, 7, 7, 7, 7, 18, 11, 18, 11, 7, 7, 7, 7, 16, 0, 16, 0, 0, 0, 0, 0, 1, 0, 1, 4, 1, 0, 1, 1,
+    17, 8, 6, 6, 17, 8, 6, 6, 13, 8, 6, 6, 13, 8, 6, 6, 21, 1, 1, 1, 21, 1, 1, 1, 0, 1, 0, 1, 0, 3, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 3, 0, 0, 0, 0, 2, 1, 5, 0, 3, 0, 0, 5, 4, 2, 3, 3, 0,
+    7, 8, 10, 9, 8, 7, 11, 7, 10, 10, 10, 10, 10, 7, 11, 7, 12, 8, 13, 8, 8, 8, 8, 8, 6, 6, 6, 6, 6, 6, 6, 6,
+    20, 10, 18, 10, 11, 7, 11, 7, 18, 10, 18, 10, 19, 7, 11, 7, 17, 13, 17, 13, 6, 6, 6, 6, 21, 6, 21, 6, 1, 6, 1, 6,
+    12, 8, 6, 6, 8, 8, 6, 6, 13, 8, 6, 6, 8, 8, 6, 6, 7, 7, 1, 7, 7, 7, 7, 7, 1, 7, 1, 1, 7, 7, 1, 7,
+    21, 1, 22, 1, 5, 1, 5, 1, 21, 1, 22, 1, 5, 1, 5, 1, 23, 1, 5, 1, 1, 1, 1, 1, 5, 1, 5, 1, 5, 1, 1, 0,
+    20, 11, 19, 19, 10, 7, 11, 7, 18, 11, 19, 11, 10, 7, 11, 7, 21, 5, 21, 5, 1, 1, 1, 1, 22, 5, 22, 5, 1, 1, 1, 1,
+    19, 19, 19, 19, 19, 1, 19, 1, 19, 19, 19, 19, 19, 1, 19, 1, 21, 22, 21, 22, 5, 1, 5, 1, 22, 5, 22, 5, 5, 1, 5, 5,
+    17, 1, 22, 1, 13, 6, 1, 1, 17, 1, 22, 1, 13, 6, 1, 1, 23, 1, 5, 5, 1, 1, 1, 1, 5, 1, 5, 1, 1, 1, 1, 0,
+    21, 5, 22, 5, 22, 1, 5, 1, 21, 5, 22, 5, 22, 1, 5, 5, 23, 5, 23, 5, 5, 1, 5, 2, 23, 5, 5, 4, 5, 2, 4, 5,
+    6, 8, 8, 8, 7, 11, 8, 8, 11, 9, 10, 9, 6, 6, 10, 6, 12, 9, 12, 8, 9, 9, 8, 8, 8, 8, 8, 8, 6, 6, 6, 6,
+    17, 13, 17, 9, 9, 8, 9, 8, 18, 9, 10, 9, 10, 6, 10, 6, 17, 13, 17, 13, 8, 8, 8, 8, 13, 8, 13, 8, 6, 6, 6, 6,
+    10, 10, 7, 7, 10, 10, 7, 7, 9, 10, 6, 7, 9, 10, 6, 7, 19, 11, 7, 7, 11, 11, 7, 7, 7, 7, 7, 7, 11, 7, 7, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 7, 6, 7, 10, 7, 6, 7, 7, 6, 6, 0, 12, 6, 6, 6, 14, 0, 0, 0, 12, 6, 5, 11, 6,
+    19, 11, 18, 11, 10, 7, 11, 7, 10, 11, 11, 11, 10, 7, 11, 7, 17, 6, 17, 6, 6, 6, 6, 6, 7, 6, 7, 10, 7, 6, 7, 7,
+    20, 18, 20, 18, 11, 7, 11, 7, 18, 11, 18, 11, 11, 7, 11, 11, 16, 16, 16, 12, 0, 0, 0, 12, 20, 0, 19, 19, 1, 0, 19, 1,
+    12, 6, 6, 6, 8, 8, 6, 6, 8, 6, 6, 6, 8, 6, 6, 7, 0, 0, 0, 0, 7, 7, 0, 5, 1, 0, 1, 10, 6, 3, 2, 0,
+    1, 1, 1, 1, 7, 1, 7, 8, 7, 1, 23, 19, 7, 2, 23, 1, 0, 0, 0, 14, 0, 5, 1, 3, 1, 1, 23, 4, 2, 3, 4, 1,
+    6, 10, 10, 6, 9, 10, 8, 6, 8, 8, 9, 6, 8, 8, 8, 6, 18, 10, 10, 10, 18, 11, 11, 11, 7, 7, 7, 7, 7, 7, 7, 7,
+    18, 10, 10, 10, 7, 7, 7, 7, 18, 11, 11, 11, 7, 7, 7, 7, 6, 6, 6, 6, 0, 6, 6, 6, 0, 6, 6, 6, 0, 0, 0, 6,
+    17, 9, 8, 6, 13, 9, 8, 6, 12, 8, 12, 6, 12, 8, 8, 6, 20, 18, 7, 7, 20, 18, 7, 7, 15, 7, 0, 7, 15, 7, 0, 7,
+    16, 0, 2, 0, 15, 0, 2, 0, 16, 0, 2, 0, 15, 0, 2, 0, 14, 0, 0, 0, 2, 0, 0, 0, 2, 0, 2, 0, 2, 0, 0, 1,
+    17, 8, 9, 6, 12, 12, 8, 6, 13, 8, 9, 6, 12, 8, 8, 6, 16, 2, 0, 0, 16, 2, 0, 0, 15, 2, 0, 0, 15, 2, 0, 0,
+    16, 0, 18, 7, 15, 0, 0, 0, 16, 0, 18, 7, 15, 0, 0, 0, 14, 0, 0, 0, 2, 2, 0, 0, 2, 0, 0, 0, 2, 0, 0, 1,
+    12, 12, 12, 0, 12, 12, 12, 0, 12, 12, 12, 0, 12, 12, 12, 0, 16, 15, 2, 0, 16, 15, 2, 0, 15, 2, 2, 0, 15, 2, 2, 2,
+    16, 2, 15, 0, 15, 2, 2, 0, 16, 2, 15, 0, 15, 2, 2, 2, 14, 2, 2, 0, 14, 2, 2, 5, 14, 2, 2, 5, 2, 3, 3, 2,
+    7, 11, 6, 8, 10, 10, 10, 10, 8, 10, 7, 7, 9, 10, 8, 7, 19, 10, 10, 10, 18, 10, 10, 10, 11, 11, 7, 7, 11, 11, 7, 7,
+    9, 9, 9, 9, 6, 6, 6, 6, 10, 9, 10, 9, 7, 6, 7, 6, 12, 8, 8, 8, 6, 6, 6, 6, 6, 6, 8, 6, 6, 6, 6, 7,
+    20, 18, 10, 11, 20, 10, 10, 11, 13, 10, 8, 7, 9, 10, 8, 7, 20, 18, 11, 11, 20, 18, 11, 11, 18, 11, 7, 7, 18, 11, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 6, 7, 6, 7, 6, 9, 6, 6, 7, 7, 7, 7, 1, 19, 7, 23, 1, 1, 7, 2, 1, 19, 8, 7,
+    12, 8, 9, 6, 13, 8, 8, 6, 9, 8, 9, 6, 8, 8, 8, 6, 20, 7, 7, 7, 20, 7, 7, 7, 6, 7, 6, 7, 6, 9, 6, 6,
+    19, 7, 11, 11, 7, 7, 7, 7, 11, 7, 11, 7, 7, 7, 7, 6, 1, 1, 6, 6, 1, 1, 1, 2, 0, 1, 7, 4, 0, 9, 5, 1,
+    17, 13, 8, 6, 17, 13, 8, 6, 13, 8, 8, 6, 13, 8, 8, 8, 20, 20, 1, 1, 20, 19, 1, 19, 16, 1, 0, 1, 12, 12, 12, 0,
+    0, 0, 6, 0, 0, 0, 6, 11, 6, 0, 6, 5, 14, 12, 14, 0, 1, 1, 1, 2, 1, 23, 0, 4, 0, 0, 5, 4, 14, 3, 3, 0,
+    6, 6, 7, 8, 6, 11, 9, 9, 6, 6, 10, 10, 8, 8, 9, 6, 9, 9, 9, 9, 10, 10, 9, 9, 6, 6, 6, 6, 7, 7, 6, 6,
+    19, 10, 10, 10, 11, 7, 11, 7, 18, 10, 10, 10, 11, 7, 11, 7, 12, 8, 8, 8, 8, 8, 6, 8, 6, 6, 6, 6, 6, 6, 6, 7,
+    12, 9, 8, 6, 9, 9, 8, 6, 12, 8, 8, 6, 8, 8, 8, 6, 19, 11, 11, 11, 11, 11, 7, 11, 7, 7, 7, 7, 7, 7, 7, 6,
+    17, 6, 7, 7, 6, 6, 6, 6, 17, 6, 7, 7, 6, 6, 9, 6, 6, 6, 6, 6, 7, 7, 6, 3, 0, 6, 1, 11, 0, 8, 9, 6,
+    17, 9, 18, 11, 13, 8, 9, 6, 17, 9, 10, 11, 9, 8, 9, 6, 6, 6, 7, 7, 6, 6, 6, 6, 6, 6, 7, 7, 6, 6, 9, 6,
+    20, 11, 18, 11, 18, 7, 11, 7, 20, 11, 18, 11, 18, 7, 11, 11, 7, 7, 7, 7, 1, 7, 1, 2, 1, 7, 19, 23, 1, 8, 19, 7,
+    17, 8, 13, 6, 13, 8, 8, 6, 17, 8, 13, 6, 13, 8, 8, 8, 6, 6, 0, 6, 6, 6, 0, 5, 0, 6, 0, 11, 12, 14, 12, 6,
+    16, 0, 20, 1, 16, 0, 0, 0, 16, 0, 19, 19, 12, 12, 12, 0, 0, 0, 1, 2, 0, 5, 0, 3, 0, 0, 23, 4, 14, 3, 3, 0,
+    6, 6, 6, 8, 7, 11, 6, 9, 6, 6, 7, 8, 6, 10, 6, 6, 9, 9, 9, 9, 10, 10, 9, 9, 9, 9, 8, 8, 10, 10, 6, 6,
+    9, 9, 9, 9, 9, 8, 9, 8, 10, 9, 10, 9, 10, 6, 10, 10, 12, 12, 12, 8, 8, 8, 8, 9, 8, 8, 8, 9, 6, 10, 10, 6,
+    10, 10, 10, 11, 10, 10, 10, 11, 9, 10, 8, 7, 9, 10, 8, 8, 19, 19, 11, 11, 19, 11, 11, 10, 11, 11, 7, 8, 11, 10, 8, 7,
+    6, 6, 6, 8, 7, 11, 6, 9, 6, 6, 11, 10, 8, 9, 9, 6, 6, 6, 6, 12, 7, 19, 6, 9, 6, 6, 11, 9, 8, 10, 9, 6,
+    9, 9, 10, 11, 9, 8, 9, 6, 9, 9, 10, 11, 9, 8, 9, 9, 6, 6, 6, 8, 7, 11, 6, 9, 6, 6, 11, 10, 8, 9, 9, 6,
+    19, 11, 19, 11, 11, 7, 11, 8, 19, 11, 11, 10, 11, 8, 10, 11, 6, 6, 6, 12, 6, 11, 7, 9, 7, 7, 19, 10, 8, 9, 10, 7,
+    12, 8, 8, 6, 12, 8, 8, 11, 12, 8, 8, 11, 8, 9, 9, 8, 7, 7, 7, 8, 7, 19, 6, 10, 6, 6, 11, 10, 12, 9, 9, 6,
+    6, 6, 7, 8, 6, 11, 6, 9, 6, 6, 19, 10, 12, 9, 9, 6, 0, 0, 1, 12, 0, 19, 0, 3, 0, 0, 19, 4, 12, 3, 3, 0,
+    16, 16, 16, 16, 20, 20, 16, 16, 3, 3, 12, 12, 19, 19, 3, 3, 17, 16, 15, 16, 22, 21, 16, 16, 3, 3, 3, 3, 4, 4, 3, 3,
+    12, 15, 12, 15, 4, 4, 15, 15, 2, 3, 15, 14, 4, 4, 3, 3, 12, 15, 14, 15, 4, 4, 3, 15, 2, 3, 2, 3, 4, 4, 3, 3,
+    18, 21, 3, 3, 19, 22, 22, 22, 5, 4, 3, 3, 22, 23, 4, 4, 18, 21, 3, 3, 23, 22, 4, 22, 5, 4, 3, 3, 5, 4, 4, 4,
+    6, 3, 2, 3, 5, 4, 3, 3, 0, 3, 2, 3, 5, 4, 3, 3, 6, 3, 2, 3, 5, 4, 3, 3, 0, 3, 2, 3, 5, 4, 3, 3,
+    6, 0, 12, 2, 19, 5, 3, 3, 6, 0, 2, 2, 5, 5, 3, 3, 6, 0, 12, 2, 19, 5, 3, 3, 0, 0, 2, 2, 5, 5, 3, 3,
+    8, 0, 12, 14, 1, 5, 2, 3, 7, 0, 2, 2, 1, 5, 2, 3, 6, 0, 12, 2, 1, 5, 2, 3, 0, 0, 2, 2, 1, 5, 2, 3,
+    11, 1, 0, 2, 19, 23, 5, 4, 6, 1, 0, 2, 5, 5, 5, 4, 7, 1, 0, 2, 19, 5, 5, 4, 1, 1, 0, 2, 5, 5, 5, 4,
+    6, 0, 6, 2, 7, 5, 0, 3, 6, 0, 0, 2, 1, 5, 0, 3, 6, 0, 0, 2, 1, 5, 0, 3, 0, 0, 0, 2, 1, 5, 0, 0,
+    16, 17, 13, 17, 18, 20, 17, 17, 9, 9, 9, 9, 10, 10, 9, 9, 16, 16, 16, 16, 20, 20, 16, 16, 12, 12, 12, 12, 19, 19, 3, 3,
+    13, 16, 15, 15, 16, 16, 15, 15, 12, 12, 12, 12, 3, 3, 14, 14, 17, 16, 15, 15, 21, 16, 15, 15, 14, 14, 14, 14, 3, 3, 3, 3,
+    18, 21, 21, 21, 21, 21, 21, 21, 19, 19, 4, 4, 19, 19, 23, 23, 20, 21, 16, 21, 21, 21, 21, 21, 23, 23, 4, 4, 23, 23, 4, 4,
+    17, 16, 15, 15, 21, 21, 3, 3, 3, 3, 3, 3, 4, 4, 3, 3, 17, 16, 15, 15, 21, 21, 3, 3, 3, 3, 3, 3, 4, 4, 3, 3,
+    9, 14, 12, 14, 19, 23, 3, 3, 3, 3, 15, 3, 22, 4, 3, 3, 9, 14, 12, 14, 19, 23, 3, 3, 3, 3, 3, 3, 4, 4, 3, 3,
+    12, 14, 12, 14, 4, 4, 3, 3, 15, 3, 15, 15, 3, 3, 3, 3, 12, 14, 12, 14, 4, 4, 3, 3, 3, 3, 15, 3, 4, 3, 3, 2,
+    19, 23, 3, 3, 19, 23, 4, 4, 22, 4, 4, 4, 22, 22, 4, 4, 19, 23, 3, 3, 19, 23, 4, 4, 4, 4, 3, 4, 22, 4, 4, 5,
+    9, 3, 14, 3, 23, 4, 3, 3, 3, 3, 3, 3, 4, 4, 3, 0, 9, 3, 14, 3, 23, 4, 3, 3, 3, 3, 3, 2, 4, 5, 0, 3,
+    14, 13, 14, 13, 10, 10, 13, 13, 8, 9, 13, 12, 10, 10, 9, 9, 15, 17, 13, 13, 17, 17, 13, 13, 14, 14, 14, 14, 9, 9, 12, 12,
+    12, 12, 16, 12, 12, 12, 12, 12, 16, 12, 16, 12, 12, 12, 12, 12, 12, 15, 13, 14, 15, 15, 14, 14, 15, 14, 15, 14, 14, 14, 14, 14,
+    17, 16, 15, 15, 18, 18, 16, 16, 2, 2, 2, 2, 11, 11, 2, 2, 17, 16, 15, 15, 20, 20, 16, 16, 3, 3, 2, 2, 3, 3, 2, 1,
+    12, 15, 14, 15, 15, 15, 15, 15, 2, 2, 3, 2, 2, 2, 2, 2, 12, 15, 14, 15, 15, 15, 15, 15, 2, 3, 2, 2, 3, 3, 2, 2,
+    10, 14, 17, 15, 2, 2, 14, 2, 18, 15, 20, 15, 2, 2, 2, 2, 13, 14, 13, 14, 15, 3, 2, 2, 16, 15, 16, 15, 2, 2, 2, 2,
+    10, 14, 17, 15, 2, 14, 15, 14, 18, 15, 20, 15, 3, 2, 3, 5, 13, 14, 13, 14, 14, 15, 2, 2, 16, 15, 16, 15, 3, 2, 3, 3,
+    10, 14, 12, 14, 3, 3, 3, 3, 11, 2, 3, 3, 2, 2, 2, 0, 9, 14, 12, 14, 3, 3, 3, 3, 2, 2, 2, 2, 3, 4, 2, 1,
+    10, 14, 12, 14, 2, 3, 2, 3, 11, 2, 3, 3, 2, 2, 4, 5, 9, 14, 12, 14, 2, 1, 2, 2, 2, 2, 1, 2, 0, 1, 1, 2,
+    14, 13, 12, 13, 10, 10, 9, 13, 8, 9, 8, 9, 10, 10, 9, 9, 16, 17, 13, 13, 20, 17, 13, 13, 12, 12, 12, 12, 9, 9, 9, 9,
+    14, 13, 15, 12, 13, 13, 12, 12, 13, 12, 13, 12, 12, 12, 12, 12, 12, 16, 12, 12, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    21, 20, 16, 16, 18, 18, 20, 20, 10, 10, 10, 10, 10, 10, 10, 6, 17, 16, 16, 16, 20, 20, 16, 16, 15, 15, 14, 13, 18, 21, 2, 1,
+    17, 16, 15, 15, 16, 16, 15, 15, 14, 14, 14, 14, 2, 2, 2, 6, 17, 16, 15, 15, 16, 16, 15, 15, 15, 15, 14, 14, 3, 21, 2, 2,
+    13, 14, 17, 15, 14, 14, 14, 14, 21, 15, 16, 15, 2, 2, 14, 6, 13, 14, 13, 14, 15, 15, 14, 13, 15, 15, 15, 15, 2, 2, 2, 8,
+    13, 14, 17, 15, 14, 14, 14, 14, 16, 15, 16, 15, 14, 14, 14, 6, 13, 14, 13, 14, 15, 15, 14, 14, 16, 15, 15, 14, 2, 16, 4, 2,
+    8, 14, 14, 14, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 6, 12, 14, 14, 14, 15, 22, 3, 21, 3, 3, 2, 13, 3, 22, 2, 1,
+    12, 14, 12, 14, 15, 15, 3, 12, 14, 2, 15, 4, 2, 2, 4, 1, 12, 14, 14, 15, 15, 22, 0, 3, 14, 0, 1, 2, 0, 5, 1, 2,
+    22, 18, 9, 9, 23, 18, 18, 18, 11, 10, 9, 9, 18, 19, 10, 10, 22, 20, 20, 20, 18, 18, 18, 18, 23, 23, 10, 10, 23, 23, 19, 19,
+    16, 17, 13, 13, 22, 22, 17, 17, 4, 4, 8, 8, 5, 5, 5, 5, 20, 21, 17, 17, 22, 22, 21, 21, 4, 4, 4, 4, 4, 4, 4, 0,
+    18, 18, 18, 18, 20, 19, 19, 19, 20, 19, 19, 19, 20, 19, 19, 19, 18, 21, 21, 21, 18, 22, 22, 22, 22, 23, 23, 23, 22, 23, 23, 23,
+    18, 21, 21, 21, 23, 22, 22, 22, 4, 4, 4, 4, 4, 5, 5, 5, 18, 21, 21, 21, 23, 22, 22, 22, 5, 4, 4, 4, 4, 4, 4, 4,
+    9, 22, 4, 4, 20, 22, 23, 5, 13, 22, 5, 5, 17, 22, 5, 5, 18, 23, 22, 4, 18, 22, 4, 4, 21, 22, 5, 5, 21, 22, 5, 5,
+    9, 23, 4, 4, 19, 23, 4, 4, 8, 4, 4, 4, 4, 4, 5, 1, 10, 23, 4, 4, 19, 23, 4, 4, 5, 5, 4, 3, 4, 4, 4, 0,
+    9, 22, 4, 22, 20, 22, 22, 23, 13, 22, 4, 5, 17, 22, 4, 2, 18, 23, 23, 22, 18, 22, 4, 4, 21, 22, 4, 5, 21, 22, 4, 4,
+    9, 23, 5, 4, 19, 23, 5, 4, 8, 4, 4, 4, 4, 4, 3, 2, 10, 23, 5, 0, 19, 23, 5, 5, 5, 5, 1, 0, 0, 4, 0, 4,
+    22, 18, 9, 9, 19, 18, 10, 18, 11, 10, 9, 9, 11, 10, 10, 10, 21, 20, 17, 20, 18, 18, 18, 18, 19, 19, 10, 10, 19, 19, 10, 10,
+    16, 17, 13, 13, 21, 21, 17, 17, 9, 9, 8, 8, 9, 9, 8, 7, 16, 17, 17, 17, 21, 21, 17, 17, 13, 13, 12, 15, 22, 18, 4, 0,
+    22, 18, 18, 18, 21, 18, 18, 18, 18, 19, 19, 19, 18, 19, 19, 19, 19, 20, 20, 20, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19,
+    20, 21, 21, 21, 21, 21, 21, 21, 22, 22, 4, 4, 23, 23, 5, 7, 20, 21, 21, 21, 21, 21, 21, 21, 22, 22, 4, 15, 22, 22, 4, 4,
+    18, 22, 22, 22, 20, 22, 23, 23, 16, 22, 5, 5, 21, 22, 23, 7, 18, 23, 22, 22, 18, 22, 22, 18, 22, 22, 5, 5, 22, 22, 5, 11,
+    11, 23, 4, 4, 23, 23, 4, 4, 4, 4, 4, 4, 5, 5, 5, 7, 19, 23, 22, 15, 23, 23, 4, 16, 4, 4, 4, 15, 4, 18, 4, 0,
+    18, 22, 22, 22, 20, 22, 23, 23, 21, 22, 23, 23, 21, 22, 23, 7, 18, 23, 22, 22, 18, 22, 22, 22, 21, 22, 5, 21, 22, 23, 3, 5,
+    19, 23, 22, 22, 19, 23, 4, 19, 22, 4, 4, 4, 22, 3, 3, 0, 19, 23, 22, 15, 23, 22, 1, 4, 23, 1, 1, 2, 0, 4, 0, 4,
+    0, 9, 8, 9, 11, 10, 9, 9, 6, 9, 8, 9, 11, 10, 9, 9, 16, 17, 13, 13, 18, 18, 9, 9, 9, 9, 9, 9, 10, 10, 9, 9,
+    14, 13, 12, 13, 13, 13, 13, 13, 8, 8, 9, 8, 8, 8, 8, 8, 16, 17, 13, 13, 17, 17, 13, 13, 12, 12, 12, 12, 8, 8, 8, 0,
+    22, 18, 18, 18, 19, 18, 18, 18, 10, 10, 10, 10, 10, 11, 11, 11, 21, 20, 20, 20, 18, 18, 18, 18, 18, 18, 10, 10, 19, 19, 11, 1,
+    16, 16, 16, 16, 20, 20, 16, 16, 0, 0, 0, 0, 1, 1, 0, 0, 17, 16, 16, 16, 21, 21, 16, 3, 3, 3, 2, 2, 4, 4, 0, 0,
+    0, 0, 22, 0, 14, 1, 0, 0, 3, 0, 23, 0, 14, 1, 0, 6, 6, 3, 2, 2, 4, 4, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+    1, 2, 22, 2, 2, 2, 2, 2, 22, 0, 22, 22, 0, 0, 5, 1, 6, 3, 2, 14, 3, 3, 2, 2, 2, 2, 4, 3, 0, 7, 4, 0,
+    0, 4, 4, 4, 15, 5, 5, 5, 14, 1, 1, 1, 14, 14, 2, 0, 7, 4, 4, 4, 4, 22, 4, 4, 5, 5, 1, 6, 3, 4, 2, 1,
+    6, 3, 3, 3, 4, 4, 3, 14, 9, 0, 22, 4, 14, 2, 3, 0, 6, 6, 0, 2, 1, 5, 0, 3, 6, 0, 1, 2, 0, 4, 0, 0,
+    0, 9, 8, 9, 11, 10, 9, 9, 6, 9, 8, 9, 11, 10, 9, 9, 16, 17, 13, 13, 18, 18, 9, 9, 9, 9, 9, 9, 10, 10, 9, 9,
+    14, 13, 12, 13, 13, 13, 13, 13, 8, 9, 8, 8, 9, 9, 8, 8, 16, 17, 13, 13, 17, 17, 13, 13, 13, 13, 12, 12, 9, 18, 8, 8,
+    22, 18, 18, 18, 19, 18, 18, 18, 11, 10, 10, 10, 10, 10, 10, 10, 21, 20, 20, 20, 18, 18, 18, 18, 18, 18, 10, 13, 18, 18, 10, 10,
+    16, 17, 17, 17, 20, 20, 17, 9, 9, 9, 8, 8, 10, 10, 6, 6, 16, 16, 16, 16, 20, 20, 16, 16, 16, 16, 12, 12, 18, 18, 0, 0,
+    0, 0, 4, 8, 2, 11, 0, 9, 3, 6, 23, 8, 14, 11, 0, 9, 0, 16, 2, 13, 4, 18, 0, 9, 0, 17, 0, 13, 1, 18, 0, 9,
+    1, 14, 22, 12, 2, 10, 2, 9, 22, 8, 22, 9, 0, 10, 23, 8, 6, 16, 2, 13, 3, 20, 2, 13, 2, 17, 22, 12, 4, 18, 4, 8,
+    0, 22, 4, 9, 15, 19, 5, 10, 14, 11, 1, 9, 14, 10, 14, 11, 7, 21, 4, 17, 4, 18, 4, 18, 5, 20, 2, 13, 15, 19, 2, 11,
+    6, 16, 3, 13, 4, 18, 0, 9, 0, 9, 22, 8, 14, 11, 3, 6, 6, 17, 6, 16, 7, 21, 0, 16, 6, 16, 1, 14, 0, 22, 0, 0,
+    0, 6, 14, 8, 23, 11, 9, 9, 0, 6, 8, 8, 11, 11, 9, 9, 3, 12, 14, 12, 23, 19, 9, 9, 9, 9, 13, 9, 18, 10, 9, 9,
+    4, 12, 16, 13, 8, 8, 12, 8, 22, 13, 21, 13, 8, 8, 8, 8, 15, 12, 16, 13, 12, 12, 12, 12, 20, 13, 17, 13, 8, 8, 12, 0,
+    3, 18, 10, 10, 21, 18, 19, 11, 15, 18, 11, 11, 16, 18, 11, 11, 21, 18, 18, 18, 21, 18, 19, 19, 17, 18, 11, 11, 20, 18, 19, 1,
+    6, 6, 18, 6, 12, 7, 6, 6, 9, 6, 19, 6, 12, 7, 6, 0, 6, 6, 10, 2, 8, 5, 6, 3, 9, 0, 19, 2, 12, 5, 6, 3,
+    0, 16, 20, 16, 16, 20, 12, 12, 12, 16, 20, 20, 16, 16, 16, 0, 6, 16, 20, 16, 17, 21, 14, 14, 9, 16, 20, 16, 17, 21, 3, 0,
+    19, 21, 20, 16, 8, 14, 15, 14, 19, 21, 20, 21, 12, 15, 22, 5, 11, 16, 20, 16, 8, 14, 15, 2, 18, 21, 20, 4, 8, 14, 4, 5,
+    12, 16, 11, 23, 17, 21, 22, 23, 12, 16, 19, 22, 17, 16, 15, 2, 8, 21, 11, 23, 17, 21, 22, 5, 13, 16, 11, 23, 17, 3, 3, 2,
+    9, 14, 19, 22, 12, 15, 6, 0, 9, 14, 19, 4, 12, 3, 3, 3, 9, 6, 11, 0, 8, 1, 0, 0, 9, 0, 5, 0, 2, 1, 3, 3,
+    0, 6, 14, 8, 23, 11, 9, 9, 6, 6, 8, 8, 11, 11, 9, 9, 3, 12, 14, 12, 23, 19, 9, 9, 9, 9, 9, 9, 10, 10, 9, 9,
+    15, 12, 15, 12, 13, 9, 8, 8, 17, 13, 17, 13, 8, 8, 8, 8, 15, 12, 15, 12, 13, 13, 12, 15, 13, 13, 13, 13, 8, 8, 8, 2,
+    22, 19, 18, 10, 21, 18, 10, 10, 20, 18, 11, 11, 20, 18, 11, 11, 22, 19, 18, 18, 21, 18, 18, 21, 18, 18, 11, 11, 18, 18, 11, 5,
+    0, 9, 8, 8, 10, 10, 6, 6, 6, 6, 6, 6, 7, 7, 6, 6, 6, 17, 8, 15, 10, 21, 6, 3, 6, 16, 6, 15, 7, 22, 6, 3,
+    0, 17, 21, 17, 16, 20, 12, 12, 3, 17, 21, 17, 16, 20, 9, 6, 0, 16, 16, 16, 20, 20, 12, 16, 16, 16, 16, 16, 20, 20, 0, 0,
+    22, 17, 21, 17, 12, 12, 12, 12, 21, 17, 21, 17, 12, 12, 23, 1, 17, 16, 17, 15, 14, 16, 14, 15, 16, 16, 16, 3, 14, 21, 5, 0,
+    15, 20, 19, 19, 16, 20, 19, 19, 16, 20, 19, 19, 16, 20, 14, 0, 20, 21, 23, 21, 20, 22, 23, 22, 21, 21, 23, 16, 21, 4, 2, 1,
+    6, 0, 10, 0, 9, 1, 0, 6, 0, 3, 22, 5, 15, 2, 3, 0, 6, 6, 6, 2, 7, 5, 0, 3, 6, 0, 1, 2, 0, 5, 3, 3,
+    2, 6, 14, 12, 7, 11, 8, 9, 1, 6, 8, 8, 7, 11, 8, 9, 14, 12, 14, 12, 10, 10, 9, 9, 13, 9, 13, 13, 9, 9, 9, 9,
+    4, 12, 16, 13, 8, 12, 13, 12, 22, 13, 21, 13, 9, 8, 9, 11, 15, 12, 16, 13, 12, 12, 12, 12, 17, 13, 17, 13, 12, 12, 12, 0,
+    3, 19, 10, 10, 23, 19, 10, 10, 2, 10, 10, 10, 10, 10, 11, 7, 5, 19, 10, 10, 19, 19, 10, 10, 10, 10, 10, 10, 11, 11, 11, 1,
+    7, 8, 18, 8, 8, 8, 8, 8, 18, 6, 18, 18, 6, 6, 11, 7, 7, 12, 18, 14, 8, 4, 8, 3, 18, 2, 18, 3, 6, 4, 19, 2,
+    23, 20, 21, 17, 2, 12, 13, 12, 23, 20, 21, 20, 14, 13, 18, 11, 18, 16, 20, 16, 14, 14, 14, 14, 20, 16, 20, 16, 14, 14, 19, 7,
+    19, 16, 20, 16, 16, 12, 16, 12, 19, 20, 20, 19, 16, 12, 19, 19, 18, 16, 20, 16, 15, 14, 15, 15, 20, 16, 23, 4, 15, 14, 23, 5,
+    0, 17, 18, 21, 15, 17, 2, 2, 15, 13, 19, 19, 14, 14, 15, 0, 11, 21, 18, 21, 3, 5, 1, 4, 19, 22, 19, 11, 15, 3, 3, 0,
+    11, 21, 18, 21, 13, 2, 3, 15, 18, 4, 23, 23, 15, 3, 23, 5, 11, 6, 0, 2, 7, 1, 0, 2, 1, 0, 5, 3, 2, 1, 4, 5,
+    0, 6, 14, 8, 7, 11, 8, 9, 6, 6, 8, 8, 7, 11, 8, 9, 14, 12, 14, 12, 10, 10, 9, 9, 9, 9, 13, 9, 10, 9, 9, 8,
+    15, 12, 15, 12, 12, 13, 8, 8, 17, 13, 17, 13, 9, 8, 9, 9, 15, 12, 15, 12, 13, 13, 12, 12, 17, 13, 13, 12, 8, 17, 10, 8,
+    4, 19, 10, 10, 23, 19, 10, 10, 11, 11, 10, 9, 10, 10, 10, 6, 23, 19, 18, 13, 19, 19, 10, 17, 10, 10, 10, 13, 10, 21, 10, 6,
+    0, 9, 8, 12, 9, 9, 8, 8, 8, 8, 10, 9, 6, 1, 10, 6, 0, 17, 8, 15, 9, 21, 8, 15, 8, 16, 18, 14, 10, 21, 10, 2,
+    5, 17, 21, 17, 2, 12, 13, 8, 22, 20, 21, 10, 2, 12, 10, 11, 16, 17, 16, 13, 12, 17, 12, 13, 17, 17, 17, 9, 12, 20, 11, 6,
+    22, 17, 21, 17, 13, 12, 13, 13, 21, 17, 19, 10, 13, 12, 19, 11, 16, 16, 16, 12, 12, 16, 3, 12, 16, 16, 19, 12, 16, 16, 19, 0,
+    2, 17, 10, 8, 15, 17, 6, 9, 14, 13, 18, 10, 14, 2, 10, 7, 1, 16, 9, 17, 4, 21, 5, 17, 0, 17, 19, 9, 14, 4, 2, 1,
+    7, 14, 9, 13, 0, 13, 9, 12, 4, 4, 19, 19, 15, 2, 23, 7, 6, 17, 0, 15, 7, 22, 0, 15, 6, 0, 23, 3, 2, 5, 4, 0,
+    5, 7, 6, 8, 23, 19, 11, 10, 0, 7, 6, 8, 11, 11, 11, 10, 23, 19, 9, 9, 23, 19, 10, 10, 18, 10, 10, 10, 18, 18, 10, 10,
+    4, 12, 14, 12, 9, 9, 9, 9, 5, 8, 9, 9, 8, 8, 8, 6, 2, 12, 12, 12, 9, 9, 9, 9, 8, 8, 8, 8, 8, 8, 8, 0,
+    3, 18, 10, 18, 21, 18, 18, 19, 15, 18, 10, 11, 16, 18, 10, 8, 21, 18, 18, 18, 21, 18, 19, 19, 20, 18, 19, 19, 20, 18, 19, 1,
+    6, 10, 10, 10, 13, 11, 11, 11, 12, 7, 7, 7, 12, 12, 8, 6, 6, 18, 10, 3, 13, 23, 11, 4, 12, 5, 7, 3, 12, 4, 12, 5,
+    14, 17, 5, 19, 16, 20, 18, 19, 14, 17, 23, 18, 16, 17, 13, 8, 13, 21, 23, 23, 17, 21, 23, 23, 17, 21, 23, 23, 17, 21, 12, 6,
+    1, 16, 22, 20, 13, 16, 5, 5, 13, 15, 23, 23, 12, 12, 13, 1, 8, 16, 4, 2, 13, 16, 0, 3, 12, 15, 22, 4, 12, 8, 4, 1,
+    12, 20, 20, 19, 16, 20, 20, 19, 12, 16, 20, 19, 16, 12, 12, 12, 13, 21, 22, 23, 17, 21, 22, 22, 17, 21, 22, 23, 14, 3, 14, 2,
+    8, 16, 18, 5, 13, 16, 4, 22, 13, 3, 22, 4, 14, 14, 14, 2, 8, 7, 6, 0, 1, 5, 1, 5, 0, 1, 5, 0, 2, 4, 3, 2,
+    1, 7, 6, 8, 23, 11, 11, 10, 7, 7, 6, 8, 11, 11, 11, 10, 23, 19, 9, 9, 23, 19, 10, 10, 10, 10, 9, 10, 18, 10, 10, 11,
+    3, 12, 14, 12, 9, 9, 9, 9, 8, 8, 8, 8, 9, 10, 8, 7, 14, 12, 12, 12, 13, 18, 9, 20, 9, 9, 8, 15, 9, 18, 8, 7,
+    22, 19, 19, 18, 21, 18, 10, 10, 20, 18, 10, 11, 20, 18, 10, 10, 22, 19, 18, 18, 21, 18, 18, 18, 20, 18, 11, 20, 18, 19, 9, 11,
+    1, 10, 10, 10, 10, 18, 10, 10, 11, 11, 7, 0, 9, 10, 8, 7, 1, 20, 10, 16, 10, 21, 10, 21, 11, 21, 8, 15, 13, 23, 8, 5,
+    2, 20, 5, 19, 16, 20, 18, 11, 15, 17, 5, 19, 16, 9, 9, 8, 21, 20, 19, 20, 21, 18, 19, 18, 20, 20, 19, 17, 20, 10, 8, 7,
+    5, 20, 22, 20, 9, 11, 7, 10, 23, 18, 23, 5, 13, 9, 9, 6, 0, 17, 3, 16, 10, 20, 2, 16, 1, 16, 23, 3, 12, 10, 5, 0,
+    15, 20, 18, 19, 16, 20, 18, 18, 16, 20, 18, 19, 12, 9, 12, 8, 20, 20, 19, 20, 20, 19, 4, 19, 20, 20, 20, 20, 12, 19, 12, 1,
+    6, 23, 1, 18, 10, 18, 10, 19, 3, 3, 22, 5, 12, 12, 14, 6, 7, 20, 6, 15, 1, 22, 1, 22, 7, 1, 5, 2, 14, 4, 3, 1,
+    0, 6, 0, 8, 1, 11, 6, 9, 0, 6, 6, 8, 7, 11, 6, 9, 3, 9, 12, 9, 19, 10, 9, 9, 9, 9, 9, 9, 10, 10, 9, 6,
+    4, 12, 14, 12, 8, 9, 8, 9, 5, 8, 9, 9, 8, 8, 10, 11, 14, 12, 14, 12, 13, 13, 9, 14, 12, 8, 13, 10, 8, 8, 10, 7,
+    3, 19, 11, 10, 23, 19, 11, 10, 2, 10, 10, 10, 10, 10, 9, 8, 23, 19, 18, 18, 23, 19, 10, 23, 18, 10, 10, 10, 18, 9, 9, 6,
+    0, 9, 9, 9, 10, 10, 9, 12, 3, 6, 18, 10, 12, 8, 9, 6, 0, 17, 9, 15, 10, 22, 6, 3, 6, 3, 18, 2, 12, 5, 9, 0,
+    3, 12, 23, 18, 14, 13, 0, 6, 3, 12, 23, 10, 14, 9, 9, 9, 0, 6, 4, 6, 3, 7, 6, 0, 6, 9, 18, 11, 13, 8, 9, 6,
+    5, 20, 22, 20, 15, 8, 9, 13, 22, 10, 19, 19, 13, 9, 19, 11, 1, 12, 3, 15, 6, 15, 3, 14, 10, 10, 23, 23, 13, 8, 19, 1,
+    2, 17, 22, 11, 15, 17, 10, 18, 15, 9, 18, 10, 12, 12, 12, 8, 0, 19, 7, 22, 4, 22, 4, 23, 9, 9, 18, 11, 14, 14, 12, 0,
+    0, 0, 19, 16, 12, 20, 16, 12, 16, 3, 19, 19, 12, 12, 12, 0, 6, 6, 0, 2, 1, 5, 0, 3, 0, 0, 23, 3, 14, 4, 3, 0,
+    0, 6, 6, 8, 7, 11, 6, 9, 6, 6, 6, 8, 7, 11, 6, 6, 3, 9, 12, 9, 19, 10, 9, 9, 9, 9, 9, 8, 10, 11, 6, 9,
+    3, 12, 14, 12, 8, 7, 8, 8, 8, 8, 7, 8, 6, 7, 7, 8, 14, 12, 12, 13, 13, 18, 6, 9, 12, 6, 7, 8, 6, 11, 7, 8,
+    4, 19, 11, 6, 23, 19, 11, 11, 11, 11, 7, 6, 6, 10, 6, 10, 23, 19, 18, 13, 19, 18, 7, 10, 19, 7, 7, 8, 6, 10, 6, 10,
+    0, 0, 6, 8, 7, 11, 6, 9, 0, 6, 7, 8, 6, 10, 6, 6, 0, 16, 0, 17, 1, 20, 6, 17, 0, 17, 7, 12, 6, 18, 6, 6,
+    3, 0, 5, 6, 2, 7, 6, 6, 3, 6, 11, 6, 8, 7, 9, 9, 0, 0, 0, 8, 1, 11, 6, 9, 0, 6, 7, 8, 6, 11, 9, 9,
+    5, 0, 6, 8, 1, 7, 6, 8, 7, 6, 11, 9, 8, 7, 10, 11, 0, 16, 6, 13, 1, 18, 6, 13, 0, 6, 19, 9, 8, 11, 10, 6,
+    2, 1, 0, 6, 7, 11, 7, 11, 6, 7, 11, 6, 8, 10, 9, 8, 1, 21, 0, 13, 7, 18, 7, 18, 1, 7, 11, 8, 12, 10, 9, 7,
+    0, 0, 6, 8, 7, 11, 6, 9, 6, 6, 19, 9, 12, 10, 9, 6, 0, 16, 0, 16, 1, 20, 0, 16, 0, 16, 19, 12, 12, 19, 3, 0,
+    12, 12, 16, 16, 12, 12, 12, 12, 20, 16, 20, 16, 19, 3, 19, 3, 12, 12, 14, 14, 15, 15, 14, 14, 4, 15, 4, 15, 4, 3, 4, 3,
+    13, 14, 16, 15, 2, 14, 3, 14, 22, 16, 21, 16, 4, 3, 4, 3, 12, 14, 14, 14, 2, 15, 2, 14, 4, 3, 4, 15, 4, 3, 4, 3,
+    8, 12, 0, 14, 7, 2, 0, 2, 11, 2, 5, 3, 1, 2, 5, 3, 8, 12, 0, 14, 7, 2, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    6, 12, 0, 2, 0, 2, 0, 2, 11, 2, 5, 3, 1, 2, 5, 3, 8, 12, 0, 14, 0, 2, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    10, 2, 21, 3, 1, 2, 4, 3, 19, 4, 22, 22, 22, 4, 23, 4, 6, 2, 2, 2, 0, 2, 2, 2, 5, 3, 4, 3, 5, 3, 4, 3,
+    10, 2, 21, 3, 1, 2, 4, 3, 23, 4, 22, 4, 5, 4, 4, 4, 6, 2, 2, 2, 0, 2, 2, 2, 5, 3, 4, 3, 5, 3, 4, 3,
+    11, 0, 1, 2, 6, 0, 1, 2, 11, 1, 23, 4, 1, 1, 5, 4, 6, 6, 0, 2, 7, 0, 0, 2, 7, 0, 1, 2, 1, 0, 1, 2,
+    7, 0, 1, 2, 1, 0, 1, 2, 11, 1, 5, 4, 1, 1, 5, 4, 6, 0, 0, 2, 0, 0, 0, 2, 1, 0, 1, 2, 1, 0, 1, 1,
+    14, 14, 12, 12, 13, 13, 12, 12, 10, 13, 10, 13, 10, 9, 10, 9, 16, 16, 12, 12, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    14, 13, 17, 13, 14, 14, 14, 14, 17, 13, 17, 13, 12, 12, 12, 12, 13, 17, 14, 14, 15, 15, 14, 14, 15, 14, 15, 14, 14, 14, 14, 14,
+    18, 17, 15, 15, 18, 20, 15, 15, 14, 14, 2, 14, 2, 2, 2, 2, 18, 17, 15, 15, 18, 20, 15, 15, 3, 15, 14, 14, 3, 3, 2, 1,
+    13, 17, 14, 15, 16, 16, 15, 15, 14, 2, 3, 2, 2, 2, 2, 2, 13, 17, 14, 15, 16, 16, 15, 15, 2, 3, 14, 14, 3, 3, 2, 2,
+    13, 14, 16, 15, 2, 2, 2, 2, 18, 16, 18, 16, 11, 2, 11, 2, 12, 14, 14, 14, 3, 3, 2, 2, 15, 15, 15, 15, 2, 2, 2, 2,
+    13, 14, 16, 15, 2, 2, 3, 2, 20, 16, 20, 16, 3, 2, 3, 5, 12, 14, 14, 14, 2, 3, 2, 2, 15, 15, 15, 15, 3, 2, 3, 3,
+    10, 12, 14, 14, 19, 3, 3, 3, 2, 2, 3, 3, 2, 2, 2, 0, 10, 12, 14, 14, 19, 3, 3, 3, 2, 2, 2, 2, 3, 4, 2, 1,
+    9, 12, 14, 14, 2, 3, 2, 3, 2, 2, 3, 3, 2, 2, 4, 5, 9, 12, 14, 14, 2, 1, 2, 2, 2, 2, 1, 2, 0, 1, 1, 2,
+    15, 12, 17, 13, 8, 12, 9, 12, 18, 17, 20, 17, 10, 9, 10, 9, 12, 15, 16, 15, 12, 12, 12, 12, 16, 15, 16, 15, 14, 14, 14, 14,
+    16, 16, 16, 16, 12, 12, 12, 12, 20, 16, 20, 16, 19, 12, 19, 12, 17, 15, 16, 15, 14, 14, 14, 14, 21, 15, 16, 15, 3, 14, 3, 14,
+    8, 12, 14, 14, 15, 15, 3, 15, 19, 3, 23, 3, 22, 3, 4, 3, 12, 12, 14, 14, 15, 15, 15, 15, 4, 3, 4, 3, 3, 3, 3, 3,
+    9, 12, 14, 14, 3, 15, 3, 3, 19, 3, 23, 3, 4, 3, 4, 3, 12, 12, 14, 14, 15, 15, 3, 15, 4, 3, 4, 3, 4, 3, 3, 2,
+    18, 16, 21, 21, 19, 4, 19, 4, 21, 21, 21, 21, 19, 23, 19, 23, 17, 15, 16, 15, 3, 3, 3, 3, 21, 3, 21, 3, 4, 3, 4, 3,
+    20, 16, 21, 16, 23, 4, 23, 4, 21, 21, 21, 21, 23, 4, 23, 4, 17, 15, 16, 15, 3, 3, 3, 3, 21, 3, 21, 3, 4, 3, 4, 4,
+    10, 3, 23, 3, 22, 3, 4, 4, 19, 4, 23, 4, 22, 4, 22, 4, 9, 14, 3, 3, 3, 3, 3, 3, 23, 3, 4, 3, 4, 3, 4, 0,
+    10, 3, 23, 3, 4, 3, 4, 3, 19, 4, 23, 4, 22, 4, 4, 5, 9, 14, 3, 3, 3, 3, 3, 2, 23, 3, 4, 4, 4, 0, 5, 4,
+    14, 12, 12, 12, 8, 13, 8, 12, 10, 9, 10, 13, 10, 9, 10, 9, 15, 16, 12, 12, 13, 13, 12, 12, 13, 12, 13, 12, 12, 12, 12, 12,
+    16, 13, 17, 13, 12, 12, 12, 12, 20, 13, 17, 13, 9, 12, 9, 12, 12, 12, 16, 12, 12, 12, 12, 12, 16, 12, 16, 12, 12, 12, 12, 12,
+    17, 17, 15, 15, 21, 16, 15, 15, 14, 14, 14, 14, 14, 14, 2, 8, 17, 17, 15, 15, 16, 16, 15, 15, 14, 14, 14, 14, 14, 14, 14, 6,
+    13, 17, 14, 15, 15, 15, 15, 15, 15, 14, 15, 17, 2, 2, 2, 8, 13, 17, 14, 15, 16, 15, 15, 14, 15, 14, 15, 15, 14, 4, 16, 14,
+    21, 16, 20, 16, 10, 14, 10, 14, 18, 20, 18, 20, 10, 10, 10, 6, 17, 15, 16, 15, 14, 14, 14, 14, 16, 15, 16, 15, 2, 2, 2, 6,
+    17, 16, 16, 16, 15, 14, 15, 17, 20, 16, 20, 16, 18, 2, 21, 21, 17, 15, 16, 15, 15, 14, 15, 15, 16, 15, 16, 16, 3, 2, 21, 3,
+    8, 14, 14, 14, 2, 2, 2, 2, 3, 3, 3, 3, 2, 2, 2, 6, 12, 12, 14, 14, 15, 15, 2, 4, 15, 3, 15, 12, 2, 4, 3, 1,
+    12, 14, 14, 14, 3, 2, 3, 17, 15, 3, 22, 21, 3, 3, 22, 5, 12, 14, 14, 15, 14, 1, 0, 2, 15, 0, 22, 3, 0, 1, 5, 3,
+    2, 14, 6, 12, 1, 8, 6, 8, 5, 8, 11, 9, 7, 8, 11, 9, 22, 16, 13, 13, 22, 21, 13, 13, 12, 12, 8, 12, 8, 8, 8, 8,
+    2, 14, 12, 12, 13, 13, 9, 13, 23, 9, 19, 9, 18, 9, 10, 9, 16, 16, 13, 13, 20, 17, 13, 13, 12, 12, 12, 12, 12, 12, 8, 2,
+    1, 20, 16, 16, 19, 20, 20, 20, 12, 12, 20, 12, 12, 12, 16, 0, 19, 20, 21, 16, 19, 20, 21, 21, 8, 15, 14, 14, 12, 4, 14, 1,
+    7, 20, 16, 16, 10, 20, 16, 16, 13, 14, 21, 14, 13, 2, 21, 0, 11, 20, 16, 16, 18, 20, 21, 3, 8, 15, 14, 2, 8, 4, 14, 1,
+    2, 10, 18, 10, 14, 11, 18, 11, 21, 19, 18, 11, 16, 11, 18, 11, 10, 18, 6, 6, 10, 19, 6, 6, 12, 6, 7, 6, 12, 6, 7, 0,
+    6, 10, 18, 18, 13, 11, 18, 11, 21, 19, 18, 19, 20, 19, 18, 5, 10, 10, 10, 2, 10, 19, 1, 2, 8, 7, 23, 4, 12, 6, 5, 4,
+    8, 11, 16, 22, 12, 19, 16, 22, 13, 6, 21, 23, 13, 14, 16, 2, 10, 19, 23, 22, 10, 19, 23, 4, 8, 7, 14, 2, 12, 3, 2, 2,
+    8, 11, 21, 23, 9, 11, 16, 22, 13, 6, 21, 5, 13, 2, 4, 2, 10, 11, 7, 0, 10, 1, 1, 0, 8, 1, 1, 1, 0, 3, 1, 1,
+    2, 14, 6, 12, 1, 8, 6, 8, 7, 8, 7, 8, 7, 8, 7, 8, 22, 16, 13, 13, 22, 21, 13, 13, 9, 13, 12, 12, 9, 9, 8, 7,
+    14, 14, 12, 12, 13, 13, 13, 13, 10, 9, 10, 9, 9, 9, 9, 9, 16, 16, 13, 13, 17, 17, 13, 13, 12, 12, 12, 12, 12, 12, 12, 0,
+    23, 21, 20, 17, 23, 21, 20, 20, 2, 13, 12, 12, 14, 10, 12, 7, 19, 20, 16, 16, 19, 20, 20, 19, 16, 16, 12, 12, 16, 19, 12, 1,
+    18, 20, 16, 16, 20, 20, 16, 16, 14, 14, 14, 14, 14, 11, 14, 7, 18, 20, 16, 16, 20, 20, 16, 4, 15, 15, 14, 14, 15, 23, 14, 1,
+    2, 10, 19, 10, 2, 10, 10, 10, 23, 10, 19, 10, 10, 11, 10, 7, 11, 18, 8, 8, 18, 18, 6, 10, 8, 8, 8, 8, 6, 11, 6, 7,
+    1, 10, 19, 10, 10, 10, 10, 10, 19, 10, 19, 10, 11, 11, 11, 1, 11, 18, 13, 14, 18, 18, 2, 2, 8, 8, 22, 3, 6, 19, 4, 2,
+    7, 18, 21, 21, 18, 19, 22, 19, 14, 2, 17, 2, 14, 14, 14, 0, 11, 18, 21, 21, 18, 23, 22, 23, 13, 3, 2, 14, 15, 4, 2, 1,
+    11, 18, 21, 21, 19, 19, 22, 11, 2, 1, 23, 4, 14, 2, 3, 0, 11, 18, 6, 2, 19, 5, 0, 3, 7, 0, 1, 2, 2, 4, 1, 1,
+    0, 14, 6, 8, 6, 8, 6, 8, 5, 8, 11, 9, 7, 8, 11, 9, 15, 16, 12, 13, 17, 17, 13, 13, 12, 8, 9, 8, 8, 8, 8, 8,
+    3, 14, 12, 12, 9, 13, 9, 9, 23, 9, 19, 9, 10, 9, 10, 9, 15, 16, 12, 13, 13, 13, 13, 13, 13, 12, 13, 16, 8, 8, 8, 2,
+    1, 21, 17, 17, 4, 21, 17, 17, 15, 12, 20, 12, 15, 8, 20, 6, 22, 21, 17, 17, 21, 21, 17, 17, 12, 12, 12, 12, 12, 5, 12, 1,
+    0, 16, 16, 16, 16, 16, 16, 16, 20, 12, 20, 20, 20, 0, 20, 1, 17, 17, 16, 15, 16, 16, 16, 3, 14, 14, 16, 15, 14, 5, 21, 0,
+    22, 18, 19, 10, 20, 11, 18, 11, 21, 10, 18, 10, 20, 11, 18, 11, 0, 8, 9, 8, 6, 6, 6, 6, 10, 6, 10, 6, 7, 6, 7, 7,
+    22, 18, 19, 18, 18, 11, 18, 11, 21, 18, 18, 21, 18, 11, 22, 5, 6, 9, 20, 16, 6, 6, 21, 15, 10, 6, 21, 21, 7, 6, 22, 4,
+    2, 10, 20, 19, 16, 19, 20, 19, 16, 19, 20, 19, 16, 14, 2, 0, 7, 10, 0, 0, 1, 4, 3, 5, 9, 0, 1, 7, 15, 3, 2, 0,
+    7, 9, 21, 21, 21, 23, 21, 16, 20, 5, 22, 22, 3, 2, 4, 1, 6, 6, 7, 2, 7, 1, 1, 2, 7, 1, 22, 4, 0, 3, 5, 4,
+    2, 14, 6, 12, 6, 8, 6, 8, 7, 8, 7, 8, 7, 8, 7, 8, 15, 16, 12, 13, 17, 17, 13, 13, 8, 9, 12, 12, 9, 9, 8, 8,
+    14, 14, 12, 12, 13, 13, 9, 13, 10, 9, 10, 9, 10, 9, 9, 8, 15, 16, 12, 13, 17, 13, 13, 12, 13, 12, 13, 13, 12, 10, 17, 12,
+    5, 21, 17, 17, 22, 21, 20, 9, 2, 13, 12, 8, 2, 10, 12, 7, 22, 21, 17, 17, 21, 21, 17, 10, 13, 13, 12, 12, 13, 19, 12, 7,
+    16, 16, 17, 13, 17, 17, 17, 9, 12, 12, 17, 13, 12, 11, 20, 6, 16, 16, 16, 12, 16, 19, 16, 12, 12, 3, 16, 12, 16, 19, 16, 0,
+    4, 10, 19, 10, 11, 10, 11, 9, 23, 10, 19, 10, 10, 10, 10, 6, 0, 8, 9, 12, 8, 10, 8, 9, 9, 8, 9, 9, 6, 10, 1, 6,
+    23, 18, 19, 17, 10, 10, 10, 13, 19, 10, 21, 17, 10, 10, 21, 6, 0, 8, 17, 16, 8, 18, 16, 14, 9, 8, 21, 16, 10, 10, 21, 2,
+    0, 10, 17, 12, 3, 11, 13, 10, 15, 6, 13, 9, 14, 10, 2, 7, 7, 10, 14, 13, 5, 19, 4, 10, 2, 9, 13, 8, 15, 23, 2, 7,
+    6, 9, 20, 17, 2, 10, 21, 13, 5, 5, 21, 21, 14, 2, 22, 1, 6, 0, 17, 15, 6, 5, 0, 3, 7, 0, 22, 15, 0, 4, 5, 2,
+    4, 8, 18, 9, 7, 8, 10, 9, 23, 10, 18, 18, 18, 10, 19, 10, 15, 12, 17, 13, 8, 8, 8, 8, 22, 17, 22, 17, 5, 8, 5, 8,
+    22, 17, 20, 20, 23, 10, 23, 10, 18, 18, 18, 18, 23, 19, 23, 19, 20, 17, 21, 17, 4, 12, 4, 12, 22, 21, 22, 21, 4, 4, 4, 0,
+    8, 4, 22, 4, 12, 5, 22, 5, 20, 23, 22, 5, 17, 5, 22, 5, 8, 4, 23, 4, 8, 4, 4, 4, 19, 4, 23, 4, 4, 5, 4, 1,
+    18, 22, 23, 4, 21, 5, 22, 5, 18, 4, 22, 4, 21, 5, 22, 5, 10, 4, 23, 4, 5, 4, 5, 3, 19, 4, 23, 4, 4, 4, 4, 0,
+    18, 18, 18, 18, 20, 19, 19, 19, 20, 19, 19, 19, 20, 19, 19, 19, 18, 21, 21, 21, 4, 4, 4, 4, 23, 22, 22, 22, 4, 5, 5, 5,
+    18, 21, 21, 21, 22, 23, 23, 23, 18, 22, 22, 22, 22, 23, 23, 23, 18, 21, 21, 21, 5, 4, 4, 4, 23, 22, 22, 22, 4, 4, 4, 4,
+    9, 4, 22, 22, 13, 4, 22, 5, 20, 4, 22, 23, 17, 4, 22, 2, 9, 5, 23, 4, 8, 4, 4, 4, 19, 5, 23, 4, 4, 3, 4, 2,
+    18, 5, 23, 22, 21, 4, 22, 5, 18, 4, 22, 4, 21, 4, 4, 4, 10, 5, 23, 0, 5, 1, 5, 0, 19, 5, 5, 5, 0, 0, 4, 4,
+    0, 8, 8, 8, 6, 8, 8, 8, 11, 9, 10, 9, 11, 9, 10, 9, 14, 12, 12, 12, 9, 9, 8, 8, 13, 13, 13, 13, 8, 8, 8, 8,
+    16, 13, 17, 13, 9, 9, 9, 9, 18, 9, 18, 9, 10, 9, 10, 9, 16, 13, 17, 13, 12, 12, 12, 12, 17, 13, 17, 13, 8, 8, 8, 0,
+    4, 22, 0, 0, 4, 23, 0, 0, 14, 0, 1, 0, 14, 0, 1, 6, 5, 22, 2, 2, 22, 22, 0, 4, 2, 2, 2, 2, 0, 5, 0, 1,
+    6, 2, 3, 2, 0, 0, 0, 0, 4, 0, 4, 0, 1, 0, 1, 1, 6, 2, 3, 14, 2, 4, 2, 3, 3, 2, 3, 3, 0, 4, 7, 0,
+    22, 18, 18, 18, 10, 10, 10, 10, 19, 18, 18, 18, 10, 11, 11, 11, 16, 16, 16, 16, 0, 0, 0, 0, 20, 16, 20, 16, 1, 0, 1, 1,
+    21, 20, 20, 20, 18, 10, 18, 10, 18, 18, 18, 18, 19, 11, 23, 5, 17, 16, 16, 16, 3, 2, 3, 3, 21, 16, 22, 4, 4, 0, 22, 4,
+    0, 4, 4, 4, 15, 1, 1, 1, 15, 5, 5, 5, 14, 2, 15, 0, 7, 3, 3, 3, 18, 4, 0, 4, 4, 3, 4, 23, 15, 3, 3, 0,
+    7, 4, 4, 4, 5, 1, 5, 22, 4, 4, 22, 4, 3, 3, 4, 5, 6, 0, 7, 2, 7, 1, 1, 2, 1, 1, 5, 4, 0, 0, 4, 4,
+    4, 8, 18, 9, 7, 8, 10, 9, 19, 10, 18, 10, 11, 10, 10, 10, 15, 12, 17, 13, 8, 8, 9, 8, 21, 17, 21, 17, 9, 8, 9, 11,
+    21, 17, 20, 17, 19, 10, 19, 10, 18, 18, 18, 18, 19, 10, 19, 10, 16, 17, 17, 17, 13, 12, 13, 16, 21, 17, 21, 17, 22, 8, 18, 18,
+    0, 4, 22, 22, 15, 5, 22, 5, 20, 23, 22, 23, 21, 23, 22, 11, 7, 4, 23, 4, 4, 4, 4, 4, 23, 4, 23, 4, 5, 5, 5, 7,
+    18, 22, 23, 22, 22, 5, 22, 5, 18, 22, 22, 18, 22, 5, 18, 11, 19, 22, 23, 16, 4, 4, 4, 15, 23, 4, 20, 16, 4, 4, 18, 0,
+    22, 18, 18, 18, 18, 19, 19, 19, 21, 18, 18, 18, 18, 19, 19, 19, 20, 21, 21, 21, 22, 4, 22, 4, 21, 21, 21, 21, 23, 5, 19, 11,
+    19, 20, 20, 20, 19, 19, 19, 19, 18, 18, 18, 18, 19, 19, 19, 19, 20, 21, 21, 21, 22, 4, 21, 16, 21, 21, 21, 21, 22, 4, 22, 22,
+    18, 22, 22, 22, 21, 23, 22, 23, 20, 23, 22, 19, 21, 14, 22, 7, 19, 22, 23, 22, 22, 4, 4, 4, 19, 4, 23, 19, 15, 3, 19, 0,
+    18, 22, 23, 21, 21, 5, 22, 21, 18, 22, 22, 22, 22, 3, 23, 23, 19, 6, 23, 15, 7, 1, 21, 2, 23, 1, 22, 22, 0, 0, 22, 4,
+    0, 8, 8, 8, 6, 8, 8, 8, 11, 9, 10, 9, 11, 9, 10, 9, 14, 12, 12, 12, 8, 9, 8, 8, 13, 13, 13, 13, 9, 8, 9, 9,
+    16, 13, 17, 13, 9, 9, 9, 9, 18, 9, 18, 9, 10, 9, 10, 10, 16, 13, 17, 13, 13, 12, 13, 13, 17, 13, 17, 17, 9, 8, 18, 9,
+    4, 4, 4, 8, 4, 23, 7, 8, 2, 1, 19, 10, 14, 0, 11, 10, 5, 22, 15, 12, 22, 22, 8, 8, 2, 2, 18, 9, 0, 23, 10, 8,
+    0, 3, 21, 17, 0, 0, 20, 13, 4, 0, 18, 18, 1, 0, 18, 10, 6, 2, 16, 17, 2, 22, 17, 12, 3, 2, 20, 17, 4, 4, 18, 8,
+    22, 18, 18, 18, 11, 10, 10, 10, 19, 18, 18, 18, 10, 10, 10, 10, 16, 17, 17, 17, 9, 8, 9, 9, 20, 17, 18, 10, 10, 6, 18, 10,
+    21, 20, 20, 20, 18, 10, 20, 17, 18, 18, 18, 18, 18, 10, 18, 18, 16, 16, 16, 16, 16, 12, 20, 16, 20, 16, 20, 20, 18, 0, 18, 18,
+    0, 4, 22, 9, 14, 1, 19, 9, 15, 5, 19, 10, 15, 14, 18, 11, 6, 3, 21, 13, 0, 22, 18, 8, 5, 1, 18, 10, 15, 3, 19, 7,
+    7, 4, 21, 17, 4, 3, 20, 17, 4, 4, 18, 18, 15, 3, 19, 19, 7, 6, 20, 16, 7, 1, 21, 15, 7, 1, 21, 21, 0, 0, 22, 4,
+    5, 6, 7, 8, 0, 6, 7, 8, 5, 7, 19, 10, 7, 7, 11, 10, 4, 14, 12, 12, 23, 9, 9, 9, 8, 8, 9, 9, 8, 8, 8, 6,
+    4, 9, 19, 9, 18, 9, 10, 10, 23, 10, 19, 10, 18, 10, 18, 10, 2, 12, 12, 12, 8, 8, 8, 8, 9, 9, 9, 9, 8, 8, 8, 0,
+    2, 5, 17, 18, 14, 23, 17, 18, 15, 0, 20, 19, 15, 12, 17, 8, 1, 22, 20, 20, 22, 23, 18, 23, 12, 8, 16, 8, 12, 12, 12, 6,
+    8, 4, 21, 23, 17, 23, 21, 23, 17, 23, 21, 23, 17, 12, 8, 6, 6, 4, 16, 14, 9, 5, 15, 4, 13, 0, 15, 3, 12, 4, 8, 1,
+    3, 10, 18, 18, 15, 10, 18, 11, 21, 10, 18, 19, 16, 10, 18, 8, 6, 10, 10, 10, 13, 7, 7, 7, 13, 11, 11, 11, 12, 8, 13, 6,
+    21, 18, 18, 18, 20, 19, 18, 19, 21, 19, 18, 23, 20, 12, 18, 1, 6, 10, 18, 3, 12, 7, 23, 3, 13, 11, 23, 4, 13, 12, 22, 5,
+    12, 20, 20, 19, 12, 20, 16, 19, 16, 20, 20, 20, 16, 12, 12, 12, 8, 18, 16, 5, 13, 22, 3, 4, 13, 16, 21, 22, 14, 14, 14, 2,
+    13, 22, 21, 23, 17, 22, 21, 23, 17, 4, 22, 22, 14, 14, 3, 2, 8, 6, 7, 0, 0, 5, 1, 0, 1, 1, 5, 5, 2, 3, 4, 2,
+    0, 0, 6, 8, 1, 6, 6, 8, 1, 6, 7, 8, 7, 6, 7, 8, 4, 14, 12, 12, 23, 9, 9, 9, 8, 8, 8, 8, 9, 10, 8, 7,
+    3, 12, 9, 9, 9, 9, 9, 9, 19, 9, 10, 9, 10, 9, 10, 6, 14, 14, 12, 12, 13, 13, 8, 10, 13, 9, 13, 14, 8, 10, 9, 7,
+    4, 23, 19, 18, 4, 23, 19, 10, 2, 1, 12, 8, 14, 9, 8, 8, 5, 22, 20, 20, 22, 19, 18, 19, 15, 9, 8, 12, 13, 10, 8, 7,
+    1, 4, 6, 6, 7, 10, 9, 11, 3, 6, 7, 1, 13, 9, 8, 6, 1, 4, 12, 15, 11, 23, 10, 4, 8, 3, 15, 2, 13, 19, 8, 1,
+    3, 11, 19, 10, 2, 10, 10, 10, 23, 11, 19, 10, 10, 9, 10, 8, 1, 9, 9, 9, 21, 10, 6, 10, 10, 9, 10, 19, 13, 9, 9, 6,
+    23, 18, 19, 18, 18, 10, 10, 10, 23, 10, 19, 23, 13, 9, 23, 6, 0, 9, 20, 15, 6, 18, 21, 2, 11, 7, 22, 4, 13, 9, 23, 1,
+    2, 22, 17, 11, 15, 18, 9, 10, 15, 17, 20, 18, 12, 12, 12, 8, 1, 19, 0, 16, 20, 19, 3, 19, 12, 16, 20, 19, 12, 12, 12, 0,
+    0, 7, 19, 22, 9, 18, 23, 11, 4, 4, 22, 23, 14, 12, 14, 0, 7, 0, 7, 2, 0, 5, 1, 3, 1, 1, 5, 4, 14, 3, 4, 0,
+    1, 6, 7, 8, 7, 6, 7, 8, 5, 7, 11, 10, 7, 7, 11, 10, 3, 14, 12, 12, 8, 9, 8, 9, 8, 8, 9, 9, 8, 8, 10, 11,
+    4, 9, 19, 9, 10, 9, 10, 9, 23, 10, 19, 10, 18, 10, 10, 11, 14, 12, 12, 12, 9, 8, 9, 16, 13, 9, 18, 20, 9, 9, 18, 11,
+    2, 5, 20, 19, 3, 5, 17, 18, 15, 0, 20, 11, 15, 8, 10, 8, 5, 22, 20, 20, 23, 23, 18, 5, 8, 7, 19, 10, 12, 8, 9, 6,
+    1, 3, 20, 20, 20, 19, 20, 17, 21, 11, 18, 18, 9, 8, 10, 7, 0, 3, 21, 16, 8, 4, 20, 15, 11, 11, 20, 20, 12, 8, 18, 7,
+    22, 11, 19, 18, 20, 10, 18, 11, 21, 10, 18, 10, 20, 10, 10, 10, 1, 10, 10, 10, 11, 7, 11, 18, 10, 10, 18, 10, 9, 9, 10, 11,
+    22, 18, 19, 20, 20, 11, 18, 20, 21, 18, 18, 18, 18, 9, 19, 19, 1, 10, 20, 16, 10, 9, 21, 16, 10, 10, 21, 21, 13, 9, 23, 23,
+    15, 18, 20, 19, 16, 18, 20, 19, 16, 10, 18, 18, 12, 12, 9, 8, 6, 1, 23, 18, 3, 22, 19, 5, 10, 10, 18, 19, 12, 14, 12, 6,
+    20, 19, 20, 20, 20, 20, 20, 20, 20, 4, 19, 19, 12, 12, 19, 1, 7, 6, 20, 15, 7, 1, 21, 2, 1, 1, 22, 22, 14, 3, 23, 5,
+    0, 6, 6, 8, 6, 6, 6, 8, 7, 6, 7, 8, 7, 6, 7, 7, 3, 14, 12, 12, 8, 7, 8, 8, 8, 8, 7, 8, 6, 7, 7, 8,
+    3, 12, 9, 9, 9, 9, 9, 8, 19, 9, 10, 10, 10, 6, 11, 10, 14, 12, 12, 13, 12, 7, 6, 8, 13, 6, 18, 9, 6, 7, 11, 9,
+    4, 5, 1, 6, 4, 7, 7, 6, 2, 7, 7, 7, 6, 9, 7, 7, 5, 22, 0, 8, 23, 11, 6, 9, 1, 6, 7, 8, 8, 10, 7, 7,
+    0, 0, 1, 8, 1, 7, 7, 8, 1, 7, 18, 10, 6, 9, 11, 10, 0, 6, 16, 13, 0, 11, 6, 9, 1, 6, 18, 13, 6, 10, 11, 8,
+    4, 11, 19, 6, 11, 7, 11, 6, 23, 11, 11, 11, 6, 6, 10, 10, 0, 6, 1, 8, 1, 7, 7, 8, 7, 7, 11, 10, 6, 6, 10, 10,
+    23, 0, 19, 13, 1, 7, 20, 8, 19, 7, 18, 18, 6, 6, 18, 10, 1, 0, 21, 17, 1, 7, 20, 13, 1, 7, 20, 20, 6, 6, 18, 10,
+    2, 0, 1, 6, 6, 11, 7, 6, 7, 7, 11, 11, 8, 9, 10, 8, 1, 6, 1, 8, 6, 11, 7, 9, 7, 7, 11, 10, 12, 9, 10, 6,
+    1, 0, 21, 13, 1, 7, 20, 8, 7, 7, 18, 18, 12, 9, 19, 11, 1, 0, 20, 16, 1, 19, 20, 12, 1, 1, 20, 20, 12, 3, 19, 1,
+    12, 16, 16, 12, 20, 16, 16, 16, 20, 16, 16, 16, 12, 12, 12, 12, 13, 17, 12, 14, 20, 16, 16, 16, 15, 15, 15, 15, 2, 14, 14, 14,
+    12, 12, 13, 14, 15, 15, 15, 15, 20, 16, 16, 16, 2, 14, 14, 14, 12, 12, 12, 14, 15, 15, 15, 15, 15, 15, 15, 15, 2, 2, 2, 14,
+    10, 13, 12, 14, 18, 20, 15, 15, 11, 2, 0, 2, 6, 2, 2, 2, 9, 13, 12, 14, 18, 20, 15, 15, 7, 2, 0, 2, 0, 2, 2, 2,
+    8, 12, 8, 14, 7, 15, 2, 15, 11, 2, 0, 2, 0, 2, 0, 2, 8, 12, 12, 14, 7, 15, 2, 15, 7, 2, 0, 2, 0, 2, 2, 3,
+    10, 12, 13, 14, 11, 0, 2, 2, 11, 2, 20, 15, 6, 2, 2, 2, 8, 8, 12, 14, 11, 0, 2, 2, 7, 2, 2, 2, 0, 0, 2, 2,
+    9, 12, 13, 14, 7, 0, 2, 2, 11, 2, 20, 15, 0, 2, 2, 2, 8, 12, 12, 14, 7, 0, 2, 2, 7, 2, 2, 2, 0, 2, 2, 3,
+    6, 6, 6, 2, 11, 7, 0, 2, 11, 0, 7, 2, 6, 0, 0, 2, 6, 6, 6, 2, 11, 7, 0, 2, 7, 0, 0, 2, 6, 0, 0, 4,
+    6, 6, 6, 2, 7, 0, 0, 2, 11, 0, 7, 2, 6, 0, 0, 4, 6, 6, 6, 2, 7, 0, 0, 0, 7, 0, 0, 0, 0, 1, 1, 0,
+    15, 16, 14, 12, 21, 17, 17, 17, 13, 13, 13, 13, 8, 12, 12, 12, 16, 16, 16, 16, 20, 16, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 17, 15, 15, 16, 16, 15, 15, 17, 13, 17, 13, 14, 14, 12, 14, 13, 17, 12, 15, 16, 16, 15, 15, 15, 14, 15, 14, 14, 14, 14, 15,
+    18, 20, 17, 16, 18, 20, 16, 16, 15, 15, 15, 15, 15, 15, 15, 15, 18, 17, 17, 16, 18, 20, 16, 16, 15, 15, 15, 15, 3, 21, 15, 22,
+    9, 17, 12, 15, 20, 16, 15, 15, 14, 15, 14, 15, 3, 3, 15, 0, 13, 17, 12, 15, 20, 16, 15, 15, 14, 13, 14, 14, 3, 21, 12, 15,
+    8, 12, 13, 14, 18, 15, 15, 15, 21, 15, 16, 16, 3, 3, 14, 14, 9, 12, 12, 14, 18, 15, 15, 15, 15, 15, 15, 15, 3, 3, 3, 0,
+    13, 12, 13, 14, 14, 15, 14, 15, 16, 15, 16, 15, 2, 3, 15, 5, 12, 12, 12, 14, 14, 13, 14, 14, 15, 15, 15, 14, 2, 13, 4, 3,
+    10, 9, 12, 14, 18, 18, 3, 3, 2, 2, 14, 2, 3, 3, 3, 0, 10, 9, 12, 14, 18, 21, 3, 21, 2, 2, 14, 16, 3, 22, 2, 5,
+    9, 12, 12, 14, 10, 3, 2, 3, 14, 2, 14, 4, 2, 2, 4, 5, 9, 12, 12, 12, 6, 6, 6, 2, 6, 8, 6, 2, 6, 1, 1, 2,
+    14, 14, 15, 12, 13, 13, 13, 13, 21, 17, 17, 17, 8, 12, 12, 12, 14, 16, 13, 13, 17, 17, 13, 13, 16, 15, 16, 15, 12, 12, 14, 12,
+    12, 12, 16, 16, 12, 12, 12, 12, 20, 16, 16, 16, 12, 12, 12, 12, 12, 12, 13, 14, 15, 15, 14, 14, 16, 15, 16, 15, 14, 14, 14, 15,
+    8, 13, 12, 14, 21, 16, 16, 16, 10, 14, 15, 15, 14, 14, 14, 14, 13, 13, 12, 14, 16, 16, 15, 16, 14, 14, 14, 14, 15, 15, 14, 1,
+    8, 12, 12, 14, 15, 15, 15, 15, 10, 14, 15, 15, 2, 14, 3, 16, 12, 12, 12, 14, 15, 15, 15, 14, 14, 14, 13, 14, 2, 12, 13, 14,
+    10, 13, 20, 16, 14, 14, 15, 15, 18, 16, 20, 16, 15, 15, 15, 15, 9, 12, 13, 14, 14, 14, 14, 14, 20, 15, 16, 15, 3, 15, 3, 0,
+    10, 13, 17, 16, 14, 14, 15, 15, 18, 16, 20, 16, 3, 15, 21, 22, 13, 12, 13, 14, 14, 14, 13, 14, 20, 15, 16, 16, 3, 12, 21, 15,
+    10, 12, 9, 14, 14, 14, 2, 14, 10, 2, 18, 3, 2, 2, 3, 0, 9, 12, 12, 14, 14, 14, 2, 4, 10, 2, 2, 2, 2, 4, 2, 1,
+    10, 12, 9, 14, 2, 14, 2, 16, 10, 2, 21, 21, 2, 2, 22, 5, 9, 12, 12, 12, 8, 6, 8, 14, 6, 6, 6, 2, 6, 1, 1, 2,
+    14, 14, 14, 12, 13, 13, 13, 13, 13, 13, 13, 13, 8, 8, 8, 12, 15, 16, 14, 13, 17, 17, 13, 13, 13, 12, 13, 12, 12, 12, 12, 13,
+    14, 14, 15, 12, 13, 13, 12, 12, 17, 13, 17, 13, 12, 12, 12, 13, 12, 16, 12, 12, 16, 16, 12, 12, 16, 12, 16, 16, 12, 16, 16, 12,
+    17, 17, 17, 16, 21, 21, 16, 16, 14, 14, 14, 12, 14, 14, 14, 8, 17, 17, 17, 16, 21, 16, 16, 17, 15, 16, 14, 13, 15, 21, 14, 13,
+    13, 17, 12, 15, 16, 16, 15, 12, 14, 14, 16, 17, 14, 14, 16, 13, 13, 17, 12, 12, 16, 17, 12, 15, 12, 13, 13, 14, 12, 17, 13, 14,
+    13, 13, 17, 16, 14, 14, 14, 12, 21, 16, 21, 16, 14, 14, 14, 8, 13, 12, 13, 14, 15, 16, 14, 13, 16, 15, 16, 12, 14, 16, 15, 13,
+    13, 13, 17, 16, 14, 14, 16, 17, 21, 16, 16, 17, 15, 15, 21, 17, 13, 12, 13, 13, 12, 13, 13, 14, 16, 12, 17, 16, 12, 13, 17, 15,
+    8, 12, 12, 14, 15, 15, 15, 12, 14, 14, 15, 12, 2, 2, 3, 6, 8, 12, 12, 16, 15, 21, 14, 17, 14, 16, 14, 13, 2, 21, 2, 1,
+    8, 12, 12, 16, 14, 14, 16, 17, 14, 14, 21, 17, 2, 2, 21, 5, 12, 13, 13, 12, 8, 13, 13, 14, 8, 13, 13, 14, 6, 1, 1, 2,
+    4, 15, 14, 12, 22, 21, 13, 13, 5, 8, 6, 8, 0, 8, 8, 8, 22, 21, 16, 17, 22, 21, 17, 17, 13, 13, 13, 13, 13, 13, 13, 13,
+    2, 15, 14, 12, 20, 17, 17, 17, 4, 12, 13, 13, 12, 12, 12, 12, 16, 16, 16, 17, 20, 20, 17, 17, 12, 12, 12, 14, 12, 12, 12, 2,
+    1, 20, 16, 20, 19, 20, 20, 20, 12, 16, 16, 16, 12, 20, 16, 1, 19, 20, 20, 21, 19, 20, 21, 21, 9, 16, 16, 16, 9, 22, 16, 5,
+    7, 20, 17, 16, 18, 20, 21, 21, 8, 15, 15, 15, 8, 4, 15, 1, 11, 20, 17, 12, 18, 20, 21, 3, 8, 8, 12, 14, 8, 5, 8, 4,
+    6, 10, 4, 21, 9, 19, 22, 22, 3, 11, 23, 18, 12, 11, 5, 0, 11, 18, 20, 21, 10, 19, 22, 22, 9, 11, 4, 4, 9, 11, 2, 1,
+    6, 10, 22, 20, 10, 19, 22, 22, 9, 7, 22, 22, 8, 7, 23, 5, 11, 10, 9, 12, 10, 19, 8, 14, 8, 8, 9, 3, 8, 12, 5, 3,
+    6, 18, 18, 21, 9, 19, 23, 22, 12, 11, 20, 4, 12, 15, 14, 2, 10, 18, 18, 21, 10, 19, 23, 23, 9, 11, 5, 23, 3, 4, 3, 4,
+    6, 10, 18, 21, 10, 19, 23, 22, 9, 1, 23, 5, 2, 3, 4, 2, 10, 6, 6, 6, 6, 1, 6, 0, 6, 6, 6, 0, 0, 5, 1, 0,
+    3, 15, 14, 12, 22, 21, 13, 13, 1, 8, 6, 8, 6, 8, 8, 8, 22, 16, 16, 17, 22, 21, 17, 17, 13, 13, 13, 13, 9, 20, 13, 18,
+    15, 15, 14, 12, 17, 17, 13, 17, 12, 12, 12, 12, 13, 13, 12, 7, 16, 16, 16, 17, 20, 17, 17, 16, 13, 17, 12, 15, 13, 20, 12, 15,
+    23, 21, 21, 20, 23, 21, 20, 20, 3, 17, 17, 17, 3, 18, 17, 11, 19, 20, 16, 16, 19, 20, 20, 20, 16, 20, 16, 16, 16, 19, 16, 19,
+    18, 20, 17, 16, 18, 20, 16, 18, 16, 16, 15, 2, 16, 19, 12, 7, 18, 20, 17, 17, 20, 21, 13, 16, 13, 17, 12, 15, 9, 22, 12, 4,
+    0, 18, 4, 21, 19, 18, 21, 18, 4, 18, 23, 18, 2, 10, 1, 11, 11, 18, 20, 16, 19, 20, 21, 20, 13, 16, 15, 17, 17, 18, 0, 11,
+    7, 10, 4, 21, 18, 18, 21, 10, 22, 20, 22, 4, 3, 11, 22, 1, 11, 13, 13, 12, 18, 17, 12, 15, 9, 13, 13, 14, 8, 17, 4, 2,
+    7, 18, 20, 21, 18, 18, 21, 18, 14, 22, 3, 20, 15, 18, 14, 7, 11, 18, 20, 20, 18, 21, 5, 21, 17, 20, 17, 21, 3, 23, 3, 23,
+    11, 18, 20, 21, 18, 18, 18, 18, 1, 1, 23, 4, 15, 3, 4, 0, 8, 13, 8, 12, 6, 21, 6, 3, 8, 8, 6, 14, 6, 5, 1, 3,
+    2, 14, 2, 12, 1, 13, 8, 13, 5, 8, 6, 8, 6, 8, 6, 8, 3, 16, 14, 13, 21, 17, 13, 13, 12, 13, 12, 13, 9, 9, 13, 6,
+    2, 14, 14, 12, 13, 13, 13, 13, 4, 12, 13, 13, 8, 12, 9, 17, 15, 16, 14, 13, 17, 17, 13, 14, 12, 12, 17, 16, 12, 12, 17, 15,
+    1, 21, 16, 17, 22, 21, 20, 20, 2, 13, 13, 13, 2, 10, 13, 7, 22, 21, 16, 17, 22, 21, 17, 22, 17, 17, 13, 8, 17, 23, 14, 1,
+    0, 16, 16, 16, 20, 16, 16, 16, 1, 12, 20, 16, 12, 1, 20, 0, 17, 17, 13, 12, 20, 13, 13, 14, 8, 12, 13, 14, 8, 4, 13, 2,
+    1, 8, 22, 20, 2, 14, 5, 14, 4, 18, 23, 18, 3, 8, 1, 7, 6, 9, 2, 14, 1, 15, 14, 2, 7, 12, 13, 9, 14, 7, 1, 6,
+    1, 8, 22, 17, 14, 13, 20, 16, 23, 17, 21, 21, 17, 17, 22, 22, 6, 13, 13, 13, 9, 12, 13, 14, 9, 13, 21, 16, 9, 12, 21, 3,
+    0, 10, 23, 16, 2, 21, 15, 23, 2, 2, 21, 10, 14, 14, 2, 0, 7, 10, 17, 20, 5, 23, 5, 22, 6, 18, 10, 6, 3, 4, 2, 1,
+    7, 13, 20, 17, 13, 13, 20, 16, 10, 1, 21, 21, 2, 2, 22, 1, 8, 8, 8, 12, 6, 6, 8, 2, 6, 6, 6, 2, 6, 5, 1, 2,
+    2, 14, 14, 12, 1, 13, 8, 13, 1, 8, 6, 8, 6, 8, 8, 9, 15, 16, 14, 13, 21, 17, 13, 13, 12, 15, 12, 12, 9, 20, 14, 13,
+    14, 14, 14, 12, 13, 13, 13, 12, 12, 12, 15, 12, 8, 14, 15, 12, 15, 16, 14, 14, 17, 16, 14, 13, 14, 15, 15, 12, 14, 16, 15, 12,
+    5, 21, 16, 14, 22, 21, 20, 9, 2, 2, 14, 12, 2, 11, 2, 10, 22, 21, 16, 16, 21, 20, 15, 17, 15, 16, 14, 13, 3, 18, 14, 10,
+    16, 16, 15, 14, 21, 15, 15, 12, 2, 14, 15, 12, 2, 10, 15, 8, 12, 16, 12, 16, 12, 16, 12, 16, 12, 16, 12, 12, 12, 20, 12, 12,
+    1, 2, 4, 14, 2, 2, 2, 12, 4, 2, 14, 12, 2, 11, 14, 9, 0, 15, 14, 14, 3, 16, 14, 13, 3, 15, 14, 12, 3, 20, 14, 9,
+    1, 14, 16, 14, 2, 14, 15, 12, 15, 14, 16, 13, 2, 14, 21, 13, 12, 15, 13, 13, 14, 16, 13, 13, 12, 15, 17, 16, 12, 16, 17, 14,
+    0, 3, 2, 14, 3, 19, 2, 9, 2, 2, 14, 12, 2, 10, 2, 10, 15, 16, 15, 16, 15, 20, 15, 20, 15, 16, 14, 13, 3, 18, 2, 10,
+    14, 15, 16, 14, 3, 15, 16, 12, 14, 14, 21, 13, 2, 10, 21, 6, 12, 17, 13, 12, 8, 17, 13, 15, 8, 17, 13, 14, 6, 21, 1, 2,
+    4, 14, 15, 12, 5, 6, 8, 8, 5, 8, 21, 13, 0, 8, 8, 8, 2, 14, 15, 12, 22, 13, 13, 13, 20, 13, 17, 17, 9, 9, 12, 12,
+    4, 15, 21, 17, 12, 12, 13, 13, 22, 17, 21, 17, 13, 13, 13, 13, 15, 15, 16, 17, 12, 12, 12, 14, 20, 17, 20, 17, 12, 12, 12, 2,
+    0, 4, 10, 20, 3, 23, 18, 18, 9, 5, 19, 22, 14, 5, 11, 6, 6, 22, 10, 20, 23, 22, 20, 22, 10, 22, 19, 22, 8, 4, 7, 5,
+    7, 2, 18, 21, 8, 12, 11, 12, 10, 22, 19, 22, 9, 2, 7, 1, 7, 8, 10, 12, 8, 8, 8, 14, 10, 8, 12, 14, 8, 5, 12, 3,
+    1, 16, 20, 20, 12, 16, 16, 16, 19, 20, 20, 20, 12, 16, 20, 1, 7, 17, 20, 16, 9, 15, 15, 15, 18, 21, 20, 21, 8, 15, 22, 1,
+    19, 17, 20, 21, 9, 16, 16, 16, 19, 21, 20, 22, 9, 16, 22, 5, 11, 17, 20, 12, 8, 12, 9, 14, 18, 8, 20, 3, 9, 8, 23, 4,
+    6, 18, 18, 21, 12, 20, 11, 4, 9, 23, 19, 22, 12, 14, 15, 2, 6, 18, 10, 21, 9, 23, 1, 5, 10, 23, 19, 22, 2, 4, 3, 2,
+    10, 18, 18, 18, 9, 11, 19, 23, 10, 5, 23, 23, 3, 3, 4, 4, 10, 6, 6, 6, 6, 6, 6, 0, 6, 6, 1, 0, 0, 1, 5, 0,
+    2, 2, 14, 12, 5, 6, 8, 8, 1, 8, 8, 8, 6, 6, 8, 8, 3, 14, 14, 12, 22, 13, 13, 13, 13, 13, 13, 13, 9, 9, 9, 6,
+    3, 14, 15, 12, 12, 12, 12, 12, 21, 13, 17, 13, 9, 13, 9, 6, 15, 14, 15, 12, 13, 17, 12, 15, 17, 13, 17, 14, 12, 17, 13, 15,
+    5, 22, 21, 20, 4, 23, 18, 18, 3, 5, 10, 10, 3, 5, 8, 7, 5, 22, 21, 17, 23, 21, 20, 21, 15, 17, 13, 16, 16, 22, 6, 5,
+    0, 3, 8, 12, 7, 13, 12, 8, 1, 14, 15, 3, 12, 1, 7, 0, 6, 13, 12, 12, 9, 17, 12, 15, 9, 13, 12, 14, 9, 21, 12, 3,
+    1, 16, 21, 17, 3, 13, 13, 13, 22, 20, 21, 20, 2, 13, 18, 7, 0, 16, 16, 16, 19, 16, 12, 16, 20, 16, 16, 16, 12, 20, 19, 0,
+    22, 16, 21, 17, 17, 13, 17, 21, 22, 17, 21, 22, 16, 15, 23, 5, 17, 13, 17, 12, 9, 13, 13, 14, 9, 13, 22, 14, 9, 13, 22, 3,
+    0, 23, 10, 16, 3, 21, 2, 10, 2, 15, 21, 23, 15, 2, 15, 0, 7, 20, 13, 17, 18, 21, 1, 21, 13, 20, 22, 16, 2, 4, 3, 1,
+    7, 10, 18, 20, 6, 10, 18, 21, 5, 5, 23, 22, 3, 3, 4, 5, 8, 8, 8, 12, 6, 6, 6, 2, 6, 8, 6, 2, 6, 1, 5, 2,
+    3, 14, 15, 12, 1, 6, 8, 8, 5, 8, 21, 13, 6, 8, 8, 8, 15, 14, 15, 12, 12, 13, 12, 13, 17, 13, 17, 13, 8, 9, 13, 11,
+    4, 15, 16, 17, 12, 12, 13, 13, 22, 17, 21, 17, 9, 13, 20, 18, 15, 15, 16, 17, 12, 12, 17, 16, 20, 17, 17, 16, 13, 13, 20, 16,
+    0, 4, 18, 21, 4, 23, 18, 18, 3, 1, 18, 18, 2, 1, 19, 11, 1, 4, 10, 20, 22, 22, 20, 4, 18, 21, 18, 10, 9, 5, 18, 7,
+    7, 2, 18, 16, 12, 15, 21, 17, 19, 16, 20, 20, 16, 16, 18, 18, 7, 12, 17, 12, 8, 12, 13, 14, 13, 12, 17, 15, 8, 12, 20, 15,
+    23, 16, 21, 20, 3, 17, 17, 17, 23, 20, 21, 18, 3, 17, 18, 11, 18, 17, 20, 16, 16, 15, 16, 20, 18, 16, 20, 18, 17, 13, 19, 11,
+    19, 16, 20, 16, 16, 16, 20, 16, 19, 20, 20, 20, 16, 16, 19, 19, 18, 17, 17, 17, 13, 13, 17, 16, 20, 13, 21, 21, 9, 13, 22, 22,
+    7, 20, 18, 21, 14, 3, 22, 20, 18, 21, 18, 18, 15, 14, 18, 7, 11, 20, 18, 21, 1, 23, 21, 4, 18, 18, 18, 18, 15, 3, 19, 0,
+    11, 17, 20, 20, 17, 17, 20, 21, 18, 5, 21, 21, 3, 3, 23, 23, 8, 8, 13, 12, 8, 6, 8, 14, 6, 6, 21, 3, 6, 1, 22, 4,
+    2, 14, 14, 12, 1, 6, 8, 8, 1, 8, 8, 8, 6, 8, 8, 9, 14, 14, 14, 12, 12, 15, 12, 12, 13, 13, 13, 12, 8, 15, 10, 9,
+    15, 14, 15, 12, 12, 12, 15, 12, 21, 13, 17, 17, 9, 14, 20, 13, 15, 14, 15, 15, 14, 15, 15, 12, 17, 14, 16, 17, 14, 15, 16, 13,
+    5, 4, 3, 14, 4, 23, 2, 12, 2, 2, 3, 9, 2, 14, 11, 9, 5, 15, 15, 14, 22, 16, 14, 13, 3, 15, 15, 12, 2, 16, 10, 8,
+    0, 15, 15, 15, 3, 14, 15, 12, 3, 15, 20, 17, 3, 14, 20, 9, 14, 13, 15, 15, 12, 17, 15, 15, 14, 13, 16, 17, 14, 17, 16, 12,
+    5, 16, 21, 14, 2, 14, 3, 12, 22, 2, 21, 9, 3, 2, 19, 10, 16, 15, 16, 14, 3, 15, 15, 12, 3, 15, 18, 12, 3, 15, 18, 9,
+    22, 16, 16, 16, 15, 15, 16, 17, 21, 15, 20, 20, 3, 15, 18, 18, 12, 12, 16, 16, 12, 12, 16, 16, 12, 12, 20, 16, 12, 12, 20, 16,
+    0, 2, 3, 14, 3, 14, 3, 12, 3, 2, 19, 9, 3, 2, 18, 10, 14, 16, 15, 14, 14, 16, 15, 13, 3, 15, 18, 12, 3, 21, 18, 6,
+    15, 15, 16, 16, 15, 15, 16, 17, 15, 15, 20, 20, 3, 3, 18, 18, 12, 13, 17, 12, 8, 13, 17, 14, 8, 13, 21, 16, 6, 1, 21, 3,
+    0, 0, 0, 8, 5, 1, 6, 8, 5, 6, 1, 8, 0, 6, 6, 8, 4, 3, 14, 12, 22, 22, 9, 9, 8, 8, 12, 8, 9, 9, 9, 6,
+    4, 14, 3, 12, 12, 12, 8, 12, 4, 8, 22, 9, 8, 8, 9, 6, 2, 14, 14, 12, 13, 13, 13, 14, 12, 12, 13, 14, 8, 8, 9, 0,
+    0, 22, 22, 18, 3, 23, 19, 18, 14, 5, 21, 10, 14, 13, 12, 8, 1, 22, 21, 20, 22, 22, 18, 22, 12, 18, 9, 21, 13, 22, 12, 1,
+    6, 4, 19, 17, 8, 20, 13, 19, 8, 8, 18, 4, 12, 12, 8, 6, 6, 9, 8, 12, 9, 23, 8, 3, 8, 8, 12, 14, 8, 4, 8, 4,
+    0, 22, 22, 18, 14, 21, 5, 10, 3, 19, 23, 18, 14, 12, 13, 8, 6, 19, 4, 17, 9, 18, 8, 4, 8, 13, 20, 19, 13, 8, 13, 6,
+    1, 21, 22, 20, 12, 9, 18, 21, 22, 18, 22, 22, 13, 12, 22, 1, 6, 8, 9, 12, 9, 12, 9, 14, 9, 8, 23, 3, 9, 8, 22, 4,
+    0, 18, 18, 0, 12, 20, 16, 20, 12, 16, 20, 20, 12, 12, 12, 12, 6, 18, 10, 18, 9, 22, 4, 22, 12, 19, 21, 22, 14, 3, 14, 2,
+    6, 10, 18, 18, 8, 21, 19, 23, 9, 4, 22, 22, 14, 14, 3, 2, 6, 6, 6, 6, 6, 1, 6, 0, 6, 6, 1, 0, 0, 4, 4, 0,
+    0, 0, 0, 8, 5, 1, 6, 8, 1, 6, 6, 8, 0, 6, 6, 10, 4, 3, 14, 12, 22, 18, 9, 18, 8, 8, 12, 17, 9, 18, 8, 11,
+    3, 14, 14, 12, 12, 12, 8, 10, 4, 8, 8, 8, 8, 10, 8, 7, 2, 14, 14, 17, 13, 20, 12, 16, 12, 17, 12, 15, 8, 18, 8, 7,
+    4, 22, 22, 18, 4, 23, 19, 19, 3, 5, 11, 19, 9, 10, 9, 10, 5, 22, 21, 21, 22, 18, 11, 18, 16, 21, 16, 20, 9, 19, 9, 19,
+    1, 4, 16, 21, 11, 19, 11, 18, 0, 22, 4, 0, 9, 10, 8, 7, 13, 17, 13, 17, 13, 21, 13, 21, 13, 17, 12, 15, 9, 22, 8, 4,
+    0, 22, 4, 18, 3, 19, 7, 11, 4, 19, 23, 18, 8, 10, 9, 8, 1, 21, 15, 16, 22, 18, 7, 18, 15, 21, 18, 17, 8, 10, 9, 7,
+    5, 21, 22, 20, 7, 19, 20, 10, 22, 22, 22, 22, 13, 9, 23, 6, 12, 17, 13, 12, 12, 17, 13, 15, 9, 13, 22, 14, 9, 18, 22, 0,
+    0, 22, 4, 22, 3, 18, 10, 18, 14, 23, 20, 18, 12, 9, 12, 8, 1, 20, 16, 20, 18, 18, 4, 18, 16, 20, 20, 16, 12, 19, 12, 1,
+    6, 22, 18, 20, 10, 18, 18, 10, 4, 4, 22, 4, 14, 12, 14, 0, 8, 13, 8, 12, 6, 21, 6, 3, 6, 8, 6, 2, 0, 4, 4, 4,
+    0, 0, 0, 8, 1, 6, 6, 8, 5, 6, 1, 8, 0, 6, 6, 10, 3, 14, 14, 12, 4, 9, 8, 9, 12, 8, 12, 10, 8, 8, 10, 11,
+    4, 14, 3, 12, 8, 12, 8, 17, 4, 8, 18, 18, 8, 8, 18, 11, 2, 14, 14, 17, 12, 12, 17, 16, 12, 12, 20, 16, 8, 8, 18, 11,
+    0, 4, 22, 18, 4, 23, 19, 18, 3, 7, 19, 11, 8, 9, 10, 8, 5, 22, 21, 20, 22, 22, 22, 22, 7, 7, 19, 10, 13, 9, 10, 6,
+    1, 15, 21, 16, 15, 15, 21, 17, 4, 7, 18, 18, 8, 8, 18, 7, 12, 13, 17, 12, 9, 13, 17, 14, 12, 12, 20, 15, 8, 4, 18, 0,
+    4, 22, 22, 22, 3, 5, 23, 19, 4, 11, 19, 19, 9, 9, 10, 10, 1, 4, 22, 21, 0, 4, 22, 18, 11, 11, 19, 18, 9, 9, 10, 11,
+    5, 16, 21, 21, 16, 16, 21, 20, 22, 11, 18, 18, 9, 9, 19, 19, 13, 13, 17, 17, 13, 13, 17, 16, 13, 13, 21, 21, 9, 9, 22, 22,
+    0, 4, 22, 22, 2, 20, 23, 19, 3, 10, 18, 18, 12, 12, 9, 8, 0, 18, 22, 21, 4, 22, 22, 4, 10, 10, 18, 10, 12, 14, 12, 6,
+    1, 16, 20, 20, 16, 16, 20, 16, 18, 4, 18, 18, 12, 12, 19, 1, 8, 8, 13, 12, 8, 6, 8, 14, 6, 6, 21, 3, 0, 4, 22, 4,
+    0, 0, 0, 8, 1, 6, 6, 6, 1, 6, 6, 6, 6, 7, 7, 6, 3, 14, 14, 14, 0, 0, 0, 8, 0, 2, 0, 8, 0, 7, 7, 8,
+    3, 14, 14, 14, 2, 0, 2, 12, 0, 0, 0, 8, 0, 7, 7, 8, 14, 15, 15, 14, 2, 15, 15, 12, 2, 15, 15, 12, 0, 7, 7, 8,
+    4, 0, 0, 0, 0, 7, 0, 6, 0, 0, 0, 6, 6, 11, 7, 6, 2, 15, 2, 14, 0, 18, 0, 9, 2, 2, 0, 12, 0, 11, 7, 9,
+    2, 2, 2, 14, 0, 0, 2, 8, 0, 0, 0, 8, 0, 11, 7, 8, 14, 16, 15, 14, 2, 16, 15, 13, 2, 16, 15, 12, 0, 18, 7, 8,
+    4, 0, 0, 0, 0, 0, 0, 6, 0, 0, 7, 6, 6, 7, 11, 6, 2, 2, 2, 14, 0, 0, 0, 8, 0, 2, 0, 8, 0, 7, 11, 8,
+    2, 2, 15, 14, 2, 0, 2, 12, 0, 0, 18, 9, 0, 7, 18, 10, 14, 15, 16, 14, 2, 15, 16, 12, 2, 15, 20, 17, 0, 7, 18, 9,
+    0, 0, 0, 0, 0, 7, 0, 6, 0, 0, 7, 6, 6, 10, 10, 6, 2, 15, 2, 14, 0, 18, 0, 9, 0, 2, 0, 8, 6, 10, 10, 10,
+    2, 2, 15, 14, 2, 0, 2, 12, 0, 0, 18, 9, 6, 10, 18, 10, 12, 16, 16, 12, 12, 16, 16, 16, 12, 16, 20, 16, 0, 18, 18, 0,
+    18, 18, 18, 18, 20, 20, 19, 19, 16, 20, 12, 4, 16, 20, 12, 4, 18, 18, 21, 21, 22, 22, 22, 22, 3, 22, 3, 4, 3, 22, 3, 4,
+    10, 18, 6, 5, 1, 23, 1, 5, 8, 4, 0, 4, 2, 4, 2, 4, 10, 18, 6, 5, 1, 23, 1, 5, 0, 5, 0, 5, 0, 4, 0, 4,
+    18, 22, 4, 22, 21, 22, 4, 23, 15, 21, 3, 4, 16, 21, 3, 4, 19, 23, 5, 22, 22, 22, 4, 22, 3, 4, 3, 4, 3, 22, 3, 4,
+    7, 19, 1, 5, 1, 5, 1, 5, 8, 4, 0, 4, 2, 4, 2, 4, 11, 19, 1, 5, 1, 23, 1, 5, 0, 5, 0, 5, 0, 4, 0, 4,
+    8, 4, 0, 4, 15, 4, 3, 4, 12, 3, 15, 3, 15, 15, 14, 3, 7, 5, 1, 5, 4, 4, 4, 4, 2, 4, 2, 4, 3, 4, 3, 4,
+    8, 1, 7, 1, 0, 5, 0, 5, 8, 0, 0, 0, 14, 3, 2, 3, 7, 7, 6, 1, 1, 5, 1, 5, 6, 1, 0, 1, 0, 4, 0, 4,
+    8, 4, 0, 4, 15, 4, 3, 4, 14, 3, 2, 3, 15, 3, 3, 3, 7, 5, 1, 5, 4, 4, 4, 4, 2, 4, 2, 4, 3, 4, 3, 4,
+    6, 1, 0, 1, 0, 5, 0, 5, 8, 0, 0, 0, 2, 3, 2, 3, 7, 1, 1, 1, 1, 5, 1, 5, 0, 1, 0, 1, 0, 4, 0, 0,
+    22, 22, 18, 18, 18, 18, 18, 18, 9, 18, 9, 10, 9, 18, 9, 10, 20, 20, 20, 20, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19,
+    13, 20, 13, 17, 21, 21, 21, 21, 22, 22, 4, 4, 5, 23, 5, 5, 13, 20, 13, 17, 21, 21, 21, 21, 4, 22, 4, 4, 22, 22, 4, 0,
+    22, 18, 22, 22, 20, 18, 23, 23, 20, 18, 19, 19, 20, 18, 19, 19, 18, 20, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 22, 23, 23, 23,
+    18, 20, 21, 21, 23, 22, 22, 22, 22, 4, 4, 4, 4, 5, 5, 5, 18, 20, 21, 21, 23, 22, 22, 22, 5, 4, 4, 4, 22, 22, 4, 4,
+    18, 22, 4, 4, 21, 22, 5, 5, 13, 21, 8, 5, 13, 21, 8, 5, 19, 23, 4, 4, 22, 22, 4, 4, 22, 22, 5, 5, 22, 22, 5, 5,
+    9, 19, 12, 4, 23, 23, 4, 4, 4, 4, 4, 4, 4, 4, 5, 1, 9, 19, 12, 4, 23, 23, 4, 4, 5, 5, 4, 3, 4, 4, 4, 0,
+    18, 22, 4, 4, 21, 22, 4, 5, 17, 21, 4, 5, 17, 21, 4, 2, 19, 23, 5, 4, 22, 22, 4, 4, 22, 22, 4, 5, 22, 22, 4, 4,
+    10, 19, 5, 4, 23, 23, 5, 4, 4, 4, 4, 4, 4, 4, 3, 2, 10, 19, 5, 0, 23, 23, 5, 5, 5, 5, 1, 0, 0, 4, 0, 4,
+    4, 22, 0, 11, 7, 19, 7, 11, 2, 10, 6, 10, 8, 10, 8, 10, 15, 21, 15, 16, 18, 18, 18, 18, 18, 18, 10, 10, 11, 19, 11, 11,
+    0, 16, 12, 16, 20, 20, 16, 16, 18, 18, 18, 18, 16, 19, 20, 1, 12, 17, 12, 17, 16, 21, 16, 16, 10, 21, 18, 3, 22, 22, 22, 0,
+    4, 22, 18, 18, 19, 19, 10, 18, 14, 10, 13, 10, 12, 10, 9, 10, 21, 21, 17, 20, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 11, 5,
+    6, 17, 9, 17, 21, 21, 21, 21, 18, 22, 18, 4, 16, 23, 16, 1, 8, 17, 13, 17, 21, 21, 16, 4, 11, 22, 11, 3, 22, 4, 22, 0,
+    4, 8, 22, 8, 12, 8, 13, 8, 16, 12, 21, 8, 13, 8, 13, 8, 8, 12, 9, 12, 7, 7, 7, 7, 19, 7, 19, 7, 6, 7, 6, 1,
+    11, 8, 19, 12, 21, 15, 21, 15, 18, 7, 18, 22, 16, 14, 21, 5, 9, 12, 9, 12, 14, 15, 14, 3, 11, 6, 19, 4, 22, 4, 4, 4,
+    7, 8, 18, 8, 12, 12, 13, 8, 16, 12, 17, 12, 13, 12, 13, 2, 8, 8, 9, 12, 8, 4, 0, 4, 11, 6, 19, 7, 14, 3, 2, 3,
+    11, 8, 10, 8, 16, 14, 21, 15, 18, 7, 18, 4, 16, 2, 3, 5, 9, 8, 9, 0, 6, 1, 0, 1, 11, 0, 1, 4, 0, 0, 0, 0,
+    4, 22, 0, 11, 7, 19, 7, 11, 6, 11, 6, 11, 6, 10, 6, 10, 15, 21, 15, 16, 18, 18, 18, 18, 10, 18, 10, 10, 18, 18, 10, 6,
+    14, 16, 14, 16, 17, 20, 17, 17, 4, 18, 22, 9, 18, 18, 18, 6, 12, 16, 12, 16, 20, 20, 16, 12, 20, 20, 20, 12, 18, 18, 18, 0,
+    22, 22, 18, 18, 19, 19, 18, 18, 9, 10, 10, 10, 9, 10, 10, 10, 21, 21, 20, 20, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 1,
+    13, 17, 17, 17, 21, 21, 21, 21, 22, 22, 22, 8, 23, 23, 23, 6, 13, 17, 17, 17, 21, 21, 21, 3, 22, 22, 22, 14, 22, 22, 22, 0,
+    4, 9, 4, 8, 12, 9, 8, 8, 14, 9, 9, 8, 12, 9, 9, 6, 8, 13, 12, 12, 11, 11, 7, 8, 11, 11, 7, 8, 11, 11, 7, 6,
+    6, 13, 13, 12, 16, 16, 15, 12, 22, 4, 22, 22, 20, 5, 23, 1, 8, 13, 13, 14, 16, 16, 15, 14, 18, 4, 22, 3, 4, 22, 4, 0,
+    0, 9, 8, 8, 12, 9, 8, 8, 12, 9, 8, 8, 12, 9, 8, 0, 8, 13, 12, 12, 18, 22, 4, 4, 11, 11, 7, 12, 15, 4, 3, 5,
+    8, 13, 12, 12, 16, 16, 15, 8, 4, 0, 22, 4, 14, 3, 4, 1, 8, 13, 12, 2, 7, 5, 1, 4, 6, 1, 5, 3, 0, 4, 0, 0,
+    21, 18, 10, 18, 20, 18, 10, 19, 13, 20, 9, 10, 17, 20, 9, 10, 18, 21, 18, 18, 21, 22, 19, 19, 21, 22, 23, 23, 21, 22, 23, 23,
+    10, 18, 21, 21, 23, 23, 4, 22, 12, 4, 15, 4, 14, 4, 3, 4, 18, 18, 21, 21, 23, 23, 22, 22, 3, 4, 4, 4, 3, 4, 4, 4,
+    20, 20, 19, 19, 20, 20, 19, 19, 16, 20, 12, 19, 16, 20, 12, 19, 20, 22, 23, 23, 21, 22, 23, 23, 16, 22, 4, 23, 21, 22, 4, 23,
+    10, 19, 4, 22, 23, 23, 4, 4, 12, 4, 3, 4, 14, 4, 3, 4, 19, 19, 22, 22, 23, 23, 4, 22, 3, 4, 3, 4, 3, 4, 4, 5,
+    13, 21, 12, 3, 16, 16, 12, 3, 15, 15, 12, 14, 15, 15, 12, 14, 20, 22, 4, 4, 21, 22, 4, 4, 15, 4, 3, 4, 15, 4, 3, 4,
+    9, 4, 15, 4, 14, 4, 3, 3, 12, 3, 15, 3, 14, 3, 15, 3, 10, 23, 4, 4, 4, 4, 4, 4, 14, 4, 3, 4, 3, 4, 3, 1,
+    17, 21, 14, 3, 16, 21, 14, 3, 15, 15, 14, 3, 15, 15, 14, 3, 20, 22, 4, 4, 21, 22, 4, 4, 15, 4, 3, 4, 15, 4, 3, 3,
+    9, 4, 3, 4, 14, 4, 3, 4, 12, 3, 15, 3, 14, 3, 3, 2, 10, 23, 4, 4, 4, 4, 4, 5, 14, 4, 3, 1, 3, 3, 2, 3,
+    23, 19, 11, 18, 18, 18, 10, 18, 9, 10, 9, 10, 9, 18, 9, 10, 22, 21, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 18, 19, 19, 19,
+    20, 20, 16, 21, 21, 21, 21, 21, 23, 23, 23, 23, 23, 23, 5, 11, 20, 20, 21, 21, 21, 21, 21, 21, 23, 23, 23, 23, 23, 23, 23, 7,
+    21, 18, 19, 19, 20, 18, 19, 19, 17, 18, 10, 19, 20, 18, 10, 19, 19, 19, 19, 19, 20, 19, 19, 19, 20, 19, 19, 19, 20, 19, 19, 19,
+    18, 20, 22, 22, 23, 22, 22, 22, 22, 23, 5, 5, 22, 20, 5, 11, 18, 20, 21, 22, 23, 22, 22, 23, 22, 23, 23, 3, 22, 22, 21, 23,
+    16, 21, 9, 23, 17, 21, 9, 23, 13, 17, 8, 8, 13, 17, 8, 7, 20, 22, 23, 23, 21, 22, 23, 23, 21, 22, 5, 5, 21, 22, 5, 7,
+    11, 23, 5, 5, 23, 23, 5, 5, 4, 4, 5, 5, 4, 4, 5, 7, 19, 19, 22, 22, 23, 23, 5, 3, 22, 4, 5, 3, 22, 19, 4, 0,
+    20, 21, 22, 23, 21, 21, 22, 20, 17, 21, 12, 5, 17, 21, 15, 15, 20, 22, 22, 23, 21, 22, 22, 22, 21, 22, 4, 5, 21, 21, 15, 4,
+    19, 23, 4, 5, 23, 23, 4, 20, 22, 4, 4, 4, 15, 16, 15, 2, 19, 23, 23, 0, 23, 22, 1, 5, 22, 1, 1, 0, 15, 4, 2, 4,
+    1, 23, 7, 11, 7, 11, 7, 11, 2, 10, 6, 10, 8, 10, 8, 10, 22, 21, 20, 20, 19, 18, 18, 18, 18, 10, 10, 10, 10, 11, 11, 11,
+    0, 16, 3, 16, 20, 20, 20, 20, 21, 18, 21, 10, 17, 19, 17, 7, 15, 16, 16, 16, 20, 20, 20, 20, 18, 18, 18, 2, 19, 19, 19, 0,
+    4, 23, 10, 18, 19, 19, 10, 10, 14, 10, 9, 10, 12, 10, 9, 10, 22, 21, 18, 18, 19, 18, 18, 18, 18, 19, 11, 11, 18, 21, 11, 5,
+    1, 20, 20, 20, 20, 20, 20, 20, 16, 19, 16, 1, 16, 16, 16, 0, 20, 20, 21, 21, 21, 22, 21, 4, 23, 23, 23, 2, 21, 22, 16, 1,
+    15, 13, 17, 8, 12, 9, 13, 8, 15, 8, 17, 8, 12, 8, 13, 8, 1, 11, 7, 7, 10, 11, 7, 7, 8, 7, 6, 7, 8, 7, 6, 6,
+    5, 9, 21, 12, 17, 12, 17, 12, 21, 12, 21, 23, 17, 12, 5, 1, 6, 9, 0, 3, 1, 1, 4, 2, 10, 1, 22, 4, 0, 6, 5, 1,
+    15, 13, 13, 8, 12, 13, 13, 8, 15, 12, 13, 8, 12, 15, 15, 2, 7, 10, 7, 7, 17, 21, 16, 22, 8, 7, 6, 7, 15, 15, 15, 3,
+    6, 10, 16, 14, 16, 16, 16, 21, 17, 2, 4, 5, 15, 15, 3, 0, 7, 7, 6, 0, 6, 5, 0, 5, 6, 0, 1, 4, 15, 3, 2, 3,
+    5, 23, 7, 11, 7, 19, 7, 11, 6, 11, 6, 11, 6, 10, 6, 10, 22, 21, 20, 20, 19, 18, 18, 18, 11, 10, 10, 10, 18, 18, 10, 10,
+    2, 16, 15, 16, 20, 20, 17, 10, 5, 18, 5, 9, 18, 10, 18, 6, 15, 16, 16, 16, 20, 20, 20, 9, 18, 18, 18, 12, 18, 18, 18, 6,
+    23, 23, 18, 18, 19, 19, 10, 18, 9, 10, 9, 10, 9, 10, 10, 11, 22, 21, 20, 18, 19, 18, 18, 19, 18, 19, 19, 9, 18, 18, 20, 19,
+    21, 21, 20, 20, 20, 18, 20, 10, 19, 19, 19, 8, 20, 18, 17, 7, 20, 20, 20, 12, 20, 19, 20, 19, 19, 4, 20, 12, 20, 19, 20, 1,
+    3, 9, 8, 9, 12, 9, 8, 10, 14, 9, 8, 8, 12, 9, 8, 7, 1, 11, 11, 9, 10, 19, 11, 10, 10, 11, 7, 8, 10, 10, 0, 7,
+    1, 9, 4, 8, 20, 19, 18, 9, 22, 7, 23, 9, 18, 10, 5, 6, 6, 9, 2, 12, 23, 18, 3, 9, 5, 10, 22, 14, 18, 11, 5, 6,
+    14, 13, 9, 9, 12, 20, 9, 18, 12, 9, 8, 8, 16, 20, 15, 7, 1, 11, 11, 13, 20, 21, 21, 23, 10, 11, 8, 8, 16, 21, 15, 5,
+    7, 10, 5, 9, 17, 20, 16, 18, 2, 2, 23, 5, 16, 16, 15, 0, 7, 1, 7, 2, 20, 22, 1, 4, 6, 1, 1, 3, 15, 22, 2, 5,
+    2, 10, 6, 10, 13, 10, 9, 10, 14, 9, 13, 9, 13, 13, 12, 9, 21, 18, 10, 10, 20, 18, 11, 11, 15, 20, 2, 11, 15, 20, 2, 11,
+    10, 2, 18, 2, 14, 2, 15, 2, 17, 14, 20, 2, 15, 2, 15, 2, 10, 3, 10, 2, 14, 3, 2, 2, 12, 3, 3, 2, 14, 3, 3, 0,
+    15, 20, 14, 9, 17, 17, 14, 9, 13, 13, 14, 12, 13, 13, 14, 12, 17, 20, 3, 19, 16, 20, 3, 19, 15, 16, 2, 2, 15, 16, 2, 1,
+    13, 15, 16, 2, 14, 3, 15, 2, 13, 2, 16, 2, 14, 2, 15, 2, 9, 3, 2, 3, 14, 3, 2, 4, 12, 3, 2, 2, 14, 3, 2, 1,
+    12, 12, 16, 12, 12, 12, 12, 12, 16, 12, 16, 12, 12, 12, 12, 12, 12, 15, 2, 2, 15, 15, 2, 2, 14, 15, 3, 2, 15, 15, 2, 2,
+    10, 2, 18, 3, 14, 14, 15, 2, 17, 3, 20, 3, 15, 14, 15, 5, 10, 2, 11, 2, 14, 3, 2, 2, 12, 2, 3, 4, 14, 3, 3, 5,
+    12, 15, 15, 14, 15, 15, 14, 14, 13, 14, 15, 14, 14, 14, 14, 14, 12, 15, 2, 3, 15, 15, 3, 3, 14, 15, 2, 2, 15, 15, 2, 2,
+    13, 2, 16, 3, 14, 15, 15, 2, 13, 2, 16, 3, 14, 2, 3, 3, 9, 2, 2, 0, 14, 1, 2, 1, 12, 2, 1, 1, 2, 2, 2, 2,
+    1, 11, 7, 11, 10, 10, 10, 10, 8, 10, 8, 10, 9, 10, 9, 10, 23, 19, 10, 10, 18, 18, 10, 10, 18, 18, 11, 11, 18, 18, 11, 11,
+    2, 14, 3, 14, 1, 1, 1, 1, 23, 1, 23, 1, 0, 1, 0, 7, 2, 15, 14, 14, 5, 5, 1, 2, 5, 5, 1, 2, 5, 5, 1, 0,
+    21, 18, 10, 10, 20, 18, 10, 10, 13, 10, 9, 10, 13, 10, 9, 10, 21, 18, 19, 19, 20, 18, 19, 19, 20, 18, 11, 11, 20, 18, 11, 1,
+    7, 5, 1, 1, 4, 5, 1, 1, 2, 1, 0, 1, 2, 1, 0, 0, 7, 5, 5, 3, 4, 23, 5, 4, 4, 5, 1, 2, 4, 4, 6, 1,
+    14, 13, 8, 8, 13, 13, 8, 8, 12, 13, 9, 8, 13, 13, 8, 8, 20, 20, 1, 1, 20, 20, 1, 1, 16, 20, 0, 1, 16, 20, 0, 0,
+    1, 2, 22, 0, 2, 2, 0, 0, 22, 2, 23, 5, 2, 2, 22, 1, 6, 4, 13, 2, 4, 4, 1, 2, 3, 4, 22, 4, 3, 14, 4, 1,
+    16, 17, 12, 8, 17, 17, 12, 8, 13, 13, 12, 8, 13, 13, 14, 2, 20, 21, 4, 5, 21, 21, 4, 4, 16, 21, 2, 1, 15, 3, 14, 2,
+    6, 3, 2, 0, 3, 3, 2, 15, 2, 2, 4, 4, 14, 2, 3, 2, 7, 1, 6, 0, 6, 5, 0, 5, 0, 0, 1, 1, 2, 3, 2, 2,
+    2, 7, 1, 7, 6, 11, 6, 11, 2, 6, 6, 6, 12, 9, 8, 9, 3, 23, 14, 10, 19, 19, 10, 10, 10, 10, 10, 10, 10, 10, 11, 7,
+    5, 2, 23, 14, 20, 13, 20, 13, 21, 1, 21, 18, 17, 12, 20, 11, 0, 15, 15, 14, 17, 17, 13, 14, 18, 10, 18, 18, 21, 11, 19, 7,
+    3, 10, 13, 10, 12, 10, 9, 9, 14, 9, 13, 9, 12, 9, 13, 9, 5, 19, 11, 11, 19, 19, 11, 11, 10, 10, 11, 11, 10, 10, 11, 1,
+    11, 3, 20, 14, 16, 14, 16, 14, 20, 14, 20, 19, 16, 14, 11, 7, 7, 3, 10, 2, 21, 23, 22, 3, 18, 1, 19, 3, 22, 4, 11, 0,
+    4, 8, 22, 9, 12, 12, 13, 8, 16, 9, 21, 9, 13, 12, 13, 11, 7, 8, 18, 6, 8, 8, 6, 6, 18, 8, 19, 11, 8, 8, 18, 7,
+    19, 16, 19, 16, 16, 12, 20, 12, 20, 16, 20, 19, 16, 16, 19, 19, 11, 13, 18, 15, 21, 2, 4, 3, 18, 21, 23, 23, 16, 15, 23, 5,
+    15, 12, 17, 12, 12, 12, 13, 12, 16, 12, 17, 19, 13, 14, 13, 0, 7, 8, 19, 6, 12, 4, 14, 4, 18, 8, 18, 19, 14, 3, 15, 2,
+    18, 15, 20, 15, 16, 14, 16, 14, 20, 3, 23, 23, 15, 15, 4, 5, 11, 7, 1, 2, 6, 1, 0, 1, 0, 0, 5, 4, 2, 2, 3, 5,
+    1, 1, 0, 7, 7, 11, 7, 11, 0, 7, 6, 7, 6, 10, 6, 10, 3, 23, 14, 10, 19, 19, 10, 10, 11, 11, 10, 9, 10, 10, 10, 6,
+    3, 14, 3, 14, 12, 13, 12, 9, 5, 0, 23, 10, 18, 10, 10, 10, 2, 15, 15, 12, 17, 17, 13, 12, 22, 10, 18, 9, 10, 18, 10, 6,
+    4, 19, 10, 10, 10, 10, 10, 10, 12, 10, 9, 10, 9, 10, 9, 7, 23, 23, 18, 18, 19, 19, 11, 9, 18, 10, 11, 9, 18, 23, 10, 6,
+    0, 3, 6, 9, 7, 7, 10, 8, 4, 7, 18, 10, 6, 0, 11, 7, 0, 3, 8, 14, 19, 22, 9, 3, 11, 4, 18, 12, 22, 5, 11, 0,
+    4, 8, 5, 8, 12, 9, 8, 8, 14, 8, 9, 10, 12, 9, 9, 11, 0, 10, 15, 8, 10, 10, 7, 8, 9, 10, 18, 10, 9, 12, 10, 7,
+    5, 15, 22, 13, 20, 8, 10, 9, 22, 20, 19, 19, 17, 13, 19, 11, 0, 12, 16, 12, 1, 20, 4, 12, 19, 20, 19, 19, 16, 12, 19, 1,
+    14, 13, 12, 8, 12, 13, 8, 8, 14, 9, 18, 10, 12, 14, 14, 7, 1, 10, 7, 12, 17, 22, 15, 5, 8, 6, 18, 10, 15, 3, 14, 0,
+    1, 6, 10, 13, 12, 15, 14, 8, 3, 3, 23, 19, 15, 14, 23, 1, 6, 1, 1, 2, 6, 5, 0, 4, 0, 0, 23, 4, 2, 3, 3, 1,
+    2, 10, 6, 10, 13, 10, 9, 10, 12, 9, 8, 9, 13, 9, 9, 9, 21, 18, 10, 10, 20, 18, 10, 11, 16, 20, 10, 11, 16, 20, 10, 8,
+    1, 2, 21, 2, 14, 14, 15, 2, 17, 14, 16, 14, 15, 14, 15, 8, 6, 3, 2, 2, 14, 3, 2, 2, 14, 3, 2, 2, 14, 3, 2, 6,
+    16, 20, 12, 9, 17, 20, 12, 9, 13, 13, 12, 9, 13, 13, 12, 9, 21, 20, 18, 19, 20, 20, 18, 21, 16, 20, 14, 11, 16, 20, 13, 13,
+    13, 15, 15, 2, 14, 15, 15, 2, 13, 14, 15, 2, 14, 13, 13, 8, 12, 15, 3, 3, 14, 21, 3, 22, 14, 3, 2, 2, 17, 21, 13, 1,
+    14, 13, 13, 12, 13, 13, 12, 12, 15, 12, 13, 12, 12, 12, 12, 12, 17, 16, 14, 2, 16, 16, 14, 2, 15, 15, 14, 2, 15, 15, 12, 8,
+    13, 14, 16, 14, 14, 14, 15, 14, 17, 14, 16, 23, 15, 12, 15, 6, 12, 15, 14, 2, 14, 15, 2, 2, 12, 3, 22, 4, 14, 12, 12, 1,
+    12, 16, 12, 12, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 17, 16, 15, 3, 16, 16, 16, 21, 15, 15, 14, 2, 15, 15, 14, 14,
+    13, 15, 16, 2, 14, 16, 15, 16, 13, 14, 15, 4, 14, 14, 14, 14, 12, 7, 6, 0, 14, 22, 16, 5, 14, 0, 1, 1, 15, 15, 14, 2,
+    1, 11, 7, 11, 10, 10, 10, 10, 8, 10, 8, 10, 9, 10, 9, 10, 23, 19, 11, 10, 18, 18, 10, 10, 18, 18, 10, 11, 18, 18, 10, 10,
+    2, 2, 3, 14, 2, 10, 6, 10, 5, 0, 23, 1, 12, 9, 8, 9, 2, 15, 14, 14, 21, 18, 10, 10, 5, 5, 1, 14, 13, 10, 9, 11,
+    21, 18, 10, 10, 20, 18, 10, 10, 13, 10, 9, 10, 13, 10, 9, 9, 21, 18, 18, 19, 20, 18, 18, 18, 20, 18, 10, 11, 20, 20, 13, 10,
+    1, 4, 1, 1, 16, 20, 17, 18, 2, 1, 0, 1, 13, 13, 13, 9, 7, 5, 5, 15, 21, 20, 20, 19, 4, 5, 2, 2, 17, 20, 13, 11,
+    14, 13, 8, 9, 13, 13, 9, 9, 12, 13, 8, 8, 13, 13, 8, 8, 21, 20, 10, 11, 20, 20, 10, 10, 17, 20, 8, 7, 13, 9, 12, 8,
+    1, 2, 23, 0, 14, 10, 12, 10, 22, 2, 22, 23, 12, 9, 13, 8, 7, 4, 1, 14, 16, 18, 13, 11, 2, 0, 22, 4, 13, 9, 12, 6,
+    16, 17, 13, 9, 17, 17, 17, 20, 13, 13, 12, 8, 13, 13, 12, 12, 20, 20, 20, 19, 20, 20, 16, 20, 16, 20, 12, 1, 16, 16, 12, 12,
+    6, 3, 3, 4, 16, 20, 17, 20, 2, 2, 22, 4, 13, 13, 12, 12, 6, 7, 6, 0, 17, 21, 16, 22, 6, 0, 1, 1, 16, 16, 14, 2,
+    0, 7, 6, 7, 6, 11, 6, 11, 2, 6, 6, 6, 8, 9, 8, 9, 4, 23, 11, 10, 19, 19, 11, 10, 10, 10, 10, 10, 10, 10, 9, 8,
+    5, 2, 4, 2, 17, 12, 20, 13, 21, 1, 21, 10, 17, 8, 9, 11, 2, 15, 14, 14, 17, 17, 13, 2, 10, 6, 18, 10, 12, 9, 10, 7,
+    3, 10, 9, 10, 12, 10, 9, 10, 14, 9, 13, 9, 12, 9, 9, 8, 23, 19, 10, 11, 19, 19, 10, 21, 18, 10, 10, 10, 13, 17, 13, 8,
+    0, 4, 17, 12, 17, 17, 17, 20, 16, 8, 10, 11, 13, 13, 9, 6, 1, 4, 11, 3, 16, 21, 17, 22, 8, 8, 19, 11, 17, 17, 13, 6,
+    15, 8, 17, 9, 12, 13, 13, 8, 15, 8, 17, 9, 12, 8, 9, 9, 0, 9, 8, 6, 9, 9, 8, 13, 8, 8, 10, 10, 12, 8, 9, 8,
+    22, 13, 21, 13, 17, 12, 17, 12, 21, 9, 19, 19, 13, 13, 10, 11, 7, 0, 4, 15, 14, 13, 12, 2, 9, 9, 19, 23, 13, 12, 19, 7,
+    15, 13, 17, 8, 12, 17, 13, 17, 15, 12, 13, 10, 12, 12, 12, 12, 0, 9, 9, 10, 17, 21, 16, 21, 8, 8, 18, 10, 15, 15, 14, 14,
+    16, 12, 16, 16, 16, 16, 16, 16, 16, 3, 19, 19, 12, 12, 12, 0, 6, 7, 6, 0, 17, 22, 16, 5, 0, 0, 23, 4, 15, 15, 14, 2,
+    1, 7, 7, 7, 7, 11, 7, 11, 6, 7, 6, 7, 6, 10, 6, 6, 4, 23, 11, 6, 19, 19, 11, 11, 11, 11, 7, 6, 6, 10, 6, 10,
+    3, 2, 3, 6, 0, 7, 6, 7, 5, 6, 7, 10, 6, 6, 6, 6, 2, 15, 14, 8, 1, 11, 7, 10, 0, 7, 11, 9, 6, 10, 6, 6,
+    4, 19, 10, 10, 10, 10, 10, 11, 12, 10, 9, 7, 9, 9, 8, 9, 23, 19, 19, 6, 19, 18, 7, 11, 18, 7, 7, 6, 13, 10, 8, 10,
+    1, 1, 0, 6, 0, 11, 6, 11, 0, 6, 7, 10, 13, 9, 8, 9, 1, 7, 1, 8, 21, 18, 7, 10, 0, 7, 7, 9, 13, 18, 8, 11,
+    3, 8, 8, 6, 12, 7, 8, 7, 14, 8, 7, 7, 8, 8, 8, 8, 1, 7, 0, 6, 0, 11, 6, 11, 6, 6, 7, 7, 8, 9, 8, 8,
+    5, 1, 7, 8, 0, 7, 6, 7, 6, 6, 11, 10, 8, 8, 9, 11, 0, 7, 7, 8, 0, 11, 6, 10, 6, 6, 19, 10, 8, 9, 9, 7,
+    14, 1, 0, 6, 12, 18, 17, 11, 12, 6, 7, 7, 13, 13, 12, 8, 0, 1, 0, 6, 16, 20, 17, 18, 0, 6, 7, 7, 17, 17, 12, 8,
+    0, 1, 0, 6, 16, 18, 17, 11, 6, 6, 19, 10, 13, 13, 12, 8, 0, 1, 0, 12, 16, 20, 16, 19, 0, 0, 19, 4, 16, 16, 12, 0,
+    19, 20, 16, 20, 20, 19, 20, 20, 16, 20, 19, 19, 20, 20, 19, 19, 18, 20, 17, 21, 19, 23, 21, 21, 22, 22, 5, 23, 22, 22, 23, 23,
+    9, 18, 13, 17, 19, 23, 22, 22, 8, 5, 7, 5, 1, 5, 5, 5, 10, 18, 13, 17, 19, 23, 22, 22, 6, 5, 1, 5, 1, 5, 5, 5,
+    18, 18, 21, 21, 18, 23, 22, 22, 17, 21, 5, 23, 21, 21, 23, 23, 18, 18, 21, 21, 19, 23, 22, 22, 22, 22, 5, 5, 22, 22, 5, 23,
+    10, 18, 6, 21, 11, 23, 5, 22, 8, 5, 1, 5, 1, 5, 1, 5, 10, 18, 6, 21, 19, 23, 5, 22, 6, 5, 1, 5, 1, 5, 5, 4,
+    9, 19, 8, 1, 18, 23, 5, 5, 8, 5, 7, 5, 17, 22, 5, 5, 11, 11, 8, 1, 19, 23, 5, 5, 6, 5, 1, 1, 5, 5, 5, 5,
+    7, 7, 8, 6, 7, 5, 1, 5, 8, 1, 7, 1, 6, 5, 1, 5, 7, 7, 8, 6, 7, 5, 1, 5, 6, 1, 7, 1, 1, 5, 1, 3,
+    10, 19, 6, 1, 18, 23, 5, 5, 8, 5, 1, 5, 17, 22, 5, 5, 11, 19, 6, 1, 19, 23, 5, 5, 6, 5, 1, 5, 5, 5, 5, 4,
+    7, 7, 6, 1, 7, 5, 1, 5, 8, 1, 7, 1, 6, 5, 1, 3, 7, 7, 6, 1, 7, 5, 1, 1, 6, 1, 1, 0, 1, 1, 0, 1,
+    22, 21, 16, 20, 23, 19, 20, 20, 18, 18, 11, 19, 18, 18, 19, 19, 20, 20, 16, 20, 20, 20, 20, 20, 19, 19, 19, 19, 19, 19, 19, 19,
+    13, 17, 13, 17, 20, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 22, 13, 20, 13, 17, 20, 21, 21, 21, 22, 22, 4, 16, 22, 22, 22, 15,
+    19, 20, 21, 21, 21, 21, 21, 21, 20, 18, 23, 23, 20, 18, 19, 23, 18, 20, 21, 21, 18, 21, 21, 21, 22, 23, 23, 23, 22, 23, 23, 22,
+    10, 20, 17, 21, 18, 21, 21, 21, 23, 22, 4, 4, 23, 22, 22, 1, 18, 20, 17, 21, 18, 21, 21, 21, 23, 18, 4, 16, 23, 23, 19, 22,
+    11, 19, 13, 22, 18, 23, 22, 22, 16, 22, 4, 4, 21, 21, 23, 23, 10, 19, 13, 22, 19, 23, 22, 22, 22, 22, 4, 4, 22, 22, 4, 1,
+    9, 10, 12, 12, 19, 23, 4, 4, 5, 5, 4, 4, 23, 5, 4, 1, 9, 10, 12, 15, 19, 23, 4, 15, 5, 5, 4, 15, 23, 21, 5, 2,
+    18, 19, 23, 22, 18, 23, 23, 22, 21, 22, 5, 4, 21, 22, 22, 2, 19, 19, 23, 18, 19, 23, 23, 23, 22, 22, 5, 18, 22, 23, 3, 4,
+    10, 19, 8, 4, 19, 23, 5, 4, 23, 5, 5, 5, 23, 3, 3, 2, 10, 19, 7, 7, 19, 19, 7, 5, 7, 11, 7, 0, 7, 5, 0, 5,
+    3, 22, 15, 16, 23, 19, 18, 18, 2, 11, 1, 11, 7, 11, 11, 11, 15, 16, 15, 16, 21, 20, 20, 20, 18, 18, 18, 18, 18, 18, 18, 18,
+    0, 16, 12, 16, 20, 16, 16, 16, 19, 20, 19, 16, 20, 20, 20, 0, 12, 17, 12, 17, 17, 16, 16, 16, 10, 21, 10, 15, 21, 21, 21, 2,
+    5, 22, 17, 20, 23, 19, 20, 20, 3, 18, 18, 18, 18, 18, 19, 19, 21, 21, 17, 17, 21, 20, 20, 20, 18, 18, 18, 18, 19, 23, 19, 5,
+    6, 17, 13, 17, 20, 21, 16, 16, 10, 21, 10, 3, 22, 22, 22, 0, 8, 17, 13, 17, 20, 19, 16, 4, 10, 10, 10, 2, 19, 23, 11, 3,
+    7, 9, 10, 12, 3, 16, 15, 15, 4, 8, 19, 8, 14, 13, 2, 1, 8, 13, 9, 12, 17, 16, 15, 15, 10, 8, 10, 8, 3, 3, 5, 0,
+    7, 12, 10, 12, 12, 15, 14, 15, 19, 8, 19, 22, 17, 3, 23, 5, 8, 12, 9, 12, 12, 15, 14, 14, 10, 8, 4, 3, 2, 14, 4, 3,
+    7, 9, 9, 12, 15, 17, 15, 15, 10, 6, 11, 6, 15, 15, 14, 2, 8, 9, 9, 12, 10, 19, 11, 23, 11, 11, 11, 19, 10, 4, 2, 4,
+    7, 8, 9, 12, 12, 15, 14, 15, 10, 0, 5, 4, 14, 2, 3, 5, 8, 7, 7, 0, 7, 7, 7, 1, 7, 7, 1, 2, 7, 1, 0, 1,
+    4, 22, 15, 16, 23, 19, 18, 18, 0, 11, 7, 11, 7, 11, 11, 11, 15, 21, 15, 16, 21, 20, 20, 20, 18, 18, 10, 17, 18, 18, 18, 13,
+    14, 16, 14, 16, 16, 17, 17, 17, 4, 20, 4, 13, 20, 20, 20, 8, 12, 16, 12, 16, 20, 20, 16, 16, 20, 16, 20, 12, 20, 20, 20, 12,
+    22, 22, 20, 20, 23, 19, 18, 20, 19, 19, 18, 18, 18, 18, 18, 6, 21, 21, 17, 20, 21, 20, 20, 21, 18, 20, 18, 17, 18, 21, 18, 21,
+    13, 17, 13, 17, 20, 21, 21, 13, 21, 21, 21, 12, 21, 5, 18, 6, 13, 17, 17, 16, 20, 20, 18, 21, 18, 20, 10, 15, 18, 21, 18, 3,
+    1, 13, 12, 13, 3, 16, 16, 13, 3, 13, 5, 9, 14, 13, 0, 8, 8, 13, 12, 17, 17, 21, 16, 17, 18, 21, 20, 13, 22, 20, 1, 8,
+    6, 13, 12, 12, 17, 16, 15, 12, 23, 15, 22, 13, 4, 17, 23, 6, 8, 13, 12, 15, 17, 17, 2, 15, 20, 17, 4, 14, 20, 16, 4, 14,
+    6, 9, 13, 13, 3, 16, 16, 9, 15, 17, 4, 8, 15, 3, 15, 0, 8, 18, 13, 20, 18, 19, 19, 22, 10, 18, 11, 20, 18, 23, 3, 5,
+    8, 13, 12, 12, 17, 16, 12, 12, 0, 0, 22, 4, 14, 3, 3, 1, 11, 18, 7, 15, 11, 19, 7, 4, 11, 11, 7, 2, 7, 23, 0, 4,
+    22, 22, 18, 18, 22, 19, 18, 18, 16, 20, 11, 19, 20, 20, 19, 19, 23, 21, 20, 20, 18, 18, 18, 18, 21, 22, 19, 19, 21, 22, 23, 19,
+    11, 18, 16, 21, 19, 23, 21, 21, 9, 22, 22, 22, 22, 22, 23, 23, 18, 18, 21, 21, 19, 23, 22, 21, 23, 23, 22, 22, 22, 22, 22, 0,
+    18, 18, 18, 18, 20, 20, 19, 19, 16, 20, 19, 19, 20, 20, 19, 19, 18, 18, 21, 21, 18, 22, 22, 22, 21, 22, 23, 23, 21, 22, 23, 22,
+    10, 18, 21, 21, 19, 23, 22, 22, 9, 22, 4, 22, 22, 22, 4, 21, 18, 18, 21, 21, 19, 23, 22, 23, 23, 23, 5, 19, 18, 22, 18, 22,
+    9, 18, 22, 22, 17, 21, 22, 22, 13, 21, 22, 22, 17, 21, 22, 22, 10, 19, 23, 23, 18, 22, 22, 22, 17, 22, 4, 22, 21, 22, 4, 1,
+    9, 19, 23, 23, 10, 23, 5, 23, 8, 4, 4, 4, 12, 4, 4, 1, 10, 19, 23, 23, 19, 23, 5, 3, 8, 5, 5, 3, 4, 4, 4, 0,
+    9, 18, 22, 22, 20, 21, 22, 22, 13, 21, 4, 22, 17, 21, 16, 15, 18, 19, 23, 23, 18, 22, 18, 22, 17, 22, 4, 19, 21, 21, 16, 22,
+    9, 19, 5, 23, 10, 23, 5, 21, 8, 4, 4, 4, 15, 15, 15, 2, 10, 19, 11, 7, 19, 19, 11, 23, 7, 7, 7, 0, 7, 4, 0, 4,
+    22, 22, 18, 18, 23, 19, 18, 18, 18, 18, 11, 11, 18, 18, 11, 19, 22, 21, 20, 20, 22, 18, 18, 18, 18, 19, 19, 19, 18, 19, 19, 18,
+    20, 20, 16, 16, 20, 21, 21, 21, 22, 22, 22, 22, 23, 19, 23, 11, 20, 20, 16, 21, 20, 21, 21, 20, 22, 21, 22, 16, 22, 18, 22, 18,
+    22, 22, 18, 18, 21, 18, 18, 18, 20, 18, 19, 19, 20, 18, 19, 18, 19, 20, 20, 20, 18, 18, 18, 18, 20, 19, 19, 20, 20, 20, 20, 19,
+    18, 20, 21, 21, 18, 21, 21, 18, 22, 22, 22, 22, 21, 20, 21, 18, 18, 20, 21, 20, 18, 18, 18, 21, 19, 18, 19, 20, 18, 22, 18, 22,
+    18, 18, 22, 22, 20, 21, 23, 19, 16, 21, 23, 23, 16, 21, 23, 11, 18, 19, 22, 21, 18, 22, 22, 18, 21, 22, 23, 21, 21, 19, 22, 18,
+    11, 19, 22, 22, 19, 23, 22, 19, 22, 22, 4, 4, 22, 19, 4, 7, 11, 19, 22, 16, 19, 21, 23, 20, 23, 21, 5, 15, 22, 18, 4, 0,
+    18, 18, 22, 22, 20, 21, 21, 20, 16, 21, 22, 22, 21, 20, 16, 20, 18, 19, 19, 18, 18, 18, 18, 22, 21, 19, 19, 18, 20, 21, 20, 22,
+    11, 19, 23, 23, 19, 21, 21, 20, 22, 22, 4, 4, 16, 20, 15, 2, 19, 18, 11, 18, 18, 19, 18, 23, 11, 18, 7, 0, 18, 22, 0, 4,
+    4, 22, 0, 18, 5, 19, 11, 18, 2, 11, 7, 11, 7, 11, 7, 11, 4, 21, 16, 20, 22, 18, 18, 18, 19, 18, 10, 10, 19, 18, 18, 7,
+    0, 16, 15, 16, 21, 20, 17, 17, 4, 18, 4, 9, 18, 18, 18, 6, 15, 16, 15, 16, 21, 20, 20, 15, 20, 20, 20, 14, 18, 11, 22, 0,
+    4, 22, 18, 18, 23, 19, 18, 18, 3, 18, 10, 18, 18, 18, 10, 20, 22, 21, 20, 20, 22, 18, 18, 22, 18, 18, 18, 18, 20, 21, 20, 22,
+    1, 20, 16, 20, 20, 20, 20, 20, 0, 18, 18, 0, 16, 20, 16, 1, 20, 20, 17, 18, 18, 19, 18, 23, 10, 18, 10, 3, 18, 22, 18, 4,
+    0, 11, 4, 22, 15, 17, 2, 23, 3, 13, 4, 11, 14, 13, 0, 6, 7, 10, 0, 22, 4, 22, 22, 4, 6, 19, 23, 6, 18, 10, 0, 7,
+    1, 9, 5, 16, 14, 21, 22, 14, 4, 4, 22, 22, 15, 8, 5, 1, 6, 9, 2, 14, 20, 17, 2, 15, 7, 12, 4, 3, 8, 7, 4, 0,
+    0, 11, 22, 18, 15, 20, 17, 21, 14, 20, 20, 20, 16, 16, 15, 15, 7, 18, 10, 19, 18, 18, 18, 22, 10, 18, 10, 19, 16, 21, 16, 4,
+    6, 18, 18, 18, 17, 20, 17, 21, 8, 0, 4, 4, 15, 15, 15, 0, 11, 11, 7, 7, 11, 19, 11, 5, 7, 7, 7, 2, 7, 4, 0, 4,
+    4, 22, 0, 18, 23, 19, 11, 18, 0, 11, 7, 11, 7, 11, 11, 10, 22, 21, 16, 20, 22, 18, 18, 18, 19, 22, 10, 17, 19, 19, 23, 18,
+    2, 16, 15, 16, 21, 23, 17, 10, 4, 4, 4, 8, 23, 19, 5, 9, 15, 16, 16, 17, 21, 21, 22, 20, 22, 21, 4, 13, 22, 18, 22, 9,
+    22, 22, 18, 18, 23, 19, 18, 19, 19, 19, 11, 23, 21, 18, 21, 18, 22, 21, 20, 21, 22, 22, 22, 18, 23, 22, 23, 21, 21, 18, 21, 18,
+    21, 21, 16, 22, 22, 23, 22, 19, 4, 22, 4, 9, 21, 18, 21, 10, 19, 20, 19, 20, 19, 20, 19, 20, 19, 20, 19, 16, 18, 18, 18, 18,
+    0, 4, 4, 4, 3, 23, 5, 19, 3, 5, 5, 8, 23, 19, 23, 10, 1, 22, 4, 21, 22, 22, 22, 18, 4, 22, 4, 17, 23, 19, 23, 10,
+    1, 4, 4, 12, 5, 23, 5, 10, 4, 4, 4, 8, 23, 19, 5, 8, 22, 21, 22, 17, 22, 21, 22, 17, 22, 21, 4, 12, 22, 18, 4, 8,
+    0, 22, 4, 22, 21, 23, 22, 19, 22, 23, 5, 23, 21, 18, 16, 18, 19, 22, 23, 21, 18, 18, 18, 18, 19, 22, 19, 21, 20, 21, 20, 23,
+    23, 22, 4, 22, 21, 23, 21, 19, 22, 22, 4, 8, 16, 18, 15, 7, 19, 20, 11, 20, 18, 19, 18, 22, 11, 20, 7, 15, 18, 22, 0, 4,
+    3, 23, 2, 7, 22, 19, 11, 11, 2, 11, 1, 11, 16, 18, 11, 11, 5, 23, 15, 18, 22, 19, 18, 18, 17, 18, 10, 10, 20, 20, 19, 19,
+    1, 3, 4, 14, 9, 17, 13, 13, 10, 2, 23, 2, 12, 15, 8, 7, 7, 15, 14, 15, 9, 17, 17, 15, 9, 15, 11, 3, 12, 15, 6, 2,
+    3, 21, 18, 18, 16, 20, 18, 18, 15, 20, 18, 18, 16, 20, 18, 18, 21, 21, 18, 18, 21, 20, 19, 23, 17, 20, 19, 19, 17, 20, 19, 5,
+    6, 5, 10, 18, 13, 16, 8, 19, 9, 15, 10, 5, 12, 15, 6, 0, 6, 10, 10, 10, 9, 19, 11, 23, 9, 11, 11, 2, 19, 23, 19, 4,
+    0, 20, 19, 20, 16, 16, 20, 20, 12, 16, 19, 20, 16, 16, 16, 0, 6, 20, 10, 22, 17, 21, 22, 22, 13, 16, 11, 22, 17, 16, 15, 0,
+    7, 12, 19, 17, 12, 15, 8, 3, 10, 14, 19, 23, 12, 15, 22, 5, 7, 12, 10, 14, 8, 15, 0, 2, 9, 14, 5, 3, 12, 15, 4, 5,
+    12, 20, 10, 21, 17, 16, 21, 21, 12, 16, 10, 21, 17, 15, 15, 2, 8, 20, 11, 19, 17, 19, 10, 23, 13, 11, 10, 11, 17, 4, 14, 3,
+    8, 12, 10, 8, 12, 12, 12, 14, 9, 2, 4, 4, 14, 14, 3, 3, 8, 7, 7, 7, 7, 7, 7, 1, 7, 7, 1, 0, 0, 1, 2, 1,
+    5, 5, 2, 7, 23, 19, 11, 11, 0, 11, 7, 7, 11, 11, 11, 11, 4, 23, 15, 18, 23, 19, 18, 18, 18, 18, 10, 10, 18, 18, 10, 7,
+    2, 15, 3, 14, 16, 17, 13, 13, 4, 2, 4, 2, 9, 9, 11, 6, 2, 15, 14, 16, 16, 20, 17, 16, 22, 20, 21, 15, 18, 21, 7, 2,
+    4, 23, 19, 19, 21, 18, 18, 18, 16, 18, 10, 18, 20, 18, 10, 7, 22, 23, 18, 20, 21, 18, 18, 21, 20, 18, 19, 20, 20, 23, 18, 22,
+    1, 4, 6, 18, 10, 18, 18, 10, 0, 23, 19, 0, 22, 4, 6, 1, 7, 18, 10, 20, 18, 18, 18, 21, 10, 18, 10, 16, 19, 23, 19, 4,
+    0, 21, 4, 18, 16, 20, 18, 18, 15, 17, 5, 18, 16, 17, 13, 6, 1, 20, 12, 20, 20, 20, 19, 20, 16, 20, 19, 16, 20, 20, 12, 1,
+    1, 14, 4, 15, 9, 21, 5, 8, 5, 22, 22, 5, 16, 14, 22, 1, 6, 17, 12, 15, 18, 20, 0, 15, 18, 17, 5, 3, 15, 21, 4, 0,
+    15, 21, 20, 18, 16, 20, 20, 16, 15, 20, 21, 22, 16, 15, 14, 2, 20, 18, 10, 18, 20, 19, 18, 23, 10, 18, 10, 18, 15, 23, 15, 4,
+    6, 9, 7, 8, 13, 17, 12, 15, 2, 2, 4, 4, 14, 15, 3, 2, 11, 11, 7, 7, 11, 19, 7, 5, 7, 11, 7, 0, 7, 5, 2, 5,
+    1, 1, 2, 0, 1, 11, 7, 11, 2, 7, 1, 7, 0, 11, 7, 11, 3, 4, 14, 14, 23, 19, 10, 10, 11, 11, 10, 10, 19, 11, 10, 7,
+    1, 14, 4, 14, 14, 13, 12, 13, 23, 2, 23, 18, 16, 9, 19, 11, 0, 15, 14, 14, 16, 17, 13, 14, 19, 13, 18, 15, 10, 16, 19, 0,
+    3, 23, 19, 19, 4, 19, 11, 19, 2, 10, 10, 10, 14, 10, 10, 7, 5, 23, 18, 18, 23, 19, 18, 23, 18, 18, 10, 10, 18, 23, 10, 1,
+    7, 3, 11, 17, 12, 20, 18, 12, 10, 10, 18, 18, 13, 2, 11, 7, 7, 10, 10, 14, 11, 19, 11, 4, 10, 10, 10, 2, 19, 23, 11, 2,
+    1, 14, 23, 16, 14, 13, 2, 9, 4, 12, 23, 19, 14, 13, 18, 11, 7, 12, 10, 13, 3, 20, 11, 2, 11, 18, 18, 11, 17, 12, 18, 7,
+    1, 12, 19, 16, 12, 1, 20, 16, 19, 20, 19, 19, 16, 16, 19, 19, 7, 12, 10, 14, 8, 12, 2, 14, 19, 12, 23, 4, 16, 15, 23, 5,
+    0, 16, 19, 10, 15, 17, 13, 16, 14, 13, 18, 19, 14, 14, 15, 0, 7, 11, 10, 19, 10, 19, 10, 23, 10, 11, 10, 11, 14, 4, 14, 2,
+    7, 8, 11, 16, 12, 12, 12, 14, 10, 2, 23, 23, 14, 14, 4, 5, 7, 7, 7, 0, 7, 7, 7, 1, 7, 7, 1, 2, 0, 1, 2, 1,
+    1, 1, 2, 0, 1, 11, 7, 11, 0, 7, 1, 7, 7, 11, 7, 9, 3, 4, 14, 13, 23, 19, 10, 13, 11, 11, 10, 13, 19, 20, 11, 8,
+    2, 14, 3, 14, 14, 13, 12, 12, 4, 2, 10, 9, 8, 12, 10, 9, 2, 15, 14, 13, 16, 16, 8, 13, 21, 16, 10, 12, 21, 17, 10, 12,
+    4, 23, 19, 19, 23, 19, 11, 9, 2, 11, 11, 9, 10, 10, 10, 6, 5, 23, 18, 17, 23, 20, 19, 21, 19, 20, 11, 13, 18, 21, 10, 6,
+    0, 3, 8, 12, 21, 16, 8, 13, 1, 14, 10, 9, 2, 1, 10, 6, 18, 20, 18, 16, 18, 20, 18, 16, 18, 20, 10, 14, 18, 21, 10, 2,
+    1, 14, 4, 12, 2, 13, 6, 8, 3, 12, 11, 9, 14, 13, 10, 11, 0, 16, 14, 13, 22, 21, 6, 13, 22, 16, 11, 9, 13, 20, 10, 6,
+    1, 14, 4, 12, 2, 14, 8, 12, 23, 14, 19, 10, 17, 13, 19, 11, 0, 16, 12, 12, 20, 16, 2, 12, 20, 16, 19, 12, 16, 20, 19, 0,
+    2, 16, 6, 12, 15, 17, 17, 9, 14, 14, 18, 10, 14, 14, 14, 7, 19, 20, 19, 20, 18, 19, 18, 22, 10, 18, 10, 13, 15, 23, 14, 1,
+    7, 15, 8, 12, 13, 17, 12, 8, 2, 2, 23, 19, 14, 2, 23, 1, 11, 18, 7, 15, 11, 19, 7, 4, 7, 11, 1, 2, 7, 5, 2, 2,
+    4, 23, 0, 7, 22, 19, 11, 11, 2, 11, 7, 11, 16, 18, 11, 11, 22, 23, 19, 18, 22, 19, 19, 18, 20, 18, 11, 10, 20, 18, 18, 8,
+    1, 3, 3, 14, 13, 16, 13, 13, 4, 0, 5, 0, 13, 13, 12, 8, 0, 3, 15, 15, 9, 17, 17, 3, 13, 16, 10, 2, 13, 9, 13, 6,
+    3, 21, 18, 18, 21, 20, 18, 18, 15, 20, 10, 18, 16, 20, 17, 13, 21, 21, 18, 18, 21, 20, 20, 21, 17, 20, 18, 18, 20, 21, 17, 21,
+    6, 5, 18, 21, 13, 21, 16, 20, 12, 21, 21, 21, 17, 17, 13, 13, 6, 18, 10, 18, 20, 19, 18, 23, 18, 19, 11, 19, 20, 22, 17, 22,
+    14, 21, 4, 20, 16, 17, 20, 20, 14, 17, 4, 20, 16, 13, 13, 8, 13, 20, 21, 22, 17, 21, 21, 17, 13, 21, 20, 18, 17, 13, 12, 8,
+    6, 17, 23, 4, 13, 16, 15, 17, 12, 15, 22, 23, 12, 12, 13, 6, 8, 17, 0, 14, 13, 16, 16, 3, 12, 12, 22, 4, 12, 12, 12, 1,
+    12, 20, 20, 20, 16, 20, 16, 20, 12, 16, 20, 20, 16, 16, 12, 12, 13, 20, 18, 18, 20, 20, 20, 21, 17, 18, 10, 18, 16, 16, 15, 15,
+    8, 20, 20, 20, 17, 17, 17, 16, 12, 2, 4, 4, 15, 15, 14, 14, 11, 11, 11, 7, 18, 19, 11, 23, 7, 7, 7, 0, 15, 4, 15, 3,
+    5, 23, 0, 7, 23, 19, 11, 11, 0, 11, 7, 11, 11, 11, 11, 10, 23, 23, 19, 22, 23, 19, 19, 19, 18, 18, 11, 22, 18, 19, 9, 10,
+    2, 3, 3, 14, 4, 23, 5, 19, 5, 5, 5, 23, 4, 10, 8, 10, 2, 22, 15, 21, 22, 23, 23, 18, 4, 22, 5, 21, 22, 19, 9, 11,
+    22, 23, 19, 19, 21, 18, 21, 18, 16, 18, 10, 23, 20, 20, 17, 18, 22, 23, 23, 22, 21, 21, 21, 18, 20, 23, 23, 22, 21, 20, 21, 18,
+    1, 22, 4, 23, 21, 21, 21, 18, 4, 22, 4, 23, 17, 20, 17, 10, 23, 18, 19, 20, 21, 21, 21, 21, 23, 18, 23, 20, 21, 20, 21, 19,
+    2, 21, 5, 23, 16, 23, 4, 19, 15, 5, 4, 5, 16, 10, 12, 9, 21, 22, 4, 22, 21, 23, 22, 19, 4, 22, 4, 22, 13, 19, 13, 10,
+    1, 5, 4, 23, 4, 23, 4, 19, 4, 5, 4, 5, 12, 10, 12, 8, 23, 21, 23, 21, 22, 23, 22, 18, 4, 22, 4, 15, 13, 19, 12, 7,
+    15, 21, 22, 22, 21, 21, 21, 20, 16, 22, 4, 22, 17, 17, 13, 13, 19, 19, 19, 19, 20, 20, 20, 20, 19, 19, 19, 19, 16, 20, 16, 20,
+    22, 22, 22, 22, 21, 21, 21, 20, 22, 22, 4, 4, 17, 17, 12, 12, 19, 18, 11, 18, 20, 19, 20, 23, 11, 18, 7, 0, 16, 21, 15, 4,
+    1, 1, 0, 7, 1, 11, 7, 11, 2, 7, 1, 7, 0, 11, 7, 9, 4, 23, 2, 10, 23, 19, 11, 10, 19, 11, 11, 11, 19, 9, 9, 8,
+    1, 2, 3, 14, 14, 13, 12, 13, 4, 6, 11, 10, 12, 8, 9, 11, 2, 15, 14, 14, 16, 17, 14, 14, 6, 6, 18, 10, 12, 9, 9, 7,
+    3, 23, 11, 19, 4, 19, 11, 20, 2, 10, 10, 10, 13, 13, 13, 8, 5, 23, 19, 19, 23, 20, 20, 21, 18, 18, 10, 10, 17, 21, 13, 8,
+    0, 22, 22, 22, 16, 21, 16, 20, 2, 6, 10, 10, 13, 13, 13, 6, 19, 18, 10, 18, 20, 19, 20, 23, 18, 18, 10, 2, 17, 22, 13, 1,
+    2, 14, 4, 2, 14, 14, 14, 12, 3, 8, 10, 10, 12, 12, 9, 9, 0, 3, 1, 2, 15, 16, 14, 13, 8, 8, 10, 10, 12, 13, 9, 8,
+    1, 2, 5, 17, 14, 14, 14, 12, 4, 8, 19, 19, 12, 12, 10, 11, 1, 13, 2, 14, 15, 16, 14, 2, 8, 8, 19, 23, 12, 8, 19, 7,
+    2, 21, 21, 21, 16, 16, 16, 17, 14, 8, 10, 10, 13, 13, 12, 12, 18, 18, 18, 18, 20, 20, 20, 21, 18, 18, 10, 10, 16, 16, 14, 14,
+    0, 20, 20, 20, 16, 16, 16, 20, 12, 2, 19, 19, 12, 12, 12, 0, 11, 11, 11, 7, 18, 19, 11, 23, 7, 7, 1, 2, 15, 4, 14, 2,
+    1, 1, 0, 7, 1, 11, 7, 7, 0, 7, 7, 6, 7, 7, 6, 7, 4, 23, 1, 1, 23, 23, 1, 11, 1, 5, 1, 6, 1, 11, 6, 11,
+    2, 1, 1, 6, 1, 1, 1, 7, 1, 1, 7, 8, 1, 7, 6, 7, 5, 22, 1, 13, 5, 23, 1, 10, 5, 5, 1, 8, 1, 19, 6, 10,
+    4, 23, 5, 1, 23, 23, 5, 19, 1, 1, 1, 6, 1, 10, 6, 10, 23, 22, 5, 22, 22, 23, 22, 19, 5, 22, 1, 6, 21, 18, 6, 10,
+    5, 5, 1, 1, 5, 23, 5, 11, 1, 1, 1, 8, 1, 10, 6, 10, 23, 21, 5, 21, 22, 23, 22, 18, 5, 21, 1, 13, 21, 18, 6, 10,
+    2, 1, 1, 1, 1, 1, 1, 7, 1, 1, 7, 6, 6, 7, 8, 7, 5, 5, 1, 1, 5, 23, 1, 11, 1, 5, 1, 6, 1, 11, 8, 11,
+    1, 1, 1, 6, 1, 1, 1, 7, 1, 1, 7, 8, 6, 7, 8, 7, 5, 22, 1, 13, 5, 23, 1, 10, 1, 5, 7, 8, 1, 11, 8, 8,
+    5, 5, 5, 1, 22, 23, 5, 19, 1, 1, 1, 6, 13, 10, 13, 9, 23, 22, 5, 22, 21, 23, 21, 19, 5, 22, 1, 6, 17, 20, 13, 10,
+    5, 5, 5, 1, 22, 23, 5, 19, 1, 1, 7, 8, 13, 10, 12, 8, 19, 20, 19, 20, 20, 19, 20, 20, 19, 20, 1, 12, 16, 20, 12, 1,
+    0, 16, 12, 16, 19, 20, 16, 16, 16, 0, 20, 0, 16, 1, 16, 0, 9, 17, 13, 17, 18, 20, 16, 16, 6, 0, 7, 0, 6, 1, 0, 0,
+    6, 13, 9, 13, 7, 18, 0, 16, 10, 6, 18, 0, 8, 1, 1, 0, 9, 9, 8, 13, 7, 18, 0, 16, 7, 0, 7, 0, 6, 1, 1, 2,
+    7, 18, 6, 13, 10, 18, 1, 21, 9, 7, 11, 0, 13, 1, 0, 1, 10, 10, 6, 13, 11, 18, 1, 21, 6, 1, 7, 0, 6, 1, 0, 5,
+    9, 9, 6, 8, 7, 11, 0, 0, 9, 0, 11, 0, 8, 1, 0, 0, 9, 9, 6, 8, 7, 11, 0, 3, 6, 0, 7, 0, 6, 1, 0, 3,
+    6, 6, 10, 6, 8, 7, 0, 0, 17, 0, 20, 1, 17, 0, 16, 0, 6, 6, 6, 6, 7, 7, 0, 0, 6, 6, 7, 0, 6, 1, 0, 0,
+    10, 6, 10, 6, 6, 7, 1, 0, 10, 1, 18, 1, 8, 0, 1, 5, 6, 6, 6, 6, 7, 7, 0, 0, 7, 6, 7, 4, 6, 1, 1, 4,
+    8, 7, 7, 6, 8, 7, 0, 1, 9, 0, 11, 1, 13, 0, 0, 2, 7, 7, 6, 6, 7, 7, 1, 1, 6, 7, 7, 0, 6, 3, 0, 3,
+    9, 6, 7, 6, 6, 7, 0, 0, 9, 0, 11, 1, 8, 0, 3, 3, 6, 6, 6, 6, 7, 7, 0, 0, 6, 0, 1, 1, 0, 0, 0, 0,
+    3, 16, 15, 16, 22, 21, 17, 17, 0, 6, 1, 6, 0, 7, 6, 6, 16, 16, 16, 16, 20, 20, 16, 16, 3, 3, 3, 3, 4, 4, 3, 0,
+    12, 17, 12, 17, 20, 20, 16, 16, 22, 3, 22, 3, 4, 4, 3, 0, 13, 17, 13, 17, 20, 20, 16, 16, 2, 3, 2, 15, 4, 4, 3, 2,
+    19, 20, 17, 17, 19, 20, 21, 21, 15, 4, 3, 3, 15, 4, 4, 1, 18, 20, 17, 17, 18, 20, 21, 21, 5, 4, 3, 3, 5, 22, 4, 5,
+    9, 17, 13, 17, 18, 20, 16, 16, 0, 3, 2, 3, 5, 4, 3, 0, 9, 17, 13, 17, 18, 20, 16, 3, 0, 3, 2, 2, 5, 5, 14, 3,
+    6, 9, 12, 12, 18, 18, 3, 3, 3, 0, 23, 2, 14, 5, 9, 0, 9, 9, 12, 12, 18, 18, 3, 3, 0, 0, 2, 2, 5, 5, 3, 0,
+    8, 9, 13, 12, 10, 18, 2, 3, 23, 0, 22, 4, 1, 5, 23, 5, 9, 9, 12, 12, 10, 18, 2, 2, 0, 0, 23, 3, 1, 6, 5, 3,
+    11, 10, 8, 12, 18, 19, 5, 4, 14, 1, 0, 2, 15, 3, 14, 2, 10, 10, 8, 12, 19, 19, 5, 5, 1, 1, 0, 7, 14, 4, 2, 4,
+    9, 9, 8, 12, 11, 19, 0, 3, 0, 0, 5, 5, 2, 2, 3, 3, 9, 9, 6, 0, 7, 1, 6, 0, 6, 0, 1, 0, 0, 1, 0, 0,
+    0, 15, 3, 15, 1, 22, 6, 17, 4, 0, 22, 6, 2, 7, 7, 6, 14, 16, 14, 16, 21, 21, 17, 17, 18, 9, 18, 9, 10, 10, 9, 6,
+    0, 12, 12, 12, 16, 16, 16, 16, 19, 3, 19, 20, 20, 16, 20, 20, 8, 13, 12, 13, 17, 17, 16, 15, 10, 8, 18, 16, 19, 16, 21, 15,
+    1, 17, 9, 17, 4, 21, 16, 16, 16, 1, 18, 6, 15, 1, 17, 0, 8, 17, 13, 13, 21, 21, 16, 16, 11, 6, 11, 6, 19, 22, 23, 1,
+    6, 13, 9, 13, 17, 17, 16, 16, 18, 6, 18, 21, 20, 3, 21, 1, 8, 13, 9, 13, 17, 17, 16, 3, 11, 6, 16, 15, 23, 5, 16, 2,
+    5, 12, 23, 13, 15, 12, 20, 14, 21, 10, 21, 10, 16, 9, 20, 7, 8, 8, 9, 12, 12, 12, 14, 14, 10, 6, 18, 6, 19, 0, 5, 1,
+    11, 13, 19, 13, 20, 12, 21, 16, 18, 10, 18, 21, 20, 19, 22, 22, 9, 8, 9, 16, 12, 12, 20, 15, 10, 10, 21, 21, 11, 7, 22, 4,
+    7, 8, 10, 8, 15, 12, 21, 14, 20, 7, 18, 7, 16, 15, 3, 0, 8, 8, 9, 8, 8, 5, 6, 5, 11, 6, 11, 6, 14, 3, 2, 3,
+    11, 8, 10, 21, 20, 12, 20, 21, 18, 1, 22, 22, 2, 2, 4, 5, 9, 6, 9, 2, 6, 1, 7, 0, 7, 7, 5, 4, 0, 0, 1, 4,
+    3, 3, 2, 15, 1, 22, 6, 17, 1, 6, 1, 6, 0, 7, 7, 8, 15, 16, 15, 16, 21, 21, 17, 17, 8, 9, 8, 13, 10, 10, 9, 8,
+    2, 15, 14, 15, 16, 16, 17, 13, 4, 2, 22, 17, 23, 17, 20, 13, 12, 16, 12, 16, 16, 16, 16, 12, 20, 16, 16, 16, 16, 20, 16, 12,
+    5, 21, 17, 17, 22, 22, 20, 20, 2, 1, 14, 13, 2, 1, 12, 6, 17, 17, 17, 17, 21, 21, 16, 13, 15, 15, 17, 12, 21, 23, 13, 1,
+    8, 17, 13, 17, 20, 17, 16, 13, 5, 15, 20, 17, 16, 5, 20, 8, 13, 17, 13, 15, 20, 22, 17, 14, 14, 2, 16, 15, 23, 4, 16, 2,
+    5, 12, 4, 12, 2, 17, 7, 12, 4, 7, 23, 9, 2, 6, 10, 6, 8, 13, 12, 12, 17, 17, 15, 12, 18, 12, 17, 13, 3, 18, 5, 6,
+    6, 12, 13, 17, 13, 17, 20, 17, 23, 18, 21, 21, 21, 18, 21, 21, 8, 13, 13, 16, 13, 8, 17, 15, 10, 9, 21, 16, 10, 6, 21, 3,
+    6, 9, 8, 12, 3, 17, 15, 8, 3, 14, 17, 9, 14, 3, 3, 0, 8, 9, 12, 12, 10, 23, 7, 4, 8, 7, 6, 12, 14, 4, 2, 5,
+    6, 13, 20, 17, 12, 14, 20, 17, 1, 1, 22, 21, 2, 2, 22, 5, 8, 6, 6, 15, 7, 1, 6, 2, 7, 6, 22, 3, 0, 1, 1, 3,
+    1, 22, 0, 15, 4, 22, 7, 20, 3, 1, 5, 6, 15, 7, 6, 7, 23, 21, 16, 16, 23, 21, 20, 20, 13, 10, 9, 9, 13, 10, 10, 7,
+    0, 16, 3, 16, 10, 20, 17, 17, 17, 0, 22, 0, 13, 7, 16, 1, 11, 20, 16, 16, 18, 18, 21, 21, 8, 7, 12, 15, 8, 7, 14, 0,
+    1, 19, 20, 20, 19, 19, 20, 20, 12, 4, 16, 20, 12, 16, 16, 16, 11, 18, 20, 20, 19, 18, 21, 22, 9, 11, 12, 21, 13, 21, 16, 22,
+    7, 18, 20, 20, 10, 18, 21, 21, 13, 7, 17, 4, 13, 16, 16, 0, 11, 18, 20, 20, 10, 18, 21, 4, 8, 7, 14, 2, 21, 22, 21, 5,
+    2, 18, 21, 18, 14, 18, 17, 23, 15, 8, 21, 10, 15, 8, 17, 6, 10, 10, 18, 18, 10, 19, 23, 23, 8, 7, 12, 1, 12, 7, 2, 0,
+    6, 10, 21, 18, 9, 11, 16, 23, 17, 6, 21, 22, 13, 6, 4, 1, 10, 10, 10, 2, 10, 11, 7, 2, 8, 7, 23, 4, 8, 7, 5, 4,
+    8, 18, 17, 19, 12, 18, 16, 21, 12, 8, 17, 12, 12, 15, 15, 15, 10, 11, 19, 19, 10, 21, 17, 22, 8, 8, 8, 6, 15, 15, 15, 3,
+    8, 11, 17, 19, 9, 16, 17, 16, 13, 0, 5, 5, 15, 15, 3, 2, 10, 7, 7, 0, 10, 5, 6, 1, 6, 6, 1, 1, 2, 3, 0, 3,
+    4, 4, 0, 15, 5, 22, 7, 20, 0, 7, 1, 6, 0, 7, 6, 11, 22, 21, 16, 16, 22, 21, 20, 20, 11, 10, 9, 9, 11, 18, 10, 11,
+    2, 16, 15, 15, 20, 20, 17, 17, 5, 0, 5, 0, 23, 18, 19, 7, 16, 16, 16, 16, 20, 20, 17, 15, 13, 13, 16, 14, 20, 19, 15, 0,
+    5, 22, 21, 21, 23, 22, 20, 18, 3, 5, 14, 20, 15, 20, 17, 18, 19, 20, 20, 20, 19, 20, 20, 19, 16, 20, 20, 16, 20, 20, 20, 19,
+    11, 20, 17, 20, 18, 20, 21, 18, 2, 22, 21, 2, 17, 20, 17, 11, 18, 20, 17, 15, 18, 22, 20, 23, 23, 5, 14, 3, 21, 22, 21, 5,
+    2, 19, 5, 20, 3, 18, 6, 18, 3, 6, 5, 7, 14, 10, 8, 7, 11, 18, 20, 20, 18, 18, 21, 18, 13, 19, 4, 12, 20, 18, 2, 7,
+    7, 10, 4, 20, 10, 18, 21, 10, 4, 23, 23, 4, 20, 10, 4, 1, 11, 10, 9, 14, 18, 18, 6, 3, 11, 6, 23, 3, 7, 19, 5, 2,
+    7, 19, 18, 20, 18, 20, 17, 20, 14, 13, 15, 12, 16, 16, 15, 15, 11, 18, 18, 11, 18, 21, 20, 22, 9, 10, 8, 7, 16, 21, 15, 4,
+    7, 18, 19, 23, 17, 20, 17, 20, 0, 0, 5, 5, 15, 16, 15, 2, 11, 7, 6, 0, 7, 22, 7, 5, 6, 7, 1, 0, 15, 4, 0, 4,
+    3, 3, 0, 2, 1, 5, 6, 6, 3, 6, 5, 6, 2, 7, 6, 6, 3, 16, 15, 16, 22, 21, 17, 17, 6, 9, 8, 9, 11, 10, 9, 6,
+    0, 15, 3, 15, 16, 16, 17, 17, 22, 0, 22, 20, 21, 9, 20, 7, 2, 16, 15, 16, 21, 16, 17, 15, 11, 13, 21, 16, 17, 11, 21, 2,
+    1, 22, 21, 21, 4, 22, 20, 20, 15, 1, 16, 10, 15, 17, 17, 6, 5, 21, 16, 21, 22, 21, 20, 22, 8, 18, 20, 8, 16, 21, 16, 5,
+    0, 16, 16, 16, 20, 20, 16, 16, 16, 16, 20, 20, 16, 16, 16, 0, 6, 17, 17, 15, 20, 22, 17, 3, 9, 0, 16, 15, 21, 22, 16, 0,
+    3, 6, 22, 11, 15, 8, 17, 9, 3, 6, 21, 10, 15, 8, 17, 6, 6, 9, 0, 13, 1, 18, 16, 0, 6, 3, 18, 10, 12, 8, 0, 6,
+    5, 8, 22, 21, 16, 20, 20, 16, 21, 18, 21, 21, 21, 8, 22, 5, 6, 9, 20, 16, 10, 8, 20, 15, 10, 10, 21, 21, 11, 7, 22, 4,
+    2, 11, 21, 17, 15, 16, 17, 21, 15, 12, 16, 11, 15, 15, 15, 2, 7, 10, 9, 11, 17, 21, 17, 22, 8, 8, 8, 6, 15, 15, 15, 3,
+    6, 9, 20, 21, 17, 16, 17, 16, 17, 0, 22, 22, 15, 15, 3, 0, 6, 6, 7, 2, 6, 5, 6, 0, 6, 6, 5, 4, 2, 3, 0, 3,
+    3, 3, 0, 2, 1, 5, 6, 9, 0, 6, 1, 6, 0, 7, 6, 9, 3, 16, 15, 16, 22, 21, 17, 9, 6, 9, 8, 8, 11, 11, 12, 9,
+    2, 15, 3, 15, 16, 16, 17, 9, 5, 0, 17, 13, 19, 11, 17, 8, 15, 16, 15, 13, 21, 18, 16, 12, 12, 8, 17, 13, 19, 10, 17, 8,
+    5, 22, 21, 21, 4, 22, 20, 10, 2, 1, 12, 8, 20, 18, 20, 11, 22, 21, 16, 13, 22, 18, 21, 19, 19, 11, 12, 9, 20, 18, 20, 11,
+    0, 16, 16, 13, 21, 18, 16, 9, 3, 6, 17, 13, 20, 18, 17, 6, 16, 16, 16, 12, 20, 19, 16, 12, 0, 3, 16, 12, 20, 19, 16, 0,
+    3, 6, 5, 8, 2, 11, 6, 9, 3, 6, 5, 8, 2, 10, 6, 6, 0, 9, 14, 12, 23, 19, 14, 9, 0, 6, 12, 8, 18, 10, 0, 6,
+    1, 8, 16, 13, 23, 11, 16, 13, 22, 6, 21, 17, 18, 10, 21, 6, 6, 9, 17, 16, 9, 18, 17, 14, 10, 9, 21, 16, 10, 18, 21, 2,
+    0, 11, 14, 8, 21, 18, 21, 18, 15, 7, 12, 8, 16, 20, 15, 7, 7, 10, 10, 13, 20, 21, 20, 23, 9, 10, 8, 12, 16, 21, 15, 5,
+    6, 6, 20, 17, 17, 20, 17, 9, 0, 0, 22, 21, 15, 16, 3, 0, 6, 6, 6, 15, 7, 22, 6, 3, 6, 0, 22, 3, 15, 4, 0, 0,
+    0, 0, 4, 0, 2, 1, 6, 6, 16, 6, 21, 7, 16, 6, 17, 6, 0, 3, 14, 14, 22, 22, 9, 9, 9, 6, 19, 8, 12, 11, 3, 6,
+    11, 14, 19, 15, 13, 14, 21, 12, 18, 4, 18, 4, 17, 3, 21, 1, 11, 14, 10, 14, 8, 16, 1, 14, 10, 1, 19, 3, 8, 0, 4, 0,
+    8, 22, 18, 22, 12, 22, 16, 19, 13, 2, 20, 4, 13, 2, 16, 0, 8, 23, 11, 21, 9, 22, 0, 22, 9, 0, 11, 1, 12, 4, 2, 1,
+    9, 0, 18, 5, 13, 2, 16, 3, 9, 0, 18, 4, 13, 2, 16, 0, 9, 0, 11, 2, 8, 5, 0, 3, 9, 0, 11, 2, 8, 4, 0, 0,
+    0, 0, 18, 4, 12, 2, 16, 3, 16, 3, 20, 4, 16, 3, 16, 0, 6, 0, 10, 1, 8, 0, 0, 0, 9, 0, 19, 23, 12, 14, 16, 0,
+    10, 1, 18, 5, 13, 2, 21, 22, 18, 4, 18, 22, 17, 15, 22, 5, 10, 1, 10, 2, 8, 6, 11, 2, 10, 7, 23, 4, 8, 7, 22, 4,
+    8, 0, 18, 4, 12, 2, 16, 15, 13, 2, 20, 22, 13, 14, 15, 2, 8, 0, 11, 7, 8, 4, 8, 4, 9, 6, 11, 6, 14, 3, 14, 2,
+    9, 0, 18, 23, 13, 14, 16, 14, 9, 0, 18, 4, 13, 2, 3, 3, 9, 6, 7, 0, 6, 1, 6, 0, 9, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 6, 6, 0, 0, 1, 6, 0, 7, 6, 6, 3, 3, 14, 14, 22, 22, 9, 9, 6, 6, 8, 8, 11, 11, 9, 6,
+    2, 2, 3, 14, 14, 14, 12, 12, 4, 0, 22, 0, 23, 6, 11, 7, 2, 15, 14, 14, 16, 16, 13, 14, 22, 14, 16, 15, 9, 22, 11, 0,
+    4, 4, 22, 22, 4, 23, 19, 19, 2, 1, 14, 7, 14, 1, 8, 6, 5, 22, 21, 21, 22, 22, 18, 22, 15, 23, 10, 14, 21, 22, 8, 1,
+    0, 3, 6, 15, 7, 22, 17, 6, 0, 9, 22, 4, 14, 2, 6, 0, 6, 3, 12, 14, 19, 23, 12, 3, 6, 0, 14, 2, 22, 4, 6, 0,
+    0, 6, 4, 7, 2, 6, 6, 6, 3, 6, 23, 19, 14, 12, 17, 6, 0, 12, 12, 12, 18, 18, 0, 0, 12, 16, 20, 19, 16, 12, 16, 0,
+    1, 14, 22, 21, 6, 10, 18, 21, 22, 22, 22, 22, 16, 15, 22, 5, 6, 8, 10, 14, 10, 6, 10, 2, 11, 7, 23, 4, 11, 7, 22, 4,
+    0, 22, 7, 8, 15, 16, 12, 15, 14, 14, 21, 22, 14, 14, 15, 2, 7, 11, 8, 7, 9, 22, 8, 4, 8, 6, 8, 6, 14, 3, 14, 2,
+    6, 6, 19, 23, 12, 14, 12, 14, 0, 0, 22, 4, 14, 2, 3, 3, 6, 6, 7, 0, 6, 1, 6, 0, 6, 0, 1, 1, 0, 0, 0, 0,
+    4, 0, 4, 0, 0, 1, 7, 6, 4, 7, 22, 7, 2, 6, 7, 11, 2, 3, 15, 14, 4, 22, 8, 9, 19, 6, 18, 10, 7, 11, 19, 11,
+    5, 15, 23, 15, 21, 14, 20, 17, 22, 4, 22, 18, 21, 23, 18, 18, 0, 14, 15, 16, 15, 16, 21, 16, 19, 22, 20, 20, 18, 22, 18, 18,
+    0, 4, 18, 22, 3, 5, 17, 19, 16, 0, 20, 18, 15, 0, 10, 7, 1, 4, 10, 21, 4, 22, 18, 4, 10, 19, 19, 10, 21, 4, 10, 7,
+    11, 2, 18, 20, 17, 21, 21, 17, 18, 22, 18, 18, 20, 2, 18, 11, 7, 2, 17, 15, 19, 5, 17, 15, 18, 0, 20, 16, 22, 4, 18, 0,
+    4, 7, 22, 11, 15, 8, 20, 18, 21, 10, 21, 18, 16, 13, 18, 11, 7, 12, 18, 20, 0, 4, 22, 18, 18, 18, 18, 18, 17, 13, 18, 11,
+    19, 16, 19, 20, 20, 20, 20, 20, 18, 18, 18, 18, 20, 16, 19, 19, 11, 9, 20, 16, 10, 9, 20, 16, 18, 10, 21, 21, 11, 11, 22, 22,
+    0, 4, 18, 18, 15, 15, 17, 15, 16, 15, 20, 19, 16, 14, 15, 0, 7, 7, 10, 7, 8, 4, 8, 4, 10, 6, 18, 19, 14, 3, 15, 2,
+    11, 7, 18, 21, 17, 14, 20, 21, 18, 4, 22, 22, 15, 15, 23, 5, 11, 6, 7, 2, 6, 1, 7, 0, 7, 7, 22, 4, 0, 0, 4, 4,
+    0, 0, 0, 0, 1, 1, 6, 6, 1, 0, 1, 10, 0, 7, 7, 10, 3, 3, 14, 14, 4, 22, 8, 8, 6, 6, 19, 9, 7, 0, 11, 9,
+    3, 2, 3, 17, 14, 14, 21, 13, 4, 4, 18, 18, 5, 1, 18, 10, 2, 15, 15, 17, 15, 2, 16, 13, 4, 3, 20, 17, 4, 0, 18, 9,
+    4, 4, 4, 8, 4, 5, 1, 8, 2, 1, 19, 10, 2, 1, 11, 10, 5, 4, 3, 12, 22, 22, 0, 9, 5, 0, 19, 9, 1, 23, 11, 8,
+    0, 3, 21, 17, 4, 2, 21, 13, 4, 4, 18, 18, 5, 1, 18, 10, 0, 3, 16, 17, 3, 22, 16, 12, 4, 3, 20, 17, 4, 22, 18, 8,
+    4, 7, 4, 8, 2, 0, 5, 8, 4, 1, 19, 10, 2, 1, 18, 10, 0, 2, 4, 12, 4, 0, 4, 8, 5, 1, 19, 10, 5, 1, 18, 10,
+    5, 3, 21, 17, 4, 3, 21, 17, 22, 4, 18, 18, 5, 5, 18, 18, 0, 3, 20, 16, 4, 3, 20, 16, 4, 4, 20, 20, 4, 4, 18, 18,
+    0, 0, 4, 8, 3, 0, 5, 8, 3, 1, 19, 10, 15, 14, 18, 11, 1, 2, 4, 12, 9, 22, 4, 4, 5, 1, 19, 10, 14, 3, 15, 0,
+    1, 3, 21, 17, 4, 3, 21, 17, 4, 4, 18, 18, 15, 15, 19, 19, 7, 6, 20, 16, 6, 1, 7, 2, 7, 7, 21, 21, 0, 0, 22, 4,
+    2, 1, 1, 0, 2, 1, 6, 7, 3, 6, 5, 7, 15, 6, 6, 8, 5, 4, 2, 14, 22, 23, 11, 10, 12, 7, 6, 8, 13, 9, 12, 8,
+    1, 2, 4, 2, 13, 14, 20, 12, 21, 1, 22, 1, 17, 13, 9, 6, 0, 3, 2, 14, 9, 16, 13, 2, 9, 12, 16, 3, 12, 9, 9, 6,
+    2, 22, 16, 23, 14, 22, 17, 20, 14, 2, 16, 14, 14, 13, 13, 13, 1, 23, 22, 21, 22, 21, 16, 21, 12, 15, 13, 14, 17, 17, 13, 13,
+    8, 5, 20, 16, 13, 17, 16, 20, 13, 14, 17, 5, 13, 13, 13, 8, 6, 5, 12, 2, 20, 22, 20, 22, 13, 1, 14, 2, 17, 21, 13, 1,
+    2, 6, 21, 10, 14, 8, 17, 13, 15, 8, 21, 18, 15, 12, 13, 8, 6, 18, 1, 2, 13, 17, 14, 13, 12, 12, 20, 18, 12, 12, 13, 8,
+    1, 2, 21, 21, 13, 13, 16, 13, 17, 13, 21, 23, 17, 12, 13, 1, 6, 6, 10, 2, 9, 6, 11, 2, 9, 7, 23, 4, 13, 12, 22, 5,
+    12, 20, 16, 16, 12, 16, 16, 16, 12, 12, 16, 20, 12, 12, 12, 12, 8, 10, 9, 10, 17, 21, 17, 21, 12, 8, 8, 8, 15, 15, 14, 14,
+    8, 6, 20, 23, 13, 16, 17, 16, 13, 2, 22, 22, 14, 14, 14, 2, 8, 7, 7, 0, 6, 5, 6, 1, 6, 6, 1, 1, 15, 3, 2, 2,
+    1, 1, 0, 0, 1, 1, 7, 7, 0, 1, 1, 6, 0, 9, 6, 9, 4, 4, 2, 14, 23, 23, 11, 11, 7, 7, 6, 1, 12, 10, 8, 10,
+    2, 2, 3, 2, 2, 11, 0, 11, 5, 0, 5, 0, 12, 9, 8, 9, 2, 3, 14, 14, 4, 19, 1, 10, 2, 1, 0, 14, 12, 10, 8, 11,
+    4, 5, 23, 23, 4, 20, 16, 18, 2, 2, 2, 0, 13, 13, 13, 9, 5, 22, 22, 5, 22, 20, 21, 18, 3, 4, 2, 1, 17, 20, 13, 10,
+    1, 4, 3, 5, 16, 20, 16, 18, 2, 2, 2, 0, 13, 13, 13, 9, 1, 4, 4, 15, 21, 20, 21, 19, 3, 4, 2, 14, 17, 20, 13, 11,
+    2, 6, 5, 1, 2, 10, 2, 10, 3, 0, 5, 0, 12, 9, 12, 8, 1, 5, 2, 1, 3, 18, 2, 10, 2, 0, 2, 0, 12, 9, 12, 8,
+    1, 1, 4, 1, 2, 10, 2, 10, 4, 0, 22, 23, 12, 9, 13, 8, 0, 5, 10, 14, 3, 18, 2, 2, 2, 0, 23, 4, 12, 9, 13, 1,
+    2, 4, 3, 4, 16, 20, 16, 20, 14, 2, 2, 2, 13, 13, 12, 12, 1, 4, 3, 4, 16, 20, 16, 20, 3, 3, 2, 2, 16, 16, 12, 12,
+    0, 4, 3, 4, 16, 20, 16, 20, 2, 2, 22, 22, 13, 13, 12, 12, 6, 7, 7, 0, 17, 21, 6, 5, 6, 6, 1, 1, 16, 16, 14, 2,
+    3, 0, 1, 0, 0, 1, 6, 6, 3, 6, 5, 7, 2, 6, 9, 9, 3, 3, 2, 14, 5, 23, 6, 9, 6, 6, 11, 11, 8, 8, 9, 9,
+    5, 2, 4, 20, 21, 14, 21, 20, 22, 7, 18, 18, 8, 8, 10, 11, 0, 15, 21, 16, 14, 12, 21, 16, 7, 7, 18, 20, 8, 8, 18, 11,
+    2, 5, 16, 23, 3, 17, 16, 17, 15, 6, 11, 11, 13, 13, 9, 8, 1, 22, 23, 19, 16, 21, 16, 21, 6, 6, 11, 11, 13, 17, 13, 8,
+    0, 3, 21, 20, 16, 17, 16, 17, 16, 6, 18, 18, 13, 13, 9, 6, 0, 0, 21, 16, 16, 21, 16, 3, 6, 6, 18, 20, 13, 17, 9, 6,
+    3, 6, 22, 19, 15, 12, 17, 12, 3, 6, 21, 10, 15, 8, 9, 9, 0, 0, 23, 19, 14, 12, 14, 12, 6, 6, 18, 10, 12, 8, 9, 9,
+    5, 1, 22, 20, 16, 12, 21, 20, 21, 10, 18, 18, 13, 13, 19, 11, 7, 9, 20, 16, 10, 9, 20, 16, 10, 10, 21, 21, 13, 13, 23, 23,
+    2, 0, 21, 19, 15, 17, 16, 17, 15, 8, 18, 18, 12, 12, 12, 8, 6, 10, 9, 10, 17, 21, 17, 21, 8, 8, 18, 18, 15, 15, 14, 14,
+    0, 0, 20, 20, 16, 16, 16, 16, 16, 3, 19, 19, 12, 12, 12, 0, 6, 6, 7, 2, 6, 5, 6, 0, 6, 0, 22, 22, 15, 15, 3, 0,
+    0, 0, 0, 0, 1, 1, 6, 6, 0, 6, 7, 7, 6, 6, 6, 6, 3, 3, 0, 6, 1, 7, 0, 6, 0, 6, 7, 6, 6, 7, 6, 6,
+    3, 0, 3, 8, 0, 7, 1, 6, 1, 1, 11, 10, 6, 6, 7, 10, 2, 0, 0, 13, 1, 7, 0, 8, 1, 0, 18, 9, 6, 7, 7, 9,
+    4, 1, 1, 6, 4, 11, 0, 7, 0, 0, 7, 7, 8, 9, 6, 9, 5, 1, 0, 6, 1, 18, 1, 11, 0, 1, 7, 6, 13, 10, 6, 10,
+    0, 0, 1, 8, 0, 11, 0, 6, 0, 0, 11, 10, 8, 9, 6, 9, 0, 0, 0, 13, 1, 18, 0, 9, 0, 6, 18, 9, 13, 10, 6, 6,
+    3, 0, 1, 6, 0, 7, 0, 6, 3, 6, 7, 7, 6, 6, 6, 6, 0, 0, 1, 6, 0, 7, 0, 6, 0, 6, 7, 7, 6, 6, 6, 6,
+    5, 0, 1, 8, 0, 7, 1, 6, 1, 1, 18, 10, 6, 6, 10, 10, 1, 0, 21, 17, 0, 7, 1, 8, 1, 1, 20, 20, 6, 6, 18, 10,
+    2, 1, 1, 6, 0, 11, 0, 7, 0, 0, 7, 7, 13, 9, 8, 8, 0, 1, 1, 6, 16, 20, 0, 11, 0, 0, 7, 7, 17, 17, 12, 8,
+    0, 0, 1, 8, 0, 11, 0, 6, 0, 6, 18, 18, 13, 13, 9, 6, 0, 0, 20, 16, 16, 20, 0, 3, 0, 0, 20, 20, 16, 16, 12, 0,
+    0, 16, 12, 16, 19, 20, 16, 16, 3, 0, 19, 0, 12, 1, 0, 0, 9, 17, 13, 17, 18, 20, 17, 16, 6, 6, 7, 0, 6, 1, 0, 0,
+    8, 13, 12, 13, 11, 18, 17, 16, 10, 6, 11, 6, 6, 1, 0, 0, 9, 13, 13, 13, 11, 18, 17, 12, 7, 6, 7, 12, 6, 1, 0, 14,
+    11, 18, 8, 13, 19, 18, 20, 21, 9, 7, 7, 0, 8, 7, 1, 1, 10, 18, 8, 13, 18, 18, 20, 19, 6, 7, 7, 0, 6, 19, 1, 23,
+    9, 9, 8, 13, 11, 18, 6, 16, 9, 6, 7, 0, 6, 1, 0, 0, 9, 9, 8, 13, 11, 18, 9, 9, 6, 9, 9, 12, 10, 19, 9, 3,
+    6, 9, 9, 8, 10, 11, 6, 0, 9, 6, 11, 6, 8, 7, 6, 0, 9, 9, 8, 8, 11, 11, 6, 0, 6, 6, 7, 6, 6, 7, 0, 0,
+    7, 8, 9, 8, 7, 7, 6, 0, 10, 6, 11, 22, 8, 1, 23, 5, 8, 8, 8, 8, 7, 7, 8, 12, 7, 8, 7, 14, 6, 8, 8, 3,
+    6, 10, 6, 6, 10, 11, 7, 1, 9, 7, 11, 0, 8, 15, 14, 2, 10, 10, 6, 6, 11, 11, 11, 19, 6, 11, 7, 11, 6, 23, 11, 4,
+    6, 6, 6, 6, 7, 7, 6, 0, 9, 6, 7, 5, 6, 2, 3, 3, 6, 6, 6, 6, 7, 7, 6, 6, 6, 6, 6, 6, 7, 7, 6, 0,
+    3, 16, 15, 16, 22, 21, 16, 17, 0, 0, 1, 6, 0, 7, 6, 6, 16, 16, 16, 16, 20, 20, 16, 16, 0, 16, 12, 16, 19, 20, 16, 16,
+    12, 17, 12, 17, 20, 20, 17, 16, 4, 2, 22, 3, 4, 4, 3, 6, 13, 17, 13, 17, 20, 20, 17, 17, 8, 13, 12, 13, 9, 17, 13, 16,
+    19, 20, 17, 17, 19, 20, 20, 21, 3, 5, 3, 3, 15, 4, 4, 7, 18, 20, 17, 17, 18, 20, 20, 20, 11, 18, 10, 20, 19, 18, 18, 21,
+    9, 17, 13, 17, 18, 20, 17, 16, 0, 3, 2, 3, 5, 4, 0, 0, 9, 17, 13, 13, 18, 18, 9, 17, 9, 9, 9, 13, 10, 18, 9, 16,
+    6, 9, 12, 13, 19, 18, 17, 16, 3, 0, 22, 2, 15, 5, 3, 6, 9, 9, 13, 13, 18, 18, 17, 17, 6, 17, 8, 17, 11, 20, 9, 16,
+    8, 9, 12, 12, 10, 18, 12, 15, 23, 0, 23, 22, 0, 2, 23, 5, 9, 9, 12, 12, 9, 13, 8, 12, 8, 13, 9, 12, 9, 13, 8, 14,
+    11, 10, 9, 13, 18, 18, 18, 21, 14, 1, 1, 5, 14, 15, 14, 2, 10, 10, 10, 18, 18, 18, 10, 18, 11, 18, 10, 18, 10, 19, 11, 23,
+    9, 9, 8, 12, 10, 18, 6, 3, 0, 0, 23, 5, 14, 2, 3, 3, 9, 9, 8, 8, 10, 10, 6, 6, 9, 9, 8, 8, 11, 11, 6, 0,
+    2, 15, 14, 15, 5, 22, 16, 17, 4, 0, 5, 0, 0, 7, 6, 6, 14, 16, 14, 16, 21, 21, 16, 17, 10, 8, 18, 9, 10, 10, 9, 0,
+    0, 12, 12, 12, 16, 16, 16, 16, 19, 3, 19, 16, 16, 12, 20, 16, 12, 13, 12, 13, 17, 17, 13, 12, 10, 12, 13, 16, 8, 13, 17, 15,
+    1, 17, 13, 17, 22, 21, 17, 16, 2, 5, 10, 8, 3, 5, 16, 1, 8, 17, 13, 17, 21, 21, 17, 19, 10, 10, 10, 18, 11, 19, 10, 23,
+    6, 13, 9, 13, 20, 17, 17, 17, 11, 12, 17, 16, 12, 12, 21, 16, 8, 13, 13, 12, 9, 10, 9, 12, 9, 9, 13, 14, 10, 10, 9, 14,
+    7, 12, 10, 13, 2, 13, 12, 14, 23, 9, 19, 9, 15, 2, 5, 7, 8, 9, 9, 12, 13, 13, 12, 9, 10, 8, 10, 8, 6, 9, 8, 0,
+    7, 12, 10, 13, 12, 12, 17, 17, 19, 13, 21, 21, 13, 13, 21, 22, 8, 12, 13, 13, 8, 12, 13, 12, 9, 9, 17, 16, 9, 8, 21, 15,
+    7, 9, 10, 12, 2, 13, 13, 17, 10, 6, 10, 10, 14, 15, 14, 2, 8, 10, 9, 10, 10, 19, 11, 19, 10, 10, 10, 10, 10, 23, 11, 4,
+    7, 8, 9, 17, 12, 12, 20, 17, 10, 1, 21, 21, 2, 2, 22, 5, 8, 8, 8, 8, 7, 7, 6, 6, 6, 6, 6, 2, 7, 7, 6, 0,
+    3, 15, 15, 15, 5, 22, 16, 14, 1, 0, 1, 14, 0, 7, 6, 12, 15, 16, 15, 16, 21, 21, 16, 16, 2, 15, 14, 15, 3, 16, 15, 17,
+    14, 15, 14, 15, 16, 16, 15, 14, 4, 14, 15, 17, 2, 15, 16, 13, 12, 16, 12, 12, 12, 16, 12, 16, 12, 12, 12, 12, 12, 16, 12, 12,
+    5, 21, 17, 17, 22, 21, 21, 14, 3, 3, 2, 14, 3, 15, 3, 12, 17, 17, 17, 16, 21, 20, 15, 16, 2, 16, 14, 16, 19, 20, 15, 17,
+    8, 17, 13, 15, 20, 15, 15, 14, 2, 14, 15, 17, 2, 15, 15, 13, 13, 13, 12, 13, 9, 17, 12, 17, 9, 13, 12, 13, 9, 20, 12, 16,
+    1, 12, 12, 14, 3, 15, 2, 14, 4, 3, 15, 12, 2, 15, 15, 12, 8, 15, 12, 15, 2, 16, 14, 16, 2, 15, 14, 15, 2, 16, 14, 17,
+    6, 12, 15, 15, 14, 14, 15, 15, 14, 14, 16, 17, 14, 14, 21, 17, 12, 12, 12, 12, 12, 13, 12, 12, 12, 12, 13, 16, 12, 13, 13, 15,
+    6, 3, 2, 14, 2, 3, 2, 14, 2, 3, 2, 14, 2, 3, 2, 6, 8, 20, 10, 16, 11, 18, 10, 20, 11, 20, 10, 16, 10, 18, 10, 21,
+    8, 14, 15, 15, 2, 14, 15, 15, 14, 14, 21, 17, 2, 2, 21, 5, 9, 9, 8, 12, 10, 10, 8, 12, 9, 9, 8, 12, 10, 10, 6, 2,
+    5, 22, 2, 15, 23, 22, 21, 20, 3, 1, 1, 6, 2, 1, 7, 7, 23, 21, 16, 16, 23, 21, 21, 20, 9, 11, 9, 9, 13, 10, 10, 1,
+    0, 16, 15, 16, 18, 20, 16, 17, 5, 2, 4, 2, 9, 11, 17, 0, 11, 20, 16, 16, 18, 20, 20, 12, 9, 9, 8, 12, 9, 13, 9, 14,
+    1, 19, 20, 20, 19, 19, 20, 20, 12, 4, 20, 19, 12, 20, 16, 20, 19, 18, 20, 20, 19, 18, 18, 19, 9, 19, 11, 18, 18, 21, 20, 22,
+    7, 18, 17, 20, 10, 18, 20, 20, 8, 19, 19, 19, 20, 21, 16, 21, 11, 18, 10, 9, 18, 19, 10, 19, 10, 10, 9, 9, 18, 23, 10, 23,
+    6, 19, 5, 18, 9, 18, 19, 23, 14, 10, 22, 5, 12, 10, 2, 6, 11, 10, 18, 18, 10, 19, 19, 10, 9, 11, 7, 10, 9, 11, 11, 1,
+    6, 10, 5, 18, 9, 19, 18, 20, 8, 7, 23, 22, 8, 8, 23, 5, 11, 9, 9, 12, 10, 9, 8, 12, 8, 8, 9, 14, 8, 8, 8, 3,
+    6, 18, 18, 18, 9, 18, 20, 20, 12, 18, 18, 18, 16, 16, 16, 15, 10, 18, 10, 18, 18, 18, 18, 19, 10, 10, 10, 11, 20, 21, 16, 22,
+    6, 10, 18, 18, 10, 20, 17, 20, 8, 0, 5, 5, 15, 15, 15, 2, 10, 10, 6, 6, 11, 11, 7, 7, 7, 7, 6, 6, 7, 5, 7, 1,
+    4, 22, 2, 15, 22, 22, 21, 23, 0, 1, 1, 6, 0, 23, 7, 19, 22, 21, 16, 16, 22, 21, 21, 21, 5, 22, 4, 21, 23, 22, 22, 20,
+    2, 16, 15, 16, 20, 20, 16, 23, 4, 4, 4, 22, 5, 23, 4, 19, 16, 16, 16, 17, 20, 21, 13, 17, 5, 17, 12, 17, 23, 21, 13, 16,
+    23, 22, 21, 21, 23, 22, 22, 23, 3, 23, 5, 22, 22, 20, 21, 18, 19, 20, 19, 20, 19, 19, 19, 20, 19, 19, 19, 20, 19, 19, 19, 19,
+    11, 20, 17, 22, 18, 22, 22, 23, 5, 23, 5, 22, 22, 20, 22, 18, 18, 18, 10, 20, 19, 18, 19, 20, 10, 18, 10, 17, 19, 18, 19, 21,
+    0, 19, 4, 22, 19, 23, 5, 23, 3, 4, 5, 22, 22, 19, 22, 19, 11, 22, 5, 21, 19, 22, 23, 21, 5, 22, 5, 21, 23, 22, 23, 20,
+    7, 4, 5, 4, 5, 23, 5, 23, 5, 4, 5, 4, 5, 23, 5, 7, 11, 17, 8, 13, 9, 21, 9, 17, 8, 17, 8, 12, 9, 21, 8, 15,
+    7, 19, 23, 23, 21, 21, 21, 21, 23, 23, 23, 23, 21, 20, 16, 20, 19, 19, 19, 18, 18, 18, 18, 18, 19, 19, 19, 18, 18, 21, 18, 22,
+    11, 23, 5, 23, 21, 21, 21, 21, 23, 23, 5, 5, 16, 20, 15, 2, 10, 10, 9, 9, 10, 18, 10, 18, 10, 10, 8, 8, 11, 19, 7, 5,
+    3, 3, 2, 15, 5, 22, 0, 17, 3, 0, 1, 6, 0, 7, 6, 6, 3, 16, 15, 16, 22, 21, 16, 17, 6, 9, 8, 9, 11, 10, 6, 6,
+    0, 15, 3, 15, 21, 16, 16, 16, 5, 14, 16, 17, 14, 14, 20, 17, 2, 16, 15, 13, 21, 13, 13, 12, 8, 12, 13, 16, 8, 13, 13, 15,
+    1, 22, 16, 21, 4, 22, 21, 21, 2, 23, 23, 23, 21, 20, 17, 20, 5, 21, 16, 18, 22, 18, 18, 19, 11, 19, 11, 18, 18, 21, 18, 22,
+    0, 16, 16, 16, 20, 20, 16, 16, 0, 12, 16, 16, 20, 20, 16, 0, 9, 9, 9, 12, 10, 19, 9, 12, 9, 9, 9, 14, 10, 23, 9, 3,
+    0, 6, 5, 0, 2, 1, 3, 0, 3, 0, 4, 10, 3, 9, 0, 6, 6, 6, 6, 8, 7, 11, 6, 9, 6, 6, 6, 8, 7, 11, 6, 0,
+    1, 12, 17, 17, 12, 12, 17, 17, 5, 12, 21, 21, 12, 12, 21, 22, 8, 8, 13, 13, 8, 9, 13, 12, 8, 8, 17, 16, 8, 12, 21, 15,
+    0, 19, 19, 19, 20, 20, 20, 20, 2, 18, 18, 18, 16, 16, 16, 15, 11, 11, 11, 10, 18, 18, 18, 19, 10, 10, 10, 18, 20, 21, 16, 22,
+    6, 12, 17, 17, 20, 20, 17, 17, 6, 0, 21, 21, 15, 15, 3, 0, 9, 9, 8, 8, 11, 11, 6, 6, 6, 6, 6, 2, 7, 5, 6, 0,
+    3, 3, 2, 15, 5, 22, 3, 3, 0, 3, 3, 14, 4, 23, 3, 9, 3, 16, 15, 15, 22, 22, 3, 16, 3, 3, 3, 15, 4, 22, 3, 17,
+    2, 15, 15, 14, 3, 4, 3, 14, 3, 3, 15, 12, 4, 4, 3, 12, 15, 15, 14, 15, 3, 16, 14, 16, 3, 15, 14, 15, 3, 21, 14, 17,
+    5, 22, 4, 3, 22, 23, 4, 23, 4, 4, 3, 3, 22, 19, 4, 19, 22, 22, 4, 21, 23, 22, 23, 21, 4, 22, 4, 16, 23, 22, 23, 20,
+    3, 3, 3, 14, 4, 23, 3, 14, 3, 3, 3, 12, 4, 19, 3, 9, 3, 16, 12, 16, 19, 20, 12, 16, 3, 16, 12, 16, 19, 20, 12, 16,
+    0, 3, 3, 3, 4, 4, 3, 3, 3, 3, 3, 14, 4, 23, 3, 9, 3, 3, 3, 15, 4, 22, 3, 16, 3, 3, 3, 15, 4, 22, 3, 17,
+    3, 3, 15, 14, 3, 4, 3, 14, 3, 3, 15, 12, 3, 4, 15, 12, 14, 15, 12, 15, 3, 16, 12, 16, 14, 15, 12, 15, 3, 16, 12, 12,
+    4, 4, 4, 3, 22, 23, 4, 23, 4, 4, 4, 3, 21, 18, 21, 18, 23, 22, 4, 21, 19, 22, 19, 21, 23, 22, 4, 21, 18, 21, 18, 18,
+    3, 3, 3, 14, 4, 23, 3, 14, 3, 3, 15, 12, 21, 18, 3, 6, 9, 17, 9, 13, 10, 18, 9, 17, 9, 17, 8, 12, 10, 18, 6, 3,
+    0, 3, 3, 2, 4, 5, 0, 6, 3, 0, 5, 0, 2, 1, 0, 6, 0, 3, 14, 15, 23, 22, 16, 17, 9, 6, 18, 8, 13, 11, 9, 0,
+    1, 14, 4, 15, 8, 15, 14, 12, 19, 3, 23, 3, 13, 8, 11, 1, 7, 14, 14, 12, 9, 13, 8, 12, 10, 9, 13, 14, 8, 13, 13, 14,
+    0, 23, 11, 22, 3, 22, 23, 19, 12, 4, 18, 11, 14, 4, 8, 0, 6, 23, 10, 18, 23, 19, 11, 19, 9, 10, 11, 18, 18, 23, 18, 23,
+    6, 0, 11, 6, 8, 7, 9, 6, 9, 6, 10, 4, 9, 3, 6, 0, 6, 9, 9, 9, 10, 10, 9, 9, 9, 9, 9, 12, 10, 19, 9, 3,
+    0, 12, 19, 16, 12, 20, 3, 0, 3, 0, 19, 19, 12, 12, 16, 0, 6, 12, 10, 9, 9, 10, 6, 9, 9, 9, 11, 9, 8, 10, 16, 0,
+    7, 12, 19, 20, 8, 8, 18, 20, 10, 9, 19, 22, 13, 15, 22, 5, 7, 8, 9, 12, 8, 8, 9, 12, 10, 8, 9, 3, 9, 8, 23, 4,
+    6, 18, 10, 10, 12, 17, 13, 17, 9, 10, 18, 22, 12, 15, 15, 2, 6, 10, 10, 10, 10, 19, 10, 19, 9, 11, 10, 11, 10, 4, 14, 3,
+    6, 6, 10, 18, 8, 12, 12, 12, 9, 0, 23, 23, 14, 14, 3, 3, 6, 6, 6, 6, 7, 7, 6, 6, 6, 6, 6, 0, 7, 1, 0, 0,
+    3, 3, 2, 2, 5, 5, 0, 6, 0, 0, 1, 0, 0, 1, 6, 6, 3, 3, 15, 15, 22, 22, 16, 16, 0, 16, 2, 16, 5, 21, 3, 17,
+    2, 3, 3, 14, 15, 15, 14, 3, 4, 2, 4, 2, 0, 3, 2, 6, 2, 13, 14, 13, 8, 17, 12, 17, 8, 13, 12, 13, 8, 17, 12, 16,
+    5, 4, 22, 22, 4, 23, 23, 4, 3, 5, 1, 4, 3, 5, 5, 7, 5, 18, 11, 20, 23, 18, 19, 20, 11, 18, 11, 20, 19, 18, 19, 21,
+    0, 0, 0, 2, 1, 5, 0, 3, 0, 0, 0, 2, 1, 5, 0, 6, 9, 9, 9, 13, 10, 18, 9, 17, 9, 9, 9, 13, 10, 18, 9, 16,
+    0, 14, 4, 3, 3, 4, 0, 3, 3, 3, 5, 3, 2, 4, 17, 6, 0, 16, 0, 16, 1, 20, 0, 16, 0, 16, 0, 16, 1, 20, 0, 0,
+    1, 2, 4, 2, 0, 2, 0, 2, 5, 2, 23, 22, 0, 2, 22, 5, 8, 13, 8, 12, 8, 13, 8, 12, 8, 13, 9, 12, 8, 13, 9, 3,
+    0, 5, 1, 5, 3, 5, 1, 5, 2, 5, 1, 5, 14, 15, 15, 2, 11, 18, 11, 18, 10, 18, 10, 18, 11, 18, 11, 18, 10, 19, 10, 4,
+    6, 0, 0, 0, 1, 1, 0, 0, 0, 0, 23, 23, 14, 14, 3, 3, 9, 9, 8, 8, 10, 10, 6, 6, 9, 9, 8, 8, 11, 11, 6, 0,
+    1, 2, 3, 2, 1, 1, 0, 6, 4, 0, 5, 18, 2, 7, 19, 11, 2, 3, 14, 14, 4, 22, 14, 13, 19, 6, 19, 18, 6, 8, 19, 11,
+    1, 14, 4, 15, 14, 14, 16, 16, 23, 15, 20, 20, 15, 15, 20, 18, 0, 14, 13, 13, 12, 12, 13, 13, 12, 12, 17, 16, 12, 12, 20, 16,
+    0, 4, 11, 22, 3, 23, 22, 21, 2, 1, 19, 18, 2, 2, 19, 11, 1, 10, 11, 10, 11, 19, 11, 19, 11, 10, 11, 10, 11, 19, 11, 1,
+    7, 14, 16, 16, 14, 14, 16, 16, 11, 14, 20, 20, 14, 14, 20, 18, 9, 9, 13, 12, 9, 10, 9, 12, 9, 9, 13, 14, 9, 10, 13, 14,
+    1, 14, 23, 21, 2, 2, 22, 21, 4, 3, 23, 18, 15, 13, 18, 11, 7, 8, 10, 8, 6, 8, 6, 8, 11, 8, 19, 18, 6, 8, 18, 11,
+    1, 12, 19, 16, 12, 12, 20, 16, 19, 16, 20, 20, 16, 16, 19, 19, 7, 12, 13, 13, 8, 12, 13, 13, 9, 9, 21, 16, 9, 9, 22, 22,
+    0, 2, 19, 21, 14, 17, 13, 17, 2, 2, 18, 18, 14, 14, 15, 0, 7, 10, 11, 10, 10, 19, 10, 19, 10, 10, 10, 10, 10, 4, 14, 2,
+    7, 12, 20, 20, 12, 12, 20, 20, 10, 1, 21, 21, 14, 2, 23, 23, 8, 8, 8, 12, 7, 7, 6, 6, 6, 6, 6, 2, 7, 7, 1, 2,
+    2, 2, 2, 2, 1, 1, 2, 14, 1, 2, 1, 12, 0, 2, 2, 9, 3, 3, 14, 14, 3, 15, 2, 14, 2, 15, 3, 14, 3, 15, 2, 12,
+    2, 14, 15, 15, 2, 14, 15, 14, 3, 3, 16, 17, 3, 2, 20, 13, 14, 14, 14, 14, 14, 15, 14, 14, 14, 14, 15, 17, 14, 15, 15, 13,
+    5, 3, 3, 14, 4, 3, 2, 14, 2, 2, 3, 12, 2, 2, 2, 9, 5, 16, 2, 15, 3, 20, 3, 16, 2, 16, 2, 14, 3, 20, 2, 13,
+    2, 2, 15, 15, 2, 3, 15, 14, 2, 2, 16, 17, 2, 14, 20, 13, 12, 13, 14, 13, 9, 17, 14, 17, 12, 13, 14, 13, 9, 17, 14, 14,
+    1, 2, 3, 14, 2, 2, 3, 14, 4, 2, 3, 9, 3, 2, 19, 10, 2, 15, 2, 14, 2, 15, 2, 14, 2, 15, 3, 14, 2, 15, 3, 9,
+    1, 14, 15, 15, 2, 14, 15, 15, 3, 3, 20, 17, 3, 3, 18, 18, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 16, 16, 12, 12, 20, 16,
+    0, 3, 3, 14, 2, 3, 3, 14, 2, 2, 3, 9, 2, 2, 18, 10, 2, 16, 2, 15, 11, 18, 2, 16, 2, 16, 2, 14, 10, 18, 2, 1,
+    2, 2, 15, 15, 2, 2, 15, 15, 2, 14, 20, 20, 2, 2, 18, 18, 9, 13, 12, 12, 10, 10, 8, 12, 9, 9, 13, 14, 10, 10, 6, 2,
+    0, 4, 0, 0, 4, 5, 1, 7, 3, 1, 5, 6, 2, 13, 12, 8, 5, 4, 3, 15, 22, 22, 22, 18, 12, 7, 7, 11, 12, 13, 12, 8,
+    1, 3, 4, 14, 8, 15, 15, 16, 4, 0, 4, 4, 12, 13, 12, 8, 0, 9, 8, 12, 8, 9, 8, 12, 8, 9, 8, 12, 8, 9, 8, 0,
+    0, 22, 22, 22, 3, 22, 21, 21, 14, 22, 22, 22, 17, 17, 17, 13, 1, 23, 19, 19, 18, 18, 18, 18, 19, 19, 19, 19, 20, 21, 17, 21,
+    6, 23, 23, 23, 21, 21, 21, 21, 8, 22, 22, 22, 17, 17, 17, 13, 10, 10, 10, 9, 18, 19, 10, 19, 10, 10, 10, 9, 18, 22, 18, 22,
+    0, 22, 4, 4, 14, 16, 15, 16, 3, 4, 22, 18, 14, 13, 13, 8, 6, 11, 7, 11, 9, 11, 7, 11, 8, 11, 7, 11, 12, 13, 13, 8,
+    1, 5, 23, 20, 12, 16, 15, 16, 4, 4, 22, 22, 12, 12, 13, 1, 6, 9, 9, 12, 8, 9, 9, 12, 8, 8, 9, 3, 8, 8, 22, 4,
+    0, 18, 18, 18, 12, 20, 16, 20, 12, 20, 20, 20, 16, 16, 12, 12, 6, 18, 10, 18, 18, 18, 18, 18, 10, 10, 10, 10, 16, 21, 15, 15,
+    6, 18, 18, 18, 17, 17, 17, 17, 8, 0, 22, 4, 15, 15, 14, 14, 10, 10, 6, 6, 11, 19, 7, 7, 7, 7, 6, 6, 7, 4, 0, 4,
+    4, 4, 0, 0, 5, 5, 5, 23, 0, 5, 1, 5, 0, 19, 5, 10, 4, 4, 4, 22, 22, 22, 4, 22, 5, 22, 4, 22, 4, 23, 5, 19,
+    2, 4, 3, 4, 4, 23, 5, 23, 4, 4, 4, 4, 4, 19, 5, 10, 2, 21, 4, 17, 5, 22, 4, 21, 5, 21, 4, 17, 4, 22, 4, 18,
+    4, 22, 4, 22, 22, 22, 22, 23, 4, 4, 4, 5, 21, 20, 17, 18, 23, 23, 23, 22, 22, 22, 22, 22, 23, 23, 23, 22, 22, 20, 22, 18,
+    5, 5, 5, 4, 22, 22, 22, 23, 4, 4, 4, 22, 21, 20, 17, 18, 19, 18, 10, 20, 23, 18, 23, 20, 19, 18, 10, 20, 22, 18, 22, 22,
+    0, 4, 4, 4, 4, 23, 4, 23, 3, 5, 4, 5, 4, 10, 12, 9, 5, 22, 5, 22, 4, 22, 4, 22, 5, 22, 5, 22, 4, 23, 4, 10,
+    1, 4, 5, 4, 4, 23, 4, 23, 4, 4, 4, 4, 4, 10, 12, 8, 5, 17, 8, 13, 5, 22, 5, 17, 5, 17, 8, 12, 4, 22, 4, 0,
+    0, 22, 4, 22, 21, 21, 21, 21, 4, 4, 4, 4, 17, 20, 13, 13, 19, 19, 19, 19, 18, 18, 18, 18, 19, 19, 19, 19, 20, 20, 16, 20,
+    5, 5, 5, 5, 21, 21, 21, 21, 4, 22, 4, 4, 17, 17, 12, 12, 10, 18, 9, 9, 18, 18, 10, 18, 10, 10, 8, 8, 18, 22, 7, 4,
+    0, 0, 0, 0, 1, 1, 0, 6, 3, 0, 1, 11, 0, 8, 9, 9, 3, 3, 2, 14, 4, 22, 0, 9, 6, 6, 19, 11, 12, 8, 9, 9,
+    1, 2, 3, 16, 14, 14, 21, 16, 4, 7, 18, 18, 8, 8, 18, 11, 2, 12, 13, 13, 8, 12, 13, 13, 12, 12, 20, 16, 8, 8, 18, 11,
+    0, 4, 22, 22, 4, 21, 16, 21, 2, 6, 11, 11, 13, 13, 13, 8, 5, 19, 11, 19, 18, 18, 18, 18, 19, 19, 11, 11, 17, 21, 13, 8,
+    0, 14, 16, 16, 21, 21, 16, 16, 0, 6, 18, 18, 13, 13, 9, 6, 9, 9, 9, 12, 10, 19, 9, 12, 9, 9, 13, 14, 18, 22, 9, 0,
+    0, 0, 4, 22, 2, 14, 14, 14, 3, 6, 19, 19, 12, 12, 9, 9, 0, 6, 6, 6, 7, 7, 6, 6, 6, 6, 19, 19, 12, 12, 9, 9,
+    1, 14, 21, 21, 14, 14, 21, 21, 4, 7, 18, 18, 12, 8, 19, 19, 8, 8, 13, 13, 8, 8, 13, 13, 8, 12, 21, 21, 8, 8, 22, 22,
+    0, 22, 22, 22, 16, 16, 16, 16, 2, 6, 18, 10, 13, 13, 12, 12, 11, 11, 11, 11, 18, 18, 18, 18, 10, 18, 10, 10, 16, 16, 14, 14,
+    0, 12, 20, 16, 16, 20, 16, 16, 0, 0, 18, 18, 12, 12, 12, 0, 9, 9, 8, 8, 11, 11, 6, 6, 6, 6, 6, 2, 7, 4, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 6, 3, 3, 2, 2, 4, 4, 0, 0, 3, 3, 2, 2, 5, 5, 0, 6,
+    2, 2, 2, 2, 1, 1, 0, 0, 0, 0, 0, 8, 1, 1, 0, 6, 3, 3, 2, 14, 4, 4, 2, 14, 3, 3, 2, 14, 4, 4, 0, 8,
+    4, 4, 0, 0, 5, 5, 1, 1, 1, 1, 0, 0, 1, 11, 1, 7, 4, 4, 3, 3, 4, 22, 4, 22, 4, 4, 2, 2, 5, 23, 1, 11,
+    3, 3, 2, 2, 5, 5, 0, 0, 0, 0, 0, 8, 1, 11, 0, 6, 3, 16, 3, 15, 4, 22, 3, 16, 3, 16, 2, 14, 4, 22, 0, 9,
+    0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 6, 1, 7, 6, 6, 3, 3, 2, 2, 4, 4, 0, 0, 3, 3, 2, 2, 5, 5, 0, 6,
+    2, 2, 2, 14, 1, 1, 0, 0, 0, 0, 0, 8, 1, 1, 7, 8, 3, 15, 14, 14, 4, 4, 2, 14, 3, 3, 15, 12, 4, 4, 0, 8,
+    4, 4, 0, 0, 5, 23, 1, 1, 1, 1, 0, 0, 1, 10, 6, 10, 4, 22, 3, 3, 22, 22, 4, 22, 4, 4, 2, 2, 21, 18, 1, 10,
+    3, 3, 2, 2, 5, 5, 0, 0, 0, 0, 0, 8, 1, 10, 6, 6, 3, 16, 12, 16, 19, 20, 3, 16, 3, 16, 12, 12, 18, 18, 0, 0,
+    0, 0, 18, 18, 12, 12, 16, 3, 16, 3, 20, 19, 16, 12, 16, 3, 6, 6, 10, 1, 8, 0, 0, 0, 0, 0, 5, 5, 2, 2, 3, 3,
+    10, 1, 18, 21, 2, 2, 4, 4, 22, 4, 22, 22, 3, 3, 22, 4, 10, 6, 10, 1, 0, 0, 1, 1, 1, 1, 23, 5, 0, 0, 4, 4,
+    8, 0, 4, 4, 12, 15, 3, 3, 14, 2, 4, 4, 14, 14, 15, 3, 8, 7, 1, 1, 8, 0, 0, 0, 0, 0, 1, 1, 14, 2, 2, 2,
+    6, 0, 5, 5, 2, 2, 3, 3, 0, 0, 4, 4, 2, 2, 3, 3, 6, 6, 7, 1, 6, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+    9, 0, 22, 4, 14, 2, 16, 3, 16, 3, 22, 4, 15, 3, 16, 3, 6, 0, 11, 1, 8, 0, 0, 0, 0, 0, 5, 5, 2, 2, 3, 3,
+    11, 1, 23, 5, 2, 2, 4, 4, 22, 4, 22, 4, 3, 3, 4, 4, 7, 1, 11, 1, 0, 0, 1, 1, 1, 1, 5, 5, 0, 0, 4, 4,
+    8, 0, 4, 4, 14, 2, 3, 3, 14, 2, 4, 4, 14, 2, 3, 3, 6, 0, 1, 1, 8, 0, 0, 0, 0, 0, 1, 1, 2, 2, 2, 2,
+    6, 0, 5, 5, 2, 2, 3, 3, 0, 0, 4, 4, 2, 2, 3, 3, 6, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 4, 7, 2, 6, 6, 6, 6, 6, 11, 11, 8, 8, 9, 9, 0, 12, 12, 12, 18, 18, 0, 0, 16, 16, 20, 16, 16, 20, 12, 0,
+    14, 14, 16, 16, 10, 10, 18, 10, 18, 18, 18, 18, 11, 11, 11, 11, 12, 12, 13, 13, 10, 18, 6, 2, 16, 16, 16, 16, 22, 22, 22, 0,
+    22, 22, 8, 8, 21, 21, 12, 8, 13, 13, 8, 8, 13, 13, 8, 8, 19, 19, 8, 12, 18, 18, 7, 4, 21, 21, 14, 14, 21, 21, 14, 1,
+    9, 9, 12, 12, 19, 19, 6, 6, 6, 6, 7, 7, 6, 6, 6, 0, 9, 9, 12, 12, 19, 19, 6, 3, 14, 14, 14, 2, 22, 4, 0, 0,
+    0, 9, 22, 18, 14, 13, 9, 9, 12, 9, 19, 10, 12, 9, 9, 9, 6, 9, 13, 13, 18, 18, 6, 0, 16, 16, 21, 21, 16, 16, 14, 0,
+    8, 13, 21, 17, 11, 11, 19, 19, 18, 18, 18, 18, 19, 11, 19, 5, 8, 13, 13, 13, 11, 11, 6, 2, 21, 16, 21, 4, 22, 22, 4, 0,
+    11, 18, 8, 8, 16, 20, 12, 12, 13, 13, 12, 8, 13, 13, 12, 2, 11, 18, 8, 8, 18, 18, 7, 4, 16, 21, 14, 14, 16, 3, 2, 1,
+    9, 9, 8, 12, 11, 19, 6, 6, 9, 0, 22, 4, 14, 2, 3, 3, 9, 9, 8, 0, 11, 1, 0, 3, 6, 0, 1, 1, 0, 0, 0, 0,
+    4, 7, 22, 18, 8, 8, 10, 10, 18, 10, 18, 18, 9, 9, 18, 10, 12, 12, 17, 17, 4, 4, 22, 4, 21, 21, 21, 21, 5, 5, 5, 5,
+    20, 16, 20, 20, 19, 19, 19, 19, 18, 18, 18, 18, 19, 19, 19, 19, 13, 13, 20, 17, 4, 4, 4, 4, 21, 21, 21, 21, 22, 4, 22, 0,
+    0, 4, 22, 4, 12, 8, 17, 5, 17, 5, 22, 5, 13, 8, 17, 5, 8, 12, 10, 4, 4, 4, 4, 4, 23, 4, 23, 4, 4, 5, 4, 1,
+    10, 4, 23, 4, 22, 5, 22, 5, 22, 4, 22, 4, 22, 5, 22, 5, 9, 12, 10, 4, 5, 4, 5, 3, 23, 4, 23, 4, 4, 4, 4, 0,
+    22, 22, 18, 22, 20, 10, 18, 19, 20, 23, 18, 23, 20, 10, 18, 19, 18, 17, 20, 21, 22, 4, 4, 4, 23, 22, 22, 22, 4, 5, 5, 5,
+    18, 22, 20, 22, 22, 23, 23, 23, 22, 22, 22, 22, 22, 23, 23, 23, 18, 17, 20, 21, 5, 4, 4, 4, 23, 22, 22, 22, 22, 4, 22, 4,
+    18, 4, 22, 4, 17, 4, 21, 5, 21, 4, 22, 5, 17, 4, 21, 2, 10, 5, 19, 4, 4, 4, 4, 4, 23, 5, 23, 4, 4, 3, 4, 2,
+    19, 5, 23, 4, 22, 4, 22, 5, 22, 4, 22, 22, 22, 4, 4, 4, 10, 5, 19, 0, 5, 1, 5, 0, 23, 5, 5, 5, 0, 0, 4, 4,
+    4, 0, 4, 7, 6, 6, 7, 7, 7, 7, 19, 11, 6, 6, 10, 10, 14, 14, 15, 15, 4, 22, 0, 8, 17, 17, 17, 17, 18, 18, 18, 6,
+    15, 15, 21, 16, 10, 10, 10, 10, 18, 18, 18, 18, 18, 10, 18, 6, 12, 12, 16, 16, 20, 20, 20, 12, 20, 16, 20, 12, 18, 18, 18, 0,
+    4, 22, 8, 8, 3, 9, 8, 8, 12, 9, 9, 8, 12, 9, 9, 6, 1, 13, 12, 12, 22, 22, 4, 4, 16, 15, 16, 12, 20, 23, 5, 1,
+    8, 13, 13, 12, 11, 7, 11, 8, 11, 7, 11, 9, 11, 7, 11, 6, 8, 13, 13, 14, 18, 22, 4, 3, 16, 15, 16, 14, 4, 4, 22, 0,
+    22, 18, 22, 18, 9, 10, 10, 10, 19, 10, 19, 18, 9, 10, 10, 10, 13, 17, 17, 17, 22, 22, 22, 8, 21, 21, 21, 21, 23, 23, 23, 6,
+    21, 17, 21, 20, 19, 19, 19, 19, 18, 18, 18, 18, 19, 19, 23, 1, 13, 17, 17, 17, 22, 22, 22, 14, 21, 21, 22, 3, 22, 22, 22, 0,
+    0, 8, 9, 8, 12, 8, 9, 8, 12, 8, 9, 8, 12, 8, 9, 0, 8, 12, 13, 12, 4, 4, 0, 4, 16, 15, 15, 8, 14, 4, 3, 1,
+    8, 12, 13, 12, 11, 7, 7, 12, 18, 22, 22, 22, 15, 3, 4, 5, 8, 12, 13, 2, 6, 5, 1, 3, 7, 1, 5, 4, 0, 0, 4, 0,
+    2, 6, 10, 10, 14, 13, 9, 9, 12, 8, 10, 10, 12, 12, 13, 9, 18, 18, 2, 2, 20, 20, 14, 2, 15, 15, 2, 2, 15, 15, 2, 2,
+    1, 2, 18, 10, 14, 2, 16, 2, 16, 2, 18, 11, 15, 2, 16, 2, 10, 18, 2, 2, 9, 3, 2, 2, 14, 3, 3, 2, 14, 3, 3, 0,
+    16, 20, 12, 12, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 18, 18, 3, 3, 17, 20, 3, 3, 15, 15, 14, 2, 15, 15, 14, 1,
+    9, 3, 15, 2, 14, 3, 15, 2, 14, 2, 15, 2, 14, 2, 15, 2, 10, 19, 2, 3, 9, 3, 2, 4, 14, 3, 2, 2, 14, 3, 2, 1,
+    14, 14, 17, 9, 13, 14, 13, 12, 17, 14, 17, 9, 13, 14, 13, 12, 13, 20, 14, 2, 17, 16, 2, 2, 14, 15, 3, 2, 15, 15, 2, 2,
+    13, 2, 20, 3, 14, 2, 16, 2, 16, 3, 20, 3, 15, 2, 16, 5, 9, 2, 2, 2, 12, 3, 2, 2, 14, 2, 3, 4, 14, 3, 3, 5,
+    13, 15, 15, 14, 17, 15, 14, 14, 14, 14, 15, 14, 14, 14, 14, 14, 13, 20, 2, 3, 17, 16, 3, 3, 14, 15, 14, 2, 15, 15, 14, 2,
+    12, 2, 15, 3, 14, 3, 15, 2, 14, 2, 15, 3, 14, 14, 3, 3, 9, 2, 2, 0, 12, 1, 2, 1, 14, 2, 1, 1, 2, 2, 2, 2,
+    2, 1, 7, 7, 2, 6, 6, 6, 6, 6, 7, 7, 12, 8, 8, 8, 23, 23, 2, 14, 21, 21, 1, 10, 20, 20, 12, 12, 20, 20, 12, 7,
+    2, 14, 4, 10, 10, 10, 10, 10, 19, 10, 19, 10, 10, 11, 10, 7, 0, 15, 14, 14, 18, 18, 2, 2, 17, 13, 17, 14, 21, 19, 2, 0,
+    22, 22, 9, 9, 16, 21, 9, 9, 13, 13, 12, 8, 13, 13, 12, 7, 19, 19, 16, 16, 20, 20, 16, 19, 16, 20, 12, 12, 16, 19, 12, 1,
+    11, 18, 8, 6, 18, 19, 8, 11, 8, 6, 8, 6, 8, 10, 8, 7, 11, 18, 13, 15, 18, 23, 3, 4, 21, 22, 2, 2, 21, 23, 14, 1,
+    14, 13, 10, 9, 14, 13, 9, 9, 12, 9, 10, 9, 12, 13, 9, 9, 18, 20, 14, 14, 20, 20, 14, 11, 16, 16, 14, 14, 16, 16, 14, 7,
+    1, 11, 19, 11, 10, 11, 10, 11, 19, 11, 19, 11, 10, 11, 10, 1, 11, 19, 2, 2, 18, 19, 1, 2, 21, 22, 23, 3, 22, 11, 4, 0,
+    16, 20, 12, 12, 16, 17, 12, 12, 13, 13, 12, 12, 13, 13, 14, 0, 18, 20, 15, 15, 20, 20, 15, 23, 16, 16, 14, 14, 15, 4, 14, 1,
+    11, 19, 8, 6, 18, 19, 6, 19, 13, 14, 22, 4, 14, 14, 3, 2, 11, 19, 7, 2, 18, 5, 0, 4, 6, 0, 1, 1, 2, 3, 2, 1,
+    0, 6, 11, 11, 8, 8, 9, 9, 6, 6, 10, 10, 8, 8, 9, 9, 3, 3, 14, 14, 23, 23, 0, 0, 0, 0, 1, 1, 0, 0, 0, 6,
+    4, 10, 19, 10, 18, 11, 18, 11, 18, 10, 18, 10, 18, 11, 18, 11, 2, 15, 15, 14, 5, 1, 5, 2, 5, 1, 5, 3, 5, 1, 5, 0,
+    3, 9, 13, 8, 12, 9, 13, 8, 12, 8, 13, 8, 12, 8, 13, 8, 5, 22, 2, 0, 22, 23, 2, 5, 2, 0, 2, 0, 2, 4, 2, 1,
+    0, 0, 20, 1, 16, 0, 16, 0, 16, 0, 20, 1, 16, 0, 16, 0, 6, 17, 4, 2, 3, 5, 3, 3, 3, 0, 4, 3, 3, 4, 14, 0,
+    16, 9, 18, 10, 13, 9, 9, 9, 17, 9, 18, 10, 13, 9, 9, 9, 6, 0, 5, 1, 2, 0, 0, 0, 3, 0, 5, 1, 2, 0, 0, 0,
+    21, 19, 18, 19, 20, 11, 18, 11, 20, 19, 18, 23, 20, 11, 18, 5, 7, 5, 5, 3, 4, 1, 5, 3, 4, 23, 23, 4, 22, 22, 4, 5,
+    16, 12, 17, 8, 13, 12, 13, 8, 17, 12, 17, 8, 13, 14, 13, 2, 6, 2, 3, 0, 2, 4, 2, 4, 3, 14, 15, 15, 14, 3, 3, 2,
+    17, 3, 21, 5, 16, 2, 16, 0, 16, 16, 22, 22, 15, 15, 3, 3, 6, 6, 1, 0, 0, 1, 0, 0, 6, 0, 5, 5, 2, 2, 3, 3,
+    0, 0, 1, 7, 0, 6, 6, 6, 6, 6, 7, 7, 6, 6, 6, 6, 3, 3, 14, 14, 23, 23, 0, 9, 12, 12, 12, 8, 18, 10, 6, 6,
+    3, 14, 4, 10, 11, 10, 11, 9, 19, 10, 19, 10, 10, 10, 10, 6, 2, 15, 15, 12, 22, 18, 10, 9, 17, 13, 17, 12, 10, 10, 18, 6,
+    4, 23, 8, 9, 3, 9, 8, 10, 12, 9, 8, 8, 12, 9, 8, 7, 5, 22, 15, 13, 22, 19, 9, 10, 20, 18, 8, 8, 20, 19, 12, 7,
+    0, 16, 10, 8, 9, 11, 9, 9, 9, 6, 10, 9, 9, 10, 12, 6, 0, 16, 12, 12, 19, 19, 0, 3, 0, 3, 20, 12, 16, 19, 12, 0,
+    3, 9, 19, 10, 12, 9, 9, 9, 9, 9, 10, 10, 9, 9, 9, 6, 0, 6, 3, 9, 4, 10, 6, 9, 6, 9, 7, 8, 6, 11, 0, 6,
+    23, 18, 23, 18, 18, 11, 10, 9, 19, 11, 19, 23, 18, 10, 23, 6, 0, 8, 4, 14, 11, 18, 4, 12, 19, 23, 22, 3, 22, 11, 23, 0,
+    14, 13, 13, 8, 14, 13, 9, 10, 12, 8, 13, 9, 12, 14, 14, 7, 1, 11, 8, 13, 3, 23, 3, 19, 12, 14, 15, 8, 15, 4, 14, 1,
+    0, 9, 11, 13, 8, 18, 6, 9, 17, 16, 22, 23, 15, 14, 3, 0, 6, 0, 1, 2, 0, 5, 0, 3, 6, 0, 5, 4, 2, 3, 3, 0,
+    3, 6, 18, 10, 12, 8, 17, 9, 17, 9, 18, 10, 13, 9, 17, 9, 6, 3, 18, 21, 12, 15, 3, 3, 14, 3, 23, 4, 14, 3, 3, 3,
+    18, 18, 21, 18, 21, 4, 22, 23, 21, 19, 22, 19, 21, 4, 22, 23, 18, 21, 18, 21, 3, 4, 4, 4, 23, 4, 23, 22, 3, 4, 4, 4,
+    12, 12, 16, 3, 15, 12, 15, 14, 16, 12, 16, 3, 15, 12, 15, 14, 12, 15, 4, 3, 12, 15, 3, 3, 14, 3, 4, 3, 14, 15, 3, 3,
+    17, 3, 22, 4, 15, 3, 3, 3, 16, 3, 22, 4, 15, 3, 3, 3, 9, 3, 23, 4, 14, 3, 3, 3, 3, 3, 4, 4, 3, 3, 3, 0,
+    16, 12, 20, 19, 16, 12, 16, 3, 16, 12, 20, 19, 16, 12, 16, 3, 9, 3, 19, 4, 12, 3, 3, 3, 14, 3, 23, 4, 14, 3, 3, 3,
+    20, 23, 22, 23, 16, 4, 22, 4, 21, 23, 22, 23, 21, 4, 22, 22, 19, 4, 19, 22, 3, 3, 4, 4, 23, 4, 23, 22, 3, 4, 22, 5,
+    17, 14, 21, 3, 15, 14, 15, 3, 16, 14, 16, 3, 15, 14, 15, 15, 12, 3, 4, 4, 12, 15, 3, 3, 14, 3, 4, 3, 14, 15, 15, 2,
+    17, 3, 22, 4, 15, 3, 3, 3, 16, 3, 22, 22, 15, 15, 16, 3, 9, 3, 23, 4, 14, 3, 3, 0, 3, 3, 22, 5, 15, 2, 3, 3,
+    0, 6, 5, 7, 2, 6, 6, 6, 6, 6, 11, 11, 8, 8, 9, 9, 0, 3, 15, 15, 21, 21, 0, 6, 17, 17, 20, 20, 17, 17, 12, 6,
+    22, 16, 21, 20, 18, 10, 10, 10, 19, 18, 18, 18, 10, 11, 11, 11, 15, 16, 16, 16, 18, 18, 18, 2, 20, 20, 20, 20, 19, 19, 19, 0,
+    15, 21, 12, 8, 16, 17, 8, 8, 12, 13, 9, 8, 13, 13, 8, 8, 22, 21, 12, 12, 21, 21, 12, 5, 17, 17, 12, 12, 17, 17, 12, 1,
+    0, 6, 11, 7, 8, 6, 6, 6, 9, 6, 11, 7, 8, 6, 6, 6, 6, 0, 9, 3, 10, 4, 0, 3, 0, 3, 1, 2, 0, 5, 6, 0,
+    3, 9, 23, 10, 14, 9, 9, 9, 12, 9, 19, 10, 12, 9, 9, 9, 0, 16, 20, 20, 16, 16, 12, 0, 16, 16, 20, 20, 16, 16, 16, 0,
+    22, 18, 21, 18, 18, 11, 19, 11, 19, 18, 18, 22, 18, 16, 21, 5, 20, 17, 20, 21, 23, 23, 23, 2, 21, 21, 22, 4, 21, 16, 22, 1,
+    15, 13, 13, 8, 16, 13, 12, 8, 12, 13, 13, 21, 13, 15, 16, 2, 17, 20, 14, 14, 17, 16, 14, 5, 16, 16, 16, 21, 15, 3, 15, 0,
+    6, 6, 10, 11, 9, 8, 9, 6, 17, 16, 21, 22, 16, 15, 16, 3, 6, 6, 7, 0, 6, 1, 0, 3, 17, 0, 22, 5, 15, 2, 3, 3,
+    5, 7, 19, 11, 8, 8, 10, 10, 18, 10, 18, 10, 9, 9, 10, 10, 2, 15, 20, 16, 5, 5, 23, 23, 21, 21, 21, 21, 23, 5, 23, 11,
+    22, 18, 21, 18, 18, 19, 19, 19, 18, 18, 18, 18, 18, 19, 19, 19, 20, 16, 20, 21, 23, 23, 23, 23, 21, 21, 21, 21, 23, 23, 19, 7,
+    15, 8, 21, 9, 12, 8, 17, 8, 17, 9, 21, 9, 13, 8, 17, 11, 7, 5, 23, 5, 4, 5, 4, 5, 23, 5, 23, 5, 4, 5, 4, 7,
+    20, 23, 22, 23, 21, 5, 22, 5, 21, 23, 22, 19, 21, 5, 22, 11, 19, 22, 19, 22, 22, 5, 4, 3, 23, 5, 23, 19, 22, 4, 19, 0,
+    21, 19, 18, 19, 17, 10, 18, 10, 20, 19, 18, 19, 20, 10, 18, 18, 18, 22, 20, 22, 22, 5, 23, 5, 23, 22, 22, 18, 22, 17, 20, 11,
+    19, 19, 19, 19, 20, 19, 19, 19, 20, 19, 19, 19, 20, 19, 20, 19, 18, 21, 20, 22, 22, 5, 23, 3, 23, 22, 22, 23, 21, 21, 22, 23,
+    16, 13, 21, 23, 17, 12, 17, 5, 17, 13, 21, 20, 17, 16, 16, 16, 19, 4, 23, 5, 22, 4, 4, 4, 23, 16, 20, 20, 16, 15, 16, 2,
+    20, 22, 22, 23, 21, 4, 22, 5, 21, 21, 21, 22, 16, 16, 21, 22, 19, 7, 23, 0, 6, 1, 1, 0, 23, 21, 22, 22, 15, 2, 22, 4,
+    1, 7, 5, 7, 6, 6, 7, 7, 7, 7, 11, 11, 6, 6, 10, 10, 2, 15, 15, 15, 5, 5, 0, 8, 20, 17, 20, 10, 18, 18, 10, 6,
+    22, 16, 21, 20, 11, 10, 10, 10, 19, 18, 18, 18, 18, 10, 18, 10, 15, 16, 16, 16, 18, 18, 18, 12, 20, 20, 18, 9, 18, 18, 18, 6,
+    3, 8, 8, 8, 14, 9, 8, 8, 12, 8, 9, 10, 12, 9, 9, 11, 5, 23, 8, 8, 22, 23, 7, 8, 20, 18, 19, 9, 18, 5, 10, 6,
+    1, 11, 11, 9, 10, 7, 11, 9, 10, 19, 19, 10, 18, 18, 10, 11, 6, 2, 10, 12, 5, 22, 10, 14, 23, 19, 18, 9, 18, 5, 19, 6,
+    23, 10, 23, 18, 9, 9, 10, 10, 19, 10, 19, 18, 9, 10, 18, 11, 21, 16, 21, 20, 19, 19, 19, 8, 20, 20, 18, 10, 20, 17, 18, 7,
+    22, 20, 21, 18, 18, 11, 19, 9, 19, 18, 18, 19, 20, 20, 18, 19, 20, 16, 20, 12, 19, 20, 4, 12, 20, 20, 19, 19, 20, 20, 19, 1,
+    14, 9, 13, 9, 12, 8, 9, 9, 12, 20, 20, 18, 16, 16, 20, 11, 0, 17, 11, 9, 2, 4, 2, 5, 17, 16, 20, 18, 16, 15, 16, 0,
+    1, 10, 10, 13, 9, 9, 11, 9, 20, 21, 21, 23, 16, 16, 21, 23, 7, 7, 1, 2, 6, 1, 1, 3, 20, 21, 22, 23, 15, 2, 22, 5,
+    2, 6, 10, 10, 12, 8, 9, 9, 12, 8, 10, 10, 12, 8, 9, 9, 5, 21, 2, 2, 17, 21, 14, 14, 15, 15, 14, 2, 15, 15, 14, 8,
+    21, 10, 18, 10, 16, 10, 20, 11, 20, 10, 18, 11, 16, 10, 20, 8, 6, 2, 3, 2, 14, 2, 3, 2, 14, 2, 3, 2, 14, 2, 3, 6,
+    15, 13, 13, 12, 16, 13, 12, 12, 12, 12, 13, 12, 12, 12, 12, 12, 17, 21, 14, 14, 17, 16, 14, 14, 15, 15, 14, 14, 15, 15, 12, 6,
+    17, 14, 16, 2, 15, 14, 15, 2, 16, 14, 16, 2, 15, 12, 15, 8, 12, 15, 15, 2, 12, 15, 3, 4, 14, 2, 15, 3, 14, 12, 12, 1,
+    16, 12, 20, 9, 13, 12, 13, 9, 17, 12, 17, 9, 13, 12, 13, 13, 13, 15, 15, 2, 17, 15, 14, 2, 14, 15, 15, 20, 15, 13, 17, 8,
+    17, 15, 20, 19, 16, 14, 16, 2, 16, 15, 20, 21, 16, 17, 17, 17, 12, 3, 15, 3, 14, 2, 3, 3, 14, 21, 21, 22, 17, 17, 21, 5,
+    12, 12, 16, 12, 12, 12, 12, 12, 16, 12, 16, 12, 12, 12, 16, 12, 13, 16, 15, 2, 17, 15, 14, 4, 14, 15, 16, 16, 15, 14, 15, 14,
+    17, 15, 16, 3, 15, 14, 15, 2, 16, 16, 21, 21, 16, 15, 16, 15, 12, 6, 7, 0, 14, 1, 0, 1, 14, 16, 22, 5, 15, 15, 15, 3,
+    0, 6, 7, 7, 2, 6, 6, 6, 6, 6, 7, 7, 8, 8, 8, 8, 5, 22, 2, 2, 21, 21, 1, 10, 17, 20, 12, 12, 17, 9, 8, 7,
+    4, 11, 23, 10, 10, 10, 10, 10, 19, 11, 19, 10, 10, 9, 10, 8, 2, 14, 15, 14, 10, 10, 6, 10, 17, 13, 13, 2, 12, 10, 9, 7,
+    15, 21, 8, 9, 16, 17, 9, 9, 12, 13, 12, 8, 13, 13, 12, 8, 22, 21, 13, 13, 21, 21, 13, 19, 17, 17, 12, 12, 13, 10, 12, 7,
+    0, 8, 9, 6, 8, 10, 8, 10, 9, 12, 13, 13, 12, 9, 9, 8, 7, 5, 2, 15, 9, 19, 9, 23, 14, 12, 13, 2, 13, 10, 12, 7,
+    14, 9, 10, 10, 14, 13, 9, 9, 12, 9, 10, 9, 12, 13, 13, 8, 16, 21, 12, 12, 16, 17, 12, 11, 17, 17, 17, 20, 13, 9, 13, 6,
+    23, 10, 19, 11, 18, 10, 10, 10, 19, 17, 21, 21, 17, 13, 17, 8, 1, 16, 5, 3, 8, 10, 5, 2, 16, 17, 21, 22, 17, 13, 17, 1,
+    15, 17, 13, 8, 16, 13, 12, 10, 12, 13, 17, 17, 13, 12, 13, 12, 16, 20, 12, 16, 16, 19, 3, 19, 16, 16, 16, 16, 12, 12, 12, 0,
+    0, 9, 10, 10, 9, 18, 8, 10, 17, 16, 21, 21, 16, 14, 16, 14, 6, 6, 7, 0, 0, 5, 0, 4, 17, 16, 22, 5, 15, 14, 15, 2,
+    0, 6, 11, 11, 8, 8, 9, 9, 6, 6, 10, 10, 8, 8, 9, 9, 3, 3, 2, 14, 5, 23, 0, 0, 3, 6, 18, 10, 12, 8, 9, 9,
+    23, 11, 19, 10, 18, 10, 18, 11, 18, 10, 18, 18, 18, 10, 10, 10, 2, 14, 15, 14, 5, 1, 1, 14, 21, 18, 18, 18, 13, 9, 10, 11,
+    14, 8, 13, 9, 12, 9, 13, 8, 12, 8, 13, 9, 12, 12, 9, 9, 5, 23, 2, 0, 22, 23, 0, 23, 15, 12, 18, 10, 12, 12, 9, 8,
+    16, 9, 20, 11, 17, 8, 17, 6, 17, 17, 18, 18, 13, 13, 9, 9, 6, 3, 5, 15, 2, 22, 0, 3, 16, 17, 18, 19, 13, 12, 9, 6,
+    16, 9, 18, 10, 13, 9, 9, 9, 17, 9, 18, 18, 13, 13, 17, 9, 0, 0, 4, 5, 3, 2, 3, 0, 16, 17, 20, 18, 17, 13, 17, 9,
+    21, 18, 18, 19, 20, 10, 18, 11, 20, 20, 20, 18, 17, 17, 20, 18, 7, 4, 4, 15, 3, 3, 5, 3, 21, 20, 20, 19, 17, 17, 20, 19,
+    16, 13, 17, 9, 13, 12, 13, 8, 17, 17, 20, 20, 17, 13, 17, 13, 6, 3, 4, 4, 3, 22, 2, 4, 16, 17, 20, 20, 17, 12, 17, 12,
+    16, 16, 20, 19, 16, 12, 16, 0, 16, 16, 20, 20, 16, 16, 16, 16, 6, 6, 7, 0, 6, 1, 0, 0, 17, 16, 21, 22, 16, 15, 16, 3,
+    0, 6, 7, 7, 6, 6, 6, 6, 6, 6, 7, 7, 6, 6, 6, 6, 3, 3, 2, 6, 5, 7, 6, 9, 0, 6, 7, 7, 6, 6, 6, 6,
+    4, 11, 23, 6, 11, 7, 11, 6, 19, 11, 11, 11, 6, 6, 10, 10, 2, 14, 15, 8, 0, 11, 7, 9, 1, 7, 11, 10, 6, 6, 10, 6,
+    3, 8, 8, 6, 14, 7, 8, 7, 12, 8, 7, 7, 8, 8, 8, 8, 5, 23, 1, 8, 22, 11, 6, 10, 0, 6, 7, 7, 8, 9, 8, 7,
+    0, 0, 7, 6, 6, 7, 6, 6, 0, 6, 11, 11, 8, 8, 9, 9, 0, 6, 7, 8, 6, 11, 6, 9, 0, 6, 11, 10, 8, 9, 9, 6,
+    3, 9, 19, 10, 12, 9, 9, 6, 9, 9, 18, 11, 13, 8, 9, 9, 0, 0, 1, 6, 0, 7, 6, 9, 16, 6, 18, 11, 13, 8, 9, 9,
+    23, 1, 19, 6, 0, 7, 7, 6, 19, 20, 18, 18, 13, 8, 18, 10, 1, 1, 7, 8, 0, 7, 7, 9, 21, 20, 18, 19, 13, 8, 18, 11,
+    14, 0, 1, 6, 12, 7, 6, 7, 12, 17, 18, 11, 13, 13, 13, 9, 0, 0, 1, 6, 6, 11, 6, 10, 16, 17, 18, 11, 13, 12, 13, 8,
+    0, 0, 1, 6, 0, 7, 6, 6, 16, 17, 20, 18, 17, 13, 17, 9, 0, 0, 1, 12, 0, 19, 0, 3, 16, 16, 20, 19, 16, 12, 16, 0,
+    0, 12, 16, 16, 20, 20, 0, 0, 3, 0, 20, 16, 16, 20, 0, 0, 6, 9, 13, 13, 18, 18, 6, 0, 6, 0, 11, 0, 8, 1, 0, 0,
+    8, 12, 17, 17, 7, 7, 0, 0, 11, 0, 20, 16, 6, 1, 1, 0, 8, 8, 9, 13, 7, 7, 0, 0, 7, 0, 11, 0, 6, 1, 1, 2,
+    10, 18, 6, 6, 20, 20, 1, 1, 8, 1, 7, 0, 17, 21, 0, 1, 10, 10, 6, 6, 10, 18, 1, 1, 6, 1, 7, 0, 8, 1, 0, 5,
+    6, 6, 6, 6, 7, 7, 6, 0, 6, 0, 7, 0, 6, 1, 0, 0, 6, 6, 6, 6, 7, 7, 6, 3, 6, 0, 7, 0, 6, 1, 0, 3,
+    6, 6, 10, 13, 9, 18, 6, 0, 9, 0, 18, 1, 13, 0, 0, 0, 9, 6, 9, 8, 10, 11, 0, 0, 6, 0, 11, 0, 8, 1, 0, 0,
+    10, 6, 10, 13, 6, 7, 1, 0, 11, 1, 18, 1, 6, 0, 1, 5, 9, 6, 9, 8, 7, 7, 0, 0, 7, 0, 11, 4, 6, 1, 1, 4,
+    9, 7, 7, 6, 9, 18, 0, 1, 8, 0, 7, 1, 13, 0, 0, 2, 10, 7, 6, 6, 10, 11, 1, 1, 6, 1, 7, 0, 8, 3, 0, 3,
+    6, 6, 7, 6, 6, 7, 6, 0, 6, 0, 7, 1, 6, 0, 3, 3, 6, 6, 6, 6, 7, 7, 6, 0, 6, 6, 1, 1, 0, 0, 0, 0,
+    0, 3, 15, 15, 22, 22, 0, 6, 0, 6, 5, 6, 2, 7, 6, 6, 0, 12, 12, 12, 19, 19, 3, 16, 16, 16, 16, 16, 20, 20, 0, 0,
+    14, 14, 15, 15, 18, 18, 8, 8, 21, 17, 21, 17, 10, 9, 10, 6, 8, 12, 12, 12, 18, 18, 8, 15, 17, 16, 17, 15, 19, 21, 0, 2,
+    23, 23, 13, 13, 21, 21, 10, 10, 16, 20, 9, 10, 16, 20, 9, 7, 11, 19, 13, 13, 18, 18, 10, 21, 20, 21, 12, 16, 20, 22, 1, 5,
+    9, 9, 8, 12, 10, 18, 6, 6, 12, 14, 12, 14, 19, 23, 0, 0, 9, 9, 8, 15, 10, 21, 6, 3, 12, 17, 12, 15, 19, 22, 6, 3,
+    6, 9, 17, 13, 20, 18, 6, 6, 3, 16, 21, 16, 16, 21, 0, 0, 6, 9, 13, 13, 18, 18, 6, 16, 17, 16, 17, 16, 20, 21, 3, 0,
+    8, 13, 17, 13, 11, 11, 6, 6, 21, 16, 21, 16, 19, 23, 22, 1, 8, 9, 13, 13, 11, 11, 6, 15, 17, 16, 17, 3, 23, 16, 5, 2,
+    11, 18, 8, 8, 20, 18, 7, 7, 16, 21, 12, 14, 16, 21, 15, 0, 11, 10, 8, 8, 18, 18, 7, 22, 20, 21, 14, 21, 20, 4, 2, 5,
+    9, 9, 8, 8, 11, 11, 6, 6, 9, 6, 23, 5, 14, 2, 3, 3, 9, 9, 6, 2, 7, 5, 6, 3, 6, 6, 1, 0, 0, 1, 0, 3,
+    2, 14, 16, 16, 1, 1, 6, 6, 5, 6, 21, 17, 0, 7, 7, 6, 12, 12, 13, 13, 22, 22, 2, 2, 20, 16, 20, 16, 4, 3, 4, 0,
+    12, 12, 16, 16, 2, 2, 3, 3, 20, 16, 20, 16, 4, 3, 4, 1, 12, 12, 13, 13, 2, 2, 2, 14, 20, 16, 20, 16, 4, 3, 4, 2,
+    1, 13, 9, 12, 4, 23, 0, 2, 2, 2, 18, 3, 14, 10, 5, 0, 8, 13, 9, 12, 23, 22, 0, 4, 10, 2, 10, 2, 1, 4, 1, 1,
+    8, 12, 9, 12, 0, 2, 0, 2, 10, 2, 18, 3, 1, 2, 5, 1, 8, 12, 9, 12, 0, 5, 0, 3, 10, 2, 10, 2, 1, 5, 6, 2,
+    11, 13, 20, 17, 14, 2, 4, 3, 19, 21, 20, 21, 15, 4, 4, 1, 9, 13, 13, 13, 0, 2, 2, 2, 18, 16, 20, 16, 5, 3, 4, 1,
+    10, 13, 20, 17, 1, 2, 4, 3, 18, 21, 20, 22, 5, 22, 22, 5, 9, 13, 13, 13, 0, 2, 2, 2, 18, 16, 20, 4, 23, 23, 5, 4,
+    11, 8, 10, 12, 14, 0, 1, 2, 10, 1, 19, 4, 14, 14, 3, 2, 9, 8, 9, 12, 0, 5, 0, 5, 11, 0, 11, 2, 2, 3, 2, 2,
+    10, 8, 10, 12, 1, 6, 7, 7, 11, 11, 23, 23, 14, 2, 4, 4, 9, 6, 9, 0, 6, 1, 1, 0, 7, 7, 1, 1, 0, 0, 1, 1,
+    2, 2, 3, 15, 1, 1, 6, 6, 1, 6, 5, 6, 0, 7, 7, 8, 2, 14, 14, 14, 22, 22, 2, 13, 16, 17, 16, 13, 23, 20, 6, 8,
+    14, 14, 15, 15, 8, 8, 8, 12, 21, 17, 21, 17, 10, 9, 10, 8, 12, 12, 12, 12, 20, 16, 12, 12, 16, 16, 16, 12, 16, 16, 20, 12,
+    5, 22, 12, 13, 4, 23, 7, 9, 2, 11, 6, 9, 2, 10, 6, 6, 1, 13, 12, 17, 23, 21, 13, 17, 13, 16, 13, 13, 21, 21, 2, 1,
+    8, 13, 12, 12, 18, 20, 12, 12, 13, 14, 17, 13, 2, 1, 18, 6, 8, 13, 12, 15, 18, 21, 8, 15, 13, 17, 8, 14, 10, 21, 6, 2,
+    1, 13, 21, 17, 2, 14, 1, 13, 22, 20, 22, 20, 2, 12, 5, 6, 8, 13, 13, 13, 5, 17, 14, 13, 20, 16, 17, 13, 16, 20, 5, 8,
+    13, 13, 17, 17, 14, 13, 15, 12, 21, 16, 21, 22, 21, 22, 23, 1, 13, 13, 13, 14, 14, 16, 2, 14, 20, 17, 22, 14, 23, 16, 22, 2,
+    6, 9, 9, 12, 3, 16, 12, 9, 2, 13, 16, 9, 14, 2, 3, 0, 6, 9, 13, 17, 1, 22, 1, 21, 12, 20, 14, 13, 2, 4, 2, 1,
+    8, 12, 9, 13, 8, 6, 7, 12, 10, 11, 23, 22, 14, 2, 4, 5, 8, 6, 6, 15, 7, 5, 6, 3, 7, 6, 1, 2, 0, 1, 1, 2,
+    4, 22, 0, 0, 21, 21, 7, 7, 2, 7, 1, 6, 16, 20, 6, 7, 19, 19, 15, 15, 18, 18, 4, 4, 17, 21, 3, 4, 17, 21, 3, 1,
+    0, 15, 3, 14, 10, 19, 1, 5, 4, 4, 22, 9, 12, 4, 2, 1, 11, 18, 14, 15, 10, 19, 1, 3, 8, 5, 0, 3, 8, 4, 0, 0,
+    18, 18, 4, 4, 20, 20, 4, 4, 16, 20, 3, 4, 16, 20, 3, 0, 18, 18, 5, 5, 18, 18, 4, 22, 17, 21, 3, 4, 17, 21, 3, 5,
+    10, 18, 1, 5, 10, 19, 1, 5, 8, 4, 0, 4, 12, 4, 2, 0, 10, 18, 1, 2, 10, 19, 1, 4, 8, 5, 0, 2, 8, 4, 7, 4,
+    8, 18, 22, 4, 17, 20, 3, 4, 12, 16, 22, 3, 17, 16, 3, 0, 10, 18, 1, 5, 18, 18, 4, 4, 13, 21, 2, 4, 17, 21, 3, 0,
+    8, 11, 23, 1, 9, 19, 0, 5, 9, 0, 22, 22, 12, 3, 4, 5, 10, 11, 1, 2, 10, 19, 1, 2, 8, 1, 5, 4, 8, 4, 4, 4,
+    9, 18, 0, 4, 17, 20, 3, 4, 13, 16, 2, 15, 17, 15, 15, 2, 10, 18, 1, 5, 18, 18, 4, 4, 13, 21, 14, 14, 17, 3, 2, 3,
+    9, 11, 0, 7, 9, 19, 6, 6, 8, 8, 22, 4, 14, 14, 3, 3, 10, 7, 7, 0, 10, 1, 0, 1, 6, 6, 1, 1, 0, 0, 0, 0,
+    4, 4, 0, 0, 4, 22, 7, 7, 0, 7, 1, 6, 2, 7, 6, 11, 5, 23, 15, 15, 22, 22, 4, 18, 21, 20, 14, 17, 21, 18, 7, 11,
+    2, 15, 3, 14, 19, 18, 6, 10, 4, 8, 4, 8, 7, 10, 7, 7, 0, 15, 14, 16, 19, 20, 15, 16, 15, 17, 15, 15, 18, 18, 4, 0,
+    22, 22, 11, 11, 21, 21, 10, 18, 16, 20, 9, 10, 16, 20, 9, 11, 19, 19, 16, 20, 18, 18, 18, 18, 20, 20, 20, 20, 20, 19, 16, 19,
+    11, 18, 13, 17, 18, 18, 18, 18, 18, 22, 4, 0, 20, 18, 12, 7, 11, 18, 13, 16, 18, 21, 10, 21, 18, 20, 8, 15, 11, 22, 7, 4,
+    0, 18, 4, 22, 16, 20, 0, 18, 15, 17, 5, 19, 15, 17, 2, 7, 11, 18, 2, 20, 18, 18, 22, 18, 17, 21, 21, 17, 20, 18, 2, 11,
+    7, 10, 4, 21, 10, 19, 19, 10, 4, 18, 22, 4, 21, 10, 4, 1, 7, 10, 0, 15, 18, 20, 0, 16, 19, 17, 5, 3, 22, 18, 4, 0,
+    18, 18, 22, 18, 20, 20, 22, 19, 16, 21, 16, 15, 16, 15, 14, 0, 18, 18, 23, 21, 18, 22, 4, 22, 17, 20, 14, 21, 15, 23, 15, 5,
+    11, 19, 11, 7, 10, 18, 6, 19, 9, 8, 22, 4, 14, 15, 3, 2, 11, 7, 6, 2, 7, 22, 7, 4, 6, 7, 1, 0, 0, 4, 0, 4,
+    0, 0, 0, 0, 1, 1, 0, 6, 0, 6, 1, 6, 0, 7, 6, 6, 3, 3, 2, 14, 4, 22, 0, 0, 14, 12, 14, 12, 23, 19, 6, 6,
+    2, 14, 3, 14, 6, 8, 6, 8, 4, 8, 22, 9, 7, 8, 11, 7, 2, 15, 14, 14, 22, 21, 14, 14, 15, 12, 16, 15, 8, 7, 22, 0,
+    4, 22, 7, 11, 4, 23, 7, 11, 2, 10, 6, 10, 14, 10, 8, 6, 5, 22, 15, 16, 22, 22, 22, 22, 21, 18, 10, 6, 21, 22, 14, 1,
+    0, 16, 12, 16, 19, 20, 16, 12, 0, 0, 18, 18, 12, 12, 12, 0, 6, 17, 12, 14, 19, 23, 6, 3, 6, 6, 6, 2, 7, 4, 6, 0,
+    0, 6, 4, 22, 2, 14, 0, 6, 3, 12, 23, 19, 14, 12, 3, 6, 0, 6, 2, 14, 4, 22, 9, 0, 6, 17, 22, 7, 15, 6, 3, 0,
+    1, 8, 22, 21, 14, 10, 23, 15, 22, 18, 22, 22, 21, 21, 22, 5, 6, 8, 1, 14, 7, 14, 1, 2, 19, 19, 23, 4, 22, 22, 4, 4,
+    0, 11, 22, 9, 15, 16, 14, 22, 14, 13, 16, 16, 14, 14, 15, 2, 7, 11, 6, 23, 0, 22, 0, 4, 12, 12, 14, 14, 14, 3, 2, 2,
+    6, 9, 11, 11, 8, 8, 6, 6, 9, 9, 22, 22, 14, 14, 3, 3, 6, 6, 7, 0, 6, 1, 0, 0, 6, 6, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 9, 0, 6, 1, 6, 0, 7, 6, 9, 3, 3, 2, 13, 4, 18, 0, 9, 14, 16, 14, 13, 23, 18, 0, 9,
+    2, 14, 3, 14, 6, 11, 6, 9, 4, 8, 4, 8, 7, 11, 0, 8, 2, 15, 14, 13, 22, 20, 2, 13, 15, 16, 2, 12, 4, 18, 0, 8,
+    4, 22, 7, 8, 4, 23, 7, 10, 2, 11, 6, 8, 2, 10, 1, 10, 5, 22, 15, 17, 22, 18, 4, 18, 22, 21, 2, 13, 5, 18, 1, 10,
+    0, 16, 14, 12, 23, 19, 0, 9, 0, 0, 0, 8, 1, 10, 0, 6, 0, 16, 3, 16, 4, 20, 3, 16, 3, 16, 2, 12, 4, 18, 0, 0,
+    0, 0, 4, 8, 2, 11, 0, 9, 3, 0, 5, 8, 2, 11, 0, 9, 0, 16, 2, 13, 4, 18, 0, 9, 3, 16, 2, 13, 5, 18, 0, 9,
+    1, 2, 4, 12, 1, 11, 0, 9, 22, 0, 22, 9, 21, 11, 23, 8, 0, 16, 2, 13, 4, 20, 2, 13, 19, 16, 22, 12, 22, 18, 22, 8,
+    0, 4, 0, 8, 3, 19, 1, 10, 14, 1, 16, 8, 14, 10, 14, 11, 1, 21, 3, 17, 4, 18, 4, 18, 12, 21, 14, 13, 15, 19, 14, 11,
+    6, 3, 11, 12, 8, 19, 6, 9, 9, 9, 22, 22, 14, 14, 3, 0, 6, 17, 6, 16, 7, 21, 6, 16, 6, 6, 1, 2, 0, 4, 0, 0,
+    0, 0, 4, 15, 3, 22, 0, 6, 3, 6, 22, 7, 15, 6, 6, 6, 0, 3, 16, 15, 21, 22, 0, 0, 9, 17, 20, 17, 17, 20, 6, 6,
+    5, 15, 21, 16, 12, 8, 10, 9, 23, 20, 21, 20, 13, 10, 10, 7, 7, 15, 20, 16, 8, 12, 7, 15, 18, 21, 18, 21, 8, 14, 11, 0,
+    2, 21, 18, 10, 16, 21, 9, 10, 14, 17, 18, 9, 16, 17, 9, 6, 6, 21, 10, 18, 17, 21, 6, 22, 13, 16, 11, 23, 13, 16, 8, 1,
+    6, 0, 10, 18, 8, 12, 6, 0, 9, 14, 19, 23, 12, 14, 9, 0, 6, 6, 10, 2, 8, 5, 6, 3, 9, 6, 11, 2, 8, 5, 6, 3,
+    0, 16, 19, 20, 12, 16, 3, 0, 12, 16, 19, 20, 12, 16, 16, 16, 6, 17, 18, 20, 13, 17, 6, 3, 9, 16, 18, 21, 13, 16, 16, 0,
+    11, 20, 18, 20, 9, 12, 11, 19, 19, 21, 18, 22, 13, 16, 21, 22, 11, 20, 18, 20, 8, 12, 1, 2, 10, 20, 22, 4, 21, 21, 22, 5,
+    8, 17, 10, 19, 13, 17, 8, 12, 12, 16, 18, 21, 13, 15, 16, 15, 8, 17, 11, 19, 13, 17, 0, 5, 9, 17, 16, 16, 15, 3, 15, 2,
+    9, 12, 11, 11, 8, 8, 9, 6, 9, 17, 21, 22, 16, 15, 16, 3, 9, 6, 7, 0, 6, 1, 6, 0, 9, 6, 5, 1, 2, 0, 3, 3,
+    3, 0, 3, 2, 4, 5, 6, 6, 0, 6, 5, 6, 2, 7, 6, 6, 0, 3, 15, 15, 22, 22, 0, 17, 16, 17, 16, 17, 21, 20, 9, 6,
+    3, 15, 15, 15, 6, 8, 8, 8, 22, 17, 21, 17, 11, 9, 10, 7, 2, 15, 15, 15, 11, 16, 12, 15, 21, 17, 16, 15, 17, 21, 11, 2,
+    4, 22, 7, 11, 21, 21, 10, 10, 15, 20, 8, 10, 16, 20, 9, 6, 5, 22, 8, 21, 21, 21, 18, 21, 16, 20, 20, 16, 21, 22, 8, 5,
+    6, 0, 8, 12, 10, 18, 3, 6, 0, 16, 18, 1, 13, 0, 9, 6, 6, 17, 8, 15, 10, 21, 6, 3, 9, 17, 8, 15, 11, 22, 6, 3,
+    0, 16, 22, 21, 15, 16, 0, 9, 3, 17, 22, 20, 15, 17, 17, 6, 0, 16, 16, 16, 20, 20, 16, 16, 16, 16, 20, 20, 16, 16, 16, 0,
+    5, 16, 21, 16, 8, 20, 18, 8, 22, 20, 21, 22, 21, 16, 21, 5, 6, 17, 17, 15, 10, 16, 1, 15, 20, 20, 22, 4, 21, 21, 22, 1,
+    2, 21, 11, 17, 16, 21, 13, 11, 15, 17, 16, 21, 16, 15, 16, 2, 7, 20, 9, 21, 20, 22, 0, 22, 17, 17, 16, 16, 15, 3, 15, 0,
+    6, 9, 10, 11, 9, 8, 9, 6, 17, 17, 21, 22, 16, 15, 16, 3, 6, 6, 7, 2, 6, 5, 6, 3, 6, 6, 5, 1, 2, 0, 3, 3,
+    4, 0, 4, 15, 0, 1, 7, 6, 5, 7, 22, 7, 0, 6, 7, 11, 2, 15, 16, 15, 5, 5, 0, 0, 20, 17, 20, 17, 23, 19, 18, 7,
+    4, 15, 21, 16, 7, 8, 10, 9, 22, 20, 21, 18, 11, 18, 18, 11, 15, 15, 16, 16, 12, 15, 13, 14, 20, 17, 20, 18, 20, 18, 19, 7,
+    2, 5, 19, 7, 3, 23, 6, 11, 3, 6, 18, 18, 14, 9, 10, 11, 1, 4, 10, 20, 4, 23, 23, 4, 10, 21, 18, 10, 20, 4, 10, 7,
+    7, 2, 18, 20, 12, 4, 19, 13, 18, 21, 18, 18, 20, 20, 18, 11, 7, 8, 10, 14, 7, 5, 6, 3, 18, 6, 18, 3, 20, 5, 19, 2,
+    5, 21, 22, 21, 3, 14, 5, 23, 23, 20, 22, 18, 15, 17, 20, 18, 11, 17, 20, 17, 2, 21, 22, 2, 18, 21, 20, 18, 20, 17, 20, 11,
+    19, 20, 20, 20, 16, 20, 20, 16, 19, 20, 20, 19, 20, 20, 20, 19, 18, 17, 20, 15, 20, 14, 5, 3, 18, 20, 22, 23, 21, 21, 22, 5,
+    0, 15, 19, 20, 14, 16, 13, 13, 15, 17, 20, 20, 16, 16, 16, 16, 7, 19, 18, 23, 0, 5, 0, 5, 17, 17, 20, 20, 15, 15, 16, 2,
+    11, 10, 18, 11, 9, 9, 10, 11, 20, 20, 21, 22, 16, 16, 21, 22, 11, 6, 7, 0, 6, 1, 7, 0, 20, 7, 22, 5, 15, 0, 4, 4,
+    3, 0, 3, 2, 1, 1, 6, 6, 1, 6, 5, 10, 0, 7, 7, 10, 2, 3, 15, 15, 5, 5, 0, 13, 16, 17, 16, 9, 19, 17, 11, 8,
+    3, 15, 15, 15, 6, 8, 8, 8, 22, 17, 21, 10, 19, 19, 11, 10, 15, 15, 15, 12, 12, 17, 8, 12, 21, 16, 18, 12, 19, 17, 18, 8,
+    4, 5, 7, 8, 4, 23, 7, 8, 2, 7, 11, 10, 2, 10, 10, 10, 1, 4, 6, 13, 22, 21, 6, 17, 23, 16, 11, 9, 18, 21, 10, 6,
+    0, 2, 7, 12, 1, 12, 7, 8, 23, 23, 19, 10, 18, 18, 10, 10, 6, 17, 8, 15, 10, 21, 8, 15, 23, 17, 18, 14, 18, 21, 18, 2,
+    5, 21, 22, 21, 2, 14, 7, 8, 4, 21, 18, 10, 20, 20, 18, 11, 0, 16, 16, 13, 4, 17, 7, 13, 21, 21, 18, 10, 20, 20, 18, 7,
+    22, 16, 21, 13, 21, 12, 11, 9, 22, 21, 18, 19, 20, 20, 18, 11, 16, 16, 16, 12, 20, 16, 4, 12, 20, 20, 19, 19, 20, 20, 19, 1,
+    0, 14, 7, 8, 15, 12, 7, 8, 21, 21, 18, 18, 16, 16, 20, 11, 1, 16, 7, 13, 0, 22, 0, 17, 17, 17, 20, 10, 16, 3, 16, 0,
+    7, 10, 10, 13, 9, 9, 10, 13, 20, 20, 21, 23, 16, 16, 21, 23, 7, 6, 7, 15, 6, 5, 1, 3, 20, 7, 22, 4, 15, 0, 22, 1,
+    3, 1, 1, 0, 3, 22, 6, 7, 2, 6, 1, 7, 15, 6, 6, 8, 5, 22, 2, 2, 21, 22, 1, 1, 17, 20, 14, 12, 17, 20, 13, 6,
+    5, 2, 4, 14, 12, 6, 7, 8, 4, 7, 23, 10, 12, 12, 9, 8, 0, 3, 3, 14, 9, 17, 14, 3, 8, 15, 17, 3, 12, 8, 9, 6,
+    3, 21, 6, 10, 16, 21, 9, 10, 15, 17, 8, 13, 16, 13, 13, 8, 21, 21, 18, 21, 21, 21, 18, 23, 17, 20, 17, 13, 17, 13, 12, 6,
+    6, 5, 18, 3, 13, 17, 12, 18, 12, 15, 17, 17, 12, 12, 13, 8, 6, 10, 6, 2, 9, 23, 7, 4, 12, 7, 17, 2, 12, 4, 12, 5,
+    2, 16, 4, 23, 15, 16, 2, 14, 14, 17, 22, 20, 15, 13, 17, 13, 8, 20, 5, 16, 17, 20, 15, 5, 13, 16, 17, 20, 17, 13, 17, 8,
+    1, 13, 23, 21, 12, 17, 15, 15, 13, 16, 21, 21, 17, 17, 17, 17, 6, 12, 1, 2, 13, 14, 1, 2, 20, 20, 22, 22, 17, 17, 21, 5,
+    12, 16, 20, 16, 16, 16, 16, 20, 12, 16, 16, 16, 16, 12, 16, 12, 13, 20, 17, 23, 17, 22, 2, 4, 13, 17, 16, 16, 15, 14, 15, 2,
+    8, 9, 10, 10, 13, 8, 9, 8, 17, 17, 21, 21, 16, 15, 16, 15, 8, 7, 7, 0, 6, 1, 6, 1, 17, 6, 22, 1, 15, 2, 3, 3,
+    4, 1, 0, 0, 4, 5, 7, 7, 0, 7, 1, 6, 2, 9, 6, 9, 5, 4, 2, 2, 22, 22, 1, 18, 21, 20, 12, 20, 21, 10, 8, 11,
+    3, 2, 3, 14, 6, 11, 6, 11, 5, 6, 5, 8, 8, 9, 8, 8, 0, 3, 15, 16, 7, 18, 7, 20, 14, 21, 12, 15, 8, 10, 8, 7,
+    4, 22, 7, 11, 21, 21, 10, 10, 15, 20, 12, 12, 16, 9, 8, 9, 22, 22, 19, 20, 21, 18, 10, 18, 16, 21, 12, 20, 13, 19, 13, 11,
+    1, 5, 0, 19, 6, 18, 6, 10, 14, 14, 12, 12, 12, 9, 8, 8, 7, 20, 9, 16, 10, 21, 10, 21, 14, 20, 12, 15, 13, 23, 12, 5,
+    2, 16, 5, 23, 15, 16, 6, 11, 3, 16, 17, 17, 13, 9, 13, 8, 1, 21, 3, 20, 21, 18, 6, 18, 16, 16, 17, 17, 13, 9, 13, 6,
+    1, 23, 22, 19, 6, 11, 6, 11, 16, 16, 21, 21, 13, 13, 17, 8, 0, 17, 1, 15, 6, 18, 1, 16, 16, 16, 21, 4, 17, 9, 17, 1,
+    15, 21, 16, 19, 16, 18, 8, 10, 15, 16, 17, 17, 13, 12, 13, 8, 20, 20, 16, 20, 20, 19, 3, 19, 16, 16, 16, 16, 12, 12, 12, 0,
+    6, 9, 10, 10, 9, 18, 9, 18, 17, 17, 21, 21, 16, 14, 16, 14, 6, 7, 7, 2, 6, 22, 0, 4, 17, 6, 22, 1, 15, 3, 15, 0,
+    0, 0, 1, 0, 0, 1, 0, 6, 0, 6, 1, 7, 0, 6, 9, 9, 3, 3, 2, 2, 5, 5, 0, 0, 3, 0, 19, 11, 12, 8, 9, 9,
+    4, 2, 4, 14, 7, 0, 1, 1, 5, 5, 19, 19, 12, 8, 10, 10, 2, 14, 3, 15, 2, 0, 1, 14, 4, 5, 19, 18, 12, 8, 10, 11,
+    3, 5, 6, 1, 3, 23, 0, 0, 2, 2, 18, 10, 12, 12, 9, 9, 5, 23, 5, 1, 4, 22, 0, 23, 3, 2, 18, 10, 12, 13, 9, 8,
+    0, 3, 5, 5, 2, 2, 0, 0, 3, 3, 18, 18, 12, 12, 9, 9, 0, 9, 5, 14, 2, 23, 0, 3, 3, 3, 18, 18, 12, 12, 9, 6,
+    3, 14, 5, 5, 2, 2, 3, 0, 3, 16, 20, 18, 17, 13, 17, 9, 0, 3, 4, 5, 3, 2, 3, 0, 16, 16, 20, 18, 17, 13, 17, 9,
+    5, 4, 22, 5, 3, 3, 4, 5, 21, 21, 20, 18, 17, 17, 20, 18, 1, 4, 4, 15, 3, 3, 4, 15, 21, 21, 20, 19, 17, 17, 20, 19,
+    2, 3, 4, 4, 15, 2, 3, 2, 16, 16, 20, 20, 17, 13, 17, 13, 0, 3, 4, 4, 3, 22, 3, 22, 16, 16, 20, 20, 17, 12, 17, 12,
+    0, 3, 4, 4, 3, 3, 3, 3, 16, 16, 20, 20, 16, 16, 16, 16, 6, 6, 7, 0, 6, 1, 6, 0, 17, 17, 21, 22, 16, 15, 16, 3,
+    0, 0, 0, 0, 1, 1, 0, 6, 0, 0, 7, 7, 6, 6, 6, 6, 3, 3, 0, 8, 1, 11, 0, 9, 0, 0, 7, 6, 6, 7, 6, 9,
+    3, 0, 3, 6, 0, 7, 7, 6, 1, 1, 7, 7, 6, 6, 7, 7, 2, 0, 0, 13, 1, 11, 0, 9, 1, 0, 7, 8, 6, 7, 7, 8,
+    4, 1, 1, 6, 4, 7, 6, 7, 0, 0, 7, 7, 6, 6, 6, 6, 5, 1, 0, 8, 1, 18, 1, 10, 0, 1, 7, 6, 6, 10, 6, 10,
+    0, 0, 1, 6, 0, 7, 6, 6, 0, 0, 7, 7, 6, 6, 6, 6, 0, 16, 0, 17, 1, 20, 0, 17, 0, 0, 7, 8, 6, 10, 6, 6,
+    3, 0, 1, 6, 0, 7, 0, 6, 3, 0, 11, 7, 8, 6, 9, 9, 0, 0, 1, 8, 0, 11, 0, 9, 0, 0, 11, 7, 8, 6, 9, 9,
+    5, 0, 1, 6, 0, 7, 1, 6, 21, 1, 18, 11, 13, 6, 10, 10, 1, 0, 1, 13, 0, 11, 7, 9, 21, 1, 18, 10, 13, 6, 18, 7,
+    2, 1, 1, 6, 0, 7, 0, 7, 16, 0, 18, 7, 13, 8, 9, 9, 0, 1, 1, 8, 0, 18, 6, 10, 16, 0, 18, 7, 13, 9, 13, 6,
+    0, 0, 1, 6, 0, 7, 0, 6, 16, 16, 20, 18, 17, 13, 17, 9, 0, 16, 1, 16, 0, 20, 0, 16, 16, 16, 20, 19, 16, 12, 16, 0,
+    1, 12, 20, 16, 12, 1, 20, 19, 20, 20, 19, 20, 20, 19, 20, 19, 8, 12, 10, 13, 8, 7, 1, 1, 19, 5, 23, 22, 1, 5, 5, 5,
+    10, 13, 20, 17, 6, 1, 22, 5, 19, 21, 23, 21, 22, 5, 22, 23, 9, 13, 10, 13, 6, 1, 1, 1, 19, 5, 23, 22, 1, 5, 5, 5,
+    8, 8, 11, 1, 8, 7, 5, 1, 10, 1, 23, 5, 13, 1, 22, 5, 7, 8, 7, 6, 8, 7, 1, 1, 7, 1, 1, 1, 6, 1, 1, 1,
+    11, 8, 11, 1, 6, 1, 5, 1, 11, 1, 23, 5, 1, 1, 5, 5, 7, 8, 7, 6, 6, 7, 1, 1, 7, 1, 1, 1, 1, 1, 1, 2,
+    10, 6, 18, 21, 13, 1, 21, 5, 18, 22, 23, 22, 21, 5, 21, 23, 10, 6, 10, 1, 8, 1, 1, 1, 11, 5, 23, 5, 1, 1, 5, 5,
+    10, 6, 18, 21, 6, 1, 22, 5, 19, 22, 23, 22, 22, 5, 22, 23, 10, 6, 10, 1, 6, 1, 1, 1, 19, 5, 23, 23, 1, 5, 23, 4,
+    10, 6, 19, 1, 8, 1, 5, 5, 10, 1, 23, 5, 13, 1, 22, 5, 7, 6, 7, 1, 8, 7, 1, 1, 7, 1, 1, 1, 6, 1, 1, 2,
+    11, 6, 11, 1, 6, 1, 5, 1, 11, 1, 23, 23, 1, 1, 23, 4, 7, 6, 7, 7, 6, 7, 7, 0, 7, 7, 11, 1, 7, 0, 1, 1,
+    2, 14, 4, 15, 2, 1, 7, 7, 23, 11, 19, 18, 7, 11, 11, 11, 0, 12, 12, 12, 19, 19, 2, 12, 20, 16, 16, 16, 20, 20, 20, 0,
+    14, 14, 16, 16, 10, 10, 18, 18, 21, 20, 20, 20, 18, 18, 18, 18, 12, 12, 13, 13, 10, 10, 8, 14, 17, 16, 16, 16, 21, 21, 21, 2,
+    7, 19, 8, 12, 23, 19, 8, 8, 2, 14, 16, 15, 14, 2, 13, 1, 11, 10, 12, 12, 19, 19, 8, 4, 12, 14, 14, 14, 17, 5, 2, 1,
+    8, 9, 13, 12, 10, 10, 8, 8, 13, 14, 16, 15, 2, 1, 3, 0, 9, 9, 12, 12, 10, 10, 8, 3, 12, 14, 14, 14, 2, 4, 14, 2,
+    1, 13, 22, 17, 2, 10, 18, 18, 23, 20, 19, 20, 18, 10, 18, 19, 6, 13, 13, 13, 10, 10, 6, 2, 20, 16, 21, 16, 22, 22, 22, 0,
+    8, 13, 21, 17, 10, 10, 18, 18, 21, 20, 20, 23, 19, 19, 23, 5, 8, 13, 13, 13, 10, 10, 10, 2, 20, 11, 19, 4, 19, 11, 23, 3,
+    7, 9, 9, 12, 10, 18, 6, 6, 14, 14, 17, 16, 14, 14, 15, 2, 11, 9, 8, 12, 10, 11, 6, 4, 13, 12, 13, 14, 14, 3, 2, 1,
+    8, 9, 9, 19, 11, 11, 11, 19, 10, 11, 19, 23, 10, 2, 23, 4, 9, 7, 11, 0, 7, 1, 7, 2, 11, 7, 11, 1, 7, 0, 1, 1,
+    4, 15, 21, 16, 0, 7, 18, 11, 23, 20, 19, 20, 18, 11, 18, 19, 12, 12, 17, 17, 4, 4, 22, 22, 20, 21, 21, 21, 22, 22, 22, 22,
+    20, 16, 20, 16, 19, 19, 19, 19, 20, 20, 20, 20, 19, 19, 19, 19, 13, 13, 17, 17, 22, 4, 22, 16, 20, 21, 21, 21, 22, 22, 21, 15,
+    7, 12, 19, 13, 15, 4, 22, 4, 18, 22, 23, 22, 21, 23, 21, 23, 8, 12, 10, 12, 5, 4, 5, 4, 19, 4, 23, 4, 23, 4, 5, 1,
+    10, 13, 19, 13, 22, 4, 22, 4, 19, 22, 23, 21, 22, 4, 22, 21, 9, 12, 10, 16, 5, 4, 5, 15, 19, 4, 23, 16, 23, 5, 21, 2,
+    19, 21, 20, 21, 20, 23, 18, 23, 21, 21, 21, 21, 20, 19, 18, 23, 10, 17, 20, 17, 23, 4, 22, 4, 18, 21, 21, 21, 23, 4, 22, 1,
+    18, 21, 20, 21, 22, 23, 23, 20, 18, 21, 21, 21, 22, 23, 23, 22, 18, 17, 20, 20, 23, 10, 18, 16, 18, 21, 18, 21, 19, 19, 23, 22,
+    11, 9, 19, 22, 21, 5, 22, 4, 18, 23, 23, 22, 21, 15, 22, 2, 10, 8, 10, 4, 23, 5, 5, 5, 19, 5, 23, 4, 14, 3, 3, 2,
+    10, 9, 19, 18, 22, 11, 18, 18, 19, 19, 19, 23, 22, 19, 23, 23, 10, 11, 11, 11, 11, 7, 11, 0, 11, 11, 19, 23, 7, 0, 23, 5,
+    3, 15, 4, 15, 0, 7, 7, 7, 23, 11, 19, 18, 7, 11, 11, 11, 14, 14, 15, 15, 4, 4, 2, 12, 16, 17, 17, 17, 20, 20, 20, 8,
+    15, 15, 16, 16, 18, 10, 18, 17, 21, 20, 20, 20, 18, 18, 20, 13, 12, 12, 16, 16, 20, 20, 16, 12, 20, 16, 20, 16, 20, 20, 20, 12,
+    1, 12, 12, 12, 4, 22, 12, 12, 3, 16, 16, 13, 14, 0, 17, 8, 6, 13, 12, 12, 23, 22, 15, 12, 17, 15, 16, 13, 4, 23, 17, 6,
+    8, 12, 13, 17, 18, 20, 21, 13, 17, 21, 21, 17, 22, 21, 20, 13, 8, 13, 13, 16, 20, 4, 17, 14, 20, 20, 17, 16, 20, 4, 21, 14,
+    22, 17, 22, 20, 19, 11, 19, 18, 23, 18, 19, 20, 18, 10, 18, 6, 13, 13, 17, 17, 21, 21, 21, 12, 20, 16, 21, 13, 21, 18, 5, 6,
+    21, 17, 21, 20, 18, 18, 20, 17, 21, 20, 20, 21, 18, 18, 21, 21, 13, 17, 20, 16, 18, 10, 20, 15, 18, 18, 20, 21, 18, 18, 21, 3,
+    6, 13, 9, 13, 2, 10, 16, 13, 3, 17, 17, 9, 15, 15, 3, 0, 8, 12, 13, 13, 0, 5, 0, 4, 13, 13, 16, 13, 14, 3, 3, 1,
+    8, 18, 18, 20, 10, 11, 18, 20, 18, 19, 19, 22, 18, 19, 23, 22, 11, 11, 18, 16, 11, 7, 11, 2, 11, 11, 19, 22, 7, 0, 23, 4,
+    2, 2, 5, 7, 2, 1, 11, 7, 4, 7, 19, 11, 15, 7, 18, 11, 1, 23, 2, 14, 19, 23, 2, 2, 8, 12, 17, 13, 12, 8, 15, 7,
+    1, 14, 23, 15, 13, 10, 18, 10, 22, 18, 19, 18, 20, 19, 20, 19, 7, 14, 14, 14, 10, 18, 14, 14, 9, 17, 17, 15, 12, 6, 16, 2,
+    0, 19, 20, 16, 12, 19, 16, 20, 12, 2, 16, 20, 12, 12, 16, 0, 11, 19, 13, 17, 10, 19, 14, 23, 12, 8, 14, 2, 12, 4, 14, 1,
+    6, 10, 20, 13, 9, 11, 16, 22, 13, 6, 21, 22, 13, 14, 16, 0, 11, 10, 13, 14, 9, 11, 12, 3, 8, 6, 13, 2, 12, 4, 14, 1,
+    2, 10, 21, 18, 14, 10, 20, 18, 16, 18, 20, 18, 16, 18, 20, 18, 6, 10, 1, 2, 9, 10, 14, 1, 13, 8, 16, 21, 12, 8, 3, 0,
+    6, 10, 21, 18, 13, 11, 20, 19, 21, 19, 20, 23, 17, 18, 23, 5, 6, 10, 10, 10, 9, 11, 11, 2, 9, 11, 19, 23, 19, 19, 23, 4,
+    12, 10, 17, 21, 12, 10, 16, 21, 13, 8, 16, 16, 13, 14, 15, 2, 9, 10, 12, 8, 9, 10, 2, 4, 12, 12, 13, 14, 14, 3, 14, 2,
+    8, 11, 20, 19, 13, 10, 11, 11, 13, 10, 19, 23, 13, 14, 4, 3, 9, 7, 11, 7, 7, 1, 7, 0, 11, 7, 11, 1, 0, 2, 1, 1,
+    1, 2, 1, 0, 2, 1, 7, 7, 1, 7, 7, 7, 0, 7, 7, 7, 5, 4, 14, 14, 23, 23, 2, 10, 14, 12, 12, 12, 16, 11, 8, 7,
+    2, 14, 4, 14, 11, 10, 11, 10, 23, 10, 19, 10, 19, 10, 11, 7, 0, 15, 14, 14, 19, 18, 13, 14, 16, 13, 17, 15, 10, 19, 16, 0,
+    5, 23, 15, 16, 4, 23, 12, 19, 14, 2, 12, 8, 14, 10, 12, 7, 19, 19, 16, 16, 19, 19, 20, 19, 16, 20, 1, 12, 16, 19, 12, 1,
+    7, 18, 12, 17, 11, 18, 18, 11, 2, 11, 20, 3, 13, 10, 12, 7, 11, 18, 13, 14, 19, 23, 12, 4, 9, 2, 13, 14, 16, 23, 14, 1,
+    2, 11, 23, 19, 2, 10, 10, 10, 4, 11, 19, 11, 14, 10, 10, 7, 7, 11, 2, 13, 18, 18, 10, 10, 12, 18, 20, 12, 17, 11, 3, 7,
+    1, 10, 23, 18, 10, 10, 18, 18, 23, 18, 19, 23, 18, 18, 23, 5, 7, 10, 10, 14, 10, 10, 10, 2, 19, 11, 19, 4, 19, 19, 23, 3,
+    0, 19, 16, 10, 15, 18, 13, 19, 14, 13, 17, 16, 14, 14, 15, 0, 11, 19, 9, 16, 18, 23, 2, 23, 13, 12, 13, 14, 14, 4, 14, 1,
+    7, 10, 11, 19, 10, 10, 11, 11, 10, 10, 19, 23, 14, 14, 4, 3, 11, 7, 11, 0, 7, 1, 7, 2, 11, 7, 11, 1, 0, 2, 1, 1,
+    5, 2, 5, 7, 0, 7, 11, 7, 5, 7, 19, 11, 7, 7, 11, 11, 2, 3, 15, 14, 4, 4, 2, 2, 15, 12, 17, 13, 8, 7, 9, 6,
+    4, 15, 23, 15, 18, 10, 18, 10, 23, 18, 19, 20, 18, 10, 18, 20, 2, 14, 15, 16, 22, 21, 20, 15, 16, 20, 20, 16, 18, 20, 21, 15,
+    0, 4, 21, 15, 3, 5, 17, 18, 15, 0, 20, 18, 15, 12, 17, 6, 1, 22, 14, 16, 5, 22, 22, 5, 8, 5, 21, 9, 15, 4, 14, 1,
+    1, 12, 20, 20, 16, 19, 20, 16, 20, 19, 20, 20, 20, 12, 20, 1, 6, 13, 17, 16, 18, 5, 17, 15, 18, 18, 20, 16, 18, 4, 21, 0,
+    4, 19, 23, 19, 16, 10, 18, 10, 21, 18, 18, 18, 20, 10, 18, 7, 1, 6, 4, 22, 0, 19, 23, 0, 10, 18, 18, 10, 18, 6, 4, 1,
+    22, 18, 23, 20, 20, 19, 18, 20, 21, 18, 18, 21, 20, 18, 23, 22, 7, 10, 18, 20, 18, 10, 18, 16, 18, 18, 18, 21, 19, 19, 23, 4,
+    2, 7, 21, 18, 15, 21, 20, 22, 16, 17, 20, 16, 16, 14, 15, 2, 6, 11, 9, 9, 2, 4, 2, 4, 13, 13, 17, 16, 14, 3, 15, 2,
+    7, 10, 18, 18, 10, 10, 18, 18, 18, 18, 19, 23, 18, 15, 23, 4, 11, 11, 11, 11, 7, 7, 11, 0, 11, 11, 19, 23, 7, 2, 5, 5,
+    1, 2, 1, 0, 0, 1, 7, 7, 1, 7, 7, 7, 7, 7, 7, 8, 3, 3, 14, 14, 4, 4, 2, 9, 14, 12, 12, 12, 8, 10, 12, 8,
+    3, 14, 4, 17, 11, 10, 11, 13, 23, 10, 19, 17, 19, 11, 20, 8, 2, 15, 15, 17, 21, 10, 16, 12, 21, 21, 16, 17, 21, 10, 20, 12,
+    5, 4, 15, 12, 3, 5, 14, 9, 2, 0, 15, 8, 14, 10, 12, 7, 5, 22, 15, 12, 23, 19, 14, 10, 3, 8, 15, 12, 17, 19, 12, 7,
+    0, 15, 16, 17, 22, 11, 16, 13, 22, 22, 21, 17, 22, 10, 20, 6, 0, 16, 16, 16, 20, 19, 16, 12, 20, 20, 16, 16, 20, 19, 20, 0,
+    4, 19, 23, 19, 2, 11, 11, 9, 23, 11, 19, 9, 10, 10, 10, 6, 0, 6, 15, 12, 5, 10, 15, 9, 19, 8, 16, 13, 18, 10, 5, 6,
+    5, 19, 20, 17, 19, 19, 20, 17, 23, 19, 20, 21, 18, 18, 21, 21, 18, 18, 20, 16, 18, 18, 20, 15, 18, 18, 20, 16, 18, 18, 21, 3,
+    2, 6, 15, 12, 3, 11, 15, 9, 15, 17, 17, 9, 15, 14, 15, 7, 7, 8, 15, 12, 2, 23, 2, 10, 13, 13, 17, 9, 14, 4, 3, 1,
+    19, 19, 20, 20, 10, 10, 18, 17, 18, 18, 19, 22, 18, 15, 23, 5, 11, 11, 18, 16, 11, 1, 11, 2, 11, 11, 19, 22, 7, 2, 23, 3,
+    4, 0, 22, 18, 15, 7, 20, 11, 22, 18, 19, 18, 20, 11, 20, 19, 7, 15, 18, 16, 8, 4, 22, 22, 19, 21, 23, 21, 22, 4, 22, 23,
+    23, 20, 21, 20, 21, 19, 22, 19, 18, 18, 18, 18, 21, 23, 22, 19, 18, 16, 18, 21, 23, 5, 23, 22, 19, 22, 23, 21, 22, 4, 22, 0,
+    8, 4, 18, 22, 12, 4, 21, 22, 17, 22, 21, 22, 17, 22, 21, 22, 8, 5, 19, 23, 8, 4, 4, 4, 10, 5, 23, 5, 12, 4, 4, 1,
+    10, 23, 19, 23, 17, 4, 22, 4, 18, 22, 22, 22, 21, 4, 22, 1, 10, 23, 19, 23, 8, 5, 5, 3, 19, 5, 23, 3, 4, 4, 4, 0,
+    18, 18, 18, 18, 16, 19, 20, 19, 20, 19, 20, 19, 20, 19, 20, 19, 10, 21, 18, 21, 9, 4, 22, 4, 19, 22, 23, 22, 22, 16, 21, 21,
+    18, 21, 18, 21, 21, 23, 22, 23, 18, 22, 22, 22, 21, 20, 21, 22, 18, 21, 18, 21, 23, 11, 19, 19, 19, 18, 19, 23, 18, 18, 22, 22,
+    9, 22, 18, 22, 13, 4, 21, 22, 20, 22, 21, 21, 17, 16, 16, 15, 9, 5, 19, 23, 8, 4, 4, 4, 10, 17, 23, 21, 16, 15, 16, 2,
+    18, 23, 19, 19, 17, 10, 22, 19, 18, 18, 18, 22, 20, 16, 21, 22, 10, 11, 11, 7, 11, 7, 11, 0, 18, 11, 19, 23, 18, 0, 22, 4,
+    4, 0, 4, 7, 2, 7, 7, 7, 5, 11, 19, 11, 7, 7, 11, 11, 0, 15, 15, 15, 4, 4, 0, 8, 21, 17, 20, 17, 18, 18, 18, 6,
+    4, 16, 21, 16, 19, 10, 18, 10, 22, 18, 18, 18, 19, 10, 18, 7, 15, 15, 16, 16, 20, 20, 20, 14, 21, 17, 20, 15, 18, 22, 11, 0,
+    0, 4, 7, 8, 3, 4, 12, 7, 15, 2, 17, 20, 14, 2, 9, 6, 1, 5, 8, 15, 22, 22, 4, 4, 14, 22, 21, 14, 16, 5, 9, 1,
+    7, 0, 10, 18, 6, 23, 19, 6, 4, 22, 22, 4, 22, 0, 10, 7, 6, 0, 13, 14, 11, 4, 13, 3, 23, 2, 17, 15, 22, 4, 11, 0,
+    4, 18, 22, 18, 3, 10, 18, 10, 23, 18, 19, 18, 18, 17, 20, 20, 1, 16, 20, 16, 0, 18, 18, 0, 20, 20, 20, 20, 20, 16, 20, 1,
+    22, 20, 21, 20, 18, 18, 18, 18, 22, 18, 18, 22, 20, 20, 21, 22, 20, 10, 18, 18, 18, 10, 18, 3, 18, 18, 19, 23, 18, 18, 22, 4,
+    0, 22, 11, 18, 14, 20, 20, 20, 15, 20, 20, 21, 16, 15, 16, 15, 6, 18, 18, 18, 9, 4, 18, 4, 17, 17, 20, 21, 16, 15, 16, 0,
+    7, 18, 18, 19, 10, 10, 18, 19, 18, 18, 18, 22, 20, 16, 21, 4, 11, 7, 11, 7, 11, 7, 11, 2, 18, 11, 19, 5, 18, 0, 22, 4,
+    4, 0, 22, 18, 0, 7, 18, 11, 23, 18, 19, 18, 18, 11, 18, 19, 2, 15, 20, 16, 4, 4, 22, 22, 20, 21, 21, 19, 23, 23, 19, 11,
+    22, 20, 21, 20, 18, 19, 19, 21, 22, 18, 18, 18, 18, 19, 19, 18, 20, 16, 20, 21, 22, 22, 21, 16, 20, 21, 21, 20, 22, 22, 18, 18,
+    0, 4, 18, 22, 15, 5, 21, 23, 20, 23, 21, 19, 16, 22, 19, 11, 7, 4, 19, 22, 4, 4, 22, 22, 19, 22, 23, 19, 22, 22, 19, 11,
+    18, 22, 19, 21, 21, 23, 22, 21, 18, 22, 22, 18, 21, 22, 19, 18, 11, 23, 21, 16, 23, 23, 21, 16, 19, 23, 21, 20, 22, 22, 18, 18,
+    22, 18, 22, 18, 20, 19, 18, 19, 21, 18, 18, 18, 20, 21, 20, 18, 18, 21, 20, 21, 22, 22, 22, 22, 18, 21, 21, 18, 21, 21, 20, 18,
+    19, 20, 20, 20, 20, 19, 19, 20, 18, 18, 18, 18, 20, 20, 20, 19, 18, 19, 18, 20, 19, 19, 18, 20, 18, 18, 18, 21, 18, 18, 22, 22,
+    18, 22, 18, 22, 16, 22, 21, 22, 20, 21, 21, 20, 21, 16, 20, 20, 11, 23, 19, 23, 22, 22, 22, 22, 21, 21, 21, 20, 16, 16, 20, 20,
+    18, 19, 19, 18, 19, 19, 19, 18, 18, 18, 18, 22, 20, 20, 21, 22, 19, 11, 18, 18, 11, 11, 18, 18, 18, 18, 19, 23, 18, 18, 22, 22,
+    4, 0, 4, 7, 0, 7, 7, 7, 23, 11, 19, 19, 7, 11, 19, 10, 2, 15, 15, 15, 4, 4, 4, 8, 21, 5, 23, 10, 23, 5, 19, 9,
+    22, 16, 21, 21, 19, 4, 22, 17, 22, 18, 22, 18, 23, 23, 19, 18, 15, 16, 21, 17, 22, 4, 21, 13, 22, 22, 21, 20, 22, 22, 18, 9,
+    0, 4, 4, 4, 3, 5, 5, 8, 3, 5, 23, 19, 23, 23, 19, 10, 1, 4, 4, 12, 4, 4, 4, 8, 23, 5, 23, 10, 23, 23, 19, 9,
+    1, 4, 22, 21, 22, 4, 22, 17, 22, 22, 22, 18, 23, 23, 19, 10, 22, 22, 21, 17, 22, 22, 21, 13, 22, 22, 21, 17, 22, 22, 18, 9,
+    22, 18, 22, 18, 19, 5, 23, 23, 23, 22, 23, 19, 21, 21, 18, 18, 21, 4, 22, 22, 22, 4, 22, 9, 22, 22, 23, 19, 21, 21, 18, 10,
+    22, 23, 22, 21, 23, 23, 22, 21, 22, 22, 22, 18, 21, 21, 18, 18, 19, 19, 20, 20, 19, 19, 20, 16, 19, 19, 20, 20, 18, 18, 18, 18,
+    0, 22, 22, 22, 22, 22, 23, 23, 21, 22, 23, 19, 21, 21, 18, 18, 23, 23, 22, 22, 22, 22, 22, 9, 21, 21, 23, 19, 21, 16, 18, 11,
+    19, 23, 22, 21, 19, 19, 22, 21, 18, 18, 18, 18, 20, 20, 21, 23, 19, 19, 20, 20, 19, 11, 20, 16, 18, 18, 19, 22, 18, 18, 22, 22,
+    4, 0, 23, 7, 2, 7, 11, 11, 4, 7, 19, 11, 15, 7, 18, 11, 1, 3, 3, 14, 4, 22, 0, 0, 12, 12, 16, 17, 12, 12, 13, 8,
+    5, 3, 23, 18, 20, 11, 18, 10, 22, 19, 19, 18, 20, 13, 18, 8, 0, 15, 3, 15, 8, 4, 17, 15, 9, 16, 16, 3, 13, 13, 9, 6,
+    14, 4, 16, 20, 14, 4, 17, 20, 15, 2, 17, 17, 15, 12, 13, 8, 6, 23, 17, 4, 13, 22, 15, 23, 12, 15, 16, 17, 12, 12, 13, 6,
+    8, 1, 20, 22, 13, 20, 21, 18, 17, 16, 21, 17, 17, 12, 13, 8, 8, 0, 13, 14, 9, 5, 13, 3, 13, 16, 16, 3, 13, 12, 13, 1,
+    3, 18, 21, 18, 15, 10, 20, 18, 21, 18, 20, 20, 16, 17, 17, 13, 6, 18, 5, 21, 12, 21, 21, 21, 13, 21, 21, 20, 17, 13, 17, 13,
+    21, 18, 21, 18, 17, 18, 20, 18, 21, 20, 20, 21, 20, 17, 21, 21, 6, 18, 18, 18, 18, 18, 19, 19, 20, 18, 19, 23, 20, 20, 22, 22,
+    12, 20, 20, 20, 12, 20, 16, 20, 16, 16, 20, 20, 16, 12, 16, 12, 8, 20, 20, 20, 13, 4, 20, 4, 17, 17, 17, 16, 16, 14, 16, 14,
+    13, 18, 18, 18, 17, 10, 18, 18, 20, 20, 20, 21, 16, 15, 21, 15, 11, 11, 11, 7, 11, 7, 11, 0, 18, 18, 19, 23, 16, 15, 22, 4,
+    1, 0, 1, 7, 2, 1, 7, 7, 1, 7, 7, 7, 0, 7, 7, 8, 5, 3, 2, 14, 4, 5, 0, 10, 15, 14, 15, 12, 12, 9, 8, 7,
+    4, 2, 4, 10, 19, 11, 11, 11, 23, 11, 19, 10, 12, 9, 9, 8, 2, 14, 15, 15, 6, 11, 6, 10, 15, 15, 17, 15, 12, 9, 9, 7,
+    3, 4, 14, 2, 3, 4, 8, 10, 14, 14, 15, 12, 12, 9, 12, 8, 5, 23, 3, 17, 22, 19, 8, 19, 15, 14, 15, 12, 12, 10, 12, 7,
+    0, 5, 3, 3, 8, 10, 8, 10, 15, 15, 16, 17, 12, 9, 13, 8, 1, 2, 13, 14, 8, 19, 8, 4, 15, 15, 16, 3, 12, 10, 9, 7,
+    3, 11, 23, 19, 2, 10, 10, 10, 4, 16, 19, 20, 17, 13, 17, 8, 0, 22, 22, 22, 3, 10, 21, 10, 16, 16, 21, 20, 17, 13, 17, 6,
+    5, 19, 23, 19, 18, 18, 18, 18, 20, 20, 20, 21, 17, 17, 21, 21, 19, 19, 18, 18, 18, 18, 18, 3, 20, 20, 19, 23, 20, 17, 22, 5,
+    2, 21, 21, 21, 15, 10, 21, 10, 16, 16, 16, 17, 17, 12, 17, 12, 0, 20, 20, 20, 16, 19, 20, 19, 16, 16, 16, 20, 16, 12, 16, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 21, 16, 15, 16, 15, 11, 11, 11, 7, 11, 1, 11, 2, 18, 18, 19, 23, 16, 15, 22, 3,
+    5, 0, 5, 7, 0, 7, 11, 7, 5, 7, 19, 19, 7, 7, 19, 10, 2, 3, 3, 23, 5, 5, 5, 23, 4, 5, 23, 19, 4, 8, 19, 10,
+    4, 3, 23, 22, 18, 5, 22, 22, 23, 23, 23, 19, 18, 23, 19, 19, 2, 22, 22, 21, 4, 5, 22, 21, 22, 23, 23, 18, 22, 23, 19, 18,
+    2, 5, 21, 23, 15, 4, 5, 5, 15, 4, 23, 19, 15, 12, 10, 9, 1, 4, 5, 23, 4, 4, 5, 5, 4, 4, 23, 19, 12, 12, 10, 9,
+    1, 4, 22, 22, 4, 4, 22, 22, 22, 22, 23, 19, 22, 13, 19, 10, 23, 23, 21, 21, 4, 4, 22, 16, 22, 22, 23, 18, 22, 13, 19, 11,
+    22, 19, 23, 23, 16, 4, 18, 23, 21, 21, 21, 18, 21, 17, 20, 18, 1, 22, 22, 23, 4, 4, 22, 23, 21, 21, 21, 18, 21, 17, 20, 10,
+    22, 23, 23, 22, 23, 23, 23, 22, 21, 21, 21, 18, 21, 21, 20, 18, 23, 19, 18, 20, 23, 23, 18, 20, 21, 21, 21, 21, 21, 21, 20, 19,
+    15, 22, 22, 22, 16, 4, 22, 22, 21, 21, 21, 20, 17, 13, 20, 13, 22, 22, 22, 22, 22, 22, 22, 22, 21, 21, 21, 20, 17, 13, 17, 13,
+    19, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 16, 20, 20, 19, 19, 18, 18, 19, 11, 18, 18, 20, 20, 19, 23, 20, 16, 21, 22,
+    1, 0, 1, 1, 0, 1, 1, 6, 1, 1, 5, 7, 1, 6, 7, 7, 3, 1, 5, 6, 1, 7, 1, 8, 5, 1, 5, 7, 1, 6, 7, 7,
+    4, 5, 5, 5, 5, 1, 5, 6, 5, 5, 23, 19, 1, 6, 19, 11, 5, 5, 22, 17, 5, 1, 5, 8, 5, 5, 23, 18, 1, 6, 19, 10,
+    3, 1, 5, 1, 1, 7, 1, 6, 5, 1, 5, 7, 6, 8, 7, 7, 5, 1, 5, 6, 1, 7, 1, 8, 5, 1, 5, 7, 6, 8, 7, 7,
+    5, 5, 5, 5, 1, 1, 5, 6, 5, 5, 23, 19, 1, 8, 11, 11, 5, 5, 22, 17, 5, 7, 5, 8, 5, 5, 23, 18, 1, 8, 19, 9,
+    4, 5, 5, 1, 5, 1, 5, 6, 22, 5, 23, 19, 21, 6, 18, 10, 5, 1, 5, 1, 5, 1, 5, 8, 22, 5, 23, 11, 21, 6, 18, 10,
+    23, 5, 22, 22, 5, 5, 22, 22, 22, 22, 23, 19, 21, 21, 18, 18, 23, 23, 21, 21, 23, 5, 21, 17, 22, 22, 23, 18, 21, 21, 18, 18,
+    5, 5, 5, 1, 5, 1, 5, 6, 22, 22, 23, 19, 17, 13, 18, 10, 5, 5, 5, 1, 5, 7, 5, 8, 22, 22, 23, 19, 17, 13, 18, 9,
+    23, 23, 22, 22, 23, 5, 22, 22, 21, 21, 23, 19, 21, 17, 20, 18, 19, 19, 20, 20, 19, 19, 20, 16, 20, 20, 19, 20, 20, 16, 20, 19,
+    0, 12, 16, 16, 4, 19, 0, 0, 19, 16, 20, 16, 12, 0, 1, 0, 8, 12, 13, 13, 10, 19, 6, 6, 11, 17, 18, 16, 6, 0, 1, 0,
+    8, 12, 17, 17, 7, 7, 6, 0, 18, 17, 20, 16, 6, 0, 1, 0, 8, 12, 13, 13, 7, 7, 6, 12, 11, 17, 18, 12, 6, 0, 1, 14,
+    7, 9, 9, 8, 10, 19, 6, 6, 10, 6, 11, 0, 8, 7, 7, 0, 11, 9, 8, 8, 10, 11, 6, 6, 7, 6, 7, 0, 8, 7, 1, 5,
+    8, 8, 9, 8, 7, 7, 6, 6, 11, 6, 11, 0, 6, 0, 7, 1, 8, 8, 8, 8, 7, 7, 8, 14, 7, 8, 7, 12, 6, 8, 8, 3,
+    11, 8, 18, 13, 9, 7, 7, 0, 10, 7, 18, 21, 8, 1, 7, 1, 9, 8, 9, 13, 10, 7, 6, 0, 11, 6, 11, 0, 6, 0, 1, 1,
+    10, 8, 10, 13, 6, 7, 7, 18, 11, 7, 18, 19, 6, 19, 19, 23, 9, 8, 9, 9, 7, 9, 10, 12, 11, 10, 10, 10, 10, 10, 19, 4,
+    6, 6, 10, 6, 9, 11, 7, 0, 10, 7, 11, 1, 8, 14, 15, 2, 6, 6, 6, 6, 10, 7, 6, 5, 7, 6, 7, 0, 6, 3, 2, 3,
+    10, 6, 10, 6, 6, 7, 11, 11, 11, 11, 19, 19, 6, 11, 23, 4, 6, 6, 10, 6, 7, 6, 7, 6, 11, 7, 11, 7, 7, 7, 7, 1,
+    2, 14, 15, 15, 4, 23, 0, 0, 5, 16, 22, 17, 0, 6, 7, 6, 0, 12, 12, 12, 19, 19, 3, 16, 16, 16, 16, 16, 16, 16, 12, 16,
+    14, 14, 15, 15, 10, 18, 8, 8, 21, 16, 21, 17, 10, 9, 9, 0, 12, 12, 12, 12, 10, 13, 12, 15, 17, 13, 17, 12, 8, 17, 13, 15,
+    7, 19, 12, 13, 23, 19, 9, 9, 2, 12, 13, 14, 15, 4, 0, 7, 11, 10, 13, 13, 19, 19, 9, 21, 12, 17, 12, 17, 13, 21, 13, 22,
+    8, 9, 8, 12, 10, 10, 8, 8, 13, 8, 9, 9, 6, 8, 9, 0, 9, 9, 8, 12, 9, 17, 8, 15, 8, 13, 13, 12, 9, 17, 8, 15,
+    6, 13, 17, 17, 11, 19, 8, 8, 22, 17, 21, 16, 3, 11, 4, 1, 6, 9, 13, 13, 11, 10, 8, 16, 20, 17, 17, 17, 12, 17, 4, 0,
+    8, 13, 17, 13, 10, 10, 10, 18, 21, 10, 19, 19, 11, 10, 19, 23, 8, 9, 9, 12, 9, 13, 9, 14, 10, 9, 10, 12, 10, 9, 10, 3,
+    7, 10, 9, 12, 10, 18, 6, 10, 2, 13, 17, 17, 14, 14, 15, 2, 11, 9, 8, 17, 10, 21, 1, 21, 13, 20, 12, 17, 2, 4, 2, 5,
+    8, 9, 10, 10, 10, 10, 10, 10, 10, 11, 19, 19, 10, 11, 23, 4, 9, 8, 9, 8, 6, 6, 6, 2, 11, 6, 11, 6, 7, 6, 7, 0,
+    2, 14, 16, 16, 1, 1, 0, 6, 22, 16, 21, 17, 0, 6, 7, 6, 12, 12, 13, 13, 4, 22, 2, 2, 20, 17, 20, 16, 4, 3, 3, 6,
+    12, 12, 16, 16, 1, 12, 20, 16, 20, 16, 20, 20, 19, 20, 20, 20, 12, 12, 13, 13, 8, 12, 13, 13, 20, 17, 17, 17, 9, 13, 17, 16,
+    6, 12, 9, 13, 4, 22, 0, 2, 11, 13, 18, 16, 14, 1, 4, 7, 8, 13, 9, 12, 23, 22, 2, 22, 10, 12, 10, 14, 0, 23, 2, 1,
+    8, 12, 9, 13, 7, 8, 20, 17, 10, 10, 20, 20, 11, 10, 20, 21, 8, 8, 13, 13, 8, 8, 13, 12, 9, 9, 13, 13, 9, 8, 13, 14,
+    11, 13, 20, 17, 2, 2, 5, 4, 19, 20, 20, 21, 15, 5, 5, 7, 9, 13, 13, 13, 1, 0, 1, 2, 18, 17, 20, 16, 1, 1, 4, 1,
+    10, 13, 20, 20, 11, 10, 18, 20, 18, 18, 18, 20, 19, 18, 18, 21, 9, 9, 10, 13, 10, 9, 10, 13, 10, 10, 18, 20, 10, 10, 18, 21,
+    11, 9, 10, 13, 14, 1, 5, 5, 10, 10, 18, 21, 14, 14, 15, 2, 9, 8, 9, 12, 1, 23, 0, 5, 10, 6, 10, 2, 14, 3, 2, 2,
+    10, 10, 18, 18, 11, 10, 18, 18, 10, 10, 18, 18, 10, 11, 19, 23, 10, 9, 10, 9, 10, 8, 10, 8, 10, 10, 10, 10, 11, 7, 11, 1,
+    2, 14, 15, 15, 1, 1, 0, 14, 5, 16, 22, 14, 0, 6, 7, 12, 14, 14, 14, 14, 4, 15, 14, 13, 16, 15, 16, 14, 2, 16, 15, 13,
+    14, 14, 15, 15, 2, 14, 15, 15, 21, 16, 16, 16, 3, 15, 16, 17, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 16, 16, 12, 12, 16, 12,
+    1, 12, 12, 14, 4, 22, 3, 12, 2, 2, 15, 14, 2, 14, 15, 12, 6, 15, 12, 15, 23, 16, 14, 17, 14, 15, 14, 14, 14, 16, 14, 13,
+    8, 12, 15, 15, 2, 14, 15, 15, 2, 14, 16, 16, 2, 14, 16, 17, 12, 12, 12, 12, 12, 13, 12, 15, 12, 12, 13, 13, 12, 13, 13, 14,
+    1, 13, 21, 17, 2, 2, 3, 14, 22, 3, 21, 14, 3, 3, 15, 12, 8, 13, 13, 14, 2, 15, 14, 13, 2, 15, 15, 14, 2, 15, 15, 13,
+    13, 13, 20, 16, 11, 14, 20, 16, 21, 18, 20, 20, 19, 18, 20, 21, 9, 12, 13, 13, 9, 12, 13, 13, 9, 12, 20, 17, 9, 12, 20, 16,
+    6, 2, 3, 14, 2, 2, 3, 14, 2, 2, 3, 14, 2, 2, 3, 6, 8, 15, 14, 15, 14, 16, 14, 17, 2, 15, 14, 14, 2, 21, 2, 1,
+    8, 10, 20, 16, 11, 10, 20, 16, 11, 10, 18, 20, 10, 10, 18, 21, 9, 9, 9, 13, 9, 8, 9, 12, 10, 9, 10, 13, 10, 6, 10, 2,
+    1, 3, 3, 2, 4, 23, 0, 0, 4, 0, 5, 6, 2, 1, 1, 6, 1, 23, 14, 15, 19, 23, 3, 3, 8, 14, 15, 12, 13, 10, 6, 1,
+    0, 14, 3, 15, 10, 18, 6, 8, 5, 15, 22, 17, 12, 7, 10, 1, 7, 14, 14, 12, 10, 18, 9, 14, 8, 8, 13, 12, 8, 12, 13, 14,
+    1, 19, 12, 16, 19, 19, 20, 19, 12, 4, 20, 1, 12, 16, 12, 0, 11, 19, 13, 17, 19, 19, 20, 22, 9, 10, 8, 20, 13, 22, 15, 5,
+    7, 10, 12, 9, 10, 18, 10, 9, 8, 7, 10, 10, 8, 15, 10, 0, 11, 9, 9, 12, 10, 9, 8, 14, 8, 8, 9, 12, 8, 5, 8, 4,
+    0, 11, 5, 22, 12, 18, 4, 11, 3, 9, 22, 19, 14, 8, 3, 0, 7, 11, 0, 6, 10, 18, 7, 4, 8, 10, 7, 7, 9, 6, 3, 0,
+    6, 10, 23, 18, 9, 11, 10, 18, 9, 11, 19, 19, 18, 18, 23, 23, 7, 9, 10, 9, 10, 9, 10, 12, 10, 10, 10, 10, 10, 10, 19, 4,
+    6, 10, 18, 10, 9, 18, 10, 22, 12, 13, 17, 17, 12, 15, 15, 2, 10, 10, 10, 18, 10, 23, 0, 5, 9, 12, 13, 12, 14, 3, 14, 3,
+    6, 10, 10, 10, 9, 10, 11, 11, 10, 10, 19, 19, 10, 14, 23, 3, 10, 6, 10, 6, 7, 6, 7, 0, 11, 7, 11, 7, 7, 0, 1, 1,
+    5, 3, 2, 2, 4, 5, 0, 0, 1, 0, 1, 6, 2, 1, 7, 11, 5, 4, 15, 15, 23, 23, 3, 20, 14, 16, 14, 16, 15, 20, 15, 18,
+    2, 15, 3, 14, 19, 18, 8, 18, 4, 14, 4, 12, 6, 19, 8, 7, 0, 13, 14, 13, 19, 17, 12, 16, 12, 13, 12, 12, 12, 17, 12, 15,
+    5, 23, 15, 16, 23, 23, 21, 18, 3, 4, 2, 21, 15, 18, 13, 11, 19, 19, 16, 16, 19, 20, 16, 20, 12, 20, 12, 16, 16, 19, 16, 19,
+    7, 18, 8, 8, 11, 19, 8, 18, 6, 6, 8, 8, 6, 18, 8, 7, 11, 13, 12, 13, 9, 21, 9, 16, 8, 13, 12, 12, 9, 22, 8, 4,
+    0, 11, 4, 22, 3, 19, 1, 18, 3, 22, 23, 21, 2, 10, 3, 7, 7, 11, 14, 16, 19, 20, 14, 20, 14, 16, 14, 16, 14, 20, 3, 11,
+    1, 11, 10, 10, 11, 11, 10, 10, 11, 11, 19, 19, 11, 11, 19, 5, 9, 13, 9, 12, 9, 13, 9, 14, 9, 9, 10, 12, 10, 13, 10, 3,
+    7, 19, 11, 21, 18, 18, 10, 18, 14, 13, 17, 17, 14, 15, 15, 0, 11, 20, 12, 17, 18, 21, 1, 21, 13, 20, 13, 20, 14, 23, 2, 5,
+    7, 11, 10, 10, 10, 10, 10, 10, 10, 10, 19, 19, 10, 14, 23, 3, 9, 8, 9, 12, 6, 6, 6, 2, 11, 6, 11, 6, 7, 1, 7, 2,
+    2, 2, 3, 2, 1, 1, 0, 0, 5, 0, 5, 6, 0, 6, 1, 7, 2, 3, 2, 14, 4, 4, 2, 2, 15, 2, 3, 3, 0, 2, 3, 6,
+    2, 14, 3, 15, 1, 2, 21, 16, 4, 4, 21, 21, 5, 4, 21, 20, 2, 14, 13, 13, 8, 12, 13, 13, 8, 12, 17, 17, 8, 12, 17, 16,
+    1, 4, 14, 3, 4, 22, 4, 3, 2, 1, 4, 4, 2, 13, 4, 6, 1, 22, 2, 2, 5, 23, 2, 22, 0, 0, 2, 2, 0, 22, 2, 1,
+    0, 0, 20, 16, 1, 0, 20, 16, 1, 1, 20, 20, 1, 1, 20, 20, 8, 8, 13, 13, 8, 9, 13, 12, 8, 8, 13, 13, 8, 8, 13, 14,
+    1, 6, 4, 4, 2, 1, 5, 4, 4, 5, 23, 4, 3, 5, 5, 7, 0, 0, 1, 2, 1, 0, 1, 2, 1, 1, 5, 4, 1, 1, 5, 7,
+    1, 11, 18, 20, 11, 11, 18, 20, 19, 19, 18, 20, 19, 19, 18, 21, 10, 9, 10, 13, 10, 9, 10, 13, 10, 10, 18, 20, 10, 10, 18, 21,
+    0, 1, 5, 5, 2, 1, 5, 5, 2, 1, 5, 5, 14, 14, 15, 2, 7, 0, 1, 0, 1, 23, 1, 23, 1, 1, 1, 1, 14, 3, 14, 2,
+    11, 11, 18, 18, 11, 11, 18, 18, 10, 10, 18, 18, 10, 10, 19, 23, 10, 9, 10, 9, 10, 8, 10, 8, 10, 10, 10, 10, 11, 7, 11, 1,
+    2, 2, 2, 2, 1, 1, 2, 12, 1, 2, 1, 14, 0, 2, 2, 9, 3, 3, 2, 14, 3, 16, 2, 13, 2, 15, 15, 14, 3, 16, 2, 13,
+    2, 2, 15, 15, 2, 2, 15, 14, 3, 3, 15, 15, 3, 2, 15, 12, 14, 14, 14, 14, 14, 15, 14, 13, 14, 14, 15, 15, 14, 15, 15, 12,
+    5, 3, 3, 14, 4, 3, 2, 12, 2, 2, 3, 14, 2, 11, 2, 10, 5, 15, 14, 15, 3, 20, 3, 17, 2, 15, 14, 14, 3, 18, 2, 10,
+    2, 2, 15, 15, 2, 3, 15, 14, 2, 2, 15, 15, 2, 2, 15, 12, 12, 12, 12, 12, 12, 16, 12, 16, 12, 12, 12, 12, 12, 16, 12, 12,
+    1, 2, 3, 14, 2, 2, 3, 12, 4, 2, 3, 14, 3, 2, 3, 9, 2, 15, 2, 14, 2, 16, 2, 13, 2, 15, 3, 14, 2, 16, 15, 13,
+    1, 2, 16, 15, 2, 2, 16, 15, 19, 3, 20, 16, 19, 3, 20, 17, 12, 14, 13, 13, 12, 14, 13, 13, 9, 14, 17, 17, 9, 14, 20, 15,
+    0, 3, 3, 14, 2, 3, 3, 12, 2, 2, 3, 14, 2, 10, 3, 10, 2, 15, 2, 15, 2, 20, 14, 17, 2, 15, 2, 14, 2, 18, 2, 10,
+    11, 2, 20, 15, 11, 2, 20, 15, 11, 11, 18, 20, 10, 10, 18, 21, 9, 12, 13, 13, 9, 13, 9, 14, 10, 9, 10, 13, 10, 6, 10, 2,
+    5, 2, 22, 15, 3, 1, 1, 6, 4, 1, 22, 20, 2, 7, 1, 7, 0, 15, 16, 16, 5, 23, 2, 2, 18, 16, 20, 17, 9, 5, 10, 7,
+    5, 15, 21, 16, 8, 8, 11, 10, 23, 21, 21, 20, 13, 11, 11, 1, 7, 15, 20, 16, 8, 8, 9, 12, 18, 9, 20, 12, 9, 9, 13, 14,
+    6, 5, 11, 18, 14, 22, 10, 5, 9, 3, 18, 23, 12, 2, 9, 6, 6, 5, 10, 18, 9, 23, 7, 22, 9, 18, 19, 20, 8, 4, 9, 1,
+    7, 0, 10, 10, 8, 7, 11, 10, 10, 11, 19, 10, 9, 11, 11, 1, 7, 8, 9, 12, 8, 8, 9, 14, 10, 8, 9, 12, 9, 8, 9, 3,
+    1, 20, 19, 20, 12, 20, 4, 19, 19, 20, 19, 20, 12, 20, 20, 20, 7, 17, 18, 20, 8, 19, 19, 19, 10, 20, 18, 20, 20, 20, 21, 21,
+    19, 20, 18, 18, 9, 19, 19, 18, 19, 18, 18, 19, 18, 20, 21, 22, 11, 10, 10, 9, 10, 9, 10, 9, 18, 10, 19, 19, 18, 18, 23, 23,
+    6, 18, 18, 18, 12, 18, 18, 18, 9, 20, 20, 20, 16, 16, 16, 15, 6, 18, 10, 18, 9, 5, 18, 5, 10, 17, 20, 20, 16, 15, 16, 2,
+    10, 10, 18, 18, 10, 10, 10, 11, 18, 18, 18, 19, 20, 20, 21, 22, 10, 6, 10, 6, 11, 6, 11, 6, 11, 7, 19, 7, 11, 7, 23, 5,
+    3, 2, 3, 15, 4, 1, 0, 6, 5, 0, 5, 6, 0, 6, 7, 7, 0, 3, 15, 15, 5, 4, 2, 17, 21, 16, 16, 16, 14, 16, 10, 6,
+    3, 15, 15, 15, 7, 6, 7, 8, 22, 16, 21, 17, 7, 7, 10, 7, 2, 15, 15, 12, 8, 13, 12, 15, 8, 13, 13, 12, 8, 13, 13, 15,
+    1, 5, 6, 0, 4, 22, 1, 10, 2, 4, 1, 1, 3, 0, 9, 6, 1, 5, 12, 17, 23, 21, 12, 21, 12, 17, 12, 17, 12, 21, 9, 5,
+    6, 6, 7, 8, 7, 6, 7, 8, 7, 7, 11, 10, 7, 7, 11, 1, 8, 13, 8, 12, 8, 17, 8, 15, 8, 13, 9, 12, 8, 17, 13, 15,
+    1, 16, 22, 21, 2, 23, 23, 23, 4, 21, 22, 21, 21, 21, 20, 20, 0, 16, 16, 16, 1, 16, 19, 16, 20, 20, 20, 20, 20, 20, 20, 1,
+    5, 11, 21, 18, 11, 11, 19, 18, 18, 18, 18, 19, 18, 18, 21, 22, 10, 9, 10, 12, 10, 9, 10, 14, 10, 10, 19, 19, 18, 10, 23, 4,
+    0, 19, 19, 19, 2, 18, 18, 18, 20, 20, 20, 20, 16, 16, 16, 15, 7, 17, 19, 17, 10, 21, 18, 21, 20, 20, 20, 20, 16, 3, 16, 0,
+    11, 11, 11, 10, 10, 10, 10, 18, 18, 18, 18, 19, 20, 20, 21, 22, 10, 8, 10, 8, 10, 6, 10, 2, 11, 7, 11, 7, 11, 7, 23, 1,
+    4, 2, 4, 15, 0, 1, 1, 22, 5, 1, 22, 23, 0, 23, 23, 19, 2, 15, 16, 15, 4, 4, 4, 22, 20, 4, 23, 23, 5, 4, 23, 19,
+    4, 15, 21, 21, 5, 4, 22, 21, 22, 22, 22, 21, 23, 22, 22, 20, 15, 15, 21, 17, 5, 12, 21, 17, 20, 22, 21, 21, 23, 22, 21, 20,
+    0, 4, 19, 22, 3, 5, 4, 22, 3, 5, 23, 23, 22, 22, 19, 19, 7, 5, 4, 4, 5, 5, 4, 4, 5, 5, 23, 23, 5, 5, 23, 11,
+    7, 5, 22, 21, 5, 5, 22, 21, 23, 23, 22, 21, 23, 23, 22, 20, 7, 8, 17, 13, 8, 8, 17, 13, 23, 9, 21, 17, 23, 9, 21, 16,
+    23, 21, 22, 22, 3, 23, 23, 22, 23, 22, 22, 23, 22, 21, 20, 18, 11, 5, 20, 22, 5, 5, 23, 22, 22, 22, 22, 23, 22, 22, 20, 18,
+    19, 19, 19, 20, 19, 19, 19, 20, 19, 19, 19, 20, 19, 19, 19, 19, 19, 10, 18, 20, 19, 10, 18, 17, 19, 19, 18, 20, 19, 19, 18, 21,
+    7, 23, 23, 23, 23, 23, 23, 23, 21, 21, 21, 21, 21, 21, 20, 20, 11, 5, 23, 23, 23, 23, 23, 23, 21, 21, 21, 21, 21, 16, 20, 20,
+    19, 19, 19, 18, 19, 19, 19, 18, 18, 18, 18, 18, 18, 18, 21, 22, 10, 9, 18, 9, 10, 9, 10, 9, 18, 10, 18, 18, 18, 11, 19, 23,
+    3, 2, 3, 3, 1, 3, 4, 14, 5, 4, 4, 4, 4, 4, 23, 10, 2, 3, 3, 14, 3, 15, 3, 12, 4, 3, 4, 14, 4, 3, 4, 9,
+    3, 3, 4, 15, 4, 3, 4, 15, 4, 4, 22, 21, 4, 4, 22, 20, 3, 14, 15, 15, 3, 14, 15, 15, 3, 14, 21, 16, 3, 14, 21, 17,
+    1, 3, 4, 3, 4, 3, 4, 14, 4, 4, 4, 4, 4, 4, 23, 10, 3, 15, 3, 14, 3, 15, 3, 12, 3, 3, 4, 14, 4, 15, 4, 9,
+    4, 3, 4, 15, 4, 3, 4, 15, 4, 4, 22, 21, 4, 4, 22, 20, 14, 12, 15, 15, 14, 12, 15, 15, 3, 12, 16, 16, 3, 12, 21, 13,
+    5, 4, 4, 3, 4, 3, 4, 3, 22, 4, 23, 23, 22, 22, 19, 19, 4, 3, 4, 14, 4, 3, 4, 12, 4, 4, 23, 23, 22, 4, 19, 10,
+    23, 4, 22, 21, 23, 4, 22, 16, 23, 23, 22, 21, 23, 23, 22, 20, 19, 12, 20, 16, 19, 12, 20, 16, 19, 19, 20, 20, 19, 19, 20, 20,
+    4, 4, 4, 3, 4, 4, 4, 3, 22, 22, 23, 23, 21, 21, 18, 18, 4, 3, 4, 14, 4, 15, 4, 12, 22, 4, 23, 23, 21, 21, 18, 10,
+    23, 23, 22, 21, 23, 23, 22, 21, 19, 19, 22, 21, 18, 18, 21, 18, 10, 9, 20, 17, 10, 9, 20, 13, 19, 10, 18, 20, 18, 10, 18, 21,
+    0, 0, 4, 0, 3, 5, 1, 6, 4, 1, 5, 7, 2, 12, 13, 8, 1, 4, 3, 14, 4, 22, 0, 4, 8, 15, 16, 16, 12, 12, 13, 8,
+    5, 3, 4, 15, 12, 7, 11, 11, 4, 4, 22, 18, 12, 12, 13, 8, 0, 8, 9, 12, 8, 8, 9, 12, 8, 8, 9, 12, 8, 8, 9, 0,
+    0, 4, 22, 4, 3, 22, 4, 18, 14, 15, 16, 16, 14, 13, 13, 8, 1, 23, 5, 20, 22, 22, 4, 22, 12, 15, 16, 16, 12, 13, 13, 6,
+    6, 7, 11, 11, 8, 7, 11, 11, 8, 7, 11, 11, 12, 12, 13, 8, 6, 9, 9, 12, 8, 9, 9, 14, 8, 8, 9, 12, 8, 4, 9, 4,
+    0, 22, 22, 22, 14, 22, 22, 22, 3, 21, 21, 21, 17, 17, 17, 13, 6, 23, 23, 23, 8, 22, 22, 22, 21, 21, 21, 21, 17, 17, 17, 13,
+    1, 19, 19, 19, 19, 19, 19, 19, 18, 18, 18, 18, 20, 20, 21, 21, 10, 10, 10, 9, 10, 10, 10, 9, 18, 18, 19, 19, 18, 18, 22, 22,
+    0, 18, 18, 18, 12, 20, 20, 20, 12, 16, 20, 20, 16, 12, 16, 12, 6, 18, 18, 18, 9, 22, 18, 4, 17, 17, 20, 17, 16, 14, 16, 14,
+    6, 10, 18, 18, 10, 10, 18, 10, 18, 18, 18, 18, 16, 15, 21, 15, 10, 6, 10, 6, 11, 6, 11, 6, 11, 7, 19, 7, 11, 0, 22, 4,
+    0, 0, 0, 0, 4, 1, 0, 11, 1, 0, 1, 6, 0, 9, 8, 9, 5, 3, 2, 16, 4, 18, 7, 18, 15, 21, 14, 16, 8, 10, 8, 11,
+    3, 2, 3, 14, 7, 19, 6, 11, 4, 0, 4, 8, 12, 9, 8, 8, 2, 13, 12, 13, 12, 17, 12, 16, 8, 13, 12, 12, 8, 18, 8, 7,
+    4, 4, 4, 22, 4, 19, 6, 11, 3, 14, 15, 14, 12, 9, 12, 9, 5, 21, 14, 16, 22, 18, 7, 18, 15, 21, 15, 21, 12, 19, 8, 11,
+    1, 6, 7, 6, 7, 19, 7, 19, 7, 7, 7, 7, 12, 9, 12, 8, 8, 13, 8, 13, 8, 21, 12, 16, 8, 13, 8, 12, 8, 22, 8, 4,
+    0, 22, 4, 22, 3, 11, 22, 11, 4, 16, 21, 21, 17, 13, 17, 8, 1, 16, 23, 16, 4, 18, 22, 18, 21, 21, 21, 21, 17, 9, 17, 6,
+    5, 11, 19, 19, 19, 19, 19, 19, 18, 18, 18, 18, 20, 17, 21, 21, 10, 9, 10, 12, 10, 13, 10, 14, 18, 10, 19, 19, 18, 18, 22, 4,
+    0, 22, 22, 22, 3, 18, 21, 10, 16, 16, 21, 16, 17, 12, 17, 12, 1, 20, 19, 16, 18, 18, 18, 18, 16, 16, 20, 20, 16, 12, 16, 0,
+    11, 11, 19, 11, 10, 10, 18, 18, 18, 18, 18, 18, 16, 15, 21, 15, 10, 8, 10, 8, 10, 6, 10, 2, 11, 7, 19, 7, 11, 0, 22, 4,
+    4, 0, 4, 0, 0, 1, 5, 5, 5, 5, 23, 23, 0, 5, 19, 10, 2, 3, 4, 4, 4, 4, 4, 4, 4, 5, 23, 23, 4, 5, 19, 10,
+    4, 4, 22, 22, 5, 4, 22, 22, 4, 4, 22, 22, 4, 5, 23, 19, 2, 4, 21, 17, 5, 4, 21, 17, 5, 4, 22, 21, 4, 4, 22, 18,
+    0, 4, 4, 4, 3, 4, 5, 5, 4, 4, 23, 23, 4, 12, 19, 9, 1, 5, 4, 4, 4, 4, 4, 4, 4, 4, 23, 23, 4, 12, 19, 9,
+    5, 5, 22, 22, 5, 5, 22, 22, 4, 4, 22, 22, 4, 4, 23, 19, 5, 8, 21, 13, 5, 8, 21, 13, 5, 5, 22, 21, 4, 4, 22, 18,
+    4, 4, 22, 22, 4, 4, 4, 5, 22, 22, 22, 23, 21, 21, 20, 18, 5, 5, 5, 4, 4, 4, 4, 22, 22, 22, 22, 23, 21, 21, 20, 18,
+    23, 23, 23, 22, 23, 23, 23, 22, 22, 22, 22, 22, 22, 22, 20, 18, 19, 19, 18, 20, 19, 19, 18, 20, 23, 23, 18, 20, 22, 22, 18, 22,
+    0, 4, 22, 22, 4, 4, 22, 4, 21, 21, 21, 21, 17, 13, 20, 13, 5, 5, 23, 5, 4, 4, 22, 22, 21, 21, 21, 21, 17, 13, 20, 13,
+    19, 19, 19, 19, 19, 19, 19, 19, 18, 18, 18, 18, 20, 20, 20, 20, 10, 9, 18, 9, 10, 9, 18, 9, 18, 18, 18, 18, 18, 18, 22, 22,
+    0, 0, 4, 0, 1, 0, 1, 0, 5, 1, 5, 1, 1, 1, 1, 7, 3, 2, 3, 2, 0, 0, 0, 8, 5, 0, 5, 0, 1, 0, 1, 6,
+    4, 3, 4, 3, 4, 2, 4, 2, 4, 4, 4, 4, 5, 1, 5, 7, 3, 3, 3, 15, 3, 2, 3, 14, 4, 3, 4, 15, 4, 0, 4, 8,
+    4, 0, 4, 0, 1, 0, 1, 6, 5, 1, 5, 1, 1, 6, 7, 7, 3, 2, 3, 14, 0, 0, 0, 8, 5, 0, 5, 0, 1, 7, 1, 8,
+    4, 3, 4, 3, 4, 2, 4, 2, 4, 4, 4, 4, 5, 1, 5, 7, 3, 14, 15, 15, 3, 15, 3, 12, 4, 3, 4, 15, 4, 0, 4, 8,
+    4, 0, 4, 0, 5, 0, 5, 0, 5, 1, 23, 1, 5, 1, 19, 11, 4, 2, 4, 2, 4, 0, 4, 8, 5, 1, 5, 1, 5, 1, 19, 7,
+    4, 3, 22, 3, 4, 3, 4, 3, 22, 4, 22, 22, 22, 5, 23, 19, 4, 3, 21, 16, 4, 3, 21, 15, 23, 4, 22, 21, 22, 4, 22, 18,
+    4, 0, 4, 0, 5, 0, 5, 0, 5, 1, 23, 1, 5, 6, 18, 10, 4, 2, 4, 2, 4, 0, 4, 8, 5, 1, 23, 1, 5, 6, 18, 10,
+    4, 3, 22, 3, 4, 3, 22, 3, 22, 22, 22, 22, 21, 21, 18, 18, 4, 12, 20, 16, 4, 12, 20, 16, 19, 19, 20, 20, 18, 18, 18, 18,
+    0, 18, 18, 0, 16, 20, 16, 12, 16, 16, 16, 12, 12, 16, 16, 12, 10, 18, 10, 6, 9, 18, 0, 0, 12, 2, 0, 2, 14, 15, 2, 2,
+    10, 10, 10, 6, 8, 0, 2, 0, 9, 0, 18, 0, 14, 2, 15, 2, 6, 10, 10, 6, 6, 7, 0, 0, 6, 0, 7, 0, 0, 0, 0, 0,
+    9, 18, 7, 0, 17, 20, 15, 2, 12, 16, 15, 2, 14, 16, 15, 14, 10, 18, 7, 0, 9, 18, 0, 0, 12, 2, 0, 2, 14, 15, 2, 2,
+    8, 11, 7, 0, 8, 0, 2, 0, 8, 0, 0, 0, 14, 2, 2, 2, 6, 11, 7, 6, 6, 7, 0, 0, 6, 0, 0, 0, 0, 0, 0, 4,
+    8, 7, 18, 0, 12, 15, 16, 2, 13, 15, 16, 2, 14, 15, 16, 14, 8, 7, 11, 0, 8, 0, 0, 0, 8, 2, 0, 0, 14, 2, 2, 2,
+    9, 7, 11, 0, 12, 0, 2, 2, 9, 0, 18, 0, 14, 2, 15, 2, 6, 7, 11, 6, 6, 0, 0, 0, 6, 0, 7, 0, 0, 0, 0, 4,
+    8, 7, 7, 0, 12, 15, 15, 2, 12, 15, 15, 2, 14, 15, 15, 14, 8, 7, 7, 0, 8, 0, 0, 0, 12, 2, 0, 2, 14, 14, 14, 3,
+    8, 7, 7, 0, 8, 0, 2, 0, 8, 0, 0, 0, 14, 14, 14, 3, 6, 7, 7, 6, 6, 6, 6, 1, 6, 6, 6, 1, 8, 0, 0, 0,
+    4, 22, 4, 0, 3, 21, 6, 6, 14, 8, 6, 8, 12, 13, 8, 8, 1, 19, 12, 12, 18, 18, 4, 18, 16, 20, 16, 16, 20, 20, 16, 1,
+    6, 12, 14, 12, 10, 18, 10, 10, 4, 22, 22, 4, 21, 22, 18, 0, 8, 9, 12, 12, 18, 18, 10, 3, 19, 23, 20, 2, 22, 22, 4, 0,
+    22, 22, 9, 9, 21, 21, 13, 13, 16, 17, 13, 13, 17, 17, 13, 13, 19, 19, 9, 9, 18, 18, 11, 22, 20, 21, 16, 16, 21, 21, 16, 5,
+    11, 10, 9, 9, 18, 19, 11, 11, 18, 22, 4, 0, 21, 22, 4, 1, 10, 10, 9, 9, 19, 19, 11, 4, 19, 23, 5, 3, 22, 22, 22, 4,
+    0, 18, 4, 8, 15, 20, 12, 12, 14, 17, 13, 9, 12, 17, 13, 12, 7, 18, 8, 8, 18, 18, 7, 4, 17, 21, 15, 15, 16, 21, 15, 1,
+    6, 10, 9, 13, 10, 19, 7, 7, 22, 22, 22, 22, 20, 21, 22, 5, 8, 10, 9, 8, 11, 19, 7, 3, 18, 19, 23, 4, 18, 22, 4, 0,
+    11, 18, 8, 8, 16, 20, 12, 12, 16, 17, 12, 12, 17, 14, 14, 2, 11, 18, 8, 8, 18, 18, 8, 4, 17, 8, 12, 8, 12, 3, 14, 4,
+    11, 10, 8, 8, 10, 12, 8, 12, 9, 8, 9, 4, 12, 14, 14, 3, 10, 6, 6, 0, 8, 1, 6, 5, 8, 6, 6, 1, 8, 0, 0, 0,
+    4, 4, 4, 0, 2, 6, 8, 6, 3, 6, 21, 6, 12, 8, 13, 8, 0, 14, 12, 14, 4, 22, 4, 4, 10, 18, 18, 10, 20, 18, 22, 6,
+    1, 12, 19, 12, 16, 20, 20, 16, 18, 4, 18, 18, 20, 16, 20, 1, 8, 12, 9, 12, 18, 20, 23, 14, 18, 10, 18, 3, 22, 4, 22, 0,
+    0, 22, 18, 9, 14, 22, 13, 9, 15, 13, 17, 12, 12, 13, 17, 12, 6, 23, 9, 13, 22, 22, 22, 22, 10, 20, 19, 7, 20, 22, 21, 5,
+    7, 9, 10, 8, 17, 18, 21, 15, 18, 7, 18, 22, 16, 15, 21, 1, 8, 9, 10, 8, 18, 23, 19, 4, 11, 7, 19, 3, 18, 4, 22, 0,
+    4, 8, 22, 9, 15, 12, 17, 13, 21, 13, 21, 13, 17, 13, 17, 13, 7, 8, 10, 9, 0, 4, 22, 0, 18, 11, 19, 11, 21, 16, 4, 1,
+    19, 9, 19, 9, 20, 16, 21, 16, 18, 11, 18, 22, 21, 21, 22, 5, 10, 9, 10, 9, 19, 11, 5, 3, 19, 19, 23, 4, 18, 22, 22, 4,
+    7, 8, 18, 8, 15, 12, 17, 12, 16, 12, 20, 13, 17, 14, 14, 2, 7, 8, 10, 8, 8, 8, 8, 4, 10, 8, 12, 12, 12, 14, 14, 3,
+    11, 8, 18, 9, 17, 12, 8, 8, 18, 9, 18, 22, 12, 14, 3, 4, 10, 6, 6, 0, 8, 6, 6, 1, 8, 6, 1, 5, 8, 0, 0, 0,
+    0, 4, 4, 0, 0, 1, 6, 6, 0, 6, 1, 6, 6, 6, 6, 6, 2, 3, 14, 14, 22, 22, 4, 9, 23, 19, 21, 8, 18, 18, 10, 6,
+    2, 14, 3, 14, 22, 21, 19, 12, 22, 4, 22, 9, 18, 10, 18, 6, 12, 12, 12, 12, 20, 20, 16, 12, 20, 16, 20, 12, 0, 18, 18, 0,
+    4, 22, 8, 9, 3, 23, 8, 9, 14, 9, 12, 9, 12, 9, 8, 6, 1, 22, 12, 13, 22, 22, 18, 22, 21, 18, 9, 12, 20, 22, 21, 1,
+    6, 13, 8, 13, 19, 20, 13, 8, 4, 8, 18, 9, 17, 4, 19, 6, 8, 13, 12, 14, 18, 23, 19, 3, 10, 5, 21, 14, 18, 22, 22, 0,
+    4, 8, 4, 8, 14, 12, 8, 8, 3, 8, 23, 9, 12, 8, 9, 6, 6, 8, 12, 12, 4, 18, 8, 8, 19, 13, 20, 8, 17, 19, 4, 6,
+    1, 12, 22, 13, 21, 9, 18, 12, 22, 18, 22, 22, 20, 21, 22, 1, 8, 12, 13, 14, 10, 21, 5, 14, 18, 19, 23, 3, 18, 22, 22, 0,
+    0, 9, 8, 8, 14, 13, 12, 12, 14, 13, 13, 13, 12, 14, 14, 2, 6, 9, 8, 8, 9, 22, 8, 4, 12, 8, 12, 12, 12, 3, 14, 4,
+    6, 9, 9, 9, 8, 12, 8, 8, 9, 9, 22, 22, 12, 14, 3, 4, 8, 6, 6, 0, 8, 1, 6, 5, 8, 6, 1, 5, 8, 0, 0, 0,
+    3, 21, 1, 6, 16, 21, 13, 8, 14, 17, 13, 8, 12, 17, 13, 12, 18, 18, 3, 3, 20, 20, 15, 15, 17, 16, 15, 15, 16, 16, 15, 15,
+    6, 18, 21, 3, 12, 18, 15, 3, 13, 15, 16, 14, 14, 15, 16, 14, 10, 18, 2, 3, 9, 19, 2, 3, 12, 3, 14, 3, 14, 3, 2, 0,
+    16, 20, 12, 12, 16, 20, 12, 12, 16, 16, 12, 12, 16, 16, 12, 12, 18, 18, 15, 3, 20, 20, 15, 21, 17, 16, 15, 15, 16, 16, 16, 22,
+    9, 18, 15, 3, 12, 18, 15, 3, 12, 15, 15, 3, 14, 16, 15, 16, 10, 19, 2, 3, 9, 21, 2, 22, 12, 3, 14, 2, 14, 21, 16, 5,
+    12, 16, 17, 14, 17, 16, 13, 14, 15, 15, 17, 12, 15, 15, 13, 14, 9, 20, 14, 3, 17, 20, 15, 3, 12, 15, 14, 3, 15, 15, 15, 0,
+    8, 10, 16, 2, 12, 15, 15, 3, 13, 14, 16, 22, 14, 15, 15, 5, 9, 11, 14, 2, 9, 3, 2, 2, 12, 2, 23, 4, 14, 3, 4, 5,
+    13, 16, 15, 14, 17, 16, 14, 17, 12, 15, 15, 14, 15, 15, 14, 15, 13, 20, 14, 9, 17, 17, 13, 21, 12, 15, 12, 12, 12, 15, 14, 15,
+    9, 10, 15, 8, 12, 13, 13, 13, 12, 12, 15, 12, 12, 14, 14, 14, 9, 8, 8, 6, 8, 8, 8, 1, 8, 8, 6, 1, 12, 14, 14, 2,
+    4, 22, 1, 6, 3, 21, 6, 6, 14, 8, 6, 8, 12, 13, 8, 8, 23, 23, 3, 3, 21, 21, 5, 18, 21, 20, 17, 17, 20, 20, 17, 11,
+    0, 19, 3, 15, 18, 18, 18, 18, 4, 21, 23, 1, 21, 18, 20, 11, 7, 18, 14, 15, 18, 18, 21, 18, 20, 22, 3, 14, 21, 18, 20, 7,
+    22, 22, 13, 9, 21, 21, 13, 20, 16, 17, 13, 13, 17, 17, 17, 18, 19, 19, 16, 16, 20, 20, 20, 19, 16, 20, 16, 16, 16, 20, 16, 19,
+    11, 19, 13, 17, 18, 20, 16, 18, 20, 16, 15, 16, 16, 20, 17, 18, 11, 18, 17, 3, 18, 21, 20, 23, 17, 17, 17, 3, 20, 21, 16, 23,
+    15, 20, 12, 8, 15, 17, 12, 13, 14, 13, 12, 8, 12, 17, 12, 7, 18, 18, 16, 16, 20, 20, 16, 19, 17, 21, 15, 12, 16, 18, 2, 7,
+    7, 18, 5, 9, 10, 18, 21, 18, 4, 20, 22, 22, 20, 10, 4, 1, 11, 19, 1, 2, 18, 18, 1, 3, 18, 18, 23, 4, 21, 18, 4, 0,
+    16, 20, 13, 13, 16, 17, 17, 20, 16, 17, 12, 12, 17, 16, 15, 15, 18, 20, 13, 9, 17, 21, 17, 22, 13, 13, 12, 12, 17, 16, 15, 4,
+    11, 13, 9, 8, 13, 17, 13, 17, 13, 12, 13, 12, 12, 15, 14, 15, 8, 8, 8, 6, 13, 21, 8, 5, 8, 8, 6, 1, 12, 15, 14, 3,
+    2, 5, 1, 6, 2, 6, 8, 6, 2, 6, 6, 6, 12, 8, 8, 8, 5, 4, 3, 3, 22, 23, 5, 5, 21, 18, 10, 6, 20, 18, 10, 7,
+    1, 3, 4, 2, 16, 22, 20, 13, 21, 1, 21, 18, 17, 13, 20, 7, 0, 15, 2, 15, 23, 21, 15, 2, 10, 2, 21, 3, 16, 10, 23, 0,
+    3, 22, 13, 9, 14, 22, 13, 9, 14, 13, 13, 9, 12, 17, 13, 17, 5, 23, 15, 16, 22, 21, 17, 22, 21, 17, 13, 17, 17, 21, 16, 22,
+    0, 19, 20, 12, 16, 16, 16, 20, 16, 12, 16, 19, 16, 16, 16, 0, 7, 18, 13, 2, 20, 21, 20, 22, 13, 13, 13, 3, 17, 21, 16, 1,
+    3, 12, 21, 9, 14, 12, 13, 9, 15, 12, 17, 9, 12, 12, 13, 6, 0, 7, 1, 12, 3, 15, 14, 1, 8, 12, 13, 7, 12, 8, 3, 0,
+    5, 6, 22, 16, 16, 13, 17, 15, 21, 20, 21, 23, 17, 21, 22, 5, 7, 8, 5, 3, 10, 10, 5, 3, 18, 18, 23, 4, 20, 21, 22, 5,
+    15, 13, 17, 12, 14, 17, 13, 17, 15, 12, 17, 13, 12, 15, 14, 15, 6, 9, 13, 9, 13, 17, 13, 21, 12, 12, 12, 12, 12, 15, 14, 3,
+    6, 9, 9, 9, 13, 13, 13, 13, 13, 13, 13, 22, 12, 14, 14, 3, 8, 8, 6, 6, 8, 8, 8, 1, 8, 8, 6, 5, 12, 14, 2, 2,
+    0, 5, 1, 0, 0, 1, 6, 6, 0, 6, 6, 6, 6, 6, 6, 10, 4, 4, 3, 3, 23, 23, 5, 10, 23, 19, 11, 9, 18, 18, 18, 10,
+    2, 3, 4, 2, 22, 19, 23, 10, 5, 1, 23, 9, 21, 10, 18, 6, 2, 15, 14, 12, 22, 19, 23, 9, 4, 11, 20, 12, 21, 18, 18, 6,
+    4, 23, 8, 9, 3, 20, 8, 18, 14, 9, 12, 8, 12, 20, 17, 11, 5, 22, 16, 9, 22, 20, 21, 19, 16, 16, 16, 9, 21, 20, 17, 19,
+    1, 22, 15, 8, 21, 20, 21, 18, 15, 15, 15, 9, 16, 20, 17, 7, 1, 20, 16, 12, 20, 20, 20, 19, 16, 16, 16, 12, 20, 20, 16, 1,
+    3, 12, 5, 8, 14, 12, 8, 10, 14, 8, 8, 8, 12, 10, 8, 7, 1, 7, 2, 9, 22, 19, 22, 10, 12, 11, 12, 8, 21, 18, 2, 7,
+    5, 7, 4, 8, 22, 19, 22, 10, 22, 20, 22, 23, 20, 10, 22, 6, 6, 11, 5, 14, 22, 19, 5, 9, 18, 18, 23, 3, 20, 10, 4, 0,
+    2, 12, 12, 12, 17, 20, 17, 20, 14, 12, 12, 12, 17, 16, 15, 15, 13, 13, 13, 13, 17, 21, 17, 22, 13, 13, 12, 12, 17, 21, 15, 4,
+    12, 12, 9, 9, 17, 17, 13, 20, 13, 13, 13, 22, 12, 15, 14, 2, 8, 8, 8, 0, 13, 21, 8, 5, 8, 8, 6, 5, 12, 15, 14, 4,
+    2, 1, 21, 6, 14, 13, 17, 8, 15, 13, 17, 8, 12, 13, 17, 12, 6, 21, 10, 2, 13, 21, 14, 14, 12, 16, 15, 3, 14, 16, 15, 14,
+    10, 2, 18, 3, 13, 14, 16, 15, 20, 15, 20, 15, 16, 15, 16, 15, 10, 2, 10, 2, 12, 14, 2, 2, 9, 2, 19, 3, 14, 2, 3, 0,
+    14, 17, 16, 12, 16, 17, 15, 12, 13, 13, 16, 14, 13, 13, 15, 12, 13, 21, 14, 2, 13, 16, 14, 15, 12, 15, 14, 2, 14, 16, 14, 1,
+    9, 14, 20, 3, 12, 14, 15, 3, 13, 14, 16, 3, 14, 14, 15, 0, 9, 14, 11, 2, 12, 14, 2, 4, 12, 2, 2, 2, 14, 4, 2, 1,
+    12, 12, 20, 12, 12, 12, 16, 12, 16, 12, 16, 12, 16, 12, 16, 12, 8, 15, 10, 2, 12, 15, 14, 2, 12, 15, 15, 21, 14, 15, 16, 16,
+    10, 14, 18, 3, 13, 14, 16, 15, 17, 15, 20, 21, 16, 16, 21, 22, 10, 2, 11, 2, 12, 14, 2, 2, 9, 20, 21, 22, 14, 16, 21, 5,
+    12, 15, 16, 14, 12, 15, 15, 14, 13, 14, 16, 17, 14, 14, 16, 15, 12, 15, 14, 8, 12, 15, 12, 12, 12, 13, 13, 13, 12, 14, 14, 14,
+    13, 14, 20, 9, 12, 12, 15, 12, 13, 13, 17, 21, 13, 14, 16, 15, 9, 8, 8, 6, 8, 6, 8, 1, 13, 8, 13, 1, 12, 14, 14, 2,
+    2, 1, 5, 6, 2, 6, 6, 6, 2, 8, 6, 6, 12, 8, 8, 8, 1, 22, 2, 2, 21, 21, 1, 10, 16, 20, 13, 13, 17, 20, 13, 7,
+    1, 2, 4, 3, 6, 10, 18, 6, 22, 5, 23, 5, 20, 17, 10, 7, 0, 2, 14, 14, 10, 21, 2, 2, 23, 15, 21, 2, 16, 23, 10, 0,
+    3, 21, 12, 9, 16, 21, 13, 9, 14, 13, 12, 9, 13, 13, 13, 6, 22, 22, 17, 17, 21, 21, 17, 23, 16, 20, 13, 14, 17, 22, 8, 1,
+    6, 1, 7, 14, 9, 13, 12, 7, 2, 14, 15, 1, 14, 2, 9, 6, 7, 1, 8, 3, 18, 23, 18, 4, 14, 5, 14, 2, 20, 22, 8, 1,
+    2, 13, 4, 8, 14, 13, 12, 8, 14, 13, 13, 20, 12, 13, 17, 17, 0, 20, 1, 12, 16, 20, 12, 1, 16, 16, 16, 20, 16, 16, 16, 0,
+    1, 14, 23, 17, 8, 13, 17, 17, 22, 17, 21, 22, 17, 16, 21, 22, 7, 13, 10, 2, 13, 13, 13, 2, 20, 20, 21, 22, 17, 16, 21, 1,
+    15, 17, 12, 12, 16, 17, 12, 12, 14, 13, 17, 17, 13, 14, 16, 15, 17, 9, 12, 8, 13, 13, 12, 4, 13, 13, 13, 13, 12, 14, 14, 2,
+    6, 13, 9, 9, 13, 12, 13, 12, 13, 13, 17, 21, 13, 14, 16, 3, 8, 6, 8, 6, 8, 6, 8, 5, 13, 8, 13, 1, 12, 2, 14, 2,
+    3, 1, 5, 6, 14, 6, 8, 8, 3, 6, 21, 6, 12, 8, 13, 8, 0, 4, 3, 15, 4, 23, 1, 1, 18, 18, 18, 18, 21, 20, 18, 11,
+    23, 3, 23, 3, 21, 17, 20, 17, 21, 5, 21, 18, 20, 20, 18, 11, 7, 14, 18, 15, 20, 3, 22, 14, 18, 21, 18, 18, 21, 20, 18, 7,
+    2, 4, 17, 8, 14, 13, 13, 9, 15, 12, 17, 18, 12, 13, 13, 11, 1, 22, 11, 3, 4, 22, 20, 22, 10, 21, 18, 18, 21, 4, 10, 7,
+    11, 0, 18, 17, 17, 15, 16, 13, 20, 21, 20, 19, 16, 20, 18, 11, 11, 1, 10, 2, 18, 23, 18, 4, 18, 21, 18, 19, 21, 4, 18, 0,
+    4, 12, 22, 9, 15, 12, 17, 13, 16, 13, 21, 20, 17, 17, 20, 18, 7, 12, 19, 16, 2, 15, 16, 16, 18, 16, 20, 18, 16, 17, 20, 18,
+    19, 16, 19, 16, 16, 16, 20, 16, 20, 20, 20, 19, 16, 16, 20, 19, 11, 17, 18, 3, 17, 17, 17, 3, 20, 20, 21, 23, 20, 21, 21, 23,
+    15, 12, 20, 13, 15, 12, 17, 13, 16, 17, 17, 20, 17, 16, 16, 16, 7, 12, 13, 13, 12, 12, 12, 12, 17, 13, 17, 17, 12, 14, 15, 15,
+    18, 13, 20, 9, 13, 13, 13, 13, 17, 17, 21, 22, 17, 16, 16, 22, 8, 8, 8, 6, 8, 6, 8, 1, 13, 13, 21, 22, 12, 14, 15, 3,
+    0, 1, 5, 0, 0, 6, 6, 6, 0, 6, 1, 6, 6, 6, 6, 10, 2, 4, 3, 2, 5, 23, 1, 9, 22, 23, 19, 10, 21, 18, 10, 6,
+    4, 3, 4, 3, 23, 5, 11, 9, 23, 23, 19, 10, 21, 18, 18, 10, 2, 14, 15, 12, 4, 20, 11, 12, 22, 23, 19, 9, 21, 18, 18, 6,
+    3, 5, 12, 8, 3, 9, 8, 8, 14, 8, 19, 10, 12, 9, 10, 11, 5, 23, 7, 8, 22, 22, 7, 9, 22, 22, 19, 10, 20, 22, 10, 6,
+    1, 2, 11, 9, 4, 4, 11, 9, 22, 22, 19, 10, 21, 20, 18, 11, 0, 5, 11, 12, 18, 23, 11, 3, 22, 22, 19, 9, 21, 4, 10, 6,
+    4, 8, 5, 8, 14, 12, 8, 8, 3, 21, 20, 18, 12, 17, 20, 11, 1, 15, 4, 8, 15, 15, 15, 8, 21, 21, 20, 18, 16, 17, 20, 7,
+    5, 16, 22, 9, 16, 16, 16, 9, 21, 21, 20, 19, 21, 20, 20, 19, 1, 16, 20, 12, 16, 16, 16, 12, 20, 20, 20, 19, 20, 16, 20, 1,
+    2, 12, 12, 12, 14, 12, 12, 12, 17, 17, 20, 20, 17, 16, 16, 16, 12, 12, 12, 12, 13, 13, 12, 4, 17, 17, 17, 20, 12, 14, 15, 2,
+    13, 13, 13, 13, 13, 13, 13, 13, 17, 17, 21, 22, 17, 16, 21, 22, 8, 8, 8, 0, 8, 6, 8, 5, 13, 13, 21, 22, 12, 14, 15, 4,
+    2, 1, 1, 6, 14, 13, 13, 8, 14, 13, 13, 8, 12, 13, 13, 12, 5, 21, 2, 2, 17, 21, 14, 14, 17, 16, 14, 14, 16, 12, 12, 8,
+    1, 2, 21, 2, 13, 14, 16, 14, 17, 14, 21, 15, 16, 12, 12, 8, 6, 3, 2, 2, 12, 15, 14, 14, 12, 15, 15, 15, 14, 12, 12, 8,
+    15, 17, 13, 12, 16, 17, 12, 16, 14, 13, 13, 12, 13, 13, 12, 13, 17, 21, 15, 15, 17, 16, 16, 21, 17, 16, 14, 14, 16, 17, 13, 13,
+    13, 15, 16, 14, 12, 16, 15, 16, 13, 14, 16, 15, 14, 13, 12, 13, 8, 14, 14, 14, 16, 21, 16, 21, 12, 14, 14, 14, 16, 17, 13, 13,
+    14, 13, 17, 12, 14, 13, 13, 12, 15, 12, 17, 16, 12, 12, 17, 13, 13, 16, 14, 14, 17, 16, 14, 14, 12, 15, 16, 16, 15, 12, 17, 13,
+    13, 14, 21, 15, 13, 14, 16, 15, 17, 16, 16, 21, 16, 17, 17, 17, 8, 14, 14, 14, 12, 14, 14, 14, 16, 16, 21, 21, 16, 17, 17, 17,
+    12, 16, 16, 12, 16, 16, 12, 16, 12, 12, 16, 16, 12, 12, 16, 12, 13, 12, 12, 12, 13, 17, 13, 17, 12, 12, 13, 13, 12, 15, 14, 14,
+    13, 12, 12, 12, 12, 13, 12, 13, 13, 13, 17, 17, 13, 14, 16, 15, 12, 8, 8, 8, 13, 13, 13, 13, 13, 13, 13, 13, 12, 14, 14, 14,
+    2, 1, 1, 6, 2, 6, 6, 6, 14, 8, 6, 8, 12, 12, 12, 9, 5, 22, 2, 2, 21, 21, 2, 10, 16, 2, 14, 2, 14, 9, 12, 10,
+    1, 2, 4, 2, 2, 2, 2, 10, 4, 2, 14, 14, 14, 12, 12, 9, 0, 3, 2, 2, 3, 18, 2, 10, 14, 2, 14, 14, 14, 9, 12, 10,
+    15, 21, 12, 3, 16, 16, 15, 20, 14, 13, 14, 14, 14, 13, 12, 13, 22, 21, 15, 3, 16, 20, 16, 18, 15, 15, 14, 14, 16, 17, 13, 10,
+    0, 3, 15, 3, 15, 16, 15, 20, 14, 14, 14, 14, 14, 13, 12, 9, 15, 15, 15, 15, 16, 20, 16, 18, 15, 15, 14, 14, 16, 20, 13, 10,
+    14, 13, 12, 2, 14, 13, 14, 14, 14, 15, 15, 15, 14, 12, 12, 12, 16, 3, 14, 2, 15, 15, 14, 10, 15, 15, 15, 15, 14, 12, 12, 8,
+    1, 14, 15, 15, 14, 14, 14, 14, 16, 15, 16, 16, 14, 12, 13, 13, 14, 14, 14, 14, 15, 15, 14, 10, 16, 16, 16, 21, 14, 12, 13, 8,
+    15, 14, 14, 14, 15, 16, 15, 16, 14, 14, 15, 15, 14, 13, 12, 12, 12, 12, 12, 12, 16, 16, 16, 20, 12, 12, 12, 12, 16, 16, 12, 12,
+    12, 14, 12, 12, 15, 16, 15, 16, 13, 13, 17, 17, 13, 13, 16, 14, 12, 12, 12, 8, 17, 17, 17, 21, 13, 13, 13, 13, 12, 15, 14, 14,
+    2, 1, 1, 6, 2, 6, 8, 6, 2, 6, 6, 6, 12, 12, 12, 9, 5, 4, 2, 2, 4, 14, 2, 14, 3, 2, 3, 10, 14, 12, 12, 9,
+    5, 2, 22, 3, 16, 14, 2, 2, 21, 3, 21, 18, 14, 12, 9, 10, 0, 3, 3, 3, 2, 14, 2, 2, 3, 3, 18, 18, 14, 12, 9, 10,
+    3, 4, 13, 2, 14, 15, 15, 15, 14, 14, 13, 14, 14, 12, 12, 12, 5, 15, 3, 2, 15, 16, 15, 16, 15, 14, 15, 14, 14, 13, 12, 13,
+    0, 3, 3, 3, 15, 15, 15, 15, 15, 15, 15, 18, 14, 12, 12, 9, 14, 14, 3, 3, 16, 16, 15, 21, 15, 15, 15, 18, 14, 13, 12, 8,
+    15, 12, 21, 3, 14, 14, 13, 14, 15, 15, 16, 20, 15, 12, 17, 13, 0, 15, 3, 3, 15, 14, 15, 14, 15, 15, 16, 20, 15, 12, 17, 9,
+    22, 15, 21, 3, 15, 15, 15, 15, 16, 16, 20, 18, 16, 17, 17, 18, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 20, 18, 16, 17, 20, 18,
+    15, 14, 14, 14, 14, 15, 14, 15, 15, 15, 16, 16, 15, 12, 17, 13, 14, 12, 14, 14, 13, 17, 13, 17, 15, 15, 16, 16, 15, 15, 17, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 16, 16, 16, 20, 16, 16, 16, 16, 12, 12, 12, 8, 13, 13, 13, 13, 17, 17, 17, 21, 12, 14, 16, 15,
+    0, 1, 1, 0, 0, 0, 0, 7, 0, 0, 0, 7, 2, 6, 6, 6, 4, 0, 0, 6, 2, 7, 0, 11, 2, 0, 0, 7, 2, 6, 6, 6,
+    4, 0, 0, 6, 2, 0, 0, 7, 2, 0, 7, 11, 2, 6, 6, 6, 2, 0, 0, 6, 2, 7, 0, 11, 2, 0, 7, 11, 2, 6, 6, 6,
+    3, 2, 2, 0, 2, 2, 2, 7, 2, 2, 0, 7, 14, 12, 12, 8, 2, 2, 2, 0, 15, 20, 2, 11, 2, 2, 0, 7, 14, 13, 12, 9,
+    2, 2, 0, 0, 2, 2, 2, 7, 2, 2, 0, 11, 14, 12, 8, 8, 2, 2, 2, 6, 15, 20, 2, 11, 2, 2, 0, 11, 14, 13, 12, 10,
+    3, 2, 2, 0, 2, 0, 2, 7, 15, 2, 15, 7, 14, 12, 12, 8, 2, 0, 2, 0, 2, 0, 2, 11, 15, 2, 15, 7, 14, 8, 12, 8,
+    2, 2, 2, 0, 2, 0, 2, 7, 15, 15, 20, 18, 14, 12, 13, 9, 2, 2, 2, 6, 2, 0, 2, 11, 15, 15, 20, 18, 14, 12, 13, 10,
+    14, 2, 2, 2, 15, 15, 15, 15, 15, 15, 15, 15, 14, 12, 12, 12, 14, 14, 14, 2, 16, 16, 16, 20, 15, 15, 15, 15, 14, 13, 12, 12,
+    14, 14, 14, 2, 15, 15, 15, 15, 16, 16, 16, 20, 14, 12, 17, 13, 12, 12, 12, 12, 16, 16, 16, 20, 16, 16, 16, 20, 12, 16, 16, 12,
+    1, 19, 3, 12, 20, 20, 1, 1, 12, 20, 19, 1, 16, 20, 0, 1, 11, 19, 9, 12, 18, 18, 7, 7, 8, 20, 7, 1, 13, 21, 0, 1,
+    6, 10, 9, 12, 10, 11, 7, 7, 9, 7, 11, 6, 8, 1, 6, 1, 8, 10, 9, 8, 11, 11, 7, 7, 6, 7, 11, 6, 6, 1, 0, 2,
+    10, 18, 6, 6, 20, 20, 7, 1, 13, 20, 7, 1, 17, 21, 0, 1, 10, 18, 6, 6, 18, 18, 7, 19, 8, 20, 7, 1, 13, 19, 0, 23,
+    10, 10, 6, 6, 10, 11, 7, 7, 8, 7, 7, 1, 8, 1, 6, 0, 10, 10, 6, 6, 11, 11, 11, 23, 6, 11, 7, 11, 6, 19, 11, 4,
+    8, 11, 10, 6, 13, 18, 6, 1, 9, 6, 11, 0, 13, 16, 6, 0, 10, 11, 9, 6, 10, 18, 7, 1, 8, 7, 7, 1, 8, 1, 0, 0,
+    7, 7, 10, 8, 8, 7, 6, 1, 9, 6, 11, 23, 8, 0, 22, 5, 7, 7, 9, 6, 7, 7, 7, 2, 6, 7, 7, 4, 6, 1, 5, 4,
+    9, 11, 7, 6, 9, 18, 6, 13, 8, 6, 7, 12, 13, 12, 12, 14, 10, 11, 6, 10, 10, 10, 9, 19, 8, 9, 9, 9, 9, 9, 12, 3,
+    8, 7, 7, 6, 8, 7, 8, 8, 8, 8, 7, 8, 12, 12, 14, 3, 7, 7, 6, 7, 8, 7, 6, 7, 8, 6, 6, 6, 8, 6, 6, 0,
+    5, 23, 3, 14, 22, 22, 1, 1, 2, 21, 1, 7, 15, 20, 6, 7, 1, 19, 12, 12, 19, 19, 4, 20, 20, 20, 20, 20, 20, 20, 19, 20,
+    6, 12, 14, 12, 19, 18, 10, 10, 5, 19, 22, 3, 18, 23, 1, 6, 8, 9, 12, 12, 18, 18, 10, 16, 19, 20, 18, 16, 19, 20, 18, 15,
+    23, 23, 9, 13, 21, 21, 10, 10, 16, 21, 9, 10, 16, 20, 10, 1, 19, 19, 9, 18, 18, 18, 18, 21, 20, 18, 11, 20, 20, 19, 18, 22,
+    11, 10, 9, 9, 10, 18, 10, 10, 18, 11, 7, 11, 10, 10, 10, 1, 10, 10, 10, 20, 10, 18, 10, 21, 11, 18, 10, 20, 18, 19, 11, 22,
+    7, 18, 8, 12, 20, 20, 11, 11, 15, 20, 4, 8, 16, 21, 3, 0, 7, 10, 8, 9, 18, 18, 11, 21, 17, 20, 19, 20, 20, 20, 3, 1,
+    6, 9, 8, 12, 10, 19, 7, 8, 5, 18, 23, 23, 20, 20, 22, 5, 8, 10, 8, 15, 11, 20, 0, 15, 18, 17, 5, 3, 19, 20, 5, 2,
+    11, 18, 9, 9, 20, 18, 9, 13, 16, 9, 8, 9, 12, 12, 12, 14, 11, 10, 10, 18, 10, 19, 10, 23, 9, 10, 9, 10, 9, 19, 9, 4,
+    11, 10, 8, 8, 9, 9, 8, 8, 9, 8, 9, 8, 12, 12, 14, 3, 10, 11, 7, 7, 10, 11, 7, 5, 8, 7, 6, 7, 8, 7, 6, 1,
+    0, 4, 3, 14, 4, 5, 1, 1, 3, 1, 5, 0, 2, 7, 0, 7, 0, 14, 12, 14, 23, 22, 4, 4, 11, 23, 18, 9, 22, 19, 7, 0,
+    0, 12, 12, 12, 19, 20, 16, 12, 19, 3, 19, 20, 16, 0, 19, 1, 8, 12, 12, 12, 18, 20, 17, 15, 10, 9, 18, 15, 11, 17, 22, 2,
+    1, 23, 9, 13, 4, 22, 7, 11, 2, 21, 18, 6, 15, 20, 9, 0, 6, 23, 9, 13, 23, 19, 10, 23, 10, 10, 10, 18, 18, 19, 18, 23,
+    6, 9, 9, 13, 19, 10, 9, 10, 10, 6, 10, 21, 9, 9, 9, 1, 8, 10, 9, 10, 10, 19, 11, 23, 10, 10, 10, 2, 10, 19, 11, 3,
+    1, 8, 19, 13, 2, 15, 3, 8, 4, 10, 23, 11, 15, 12, 4, 1, 6, 8, 9, 13, 1, 7, 6, 3, 11, 9, 10, 7, 6, 6, 4, 1,
+    7, 8, 10, 13, 12, 8, 9, 15, 19, 18, 19, 22, 20, 20, 22, 5, 8, 8, 9, 14, 8, 12, 1, 2, 10, 19, 23, 4, 18, 19, 23, 4,
+    7, 9, 10, 8, 14, 13, 9, 13, 10, 8, 13, 13, 12, 12, 14, 14, 6, 10, 9, 10, 9, 10, 9, 19, 9, 9, 9, 9, 9, 9, 12, 3,
+    7, 8, 10, 9, 8, 8, 8, 8, 9, 9, 9, 23, 12, 12, 14, 4, 8, 7, 6, 7, 8, 7, 6, 1, 8, 6, 6, 1, 8, 6, 0, 0,
+    2, 4, 3, 2, 5, 5, 1, 1, 0, 1, 5, 0, 0, 7, 6, 8, 2, 3, 14, 14, 22, 22, 4, 17, 23, 21, 22, 17, 23, 21, 22, 13,
+    2, 14, 14, 14, 22, 21, 16, 13, 4, 3, 22, 13, 5, 16, 18, 8, 12, 12, 12, 16, 20, 20, 20, 16, 19, 16, 20, 12, 19, 20, 20, 12,
+    5, 22, 12, 13, 4, 23, 11, 13, 3, 23, 7, 12, 3, 18, 10, 6, 1, 18, 12, 20, 23, 18, 19, 21, 19, 18, 19, 20, 18, 18, 18, 21,
+    6, 13, 8, 12, 11, 11, 11, 13, 7, 7, 7, 13, 10, 10, 10, 6, 8, 18, 10, 16, 19, 18, 10, 21, 11, 18, 10, 15, 18, 18, 10, 3,
+    1, 8, 4, 12, 3, 15, 0, 13, 4, 15, 5, 9, 14, 16, 4, 6, 6, 8, 12, 17, 23, 21, 23, 17, 23, 21, 23, 17, 23, 21, 4, 8,
+    6, 12, 12, 12, 8, 16, 8, 12, 23, 18, 23, 22, 20, 20, 22, 1, 8, 17, 12, 15, 19, 20, 0, 15, 18, 17, 23, 14, 18, 17, 5, 2,
+    0, 8, 8, 8, 9, 9, 9, 9, 8, 8, 8, 8, 12, 12, 12, 2, 10, 18, 10, 18, 10, 19, 10, 23, 10, 10, 9, 18, 9, 19, 9, 4,
+    6, 8, 8, 8, 9, 9, 8, 8, 9, 9, 9, 23, 12, 12, 14, 4, 10, 11, 7, 7, 10, 19, 7, 5, 8, 7, 6, 0, 8, 7, 6, 5,
+    4, 22, 0, 0, 21, 21, 1, 7, 15, 21, 1, 7, 16, 20, 6, 7, 19, 19, 3, 15, 18, 18, 4, 4, 17, 20, 3, 4, 17, 21, 4, 7,
+    7, 19, 3, 15, 10, 18, 1, 5, 8, 18, 22, 0, 13, 21, 3, 6, 11, 18, 14, 15, 10, 19, 5, 15, 9, 19, 1, 14, 9, 22, 4, 0,
+    18, 18, 0, 18, 20, 20, 16, 20, 16, 20, 12, 16, 16, 16, 16, 16, 18, 18, 10, 18, 18, 18, 18, 18, 17, 20, 10, 18, 20, 20, 20, 21,
+    10, 18, 6, 10, 10, 18, 17, 20, 9, 9, 8, 9, 17, 17, 17, 16, 10, 10, 10, 10, 18, 18, 18, 19, 10, 10, 10, 11, 18, 18, 18, 22,
+    8, 18, 4, 4, 17, 20, 2, 3, 12, 17, 22, 2, 17, 16, 2, 6, 10, 18, 0, 1, 18, 18, 0, 4, 13, 20, 0, 0, 17, 21, 3, 0,
+    8, 10, 23, 0, 9, 18, 2, 2, 8, 8, 22, 22, 12, 15, 22, 5, 10, 11, 0, 14, 10, 19, 1, 2, 8, 7, 23, 4, 8, 4, 4, 4,
+    9, 18, 8, 9, 17, 17, 13, 17, 13, 13, 12, 13, 13, 17, 13, 16, 10, 10, 9, 10, 9, 18, 9, 18, 9, 9, 9, 9, 13, 17, 13, 16,
+    9, 9, 8, 9, 13, 13, 13, 13, 8, 8, 9, 8, 12, 12, 12, 14, 9, 10, 9, 11, 9, 10, 9, 11, 8, 8, 8, 6, 8, 8, 8, 0,
+    4, 22, 0, 0, 22, 22, 1, 23, 2, 21, 1, 7, 15, 23, 6, 19, 23, 23, 3, 22, 22, 22, 22, 18, 21, 22, 5, 21, 21, 23, 22, 18,
+    0, 19, 3, 15, 19, 23, 4, 19, 4, 4, 4, 22, 22, 23, 22, 19, 7, 22, 14, 21, 19, 22, 23, 20, 23, 22, 23, 21, 22, 22, 22, 18,
+    22, 22, 4, 22, 21, 21, 21, 21, 16, 21, 4, 22, 21, 21, 21, 20, 19, 19, 19, 19, 18, 18, 18, 18, 19, 19, 19, 19, 20, 20, 20, 19,
+    11, 19, 5, 23, 21, 21, 21, 21, 4, 22, 4, 22, 21, 21, 21, 20, 19, 19, 19, 18, 18, 18, 18, 21, 19, 19, 19, 18, 18, 18, 18, 22,
+    0, 18, 4, 4, 16, 20, 4, 23, 15, 4, 4, 4, 16, 23, 22, 19, 11, 18, 5, 22, 18, 22, 22, 18, 5, 22, 5, 22, 22, 23, 22, 18,
+    7, 5, 5, 5, 4, 23, 4, 23, 4, 4, 4, 4, 4, 23, 4, 7, 11, 22, 23, 21, 23, 22, 23, 20, 5, 22, 5, 15, 22, 22, 4, 0,
+    18, 18, 8, 22, 17, 21, 17, 21, 16, 13, 12, 13, 17, 17, 17, 16, 10, 19, 10, 19, 18, 18, 18, 18, 10, 19, 10, 19, 17, 20, 17, 21,
+    11, 9, 8, 9, 17, 21, 17, 21, 8, 9, 8, 8, 13, 17, 12, 15, 10, 10, 10, 11, 10, 18, 10, 19, 9, 10, 8, 7, 9, 18, 8, 4,
+    4, 4, 0, 0, 4, 5, 1, 1, 2, 1, 1, 7, 2, 7, 0, 6, 5, 4, 3, 3, 4, 22, 4, 4, 22, 5, 1, 5, 4, 4, 4, 7,
+    0, 3, 3, 15, 23, 4, 3, 4, 4, 0, 4, 18, 3, 3, 3, 7, 0, 15, 2, 14, 5, 5, 5, 15, 1, 1, 1, 15, 4, 4, 4, 0,
+    4, 22, 0, 4, 4, 22, 16, 21, 3, 3, 2, 3, 16, 16, 16, 17, 5, 23, 11, 19, 18, 18, 18, 18, 10, 18, 10, 18, 20, 20, 20, 21,
+    1, 1, 0, 1, 16, 20, 16, 20, 0, 0, 0, 0, 16, 16, 16, 16, 11, 11, 11, 10, 18, 18, 18, 19, 10, 10, 10, 10, 18, 18, 18, 22,
+    0, 7, 4, 0, 3, 3, 2, 3, 3, 2, 4, 2, 14, 3, 2, 6, 1, 1, 0, 1, 0, 4, 0, 4, 0, 0, 0, 0, 2, 3, 2, 6,
+    1, 0, 5, 0, 2, 2, 2, 2, 4, 0, 22, 22, 2, 2, 22, 5, 6, 1, 0, 14, 0, 1, 0, 14, 0, 0, 23, 4, 0, 0, 22, 4,
+    0, 8, 8, 8, 13, 17, 13, 17, 12, 12, 12, 12, 13, 17, 13, 16, 9, 10, 9, 10, 9, 18, 9, 18, 9, 9, 9, 9, 13, 17, 13, 16,
+    8, 8, 8, 8, 13, 13, 13, 13, 8, 8, 9, 9, 12, 12, 12, 14, 9, 10, 9, 11, 9, 10, 9, 11, 8, 8, 8, 6, 8, 8, 8, 0,
+    4, 4, 0, 0, 5, 5, 5, 19, 0, 5, 1, 5, 0, 23, 5, 10, 4, 4, 4, 21, 4, 22, 4, 18, 5, 22, 4, 21, 22, 23, 5, 18,
+    2, 4, 3, 4, 4, 23, 5, 19, 4, 4, 4, 8, 4, 23, 5, 9, 2, 22, 4, 17, 23, 22, 4, 20, 5, 22, 4, 13, 22, 22, 4, 9,
+    4, 4, 4, 4, 22, 22, 22, 23, 4, 4, 4, 5, 21, 21, 21, 18, 23, 23, 23, 22, 22, 22, 22, 18, 23, 23, 23, 22, 21, 21, 21, 18,
+    5, 5, 5, 4, 22, 22, 22, 23, 4, 4, 4, 4, 21, 21, 21, 18, 19, 19, 19, 20, 19, 19, 19, 20, 19, 19, 19, 20, 18, 18, 18, 18,
+    0, 4, 4, 4, 4, 23, 4, 19, 3, 5, 4, 5, 4, 23, 4, 10, 5, 22, 5, 21, 4, 22, 4, 18, 5, 22, 5, 21, 4, 23, 22, 18,
+    1, 4, 5, 4, 4, 23, 4, 19, 4, 4, 4, 8, 4, 23, 4, 8, 5, 22, 5, 17, 5, 22, 23, 20, 5, 22, 5, 12, 4, 22, 4, 8,
+    0, 4, 4, 4, 21, 22, 21, 22, 12, 4, 12, 4, 17, 21, 17, 20, 19, 23, 19, 23, 18, 18, 18, 18, 10, 23, 10, 23, 20, 20, 17, 22,
+    8, 5, 8, 5, 17, 22, 17, 22, 8, 8, 8, 8, 13, 17, 12, 15, 10, 19, 10, 18, 18, 18, 10, 23, 9, 10, 8, 7, 9, 18, 8, 4,
+    2, 5, 4, 0, 15, 22, 0, 7, 3, 0, 5, 6, 15, 17, 0, 6, 1, 22, 2, 14, 21, 21, 5, 5, 13, 21, 10, 2, 17, 20, 9, 6,
+    7, 2, 23, 15, 8, 13, 9, 2, 10, 4, 19, 5, 13, 14, 10, 7, 7, 2, 10, 14, 9, 13, 6, 15, 10, 13, 11, 3, 12, 17, 10, 0,
+    2, 21, 10, 10, 16, 21, 8, 9, 14, 16, 18, 8, 16, 17, 8, 0, 6, 21, 10, 10, 17, 21, 10, 19, 13, 10, 10, 10, 17, 19, 18, 23,
+    6, 1, 10, 6, 9, 9, 8, 9, 9, 8, 10, 8, 12, 9, 8, 0, 6, 10, 10, 10, 10, 19, 10, 23, 9, 11, 10, 11, 10, 19, 10, 4,
+    0, 16, 19, 16, 12, 16, 3, 12, 12, 16, 19, 16, 12, 16, 16, 16, 6, 20, 11, 12, 13, 17, 12, 12, 9, 17, 17, 17, 13, 17, 16, 16,
+    7, 12, 19, 13, 12, 12, 13, 13, 10, 17, 21, 21, 17, 17, 21, 22, 7, 12, 10, 2, 8, 12, 13, 2, 9, 20, 21, 22, 17, 17, 21, 5,
+    12, 17, 10, 12, 13, 13, 12, 13, 12, 13, 13, 17, 13, 12, 16, 15, 8, 9, 9, 10, 9, 10, 9, 10, 13, 9, 13, 13, 12, 12, 14, 14,
+    8, 8, 9, 9, 12, 12, 9, 8, 13, 13, 17, 17, 13, 12, 16, 15, 8, 7, 8, 7, 8, 7, 8, 7, 8, 6, 8, 6, 12, 6, 14, 2,
+    4, 5, 3, 0, 4, 22, 1, 7, 2, 1, 1, 7, 2, 7, 6, 6, 1, 4, 2, 3, 22, 22, 5, 20, 16, 21, 23, 21, 21, 21, 9, 7,
+    0, 2, 3, 15, 7, 1, 0, 9, 5, 3, 4, 1, 0, 0, 10, 7, 0, 2, 14, 16, 19, 20, 19, 16, 19, 20, 19, 16, 19, 20, 10, 2,
+    4, 22, 6, 7, 21, 21, 6, 10, 15, 21, 6, 6, 16, 20, 9, 6, 5, 22, 11, 18, 21, 18, 18, 21, 11, 18, 11, 18, 18, 19, 18, 22,
+    7, 7, 6, 7, 6, 10, 6, 10, 6, 6, 6, 6, 8, 9, 8, 0, 11, 18, 11, 20, 10, 18, 10, 21, 11, 18, 11, 20, 10, 19, 18, 22,
+    0, 21, 5, 14, 15, 16, 14, 14, 3, 16, 16, 16, 15, 16, 17, 17, 1, 20, 0, 20, 20, 20, 12, 20, 16, 16, 16, 16, 16, 16, 16, 0,
+    1, 12, 5, 12, 12, 12, 12, 12, 17, 17, 21, 21, 17, 17, 21, 22, 6, 20, 8, 15, 12, 20, 12, 15, 17, 17, 21, 4, 17, 17, 21, 1,
+    2, 8, 8, 8, 16, 13, 12, 13, 13, 13, 13, 13, 13, 12, 16, 15, 9, 10, 9, 10, 9, 19, 9, 23, 9, 9, 13, 9, 12, 12, 14, 3,
+    8, 8, 8, 8, 8, 9, 8, 12, 13, 13, 17, 17, 13, 12, 16, 15, 9, 11, 8, 7, 9, 11, 8, 5, 8, 6, 8, 6, 8, 6, 14, 0,
+    1, 1, 4, 2, 2, 1, 0, 7, 3, 0, 5, 19, 2, 6, 18, 11, 0, 3, 2, 14, 4, 23, 1, 2, 11, 22, 19, 19, 21, 21, 18, 11,
+    1, 2, 4, 15, 14, 2, 3, 13, 23, 22, 23, 18, 21, 21, 18, 11, 0, 14, 14, 14, 2, 17, 2, 14, 19, 22, 19, 18, 21, 21, 18, 7,
+    2, 4, 19, 6, 3, 22, 8, 8, 2, 2, 18, 18, 14, 13, 18, 11, 1, 11, 11, 11, 10, 19, 10, 19, 10, 10, 10, 10, 10, 19, 10, 1,
+    7, 6, 11, 6, 8, 8, 8, 8, 10, 6, 18, 18, 8, 8, 18, 11, 7, 10, 11, 10, 10, 19, 10, 23, 10, 10, 10, 2, 10, 19, 10, 2,
+    1, 14, 23, 15, 14, 14, 15, 15, 4, 16, 20, 20, 16, 16, 20, 18, 7, 14, 11, 14, 14, 14, 14, 14, 16, 16, 20, 20, 16, 16, 20, 18,
+    1, 12, 19, 16, 12, 12, 16, 16, 19, 20, 20, 19, 16, 16, 20, 19, 7, 12, 10, 14, 12, 12, 13, 2, 20, 20, 21, 23, 17, 20, 21, 23,
+    0, 12, 12, 12, 12, 12, 12, 12, 13, 13, 17, 17, 13, 13, 16, 16, 9, 9, 9, 9, 9, 10, 9, 10, 13, 13, 13, 13, 12, 12, 14, 14,
+    7, 8, 9, 9, 12, 12, 13, 9, 13, 13, 21, 22, 13, 13, 16, 22, 8, 7, 8, 7, 8, 7, 8, 7, 8, 6, 8, 1, 12, 6, 14, 2,
+    1, 1, 3, 0, 1, 1, 1, 8, 0, 1, 1, 10, 0, 7, 11, 10, 2, 4, 2, 13, 5, 21, 6, 13, 22, 16, 11, 9, 23, 21, 11, 8,
+    2, 2, 3, 12, 2, 14, 7, 8, 4, 23, 19, 10, 22, 23, 19, 10, 2, 16, 14, 13, 23, 21, 6, 13, 22, 16, 19, 12, 22, 16, 11, 8,
+    4, 5, 6, 12, 4, 23, 7, 8, 2, 1, 19, 10, 2, 10, 10, 10, 5, 18, 19, 20, 19, 18, 19, 21, 11, 18, 11, 13, 18, 18, 10, 6,
+    0, 7, 6, 12, 6, 7, 6, 12, 6, 6, 19, 10, 6, 6, 18, 10, 11, 18, 11, 16, 11, 18, 19, 21, 11, 18, 11, 14, 10, 18, 10, 2,
+    1, 14, 4, 8, 2, 14, 15, 8, 3, 21, 20, 18, 16, 16, 20, 11, 0, 21, 2, 13, 14, 21, 14, 13, 16, 16, 20, 10, 16, 16, 20, 7,
+    1, 14, 4, 12, 14, 14, 15, 8, 21, 21, 20, 19, 16, 21, 20, 19, 0, 16, 12, 12, 12, 20, 12, 12, 20, 20, 20, 19, 16, 16, 20, 1,
+    2, 8, 12, 12, 12, 12, 12, 12, 13, 13, 17, 20, 13, 13, 16, 16, 9, 10, 9, 18, 9, 19, 9, 23, 13, 9, 13, 13, 12, 12, 14, 2,
+    8, 8, 8, 8, 12, 8, 12, 12, 13, 13, 21, 22, 13, 13, 16, 22, 9, 11, 8, 7, 9, 11, 8, 5, 8, 6, 8, 1, 12, 6, 14, 2,
+    3, 5, 1, 0, 3, 22, 0, 15, 2, 0, 1, 14, 15, 14, 14, 12, 5, 22, 3, 3, 21, 22, 3, 15, 17, 3, 2, 3, 14, 14, 14, 12,
+    1, 3, 4, 2, 12, 15, 3, 15, 4, 2, 15, 15, 14, 14, 12, 12, 6, 2, 2, 2, 3, 3, 3, 3, 2, 2, 2, 2, 14, 14, 14, 8,
+    3, 21, 2, 3, 16, 16, 15, 16, 15, 15, 14, 15, 15, 16, 15, 17, 21, 21, 2, 18, 16, 20, 16, 20, 17, 15, 14, 15, 16, 16, 16, 17,
+    6, 2, 2, 2, 15, 16, 15, 16, 14, 14, 14, 14, 15, 16, 15, 17, 6, 10, 10, 10, 20, 18, 20, 18, 14, 10, 14, 10, 16, 20, 16, 21,
+    14, 16, 4, 14, 15, 15, 14, 15, 14, 15, 15, 16, 15, 14, 17, 13, 8, 2, 2, 2, 17, 15, 14, 15, 15, 15, 15, 15, 15, 14, 17, 13,
+    6, 14, 14, 14, 14, 14, 14, 14, 15, 15, 16, 16, 15, 15, 17, 17, 8, 2, 14, 14, 14, 14, 14, 14, 15, 15, 16, 21, 15, 15, 17, 17,
+    12, 12, 12, 12, 12, 16, 12, 16, 12, 12, 12, 12, 12, 16, 12, 12, 12, 9, 12, 9, 13, 17, 13, 20, 12, 12, 12, 12, 13, 17, 13, 16,
+    12, 12, 12, 12, 12, 13, 12, 13, 12, 12, 13, 13, 12, 12, 16, 15, 9, 10, 9, 10, 13, 10, 9, 10, 12, 8, 13, 8, 12, 12, 12, 14,
+    4, 5, 0, 4, 4, 4, 3, 23, 2, 3, 3, 3, 3, 3, 14, 9, 5, 4, 4, 22, 4, 23, 4, 19, 3, 4, 3, 4, 3, 23, 3, 10,
+    0, 4, 3, 4, 3, 4, 3, 23, 3, 3, 3, 3, 3, 3, 14, 9, 4, 22, 4, 22, 4, 23, 4, 19, 4, 4, 3, 22, 3, 23, 3, 10,
+    4, 4, 3, 4, 3, 21, 3, 21, 3, 3, 3, 3, 15, 16, 15, 17, 4, 23, 4, 23, 21, 21, 21, 21, 4, 23, 4, 23, 16, 21, 16, 20,
+    3, 4, 3, 4, 3, 21, 3, 21, 3, 3, 3, 3, 15, 16, 15, 17, 23, 19, 23, 19, 21, 21, 21, 21, 4, 19, 4, 19, 21, 21, 16, 18,
+    2, 3, 3, 4, 3, 4, 3, 4, 15, 3, 15, 15, 14, 14, 12, 12, 3, 4, 3, 4, 3, 23, 3, 19, 3, 3, 15, 3, 14, 14, 12, 9,
+    3, 3, 3, 3, 3, 4, 3, 4, 15, 15, 15, 15, 14, 14, 12, 12, 3, 4, 3, 22, 3, 23, 3, 19, 15, 3, 15, 15, 14, 14, 12, 8,
+    14, 3, 14, 3, 15, 16, 15, 21, 14, 14, 14, 14, 15, 16, 15, 17, 12, 19, 12, 19, 16, 20, 16, 20, 12, 12, 12, 12, 16, 16, 16, 16,
+    14, 14, 14, 14, 15, 16, 15, 16, 12, 12, 12, 12, 15, 16, 15, 12, 9, 10, 9, 10, 17, 20, 17, 18, 12, 9, 12, 8, 13, 17, 12, 15,
+    2, 1, 1, 0, 2, 1, 2, 2, 2, 2, 1, 2, 14, 14, 12, 9, 5, 4, 2, 2, 3, 3, 2, 2, 3, 2, 3, 2, 14, 14, 12, 9,
+    1, 2, 4, 3, 2, 2, 2, 2, 3, 3, 3, 19, 14, 14, 12, 10, 0, 2, 2, 2, 3, 3, 2, 2, 3, 3, 3, 19, 14, 14, 12, 10,
+    3, 3, 2, 3, 15, 15, 15, 15, 2, 2, 3, 2, 14, 14, 14, 12, 5, 3, 2, 3, 16, 20, 16, 20, 2, 3, 2, 2, 15, 16, 14, 13,
+    2, 2, 2, 2, 15, 15, 15, 15, 2, 2, 3, 3, 14, 14, 14, 12, 2, 11, 2, 11, 16, 18, 16, 18, 2, 2, 2, 2, 15, 16, 14, 13,
+    2, 2, 3, 3, 14, 14, 3, 2, 15, 15, 16, 16, 15, 14, 17, 13, 2, 2, 2, 2, 2, 3, 2, 14, 15, 15, 16, 16, 15, 14, 17, 13,
+    1, 2, 3, 3, 14, 14, 15, 3, 15, 15, 20, 18, 15, 15, 17, 18, 2, 2, 2, 2, 14, 2, 14, 14, 15, 15, 20, 18, 15, 15, 17, 18,
+    14, 14, 14, 14, 14, 15, 14, 15, 14, 14, 15, 15, 14, 14, 17, 13, 12, 12, 12, 12, 13, 17, 13, 17, 14, 14, 14, 14, 13, 17, 13, 14,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 16, 16, 12, 12, 16, 16, 9, 10, 9, 10, 13, 10, 13, 10, 12, 12, 13, 13, 12, 12, 14, 14,
+    1, 1, 0, 1, 2, 1, 0, 1, 2, 0, 0, 0, 2, 0, 0, 6, 4, 5, 1, 1, 4, 5, 1, 11, 2, 1, 0, 1, 2, 1, 0, 7,
+    2, 1, 0, 1, 2, 1, 0, 7, 2, 0, 0, 7, 2, 0, 6, 6, 4, 5, 1, 1, 4, 23, 1, 11, 2, 1, 0, 6, 2, 1, 0, 11,
+    3, 4, 3, 5, 3, 4, 3, 5, 2, 2, 2, 0, 2, 2, 2, 6, 4, 4, 4, 5, 4, 22, 4, 23, 3, 4, 2, 1, 3, 21, 2, 10,
+    3, 4, 3, 5, 3, 4, 3, 5, 2, 2, 2, 0, 2, 2, 2, 6, 4, 23, 4, 22, 22, 22, 4, 19, 3, 4, 2, 1, 3, 21, 2, 10,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 0, 2, 0, 14, 0, 12, 8, 3, 5, 2, 1, 3, 5, 2, 11, 2, 0, 2, 0, 2, 0, 12, 6,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 0, 2, 7, 14, 0, 12, 8, 3, 5, 2, 1, 3, 5, 2, 11, 2, 0, 2, 7, 14, 0, 12, 8,
+    3, 4, 3, 4, 15, 4, 3, 4, 14, 2, 15, 2, 14, 14, 14, 12, 3, 4, 3, 4, 16, 21, 16, 22, 14, 3, 14, 2, 15, 16, 14, 13,
+    3, 4, 3, 4, 15, 4, 15, 4, 14, 14, 15, 15, 14, 14, 12, 12, 3, 19, 3, 19, 16, 20, 16, 20, 12, 12, 12, 12, 16, 16, 12, 12,
+    0, 3, 19, 12, 12, 19, 16, 0, 16, 0, 20, 1, 16, 0, 16, 0, 6, 9, 10, 12, 9, 19, 6, 6, 9, 6, 11, 7, 8, 6, 0, 0,
+    7, 9, 10, 12, 8, 11, 7, 1, 18, 7, 18, 7, 13, 0, 21, 1, 8, 9, 10, 8, 6, 11, 7, 6, 11, 7, 11, 7, 6, 0, 1, 2,
+    6, 10, 11, 8, 9, 19, 6, 0, 13, 6, 18, 1, 13, 6, 16, 0, 11, 10, 7, 8, 9, 11, 6, 7, 8, 6, 7, 1, 8, 6, 0, 5,
+    9, 9, 11, 6, 8, 7, 6, 0, 9, 6, 11, 1, 8, 0, 0, 0, 9, 9, 7, 8, 6, 11, 6, 3, 6, 6, 7, 2, 6, 5, 0, 3,
+    6, 6, 18, 6, 12, 7, 17, 0, 17, 6, 20, 1, 17, 0, 16, 0, 6, 6, 10, 6, 8, 7, 6, 0, 9, 6, 11, 7, 8, 6, 0, 0,
+    10, 6, 10, 6, 8, 7, 7, 19, 10, 7, 18, 19, 13, 18, 19, 23, 10, 6, 10, 6, 6, 7, 11, 11, 11, 11, 19, 23, 6, 11, 19, 4,
+    8, 7, 11, 6, 8, 7, 6, 12, 9, 6, 18, 13, 13, 12, 12, 14, 8, 7, 7, 6, 8, 7, 8, 8, 8, 8, 7, 8, 12, 14, 12, 3,
+    9, 6, 11, 10, 8, 9, 9, 9, 9, 9, 10, 19, 9, 12, 9, 3, 6, 6, 11, 7, 8, 6, 6, 6, 9, 6, 11, 7, 8, 6, 6, 0,
+    0, 3, 4, 14, 3, 23, 0, 0, 3, 0, 5, 1, 2, 0, 6, 6, 0, 12, 12, 12, 19, 19, 3, 16, 12, 16, 20, 12, 16, 19, 0, 0,
+    0, 12, 14, 14, 11, 18, 9, 9, 23, 4, 22, 4, 22, 7, 19, 0, 8, 12, 12, 12, 10, 18, 9, 15, 18, 10, 17, 15, 11, 22, 17, 2,
+    1, 19, 8, 13, 23, 23, 10, 10, 14, 3, 15, 6, 15, 3, 12, 1, 11, 19, 9, 13, 19, 19, 10, 22, 13, 9, 8, 15, 20, 22, 20, 5,
+    6, 9, 8, 13, 11, 18, 9, 6, 0, 6, 7, 3, 6, 4, 6, 0, 9, 9, 9, 14, 10, 23, 12, 3, 6, 0, 13, 14, 18, 23, 12, 3,
+    0, 9, 5, 12, 2, 18, 3, 6, 3, 6, 22, 10, 15, 9, 17, 0, 6, 9, 8, 12, 10, 18, 6, 3, 12, 9, 10, 10, 9, 9, 9, 0,
+    6, 9, 9, 18, 10, 10, 10, 18, 23, 10, 19, 23, 18, 18, 19, 23, 8, 9, 10, 10, 10, 10, 10, 2, 10, 11, 19, 23, 10, 11, 19, 3,
+    7, 10, 8, 8, 10, 13, 8, 12, 14, 9, 13, 13, 12, 14, 12, 14, 11, 10, 8, 8, 9, 9, 8, 5, 9, 8, 9, 8, 12, 14, 12, 4,
+    6, 9, 10, 10, 9, 9, 9, 9, 9, 9, 10, 19, 9, 12, 9, 3, 9, 6, 11, 7, 8, 6, 6, 0, 9, 6, 11, 1, 8, 0, 6, 0,
+    1, 3, 4, 14, 2, 5, 1, 7, 22, 1, 22, 1, 15, 6, 20, 7, 6, 14, 12, 12, 5, 22, 3, 3, 19, 10, 18, 10, 18, 1, 23, 6,
+    1, 12, 19, 12, 20, 20, 20, 20, 19, 4, 19, 20, 20, 19, 20, 20, 8, 12, 9, 12, 19, 18, 20, 16, 18, 18, 20, 16, 19, 18, 20, 15,
+    0, 5, 10, 12, 3, 23, 16, 1, 16, 2, 20, 10, 16, 3, 17, 0, 6, 9, 9, 13, 5, 23, 18, 23, 10, 7, 11, 9, 20, 22, 20, 5,
+    7, 8, 10, 20, 17, 19, 20, 20, 18, 19, 18, 21, 20, 19, 20, 21, 8, 9, 9, 16, 19, 5, 17, 15, 11, 18, 20, 16, 19, 5, 20, 2,
+    5, 8, 23, 13, 15, 8, 21, 11, 21, 10, 21, 10, 16, 10, 20, 1, 7, 8, 10, 9, 0, 7, 11, 11, 10, 10, 18, 10, 10, 10, 10, 1,
+    11, 9, 19, 18, 20, 11, 18, 20, 18, 18, 18, 21, 18, 18, 19, 22, 10, 10, 18, 20, 11, 10, 18, 20, 10, 10, 18, 21, 18, 19, 19, 22,
+    7, 8, 18, 9, 15, 8, 9, 9, 20, 9, 18, 13, 12, 12, 12, 14, 7, 8, 10, 9, 8, 8, 8, 8, 9, 9, 9, 9, 12, 14, 12, 3,
+    11, 10, 10, 18, 10, 9, 10, 10, 10, 10, 19, 23, 9, 9, 19, 23, 10, 11, 11, 11, 8, 6, 7, 7, 10, 11, 11, 23, 8, 6, 7, 1,
+    2, 3, 4, 2, 0, 5, 1, 0, 5, 1, 5, 1, 0, 6, 7, 8, 2, 14, 14, 14, 4, 22, 3, 13, 22, 4, 16, 13, 5, 18, 16, 8,
+    2, 14, 3, 14, 23, 22, 21, 17, 22, 22, 21, 17, 23, 22, 21, 13, 12, 12, 12, 16, 19, 20, 16, 12, 19, 20, 20, 16, 19, 20, 20, 12,
+    1, 4, 8, 12, 4, 22, 15, 12, 3, 0, 16, 13, 2, 4, 16, 8, 1, 13, 12, 12, 23, 23, 15, 13, 5, 5, 16, 13, 20, 22, 16, 1,
+    6, 12, 21, 17, 23, 23, 21, 17, 23, 23, 21, 17, 23, 23, 21, 13, 8, 13, 17, 16, 18, 23, 17, 14, 19, 18, 20, 16, 19, 5, 17, 14,
+    5, 12, 4, 12, 3, 7, 5, 12, 4, 11, 23, 13, 3, 10, 18, 6, 6, 8, 12, 12, 7, 7, 7, 12, 11, 11, 11, 13, 10, 10, 10, 6,
+    1, 19, 18, 20, 19, 19, 18, 20, 19, 19, 18, 21, 18, 18, 18, 21, 8, 10, 18, 16, 11, 10, 18, 15, 19, 18, 18, 21, 18, 10, 18, 3,
+    0, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 12, 12, 12, 2, 6, 8, 8, 8, 9, 9, 8, 5, 9, 9, 9, 9, 12, 14, 12, 4,
+    10, 10, 18, 18, 10, 10, 10, 18, 10, 10, 19, 23, 9, 9, 19, 23, 10, 11, 11, 11, 8, 6, 7, 0, 10, 11, 19, 23, 8, 6, 7, 5,
+    0, 4, 5, 2, 3, 23, 0, 6, 15, 0, 22, 7, 15, 0, 17, 6, 7, 23, 2, 15, 19, 19, 4, 4, 12, 9, 13, 0, 13, 9, 14, 7,
+    1, 2, 4, 14, 9, 19, 17, 0, 17, 5, 21, 4, 17, 9, 16, 1, 7, 10, 2, 14, 10, 18, 13, 14, 9, 6, 17, 15, 8, 10, 17, 2,
+    0, 19, 16, 16, 12, 19, 16, 16, 12, 3, 16, 12, 12, 16, 16, 16, 11, 19, 12, 13, 10, 19, 17, 21, 13, 13, 12, 13, 17, 21, 17, 22,
+    6, 11, 20, 12, 9, 17, 17, 17, 13, 12, 17, 12, 13, 16, 17, 16, 11, 10, 12, 2, 10, 21, 20, 22, 8, 13, 12, 2, 17, 21, 17, 5,
+    2, 10, 21, 10, 14, 18, 16, 8, 15, 8, 21, 9, 15, 8, 17, 0, 6, 10, 1, 6, 9, 10, 8, 8, 8, 8, 9, 9, 12, 8, 9, 0,
+    6, 10, 21, 10, 13, 10, 10, 10, 17, 10, 19, 19, 13, 18, 19, 23, 6, 10, 10, 10, 9, 10, 11, 11, 10, 10, 19, 23, 10, 10, 19, 4,
+    8, 10, 17, 8, 12, 13, 13, 17, 12, 12, 13, 13, 12, 15, 12, 15, 9, 9, 8, 9, 13, 17, 13, 17, 8, 8, 13, 12, 12, 15, 12, 15,
+    8, 9, 9, 10, 9, 13, 9, 9, 9, 9, 10, 10, 12, 14, 12, 14, 9, 8, 11, 7, 8, 8, 6, 6, 9, 8, 11, 7, 8, 14, 6, 0,
+    5, 4, 1, 2, 3, 5, 0, 1, 2, 0, 1, 7, 2, 0, 6, 11, 5, 23, 3, 15, 23, 23, 4, 18, 15, 3, 2, 13, 21, 18, 21, 11,
+    0, 3, 3, 15, 11, 19, 22, 19, 4, 1, 5, 3, 21, 18, 21, 11, 0, 15, 14, 14, 19, 19, 13, 15, 2, 2, 17, 15, 21, 18, 17, 0,
+    5, 23, 14, 15, 4, 23, 16, 20, 15, 15, 14, 15, 16, 20, 16, 18, 19, 19, 12, 16, 19, 20, 20, 19, 12, 16, 12, 16, 16, 20, 16, 19,
+    7, 19, 14, 14, 16, 20, 16, 20, 14, 14, 14, 14, 16, 20, 16, 18, 11, 18, 13, 14, 20, 21, 20, 23, 12, 13, 12, 2, 17, 21, 20, 23,
+    2, 19, 4, 6, 3, 18, 2, 18, 3, 8, 4, 8, 14, 18, 12, 7, 7, 11, 6, 6, 18, 18, 6, 18, 8, 8, 8, 8, 8, 18, 8, 7,
+    1, 11, 11, 11, 10, 10, 10, 10, 10, 10, 19, 19, 10, 10, 19, 5, 7, 11, 10, 10, 10, 10, 10, 2, 10, 10, 19, 23, 10, 10, 19, 3,
+    0, 12, 12, 12, 13, 17, 13, 17, 12, 12, 12, 12, 13, 16, 12, 15, 11, 9, 8, 9, 13, 21, 13, 22, 12, 13, 12, 8, 13, 16, 12, 4,
+    9, 9, 9, 9, 13, 13, 9, 13, 9, 9, 10, 10, 12, 14, 12, 14, 9, 8, 11, 7, 8, 8, 6, 1, 9, 8, 11, 7, 12, 14, 6, 2,
+    3, 3, 5, 0, 2, 1, 0, 6, 3, 0, 5, 7, 2, 6, 6, 6, 0, 3, 2, 15, 5, 22, 3, 0, 6, 0, 1, 9, 0, 10, 0, 6,
+    1, 2, 4, 21, 16, 23, 21, 21, 22, 23, 22, 20, 21, 23, 21, 20, 0, 14, 20, 16, 19, 19, 20, 16, 19, 19, 20, 16, 19, 19, 20, 15,
+    0, 5, 21, 14, 3, 16, 16, 16, 15, 14, 16, 14, 15, 17, 16, 17, 1, 23, 12, 12, 17, 21, 17, 21, 12, 12, 12, 12, 17, 21, 17, 22,
+    0, 0, 20, 20, 16, 16, 16, 16, 16, 12, 20, 20, 16, 16, 16, 0, 6, 9, 20, 16, 17, 21, 17, 3, 12, 12, 20, 16, 17, 21, 17, 0,
+    3, 6, 22, 7, 15, 6, 16, 6, 3, 6, 21, 10, 15, 8, 17, 6, 6, 6, 7, 7, 6, 6, 6, 6, 6, 6, 10, 10, 8, 8, 9, 0,
+    5, 11, 18, 18, 11, 11, 18, 18, 21, 18, 18, 21, 18, 18, 19, 22, 11, 11, 18, 20, 11, 11, 18, 20, 10, 10, 18, 21, 10, 18, 19, 22,
+    2, 8, 8, 8, 13, 13, 13, 13, 15, 12, 13, 13, 12, 15, 12, 15, 8, 8, 8, 8, 13, 17, 13, 17, 8, 8, 9, 13, 12, 15, 12, 15,
+    9, 9, 10, 10, 9, 9, 9, 9, 9, 9, 19, 23, 12, 14, 12, 3, 9, 9, 11, 11, 8, 8, 6, 6, 9, 9, 11, 23, 8, 14, 6, 0,
+    3, 3, 1, 2, 0, 5, 0, 9, 0, 0, 1, 8, 0, 11, 6, 9, 3, 3, 3, 12, 4, 19, 14, 9, 0, 6, 15, 12, 22, 19, 14, 9,
+    2, 3, 3, 17, 23, 11, 16, 13, 5, 22, 21, 17, 23, 11, 21, 8, 2, 15, 16, 17, 22, 19, 16, 12, 23, 22, 21, 17, 23, 11, 16, 12,
+    5, 4, 14, 8, 4, 20, 21, 18, 2, 15, 14, 8, 16, 20, 16, 11, 5, 22, 15, 12, 21, 20, 21, 19, 14, 15, 14, 8, 16, 20, 21, 19,
+    0, 3, 21, 17, 16, 20, 16, 9, 14, 14, 21, 17, 16, 20, 16, 6, 0, 16, 16, 16, 20, 20, 16, 12, 12, 12, 20, 16, 16, 20, 16, 0,
+    3, 6, 5, 12, 2, 19, 0, 9, 3, 6, 5, 8, 2, 10, 6, 6, 0, 6, 7, 12, 6, 19, 6, 9, 6, 6, 7, 12, 6, 18, 6, 6,
+    1, 19, 18, 20, 11, 11, 18, 17, 19, 19, 18, 21, 18, 18, 18, 21, 11, 11, 18, 16, 11, 11, 18, 15, 11, 19, 18, 21, 10, 10, 18, 3,
+    0, 12, 8, 8, 13, 17, 13, 20, 12, 12, 12, 12, 13, 16, 12, 15, 8, 8, 8, 8, 13, 21, 13, 22, 8, 12, 8, 8, 13, 16, 12, 4,
+    9, 9, 10, 18, 9, 13, 9, 9, 9, 9, 19, 23, 12, 14, 12, 3, 9, 9, 11, 11, 8, 8, 6, 0, 9, 9, 11, 23, 8, 14, 6, 0,
+    0, 0, 22, 0, 14, 1, 16, 6, 16, 0, 21, 7, 16, 6, 17, 6, 6, 3, 11, 14, 8, 22, 9, 0, 9, 0, 18, 4, 13, 3, 16, 6,
+    11, 2, 19, 15, 13, 2, 20, 5, 18, 4, 18, 4, 17, 4, 21, 7, 11, 14, 10, 14, 9, 1, 11, 14, 10, 5, 19, 15, 9, 4, 22, 0,
+    8, 4, 18, 4, 12, 22, 17, 2, 13, 2, 20, 3, 13, 2, 16, 6, 8, 23, 10, 0, 9, 22, 8, 22, 9, 2, 10, 2, 12, 22, 14, 1,
+    9, 0, 18, 1, 13, 0, 17, 0, 9, 0, 18, 4, 13, 2, 16, 0, 9, 0, 11, 14, 8, 23, 6, 3, 9, 0, 11, 2, 8, 4, 0, 0,
+    0, 0, 18, 18, 12, 12, 16, 16, 16, 16, 20, 20, 16, 16, 16, 16, 6, 6, 10, 10, 8, 8, 9, 9, 9, 17, 20, 20, 17, 17, 17, 16,
+    10, 10, 18, 18, 13, 10, 18, 18, 18, 18, 18, 18, 20, 20, 20, 21, 10, 10, 10, 10, 10, 10, 10, 11, 18, 18, 18, 19, 18, 18, 18, 22,
+    8, 8, 18, 9, 12, 12, 13, 13, 13, 13, 17, 17, 13, 13, 17, 16, 8, 8, 9, 9, 8, 8, 9, 8, 13, 13, 13, 13, 13, 12, 13, 14,
+    9, 9, 10, 10, 9, 9, 9, 9, 9, 9, 18, 18, 13, 13, 17, 16, 9, 9, 10, 11, 9, 8, 9, 6, 9, 9, 10, 11, 9, 8, 9, 0,
+    0, 0, 4, 0, 2, 1, 0, 6, 3, 0, 5, 1, 2, 0, 6, 6, 0, 3, 2, 14, 4, 22, 0, 9, 14, 3, 4, 4, 3, 3, 3, 6,
+    1, 2, 4, 3, 6, 1, 5, 5, 4, 4, 22, 4, 4, 4, 4, 7, 0, 2, 14, 14, 1, 1, 1, 14, 5, 5, 5, 15, 4, 4, 4, 0,
+    0, 4, 7, 0, 3, 4, 2, 2, 2, 2, 3, 3, 14, 2, 3, 6, 1, 5, 0, 0, 22, 22, 0, 22, 2, 2, 2, 2, 2, 22, 2, 1,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 4, 4, 2, 2, 3, 6, 6, 0, 1, 14, 0, 23, 0, 3, 0, 0, 1, 14, 0, 22, 0, 0,
+    0, 0, 4, 4, 2, 2, 3, 3, 3, 16, 21, 21, 16, 16, 16, 17, 0, 0, 1, 1, 0, 0, 0, 0, 16, 16, 20, 20, 16, 16, 16, 16,
+    1, 11, 19, 19, 10, 10, 18, 18, 18, 18, 18, 18, 20, 20, 20, 21, 11, 11, 11, 10, 10, 10, 10, 10, 18, 18, 18, 19, 18, 18, 18, 22,
+    0, 8, 8, 8, 12, 12, 12, 12, 13, 13, 17, 17, 13, 13, 17, 16, 8, 8, 8, 8, 8, 9, 8, 8, 13, 13, 13, 13, 13, 12, 13, 14,
+    9, 9, 10, 10, 9, 9, 9, 9, 9, 9, 18, 18, 13, 13, 17, 16, 9, 9, 10, 11, 9, 8, 9, 6, 9, 9, 10, 11, 9, 8, 9, 0,
+    4, 0, 4, 0, 2, 1, 1, 23, 4, 1, 22, 23, 15, 22, 23, 19, 0, 3, 3, 22, 4, 4, 4, 22, 19, 4, 23, 19, 22, 22, 23, 19,
+    5, 3, 23, 22, 21, 5, 22, 21, 22, 22, 22, 18, 22, 22, 23, 18, 7, 23, 22, 21, 23, 23, 22, 21, 23, 23, 22, 20, 22, 22, 22, 18,
+    0, 4, 18, 4, 15, 4, 4, 4, 16, 4, 23, 23, 15, 22, 23, 19, 7, 5, 5, 5, 4, 4, 4, 4, 4, 4, 23, 23, 4, 4, 23, 11,
+    11, 5, 22, 22, 5, 5, 22, 22, 18, 22, 22, 18, 22, 22, 23, 18, 7, 23, 22, 21, 5, 5, 22, 16, 23, 23, 22, 20, 22, 22, 22, 18,
+    4, 4, 22, 22, 15, 4, 22, 22, 21, 21, 21, 21, 21, 21, 21, 20, 7, 5, 23, 23, 4, 4, 22, 22, 21, 21, 21, 21, 21, 21, 21, 20,
+    19, 19, 19, 19, 19, 19, 19, 19, 18, 18, 18, 18, 20, 20, 20, 19, 19, 19, 19, 18, 19, 19, 19, 18, 18, 18, 18, 21, 18, 18, 18, 22,
+    0, 4, 18, 22, 15, 12, 13, 13, 17, 17, 21, 21, 17, 17, 17, 16, 7, 8, 9, 9, 8, 8, 9, 9, 17, 17, 21, 21, 13, 13, 17, 16,
+    10, 10, 19, 19, 10, 10, 19, 19, 18, 18, 18, 18, 20, 17, 20, 21, 10, 10, 10, 11, 9, 9, 10, 11, 18, 10, 18, 19, 9, 9, 18, 22,
+    4, 0, 4, 0, 0, 1, 5, 5, 5, 5, 23, 19, 0, 5, 23, 10, 2, 3, 4, 4, 4, 4, 4, 8, 4, 5, 23, 19, 4, 5, 23, 9,
+    4, 4, 22, 21, 5, 4, 22, 21, 4, 4, 22, 18, 22, 23, 23, 18, 2, 4, 22, 17, 5, 4, 22, 13, 23, 22, 22, 20, 22, 4, 22, 9,
+    0, 4, 4, 4, 3, 4, 5, 5, 4, 4, 23, 19, 4, 4, 23, 10, 1, 5, 4, 4, 4, 4, 4, 8, 4, 4, 23, 19, 4, 4, 23, 9,
+    5, 5, 22, 21, 5, 5, 22, 21, 4, 4, 22, 18, 4, 22, 23, 18, 5, 5, 22, 17, 5, 5, 22, 13, 5, 23, 22, 20, 4, 4, 22, 9,
+    4, 4, 4, 4, 4, 4, 4, 5, 22, 22, 22, 23, 21, 21, 21, 18, 5, 5, 5, 4, 4, 4, 4, 4, 22, 22, 22, 23, 21, 21, 21, 18,
+    23, 23, 23, 22, 23, 23, 23, 22, 22, 22, 22, 18, 21, 21, 21, 18, 19, 19, 19, 20, 19, 19, 19, 20, 19, 19, 19, 20, 18, 18, 18, 18,
+    0, 4, 4, 4, 4, 4, 4, 4, 21, 21, 22, 22, 17, 17, 21, 20, 5, 5, 5, 5, 8, 8, 4, 4, 17, 17, 22, 22, 13, 13, 17, 16,
+    19, 19, 23, 23, 10, 10, 23, 23, 18, 18, 18, 18, 20, 20, 20, 22, 10, 10, 19, 18, 9, 9, 10, 11, 18, 18, 18, 23, 9, 9, 18, 22,
+    2, 1, 5, 0, 2, 1, 0, 14, 3, 0, 22, 15, 15, 14, 14, 12, 1, 4, 2, 2, 4, 15, 2, 14, 12, 3, 15, 15, 14, 12, 14, 12,
+    1, 2, 22, 3, 13, 2, 3, 3, 21, 3, 22, 15, 14, 14, 14, 12, 6, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 14, 14, 14, 8,
+    2, 4, 16, 2, 14, 15, 15, 16, 14, 14, 15, 15, 14, 13, 14, 13, 6, 14, 14, 14, 15, 16, 15, 16, 14, 14, 14, 14, 15, 17, 14, 13,
+    8, 2, 2, 2, 15, 15, 15, 15, 13, 14, 15, 15, 14, 13, 14, 13, 6, 14, 2, 2, 15, 16, 15, 21, 14, 14, 14, 14, 15, 17, 14, 13,
+    2, 2, 21, 3, 14, 14, 15, 15, 15, 15, 16, 16, 15, 15, 16, 17, 6, 2, 2, 2, 14, 14, 14, 14, 15, 15, 16, 16, 15, 15, 16, 17,
+    1, 2, 21, 18, 13, 14, 15, 15, 16, 16, 20, 20, 16, 16, 16, 17, 6, 10, 10, 10, 10, 10, 10, 10, 20, 20, 18, 18, 16, 16, 20, 21,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 16, 16, 12, 12, 16, 12, 12, 12, 12, 12, 12, 13, 12, 13, 12, 12, 13, 13, 12, 15, 13, 14,
+    9, 9, 9, 9, 12, 12, 12, 12, 13, 13, 17, 20, 13, 13, 17, 16, 9, 9, 10, 10, 9, 8, 9, 8, 13, 9, 10, 10, 13, 12, 13, 14,
+    2, 1, 1, 0, 2, 1, 2, 2, 2, 2, 1, 2, 14, 12, 14, 9, 5, 4, 2, 2, 3, 3, 2, 11, 3, 2, 3, 2, 14, 12, 14, 10,
+    1, 2, 4, 3, 2, 2, 2, 2, 3, 3, 3, 3, 14, 12, 14, 9, 0, 2, 2, 2, 3, 3, 2, 11, 3, 3, 3, 3, 14, 12, 14, 10,
+    3, 3, 2, 3, 15, 16, 15, 16, 2, 2, 15, 14, 14, 13, 14, 13, 5, 3, 2, 3, 15, 20, 15, 18, 14, 15, 14, 2, 15, 17, 14, 10,
+    2, 2, 2, 2, 15, 16, 15, 16, 2, 2, 3, 15, 14, 13, 14, 13, 2, 2, 2, 2, 15, 20, 15, 18, 2, 14, 2, 2, 15, 17, 14, 10,
+    2, 2, 3, 3, 2, 2, 3, 2, 15, 15, 15, 15, 15, 14, 15, 12, 2, 2, 2, 2, 2, 3, 2, 2, 15, 15, 15, 15, 15, 14, 15, 12,
+    1, 2, 3, 3, 2, 2, 3, 3, 16, 16, 20, 20, 15, 15, 16, 17, 2, 2, 11, 11, 2, 2, 2, 2, 16, 16, 18, 18, 15, 15, 16, 17,
+    14, 14, 14, 14, 14, 15, 14, 15, 14, 14, 15, 15, 14, 13, 15, 12, 12, 12, 12, 12, 12, 16, 12, 16, 12, 12, 12, 12, 12, 16, 12, 12,
+    12, 12, 9, 9, 14, 14, 14, 14, 13, 13, 17, 17, 13, 13, 17, 15, 9, 9, 10, 10, 12, 13, 9, 8, 13, 13, 10, 10, 13, 14, 13, 14,
+    3, 0, 5, 4, 2, 3, 3, 3, 3, 3, 4, 23, 3, 14, 3, 9, 0, 3, 4, 4, 3, 3, 3, 3, 3, 3, 4, 23, 3, 14, 3, 9,
+    5, 4, 4, 22, 4, 3, 4, 4, 4, 4, 23, 19, 3, 3, 23, 19, 4, 4, 22, 22, 4, 4, 4, 22, 4, 4, 23, 19, 3, 3, 23, 19,
+    2, 3, 3, 4, 3, 15, 3, 3, 3, 3, 4, 4, 14, 12, 14, 12, 3, 3, 3, 3, 15, 15, 3, 15, 3, 3, 4, 4, 14, 12, 14, 12,
+    3, 3, 4, 4, 3, 3, 3, 3, 3, 3, 23, 19, 14, 12, 14, 9, 3, 3, 4, 22, 3, 15, 3, 3, 3, 3, 23, 19, 14, 12, 14, 9,
+    3, 3, 4, 4, 3, 3, 3, 3, 3, 3, 21, 21, 15, 15, 16, 17, 3, 3, 4, 4, 3, 3, 3, 3, 3, 3, 21, 21, 15, 15, 16, 17,
+    4, 4, 23, 23, 4, 4, 23, 23, 21, 21, 21, 21, 21, 16, 21, 20, 23, 23, 19, 19, 4, 4, 19, 19, 21, 21, 21, 21, 21, 21, 21, 18,
+    3, 3, 3, 3, 14, 14, 14, 14, 15, 15, 16, 21, 15, 15, 16, 17, 14, 14, 3, 3, 12, 12, 12, 12, 15, 15, 16, 16, 15, 15, 16, 13,
+    3, 3, 19, 19, 12, 12, 12, 12, 16, 16, 20, 20, 16, 16, 16, 16, 9, 9, 10, 10, 9, 9, 9, 9, 17, 17, 20, 18, 17, 13, 17, 16,
+    0, 0, 5, 1, 2, 0, 0, 0, 3, 0, 5, 1, 2, 0, 0, 6, 3, 0, 5, 1, 2, 0, 0, 6, 3, 0, 5, 7, 2, 6, 0, 6,
+    4, 5, 5, 5, 2, 0, 1, 1, 4, 5, 5, 19, 2, 0, 1, 7, 4, 5, 5, 5, 2, 0, 1, 6, 4, 5, 23, 19, 2, 0, 1, 11,
+    3, 2, 5, 1, 2, 2, 0, 0, 3, 2, 5, 1, 2, 12, 0, 6, 3, 2, 5, 1, 2, 2, 0, 7, 3, 2, 5, 1, 14, 12, 0, 8,
+    3, 3, 5, 5, 2, 2, 0, 0, 3, 3, 5, 19, 2, 12, 0, 6, 3, 3, 5, 5, 2, 2, 0, 6, 3, 3, 5, 19, 2, 12, 0, 6,
+    3, 3, 4, 5, 3, 2, 3, 0, 3, 3, 4, 5, 3, 2, 3, 6, 3, 3, 4, 5, 3, 2, 3, 0, 3, 3, 4, 5, 3, 2, 3, 6,
+    4, 4, 4, 5, 3, 3, 4, 5, 22, 4, 22, 23, 3, 3, 21, 18, 4, 4, 23, 22, 3, 3, 4, 5, 22, 22, 22, 19, 3, 3, 21, 18,
+    3, 3, 4, 4, 3, 2, 3, 2, 15, 3, 4, 4, 15, 14, 15, 12, 3, 3, 4, 4, 14, 15, 3, 2, 15, 15, 4, 4, 15, 12, 15, 12,
+    3, 3, 4, 4, 3, 3, 3, 3, 16, 16, 21, 22, 16, 15, 16, 17, 3, 3, 19, 19, 12, 12, 3, 3, 16, 16, 20, 20, 16, 16, 16, 16,
+    0, 3, 3, 12, 4, 19, 0, 0, 3, 0, 19, 0, 12, 1, 0, 0, 6, 9, 9, 12, 10, 19, 6, 6, 9, 6, 11, 6, 8, 7, 6, 6,
+    6, 9, 9, 12, 10, 11, 6, 6, 10, 6, 19, 7, 8, 7, 7, 7, 8, 9, 9, 8, 11, 8, 8, 12, 11, 8, 8, 12, 6, 8, 8, 12,
+    7, 10, 9, 8, 10, 19, 7, 7, 9, 7, 11, 6, 12, 6, 6, 6, 11, 10, 8, 11, 10, 11, 11, 19, 8, 11, 7, 11, 11, 19, 11, 19,
+    6, 9, 9, 8, 10, 11, 6, 6, 9, 6, 11, 7, 8, 6, 6, 6, 9, 9, 8, 9, 11, 10, 9, 9, 6, 9, 8, 9, 11, 10, 9, 9,
+    6, 9, 10, 8, 9, 11, 6, 6, 9, 6, 19, 7, 12, 6, 6, 6, 6, 9, 9, 8, 10, 11, 6, 6, 9, 6, 11, 7, 8, 6, 6, 6,
+    7, 8, 10, 11, 8, 7, 11, 11, 10, 11, 11, 19, 11, 11, 19, 19, 8, 8, 10, 9, 7, 8, 10, 9, 11, 10, 10, 10, 11, 10, 10, 10,
+    6, 10, 10, 6, 9, 8, 8, 8, 9, 8, 8, 8, 8, 12, 12, 12, 10, 10, 6, 10, 9, 10, 9, 10, 8, 9, 8, 9, 9, 9, 9, 9,
+    6, 6, 10, 10, 8, 8, 9, 9, 9, 9, 10, 10, 9, 9, 9, 9, 6, 6, 10, 6, 8, 7, 6, 6, 9, 6, 11, 7, 8, 6, 6, 6,
+    0, 3, 3, 14, 4, 23, 0, 0, 3, 0, 5, 0, 2, 1, 0, 0, 0, 12, 12, 12, 19, 19, 0, 16, 0, 0, 0, 16, 1, 20, 0, 16,
+    6, 12, 14, 12, 11, 0, 6, 0, 5, 0, 6, 6, 6, 0, 6, 6, 8, 8, 8, 13, 6, 13, 8, 17, 6, 8, 8, 13, 6, 13, 8, 17,
+    7, 19, 8, 1, 23, 19, 7, 1, 2, 1, 7, 1, 7, 7, 7, 7, 11, 11, 7, 18, 11, 18, 11, 20, 7, 11, 7, 18, 11, 18, 11, 20,
+    6, 9, 6, 6, 7, 7, 6, 6, 6, 6, 6, 6, 7, 7, 6, 6, 6, 9, 8, 9, 11, 10, 9, 17, 6, 9, 8, 13, 11, 18, 9, 17,
+    6, 9, 8, 0, 11, 1, 6, 0, 3, 6, 7, 7, 6, 6, 6, 6, 6, 9, 6, 6, 7, 7, 6, 17, 6, 6, 6, 6, 7, 7, 6, 17,
+    6, 7, 7, 7, 7, 7, 7, 7, 11, 7, 11, 11, 11, 11, 11, 19, 6, 8, 8, 8, 6, 8, 8, 12, 6, 8, 9, 9, 6, 8, 9, 12,
+    7, 6, 6, 6, 6, 6, 6, 6, 8, 6, 8, 8, 8, 8, 8, 12, 7, 11, 7, 11, 10, 10, 10, 18, 7, 11, 7, 11, 10, 10, 10, 19,
+    6, 6, 7, 7, 6, 6, 6, 6, 9, 9, 10, 10, 9, 9, 9, 9, 6, 9, 8, 8, 10, 10, 6, 6, 9, 9, 11, 6, 8, 7, 6, 6,
+    0, 3, 3, 14, 4, 5, 0, 0, 4, 0, 23, 1, 2, 1, 1, 1, 0, 14, 12, 14, 5, 6, 0, 6, 11, 6, 0, 0, 0, 6, 0, 0,
+    0, 12, 12, 12, 1, 0, 1, 16, 19, 1, 19, 20, 1, 1, 20, 20, 8, 8, 8, 13, 6, 8, 8, 13, 6, 8, 13, 17, 6, 8, 13, 17,
+    1, 5, 9, 0, 4, 7, 1, 0, 2, 1, 1, 1, 6, 6, 1, 1, 6, 7, 7, 7, 7, 11, 7, 11, 7, 7, 7, 7, 11, 11, 7, 19,
+    6, 6, 9, 6, 7, 6, 7, 6, 7, 7, 7, 20, 7, 7, 7, 20, 6, 8, 8, 8, 6, 9, 8, 9, 6, 8, 8, 13, 6, 9, 8, 12,
+    7, 8, 19, 1, 2, 7, 1, 1, 23, 7, 19, 1, 7, 7, 7, 7, 6, 6, 9, 6, 7, 6, 7, 6, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 11, 18, 7, 7, 11, 18, 11, 11, 18, 20, 11, 11, 18, 20, 7, 8, 10, 9, 7, 8, 10, 13, 11, 10, 10, 20, 11, 10, 18, 20,
+    7, 6, 6, 6, 6, 8, 6, 6, 6, 6, 6, 6, 8, 8, 8, 12, 6, 7, 6, 7, 9, 10, 9, 10, 6, 6, 6, 6, 9, 9, 9, 9,
+    7, 7, 11, 11, 7, 7, 11, 11, 10, 10, 10, 18, 10, 10, 10, 19, 7, 8, 10, 9, 7, 7, 10, 8, 10, 10, 10, 10, 8, 6, 11, 7,
+    2, 3, 3, 2, 5, 2, 2, 14, 5, 2, 2, 14, 0, 2, 2, 14, 2, 2, 2, 15, 0, 15, 2, 16, 0, 2, 2, 15, 0, 15, 2, 16,
+    2, 2, 2, 15, 0, 2, 2, 15, 0, 2, 15, 16, 0, 2, 15, 16, 0, 12, 12, 12, 0, 12, 12, 12, 0, 12, 12, 12, 0, 12, 12, 12,
+    1, 0, 0, 2, 0, 0, 0, 2, 0, 0, 2, 2, 0, 0, 0, 14, 0, 0, 0, 15, 7, 18, 0, 16, 0, 0, 0, 15, 7, 18, 0, 16,
+    0, 0, 2, 15, 0, 0, 2, 15, 0, 0, 2, 16, 0, 0, 2, 16, 6, 8, 8, 12, 6, 9, 8, 13, 6, 8, 12, 12, 6, 9, 8, 17,
+    1, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 14, 0, 2, 0, 15, 0, 2, 0, 16, 0, 2, 0, 15, 0, 2, 0, 16,
+    7, 0, 7, 15, 7, 0, 7, 15, 7, 7, 18, 20, 7, 7, 18, 20, 6, 8, 8, 12, 6, 12, 8, 12, 6, 8, 9, 13, 6, 8, 9, 17,
+    6, 0, 0, 0, 6, 6, 6, 0, 6, 6, 6, 0, 6, 6, 6, 6, 7, 7, 7, 7, 11, 11, 11, 18, 7, 7, 7, 7, 10, 10, 10, 18,
+    7, 7, 7, 7, 7, 7, 7, 7, 11, 11, 11, 18, 10, 10, 10, 18, 6, 8, 8, 8, 6, 9, 8, 8, 6, 8, 10, 9, 6, 10, 10, 6,
+    1, 4, 3, 2, 4, 23, 1, 1, 3, 1, 5, 0, 14, 0, 0, 0, 1, 23, 2, 7, 19, 23, 1, 7, 8, 7, 1, 7, 1, 1, 1, 1,
+    0, 2, 3, 6, 10, 1, 0, 1, 5, 0, 7, 7, 0, 0, 0, 0, 7, 6, 6, 8, 6, 6, 6, 8, 6, 6, 8, 8, 6, 6, 6, 12,
+    1, 19, 0, 1, 19, 19, 0, 20, 12, 0, 0, 0, 12, 16, 16, 16, 11, 11, 7, 11, 11, 18, 11, 18, 7, 11, 7, 11, 18, 20, 18, 20,
+    7, 7, 6, 7, 10, 7, 6, 7, 6, 6, 6, 6, 6, 17, 6, 17, 7, 11, 7, 10, 11, 11, 11, 10, 7, 11, 7, 10, 11, 18, 11, 19,
+    6, 11, 5, 6, 12, 0, 0, 0, 14, 6, 6, 6, 12, 0, 6, 6, 7, 7, 6, 7, 10, 7, 6, 7, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 7, 7, 11, 7, 7, 7, 7, 7, 7, 11, 11, 7, 7, 11, 19, 7, 6, 10, 9, 7, 6, 10, 9, 7, 7, 10, 10, 7, 7, 10, 10,
+    6, 6, 6, 6, 8, 13, 8, 13, 8, 8, 8, 8, 13, 17, 13, 17, 6, 10, 6, 10, 9, 10, 9, 18, 8, 9, 8, 9, 9, 17, 13, 17,
+    6, 6, 6, 6, 8, 8, 8, 8, 8, 8, 9, 9, 8, 12, 9, 12, 6, 10, 6, 6, 9, 10, 9, 11, 8, 8, 11, 7, 8, 8, 8, 6,
+    5, 4, 2, 5, 4, 5, 5, 23, 2, 5, 1, 5, 5, 23, 5, 23, 5, 5, 1, 22, 5, 22, 5, 21, 1, 5, 1, 22, 5, 22, 5, 21,
+    0, 1, 1, 1, 1, 5, 1, 5, 1, 1, 1, 1, 5, 5, 1, 23, 1, 1, 6, 13, 1, 22, 1, 17, 1, 1, 6, 13, 1, 22, 1, 17,
+    5, 5, 1, 5, 5, 22, 5, 22, 1, 5, 1, 5, 22, 21, 22, 21, 1, 19, 1, 19, 19, 19, 19, 19, 1, 19, 1, 19, 19, 19, 19, 19,
+    1, 1, 1, 1, 5, 22, 5, 22, 1, 1, 1, 1, 5, 21, 5, 21, 7, 11, 7, 10, 11, 19, 11, 18, 7, 11, 7, 10, 19, 19, 11, 20,
+    0, 1, 1, 5, 1, 5, 1, 5, 1, 1, 1, 1, 1, 5, 1, 23, 1, 5, 1, 5, 1, 22, 1, 21, 1, 5, 1, 5, 1, 22, 1, 21,
+    7, 1, 7, 7, 1, 1, 7, 1, 7, 7, 7, 7, 7, 1, 7, 7, 6, 6, 8, 8, 6, 6, 8, 13, 6, 6, 8, 8, 6, 6, 8, 12,
+    6, 1, 6, 1, 6, 21, 6, 21, 6, 6, 6, 6, 13, 17, 13, 17, 7, 11, 7, 19, 10, 18, 10, 18, 7, 11, 7, 11, 10, 18, 10, 20,
+    6, 6, 6, 6, 6, 6, 6, 6, 8, 8, 8, 8, 8, 13, 8, 12, 7, 11, 7, 10, 10, 10, 10, 10, 7, 11, 7, 8, 9, 10, 8, 7,
+    0, 3, 3, 2, 4, 5, 0, 0, 3, 0, 5, 1, 2, 0, 0, 0, 0, 3, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+    0, 0, 3, 0, 1, 0, 1, 0, 1, 1, 1, 21, 1, 1, 1, 21, 6, 6, 8, 13, 6, 6, 8, 13, 6, 6, 8, 17, 6, 6, 8, 17,
+    1, 1, 0, 1, 4, 1, 0, 1, 0, 0, 0, 0, 0, 16, 0, 16, 7, 7, 7, 7, 11, 18, 11, 18, 7, 7, 7, 7, 11, 20, 11, 20,
+    0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 6, 6, 6, 8, 7, 11, 6, 9, 6, 6, 6, 8, 7, 11, 6, 9,
+    0, 0, 1, 1, 0, 0, 0, 0, 3, 0, 1, 1, 0, 0, 0, 0, 6, 6, 1, 0, 0, 1, 0, 6, 6, 6, 7, 1, 6, 0, 6, 6,
+    7, 7, 11, 11, 7, 7, 11, 11, 7, 7, 18, 20, 7, 7, 18, 20, 7, 6, 10, 9, 7, 6, 10, 9, 7, 7, 10, 20, 7, 7, 10, 20,
+    6, 6, 6, 6, 8, 8, 8, 8, 6, 6, 6, 6, 13, 17, 13, 17, 6, 7, 6, 7, 9, 10, 9, 10, 6, 6, 6, 6, 9, 17, 9, 17,
+    6, 6, 7, 7, 6, 6, 6, 6, 6, 6, 10, 10, 8, 8, 9, 9, 6, 6, 10, 9, 9, 10, 9, 6, 6, 6, 10, 10, 8, 8, 6, 6,
+    3, 3, 2, 3, 5, 4, 3, 3, 0, 3, 2, 3, 5, 4, 3, 3, 0, 3, 2, 3, 5, 4, 3, 16, 0, 3, 2, 15, 5, 22, 3, 16,
+    0, 2, 2, 2, 0, 3, 2, 3, 0, 2, 2, 15, 0, 3, 2, 14, 0, 2, 2, 14, 0, 3, 2, 15, 0, 2, 14, 14, 0, 3, 2, 16,
+    1, 5, 1, 4, 5, 5, 5, 4, 1, 5, 1, 4, 5, 22, 5, 23, 1, 5, 1, 4, 5, 23, 5, 22, 1, 5, 1, 4, 23, 23, 5, 21,
+    0, 0, 0, 2, 1, 5, 0, 3, 0, 0, 0, 2, 1, 5, 0, 3, 0, 0, 0, 12, 1, 19, 0, 16, 0, 0, 0, 12, 1, 19, 0, 16,
+    0, 3, 0, 3, 1, 4, 0, 3, 0, 3, 0, 3, 1, 4, 0, 3, 0, 3, 0, 3, 1, 4, 0, 16, 0, 3, 0, 3, 1, 4, 0, 16,
+    0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 15, 0, 2, 0, 15, 6, 2, 8, 12, 0, 2, 8, 14, 6, 2, 8, 12, 6, 2, 8, 12,
+    1, 5, 1, 5, 1, 5, 1, 5, 1, 5, 1, 5, 1, 21, 1, 21, 7, 5, 1, 5, 11, 19, 11, 23, 7, 5, 7, 5, 10, 18, 10, 18,
+    6, 0, 7, 0, 6, 1, 6, 0, 6, 6, 7, 7, 6, 6, 6, 6, 6, 6, 6, 8, 7, 11, 6, 9, 6, 6, 8, 8, 10, 10, 6, 6,
+    0, 3, 4, 2, 3, 5, 0, 0, 3, 0, 23, 1, 14, 0, 0, 0, 0, 3, 2, 6, 5, 7, 0, 6, 9, 0, 1, 1, 0, 0, 0, 0,
+    1, 2, 23, 7, 8, 1, 7, 7, 19, 1, 23, 7, 1, 1, 1, 1, 7, 6, 6, 8, 6, 8, 6, 8, 6, 6, 6, 8, 6, 6, 6, 12,
+    0, 5, 11, 0, 14, 6, 6, 6, 12, 0, 0, 0, 14, 6, 0, 0, 6, 7, 7, 11, 7, 11, 7, 11, 7, 7, 7, 7, 7, 11, 7, 19,
+    6, 6, 7, 7, 6, 6, 6, 6, 9, 6, 7, 7, 6, 6, 6, 6, 6, 9, 6, 9, 7, 10, 6, 9, 6, 9, 6, 9, 7, 10, 6, 9,
+    0, 0, 19, 1, 12, 0, 0, 0, 3, 0, 19, 20, 12, 16, 16, 16, 6, 6, 7, 7, 6, 6, 6, 6, 9, 6, 7, 7, 6, 6, 17, 17,
+    7, 7, 11, 11, 7, 7, 11, 11, 11, 11, 18, 18, 18, 18, 20, 20, 7, 7, 11, 10, 7, 7, 11, 10, 11, 11, 11, 10, 11, 11, 18, 19,
+    6, 6, 6, 6, 8, 8, 8, 8, 8, 8, 13, 13, 13, 13, 17, 17, 6, 6, 6, 6, 8, 9, 8, 9, 8, 8, 8, 8, 8, 9, 13, 12,
+    6, 6, 10, 10, 8, 8, 9, 9, 9, 9, 10, 18, 9, 13, 17, 17, 6, 6, 10, 6, 8, 7, 9, 6, 9, 9, 10, 11, 9, 8, 9, 6,
+    0, 3, 3, 2, 4, 5, 0, 0, 3, 0, 5, 1, 2, 0, 0, 0, 0, 3, 0, 0, 1, 1, 0, 16, 0, 0, 0, 0, 1, 1, 0, 16,
+    0, 0, 3, 0, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 6, 8, 6, 13, 6, 8, 6, 17, 6, 8, 6, 13, 6, 8, 6, 17,
+    1, 1, 0, 1, 4, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 7, 11, 7, 11, 7, 18, 7, 20, 7, 11, 7, 11, 7, 18, 7, 20,
+    0, 0, 7, 6, 6, 7, 6, 0, 0, 0, 1, 7, 0, 6, 0, 0, 6, 9, 6, 9, 7, 10, 6, 17, 6, 9, 6, 9, 7, 10, 6, 17,
+    0, 0, 1, 1, 0, 0, 0, 0, 3, 0, 1, 1, 0, 0, 16, 16, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 11, 11, 18, 18, 11, 11, 20, 20, 7, 6, 7, 8, 7, 6, 7, 8, 7, 7, 11, 10, 7, 7, 11, 10,
+    6, 6, 6, 6, 6, 6, 6, 6, 8, 8, 8, 8, 13, 13, 17, 17, 6, 7, 6, 7, 6, 10, 6, 10, 6, 6, 6, 6, 8, 9, 8, 9,
+    6, 6, 7, 7, 6, 6, 6, 6, 9, 9, 10, 10, 9, 9, 17, 17, 6, 9, 7, 8, 6, 10, 6, 6, 9, 9, 10, 7, 9, 6, 9, 6,
+    1, 2, 4, 5, 2, 1, 5, 5, 4, 5, 5, 23, 5, 5, 23, 23, 0, 1, 1, 1, 1, 1, 1, 1, 5, 1, 5, 5, 5, 5, 5, 23,
+    1, 1, 5, 22, 1, 1, 5, 22, 5, 5, 22, 21, 5, 5, 22, 21, 1, 6, 1, 13, 1, 6, 1, 13, 1, 1, 22, 21, 1, 1, 22, 21,
+    0, 1, 1, 5, 1, 1, 1, 1, 1, 1, 5, 5, 1, 1, 5, 23, 1, 7, 1, 1, 7, 7, 1, 7, 1, 1, 1, 1, 1, 7, 1, 1,
+    1, 1, 5, 5, 1, 1, 5, 5, 1, 1, 22, 21, 1, 1, 22, 21, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 13, 6, 8, 6, 13,
+    1, 1, 5, 5, 1, 1, 5, 5, 5, 5, 22, 22, 22, 22, 21, 21, 1, 1, 1, 1, 1, 1, 1, 1, 5, 5, 22, 22, 5, 5, 21, 21,
+    1, 1, 19, 19, 1, 1, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 7, 7, 11, 10, 7, 7, 11, 10, 19, 11, 19, 18, 19, 19, 19, 20,
+    1, 1, 1, 1, 6, 6, 1, 1, 1, 1, 21, 21, 13, 13, 17, 17, 6, 6, 6, 6, 8, 8, 8, 8, 6, 6, 6, 6, 8, 8, 13, 13,
+    7, 7, 11, 19, 7, 7, 11, 11, 10, 10, 18, 18, 10, 10, 18, 20, 7, 7, 11, 10, 7, 7, 11, 9, 10, 10, 10, 10, 10, 9, 10, 11,
+    2, 2, 4, 3, 1, 2, 4, 3, 5, 4, 4, 4, 5, 4, 4, 4, 0, 2, 2, 2, 0, 2, 2, 14, 0, 2, 3, 3, 0, 2, 3, 14,
+    1, 2, 4, 3, 1, 2, 4, 15, 5, 4, 4, 21, 5, 4, 22, 21, 0, 2, 2, 14, 0, 14, 2, 14, 0, 2, 3, 15, 0, 2, 3, 16,
+    1, 0, 4, 3, 1, 0, 4, 3, 1, 1, 4, 4, 1, 1, 4, 4, 0, 0, 2, 2, 0, 0, 2, 15, 0, 0, 2, 2, 0, 0, 2, 14,
+    1, 0, 4, 3, 1, 0, 4, 3, 1, 1, 4, 21, 1, 1, 4, 21, 0, 8, 2, 14, 6, 8, 2, 12, 0, 8, 2, 14, 0, 8, 2, 14,
+    1, 1, 5, 4, 1, 1, 5, 4, 5, 5, 5, 4, 5, 5, 22, 23, 1, 0, 1, 2, 1, 0, 1, 2, 1, 1, 5, 4, 1, 1, 5, 4,
+    1, 1, 5, 4, 1, 1, 5, 4, 23, 5, 23, 22, 23, 23, 23, 21, 1, 0, 1, 12, 1, 0, 1, 12, 1, 1, 19, 20, 1, 1, 19, 20,
+    1, 1, 5, 5, 1, 1, 5, 5, 1, 1, 5, 5, 1, 1, 21, 21, 1, 0, 1, 0, 6, 7, 1, 0, 1, 1, 1, 1, 6, 6, 1, 1,
+    7, 1, 5, 5, 7, 7, 5, 5, 11, 11, 19, 23, 10, 10, 18, 18, 7, 6, 7, 8, 7, 8, 7, 8, 11, 7, 11, 10, 10, 10, 10, 10,
+    0, 4, 4, 0, 3, 2, 2, 2, 3, 2, 2, 2, 2, 14, 14, 14, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 2, 2, 2, 14,
+    1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 2, 2, 14, 0, 6, 6, 6, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 15, 2, 15, 2, 2, 2, 2, 15, 16, 15, 16, 0, 7, 0, 7, 0, 18, 0, 18, 0, 0, 0, 0, 15, 16, 15, 16,
+    0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 15, 16, 15, 16, 7, 11, 7, 11, 7, 11, 7, 11, 7, 11, 7, 11, 7, 18, 7, 18,
+    0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 15, 15, 15, 15, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 15, 15, 16, 16,
+    0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 18, 18, 15, 15, 16, 16, 7, 7, 11, 11, 7, 7, 11, 11, 7, 7, 11, 11, 7, 7, 18, 18,
+    0, 0, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 6, 6, 6, 8, 9, 8, 9, 12, 8, 12, 12, 12, 13, 12, 17,
+    6, 6, 6, 6, 8, 12, 8, 8, 8, 8, 9, 9, 12, 12, 13, 17, 6, 6, 6, 6, 8, 9, 8, 10, 8, 8, 9, 10, 8, 8, 9, 8,
+    4, 4, 0, 4, 3, 4, 3, 4, 2, 3, 2, 3, 3, 3, 3, 3, 1, 5, 1, 5, 4, 4, 4, 22, 1, 5, 1, 5, 4, 4, 4, 23,
+    0, 1, 0, 1, 3, 4, 3, 4, 0, 0, 0, 0, 3, 3, 3, 3, 1, 1, 1, 1, 5, 5, 5, 22, 1, 1, 1, 1, 4, 4, 4, 22,
+    0, 4, 0, 4, 3, 4, 3, 22, 2, 3, 2, 3, 3, 16, 15, 16, 1, 5, 1, 23, 4, 22, 4, 22, 1, 5, 1, 5, 4, 22, 4, 21,
+    0, 1, 0, 1, 3, 4, 3, 4, 0, 0, 0, 0, 3, 16, 3, 16, 1, 11, 7, 11, 5, 23, 5, 19, 1, 11, 1, 11, 4, 22, 4, 22,
+    0, 0, 0, 0, 2, 3, 2, 3, 2, 2, 2, 2, 2, 3, 15, 14, 0, 1, 0, 1, 0, 4, 0, 4, 0, 0, 0, 0, 2, 3, 2, 3,
+    0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 15, 15, 0, 1, 7, 6, 0, 1, 0, 1, 0, 0, 7, 7, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 3, 2, 3, 14, 2, 14, 14, 14, 15, 14, 16, 0, 1, 0, 1, 0, 18, 0, 18, 0, 0, 0, 0, 12, 16, 12, 16,
+    6, 0, 6, 6, 2, 2, 2, 2, 8, 8, 8, 8, 12, 14, 12, 12, 6, 7, 6, 11, 6, 10, 6, 10, 8, 6, 8, 8, 8, 9, 8, 8,
+    0, 0, 4, 4, 2, 2, 3, 3, 3, 3, 4, 4, 3, 3, 3, 3, 0, 0, 1, 1, 0, 0, 0, 0, 3, 3, 4, 4, 3, 3, 3, 3,
+    1, 1, 5, 5, 1, 1, 5, 5, 4, 4, 4, 22, 4, 4, 4, 23, 1, 1, 1, 1, 1, 1, 1, 1, 5, 5, 5, 22, 4, 4, 4, 22,
+    0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 3, 3, 2, 14, 3, 14, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 15, 2, 14,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 4, 4, 2, 2, 3, 3, 0, 6, 1, 6, 0, 7, 0, 6, 0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 4, 4, 2, 2, 3, 3, 3, 3, 4, 22, 3, 15, 16, 16, 0, 0, 1, 1, 0, 0, 0, 0, 3, 3, 4, 4, 3, 3, 16, 16,
+    1, 1, 5, 23, 1, 1, 5, 5, 4, 4, 22, 22, 4, 4, 22, 21, 1, 7, 11, 11, 1, 1, 11, 11, 5, 5, 23, 19, 4, 4, 22, 22,
+    0, 0, 0, 0, 2, 14, 2, 2, 2, 2, 3, 3, 14, 14, 15, 16, 0, 6, 0, 0, 8, 8, 8, 8, 2, 2, 2, 2, 14, 12, 14, 14,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 18, 18, 12, 12, 16, 16, 6, 6, 7, 11, 6, 8, 6, 6, 6, 6, 10, 10, 8, 8, 9, 9,
+    0, 0, 4, 0, 2, 1, 0, 0, 3, 0, 5, 1, 2, 0, 0, 0, 0, 3, 2, 2, 4, 4, 0, 0, 3, 3, 5, 0, 2, 1, 0, 0,
+    1, 2, 4, 3, 1, 1, 4, 2, 4, 4, 4, 4, 2, 0, 5, 1, 0, 2, 2, 2, 0, 3, 2, 2, 0, 2, 4, 3, 0, 4, 4, 0,
+    0, 4, 0, 0, 3, 4, 3, 5, 2, 2, 5, 1, 2, 2, 2, 0, 1, 5, 1, 4, 4, 4, 4, 4, 1, 5, 1, 2, 3, 4, 2, 1,
+    0, 0, 4, 3, 3, 4, 3, 0, 0, 0, 4, 4, 2, 2, 0, 0, 0, 0, 0, 2, 1, 5, 0, 3, 0, 0, 2, 2, 4, 4, 0, 0,
+    0, 0, 4, 0, 2, 1, 3, 0, 3, 3, 4, 5, 3, 2, 3, 0, 0, 3, 1, 2, 0, 4, 0, 0, 3, 3, 4, 1, 3, 0, 3, 0,
+    1, 1, 5, 4, 1, 1, 5, 3, 4, 4, 4, 4, 4, 3, 4, 5, 1, 0, 1, 2, 1, 2, 1, 2, 5, 1, 5, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 2, 3, 2, 4, 2, 2, 3, 4, 2, 2, 3, 2, 0, 1, 0, 5, 0, 4, 0, 4, 2, 0, 2, 2, 2, 3, 2, 2,
+    0, 0, 1, 5, 0, 2, 0, 0, 0, 0, 4, 4, 2, 2, 3, 3, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns NPN canonical forms for 4-variable functions.]
+
+  Description [Allocates the tables in the same form as they are returned
+  by Extra_Truth4VarNPNCompute(). The tables not requested are skipped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_Truth4VarNPN( unsigned short ** puCanons, char ** puPhases, char ** puPerms, unsigned char ** puMap )
+{
+    int i, nFuncs = (1 << 16);
+    if ( puCanons )
+    {
+        *puCanons = ABC_ALLOC( unsigned short, nFuncs );
+        for ( i = 0; i < nFuncs; i++ )
+            (*puCanons)[i] = s_Npn4Classes[s_Npn4Map[i]];
+        // complements of the representatives are not mapped
+        for ( i = 1; i < (int)(sizeof(s_Npn4Classes)/sizeof(s_Npn4Classes[0])); i++ )
+            (*puCanons)[0xFFFF & ~s_Npn4Classes[i]] = s_Npn4Classes[i];
+    }
+    if ( puPhases )
+    {
+        *puPhases = ABC_ALLOC( char, nFuncs );
+        memcpy( *puPhases, s_Npn4Phases, sizeof(char) * nFuncs );
+    }
+    if ( puPerms )
+    {
+        *puPerms = ABC_ALLOC( char, nFuncs );
+        memcpy( *puPerms, s_Npn4Perms, sizeof(char) * nFuncs );
+    }
+    if ( puMap )
+    {
+        *puMap = ABC_ALLOC( unsigned char, nFuncs );
+        memcpy( *puMap, s_Npn4Map, sizeof(unsigned char) * nFuncs );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,395 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Bit-parallel simulation kernels.]
+
+  Synopsis    [Runtime-dispatched AVX2/AVX-512 kernels with scalar fallback.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    [$Id: utilSimd.c,v 1.00 2026/10/16 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "utilSimd.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+// the vector kernels are compiled for x86 with GCC/Clang using function-level
+// target attributes, so that the rest of the code is compiled for the default target
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && !defined(ABC_NO_SIMD)
+#define ABC_USE_SIMD_X86
+#include <immintrin.h>
+#define ABC_TARGET_AVX2    __attribute__((target("avx2")))
+#define ABC_TARGET_AVX512  __attribute__((target("avx512f")))
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+static int s_SimdLevel    = -1;   // the level used by the kernels
+static int s_SimdLevelMax = -1;   // the level detected at the start
+
+#ifdef ABC_USE_PTHREADS
+static pthread_once_t s_SimdOnce = PTHREAD_ONCE_INIT;
+#endif
+
+static unsigned s_SimdPrimes[16] = {
+    1291, 1699, 1999, 2357, 2953, 3313, 3907, 4177,
+    4831, 5147, 5647, 6343, 6899, 7103, 7873, 8147 };
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Detects the instruction set supported by the CPU.]
+
+  Description [The detection is performed once, by Abc_SimdStart() called 
+  when the ABC frame is created, or by the first call to Abc_SimdLevel() 
+  if ABC is used without the frame. With pthreads, the detection is guarded
+  by pthread_once(), so that the worker threads calling the kernels do not 
+  race with it. The level can be lowered by Abc_SimdSetLevel() or by 
+  setting ABC_SIMD_LEVEL in the environment.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SimdDetect()
+{
+    int Level = ABC_SIMD_NONE;
+    char * pEnv = getenv( "ABC_SIMD_LEVEL" );
+#ifdef ABC_USE_SIMD_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx2") )
+        Level = ABC_SIMD_AVX2;
+    if ( __builtin_cpu_supports("avx512f") )
+        Level = ABC_SIMD_AVX512;
+#endif
+    if ( pEnv && atoi(pEnv) >= 0 && atoi(pEnv) < Level )
+        Level = atoi(pEnv);
+    return Level;
+}
+static void Abc_SimdDetectOnce()
+{
+    s_SimdLevelMax = Abc_SimdDetect();
+    s_SimdLevel    = s_SimdLevelMax;
+}
+void Abc_SimdStart()
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_once( &s_SimdOnce, Abc_SimdDetectOnce );
+#else
+    if ( s_SimdLevelMax == -1 )
+        Abc_SimdDetectOnce();
+#endif
+}
+int Abc_SimdLevel()
+{
+    Abc_SimdStart();
+    return s_SimdLevel;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the instruction set used by the kernels.]
+
+  Description [The level cannot exceed the detected one. Returns the
+  previous level. Should not be called while other threads simulate.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SimdSetLevel( int Level )
+{
+    int LevelOld = Abc_SimdLevel();
+    s_SimdLevel = Abc_MaxInt( ABC_SIMD_NONE, Abc_MinInt(Level, s_SimdLevelMax) );
+    return LevelOld;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Scalar kernels.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SimdAndScalar( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+static void Abc_SimdXorScalar( word * pOut, word * pIn0, word * pIn1, word Diff, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = pIn0[w] ^ pIn1[w] ^ Diff;
+}
+static int Abc_SimdEqualScalar( word * pIn0, word * pIn1, word Diff, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( pIn0[w] != (pIn1[w] ^ Diff) )
+            return 0;
+    return 1;
+}
+static unsigned Abc_SimdHashScalar( unsigned * pInU, unsigned uDiff, int nUnsigns, int iStart )
+{
+    unsigned uHash = 0; int i;
+    for ( i = iStart; i < nUnsigns; i++ )
+        uHash ^= (pInU[i] ^ uDiff) * s_SimdPrimes[i & 0xf];
+    return uHash;
+}
+
+#ifdef ABC_USE_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 kernels.]
+
+  Description [Process 4 words at a time. The remaining words are
+  processed by the scalar kernels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+ABC_TARGET_AVX2 static void Abc_SimdAndAvx2( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    __m256i Mask0 = _mm256_set1_epi64x( (long long)Diff0 );
+    __m256i Mask1 = _mm256_set1_epi64x( (long long)Diff1 );
+    int w, nVecs = nWords & ~3;
+    for ( w = 0; w < nVecs; w += 4 )
+    {
+        __m256i Sim0 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn0 + w)), Mask0 );
+        __m256i Sim1 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn1 + w)), Mask1 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_and_si256(Sim0, Sim1) );
+    }
+    Abc_SimdAndScalar( pOut + nVecs, pIn0 + nVecs, pIn1 + nVecs, Diff0, Diff1, nWords - nVecs );
+}
+ABC_TARGET_AVX2 static void Abc_SimdXorAvx2( word * pOut, word * pIn0, word * pIn1, word Diff, int nWords )
+{
+    __m256i Mask = _mm256_set1_epi64x( (long long)Diff );
+    int w, nVecs = nWords & ~3;
+    for ( w = 0; w < nVecs; w += 4 )
+    {
+        __m256i Sim = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn0 + w)), _mm256_loadu_si256((__m256i *)(pIn1 + w)) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(Sim, Mask) );
+    }
+    Abc_SimdXorScalar( pOut + nVecs, pIn0 + nVecs, pIn1 + nVecs, Diff, nWords - nVecs );
+}
+ABC_TARGET_AVX2 static int Abc_SimdEqualAvx2( word * pIn0, word * pIn1, word Diff, int nWords )
+{
+    __m256i Mask = _mm256_set1_epi64x( (long long)Diff );
+    int w, nVecs = nWords & ~3;
+    for ( w = 0; w < nVecs; w += 4 )
+    {
+        __m256i Sim = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn0 + w)), _mm256_loadu_si256((__m256i *)(pIn1 + w)) );
+        Sim = _mm256_xor_si256( Sim, Mask );
+        if ( !_mm256_testz_si256(Sim, Sim) )
+            return 0;
+    }
+    return Abc_SimdEqualScalar( pIn0 + nVecs, pIn1 + nVecs, Diff, nWords - nVecs );
+}
+ABC_TARGET_AVX2 static unsigned Abc_SimdHashAvx2( word * pIn, word Diff, int nWords )
+{
+    unsigned * pInU = (unsigned *)pIn, Res[8];
+    __m256i Mask    = _mm256_set1_epi64x( (long long)Diff );
+    __m256i Primes0 = _mm256_loadu_si256( (__m256i *)s_SimdPrimes );
+    __m256i Primes1 = _mm256_loadu_si256( (__m256i *)(s_SimdPrimes + 8) );
+    __m256i Hash    = _mm256_setzero_si256();
+    int i, nUnsigns = 2 * nWords, nVecs = nUnsigns & ~15;
+    for ( i = 0; i < nVecs; i += 16 )
+    {
+        __m256i Sim0 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pInU + i)), Mask );
+        __m256i Sim1 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pInU + i + 8)), Mask );
+        Hash = _mm256_xor_si256( Hash, _mm256_mullo_epi32(Sim0, Primes0) );
+        Hash = _mm256_xor_si256( Hash, _mm256_mullo_epi32(Sim1, Primes1) );
+    }
+    _mm256_storeu_si256( (__m256i *)Res, Hash );
+    return Res[0] ^ Res[1] ^ Res[2] ^ Res[3] ^ Res[4] ^ Res[5] ^ Res[6] ^ Res[7] ^
+        Abc_SimdHashScalar( pInU, (unsigned)Diff, nUnsigns, nVecs );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX-512 kernels.]
+
+  Description [Process 8 words at a time. The remaining words are
+  processed by the AVX2 kernels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+ABC_TARGET_AVX512 static void Abc_SimdAndAvx512( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    __m512i Mask0 = _mm512_set1_epi64( (long long)Diff0 );
+    __m512i Mask1 = _mm512_set1_epi64( (long long)Diff1 );
+    int w, nVecs = nWords & ~7;
+    for ( w = 0; w < nVecs; w += 8 )
+    {
+        __m512i Sim0 = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn0 + w)), Mask0 );
+        __m512i Sim1 = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn1 + w)), Mask1 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_and_si512(Sim0, Sim1) );
+    }
+    Abc_SimdAndAvx2( pOut + nVecs, pIn0 + nVecs, pIn1 + nVecs, Diff0, Diff1, nWords - nVecs );
+}
+ABC_TARGET_AVX512 static void Abc_SimdXorAvx512( word * pOut, word * pIn0, word * pIn1, word Diff, int nWords )
+{
+    __m512i Mask = _mm512_set1_epi64( (long long)Diff );
+    int w, nVecs = nWords & ~7;
+    for ( w = 0; w < nVecs; w += 8 )
+    {
+        __m512i Sim = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn0 + w)), _mm512_loadu_si512((void *)(pIn1 + w)) );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(Sim, Mask) );
+    }
+    Abc_SimdXorAvx2( pOut + nVecs, pIn0 + nVecs, pIn1 + nVecs, Diff, nWords - nVecs );
+}
+ABC_TARGET_AVX512 static int Abc_SimdEqualAvx512( word * pIn0, word * pIn1, word Diff, int nWords )
+{
+    __m512i Mask = _mm512_set1_epi64( (long long)Diff );
+    int w, nVecs = nWords & ~7;
+    for ( w = 0; w < nVecs; w += 8 )
+    {
+        __m512i Sim1 = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn1 + w)), Mask );
+        if ( _mm512_cmpneq_epi64_mask(_mm512_loadu_si512((void *)(pIn0 + w)), Sim1) )
+            return 0;
+    }
+    return Abc_SimdEqualAvx2( pIn0 + nVecs, pIn1 + nVecs, Diff, nWords - nVecs );
+}
+ABC_TARGET_AVX512 static unsigned Abc_SimdHashAvx512( word * pIn, word Diff, int nWords )
+{
+    unsigned * pInU = (unsigned *)pIn, Res[16];
+    __m512i Mask    = _mm512_set1_epi64( (long long)Diff );
+    __m512i Primes  = _mm512_loadu_si512( (void *)s_SimdPrimes );
+    __m512i Hash    = _mm512_setzero_si512();
+    int i, nUnsigns = 2 * nWords, nVecs = nUnsigns & ~15;
+    for ( i = 0; i < nVecs; i += 16 )
+    {
+        __m512i Sim = _mm512_xor_si512( _mm512_loadu_si512((void *)(pInU + i)), Mask );
+        Hash = _mm512_xor_si512( Hash, _mm512_mullo_epi32(Sim, Primes) );
+    }
+    _mm512_storeu_si512( (void *)Res, Hash );
+    for ( i = 1; i < 16; i++ )
+        Res[0] ^= Res[i];
+    return Res[0] ^ Abc_SimdHashScalar( pInU, (unsigned)Diff, nUnsigns, nVecs );
+}
+
+#endif // ABC_USE_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [Dispatching the kernels.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SimdAndInt( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords )
+{
+    word Diff0 = fCompl0 ? ~(word)0 : 0;
+    word Diff1 = fCompl1 ? ~(word)0 : 0;
+#ifdef ABC_USE_SIMD_X86
+    int Level = Abc_SimdLevel();
+    if ( Level == ABC_SIMD_AVX512 )
+        Abc_SimdAndAvx512( pOut, pIn0, pIn1, Diff0, Diff1, nWords );
+    else if ( Level == ABC_SIMD_AVX2 )
+        Abc_SimdAndAvx2( pOut, pIn0, pIn1, Diff0, Diff1, nWords );
+    else
+#endif
+        Abc_SimdAndScalar( pOut, pIn0, pIn1, Diff0, Diff1, nWords );
+}
+void Abc_SimdXorInt( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    word Diff = fCompl ? ~(word)0 : 0;
+#ifdef ABC_USE_SIMD_X86
+    int Level = Abc_SimdLevel();
+    if ( Level == ABC_SIMD_AVX512 )
+        Abc_SimdXorAvx512( pOut, pIn0, pIn1, Diff, nWords );
+    else if ( Level == ABC_SIMD_AVX2 )
+        Abc_SimdXorAvx2( pOut, pIn0, pIn1, Diff, nWords );
+    else
+#endif
+        Abc_SimdXorScalar( pOut, pIn0, pIn1, Diff, nWords );
+}
+void Abc_SimdCopyInt( word * pOut, word * pIn, int fCompl, int nWords )
+{
+    // complementing is AND-ing two copies of the input with both complemented
+    if ( !fCompl )
+    {
+        if ( pOut != pIn )
+            memmove( pOut, pIn, sizeof(word) * nWords );
+    }
+    else
+        Abc_SimdAndInt( pOut, pIn, pIn, 1, 1, nWords );
+}
+int Abc_SimdEqualInt( word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    word Diff = fCompl ? ~(word)0 : 0;
+#ifdef ABC_USE_SIMD_X86
+    int Level = Abc_SimdLevel();
+    if ( Level == ABC_SIMD_AVX512 )
+        return Abc_SimdEqualAvx512( pIn0, pIn1, Diff, nWords );
+    if ( Level == ABC_SIMD_AVX2 )
+        return Abc_SimdEqualAvx2( pIn0, pIn1, Diff, nWords );
+#endif
+    return Abc_SimdEqualScalar( pIn0, pIn1, Diff, nWords );
+}
+unsigned Abc_SimdHashInt( word * pIn, int fCompl, int nWords )
+{
+    word Diff = fCompl ? ~(word)0 : 0;
+#ifdef ABC_USE_SIMD_X86
+    int Level = Abc_SimdLevel();
+    if ( Level == ABC_SIMD_AVX512 )
+        return Abc_SimdHashAvx512( pIn, Diff, nWords );
+    if ( Level == ABC_SIMD_AVX2 )
+        return Abc_SimdHashAvx2( pIn, Diff, nWords );
+#endif
+    return Abc_SimdHashScalar( (unsigned *)pIn, (unsigned)Diff, 2 * nWords, 0 );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
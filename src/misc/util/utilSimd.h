@@ -0,0 +1,164 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Bit-parallel simulation kernels.]
+
+  Synopsis    [Runtime-dispatched AVX2/AVX-512 kernels with scalar fallback.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    [$Id: utilSimd.h,v 1.00 2026/10/16 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilSimd_h
+#define ABC__misc__util__utilSimd_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/util/abc_global.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// the smallest number of words, for which the vector kernels are called
+// (one AVX2 vector, which is the default simulation info size of &fraig -y)
+#define ABC_SIMD_WORDS_MIN  4
+
+// the instruction sets detected at runtime
+#define ABC_SIMD_NONE       0
+#define ABC_SIMD_AVX2       1
+#define ABC_SIMD_AVX512     2
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilSimd.c ==========================================================*/
+extern void          Abc_SimdStart();
+extern int           Abc_SimdLevel();
+extern int           Abc_SimdSetLevel( int Level );
+extern void          Abc_SimdAndInt( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords );
+extern void          Abc_SimdXorInt( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords );
+extern void          Abc_SimdCopyInt( word * pOut, word * pIn, int fCompl, int nWords );
+extern int           Abc_SimdEqualInt( word * pIn0, word * pIn1, int fCompl, int nWords );
+extern unsigned      Abc_SimdHashInt( word * pIn, int fCompl, int nWords );
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Simulation of AND, XOR, and buffer/inverter.]
+
+  Description [Short simulation info is processed inline, because
+  the call overhead exceeds the gain from the vector instructions.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_SimdAnd( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords )
+{
+    word Diff0 = fCompl0 ? ~(word)0 : 0;
+    word Diff1 = fCompl1 ? ~(word)0 : 0; int w;
+    if ( nWords >= ABC_SIMD_WORDS_MIN )
+    {
+        Abc_SimdAndInt( pOut, pIn0, pIn1, fCompl0, fCompl1, nWords );
+        return;
+    }
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+static inline void Abc_SimdXor( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    word Diff = fCompl ? ~(word)0 : 0; int w;
+    if ( nWords >= ABC_SIMD_WORDS_MIN )
+    {
+        Abc_SimdXorInt( pOut, pIn0, pIn1, fCompl, nWords );
+        return;
+    }
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = pIn0[w] ^ pIn1[w] ^ Diff;
+}
+static inline void Abc_SimdCopy( word * pOut, word * pIn, int fCompl, int nWords )
+{
+    word Diff = fCompl ? ~(word)0 : 0; int w;
+    if ( nWords >= ABC_SIMD_WORDS_MIN )
+    {
+        Abc_SimdCopyInt( pOut, pIn, fCompl, nWords );
+        return;
+    }
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = pIn[w] ^ Diff;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks equality of simulation info, possibly complemented.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_SimdEqual( word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    word Diff = fCompl ? ~(word)0 : 0; int w;
+    if ( nWords >= ABC_SIMD_WORDS_MIN )
+        return Abc_SimdEqualInt( pIn0, pIn1, fCompl, nWords );
+    for ( w = 0; w < nWords; w++ )
+        if ( pIn0[w] != (pIn1[w] ^ Diff) )
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Hashes simulation info, possibly complemented.]
+
+  Description [The result is the XOR of 32-bit halves of words multiplied
+  by one of 16 primes depending on the position of the half.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Abc_SimdHash( word * pIn, int fCompl, int nWords )
+{
+    static unsigned s_Primes[16] = {
+        1291, 1699, 1999, 2357, 2953, 3313, 3907, 4177,
+        4831, 5147, 5647, 6343, 6899, 7103, 7873, 8147 };
+    unsigned uHash = 0, uDiff = fCompl ? ~0u : 0, * pInU = (unsigned *)pIn;
+    int i;
+    if ( nWords >= ABC_SIMD_WORDS_MIN )
+        return Abc_SimdHashInt( pIn, fCompl, nWords );
+    for ( i = 0; i < 2 * nWords; i++ )
+        uHash ^= (pInU[i] ^ uDiff) * s_Primes[i & 0xf];
+    return uHash;
+}
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
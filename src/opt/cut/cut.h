@@ -71,6 +71,7 @@ struct Cut_ParamsStruct_t_
     int                fMap;              // computes delay of FPGA mapping with cuts
     int                fAdjust;           // removed useless fanouts of XORs/MUXes
     int                fNpnSave;          // enables dumping 6-input truth tables
+    int                fIncremental;      // records computation stamps for reusing cuts
     int                fVerbose;          // the verbosiness flag
 };
 
@@ -116,6 +117,8 @@ extern void             Cut_NodeWriteCutsTemp( Cut_Man_t * p, int Node, Cut_Cut_
 extern void             Cut_NodeSetTriv( Cut_Man_t * p, int Node );
 extern void             Cut_NodeTryDroppingCuts( Cut_Man_t * p, int Node );
 extern void             Cut_NodeFreeCuts( Cut_Man_t * p, int Node );
+extern int              Cut_NodeIsCurrent( Cut_Man_t * p, int Node, int Node0, int Node1, int fCompl0, int fCompl1 );
+extern void             Cut_ManRemapNodes( Cut_Man_t * p, Vec_Int_t * vMap );
 /*=== cutCut.c ==========================================================*/
 extern void             Cut_CutPrint( Cut_Cut_t * pCut, int fSeq );
 extern void             Cut_CutPrintList( Cut_Cut_t * pList, int fSeq );
@@ -146,6 +146,8 @@ void Cut_NodeSetTriv( Cut_Man_t * p, int Node )
 {
     assert( Cut_NodeReadCutsNew(p, Node) == NULL );
     Cut_NodeWriteCutsNew( p, Node, Cut_CutCreateTriv(p, Node) );
+    if ( p->vNodeStamps )
+        Vec_IntSetEntry( p->vNodeStamps, Node, ++p->nStamps );
 }
 
 /**Function*************************************************************
@@ -192,6 +194,145 @@ void Cut_NodeFreeCuts( Cut_Man_t * p, int Node )
     Cut_NodeWriteCutsNew( p, Node, NULL );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the cuts of the node can be reused.]
+
+  Description [Works only when the computation stamps are recorded. 
+  The cuts are current if they were computed from the given fanins,
+  and the fanins still have the cuts that were computed before those
+  of the node. The caller is expected to visit the nodes in the
+  topological order and free the cuts that are not current, which
+  invalidates the transitive fanout of the modified nodes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cut_NodeIsCurrent( Cut_Man_t * p, int Node, int Node0, int Node1, int fCompl0, int fCompl1 )
+{
+    int Stamp, Lit0, Lit1;
+    assert( p->vNodeStamps != NULL );
+    if ( Cut_NodeReadCutsNew(p, Node) == NULL )
+        return 0;
+    if ( Cut_NodeReadCutsNew(p, Node0) == NULL || Cut_NodeReadCutsNew(p, Node1) == NULL )
+        return 0;
+    if ( 2 * Node + 1 >= Vec_IntSize(p->vNodeFanins) )
+        return 0;
+    Lit0 = Vec_IntEntry( p->vNodeFanins, 2 * Node + 0 );
+    Lit1 = Vec_IntEntry( p->vNodeFanins, 2 * Node + 1 );
+    // the fanins may have been reordered when the IDs changed
+    if ( !(Lit0 == Abc_Var2Lit(Node0, fCompl0) && Lit1 == Abc_Var2Lit(Node1, fCompl1)) && 
+         !(Lit0 == Abc_Var2Lit(Node1, fCompl1) && Lit1 == Abc_Var2Lit(Node0, fCompl0)) )
+        return 0;
+    Stamp = Vec_IntEntry( p->vNodeStamps, Node );
+    return Vec_IntEntry(p->vNodeStamps, Node0) < Stamp && Vec_IntEntry(p->vNodeStamps, Node1) < Stamp;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Renumbers the nodes after their IDs have changed.]
+
+  Description [The array maps each old node ID into the new one, or into 
+  -1 if the node no longer exists. The cuts of the removed nodes and the 
+  cuts depending on them are dropped. The leaves of the remaining cuts 
+  are renumbered and sorted, and their truth tables are permuted.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cut_ManRemapNodes( Cut_Man_t * p, Vec_Int_t * vMap )
+{
+    Vec_Ptr_t * vCutsNew;
+    Vec_Int_t * vStamps = NULL, * vFanins = NULL;
+    Cut_Cut_t * pList, * pCut, * pCut2;
+    unsigned * pTruth;
+    int i, k, Temp, iNew, nIdsMax = 0, fChange;
+    assert( p->vCutsOld == NULL );
+    Vec_IntForEachEntry( vMap, iNew, i )
+        nIdsMax = Abc_MaxInt( nIdsMax, iNew + 1 );
+    vCutsNew = Vec_PtrStart( nIdsMax );
+    if ( p->vNodeStamps )
+    {
+        vStamps = Vec_IntStart( nIdsMax );
+        vFanins = Vec_IntStartFull( 2 * nIdsMax );
+    }
+    Vec_PtrForEachEntry( Cut_Cut_t *, p->vCutsNew, pList, i )
+    {
+        if ( pList == NULL )
+            continue;
+        iNew = i < Vec_IntSize(vMap) ? Vec_IntEntry(vMap, i) : -1;
+        // drop the cuts of the removed nodes and of the nodes depending on them
+        Cut_ListForEachCut( pList, pCut )
+        {
+            for ( k = 0; k < (int)pCut->nLeaves; k++ )
+                if ( pCut->pLeaves[k] >= Vec_IntSize(vMap) || Vec_IntEntry(vMap, pCut->pLeaves[k]) == -1 )
+                    break;
+            if ( k < (int)pCut->nLeaves )
+                break;
+        }
+        if ( iNew == -1 || pCut != NULL )
+        {
+            Cut_ListForEachCutSafe( pList, pCut, pCut2 )
+                Cut_CutRecycle( p, pCut );
+            continue;
+        }
+        // renumber the leaves of each cut
+        Cut_ListForEachCut( pList, pCut )
+        {
+            pCut->uSign = 0;
+            for ( k = 0; k < (int)pCut->nLeaves; k++ )
+            {
+                pCut->pLeaves[k] = Vec_IntEntry( vMap, pCut->pLeaves[k] );
+                pCut->uSign |= Cut_NodeSign( pCut->pLeaves[k] );
+            }
+            // restore the order of leaves while permuting the variables of the truth table
+            do {
+                fChange = 0;
+                for ( k = 0; k < (int)pCut->nLeaves - 1; k++ )
+                {
+                    if ( pCut->pLeaves[k] < pCut->pLeaves[k+1] )
+                        continue;
+                    Temp = pCut->pLeaves[k];
+                    pCut->pLeaves[k] = pCut->pLeaves[k+1];
+                    pCut->pLeaves[k+1] = Temp;
+                    if ( p->pParams->fTruth )
+                    {
+                        pTruth = Cut_CutReadTruth( pCut );
+                        Extra_TruthSwapAdjacentVars( p->puTemp[0], pTruth, pCut->nVarsMax, k );
+                        Extra_TruthCopy( pTruth, p->puTemp[0], pCut->nVarsMax );
+                    }
+                    fChange = 1;
+                }
+            } while ( fChange );
+        }
+        Vec_PtrWriteEntry( vCutsNew, iNew, pList );
+        if ( vStamps == NULL )
+            continue;
+        Vec_IntWriteEntry( vStamps, iNew, Vec_IntEntry(p->vNodeStamps, i) );
+        if ( 2 * i + 1 >= Vec_IntSize(p->vNodeFanins) )
+            continue;
+        for ( k = 0; k < 2; k++ )
+        {
+            Temp = Vec_IntEntry( p->vNodeFanins, 2 * i + k );
+            if ( Temp == -1 || Abc_Lit2Var(Temp) >= Vec_IntSize(vMap) || Vec_IntEntry(vMap, Abc_Lit2Var(Temp)) == -1 )
+                continue;
+            Vec_IntWriteEntry( vFanins, 2 * iNew + k, Abc_Var2Lit(Vec_IntEntry(vMap, Abc_Lit2Var(Temp)), Abc_LitIsCompl(Temp)) );
+        }
+    }
+    Vec_PtrFree( p->vCutsNew );
+    p->vCutsNew = vCutsNew;
+    if ( vStamps == NULL )
+        return;
+    Vec_IntFree( p->vNodeStamps );
+    Vec_IntFree( p->vNodeFanins );
+    p->vNodeStamps = vStamps;
+    p->vNodeFanins = vFanins;
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
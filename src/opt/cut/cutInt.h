@@ -75,6 +75,10 @@ struct Cut_ManStruct_t_
     Vec_Int_t *        vNodeCuts;        // the number of cuts for each node
     Vec_Int_t *        vNodeStarts;      // the number of the starting cut of each node
     Vec_Int_t *        vCutPairs;        // the pairs of parent cuts for each cut
+    // record for incremental reuse of the cuts
+    Vec_Int_t *        vNodeStamps;      // the computation stamp of each node
+    Vec_Int_t *        vNodeFanins;      // the fanin literals of each node at computation
+    int                nStamps;          // the last stamp used
     // minimum delay mapping with the given cuts
     Vec_Ptr_t *        vCutsMax;
     Vec_Int_t *        vDelays;
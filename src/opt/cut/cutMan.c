@@ -97,6 +97,12 @@ Cut_Man_t * Cut_ManStart( Cut_Params_t * pParams )
         p->vNodeStarts = Vec_IntStart( pParams->nIdsMax );
         p->vCutPairs   = Vec_IntAlloc( 0 );
     }
+    // enable recording for incremental reuse
+    if ( pParams->fIncremental )
+    {
+        p->vNodeStamps = Vec_IntStart( pParams->nIdsMax );
+        p->vNodeFanins = Vec_IntStartFull( 2 * pParams->nIdsMax );
+    }
     // allocate storage for delays
     if ( pParams->fMap && !p->pParams->fSeq )
     {
@@ -135,6 +141,8 @@ void Cut_ManStop( Cut_Man_t * p )
     if ( p->vNodeCuts )   Vec_IntFree( p->vNodeCuts );
     if ( p->vNodeStarts ) Vec_IntFree( p->vNodeStarts );
     if ( p->vCutPairs )   Vec_IntFree( p->vCutPairs );
+    if ( p->vNodeStamps ) Vec_IntFree( p->vNodeStamps );
+    if ( p->vNodeFanins ) Vec_IntFree( p->vNodeFanins );
     if ( p->puTemp[0] )   ABC_FREE( p->puTemp[0] );
 
     Extra_MmFixedStop( p->pMmCuts );
@@ -413,6 +413,14 @@ p->timeMerge += Abc_Clock() - clk;
 //    pList->pNext = NULL;
     /////
     Cut_NodeWriteCutsNew( p, Node, pList );
+    // remember when and from which fanins the cuts were computed
+    if ( p->vNodeStamps )
+    {
+        Vec_IntSetEntry( p->vNodeStamps, Node, ++p->nStamps );
+        Vec_IntFillExtra( p->vNodeFanins, 2 * Node + 2, -1 );
+        Vec_IntWriteEntry( p->vNodeFanins, 2 * Node + 0, Abc_Var2Lit(Node0, fCompl0) );
+        Vec_IntWriteEntry( p->vNodeFanins, 2 * Node + 1, Abc_Var2Lit(Node1, fCompl1) );
+    }
     // filter the cuts
 //clk = Abc_Clock();
 //    if ( p->pParams->fFilter )
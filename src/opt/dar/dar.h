@@ -30,6 +30,8 @@
 ///                         PARAMETERS                               ///
 ////////////////////////////////////////////////////////////////////////
 
+// the min number of nodes in a window for concurrent rewriting
+#define DAR_PAR_WIN_MIN  5000
 
 
 ABC_NAMESPACE_HEADER_START
@@ -52,6 +54,8 @@ struct Dar_RwrPar_t_
     int              fUseZeros;      // performs zero-cost replacement
     int              fPower;         // enables power-aware rewriting
     int              fRecycle;       // enables cut recycling
+    int              nProcs;         // the number of concurrent threads
+    int              nWinSize;       // the max number of nodes in a window
     int              fVerbose;       // enables verbose output
     int              fVeryVerbose;   // enables very verbose output
 };
@@ -93,6 +97,9 @@ extern void            Dar_BalancePrintStats( Aig_Man_t * p );
 extern void            Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars );
 extern int             Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars );
 extern Aig_MmFixed_t * Dar_ManComputeCuts( Aig_Man_t * pAig, int nCutsMax, int fSkipTtMin, int fVerbose );
+/*=== darPar.c ========================================================*/
+extern Aig_Man_t *     Dar_ManRewritePar( Aig_Man_t * pAig, Dar_RwrPar_t * pPars );
+extern Aig_Man_t *     Dar_ManCompress2Par( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int nSuppMax, int nProcs, int fVerbose );
 /*=== darRefact.c ========================================================*/
 extern void            Dar_ManDefaultRefParams( Dar_RefPar_t * pPars );
 extern int             Dar_ManRefactor( Aig_Man_t * pAig, Dar_RefPar_t * pPars );
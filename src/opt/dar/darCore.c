@@ -59,6 +59,8 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
     pPars->fUseZeros    =  0;
     pPars->fPower       =  0;
     pPars->fRecycle     =  1;
+    pPars->nProcs       =  1;
+    pPars->nWinSize     =  10000;
     pPars->fVerbose     =  0;
     pPars->fVeryVerbose =  0;
 }
@@ -100,7 +102,7 @@ int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
     // if updating levels is requested, start fanout and timing
     if ( p->pPars->fFanout )
         Aig_ManFanoutStart( pAig );
-    if ( p->pPars->fUpdateLevel )
+    if ( p->pPars->fUpdateLevel && pAig->vLevelR == NULL )
         Aig_ManStartReverseLevels( pAig, 0 );
     // set elementary cuts for the PIs
 //    Dar_ManCutsStart( p );
@@ -144,6 +144,8 @@ extern Vec_Int_t *     Dar_LibReadPrios();
 /*=== darLib.c ============================================================*/
 extern void            Dar_LibStart();
 extern void            Dar_LibStop();
+extern void            Dar_LibThreadStart();
+extern void            Dar_LibThreadStop();
 extern void            Dar_LibReturnCanonicals( unsigned * pCanons );
 extern void            Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Required, int * pnMffcSize );
 extern Aig_Obj_t *     Dar_LibBuildBest( Dar_Man_t * p );
@@ -107,7 +107,18 @@ struct Dar_Lib_t_ // library
 
 static Dar_Lib_t * s_DarLib = NULL;
 
-static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
+// the copy of library objects and their data private to a thread
+// (the objects are renumbered and the data is updated during evaluation)
+#ifdef _MSC_VER
+static __declspec(thread) Dar_LibObj_t * s_DarObjs  = NULL;
+static __declspec(thread) Dar_LibDat_t * s_DarDatas = NULL;
+#else
+static __thread Dar_LibObj_t * s_DarObjs  = NULL;
+static __thread Dar_LibDat_t * s_DarDatas = NULL;
+#endif
+
+static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return (s_DarObjs ? s_DarObjs : p->pObjs) + Id; }
+static inline Dar_LibDat_t * Dar_LibDatas()                        { return s_DarDatas ? s_DarDatas : s_DarLib->pDatas; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
 
 ////////////////////////////////////////////////////////////////////////
@@ -543,6 +554,7 @@ void Dar_LibPrepare( int nSubgraphs )
     // realloc the datas
     Dar_LibCreateData( p, p->nNodes0Max + 32 ); 
     // allocated more because Dar_LibBuildBest() sometimes requires more entries
+    p->nSubgraphs = nSubgraphs;
 }
 
 /**Function*************************************************************
@@ -619,6 +631,33 @@ void Dar_LibStop()
     s_DarLib = NULL;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the library data private to the current thread.]
+
+  Description [Should be called by each thread, which rewrites its own AIG
+  concurrently with other threads, after the library is prepared by the
+  main thread with the same number of subgraphs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_LibThreadStart()
+{
+    assert( s_DarLib != NULL && s_DarLib->nSubgraphs > 0 );
+    assert( s_DarObjs == NULL && s_DarDatas == NULL );
+    s_DarObjs  = ABC_ALLOC( Dar_LibObj_t, s_DarLib->nObjs );
+    memcpy( s_DarObjs, s_DarLib->pObjs, sizeof(Dar_LibObj_t) * s_DarLib->nObjs );
+    s_DarDatas = ABC_CALLOC( Dar_LibDat_t, s_DarLib->nDatas );
+}
+void Dar_LibThreadStop()
+{
+    ABC_FREE( s_DarObjs );
+    ABC_FREE( s_DarDatas );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Updates the score of the class and adjusts the priority of this class.]
@@ -723,13 +762,13 @@ int Dar_LibCutMatch( Dar_Man_t * p, Dar_Cut_t * pCut )
             return 0;
         }
         pFanin = Aig_NotCond(pFanin, ((uPhase >> i) & 1) );
-        s_DarLib->pDatas[i].pFunc = pFanin;
-        s_DarLib->pDatas[i].Level = Aig_Regular(pFanin)->Level;
+        Dar_LibDatas()[i].pFunc = pFanin;
+        Dar_LibDatas()[i].Level = Aig_Regular(pFanin)->Level;
         // copy the propability of node being one
         if ( p->pPars->fPower )
         {
             float Prob = Abc_Int2Float( Vec_IntEntry( p->pAig->vProbs, Aig_ObjId(Aig_Regular(pFanin)) ) );
-            s_DarLib->pDatas[i].dProb = Aig_IsComplement(pFanin)? 1.0-Prob : Prob;
+            Dar_LibDatas()[i].dProb = Aig_IsComplement(pFanin)? 1.0-Prob : Prob;
         }
     }
     p->nCutsGood++;
@@ -754,12 +793,12 @@ int Dar_LibCutMarkMffc( Aig_Man_t * p, Aig_Obj_t * pRoot, int nLeaves, float * p
     int i, nNodes;
     // mark the cut leaves
     for ( i = 0; i < nLeaves; i++ )
-        Aig_Regular(s_DarLib->pDatas[i].pFunc)->nRefs++;
+        Aig_Regular(Dar_LibDatas()[i].pFunc)->nRefs++;
     // label MFFC with current ID
     nNodes = Aig_NodeMffcLabel( p, pRoot, pPower );
     // unmark the cut leaves
     for ( i = 0; i < nLeaves; i++ )
-        Aig_Regular(s_DarLib->pDatas[i].pFunc)->nRefs--;
+        Aig_Regular(Dar_LibDatas()[i].pFunc)->nRefs--;
     return nNodes;
 }
 
@@ -778,7 +817,7 @@ void Dar_LibObjPrint_rec( Dar_LibObj_t * pObj )
 {
     if ( pObj->fTerm )
     {
-        printf( "%c", 'a' + (int)(pObj - s_DarLib->pObjs) );
+        printf( "%c", 'a' + (int)(pObj - Dar_LibObj(s_DarLib, 0)) );
         return;
     }
     printf( "(" );
@@ -815,7 +854,7 @@ void Dar_LibEvalAssignNums( Dar_Man_t * p, int Class, Aig_Obj_t * pRoot )
         pObj = Dar_LibObj(s_DarLib, s_DarLib->pNodes0[Class][i]);
         pObj->Num = 4 + i;
         assert( (int)pObj->Num < s_DarLib->nNodes0Max + 4 );
-        pData = s_DarLib->pDatas + pObj->Num;
+        pData = Dar_LibDatas() + pObj->Num;
         pData->fMffc = 0;
         pData->pFunc = NULL;
         pData->TravId = 0xFFFF;
@@ -823,8 +862,8 @@ void Dar_LibEvalAssignNums( Dar_Man_t * p, int Class, Aig_Obj_t * pRoot )
         // explore the fanins
         assert( (int)Dar_LibObj(s_DarLib, pObj->Fan0)->Num < s_DarLib->nNodes0Max + 4 );
         assert( (int)Dar_LibObj(s_DarLib, pObj->Fan1)->Num < s_DarLib->nNodes0Max + 4 );
-        pData0 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
-        pData1 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
+        pData0 = Dar_LibDatas() + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
+        pData1 = Dar_LibDatas() + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
         pData->Level = 1 + Abc_MaxInt(pData0->Level, pData1->Level);
         if ( pData0->pFunc == NULL || pData1->pFunc == NULL )
             continue;
@@ -867,7 +906,7 @@ int Dar_LibEval_rec( Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required
     int Area;
     if ( pPower )
         *pPower = (float)0.0;
-    pData = s_DarLib->pDatas + pObj->Num;
+    pData = Dar_LibDatas() + pObj->Num;
     if ( pData->TravId == Out )
         return 0;
     pData->TravId = Out;
@@ -896,8 +935,8 @@ int Dar_LibEval_rec( Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required
         return 0xff;
     if ( pPower )
     {
-        Dar_LibDat_t * pData0 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
-        Dar_LibDat_t * pData1 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
+        Dar_LibDat_t * pData0 = Dar_LibDatas() + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
+        Dar_LibDat_t * pData1 = Dar_LibDatas() + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
         pData->dProb = (pObj->fCompl0? 1.0 - pData0->dProb : pData0->dProb)*
                        (pObj->fCompl1? 1.0 - pData1->dProb : pData1->dProb);
         *pPower = Power0 + 2.0 * pData0->dProb * (1.0 - pData0->dProb) +
@@ -940,7 +979,7 @@ void Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Requir
     for ( Out = 0; Out < s_DarLib->nSubgr0[Class]; Out++ )
     {
         pObj = Dar_LibObj(s_DarLib, s_DarLib->pSubgr0[Class][Out]);
-        if ( Aig_Regular(s_DarLib->pDatas[pObj->Num].pFunc) == pRoot )
+        if ( Aig_Regular(Dar_LibDatas()[pObj->Num].pFunc) == pRoot )
             continue;
         nNodesAdded = Dar_LibEval_rec( pObj, Out, nNodesSaved - !p->pPars->fUseZeros, Required, p->pPars->fPower? &PowerAdded : NULL );
         nNodesGained = nNodesSaved - nNodesAdded;
@@ -951,15 +990,15 @@ void Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Requir
         if ( nNodesGained < 0 || (nNodesGained == 0 && !p->pPars->fUseZeros) )
             continue;
         if ( nNodesGained <  p->GainBest || 
-            (nNodesGained == p->GainBest && s_DarLib->pDatas[pObj->Num].Level >= p->LevelBest) )
+            (nNodesGained == p->GainBest && Dar_LibDatas()[pObj->Num].Level >= p->LevelBest) )
             continue;
         // remember this possibility
         Vec_PtrClear( p->vLeavesBest );
         for ( k = 0; k < (int)pCut->nLeaves; k++ )
-            Vec_PtrPush( p->vLeavesBest, s_DarLib->pDatas[k].pFunc );
+            Vec_PtrPush( p->vLeavesBest, Dar_LibDatas()[k].pFunc );
         p->OutBest    = s_DarLib->pSubgr0[Class][Out];
         p->OutNumBest = Out;
-        p->LevelBest  = s_DarLib->pDatas[pObj->Num].Level;
+        p->LevelBest  = Dar_LibDatas()[pObj->Num].Level;
         p->GainBest   = nNodesGained;
         p->ClassBest  = Class;
         assert( p->LevelBest <= Required );
@@ -986,7 +1025,7 @@ void Dar_LibBuildClear_rec( Dar_LibObj_t * pObj, int * pCounter )
     if ( pObj->fTerm )
         return;
     pObj->Num = (*pCounter)++;
-    s_DarLib->pDatas[ pObj->Num ].pFunc = NULL;
+    Dar_LibDatas()[ pObj->Num ].pFunc = NULL;
     Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, pObj->Fan0), pCounter );
     Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, pObj->Fan1), pCounter );
 }
@@ -1005,7 +1044,7 @@ void Dar_LibBuildClear_rec( Dar_LibObj_t * pObj, int * pCounter )
 Aig_Obj_t * Dar_LibBuildBest_rec( Dar_Man_t * p, Dar_LibObj_t * pObj )
 {
     Aig_Obj_t * pFanin0, * pFanin1;
-    Dar_LibDat_t * pData = s_DarLib->pDatas + pObj->Num;
+    Dar_LibDat_t * pData = Dar_LibDatas() + pObj->Num;
     if ( pData->pFunc )
         return pData->pFunc;
     pFanin0 = Dar_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, pObj->Fan0) );
@@ -1032,7 +1071,7 @@ Aig_Obj_t * Dar_LibBuildBest( Dar_Man_t * p )
 {
     int i, Counter = 4;
     for ( i = 0; i < Vec_PtrSize(p->vLeavesBest); i++ )
-        s_DarLib->pDatas[i].pFunc = (Aig_Obj_t *)Vec_PtrEntry( p->vLeavesBest, i );
+        Dar_LibDatas()[i].pFunc = (Aig_Obj_t *)Vec_PtrEntry( p->vLeavesBest, i );
     Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, p->OutBest), &Counter );
     return Dar_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, p->OutBest) );
 }
@@ -1068,8 +1107,8 @@ int Dar2_LibCutMatch( Gia_Man_t * p, Vec_Int_t * vCutLits, unsigned uTruth )
 //        pFanin = Gia_ManObj( p, pCut->pLeaves[ (int)pPerm[i] ] );
 //        pFanin = Gia_ManObj( p, Vec_IntEntry( vCutLits, (int)pPerm[i] ) );
 //        pFanin = Gia_ObjFromLit( p, Vec_IntEntry( vCutLits, (int)pPerm[i] ) );
-        s_DarLib->pDatas[i].iGunc = Abc_LitNotCond( Vec_IntEntry(vCutLits, (int)pPerm[i]), ((uPhase >> i) & 1) );
-        s_DarLib->pDatas[i].Level = Gia_ObjLevel( p, Gia_Regular(Gia_ObjFromLit(p, s_DarLib->pDatas[i].iGunc)) );
+        Dar_LibDatas()[i].iGunc = Abc_LitNotCond( Vec_IntEntry(vCutLits, (int)pPerm[i]), ((uPhase >> i) & 1) );
+        Dar_LibDatas()[i].Level = Gia_ObjLevel( p, Gia_Regular(Gia_ObjFromLit(p, Dar_LibDatas()[i].iGunc)) );
     }
     return 1;
 }
@@ -1096,7 +1135,7 @@ void Dar2_LibEvalAssignNums( Gia_Man_t * p, int Class )
         pObj = Dar_LibObj(s_DarLib, s_DarLib->pNodes0[Class][i]);
         pObj->Num = 4 + i;
         assert( (int)pObj->Num < s_DarLib->nNodes0Max + 4 );
-        pData = s_DarLib->pDatas + pObj->Num;
+        pData = Dar_LibDatas() + pObj->Num;
         pData->fMffc = 0;
         pData->iGunc = -1;
         pData->TravId = 0xFFFF;
@@ -1104,8 +1143,8 @@ void Dar2_LibEvalAssignNums( Gia_Man_t * p, int Class )
         // explore the fanins
         assert( (int)Dar_LibObj(s_DarLib, pObj->Fan0)->Num < s_DarLib->nNodes0Max + 4 );
         assert( (int)Dar_LibObj(s_DarLib, pObj->Fan1)->Num < s_DarLib->nNodes0Max + 4 );
-        pData0 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
-        pData1 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
+        pData0 = Dar_LibDatas() + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
+        pData1 = Dar_LibDatas() + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
         pData->Level = 1 + Abc_MaxInt(pData0->Level, pData1->Level);
         if ( pData0->iGunc == -1 || pData1->iGunc == -1 )
             continue;
@@ -1150,7 +1189,7 @@ int Dar2_LibEval_rec( Dar_LibObj_t * pObj, int Out )
 {
     Dar_LibDat_t * pData;
     int Area;
-    pData = s_DarLib->pDatas + pObj->Num;
+    pData = Dar_LibDatas() + pObj->Num;
     if ( pData->TravId == Out )
         return 0;
     pData->TravId = Out;
@@ -1214,23 +1253,23 @@ int Dar2_LibEval( Gia_Man_t * p, Vec_Int_t * vCutLits, unsigned uTruth, int fKee
         nNodesGained = nNodesSaved - nNodesAdded;
         if ( fKeepLevel )
         {
-            if ( s_DarLib->pDatas[pObj->Num].Level >  p_LevelBest || 
-                (s_DarLib->pDatas[pObj->Num].Level == p_LevelBest && nNodesGained <= p_GainBest) )
+            if ( Dar_LibDatas()[pObj->Num].Level >  p_LevelBest || 
+                (Dar_LibDatas()[pObj->Num].Level == p_LevelBest && nNodesGained <= p_GainBest) )
                 continue;
         }
         else
         {
             if ( nNodesGained <  p_GainBest || 
-                (nNodesGained == p_GainBest && s_DarLib->pDatas[pObj->Num].Level >= p_LevelBest) )
+                (nNodesGained == p_GainBest && Dar_LibDatas()[pObj->Num].Level >= p_LevelBest) )
                 continue;
         }
         // remember this possibility
         Vec_IntClear( vLeavesBest2 );
         for ( k = 0; k < Vec_IntSize(vCutLits); k++ )
-            Vec_IntPush( vLeavesBest2, s_DarLib->pDatas[k].iGunc );
+            Vec_IntPush( vLeavesBest2, Dar_LibDatas()[k].iGunc );
         p_OutBest    = s_DarLib->pSubgr0[Class][Out];
         p_OutNumBest = Out;
-        p_LevelBest  = s_DarLib->pDatas[pObj->Num].Level;
+        p_LevelBest  = Dar_LibDatas()[pObj->Num].Level;
         p_GainBest   = nNodesGained;
         p_ClassBest  = Class;
 //        assert( p_LevelBest <= Required );
@@ -1258,7 +1297,7 @@ void Dar2_LibBuildClear_rec( Dar_LibObj_t * pObj, int * pCounter )
     if ( pObj->fTerm )
         return;
     pObj->Num = (*pCounter)++;
-    s_DarLib->pDatas[ pObj->Num ].iGunc = -1;
+    Dar_LibDatas()[ pObj->Num ].iGunc = -1;
     Dar2_LibBuildClear_rec( Dar_LibObj(s_DarLib, pObj->Fan0), pCounter );
     Dar2_LibBuildClear_rec( Dar_LibObj(s_DarLib, pObj->Fan1), pCounter );
 }
@@ -1279,7 +1318,7 @@ int Dar2_LibBuildBest_rec( Gia_Man_t * p, Dar_LibObj_t * pObj )
     Gia_Obj_t * pNode;
     Dar_LibDat_t * pData;
     int iFanin0, iFanin1;
-    pData = s_DarLib->pDatas + pObj->Num;
+    pData = Dar_LibDatas() + pObj->Num;
     if ( pData->iGunc >= 0 )
         return pData->iGunc;
     iFanin0 = Dar2_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, pObj->Fan0) );
@@ -1310,7 +1349,7 @@ int Dar2_LibBuildBest( Gia_Man_t * p, Vec_Int_t * vLeavesBest2, int OutBest )
     int i, iLeaf, Counter = 4;
     assert( Vec_IntSize(vLeavesBest2) == 4 );
     Vec_IntForEachEntry( vLeavesBest2, iLeaf, i )
-        s_DarLib->pDatas[i].iGunc = iLeaf;
+        Dar_LibDatas()[i].iGunc = iLeaf;
     Dar2_LibBuildClear_rec( Dar_LibObj(s_DarLib, OutBest), &Counter );
     return Dar2_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, OutBest) );
 }
@@ -0,0 +1,625 @@
+/**CFile****************************************************************
+
+  FileName    [darPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware AIG rewriting.]
+
+  Synopsis    [Concurrent rewriting of AIG windows and output partitions.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: darPar.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "darInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the data of one rewriting job
+typedef struct Dar_ParData_t_ Dar_ParData_t;
+struct Dar_ParData_t_
+{
+    Aig_Man_t *      pAig;           // the window (replaced by the rewritten window)
+    Dar_RwrPar_t     Pars;           // the private copy of rewriting parameters
+    Vec_Int_t *      vRequired;      // the required levels of the window outputs (switch -l)
+    int              nLevelMax;      // the number of levels in the AIG (switch -l)
+};
+
+// the data of one output partition
+typedef struct Dar_PartData_t_ Dar_PartData_t;
+struct Dar_PartData_t_
+{
+    Aig_Man_t *      pAig;           // the partition (replaced by the optimized partition)
+    int              fBalance;       // the parameters of compress2
+    int              fUpdateLevel;
+    int              fFanout;
+    int              fPower;
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Divides the internal nodes into windows.]
+
+  Description [The fanin cones of the COs are traversed in the order
+  of the COs and the nodes are divided into disjoint windows of nWinSize
+  nodes in the order of traversal (the first window has nWinSize-nShift
+  nodes). The nodes of each window are in a topological order and the
+  fanins of each window belong to the previous windows or are the CIs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_ManParCollect_rec( Aig_Man_t * p, Aig_Obj_t * pObj, Vec_Wec_t * vRes, int nWinSize, int * pnNodes )
+{
+    if ( Aig_ObjIsTravIdCurrent(p, pObj) )
+        return;
+    Aig_ObjSetTravIdCurrent(p, pObj);
+    if ( !Aig_ObjIsNode(pObj) )
+        return;
+    Dar_ManParCollect_rec( p, Aig_ObjFanin0(pObj), vRes, nWinSize, pnNodes );
+    Dar_ManParCollect_rec( p, Aig_ObjFanin1(pObj), vRes, nWinSize, pnNodes );
+    if ( (*pnNodes)++ % nWinSize == 0 || Vec_WecSize(vRes) == 0 )
+        Vec_WecPushLevel( vRes );
+    Vec_IntPush( Vec_WecEntryLast(vRes), Aig_ObjId(pObj) );
+}
+Vec_Wec_t * Dar_ManParNodes( Aig_Man_t * p, int nWinSize, int nShift )
+{
+    Vec_Wec_t * vRes = Vec_WecAlloc( 100 );
+    Aig_Obj_t * pObj; int i, nNodes = nShift;
+    Aig_ManIncrementTravId( p );
+    Aig_ManForEachCo( p, pObj, i )
+        Dar_ManParCollect_rec( p, Aig_ObjFanin0(pObj), vRes, nWinSize, &nNodes );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the inputs and the outputs of each window.]
+
+  Description [The inputs are the fanins outside of the window, except
+  the constant node. The outputs are the nodes referenced outside of
+  the window, including the references by the COs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Dar_ManParInputs( Aig_Man_t * p, Vec_Wec_t * vNodes )
+{
+    Vec_Wec_t * vRes = Vec_WecAlloc( Vec_WecSize(vNodes) );
+    Vec_Int_t * vLevel, * vVec;
+    Aig_Obj_t * pObj, * pFanin; int i, k;
+    Vec_WecForEachLevel( vNodes, vLevel, i )
+    {
+        vVec = Vec_WecPushLevel( vRes );
+        Aig_ManIncrementTravId( p );
+        Aig_ObjSetTravIdCurrent( p, Aig_ManConst1(p) );
+        Aig_ManForEachObjVec( vLevel, p, pObj, k )
+            Aig_ObjSetTravIdCurrent( p, pObj );
+        Aig_ManForEachObjVec( vLevel, p, pObj, k )
+        {
+            pFanin = Aig_ObjFanin0(pObj);
+            if ( !Aig_ObjIsTravIdCurrent(p, pFanin) )
+                Aig_ObjSetTravIdCurrent(p, pFanin), Vec_IntPush( vVec, Aig_ObjId(pFanin) );
+            pFanin = Aig_ObjFanin1(pObj);
+            if ( !Aig_ObjIsTravIdCurrent(p, pFanin) )
+                Aig_ObjSetTravIdCurrent(p, pFanin), Vec_IntPush( vVec, Aig_ObjId(pFanin) );
+        }
+    }
+    return vRes;
+}
+Vec_Wec_t * Dar_ManParOutputs( Aig_Man_t * p, Vec_Wec_t * vNodes )
+{
+    Vec_Wec_t * vRes = Vec_WecAlloc( Vec_WecSize(vNodes) );
+    Vec_Int_t * vLevel, * vVec;
+    Aig_Obj_t * pObj; int i, k;
+    Vec_WecForEachLevel( vNodes, vLevel, i )
+    {
+        vVec = Vec_WecPushLevel( vRes );
+        Aig_ManForEachObjVec( vLevel, p, pObj, k )
+        {
+            Aig_ObjDeref( Aig_ObjFanin0(pObj) );
+            Aig_ObjDeref( Aig_ObjFanin1(pObj) );
+        }
+        Aig_ManForEachObjVec( vLevel, p, pObj, k )
+            if ( Aig_ObjRefs(pObj) > 0 )
+                Vec_IntPush( vVec, Aig_ObjId(pObj) );
+        Aig_ManForEachObjVec( vLevel, p, pObj, k )
+        {
+            Aig_ObjRef( Aig_ObjFanin0(pObj) );
+            Aig_ObjRef( Aig_ObjFanin1(pObj) );
+        }
+        assert( Vec_IntSize(vVec) > 0 );
+    }
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Duplicates one window as a combinational AIG.]
+
+  Description [If fUpdateLevel is set, the inputs of the window inherit
+  their levels in the AIG, so that the window levels are global.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManParDupWindow( Aig_Man_t * p, Vec_Int_t * vIns, Vec_Int_t * vNodes, Vec_Int_t * vOuts, int fUpdateLevel )
+{
+    Aig_Man_t * pNew;
+    Aig_Obj_t * pObj; int i;
+    pNew = Aig_ManStart( Vec_IntSize(vNodes) );
+    Aig_ManConst1(p)->pData = Aig_ManConst1(pNew);
+    Aig_ManForEachObjVec( vIns, p, pObj, i )
+    {
+        pObj->pData = Aig_ObjCreateCi( pNew );
+        if ( fUpdateLevel )
+            ((Aig_Obj_t *)pObj->pData)->Level = pObj->Level;
+    }
+    Aig_ManForEachObjVec( vNodes, p, pObj, i )
+        pObj->pData = Aig_And( pNew, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+    Aig_ManForEachObjVec( vOuts, p, pObj, i )
+        Aig_ObjCreateCo( pNew, (Aig_Obj_t *)pObj->pData );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the required levels of the window outputs.]
+
+  Description [The windows are rewritten concurrently, so the slack of 
+  a window output cannot be used without invalidating the levels of the
+  window inputs assumed by the other windows. For this reason, the 
+  required level of each window output is its current level in the AIG.
+  Together with the window inputs inheriting their levels in the AIG,
+  this guarantees that the stitched AIG is not deeper than the original.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Dar_ManParRequired( Aig_Man_t * p, Vec_Wec_t * vOuts )
+{
+    Vec_Wec_t * vRes = Vec_WecAlloc( Vec_WecSize(vOuts) );
+    Vec_Int_t * vLevel, * vVec;
+    Aig_Obj_t * pObj; int i, k;
+    Vec_WecForEachLevel( vOuts, vLevel, i )
+    {
+        vVec = Vec_WecPushLevel( vRes );
+        Aig_ManForEachObjVec( vLevel, p, pObj, k )
+            Vec_IntPush( vVec, Aig_ObjLevel(pObj) );
+    }
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the reverse levels of the window.]
+
+  Description [The reverse levels of the window COs are derived from 
+  the required levels of the window outputs. The reverse levels of the
+  nodes are computed in the reverse topological order. Rewriting uses 
+  these levels instead of computing them in the window.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_ManParStartLevels( Aig_Man_t * p, Vec_Int_t * vRequired, int nLevelMax )
+{
+    Aig_Obj_t * pObj; int i;
+    assert( p->vLevelR == NULL );
+    assert( Vec_IntSize(vRequired) == Aig_ManCoNum(p) );
+    p->nLevelMax = nLevelMax;
+    p->vLevelR = Vec_IntStart( Aig_ManObjNumMax(p) );
+    Aig_ManForEachCo( p, pObj, i )
+        Vec_IntWriteEntry( p->vLevelR, Aig_ObjId(pObj), nLevelMax - Vec_IntEntry(vRequired, i) );
+    Aig_ManForEachObjReverse( p, pObj, i )
+    {
+        if ( Aig_ObjIsCo(pObj) || Aig_ObjIsNode(pObj) )
+            if ( Aig_ObjIsNode(Aig_ObjFanin0(pObj)) )
+                Vec_IntUpdateEntry( p->vLevelR, Aig_ObjFaninId0(pObj), Vec_IntEntry(p->vLevelR, i) + 1 );
+        if ( Aig_ObjIsNode(pObj) )
+            if ( Aig_ObjIsNode(Aig_ObjFanin1(pObj)) )
+                Vec_IntUpdateEntry( p->vLevelR, Aig_ObjFaninId1(pObj), Vec_IntEntry(p->vLevelR, i) + 1 );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stitches the rewritten windows into a new AIG.]
+
+  Description [The windows are added in the order of their creation,
+  which guarantees that the inputs of each window are already mapped.
+  Structural hashing of the new AIG merges the logic shared by the
+  windows, while the dangling logic is removed at the end.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManParStitch( Aig_Man_t * p, Vec_Wec_t * vIns, Vec_Wec_t * vOuts, Vec_Ptr_t * vWins )
+{
+    Aig_Man_t * pNew, * pWin;
+    Aig_Obj_t * pObj; int i, k;
+    pNew = Aig_ManStart( Aig_ManObjNumMax(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Aig_ManCleanData( p );
+    Aig_ManConst1(p)->pData = Aig_ManConst1(pNew);
+    Aig_ManForEachCi( p, pObj, i )
+        pObj->pData = Aig_ObjCreateCi( pNew );
+    Vec_PtrForEachEntry( Aig_Man_t *, vWins, pWin, i )
+    {
+        Aig_ManCleanData( pWin );
+        Aig_ManConst1(pWin)->pData = Aig_ManConst1(pNew);
+        Aig_ManForEachObjVec( Vec_WecEntry(vIns, i), p, pObj, k )
+        {
+            assert( pObj->pData != NULL );
+            Aig_ManCi(pWin, k)->pData = pObj->pData;
+        }
+        Aig_ManForEachNode( pWin, pObj, k )
+            pObj->pData = Aig_And( pNew, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+        Aig_ManForEachObjVec( Vec_WecEntry(vOuts, i), p, pObj, k )
+            pObj->pData = Aig_ObjChild0Copy( Aig_ManCo(pWin, k) );
+    }
+    Aig_ManForEachCo( p, pObj, i )
+        Aig_ObjCreateCo( pNew, Aig_ObjChild0Copy(pObj) );
+    Aig_ManSetRegNum( pNew, Aig_ManRegNum(p) );
+    Aig_ManCleanup( pNew );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rewrites one window.]
+
+  Description [Runs in a separate thread. The rewriting library is shared
+  by the threads, while its object data is private to each thread. If 
+  the levels are preserved, the required levels come from the AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar_ManParRewriteOne( void * pArg )
+{
+    Dar_ParData_t * pData = (Dar_ParData_t *)pArg;
+    Aig_Man_t * pTemp;
+    Dar_LibThreadStart();
+    if ( pData->vRequired )
+        Dar_ManParStartLevels( pData->pAig, pData->vRequired, pData->nLevelMax );
+    Dar_ManRewrite( pData->pAig, &pData->Pars );
+    pData->pAig = Aig_ManDupDfs( pTemp = pData->pAig );
+    Aig_ManStop( pTemp );
+    Dar_LibThreadStop();
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one pass of rewriting of AIG windows in parallel.]
+
+  Description [The AIG is divided into disjoint windows, which are
+  rewritten concurrently and stitched back in the fixed order. The levels
+  of the stitched AIG are computed globally while it is constructed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManRewriteParOne( Aig_Man_t * pAig, Dar_RwrPar_t * pPars, int nShift )
+{
+    Aig_Man_t * pNew;
+    Vec_Wec_t * vNodes, * vIns, * vOuts, * vReqs = NULL;
+    Vec_Ptr_t * vWins, * vData;
+    Dar_ParData_t * pData;
+    abctime clk = Abc_Clock();
+    int i, nNodes = Aig_ManNodeNum(pAig);
+    // divide the AIG into windows
+    vNodes = Dar_ManParNodes( pAig, pPars->nWinSize, nShift );
+    vIns   = Dar_ManParInputs( pAig, vNodes );
+    vOuts  = Dar_ManParOutputs( pAig, vNodes );
+    if ( pPars->fUpdateLevel )
+        vReqs = Dar_ManParRequired( pAig, vOuts );
+    pData  = ABC_CALLOC( Dar_ParData_t, Vec_WecSize(vNodes) );
+    vData  = Vec_PtrAlloc( Vec_WecSize(vNodes) );
+    for ( i = 0; i < Vec_WecSize(vNodes); i++ )
+    {
+        pData[i].pAig = Dar_ManParDupWindow( pAig, Vec_WecEntry(vIns, i), Vec_WecEntry(vNodes, i), Vec_WecEntry(vOuts, i), pPars->fUpdateLevel );
+        pData[i].Pars = *pPars;
+        pData[i].Pars.fVerbose = 0;
+        pData[i].Pars.fVeryVerbose = 0;
+        pData[i].vRequired = vReqs ? Vec_WecEntry(vReqs, i) : NULL;
+        pData[i].nLevelMax = Aig_ManLevels(pAig);
+        Vec_PtrPush( vData, pData + i );
+    }
+    // rewrite the windows (the calling thread only dispatches the windows)
+    Util_ProcessThreads( Dar_ManParRewriteOne, vData, pPars->nProcs + 1, 0, 0 );
+    // stitch the windows
+    vWins = Vec_PtrAlloc( Vec_WecSize(vNodes) );
+    for ( i = 0; i < Vec_WecSize(vNodes); i++ )
+        Vec_PtrPush( vWins, pData[i].pAig );
+    pNew = Dar_ManParStitch( pAig, vIns, vOuts, vWins );
+    if ( pPars->fVerbose )
+    {
+        printf( "Rewrote %4d windows with shift %6d. Reduced %8d to %8d nodes.  ",
+            Vec_PtrSize(vWins), nShift, nNodes, Aig_ManNodeNum(pNew) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    assert( !pPars->fUpdateLevel || Aig_ManLevels(pNew) <= Aig_ManLevels(pAig) );
+    Vec_PtrFreeFunc( vWins, (void (*)(void *)) Aig_ManStop );
+    Vec_PtrFree( vData );
+    ABC_FREE( pData );
+    Vec_WecFree( vNodes );
+    Vec_WecFree( vIns );
+    Vec_WecFree( vOuts );
+    if ( vReqs )
+        Vec_WecFree( vReqs );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs rewriting of AIG windows in parallel.]
+
+  Description [Rewriting inside a window cannot restructure the logic
+  across its boundary. For this reason, two passes are performed: the
+  windows of the second pass are shifted by half of the window size,
+  so that the boundaries of the first pass fall inside the windows of
+  the second pass. Because the windows do not depend on the number of
+  threads or on the order of their completion, the result is the same
+  for any number of threads. When the levels are preserved (switch -l),
+  the levels of the window inputs and the required levels of the window
+  outputs are taken from the AIG, so that the number of levels does not
+  increase.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManRewritePar( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    Aig_Man_t * pTemp;
+    abctime clk = Abc_Clock();
+    int nNodes = Aig_ManNodeNum(pAig);
+    assert( pPars->nWinSize >= DAR_PAR_WIN_MIN );
+    // prepare the shared library before starting the threads
+    Dar_LibPrepare( pPars->nSubgMax );
+    Aig_ManCleanup( pAig );
+    pAig = Dar_ManRewriteParOne( pAig, pPars, 0 );
+    if ( Aig_ManNodeNum(pAig) > pPars->nWinSize / 2 )
+    {
+        pAig = Dar_ManRewriteParOne( pTemp = pAig, pPars, pPars->nWinSize / 2 );
+        Aig_ManStop( pTemp );
+    }
+    if ( pPars->fVerbose )
+    {
+        printf( "Concurrent rewriting with %d threads reduced %d to %d nodes.  ",
+            pPars->nProcs, nNodes, Aig_ManNodeNum(pAig) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return pAig;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the cones of one output partition.]
+
+  Description [The CIs of the new AIG are the support of the partition 
+  (vSupp) and its COs are the COs of the partition (vPart), in the same 
+  order.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManPartDup( Aig_Man_t * p, Vec_Int_t * vPart, Vec_Int_t * vSupp )
+{
+    extern Vec_Ptr_t * Aig_ManDupPart( Aig_Man_t * pNew, Aig_Man_t * pOld, Vec_Int_t * vPart, Vec_Int_t * vSuppMap, int fInverse );
+    Aig_Man_t * pNew;
+    Vec_Ptr_t * vOuts;
+    Aig_Obj_t * pObj; int i;
+    pNew = Aig_ManStart( 1000 );
+    for ( i = 0; i < Vec_IntSize(vSupp); i++ )
+        Aig_ObjCreateCi( pNew );
+    vOuts = Aig_ManDupPart( pNew, p, vPart, vSupp, 0 );
+    assert( Aig_ManCiNum(pNew) == Vec_IntSize(vSupp) );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vOuts, pObj, i )
+        Aig_ObjCreateCo( pNew, pObj );
+    Vec_PtrFree( vOuts );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stitches the optimized partitions into a new AIG.]
+
+  Description [The logic shared by several partitions is duplicated in 
+  each of them. After optimization, structural hashing of the new AIG 
+  merges the copies that remain structurally identical.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManPartStitch( Aig_Man_t * p, Vec_Ptr_t * vParts, Vec_Ptr_t * vSupps, Vec_Ptr_t * vAigs )
+{
+    Aig_Man_t * pNew, * pPart;
+    Vec_Ptr_t * vDrivers;
+    Vec_Int_t * vPart, * vSupp;
+    Aig_Obj_t * pObj; int i, k;
+    pNew = Aig_ManStart( Aig_ManObjNumMax(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    for ( i = 0; i < Aig_ManCiNum(p); i++ )
+        Aig_ObjCreateCi( pNew );
+    vDrivers = Vec_PtrStart( Aig_ManCoNum(p) );
+    Vec_PtrForEachEntry( Aig_Man_t *, vAigs, pPart, i )
+    {
+        vPart = (Vec_Int_t *)Vec_PtrEntry( vParts, i );
+        vSupp = (Vec_Int_t *)Vec_PtrEntry( vSupps, i );
+        Aig_ManCleanData( pPart );
+        Aig_ManConst1(pPart)->pData = Aig_ManConst1(pNew);
+        Aig_ManForEachCi( pPart, pObj, k )
+            pObj->pData = Aig_ManCi( pNew, Vec_IntEntry(vSupp, k) );
+        Aig_ManForEachNode( pPart, pObj, k )
+            pObj->pData = Aig_And( pNew, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+        Aig_ManForEachCo( pPart, pObj, k )
+            Vec_PtrWriteEntry( vDrivers, Vec_IntEntry(vPart, k), Aig_ObjChild0Copy(pObj) );
+    }
+    Vec_PtrForEachEntry( Aig_Obj_t *, vDrivers, pObj, i )
+    {
+        assert( pObj != NULL );
+        Aig_ObjCreateCo( pNew, pObj );
+    }
+    Vec_PtrFree( vDrivers );
+    Aig_ManSetRegNum( pNew, Aig_ManRegNum(p) );
+    Aig_ManCleanup( pNew );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Optimizes one output partition.]
+
+  Description [Runs in a separate thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar_ManPartCompressOne( void * pArg )
+{
+    Dar_PartData_t * pData = (Dar_PartData_t *)pArg;
+    Aig_Man_t * pTemp;
+    Dar_LibThreadStart();
+    pData->pAig = Dar_ManCompress2( pTemp = pData->pAig, pData->fBalance, pData->fUpdateLevel, pData->fFanout, pData->fPower, 0 );
+    Aig_ManStop( pTemp );
+    Dar_LibThreadStop();
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs compress2 on output partitions in parallel.]
+
+  Description [The COs are divided into groups with overlapping support,
+  so that the support of each group does not exceed nSuppMax CIs unless 
+  the support of one CO does. If nSuppMax is 0, the support is not limited
+  and all COs end up in one group. The fanin cones of each group are extracted 
+  into a separate AIG and optimized by compress2 concurrently. The results 
+  are stitched in the order of partitions, so the result does not depend 
+  on the number of threads. One more rewriting pass over the stitched 
+  AIG merges the copies of the logic shared by several partitions. The 
+  registers, if present, are treated as CIs/COs, which makes the 
+  optimization combinational.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManCompress2Par( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int nSuppMax, int nProcs, int fVerbose )
+{
+    Dar_RwrPar_t Pars;
+    Aig_Man_t * pNew, * pTemp;
+    Vec_Ptr_t * vParts, * vSupps, * vAigs, * vData;
+    Dar_PartData_t * pData;
+    abctime clk = Abc_Clock();
+    int i, nNodes = 0;
+    // prepare the shared library before starting the threads
+    Dar_ManDefaultRwrParams( &Pars );
+    Dar_LibPrepare( Pars.nSubgMax );
+    // divide the outputs into partitions (the partitioner packs the small
+    // partitions up to 200 CIs if the limit is 0, so no limit is passed as
+    // a limit that no support can reach)
+    if ( nSuppMax == 0 )
+        nSuppMax = Aig_ManCiNum(pAig) + 1;
+    vParts = Aig_ManPartitionSmart( pAig, nSuppMax, 0, &vSupps );
+    pData  = ABC_CALLOC( Dar_PartData_t, Vec_PtrSize(vParts) );
+    vData  = Vec_PtrAlloc( Vec_PtrSize(vParts) );
+    for ( i = 0; i < Vec_PtrSize(vParts); i++ )
+    {
+        pData[i].pAig         = Dar_ManPartDup( pAig, (Vec_Int_t *)Vec_PtrEntry(vParts, i), (Vec_Int_t *)Vec_PtrEntry(vSupps, i) );
+        pData[i].fBalance     = fBalance;
+        pData[i].fUpdateLevel = fUpdateLevel;
+        pData[i].fFanout      = fFanout;
+        pData[i].fPower       = fPower;
+        nNodes += Aig_ManNodeNum( pData[i].pAig );
+        Vec_PtrPush( vData, pData + i );
+    }
+    if ( fVerbose )
+    {
+        printf( "Divided %d COs into %d partitions with %d nodes (%.2f of the original %d nodes).  ",
+            Aig_ManCoNum(pAig), Vec_PtrSize(vParts), nNodes, 1.0 * nNodes / Abc_MaxInt(1, Aig_ManNodeNum(pAig)), Aig_ManNodeNum(pAig) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    // optimize the partitions (the calling thread only dispatches the partitions)
+    Util_ProcessThreads( Dar_ManPartCompressOne, vData, nProcs + 1, 0, 0 );
+    // stitch the partitions
+    vAigs = Vec_PtrAlloc( Vec_PtrSize(vParts) );
+    for ( i = 0; i < Vec_PtrSize(vParts); i++ )
+        Vec_PtrPush( vAigs, pData[i].pAig );
+    pNew = Dar_ManPartStitch( pAig, vParts, vSupps, vAigs );
+    if ( fVerbose )
+    {
+        printf( "Concurrent compress2 with %d threads reduced %d to %d nodes.  ",
+            nProcs, Aig_ManNodeNum(pAig), Aig_ManNodeNum(pNew) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    // rewrite once more to merge the copies of shared logic
+    Pars.fUpdateLevel = fUpdateLevel;
+    Dar_ManRewrite( pNew, &Pars );
+    pNew = Aig_ManDupDfs( pTemp = pNew );
+    Aig_ManStop( pTemp );
+    if ( fVerbose )
+    {
+        printf( "Final rewriting of the stitched AIG reduced it to %d nodes.  ", Aig_ManNodeNum(pNew) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_PtrFreeFunc( vAigs, (void (*)(void *)) Aig_ManStop );
+    Vec_PtrFree( vData );
+    ABC_FREE( pData );
+    Vec_VecFree( (Vec_Vec_t *)vParts );
+    Vec_VecFree( (Vec_Vec_t *)vSupps );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
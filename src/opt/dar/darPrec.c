@@ -281,9 +281,10 @@ unsigned Dar_TruthPolarize( unsigned uTruth, int Polarity, int nVars )
 
 /**Function*************************************************************
 
-  Synopsis    [Computes NPN canonical forms for 4-variable functions.]
+  Synopsis    [Returns NPN canonical forms for 4-variable functions.]
 
-  Description []
+  Description [Uses the precomputed tables, in which the complements of
+  the class representatives are not mapped.]
                
   SideEffects []
 
@@ -294,91 +295,17 @@ void Dar_Truth4VarNPN( unsigned short ** puCanons, char ** puPhases, char ** puP
 {
     unsigned short * uCanons;
     unsigned char * uMap;
-    unsigned uTruth, uPhase, uPerm;
-    char ** pPerms4, * uPhases, * uPerms;
-    int nFuncs, nClasses;
-    int i, k;
-
-    nFuncs  = (1 << 16);
-    uCanons = ABC_CALLOC( unsigned short, nFuncs );
-    uPhases = ABC_CALLOC( char, nFuncs );
-    uPerms  = ABC_CALLOC( char, nFuncs );
-    uMap    = ABC_CALLOC( unsigned char, nFuncs );
-    pPerms4 = Dar_Permutations( 4 );
-
-    nClasses = 1;
-    nFuncs = (1 << 15);
-    for ( uTruth = 1; uTruth < (unsigned)nFuncs; uTruth++ )
-    {
-        // skip already assigned
-        if ( uCanons[uTruth] )
-        {
-            assert( uTruth > uCanons[uTruth] );
-            uMap[~uTruth & 0xFFFF] = uMap[uTruth] = uMap[uCanons[uTruth]];
-            continue;
-        }
-        uMap[uTruth] = nClasses++;
-        for ( i = 0; i < 16; i++ )
-        {
-            uPhase = Dar_TruthPolarize( uTruth, i, 4 );
-            for ( k = 0; k < 24; k++ )
-            {
-                uPerm = Dar_TruthPermute( uPhase, pPerms4[k], 4, 0 );
-                if ( uCanons[uPerm] == 0 )
-                {
-                    uCanons[uPerm] = uTruth;
-                    uPhases[uPerm] = i;
-                    uPerms[uPerm]  = k;
-                    uMap[uPerm]    = uMap[uTruth];
-
-                    uPerm = ~uPerm & 0xFFFF;
-                    uCanons[uPerm] = uTruth;
-                    uPhases[uPerm] = i | 16;
-                    uPerms[uPerm]  = k;
-                    uMap[uPerm]    = uMap[uTruth];
-                }
-                else
-                    assert( uCanons[uPerm] == uTruth );
-            }
-            uPhase = Dar_TruthPolarize( ~uTruth & 0xFFFF, i, 4 ); 
-            for ( k = 0; k < 24; k++ )
-            {
-                uPerm = Dar_TruthPermute( uPhase, pPerms4[k], 4, 0 );
-                if ( uCanons[uPerm] == 0 )
-                {
-                    uCanons[uPerm] = uTruth;
-                    uPhases[uPerm] = i;
-                    uPerms[uPerm]  = k;
-                    uMap[uPerm]    = uMap[uTruth];
-
-                    uPerm = ~uPerm & 0xFFFF;
-                    uCanons[uPerm] = uTruth;
-                    uPhases[uPerm] = i | 16;
-                    uPerms[uPerm]  = k;
-                    uMap[uPerm]    = uMap[uTruth];
-                }
-                else
-                    assert( uCanons[uPerm] == uTruth );
-            }
-        }
-    }
-    for ( uTruth = 1; uTruth < 0xffff; uTruth++ )
-        assert( uMap[uTruth] != 0 );
-    uPhases[(1<<16)-1] = 16;
-    assert( nClasses == 222 );
-    ABC_FREE( pPerms4 );
+    int i;
+    Abc_Truth4VarNPN( &uCanons, puPhases, puPerms, &uMap );
+    for ( i = 1; i < 0xffff; i++ )
+        if ( uMap[i] == 0 )
+            uMap[i] = uMap[uCanons[i]];
+    for ( i = 1; i < 0xffff; i++ )
+        assert( uMap[i] != 0 );
     if ( puCanons ) 
         *puCanons = uCanons;
     else
         ABC_FREE( uCanons );
-    if ( puPhases ) 
-        *puPhases = uPhases;
-    else
-        ABC_FREE( uPhases );
-    if ( puPerms ) 
-        *puPerms = uPerms;
-    else
-        ABC_FREE( uPerms );
     if ( puMap ) 
         *puMap = uMap;
     else
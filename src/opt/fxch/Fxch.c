@@ -36,59 +36,57 @@ ABC_NAMESPACE_IMPL_START
 ***********************************************************************/
 void Fxch_CubesGruping(Fxch_Man_t* pFxchMan)
 {
-    Vec_Int_t* vCube;
-    int iCube, nOutputs, SizeOutputID;
+    Vec_Int_t* vCube,
+             * vOutputMap;
+    int iCube, IdMax = 0;
     Hsh_VecMan_t* pCubeHash;
 
     /* Identify the number of Outputs and create the translation table */
+    Vec_WecForEachLevel( pFxchMan->vCubes, vCube, iCube )
+        IdMax = Abc_MaxInt( IdMax, Vec_IntEntry( vCube, 0 ) );
+    vOutputMap = Vec_IntStartFull( IdMax + 1 );
+
     pFxchMan->vTranslation = Vec_IntAlloc( 32 );
     Vec_WecForEachLevel( pFxchMan->vCubes, vCube, iCube )
     {
         int Id = Vec_IntEntry( vCube, 0 );
-        int iTranslation = Vec_IntFind( pFxchMan->vTranslation, Id );
 
-        if ( iTranslation == -1 )
+        if ( Vec_IntEntry( vOutputMap, Id ) == -1 )
+        {
+            Vec_IntWriteEntry( vOutputMap, Id, Vec_IntSize( pFxchMan->vTranslation ) );
             Vec_IntPush( pFxchMan->vTranslation, Id );
+        }
     }
-    nOutputs = Vec_IntSize( pFxchMan->vTranslation );
-
-    /* Size of the OutputID in number o ints */
-    SizeOutputID = ( nOutputs >> 5 ) + ( ( nOutputs & 31 ) > 0 );
 
     /* Initialize needed structures */
-    pFxchMan->vOutputID = Vec_IntAlloc( 4096 );
-    pFxchMan->pTempOutputID = ABC_CALLOC( int, SizeOutputID );
-    pFxchMan->nSizeOutputID = SizeOutputID;
+    pFxchMan->vOutputID = Vec_WecAlloc( Vec_WecSize( pFxchMan->vCubes ) );
+    pFxchMan->vTempOutputID = Vec_IntAlloc( 16 );
 
     pCubeHash =  Hsh_VecManStart( 1024 );
 
     /* Identify equal cubes */
     Vec_WecForEachLevel( pFxchMan->vCubes, vCube, iCube )
     {
-        int Id = Vec_IntEntry( vCube, 0 );
-        int iTranslation = Vec_IntFind( pFxchMan->vTranslation, Id );
-        int i, iCubeNoID, Temp, * pEntry;
+        int iTranslation = Vec_IntEntry( vOutputMap, Vec_IntEntry( vCube, 0 ) );
+        int iCubeNoID;
         Vec_IntWriteEntry( vCube, 0, 0 ); // Clear ID, Outputs will be identified by it later
 
         iCubeNoID = Hsh_VecManAdd( pCubeHash, vCube );
-        Temp = ( 1 << ( iTranslation & 31 ) );
-        if ( iCubeNoID == Vec_IntSize( pFxchMan->vOutputID ) / SizeOutputID )
+        if ( iCubeNoID == Vec_WecSize( pFxchMan->vOutputID ) )
         {
-            for ( i = 0; i < SizeOutputID; i++ )
-                pFxchMan->pTempOutputID[i] = 0;
-
-            pFxchMan->pTempOutputID[ iTranslation >> 5 ] = Temp;
-            Vec_IntPushArray( pFxchMan->vOutputID, pFxchMan->pTempOutputID, SizeOutputID ); 
+            Vec_Int_t* vOutputID = Vec_WecPushLevel( pFxchMan->vOutputID );
+            Vec_IntGrow( vOutputID, 1 );
+            Vec_IntPush( vOutputID, iTranslation );
         }
         else
         {
             Vec_IntClear( vCube );
-            pEntry = Vec_IntEntryP( pFxchMan->vOutputID, ( iCubeNoID * SizeOutputID ) + ( iTranslation >> 5 ) );
-            *pEntry |= Temp;
+            Vec_IntPushUniqueOrder( Vec_WecEntry( pFxchMan->vOutputID, iCubeNoID ), iTranslation );
         }
     }
 
     Hsh_VecManStop( pCubeHash );
+    Vec_IntFree( vOutputMap );
     Vec_WecRemoveEmpty( pFxchMan->vCubes );
 }
 
@@ -106,42 +104,35 @@ void Fxch_CubesGruping(Fxch_Man_t* pFxchMan)
 void Fxch_CubesUnGruping(Fxch_Man_t* pFxchMan)
 {
     int iCube;
-    int i, j;
+    int i, iOutput;
     Vec_Int_t* vCube;
     Vec_Int_t* vNewCube;
+    Vec_Int_t* vOutputID;
 
-    assert( Vec_WecSize( pFxchMan->vCubes ) == ( Vec_IntSize( pFxchMan->vOutputID ) / pFxchMan->nSizeOutputID ) );
+    assert( Vec_WecSize( pFxchMan->vCubes ) == Vec_WecSize( pFxchMan->vOutputID ) );
     Vec_WecForEachLevel( pFxchMan->vCubes, vCube, iCube )
     {
-        int * pOutputID, nOnes;
         if ( Vec_IntSize( vCube ) == 0 || Vec_IntEntry( vCube, 0 ) != 0 )
             continue;
 
-        pOutputID = Vec_IntEntryP( pFxchMan->vOutputID, iCube * pFxchMan->nSizeOutputID );
-        nOnes = 0;
-
-        for ( i = 0; i < pFxchMan->nSizeOutputID; i++ )
-            nOnes += Fxch_CountOnes( (unsigned int) pOutputID[i] );
-
-        for ( i = 0; i < pFxchMan->nSizeOutputID && nOnes; i++ )
-            for ( j = 0; j < 32 && nOnes; j++ )
-                if ( pOutputID[i] & ( 1 << j ) )
-                {
-                    if ( nOnes == 1 )
-                        Vec_IntWriteEntry( vCube, 0, Vec_IntEntry( pFxchMan->vTranslation, ( i << 5 ) | j ) );
-                    else
-                    {
-                        vNewCube = Vec_WecPushLevel( pFxchMan->vCubes );
-                        Vec_IntAppend( vNewCube, vCube );
-                        Vec_IntWriteEntry( vNewCube, 0, Vec_IntEntry( pFxchMan->vTranslation, (i << 5 ) | j ) );
-                    }
-                    nOnes -= 1;
-                }
+        vOutputID = Fxch_ManGetOutputID( pFxchMan, iCube );
+        Vec_IntForEachEntry( vOutputID, iOutput, i )
+        {
+            if ( i == Vec_IntSize( vOutputID ) - 1 )
+                Vec_IntWriteEntry( vCube, 0, Vec_IntEntry( pFxchMan->vTranslation, iOutput ) );
+            else
+            {
+                vNewCube = Vec_WecPushLevel( pFxchMan->vCubes );
+                vCube = Vec_WecEntry( pFxchMan->vCubes, iCube );
+                Vec_IntAppend( vNewCube, vCube );
+                Vec_IntWriteEntry( vNewCube, 0, Vec_IntEntry( pFxchMan->vTranslation, iOutput ) );
+            }
+        }
     }
 
     Vec_IntFree( pFxchMan->vTranslation );
-    Vec_IntFree( pFxchMan->vOutputID );
-    ABC_FREE( pFxchMan->pTempOutputID );
+    Vec_WecFree( pFxchMan->vOutputID );
+    Vec_IntFree( pFxchMan->vTempOutputID );
     return;
 }
 
@@ -169,6 +160,7 @@ int Fxch_FastExtract( Vec_Wec_t* vCubes,
 
     TempTime = Abc_Clock();
     Fxch_CubesGruping( pFxchMan );
+    Fxch_ManCompactCubes( pFxchMan );
     Fxch_ManMapLiteralsIntoCubes( pFxchMan, ObjIdMax );
     Fxch_ManGenerateLitHashKeys( pFxchMan );
     Fxch_ManComputeLevel( pFxchMan );
@@ -199,6 +191,7 @@ int Fxch_FastExtract( Vec_Wec_t* vCubes,
     if ( fVerbose )
     {
         Fxch_ManPrintStats( pFxchMan );
+        Fxch_ManPrintMemory( pFxchMan );
         Abc_PrintTime( 1, "\n[FXCH] Elapsed Time", pFxchMan->timeInit + pFxchMan->timeExt );
         Abc_PrintTime( 1, "[FXCH]    +-> Init", pFxchMan->timeInit );
         Abc_PrintTime( 1, "[FXCH]    +-> Extr", pFxchMan->timeExt );
@@ -109,9 +109,8 @@ struct Fxch_Man_t_
 
     // Cube Grouping
     Vec_Int_t* vTranslation;
-    Vec_Int_t* vOutputID;
-    int* pTempOutputID;
-    int  nSizeOutputID;
+    Vec_Wec_t* vOutputID;      /* sorted list of (translated) outputs of each cube */
+    Vec_Int_t* vTempOutputID;
 
     // temporary data to update the data-structure when a divisor is extracted
     Vec_Int_t* vCubesS;    /* cubes for the given single cube divisor */
@@ -169,6 +168,7 @@ int Fxch_DivIsNotConstant1( Vec_Int_t* vDiv );
 /*===== FxchMan.c ====================================================================================================*/
 Fxch_Man_t* Fxch_ManAlloc( Vec_Wec_t* vCubes );
 void  Fxch_ManFree( Fxch_Man_t* pFxchMan );
+void  Fxch_ManCompactCubes( Fxch_Man_t* pFxchMan );
 void  Fxch_ManMapLiteralsIntoCubes( Fxch_Man_t* pFxchMan, int nVars );
 void  Fxch_ManGenerateLitHashKeys( Fxch_Man_t* pFxchMan );
 void  Fxch_ManSCHashTablesInit( Fxch_Man_t* pFxchMan );
@@ -180,6 +180,7 @@ void  Fxch_ManComputeLevel( Fxch_Man_t* pFxchMan );
 void  Fxch_ManUpdate( Fxch_Man_t* pFxchMan, int iDiv );
 void  Fxch_ManPrintDivs( Fxch_Man_t* pFxchMan );
 void  Fxch_ManPrintStats( Fxch_Man_t* pFxchMan );
+void  Fxch_ManPrintMemory( Fxch_Man_t* pFxchMan );
 
 static inline Vec_Int_t* Fxch_ManGetCube( Fxch_Man_t* pFxchMan,
                                           int iCube )
@@ -187,6 +188,12 @@ static inline Vec_Int_t* Fxch_ManGetCube( Fxch_Man_t* pFxchMan,
     return Vec_WecEntry( pFxchMan->vCubes, iCube );
 }
 
+static inline Vec_Int_t* Fxch_ManGetOutputID( Fxch_Man_t* pFxchMan,
+                                              int iCube )
+{
+    return Vec_WecEntry( pFxchMan->vOutputID, iCube );
+}
+
 static inline int Fxch_ManGetLit( Fxch_Man_t* pFxchMan,
                                   int iCube,
                                   int iLit )
@@ -216,7 +223,7 @@ int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
                             uint32_t iLit1,
                             char fUpdate );
 
-unsigned int Fxch_SCHashTableMemory( Fxch_SCHashTable_t* );
+double Fxch_SCHashTableMemory( Fxch_SCHashTable_t* );
 void Fxch_SCHashTablePrint( Fxch_SCHashTable_t* );
 
 ABC_NAMESPACE_HEADER_END
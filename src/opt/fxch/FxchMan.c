@@ -67,18 +67,14 @@ static inline int Fxch_ManDivSingleCube( Fxch_Man_t* pFxchMan,
     Vec_IntForEachEntryStart( vCube, Lit0, i, 1)
     Vec_IntForEachEntryStart( vCube, Lit1, k, (i + 1) )
     {
-        int * pOutputID, nOnes, j, z;
+        int nOnes, z;
         assert( Lit0 < Lit1 );
 
         Vec_IntClear( pFxchMan->vCubeFree );
         Vec_IntPush( pFxchMan->vCubeFree, Abc_Var2Lit( Abc_LitNot( Lit0 ), 0 ) );
         Vec_IntPush( pFxchMan->vCubeFree, Abc_Var2Lit( Abc_LitNot( Lit1 ), 1 ) );
 
-        pOutputID = Vec_IntEntryP( pFxchMan->vOutputID, iCube * pFxchMan->nSizeOutputID );
-        nOnes = 0;
-
-        for ( j = 0; j < pFxchMan->nSizeOutputID; j++ )
-            nOnes += Fxch_CountOnes( pOutputID[j] );
+        nOnes = Vec_IntSize( Fxch_ManGetOutputID( pFxchMan, iCube ) );
 
         if ( nOnes == 0 )
             nOnes = 1;
@@ -212,6 +208,29 @@ void Fxch_ManFree( Fxch_Man_t* pFxchMan )
     ABC_FREE( pFxchMan );
 }
 
+/* Trims the literal and output arrays of each cube to their size, since
+ * covers are mostly made of short cubes */
+void Fxch_ManCompactCubes( Fxch_Man_t* pFxchMan )
+{
+    Vec_Int_t* vCube,
+             * vOutputID;
+    int i;
+
+    Vec_WecForEachLevelTwo( pFxchMan->vCubes, pFxchMan->vOutputID, vCube, vOutputID, i )
+    {
+        if ( Vec_IntCap( vCube ) > Vec_IntSize( vCube ) )
+        {
+            vCube->pArray = ABC_REALLOC( int, vCube->pArray, Vec_IntSize( vCube ) );
+            vCube->nCap = Vec_IntSize( vCube );
+        }
+        if ( Vec_IntCap( vOutputID ) > Vec_IntSize( vOutputID ) )
+        {
+            vOutputID->pArray = ABC_REALLOC( int, vOutputID->pArray, Vec_IntSize( vOutputID ) );
+            vOutputID->nCap = Vec_IntSize( vOutputID );
+        }
+    }
+}
+
 void Fxch_ManMapLiteralsIntoCubes( Fxch_Man_t* pFxchMan,
                                    int nVars )
 {
@@ -397,7 +416,7 @@ static inline void Fxch_ManExtractDivFromCubePairs( Fxch_Man_t* pFxchMan,
         int j, Lit,
             RetValue,
             fCompl = 0;
-        int * pOutputID0, * pOutputID1;
+        Vec_Int_t* vOutputID0, * vOutputID1;
 
         Vec_Int_t* vCube = NULL,
                  * vCube0 = Fxch_ManGetCube( pFxchMan, iCube0 ),
@@ -412,14 +431,11 @@ static inline void Fxch_ManExtractDivFromCubePairs( Fxch_Man_t* pFxchMan,
         pFxchMan->nLits -= Vec_IntSize( pFxchMan->vDiv ) + Vec_IntSize( vCube1 ) - 2;
 
         /* Identify type of Extraction */
-        pOutputID0 = Vec_IntEntryP( pFxchMan->vOutputID, iCube0 * pFxchMan->nSizeOutputID );
-        pOutputID1 = Vec_IntEntryP( pFxchMan->vOutputID, iCube1 * pFxchMan->nSizeOutputID );
-        RetValue = 1;
-        for ( j = 0; j < pFxchMan->nSizeOutputID && RetValue; j++ )
-            RetValue = ( pOutputID0[j] == pOutputID1[j] );
+        vOutputID0 = Fxch_ManGetOutputID( pFxchMan, iCube0 );
+        vOutputID1 = Fxch_ManGetOutputID( pFxchMan, iCube1 );
 
         /* Exact Extractraion */
-        if ( RetValue )
+        if ( Vec_IntEqual( vOutputID0, vOutputID1 ) )
         {
             Vec_IntClear( vCube0 );
             Vec_IntAppend( vCube0, vCube0Copy );
@@ -441,13 +457,18 @@ static inline void Fxch_ManExtractDivFromCubePairs( Fxch_Man_t* pFxchMan,
         /* Unexact Extraction */
         else
         {
-            for ( j = 0; j < pFxchMan->nSizeOutputID; j++ )
-                pFxchMan->pTempOutputID[j] = ( pOutputID0[j] & pOutputID1[j] );
+            Vec_IntTwoFindCommon( vOutputID0, vOutputID1, pFxchMan->vTempOutputID );
 
-            /* Create new cube */
+            /* Create new cube (pushing may move the cubes and their outputs) */
             vCube = Vec_WecPushLevel( pFxchMan->vCubes );
             Vec_IntAppend( vCube, vCube0Copy );
-            Vec_IntPushArray( pFxchMan->vOutputID, pFxchMan->pTempOutputID, pFxchMan->nSizeOutputID );
+            vOutputID0 = Vec_WecPushLevel( pFxchMan->vOutputID );
+            Vec_IntGrow( vOutputID0, Vec_IntSize( pFxchMan->vTempOutputID ) );
+            Vec_IntAppend( vOutputID0, pFxchMan->vTempOutputID );
+            vCube0 = Fxch_ManGetCube( pFxchMan, iCube0 );
+            vCube1 = Fxch_ManGetCube( pFxchMan, iCube1 );
+            vOutputID0 = Fxch_ManGetOutputID( pFxchMan, iCube0 );
+            vOutputID1 = Fxch_ManGetOutputID( pFxchMan, iCube1 );
             Vec_IntPush( pFxchMan->vCubesToUpdate, Vec_WecLevelId( pFxchMan->vCubes, vCube ) );
 
             /* Update Lit -> Cube mapping */
@@ -455,28 +476,16 @@ static inline void Fxch_ManExtractDivFromCubePairs( Fxch_Man_t* pFxchMan,
                 Vec_WecPush( pFxchMan->vLits, Lit, Vec_WecLevelId( pFxchMan->vCubes, vCube ) );
 
             /*********************************************************/
-            RetValue = 0;
-            for ( j = 0; j < pFxchMan->nSizeOutputID; j++ )
-            {
-                pFxchMan->pTempOutputID[j] = pOutputID0[j];
-                RetValue |= ( pOutputID0[j] & ~( pOutputID1[j] ) );
-                pOutputID0[j] &= ~( pOutputID1[j] );
-            }
+            Vec_IntClear( pFxchMan->vTempOutputID );
+            Vec_IntAppend( pFxchMan->vTempOutputID, vOutputID0 );
 
-            if ( RetValue != 0 )
+            if ( Vec_IntTwoRemove( vOutputID0, vOutputID1 ) )
                 Vec_IntPush( pFxchMan->vCubesToUpdate, iCube0 );
             else
                 Vec_IntClear( vCube0 );
 
             /*********************************************************/
-            RetValue = 0;
-            for ( j = 0; j < pFxchMan->nSizeOutputID; j++ )
-            {
-                RetValue |= ( pOutputID1[j] & ~( pFxchMan->pTempOutputID[j] ) );
-                pOutputID1[j] &= ~( pFxchMan->pTempOutputID[j] );
-            }
-
-            if ( RetValue != 0 )
+            if ( Vec_IntTwoRemove( vOutputID1, pFxchMan->vTempOutputID ) )
                 Vec_IntPush( pFxchMan->vCubesToUpdate, iCube1 );
             else
                 Vec_IntClear( vCube1 );
@@ -514,8 +523,7 @@ static inline int Fxch_ManCreateCube( Fxch_Man_t* pFxchMan,
                                       int Lit1 )
 {
     int Level,
-        iVarNew,
-        j;
+        iVarNew;
     Vec_Int_t* vCube0,
              * vCube1;
 
@@ -523,10 +531,6 @@ static inline int Fxch_ManCreateCube( Fxch_Man_t* pFxchMan,
     iVarNew = pFxchMan->nVars;
     pFxchMan->nVars++;
 
-    /* Clear temporary outputID vector */
-    for ( j = 0; j < pFxchMan->nSizeOutputID; j++ )
-        pFxchMan->pTempOutputID[j] = 0;
-
     /* Create new Lit hash keys */
     Vec_IntPush( pFxchMan->vLitHashKeys, Gia_ManRandom(0) & 0x3FFFFFF );
     Vec_IntPush( pFxchMan->vLitHashKeys, Gia_ManRandom(0) & 0x3FFFFFF );
@@ -534,7 +538,7 @@ static inline int Fxch_ManCreateCube( Fxch_Man_t* pFxchMan,
     /* Create new Cube */
     vCube0 = Vec_WecPushLevel( pFxchMan->vCubes );
     Vec_IntPush( vCube0, iVarNew );
-    Vec_IntPushArray( pFxchMan->vOutputID, pFxchMan->pTempOutputID, pFxchMan->nSizeOutputID );
+    Vec_WecPushLevel( pFxchMan->vOutputID );
 
     if ( Vec_IntSize( pFxchMan->vDiv ) == 2 )
     {
@@ -552,7 +556,7 @@ static inline int Fxch_ManCreateCube( Fxch_Man_t* pFxchMan,
 
         vCube1 = Vec_WecPushLevel( pFxchMan->vCubes );
         Vec_IntPush( vCube1, iVarNew );
-        Vec_IntPushArray( pFxchMan->vOutputID, pFxchMan->pTempOutputID, pFxchMan->nSizeOutputID );
+        Vec_WecPushLevel( pFxchMan->vOutputID );
 
         vCube0 = Fxch_ManGetCube( pFxchMan, Vec_WecSize( pFxchMan->vCubes ) - 2 );
         Fxch_DivSepareteCubes( pFxchMan->vDiv, vCube0, vCube1 );
@@ -677,9 +681,8 @@ void Fxch_ManUpdate( Fxch_Man_t* pFxchMan,
 
         Vec_IntForEachEntryDouble( pFxchMan->vSCC, iCube0, iCube1, i )
         {
-            int j, RetValue = 1;
-            int* pOutputID0 = Vec_IntEntryP( pFxchMan->vOutputID, iCube0 * pFxchMan->nSizeOutputID );
-            int* pOutputID1 = Vec_IntEntryP( pFxchMan->vOutputID, iCube1 * pFxchMan->nSizeOutputID );
+            Vec_Int_t* vOutputID0 = Fxch_ManGetOutputID( pFxchMan, iCube0 ),
+                     * vOutputID1 = Fxch_ManGetOutputID( pFxchMan, iCube1 );
             vCube0 = Vec_WecEntry( pFxchMan->vCubes, iCube0 );
             vCube1 = Vec_WecEntry( pFxchMan->vCubes, iCube1 );
 
@@ -699,34 +702,23 @@ void Fxch_ManUpdate( Fxch_Man_t* pFxchMan,
 
             if ( Vec_IntSize( vCube0 ) == Vec_IntSize( vCube1 ) )
             {
-                for ( j = 0; j < pFxchMan->nSizeOutputID; j++ )
-                {
-                    pOutputID1[j] |= pOutputID0[j];
-                    pOutputID0[j] = 0;
-                }
+                Vec_IntTwoMerge2( vOutputID1, vOutputID0, pFxchMan->vTempOutputID );
+                Vec_IntClear( vOutputID1 );
+                Vec_IntAppend( vOutputID1, pFxchMan->vTempOutputID );
+                Vec_IntClear( vOutputID0 );
                 Vec_IntClear( Vec_WecEntry( pFxchMan->vCubes, iCube0 ) );
                 Vec_WecIntXorMark( vCube0 );
                 continue;
             }
 
-            for ( j = 0; j < pFxchMan->nSizeOutputID && RetValue; j++ )
-                RetValue = ( pOutputID0[j] == pOutputID1[j] );
-
-            if ( RetValue )
+            if ( Vec_IntEqual( vOutputID0, vOutputID1 ) )
             {
                 Vec_IntClear( Vec_WecEntry( pFxchMan->vCubes, iCube0 ) );
                 Vec_WecIntXorMark( vCube0 );
             }
             else
             {
-                RetValue = 0;
-                for ( j = 0; j < pFxchMan->nSizeOutputID; j++ )
-                {
-                    RetValue |= ( pOutputID0[j] & ~( pOutputID1[j] ) );
-                    pOutputID0[j] &= ~( pOutputID1[j] );
-                }
-
-                if ( RetValue == 0 )
+                if ( Vec_IntTwoRemove( vOutputID0, vOutputID1 ) == 0 )
                 {
                     Vec_IntClear( Vec_WecEntry( pFxchMan->vCubes, iCube0 ) );
                     Vec_WecIntXorMark( vCube0 );
@@ -778,6 +770,25 @@ void Fxch_ManPrintStats( Fxch_Man_t* pFxchMan )
     printf( "Extr  =%7d  \n", pFxchMan->nExtDivs );
 }
 
+void Fxch_ManPrintMemory( Fxch_Man_t* pFxchMan )
+{
+    double MemCubes = Vec_WecMemory( pFxchMan->vCubes ) + Vec_WecMemory( pFxchMan->vOutputID ),
+           MemLits  = Vec_WecMemory( pFxchMan->vLits ) + Vec_IntMemory( pFxchMan->vLitCount ) + Vec_IntMemory( pFxchMan->vLitHashKeys ),
+           MemSubs  = Fxch_SCHashTableMemory( pFxchMan->pSCHashTable ),
+           MemDivs  = Hsh_VecManMemory( pFxchMan->pDivHash ),
+           MemPrio  = Vec_FltMemory( pFxchMan->vDivWeights ) + Vec_QueMemory( pFxchMan->vDivPrio ),
+           MemPairs = Vec_WecMemory( pFxchMan->vDivCubePairs ),
+           MemTotal = MemCubes + MemLits + MemSubs + MemDivs + MemPrio + MemPairs;
+
+    ABC_PRMP( "Memory: Cubes       ", MemCubes, MemTotal );
+    ABC_PRMP( "Memory: Lit->cubes  ", MemLits,  MemTotal );
+    ABC_PRMP( "Memory: Sub-cubes   ", MemSubs,  MemTotal );
+    ABC_PRMP( "Memory: Divisors    ", MemDivs,  MemTotal );
+    ABC_PRMP( "Memory: Weights     ", MemPrio,  MemTotal );
+    ABC_PRMP( "Memory: Cube pairs  ", MemPairs, MemTotal );
+    ABC_PRMP( "Memory: TOTAL       ", MemTotal, MemTotal );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -129,20 +129,14 @@ static inline int Fxch_SCHashTableEntryCompare( Fxch_SCHashTable_t* pSCHashTable
     Vec_Int_t* vCube0 = Vec_WecEntry( vCubes, pSCData0->iCube ),
              * vCube1 = Vec_WecEntry( vCubes, pSCData1->iCube );
 
-    int* pOutputID0 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pSCData0->iCube * pSCHashTable->pFxchMan->nSizeOutputID ),
-       * pOutputID1 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pSCData1->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
-    int i, Result = 0;
-
     if ( !Vec_IntSize( vCube0 ) ||
          !Vec_IntSize( vCube1 ) ||
          Vec_IntEntry( vCube0, 0 ) != Vec_IntEntry( vCube1, 0 ) ||
          pSCData0->Id != pSCData1->Id )
         return 0;
 
-    for ( i = 0; i < pSCHashTable->pFxchMan->nSizeOutputID && Result == 0; i++ )
-        Result = ( pOutputID0[i] & pOutputID1[i] );
-
-    if ( Result == 0 )
+    if ( !Vec_IntTwoCountCommon( Fxch_ManGetOutputID( pSCHashTable->pFxchMan, pSCData0->iCube ),
+                                 Fxch_ManGetOutputID( pSCHashTable->pFxchMan, pSCData1->iCube ) ) )
         return 0;
 
     Vec_IntClear( &pSCHashTable->vSubCube0 );
@@ -194,16 +188,17 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
     MurmurHash3_x86_32( ( void* ) &SubCubeID, sizeof( int ), 0x9747b28c, &BinID);
     pBin = Fxch_SCHashTableBin( pSCHashTable, BinID );
 
+    /* Most bins hold one or two sub-cubes, so start small and grow by 1.5 */
     if ( pBin->vSCData == NULL )
     {
-        pBin->vSCData = ABC_CALLOC( Fxch_SubCube_t, 16 );
+        pBin->vSCData = ABC_CALLOC( Fxch_SubCube_t, 2 );
         pBin->Size = 0;
-        pBin->Cap = 16;
+        pBin->Cap = 2;
     }
     else if ( pBin->Size == pBin->Cap )
     {
         assert(pBin->Cap <= 0xAAAA);
-        pBin->Cap = ( pBin->Cap >> 1 ) * 3;
+        pBin->Cap += pBin->Cap >> 1;
         pBin->vSCData = ABC_REALLOC( Fxch_SubCube_t, pBin->vSCData, pBin->Cap );
     }
 
@@ -221,11 +216,9 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
     for ( iEntry = 0; iEntry < (int)pBin->Size - 1; iEntry++ )
     {
         Fxch_SubCube_t* pEntry = &( pBin->vSCData[iEntry] );
-        int* pOutputID0 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
-        int* pOutputID1 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pNewEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
-        int Result = 0;
+        int Result;
         int Base;
-        int iNewDiv = -1, i, z;
+        int iNewDiv = -1, z;
 
         if ( (pEntry->iLit1 != 0 && pNewEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNewEntry->iLit1 != 0)  )
             continue;
@@ -257,8 +250,8 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
         if ( Base < 0 )
             continue;
 
-        for ( i = 0; i < pSCHashTable->pFxchMan->nSizeOutputID; i++ )
-            Result += Fxch_CountOnes( pOutputID0[i] & pOutputID1[i] );
+        Result = Vec_IntTwoCountCommon( Fxch_ManGetOutputID( pSCHashTable->pFxchMan, pEntry->iCube ),
+                                        Fxch_ManGetOutputID( pSCHashTable->pFxchMan, pNewEntry->iCube ) );
 
         for ( z = 0; z < Result; z++ )
             iNewDiv = Fxch_DivAdd( pSCHashTable->pFxchMan, fUpdate, 0, Base );
@@ -316,9 +309,7 @@ int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
 
         Fxch_SubCube_t* pNextEntry = &( pBin->vSCData[idx] );
         Vec_Int_t* vDivCubePairs;
-        int* pOutputID0 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
-        int* pOutputID1 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pNextEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
-        int Result = 0;
+        int Result;
 
         if ( (pEntry->iLit1 != 0 && pNextEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNextEntry->iLit1 != 0)  )
             continue;
@@ -333,8 +324,8 @@ int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
         if ( Base < 0 )
             continue;
 
-        for ( i = 0; i < pSCHashTable->pFxchMan->nSizeOutputID; i++ )
-            Result += Fxch_CountOnes( pOutputID0[i] & pOutputID1[i] );
+        Result = Vec_IntTwoCountCommon( Fxch_ManGetOutputID( pSCHashTable->pFxchMan, pEntry->iCube ),
+                                        Fxch_ManGetOutputID( pSCHashTable->pFxchMan, pNextEntry->iCube ) );
 
         for ( z = 0; z < Result; z++ )
             iDiv = Fxch_DivRemove( pSCHashTable->pFxchMan, fUpdate, 0, Base );
@@ -359,25 +350,29 @@ int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
     return Pairs;
 }
 
-unsigned int Fxch_SCHashTableMemory( Fxch_SCHashTable_t* pHashTable )
+double Fxch_SCHashTableMemory( Fxch_SCHashTable_t* pHashTable )
 {
-    unsigned int Memory = sizeof ( Fxch_SCHashTable_t );
+    double Memory = sizeof ( Fxch_SCHashTable_t );
+    unsigned i;
 
-    Memory += sizeof( Fxch_SubCube_t ) * ( pHashTable->SizeMask + 1 );
+    Memory += sizeof( Fxch_SCHashTable_Entry_t ) * ( pHashTable->SizeMask + 1 );
+    for ( i = 0; i <= pHashTable->SizeMask; i++ )
+        Memory += sizeof( Fxch_SubCube_t ) * pHashTable->pBins[i].Cap;
+    Memory += Vec_IntMemory( &pHashTable->vSubCube0 ) + Vec_IntMemory( &pHashTable->vSubCube1 );
 
     return Memory;
 }
 
 void Fxch_SCHashTablePrint( Fxch_SCHashTable_t* pHashTable )
 {
-    int Memory;
+    double Memory;
     printf( "SubCube Hash Table at %p\n", ( void* )pHashTable );
     printf("%20s %20s\n", "nEntries",
                           "Memory Usage (MB)" );
 
     Memory = Fxch_SCHashTableMemory( pHashTable );
     printf("%20d %18.2f\n", pHashTable->nEntries,
-                            ( ( double ) Memory / 1048576 ) );
+                            ( Memory / 1048576 ) );
 }
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
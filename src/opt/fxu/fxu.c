@@ -37,6 +37,36 @@ static int s_MemoryPeak;
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Prints memory used by the sparse matrix.]
+
+  Description [Entries of all types are fetched from the same fixed-size 
+  memory manager, so each entry takes the size of the largest type. The 
+  cube pairs are the entries in use that are not of the other types.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Fxu_MatrixPrintMemory( Fxu_Matrix * p )
+{
+    double MemTotal = Extra_MmFixedReadMemUsage( p->pMemMan );
+    double nEntry   = Extra_MmFixedReadEntrySize( p->pMemMan );
+    int nUsed       = Extra_MmFixedReadEntriesUsed( p->pMemMan );
+    int nPairs      = nUsed - p->lCubes.nItems - p->lVars.nItems - p->nEntries - p->lSingles.nItems - p->nDivs;
+    ABC_PRMP( "Memory: Cubes        ", nEntry * p->lCubes.nItems,   MemTotal );
+    ABC_PRMP( "Memory: Variables    ", nEntry * p->lVars.nItems,    MemTotal );
+    ABC_PRMP( "Memory: Literals     ", nEntry * p->nEntries,        MemTotal );
+    ABC_PRMP( "Memory: Single divs  ", nEntry * p->lSingles.nItems, MemTotal );
+    ABC_PRMP( "Memory: Double divs  ", nEntry * p->nDivs,           MemTotal );
+    ABC_PRMP( "Memory: Cube pairs   ", nEntry * nPairs,             MemTotal );
+    ABC_PRMP( "Memory: Free entries ", MemTotal - nEntry * nUsed,   MemTotal );
+    ABC_PRMP( "Memory: Allocated    ", MemTotal,                    MemTotal );
+    ABC_PRM ( "Memory: Divisor table", (double)sizeof(Fxu_ListDouble) * p->nTableSize );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs fast_extract on a set of covers.]
@@ -71,8 +101,8 @@ int Fxu_FastExtract( Fxu_Data_t * pData )
     p = Fxu_CreateMatrix( pData );
     if ( p == NULL )
         return -1;
-//    if ( pData->fVerbose )
-//        printf( "Memory usage after construction: Total = %d. Peak = %d.\n", s_MemoryTotal, s_MemoryPeak );
+    if ( pData->fVerbose )
+        Fxu_MatrixPrintMemory( p );
 //Fxu_MatrixPrint( NULL, p );
 
     if ( pData->fOnlyS )
@@ -159,6 +189,8 @@ int Fxu_FastExtract( Fxu_Data_t * pData )
     if ( pData->fVerbose )
         printf( "Total single = %3d. Total double = %3d. Total compl = %3d.                    \n", 
         p->nDivs1, p->nDivs2, p->nDivs3 );
+    if ( pData->fVerbose )
+        Fxu_MatrixPrintMemory( p );
 
     // create the new covers
     if ( pData->nNodesNew )
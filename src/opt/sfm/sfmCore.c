@@ -52,9 +52,11 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
     pPars->nWinSizeMax  =  300;  // the maximum window size
     pPars->nGrowthLevel =    0;  // the maximum allowed growth in level
     pPars->nBTLimit     = 5000;  // the maximum number of conflicts in one SAT run
+    pPars->nProcs       =    1;  // the number of concurrent threads
     pPars->fRrOnly      =    0;  // perform redundancy removal
     pPars->fArea        =    0;  // performs optimization for area
     pPars->fMoreEffort  =    0;  // performs high-affort minimization
+    pPars->fUseSim      =    1;  // enable simulation
     pPars->fAllBoxes    =    0;  // enable preserving all boxes
     pPars->fVerbose     =    0;  // enable basic stats
     pPars->fVeryVerbose =    0;  // enable detailed stats
@@ -98,6 +100,78 @@ void Sfm_NtkPrintStats( Sfm_Ntk_t * p )
 //    ABC_PRTP( "   ", p->time1    ,  p->timeTotal );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Groups the CEXes by the values of the remaining fanins.]
+
+  Description [When fanin f is replaced, the new fanin should distinguish
+  the onset and offset CEXes of each class. Keeps the classes containing
+  both and returns their number. If there is at least one such class, 
+  the fanin cannot be removed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sfm_NodeCexCollect( Sfm_Ntk_t * p, int iNode, int f )
+{
+    int nDivs = Vec_IntSize(p->vDivs), nFanins = Sfm_ObjFaninNum(p, iNode);
+    int nWords = p->nCexWords, nClasses = 0;
+    word * pOnset = Sfm_DivCexSign( p, nDivs + nFanins );
+    word * pCare;
+    int i, k, c, Key;
+    Vec_WrdClear( p->vCexCare );
+    Vec_IntClear( p->vCexKeysUsed );
+    for ( k = 0; k < p->nCexes; k++ )
+    {
+        for ( Key = i = 0; i < nFanins; i++ )
+            if ( i != f && Abc_TtGetBit(Sfm_DivCexSign(p, nDivs + i), k) )
+                Key |= (1 << i);
+        c = Vec_IntEntry( p->vCexKeys, Key );
+        if ( c == -1 )
+        {
+            c = nClasses++;
+            Vec_IntWriteEntry( p->vCexKeys, Key, c );
+            Vec_IntPush( p->vCexKeysUsed, Key );
+            Vec_WrdFillExtra( p->vCexCare, 2 * nClasses * nWords, 0 );
+        }
+        Abc_TtSetBit( Vec_WrdEntryP(p->vCexCare, (2 * c + !Abc_TtGetBit(pOnset, k)) * nWords), k );
+    }
+    Vec_IntForEachEntry( p->vCexKeysUsed, Key, i )
+        Vec_IntWriteEntry( p->vCexKeys, Key, -1 );
+    // keep the classes with both onset and offset CEXes
+    pCare = Vec_WrdArray( p->vCexCare );
+    for ( c = k = 0; c < nClasses; c++ )
+    {
+        if ( Abc_TtIsConst0(pCare + 2 * c * nWords, nWords) || Abc_TtIsConst0(pCare + (2 * c + 1) * nWords, nWords) )
+            continue;
+        if ( c > k )
+            memmove( pCare + 2 * k * nWords, pCare + 2 * c * nWords, sizeof(word) * 2 * nWords );
+        k++;
+    }
+    return (p->nCexCare = k);
+}
+static inline int Sfm_NodeCexIsCand( Sfm_Ntk_t * p, int iVar )
+{
+    word * pSign = Sfm_DivCexSign( p, iVar ), * pOn, * pOff;
+    int c, w, fPos, fNeg;
+    for ( c = 0; c < p->nCexCare; c++ )
+    {
+        pOn  = Vec_WrdEntryP( p->vCexCare, 2 * c * p->nCexWords );
+        pOff = pOn + p->nCexWords;
+        fPos = fNeg = 1;
+        for ( w = 0; w < p->nCexWords; w++ )
+        {
+            fPos &= !((pOn[w] & ~pSign[w]) | (pOff[w] &  pSign[w]));
+            fNeg &= !((pOn[w] &  pSign[w]) | (pOff[w] & ~pSign[w]));
+        }
+        if ( !fPos && !fNeg )
+            return 0;
+    }
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs resubstitution for the node.]
@@ -116,7 +190,8 @@ int Sfm_NodeResubSolve( Sfm_Ntk_t * p, int iNode, int f, int fRemoveOnly )
     int i, iFanin, iVar = -1;
     int iFaninRem = -1, iFaninSkip = -1;
     int nFanins = Sfm_ObjFaninNum(p, iNode); 
-    word uTruth, uSign, uMask;
+    int nDivTries = 0;
+    word uTruth = 0;
     abctime clk;
     assert( Sfm_ObjIsNode(p, iNode) );
     assert( f >= 0 && f < Sfm_ObjFaninNum(p, iNode) );
@@ -126,9 +201,6 @@ int Sfm_NodeResubSolve( Sfm_Ntk_t * p, int iNode, int f, int fRemoveOnly )
         printf( "%5d : Lev =%3d. Leaf =%3d.  Node =%3d.  Div=%3d.  Fanin =%4d (%d/%d). MFFC = %d\n", 
             iNode, Sfm_ObjLevel(p, iNode), 0, Vec_IntSize(p->vNodes), Vec_IntSize(p->vDivs), 
             Sfm_ObjFanin(p, iNode, f), f, Sfm_ObjFaninNum(p, iNode), Sfm_ObjMffcSize(p, Sfm_ObjFanin(p, iNode, f)) );
-    // clean simulation info
-    p->nCexes = 0;
-    Vec_WrdFill( p->vDivCexes, Vec_IntSize(p->vDivs), 0 );
     // try removing the critical fanin
     Vec_IntClear( p->vDivIds );
     Sfm_ObjForEachFanin( p, iNode, iFanin, i )
@@ -140,17 +212,21 @@ int Sfm_NodeResubSolve( Sfm_Ntk_t * p, int iNode, int f, int fRemoveOnly )
     // find fanin to skip 
     if ( Sfm_ObjIsFixed(p, iFaninRem) && Sfm_ObjFaninNum(p, iFaninRem) == 1 )
         iFaninSkip = Sfm_ObjFanin(p, iFaninRem, 0);
+    // skip the SAT call if known CEXes show that the fanin cannot be removed
+    if ( !p->pPars->fUseSim || !Sfm_NodeCexCollect(p, iNode, f) )
+    {
 clk = Abc_Clock();
-    uTruth = Sfm_ComputeInterpolant( p );
+        uTruth = Sfm_ComputeInterpolant( p );
 p->timeSat += Abc_Clock() - clk;
-    // analyze outcomes
-    if ( uTruth == SFM_SAT_UNDEC )
-    {
-        p->nTimeOuts++;
-        return 0;
+        // analyze outcomes
+        if ( uTruth == SFM_SAT_UNDEC )
+        {
+            p->nTimeOuts++;
+            return 0;
+        }
+        if ( uTruth != SFM_SAT_SAT )
+            goto finish;
     }
-    if ( uTruth != SFM_SAT_SAT )
-        goto finish;
     if ( fRemoveOnly || p->pPars->fRrOnly || Vec_IntSize(p->vDivs) == 0 )
         return 0;
 
@@ -168,15 +244,24 @@ p->timeSat += Abc_Clock() - clk;
         if ( fVeryVerbose )
         {
             printf( "%3d: %3d ", p->nCexes, iVar );
-            Vec_WrdForEachEntry( p->vDivCexes, uSign, i )
-                printf( "%d", Abc_InfoHasBit((unsigned *)&uSign, p->nCexes-1) );
+            for ( i = 0; i < Vec_IntSize(p->vDivs); i++ )
+                printf( "%d", p->nCexes ? Abc_TtGetBit(Sfm_DivCexSign(p, i), p->nCexes-1) : 0 );
             printf( "\n" );
         }
-        // find the next divisor to try
-        uMask = (~(word)0) >> (64 - p->nCexes);
-        Vec_WrdForEachEntry( p->vDivCexes, uSign, iVar )
-            if ( uSign == uMask && Vec_IntEntry(p->vDivs, iVar) != iFaninSkip )
-                break;
+        // find the next divisor distinguishing the known CEXes
+        if ( p->pPars->fUseSim )
+        {
+            Sfm_NodeCexCollect( p, iNode, f );
+            for ( iVar = 0; iVar < Vec_IntSize(p->vDivs); iVar++ )
+                if ( Sfm_NodeCexIsCand(p, iVar) && Vec_IntEntry(p->vDivs, iVar) != iFaninSkip )
+                    break;
+        }
+        else // without the pattern pool, try the divisors in their order
+        {
+            for ( iVar++; iVar < Vec_IntSize(p->vDivs); iVar++ )
+                if ( Vec_IntEntry(p->vDivs, iVar) != iFaninSkip )
+                    break;
+        }
         if ( iVar == Vec_IntSize(p->vDivs) )
             return 0;
         assert( Vec_IntEntry(p->vDivs, iVar) != iFaninSkip );
@@ -193,7 +278,7 @@ p->timeSat += Abc_Clock() - clk;
         }
         if ( uTruth != SFM_SAT_SAT )
             goto finish;
-        if ( p->nCexes == 64 )
+        if ( ++nDivTries == 64 || Sfm_NtkCexIsFull(p) )
             return 0;
         // remove the last variable
         Vec_IntPop( p->vDivIds );
@@ -214,6 +299,15 @@ finish:
         p->nResubs++;
     if ( fSkipUpdate )
         return 0;
+    // record the change to be applied later
+    if ( p->fDelayUpdate )
+    {
+        p->ChgType     = 1;
+        p->ChgFanin    = f;
+        p->ChgFaninNew = (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar));
+        p->ChgTruth    = uTruth;
+        return 1;
+    }
     // update the network
     Sfm_NtkUpdate( p, iNode, f, (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar)), uTruth, p->pTruth );
     // the number of fanins cannot increase
@@ -280,9 +374,17 @@ p->timeSat += Abc_Clock() - clk;
     p->nImproves++;
     if ( fSkipUpdate )
         return 0;
+    // record the change to be applied later
+    if ( p->fDelayUpdate )
+    {
+        p->ChgType  = 2;
+        p->ChgTruth = uTruth;
+        return 1;
+    }
     // update truth table
     Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
     Sfm_TruthToCnf( uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
+    Sfm_ObjSetChanged( p, iNode );
     return 1;
 }
 int Sfm_NodeResub( Sfm_Ntk_t * p, int iNode )
@@ -382,27 +484,32 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
-    Sfm_NtkForEachNode( p, i )
+    if ( pPars->nProcs > 1 )
+        Counter = Sfm_NtkPerformPar( p, &CounterLarge );
+    else
     {
-        if ( Sfm_ObjIsFixed( p, i ) )
-            continue;
-        if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax )
-            continue;
-        //if ( Sfm_ObjFaninNum(p, i) < 2 )
-        //    continue;
-        if ( Sfm_ObjFaninNum(p, i) > SFM_SUPP_MAX )
+        Sfm_NtkForEachNode( p, i )
         {
-            CounterLarge++;
-            continue;
-        }
-        for ( k = 0; Sfm_NodeResub(p, i); k++ )
-        {
-//            Counter++;
-//            break;
+            if ( Sfm_ObjIsFixed( p, i ) )
+                continue;
+            if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax )
+                continue;
+            //if ( Sfm_ObjFaninNum(p, i) < 2 )
+            //    continue;
+            if ( Sfm_ObjFaninNum(p, i) > SFM_SUPP_MAX )
+            {
+                CounterLarge++;
+                continue;
+            }
+            for ( k = 0; Sfm_NodeResub(p, i); k++ )
+            {
+//                Counter++;
+//                break;
+            }
+            Counter += (k > 0);
+            if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
+                break;
         }
-        Counter += (k > 0);
-        if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
-            break;
     }
     p->nTotalNodesEnd = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesEnd = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
@@ -58,6 +58,7 @@ ABC_NAMESPACE_HEADER_START
 #define SFM_WIN_MAX   1000
 #define SFM_DEC_MAX   4
 #define SFM_SIM_WORDS 8
+#define SFM_CEX_WORDS 16
 
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -116,10 +117,16 @@ struct Sfm_Ntk_t_
     int               nResubs;     // number of resubstitutions
     // counter-examples
     int               nCexes;      // number of CEXes
-    Vec_Wrd_t *       vDivCexes;   // counter-examples
+    int               nCexWords;   // number of words in CEX signatures
+    int               nCexCare;    // number of CEX classes with onset and offset
+    Vec_Wrd_t *       vDivCexes;   // CEX signatures of divisors, fanins, and onset
+    Vec_Wrd_t *       vCexCare;    // onset/offset CEXes of each class
+    Vec_Int_t *       vCexKeys;    // mapping of fanin values into CEX classes
+    Vec_Int_t *       vCexKeysUsed;// fanin values of CEX classes
+    Vec_Wrd_t *       vSims;       // simulation info of the window
     // intermediate data
     Vec_Int_t *       vOrder;      // object order
-    Vec_Int_t *       vDivVars;    // divisor SAT variables
+    Vec_Int_t *       vDivVars;    // divisor and fanin SAT variables
     Vec_Int_t *       vDivIds;     // divisors indexes
     Vec_Int_t *       vLits;       // literals
     Vec_Int_t *       vValues;     // SAT variable values
@@ -129,6 +136,15 @@ struct Sfm_Ntk_t_
     word *            pTtElems[SFM_FANIN_MAX];
     word              pTruth[SFM_WORDS_MAX];
     word              pCube[SFM_WORDS_MAX];
+    // deferred updates (used by the parallel mode)
+    int               fDelayUpdate;// record the change instead of applying it
+    int               ChgType;     // the change type (1 = fanin resub; 2 = new function)
+    int               ChgFanin;    // the index of the fanin to be replaced
+    int               ChgFaninNew; // the new fanin (-1 if the fanin is removed)
+    word              ChgTruth;    // the new function
+    Vec_Int_t *       vChanged;    // the last batch that modified fanins of each object
+    Vec_Int_t *       vChangedFo;  // the last batch that modified fanouts of each object
+    int               iBatch;      // the current batch
     // nodes
     int               nTotalNodesBeg;
     int               nTotalEdgesBeg;
@@ -183,6 +199,14 @@ static inline void Sfm_ObjSetLevel( Sfm_Ntk_t * p, int iObj, int Lev )  { Vec_In
 static inline int  Sfm_ObjLevelR( Sfm_Ntk_t * p, int iObj )             { return Vec_IntEntry( &p->vLevelsR, iObj );                        }
 static inline void Sfm_ObjSetLevelR( Sfm_Ntk_t * p, int iObj, int Lev ) { Vec_IntWriteEntry( &p->vLevelsR, iObj, Lev );                     }
 
+static inline void Sfm_ObjSetChanged( Sfm_Ntk_t * p, int iObj )       { if ( p->vChanged && iObj >= 0 ) Vec_IntWriteEntry(p->vChanged, iObj, p->iBatch);     }
+static inline void Sfm_ObjSetChangedFo( Sfm_Ntk_t * p, int iObj )     { if ( p->vChangedFo && iObj >= 0 ) Vec_IntWriteEntry(p->vChangedFo, iObj, p->iBatch); }
+static inline int  Sfm_ObjIsChanged( Sfm_Ntk_t * p, int iObj )        { return Vec_IntEntry(p->vChanged, iObj) == p->iBatch;                                 }
+static inline int  Sfm_ObjIsChangedFo( Sfm_Ntk_t * p, int iObj )      { return Vec_IntEntry(p->vChangedFo, iObj) == p->iBatch;                               }
+
+static inline word * Sfm_DivCexSign( Sfm_Ntk_t * p, int i )          { return Vec_WrdEntryP( p->vDivCexes, i * p->nCexWords );          }
+static inline int  Sfm_NtkCexIsFull( Sfm_Ntk_t * p )                  { return p->nCexes == 64 * SFM_CEX_WORDS;                         }
+
 static inline int  Sfm_ObjUpdateFaninCount( Sfm_Ntk_t * p, int iObj )   { return Vec_IntAddToEntry(&p->vCounts, iObj, -1);                  }
 static inline void Sfm_ObjResetFaninCount( Sfm_Ntk_t * p, int iObj )    { Vec_IntWriteEntry(&p->vCounts, iObj, Sfm_ObjFaninNum(p, iObj)-1); }
 
@@ -209,6 +233,7 @@ extern int          Sfm_TruthToCnf( word Truth, word * pTruth, int nVars, Vec_In
 extern Vec_Wec_t *  Sfm_CreateCnf( Sfm_Ntk_t * p );
 extern void         Sfm_TranslateCnf( Vec_Wec_t * vRes, Vec_Str_t * vCnf, Vec_Int_t * vFaninMap, int iPivotVar );
 /*=== sfmCore.c ==========================================================*/
+extern int          Sfm_NodeResub( Sfm_Ntk_t * p, int iNode );
 /*=== sfmLib.c ==========================================================*/
 extern int          Sfm_LibFindComplInputGate( Vec_Wrd_t * vFuncs, int iGate, int nFanins, int iFanin, int * piFaninNew );
 extern Sfm_Lib_t *  Sfm_LibPrepare( int nVars, int fTwo, int fDelay, int fVerbose, int fLibVerbose );
@@ -223,8 +248,12 @@ extern int          Sfm_LibImplementGatesDelay( Sfm_Lib_t * p, int * pFanins, Mi
 extern Sfm_Ntk_t *  Sfm_ConstructNetwork( Vec_Wec_t * vFanins, int nPis, int nPos );
 extern void         Sfm_NtkPrepare( Sfm_Ntk_t * p );
 extern void         Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth, word * pTruth );
+/*=== sfmPar.c ==========================================================*/
+extern int          Sfm_NtkPerformPar( Sfm_Ntk_t * p, int * pCounterLarge );
 /*=== sfmSat.c ==========================================================*/
 extern int          Sfm_NtkWindowToSolver( Sfm_Ntk_t * p );
+extern void         Sfm_NtkAddCex( Sfm_Ntk_t * p, int fOnSet );
+extern void         Sfm_NtkAddSimCexes( Sfm_Ntk_t * p, word uCare );
 extern word         Sfm_ComputeInterpolant( Sfm_Ntk_t * p );
 extern word         Sfm_ComputeInterpolant2( Sfm_Ntk_t * p );
 /*=== sfmTim.c ==========================================================*/
@@ -254,6 +283,7 @@ extern int          Sfm_MitEvalRemapping( Sfm_Mit_t * p, Vec_Int_t * vMffc, Abc_
 /*=== sfmWin.c ==========================================================*/
 extern int          Sfm_ObjMffcSize( Sfm_Ntk_t * p, int iObj );
 extern int          Sfm_NtkCreateWindow( Sfm_Ntk_t * p, int iNode, int fVerbose );
+extern word         Sfm_NtkWindowSimulate( Sfm_Ntk_t * p );
 
 ABC_NAMESPACE_HEADER_END
 
@@ -206,6 +206,10 @@ void Sfm_NtkPrepare( Sfm_Ntk_t * p )
     p->vRoots    = Vec_IntAlloc( 1000 );
     p->vTfo      = Vec_IntAlloc( 1000 );
     p->vDivCexes = Vec_WrdStart( p->pPars->nWinSizeMax );
+    p->vCexCare  = Vec_WrdAlloc( 1000 );
+    p->vCexKeys  = Vec_IntStartFull( 1 << SFM_FANIN_MAX );
+    p->vCexKeysUsed = Vec_IntAlloc( 100 );
+    p->vSims     = Vec_WrdStart( 2 * p->nObjs );
     p->vOrder    = Vec_IntAlloc( 100 );
     p->vDivVars  = Vec_IntAlloc( 100 );
     p->vDivIds   = Vec_IntAlloc( 1000 );
@@ -242,6 +246,10 @@ void Sfm_NtkFree( Sfm_Ntk_t * p )
     Vec_IntFreeP( &p->vRoots );
     Vec_IntFreeP( &p->vTfo   );
     Vec_WrdFreeP( &p->vDivCexes );
+    Vec_WrdFreeP( &p->vCexCare );
+    Vec_IntFreeP( &p->vCexKeys );
+    Vec_IntFreeP( &p->vCexKeysUsed );
+    Vec_WrdFreeP( &p->vSims );
     Vec_IntFreeP( &p->vOrder );
     Vec_IntFreeP( &p->vDivVars );
     Vec_IntFreeP( &p->vDivIds );
@@ -294,10 +302,12 @@ void Sfm_NtkDeleteObj_rec( Sfm_Ntk_t * p, int iNode )
     Sfm_ObjForEachFanin( p, iNode, iFanin, i )
     {
         int RetValue = Vec_IntRemove( Sfm_ObjFoArray(p, iFanin), iNode );  assert( RetValue );
+        Sfm_ObjSetChangedFo( p, iFanin );
         Sfm_NtkDeleteObj_rec( p, iFanin );
     }
     Vec_IntClear( Sfm_ObjFiArray(p, iNode) );
     Vec_WrdWriteEntry( p->vTruths, iNode, (word)0 );
+    Sfm_ObjSetChanged( p, iNode );
 }
 void Sfm_NtkUpdateLevel_rec( Sfm_Ntk_t * p, int iNode )
 {
@@ -326,11 +336,16 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth,
     assert( Sfm_ObjIsNode(p, iNode) );
     assert( iFanin != iFaninNew );
     assert( Sfm_ObjFaninNum(p, iNode) <= SFM_FANIN_MAX );
+    // remember the objects whose fanins or fanouts are modified
+    Sfm_ObjSetChanged( p, iNode );
+    Sfm_ObjSetChangedFo( p, iFanin );
+    Sfm_ObjSetChangedFo( p, iFaninNew );
     if ( Abc_TtIsConst0(pTruth, nWords) || Abc_TtIsConst1(pTruth, nWords) )
     {
         Sfm_ObjForEachFanin( p, iNode, iFanin, f )
         {
             int RetValue = Vec_IntRemove( Sfm_ObjFoArray(p, iFanin), iNode );  assert( RetValue );
+            Sfm_ObjSetChangedFo( p, iFanin );
             Sfm_NtkDeleteObj_rec( p, iFanin );
         }
         Vec_IntClear( Sfm_ObjFiArray(p, iNode) );
@@ -0,0 +1,361 @@
+/**CFile****************************************************************
+
+  FileName    [sfmPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based optimization using internal don't-cares.]
+
+  Synopsis    [Concurrent evaluation of resubstitution windows.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: sfmPar.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "sfmInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define SFM_PAR_BATCH 512      // the number of nodes evaluated concurrently
+
+typedef struct Sfm_Res_t_ Sfm_Res_t;
+struct Sfm_Res_t_
+{
+    int               iNode;       // the node
+    int               Type;        // the change type (0 = none; 1 = fanin resub; 2 = new function)
+    int               Fanin;       // the index of the fanin to be replaced
+    int               FaninNew;    // the new fanin (-1 if the fanin is removed)
+    word              uTruth;      // the new function
+    word              pTruth[SFM_WORDS_MAX]; // the new function (large)
+    Vec_Int_t *       vWindow;     // the objects whose functions were used
+    Vec_Int_t *       vTfo;        // the objects whose fanouts were used
+};
+
+typedef struct Sfm_Job_t_ Sfm_Job_t;
+struct Sfm_Job_t_
+{
+    Sfm_Ntk_t *       pWork;       // the worker copy of the network
+    Sfm_Res_t *       pRes;        // the results of the batch
+    int               nRes;        // the number of results
+    int               iJob;        // the index of this job
+    int               nJobs;       // the number of jobs
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Creates a worker sharing the network with the manager.]
+
+  Description [The worker reads the structure, the functions, and the
+  levels of the manager but owns the traversal IDs, the window, and
+  the SAT solver. Instead of updating the network, it records the
+  change to be applied by the manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Sfm_Ntk_t * Sfm_NtkWorkerStart( Sfm_Ntk_t * p )
+{
+    Sfm_Ntk_t * pW = ABC_ALLOC( Sfm_Ntk_t, 1 );
+    int i;
+    memcpy( pW, p, sizeof(Sfm_Ntk_t) );
+    // the window computation temporarily changes the parameters
+    pW->pPars = ABC_ALLOC( Sfm_Par_t, 1 );
+    memcpy( pW->pPars, p->pPars, sizeof(Sfm_Par_t) );
+    pW->pPars->fVeryVerbose = 0;
+    // private attributes
+    memset( &pW->vCounts,   0, sizeof(Vec_Int_t) );
+    memset( &pW->vTravIds,  0, sizeof(Vec_Int_t) );
+    memset( &pW->vTravIds2, 0, sizeof(Vec_Int_t) );
+    memset( &pW->vId2Var,   0, sizeof(Vec_Int_t) );
+    memset( &pW->vVar2Id,   0, sizeof(Vec_Int_t) );
+    Vec_IntFill( &pW->vCounts,   p->nObjs,  0 );
+    Vec_IntFill( &pW->vTravIds,  p->nObjs,  0 );
+    Vec_IntFill( &pW->vTravIds2, p->nObjs,  0 );
+    Vec_IntFill( &pW->vId2Var,   2*p->nObjs, -1 );
+    Vec_IntFill( &pW->vVar2Id,   2*p->nObjs, -1 );
+    pW->nTravIds  = 0;
+    pW->nTravIds2 = 0;
+    pW->nSatVars  = 0;
+    pW->vCover    = Vec_IntAlloc( 1 << 16 );
+    pW->vChanged  = NULL;
+    pW->vChangedFo = NULL;
+    pW->fDelayUpdate = 1;
+    for ( i = 0; i < SFM_FANIN_MAX; i++ )
+        pW->pTtElems[i] = pW->TtElems[i];
+    // private window and SAT solver
+    Sfm_NtkPrepare( pW );
+    pW->nLevelMax = p->nLevelMax;
+    // statistics
+    pW->nTryRemoves = pW->nTryImproves = pW->nTryResubs = 0;
+    pW->nRemoves = pW->nImproves = pW->nResubs = 0;
+    pW->nNodesTried = pW->nTotalDivs = pW->nSatCalls = pW->nTimeOuts = pW->nMaxDivs = 0;
+    pW->timeWin = pW->timeDiv = pW->timeCnf = pW->timeSat = 0;
+    return pW;
+}
+static void Sfm_NtkWorkerStop( Sfm_Ntk_t * p, Sfm_Ntk_t * pW )
+{
+    // collect statistics
+    p->nTryRemoves  += pW->nTryRemoves;
+    p->nTryImproves += pW->nTryImproves;
+    p->nTryResubs   += pW->nTryResubs;
+    p->nNodesTried  += pW->nNodesTried;
+    p->nTotalDivs   += pW->nTotalDivs;
+    p->nSatCalls    += pW->nSatCalls;
+    p->nTimeOuts    += pW->nTimeOuts;
+    p->nMaxDivs      = Abc_MaxInt( p->nMaxDivs, pW->nMaxDivs );
+    p->timeWin      += pW->timeWin;
+    p->timeDiv      += pW->timeDiv;
+    p->timeCnf      += pW->timeCnf;
+    p->timeSat      += pW->timeSat;
+    // free private data
+    ABC_FREE( pW->vCounts.pArray );
+    ABC_FREE( pW->vTravIds.pArray );
+    ABC_FREE( pW->vTravIds2.pArray );
+    ABC_FREE( pW->vId2Var.pArray );
+    ABC_FREE( pW->vVar2Id.pArray );
+    Vec_IntFree( pW->vCover );
+    Vec_IntFreeP( &pW->vNodes );
+    Vec_IntFreeP( &pW->vDivs  );
+    Vec_IntFreeP( &pW->vRoots );
+    Vec_IntFreeP( &pW->vTfo   );
+    Vec_WrdFreeP( &pW->vDivCexes );
+    Vec_WrdFreeP( &pW->vCexCare );
+    Vec_IntFreeP( &pW->vCexKeys );
+    Vec_IntFreeP( &pW->vCexKeysUsed );
+    Vec_WrdFreeP( &pW->vSims );
+    Vec_IntFreeP( &pW->vOrder );
+    Vec_IntFreeP( &pW->vDivVars );
+    Vec_IntFreeP( &pW->vDivIds );
+    Vec_IntFreeP( &pW->vLits  );
+    Vec_IntFreeP( &pW->vValues );
+    Vec_WecFreeP( &pW->vClauses );
+    Vec_IntFreeP( &pW->vFaninMap );
+    if ( pW->pSat ) sat_solver_delete( pW->pSat );
+    ABC_FREE( pW->pPars );
+    ABC_FREE( pW );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the nodes of the batch assigned to one job.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sfm_NtkParEvalJob( void * pArg )
+{
+    Sfm_Job_t * pJob = (Sfm_Job_t *)pArg;
+    Sfm_Ntk_t * pW = pJob->pWork;
+    Sfm_Res_t * pRes;
+    int i;
+    for ( i = pJob->iJob; i < pJob->nRes; i += pJob->nJobs )
+    {
+        pRes = pJob->pRes + i;
+        pRes->Type = 0;
+        pW->ChgType = pW->ChgFanin = 0;
+        pW->ChgFaninNew = -1;
+        if ( !Sfm_NodeResub(pW, pRes->iNode) )
+            continue;
+        assert( pW->ChgType > 0 );
+        pRes->Type     = pW->ChgType;
+        pRes->Fanin    = pW->ChgFanin;
+        pRes->FaninNew = pW->ChgFaninNew;
+        pRes->uTruth   = pW->ChgTruth;
+        memcpy( pRes->pTruth, pW->pTruth, sizeof(word) * SFM_WORDS_MAX );
+        // remember the window, which should not change before the update:
+        // the functions of its nodes, and the fanouts of the TFO nodes
+        Vec_IntClear( pRes->vWindow );
+        Vec_IntPush( pRes->vWindow, pRes->iNode );
+        Vec_IntAppend( pRes->vWindow, pW->vOrder );
+        Vec_IntClear( pRes->vTfo );
+        Vec_IntPush( pRes->vTfo, pRes->iNode );
+        Vec_IntAppend( pRes->vTfo, pW->vTfo );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the node should be tried.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sfm_NtkParNodeIsCand( Sfm_Ntk_t * p, int i, int * pCounterLarge )
+{
+    if ( Sfm_ObjIsFixed( p, i ) )
+        return 0;
+    if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax )
+        return 0;
+    if ( Sfm_ObjFaninNum(p, i) > SFM_SUPP_MAX )
+    {
+        (*pCounterLarge)++;
+        return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution using concurrent threads.]
+
+  Description [The nodes are processed in batches. The windows of a
+  batch are computed and solved concurrently against the same state of
+  the network, each by a worker with its own window and SAT solver.
+  The resulting changes are then applied by the manager in the node
+  order. If an earlier change of the same batch modified an object of
+  the window, or raised the levels so that the new fanin violates the 
+  level limit (nGrowthLevel), the change is dropped and the node is 
+  tried again by the manager in the current network. The result does 
+  not depend on the number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkPerformPar( Sfm_Ntk_t * p, int * pCounterLarge )
+{
+    Sfm_Job_t * pJobs;
+    Sfm_Res_t * pRes, * pResAll;
+    Vec_Ptr_t * vData;
+    int nJobs = p->pPars->nProcs;
+    int i, k, iObj, iNext = p->nPis, nRes, Counter = 0;
+    int nBatches = 0, nConflicts = 0, fConflict, fStop = 0;
+    assert( p->pPars->nProcs > 1 );
+    *pCounterLarge = 0;
+    p->vChanged   = Vec_IntStartFull( p->nObjs );
+    p->vChangedFo = Vec_IntStartFull( p->nObjs );
+    p->iBatch   = 0;
+    // start the jobs
+    pResAll = ABC_CALLOC( Sfm_Res_t, SFM_PAR_BATCH );
+    for ( i = 0; i < SFM_PAR_BATCH; i++ )
+    {
+        pResAll[i].vWindow = Vec_IntAlloc( 100 );
+        pResAll[i].vTfo    = Vec_IntAlloc( 100 );
+    }
+    pJobs = ABC_CALLOC( Sfm_Job_t, nJobs );
+    vData = Vec_PtrAlloc( nJobs );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        pJobs[k].pWork = Sfm_NtkWorkerStart( p );
+        pJobs[k].pRes  = pResAll;
+        pJobs[k].iJob  = k;
+        pJobs[k].nJobs = nJobs;
+        Vec_PtrPush( vData, pJobs + k );
+    }
+    while ( !fStop )
+    {
+        // collect the batch
+        nRes = 0;
+        for ( ; nRes < SFM_PAR_BATCH && iNext + p->nPos < p->nObjs; iNext++ )
+            if ( Sfm_NtkParNodeIsCand(p, iNext, pCounterLarge) )
+                pResAll[nRes++].iNode = iNext;
+        if ( nRes == 0 )
+            break;
+        // evaluate the batch concurrently
+        for ( k = 0; k < nJobs; k++ )
+        {
+            Sfm_Ntk_t * pW = pJobs[k].pWork;
+            pW->vFanins  = p->vFanins;
+            pW->vFanouts = p->vFanouts;
+            pW->vLevels  = p->vLevels;
+            pW->vLevelsR = p->vLevelsR;
+            pJobs[k].nRes = nRes;
+        }
+        // the calling thread only dispatches the jobs
+        Util_ProcessThreads( Sfm_NtkParEvalJob, vData, p->pPars->nProcs + 1, 0, 0 );
+        nBatches++;
+        // apply the changes in the node order
+        p->iBatch++;
+        for ( i = 0; i < nRes && !fStop; i++ )
+        {
+            pRes = pResAll + i;
+            if ( pRes->Type == 0 )
+                continue;
+            fConflict = 0;
+            Vec_IntForEachEntry( pRes->vWindow, iObj, k )
+                fConflict |= Sfm_ObjIsChanged( p, iObj );
+            Vec_IntForEachEntry( pRes->vTfo, iObj, k )
+                fConflict |= Sfm_ObjIsChangedFo( p, iObj );
+            // the levels may have grown since the divisor was selected
+            if ( pRes->Type == 1 && pRes->FaninNew != -1 )
+                fConflict |= Sfm_ObjLevel(p, pRes->FaninNew) > p->nLevelMax - Sfm_ObjLevelR(p, pRes->iNode);
+            if ( fConflict )
+            {
+                // the window was modified by an earlier change; recompute it
+                nConflicts++;
+                if ( !Sfm_NodeResub(p, pRes->iNode) )
+                    continue;
+            }
+            else if ( pRes->Type == 1 )
+            {
+                if ( pRes->FaninNew == -1 )
+                    p->nRemoves++;
+                else
+                    p->nResubs++;
+                Sfm_NtkUpdate( p, pRes->iNode, pRes->Fanin, pRes->FaninNew, pRes->uTruth, pRes->pTruth );
+            }
+            else
+            {
+                p->nImproves++;
+                Vec_WrdWriteEntry( p->vTruths, pRes->iNode, pRes->uTruth );
+                Sfm_TruthToCnf( pRes->uTruth, NULL, Sfm_ObjFaninNum(p, pRes->iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, pRes->iNode) );
+                Sfm_ObjSetChanged( p, pRes->iNode );
+            }
+            // the updated node is tried again until it cannot be improved
+            while ( Sfm_NodeResub(p, pRes->iNode) );
+            Counter++;
+            if ( p->pPars->nNodesMax && Counter >= p->pPars->nNodesMax )
+                fStop = 1;
+        }
+    }
+    if ( p->pPars->fVerbose )
+        printf( "Evaluated %d batches using %d threads. Recomputed %d windows modified by earlier changes.\n", nBatches, p->pPars->nProcs, nConflicts );
+    // stop the jobs
+    for ( k = 0; k < nJobs; k++ )
+        Sfm_NtkWorkerStop( p, pJobs[k].pWork );
+    for ( i = 0; i < SFM_PAR_BATCH; i++ )
+    {
+        Vec_IntFree( pResAll[i].vWindow );
+        Vec_IntFree( pResAll[i].vTfo );
+    }
+    ABC_FREE( pResAll );
+    ABC_FREE( pJobs );
+    Vec_PtrFree( vData );
+    Vec_IntFreeP( &p->vChanged );
+    Vec_IntFreeP( &p->vChangedFo );
+    return Counter;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -65,6 +65,14 @@ int Sfm_NtkWindowToSolver( Sfm_Ntk_t * p )
     Vec_IntClear( p->vDivVars );
     Vec_IntForEachEntry( p->vDivs, iNode, i )
         Vec_IntPush( p->vDivVars, Sfm_ObjSatVar(p, iNode) );
+    Sfm_ObjForEachFanin( p, p->iPivotNode, iFanin, i )
+        Vec_IntPush( p->vDivVars, Sfm_ObjSatVar(p, iFanin) );
+    // start the pattern pool of the window
+    p->nCexes = 0;
+    p->nCexWords = 1;
+    Vec_WrdFill( p->vDivCexes, Vec_IntSize(p->vDivVars) + 1, 0 );
+    if ( p->pPars->fUseSim )
+        Sfm_NtkAddSimCexes( p, Sfm_NtkWindowSimulate(p) );
     // add CNF clauses for the TFI
     Vec_IntForEachEntry( p->vOrder, iNode, i )
     {
@@ -140,6 +148,69 @@ int Sfm_NtkWindowToSolver( Sfm_Ntk_t * p )
     return RetValue;
 } 
 
+/**Function*************************************************************
+
+  Synopsis    [Adds a care minterm to the pattern pool.]
+
+  Description [The pool is shared by all SAT calls of the window. The 
+  signatures of divisors and fanins are followed by the signature of 
+  the onset. They are expanded as needed. The minterm is taken from
+  the current SAT assignment or from the simulation info.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sfm_NtkCexGrow( Sfm_Ntk_t * p )
+{
+    int i, nVars = Vec_IntSize(p->vDivVars);
+    word * pCexes;
+    if ( Sfm_NtkCexIsFull(p) )
+        return 0;
+    if ( p->nCexes < 64 * p->nCexWords )
+        return 1;
+    Vec_WrdFillExtra( p->vDivCexes, 2 * (nVars + 1) * p->nCexWords, 0 );
+    pCexes = Vec_WrdArray( p->vDivCexes );
+    for ( i = nVars; i >= 0; i-- )
+    {
+        memmove( pCexes + 2 * i * p->nCexWords, pCexes + i * p->nCexWords, sizeof(word) * p->nCexWords );
+        memset( pCexes + (2 * i + 1) * p->nCexWords, 0, sizeof(word) * p->nCexWords );
+    }
+    p->nCexWords *= 2;
+    return 1;
+}
+void Sfm_NtkAddCex( Sfm_Ntk_t * p, int fOnSet )
+{
+    int i, iVar;
+    if ( !Sfm_NtkCexGrow(p) )
+        return;
+    Vec_IntForEachEntry( p->vDivVars, iVar, i )
+        if ( sat_solver_var_value(p->pSat, iVar) )
+            Abc_TtSetBit( Sfm_DivCexSign(p, i), p->nCexes );
+    if ( fOnSet )
+        Abc_TtSetBit( Sfm_DivCexSign(p, Vec_IntSize(p->vDivVars)), p->nCexes );
+    p->nCexes++;
+}
+void Sfm_NtkAddSimCexes( Sfm_Ntk_t * p, word uCare )
+{
+    int i, k, iNode, nDivs = Vec_IntSize(p->vDivs);
+    for ( k = 0; k < 64; k++ )
+    {
+        if ( !((uCare >> k) & 1) || !Sfm_NtkCexGrow(p) )
+            continue;
+        Vec_IntForEachEntry( p->vDivs, iNode, i )
+            if ( (Vec_WrdEntry(p->vSims, 2 * iNode) >> k) & 1 )
+                Abc_TtSetBit( Sfm_DivCexSign(p, i), p->nCexes );
+        Sfm_ObjForEachFanin( p, p->iPivotNode, iNode, i )
+            if ( (Vec_WrdEntry(p->vSims, 2 * iNode) >> k) & 1 )
+                Abc_TtSetBit( Sfm_DivCexSign(p, nDivs + i), p->nCexes );
+        if ( (Vec_WrdEntry(p->vSims, 2 * p->iPivotNode) >> k) & 1 )
+            Abc_TtSetBit( Sfm_DivCexSign(p, Vec_IntSize(p->vDivVars)), p->nCexes );
+        p->nCexes++;
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Takes SAT solver and returns interpolant.]
@@ -153,7 +224,6 @@ int Sfm_NtkWindowToSolver( Sfm_Ntk_t * p )
 ***********************************************************************/
 word Sfm_ComputeInterpolant( Sfm_Ntk_t * p )
 {
-    word * pSign;
     int status, i, Div, iVar, nFinal, * pFinal, nIter = 0;
     int pLits[2], nVars = sat_solver_nvars( p->pSat );
     int nWords = Abc_Truth6WordNum( Vec_IntSize(p->vDivIds) );
@@ -172,10 +242,7 @@ word Sfm_ComputeInterpolant( Sfm_Ntk_t * p )
         if ( status == l_False )
             return p->pTruth[0];
         assert( status == l_True );
-        // remember variable values
-        Vec_IntClear( p->vValues );
-        Vec_IntForEachEntry( p->vDivVars, iVar, i )
-            Vec_IntPush( p->vValues, sat_solver_var_value(p->pSat, iVar) );
+        Sfm_NtkAddCex( p, 1 );
         // collect divisor literals
         Vec_IntClear( p->vLits );
         Vec_IntPush( p->vLits, Abc_LitNot(pLits[0]) ); // F = 0
@@ -209,14 +276,7 @@ word Sfm_ComputeInterpolant( Sfm_Ntk_t * p )
     }
     assert( status == l_True );
     // store the counter-example
-    Vec_IntForEachEntry( p->vDivVars, iVar, i )
-        if ( Vec_IntEntry(p->vValues, i) ^ sat_solver_var_value(p->pSat, iVar) ) // insert 1
-        {
-            pSign = Vec_WrdEntryP( p->vDivCexes, i );
-            assert( !Abc_InfoHasBit( (unsigned *)pSign, p->nCexes) );
-            Abc_InfoXorBit( (unsigned *)pSign, p->nCexes );
-        }
-    p->nCexes++;
+    Sfm_NtkAddCex( p, 0 );
     return SFM_SAT_SAT;
 }
 
@@ -233,14 +293,13 @@ word Sfm_ComputeInterpolant( Sfm_Ntk_t * p )
 ***********************************************************************/
 int Sfm_ComputeInterpolantInt( Sfm_Ntk_t * p, word Truth[2] )
 {
-    int fOnSet, iMint, iVar, nVars = sat_solver_nvars( p->pSat );
+    int fOnSet, iMint, nVars = sat_solver_nvars( p->pSat );
     int iVarPivot = Sfm_ObjSatVar( p, p->iPivotNode );
     int status, iNewLit, i, Div, nIter = 0;
     Truth[0] = Truth[1] = 0;
     sat_solver_setnvars( p->pSat, nVars + 1 );
     iNewLit = Abc_Var2Lit( nVars, 0 ); // iNewLit
     assert( Vec_IntSize(p->vDivIds) <= 6 );
-    Vec_IntFill( p->vValues, (1 << Vec_IntSize(p->vDivIds)) * Vec_IntSize(p->vDivVars), -1 );
     while ( 1 ) 
     {
         // find care minterm
@@ -254,6 +313,7 @@ int Sfm_ComputeInterpolantInt( Sfm_Ntk_t * p, word Truth[2] )
         // collect values
         iMint = 0;
         fOnSet = sat_solver_var_value(p->pSat, iVarPivot);
+        Sfm_NtkAddCex( p, fOnSet );
         Vec_IntClear( p->vLits );
         Vec_IntPush( p->vLits, Abc_LitNot(iNewLit) ); // NOT(iNewLit)
         Vec_IntPush( p->vLits, Abc_LitNot(sat_solver_var_literal(p->pSat, iVarPivot)) );
@@ -267,28 +327,12 @@ int Sfm_ComputeInterpolantInt( Sfm_Ntk_t * p, word Truth[2] )
             break; 
         assert( !(Truth[fOnSet] & ((word)1 << iMint)) );
         Truth[fOnSet] |= ((word)1 << iMint);
-        // remember variable values
-        Vec_IntForEachEntry( p->vDivVars, iVar, i )
-            Vec_IntWriteEntry( p->vValues, iMint * Vec_IntSize(p->vDivVars) + i, sat_solver_var_value(p->pSat, iVar) );
         status = sat_solver_addclause( p->pSat, Vec_IntArray(p->vLits), Vec_IntArray(p->vLits) + Vec_IntSize(p->vLits) );
         if ( status == 0 )
             return l_False;
     }
     assert( status == l_True );
-    // store the counter-example
     assert( iMint < (1 << Vec_IntSize(p->vDivIds)) );
-    Vec_IntForEachEntry( p->vDivVars, iVar, i )
-    {
-        int Value = Vec_IntEntry(p->vValues, iMint * Vec_IntSize(p->vDivVars) + i);
-        assert( Value != -1 );
-        if ( Value ^ sat_solver_var_value(p->pSat, iVar) ) // insert 1
-        {
-            word * pSign = Vec_WrdEntryP( p->vDivCexes, i );
-            assert( !Abc_InfoHasBit( (unsigned *)pSign, p->nCexes) );
-            Abc_InfoXorBit( (unsigned *)pSign, p->nCexes );
-        }
-    }
-    p->nCexes++;
     return l_True;
 }
 word Sfm_ComputeInterpolant2( Sfm_Ntk_t * p )
@@ -472,6 +472,84 @@ void Sfm_NtkWindowTest( Sfm_Ntk_t * p, int iNode )
         Sfm_NtkCreateWindow( p, i, 1 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Simulates the window with random patterns.]
+
+  Description [Mirrors the CNF of the window: the values of each node
+  are followed by its values in the TFO copy, where the pivot is
+  complemented. Returns the care set of the patterns, or 0 if some
+  node functions are not available.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Sfm_ObjRandomSim( int iPivot, int iObj )
+{
+    word x = ((word)iPivot << 32) ^ (word)iObj ^ ABC_CONST(0x9E3779B97F4A7C15);
+    x = (x ^ (x >> 30)) * ABC_CONST(0xBF58476D1CE4E5B9);
+    x = (x ^ (x >> 27)) * ABC_CONST(0x94D049BB133111EB);
+    return x ^ (x >> 31);
+}
+static word Sfm_TtSimulate6_rec( word t, int nVars, word * pSims )
+{
+    word c0, c1;
+    if ( t == 0 )
+        return 0;
+    if ( ~t == 0 )
+        return ~(word)0;
+    assert( nVars > 0 );
+    c0 = Abc_Tt6Cofactor0( t, --nVars );
+    c1 = Abc_Tt6Cofactor1( t, nVars );
+    if ( c0 == c1 )
+        return Sfm_TtSimulate6_rec( c0, nVars, pSims );
+    return (pSims[nVars] & Sfm_TtSimulate6_rec(c1, nVars, pSims)) | (~pSims[nVars] & Sfm_TtSimulate6_rec(c0, nVars, pSims));
+}
+static word Sfm_TtSimulate_rec( word * pTruth, int nVars, word * pSims )
+{
+    int nWords;
+    if ( nVars <= 6 )
+        return Sfm_TtSimulate6_rec( Abc_Tt6Stretch(pTruth[0], nVars), nVars, pSims );
+    nWords = 1 << (nVars - 7);
+    return (pSims[nVars-1] & Sfm_TtSimulate_rec(pTruth + nWords, nVars-1, pSims)) | (~pSims[nVars-1] & Sfm_TtSimulate_rec(pTruth, nVars-1, pSims));
+}
+static inline word Sfm_ObjSimulate( Sfm_Ntk_t * p, int iNode, int fCopy )
+{
+    word pSims[SFM_FANIN_MAX];
+    int i, iFanin;
+    Sfm_ObjForEachFanin( p, iNode, iFanin, i )
+        pSims[i] = Vec_WrdEntry( p->vSims, 2 * iFanin + fCopy );
+    return Sfm_TtSimulate_rec( Sfm_NodeReadTruth(p, iNode), Sfm_ObjFaninNum(p, iNode), pSims );
+}
+word Sfm_NtkWindowSimulate( Sfm_Ntk_t * p )
+{
+    word Sim, uCare = 0;
+    int i, iNode;
+    Vec_IntForEachEntry( p->vOrder, iNode, i )
+        if ( Sfm_ObjFaninNum(p, iNode) > 6 && (p->vTruths2 == NULL || Vec_WrdSize(p->vTruths2) == 0) )
+            return 0;
+    Sfm_NtkIncrementTravId2( p );
+    Vec_IntForEachEntry( p->vTfo, iNode, i )
+        Sfm_ObjSetTravIdCurrent2( p, iNode );
+    Vec_IntForEachEntry( p->vOrder, iNode, i )
+    {
+        Sim = Sfm_ObjIsPi(p, iNode) ? Sfm_ObjRandomSim(p->iPivotNode, iNode) : Sfm_ObjSimulate(p, iNode, 0);
+        Vec_WrdWriteEntry( p->vSims, 2 * iNode, Sim );
+        if ( iNode == p->iPivotNode )
+            Sim = ~Sim;
+        else if ( Sfm_ObjIsTravIdCurrent2(p, iNode) )
+            Sim = Sfm_ObjSimulate( p, iNode, 1 );
+        Vec_WrdWriteEntry( p->vSims, 2 * iNode + 1, Sim );
+    }
+    if ( Vec_IntSize(p->vTfo) == 0 )
+        return ~(word)0;
+    Vec_IntForEachEntry( p->vRoots, iNode, i )
+        uCare |= Vec_WrdEntry(p->vSims, 2 * iNode) ^ Vec_WrdEntry(p->vSims, 2 * iNode + 1);
+    return uCare;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
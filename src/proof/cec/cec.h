@@ -108,6 +108,7 @@ struct Cec_ParFra_t_
     int              nCallsRecycle; // calls to perform before recycling SAT solver
     int              nSatVarMax;    // the max number of SAT variables
     int              nGenIters;     // pattern generation iterations
+    int              nProcs;        // the number of concurrent threads
     int              fRewriting;    // enables AIG rewriting
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
@@ -131,6 +132,7 @@ struct Cec_ParCec_t_
 {
     int              nBTLimit;      // conflict limit at a node
     int              TimeLimit;     // the runtime limit in seconds
+    int              nProcs;        // the number of concurrent threads
 //    int              fFirstStop;    // stop on the first sat output
     int              fUseSmartCnf;  // use smart CNF computation
     int              fRewriting;    // enables AIG rewriting
@@ -230,6 +232,8 @@ extern void          Cec_ManChcSetDefaultParams( Cec_ParChc_t * p );
 extern Gia_Man_t *   Cec_ManSatSweeping( Gia_Man_t * pAig, Cec_ParFra_t * pPars, int fSilent );
 extern Gia_Man_t *   Cec_ManSatSolving( Gia_Man_t * pAig, Cec_ParSat_t * pPars, int f0Proved );
 extern void          Cec_ManSimulation( Gia_Man_t * pAig, Cec_ParSim_t * pPars );
+/*=== cecSatG2.c ==========================================================*/
+extern Gia_Man_t *   Cec4_ManSimulateTestPar( Gia_Man_t * p, int nBTLimit, int nProcs, int fVerbose );
 /*=== cecSeq.c ==========================================================*/
 extern int           Cec_ManSeqResimulateCounter( Gia_Man_t * pAig, Cec_ParSim_t * pPars, Abc_Cex_t * pCex );
 extern int           Cec_ManSeqSemiformal( Gia_Man_t * pAig, Cec_ParSmf_t * pPars );
@@ -19,7 +19,9 @@
 ***********************************************************************/
 
 #include "aig/gia/gia.h"
+#include "aig/gia/giaCnfInc.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilSimd.h"
 #include "cec.h"
 
 #define USE_GLUCOSE2
@@ -35,6 +37,7 @@
 #define sat_solver_add_and                 bmcg2_sat_solver_add_and
 #define sat_solver_add_xor                 bmcg2_sat_solver_add_xor
 #define sat_solver_addvar                  bmcg2_sat_solver_addvar
+#define sat_solver_varnum                  bmcg2_sat_solver_varnum
 #define sat_solver_read_cex_varvalue       bmcg2_sat_solver_read_cex_varvalue
 #define sat_solver_reset                   bmcg2_sat_solver_reset
 #define sat_solver_set_conflict_budget     bmcg2_sat_solver_set_conflict_budget
@@ -59,6 +62,7 @@
 #define sat_solver_add_and                 bmcg_sat_solver_add_and
 #define sat_solver_add_xor                 bmcg_sat_solver_add_xor
 #define sat_solver_addvar                  bmcg_sat_solver_addvar
+#define sat_solver_varnum                  bmcg_sat_solver_varnum
 #define sat_solver_read_cex_varvalue       bmcg_sat_solver_read_cex_varvalue
 #define sat_solver_reset                   bmcg_sat_solver_reset
 #define sat_solver_set_conflict_budget     bmcg_sat_solver_set_conflict_budget
@@ -90,8 +94,7 @@ struct Cec4_Man_t_
     Gia_Man_t *      pNew;           // internal AIG
     // SAT solving
     sat_solver *     pSat;           // SAT solver
-    Vec_Ptr_t *      vFrontier;      // CNF construction
-    Vec_Ptr_t *      vFanins;        // CNF construction
+    Gia_CnfInc_t *   pCnf;           // CNF construction
     Vec_Int_t *      vCexMin;        // minimized CEX
     Vec_Int_t *      vClassUpdates;  // updated equiv classes
     Vec_Int_t *      vCexStamps;     // time stamps
@@ -102,6 +105,7 @@ struct Cec4_Man_t_
     Vec_Bit_t *      vFails;
     Vec_Bit_t *      vCoDrivers;
     Vec_Int_t *      vPairs;   
+    Vec_Int_t *      vProved;        // representatives proved by concurrent sweeping
     int              iPosRead;       // candidate reading position
     int              iPosWrite;      // candidate writing position
     int              iLastConst;     // last const node proved
@@ -123,7 +127,6 @@ struct Cec4_Man_t_
     int              nSimulates;
     int              nRecycles;
     int              nConflicts[2][3];
-    int              nGates[2];
     int              nFaster[2];
     abctime          timeCnf;
     abctime          timeGenPats;
@@ -139,9 +142,6 @@ struct Cec4_Man_t_
     abctime          timeStart;
 };
 
-static inline int    Cec4_ObjSatId( Gia_Man_t * p, Gia_Obj_t * pObj )             { return Gia_ObjCopy2Array(p, Gia_ObjId(p, pObj));                                                     }
-static inline int    Cec4_ObjSetSatId( Gia_Man_t * p, Gia_Obj_t * pObj, int Num ) { assert(Cec4_ObjSatId(p, pObj) == -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), Num); Vec_IntPush(&p->vSuppVars, Gia_ObjId(p, pObj)); if ( Gia_ObjIsCi(pObj) ) Vec_IntPushTwo(&p->vCopiesTwo, Gia_ObjId(p, pObj), Num); assert(Vec_IntSize(&p->vVarMap) == Num); Vec_IntPush(&p->vVarMap, Gia_ObjId(p, pObj)); return Num;  }
-static inline void   Cec4_ObjCleanSatId( Gia_Man_t * p, Gia_Obj_t * pObj )        { assert(Cec4_ObjSatId(p, pObj) != -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), -1);               }
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -220,6 +220,7 @@ void Cec4_ManSetParams( Cec_ParFra_t * pPars )
     pPars->nCallsRecycle  =     500;    // calls to perform before recycling SAT solver
     pPars->nGenIters      =     100;    // pattern generation iterations
     pPars->fBMiterInfo    =       0;    // printing BMiter information
+    pPars->nProcs         =       1;    // the number of concurrent threads
 }
 
 /**Function*************************************************************
@@ -242,8 +243,6 @@ Cec4_Man_t * Cec4_ManCreate( Gia_Man_t * pAig, Cec_ParFra_t * pPars )
     p->pAig          = pAig;
     p->pSat          = sat_solver_start();  
     sat_solver_set_jftr( p->pSat, pPars->jType );
-    p->vFrontier     = Vec_PtrAlloc( 1000 );
-    p->vFanins       = Vec_PtrAlloc( 100 );
     p->vCexMin       = Vec_IntAlloc( 100 );
     p->vClassUpdates = Vec_IntAlloc( 100 );
     p->vCexStamps    = Vec_IntStart( Gia_ManObjNum(pAig) );
@@ -297,8 +296,8 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     Gia_ManCleanMark01( p->pAig );
     sat_solver_stop( p->pSat );
     Gia_ManStopP( &p->pNew );
-    Vec_PtrFreeP( &p->vFrontier );
-    Vec_PtrFreeP( &p->vFanins );
+    if ( p->pCnf )
+        Gia_CnfIncStop( p->pCnf );
     Vec_IntFreeP( &p->vCexMin );
     Vec_IntFreeP( &p->vClassUpdates );
     Vec_IntFreeP( &p->vCexStamps );
@@ -308,6 +307,7 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     Vec_IntFreeP( &p->vDisprPairs );
     Vec_BitFreeP( &p->vFails );
     Vec_IntFreeP( &p->vPairs );
+    Vec_IntFreeP( &p->vProved );
     Vec_BitFreeP( &p->vCoDrivers );
     Vec_IntFreeP( &p->vRefClasses );
     Vec_IntFreeP( &p->vRefNodes );
@@ -328,307 +328,40 @@ Gia_Man_t * Cec4_ManStartNew( Gia_Man_t * pAig )
     Gia_ManForEachCi( pAig, pObj, i )
         pObj->Value = Gia_ManAppendCi( pNew );
     Gia_ManHashAlloc( pNew );
-    Vec_IntFill( &pNew->vCopies2, Gia_ManObjNum(pAig), -1 );
     Gia_ManSetRegNum( pNew, Gia_ManRegNum(pAig) );
     return pNew;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Adds clauses to the solver.]
+  Synopsis    [Connects the CNF loader to the SAT solver.]
 
-  Description []
-               
-  SideEffects []
-
-  SeeAlso     []
-
-***********************************************************************/
-void Cec4_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, sat_solver * pSat )
-{
-    int fPolarFlip = 0;
-    Gia_Obj_t * pNodeI, * pNodeT, * pNodeE;
-    int pLits[4], RetValue, VarF, VarI, VarT, VarE, fCompT, fCompE;
-
-    assert( !Gia_IsComplement( pNode ) );
-    assert( pNode->fMark0 );
-    // get nodes (I = if, T = then, E = else)
-    pNodeI = Gia_ObjRecognizeMux( pNode, &pNodeT, &pNodeE );
-    // get the variable numbers
-    VarF = Cec4_ObjSatId(p, pNode);
-    VarI = Cec4_ObjSatId(p, pNodeI);
-    VarT = Cec4_ObjSatId(p, Gia_Regular(pNodeT));
-    VarE = Cec4_ObjSatId(p, Gia_Regular(pNodeE));
-    // get the complementation flags
-    fCompT = Gia_IsComplement(pNodeT);
-    fCompE = Gia_IsComplement(pNodeE);
-
-    // f = ITE(i, t, e)
-
-    // i' + t' + f
-    // i' + t  + f'
-    // i  + e' + f
-    // i  + e  + f'
-
-    // create four clauses
-    pLits[0] = Abc_Var2Lit(VarI, 1);
-    pLits[1] = Abc_Var2Lit(VarT, 1^fCompT);
-    pLits[2] = Abc_Var2Lit(VarF, 0);
-    if ( fPolarFlip )
-    {
-        if ( pNodeI->fPhase )               pLits[0] = Abc_LitNot( pLits[0] );
-        if ( Gia_Regular(pNodeT)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
-        if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
-    }
-    RetValue = sat_solver_addclause( pSat, pLits, 3 );
-    assert( RetValue );
-    pLits[0] = Abc_Var2Lit(VarI, 1);
-    pLits[1] = Abc_Var2Lit(VarT, 0^fCompT);
-    pLits[2] = Abc_Var2Lit(VarF, 1);
-    if ( fPolarFlip )
-    {
-        if ( pNodeI->fPhase )               pLits[0] = Abc_LitNot( pLits[0] );
-        if ( Gia_Regular(pNodeT)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
-        if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
-    }
-    RetValue = sat_solver_addclause( pSat, pLits, 3 );
-    assert( RetValue );
-    pLits[0] = Abc_Var2Lit(VarI, 0);
-    pLits[1] = Abc_Var2Lit(VarE, 1^fCompE);
-    pLits[2] = Abc_Var2Lit(VarF, 0);
-    if ( fPolarFlip )
-    {
-        if ( pNodeI->fPhase )               pLits[0] = Abc_LitNot( pLits[0] );
-        if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
-        if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
-    }
-    RetValue = sat_solver_addclause( pSat, pLits, 3 );
-    assert( RetValue );
-    pLits[0] = Abc_Var2Lit(VarI, 0);
-    pLits[1] = Abc_Var2Lit(VarE, 0^fCompE);
-    pLits[2] = Abc_Var2Lit(VarF, 1);
-    if ( fPolarFlip )
-    {
-        if ( pNodeI->fPhase )               pLits[0] = Abc_LitNot( pLits[0] );
-        if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
-        if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
-    }
-    RetValue = sat_solver_addclause( pSat, pLits, 3 );
-    assert( RetValue );
-
-    // two additional clauses
-    // t' & e' -> f'
-    // t  & e  -> f 
-
-    // t  + e   + f'
-    // t' + e'  + f 
-
-    if ( VarT == VarE )
-    {
-//        assert( fCompT == !fCompE );
-        return;
-    }
-
-    pLits[0] = Abc_Var2Lit(VarT, 0^fCompT);
-    pLits[1] = Abc_Var2Lit(VarE, 0^fCompE);
-    pLits[2] = Abc_Var2Lit(VarF, 1);
-    if ( fPolarFlip )
-    {
-        if ( Gia_Regular(pNodeT)->fPhase )  pLits[0] = Abc_LitNot( pLits[0] );
-        if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
-        if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
-    }
-    RetValue = sat_solver_addclause( pSat, pLits, 3 );
-    assert( RetValue );
-    pLits[0] = Abc_Var2Lit(VarT, 1^fCompT);
-    pLits[1] = Abc_Var2Lit(VarE, 1^fCompE);
-    pLits[2] = Abc_Var2Lit(VarF, 0);
-    if ( fPolarFlip )
-    {
-        if ( Gia_Regular(pNodeT)->fPhase )  pLits[0] = Abc_LitNot( pLits[0] );
-        if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
-        if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
-    }
-    RetValue = sat_solver_addclause( pSat, pLits, 3 );
-    assert( RetValue );
-}
-void Cec4_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper, sat_solver * pSat )
-{
-    int fPolarFlip = 0;
-    Gia_Obj_t * pFanin;
-    int * pLits, nLits, RetValue, i;
-    assert( !Gia_IsComplement(pNode) );
-    assert( Gia_ObjIsAnd( pNode ) );
-    // create storage for literals
-    nLits = Vec_PtrSize(vSuper) + 1;
-    pLits = ABC_ALLOC( int, nLits );
-    // suppose AND-gate is A & B = C
-    // add !A => !C   or   A + !C
-    Vec_PtrForEachEntry( Gia_Obj_t *, vSuper, pFanin, i )
-    {
-        pLits[0] = Abc_Var2Lit(Cec4_ObjSatId(p, Gia_Regular(pFanin)), Gia_IsComplement(pFanin));
-        pLits[1] = Abc_Var2Lit(Cec4_ObjSatId(p, pNode), 1);
-        if ( fPolarFlip )
-        {
-            if ( Gia_Regular(pFanin)->fPhase )  pLits[0] = Abc_LitNot( pLits[0] );
-            if ( pNode->fPhase )                pLits[1] = Abc_LitNot( pLits[1] );
-        }
-        RetValue = sat_solver_addclause( pSat, pLits, 2 );
-        assert( RetValue );
-    }
-    // add A & B => C   or   !A + !B + C
-    Vec_PtrForEachEntry( Gia_Obj_t *, vSuper, pFanin, i )
-    {
-        pLits[i] = Abc_Var2Lit(Cec4_ObjSatId(p, Gia_Regular(pFanin)), !Gia_IsComplement(pFanin));
-        if ( fPolarFlip )
-        {
-            if ( Gia_Regular(pFanin)->fPhase )  pLits[i] = Abc_LitNot( pLits[i] );
-        }
-    }
-    pLits[nLits-1] = Abc_Var2Lit(Cec4_ObjSatId(p, pNode), 0);
-    if ( fPolarFlip )
-    {
-        if ( pNode->fPhase )  pLits[nLits-1] = Abc_LitNot( pLits[nLits-1] );
-    }
-    RetValue = sat_solver_addclause( pSat, pLits, nLits );
-    assert( RetValue );
-    ABC_FREE( pLits );
-}
-
-/**Function*************************************************************
-
-  Synopsis    [Adds clauses and returns CNF variable of the node.]
-
-  Description []
+  Description [The CNF of the nodes of the internal AIG is loaded on demand.
+  When JFTR is used, the solver also receives the fanin literals of each
+  gate, ordered so that AND gates have Lit0 < Lit1 and XOR gates have
+  Lit0 > Lit1.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Cec4_CollectSuper_rec( Gia_Obj_t * pObj, Vec_Ptr_t * vSuper, int fFirst, int fUseMuxes )
+static int  Cec4_CnfAddVar( void * pSat )                           { return sat_solver_addvar( (sat_solver *)pSat );                    }
+static int  Cec4_CnfVarNum( void * pSat )                           { return sat_solver_varnum( (sat_solver *)pSat );                    }
+static int  Cec4_CnfAddClause( void * pSat, int * pLits, int nLits ) { return sat_solver_addclause( (sat_solver *)pSat, pLits, nLits ); }
+static void Cec4_CnfAddGate( void * pSat, int iVar, int Lit0, int Lit1, int fXor )
 {
-    // if the new node is complemented or a PI, another gate begins
-    if ( Gia_IsComplement(pObj) || Gia_ObjIsCi(pObj) || 
-         (!fFirst && Gia_ObjValue(pObj) > 1) || 
-         (fUseMuxes && pObj->fMark0) )
-    {
-        Vec_PtrPushUnique( vSuper, pObj );
-        return;
-    }
-    // go through the branches
-    Cec4_CollectSuper_rec( Gia_ObjChild0(pObj), vSuper, 0, fUseMuxes );
-    Cec4_CollectSuper_rec( Gia_ObjChild1(pObj), vSuper, 0, fUseMuxes );
-}
-void Cec4_CollectSuper( Gia_Obj_t * pObj, int fUseMuxes, Vec_Ptr_t * vSuper )
-{
-    assert( !Gia_IsComplement(pObj) );
-    assert( !Gia_ObjIsCi(pObj) );
-    Vec_PtrClear( vSuper );
-    Cec4_CollectSuper_rec( pObj, vSuper, 1, fUseMuxes );
+    if ( (Lit0 > Lit1) ^ fXor )
+         Lit1 ^= Lit0, Lit0 ^= Lit1, Lit1 ^= Lit0;
+    sat_solver_set_var_fanin_lit( (sat_solver *)pSat, iVar, Lit0, Lit1 );
 }
-void Cec4_ObjAddToFrontier( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Ptr_t * vFrontier, sat_solver * pSat )
+Gia_CnfInc_t * Cec4_ManStartCnf( Cec4_Man_t * p )
 {
-    assert( !Gia_IsComplement(pObj) );
-    assert( !Gia_ObjIsConst0(pObj) );
-    if ( Cec4_ObjSatId(p, pObj) >= 0 )
-        return;
-    assert( Cec4_ObjSatId(p, pObj) == -1 );
-    Cec4_ObjSetSatId( p, pObj, sat_solver_addvar(pSat) );
-    if ( Gia_ObjIsAnd(pObj) )
-        Vec_PtrPush( vFrontier, pObj );
-}
-int Cec4_ObjGetCnfVar( Cec4_Man_t * p, int iObj )
-{ 
-    int fUseSimple = 1; // enable simple CNF
-    int fUseMuxes  = 1; // enable MUXes when using complex CNF
-    Gia_Obj_t * pNode, * pFanin;
-    Gia_Obj_t * pObj = Gia_ManObj(p->pNew, iObj);
-    int i, k;
-    // quit if CNF is ready
-    if ( Cec4_ObjSatId(p->pNew,pObj) >= 0 )
-        return Cec4_ObjSatId(p->pNew,pObj);
-    assert( iObj > 0 );
-    if ( Gia_ObjIsCi(pObj) )
-        return Cec4_ObjSetSatId( p->pNew, pObj, sat_solver_addvar(p->pSat) );
-    assert( Gia_ObjIsAnd(pObj) );
-    if ( fUseSimple )
-    {
-        Gia_Obj_t * pFan0, * pFan1;
-        //if ( Gia_ObjRecognizeExor(pObj, &pFan0, &pFan1) )
-        //    printf( "%d", (Gia_IsComplement(pFan1) << 1) + Gia_IsComplement(pFan0) );
-        if ( p->pNew->pMuxes == NULL && Gia_ObjRecognizeExor(pObj, &pFan0, &pFan1) && Gia_IsComplement(pFan0) == Gia_IsComplement(pFan1) )
-        {
-            int iVar0 = Cec4_ObjGetCnfVar( p, Gia_ObjId(p->pNew, Gia_Regular(pFan0)) );
-            int iVar1 = Cec4_ObjGetCnfVar( p, Gia_ObjId(p->pNew, Gia_Regular(pFan1)) );
-            int iVar  = Cec4_ObjSetSatId( p->pNew, pObj, sat_solver_addvar(p->pSat) );
-            if ( p->pPars->jType < 2 )
-                sat_solver_add_xor( p->pSat, iVar, iVar0, iVar1, 0 );
-            if ( p->pPars->jType > 0 )
-            {
-                int Lit0 = Abc_Var2Lit( iVar0, 0 );
-                int Lit1 = Abc_Var2Lit( iVar1, 0 );
-                if ( Lit0 < Lit1 )
-                     Lit1 ^= Lit0, Lit0 ^= Lit1, Lit1 ^= Lit0;
-                assert( Lit0 > Lit1 );
-                sat_solver_set_var_fanin_lit( p->pSat, iVar, Lit0, Lit1 );
-                p->nGates[1]++;
-            }
-        }
-        else
-        {
-            int iVar0 = Cec4_ObjGetCnfVar( p, Gia_ObjFaninId0(pObj, iObj) );
-            int iVar1 = Cec4_ObjGetCnfVar( p, Gia_ObjFaninId1(pObj, iObj) );
-            int iVar  = Cec4_ObjSetSatId( p->pNew, pObj, sat_solver_addvar(p->pSat) );
-            if ( p->pPars->jType < 2 )
-            {
-                if ( Gia_ObjIsXor(pObj) )
-                    sat_solver_add_xor( p->pSat, iVar, iVar0, iVar1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj) );
-                else
-                    sat_solver_add_and( p->pSat, iVar, iVar0, iVar1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), 0 );
-            }
-            if ( p->pPars->jType > 0 )
-            {
-                int Lit0 = Abc_Var2Lit( iVar0, Gia_ObjFaninC0(pObj) );
-                int Lit1 = Abc_Var2Lit( iVar1, Gia_ObjFaninC1(pObj) );
-                if ( (Lit0 > Lit1) ^ Gia_ObjIsXor(pObj) )
-                     Lit1 ^= Lit0, Lit0 ^= Lit1, Lit1 ^= Lit0;
-                sat_solver_set_var_fanin_lit( p->pSat, iVar, Lit0, Lit1 );
-                p->nGates[Gia_ObjIsXor(pObj)]++;
-            }
-        }
-        return Cec4_ObjSatId( p->pNew, pObj );
-    }
-    assert( !Gia_ObjIsXor(pObj) );
-    // start the frontier
-    Vec_PtrClear( p->vFrontier );
-    Cec4_ObjAddToFrontier( p->pNew, pObj, p->vFrontier, p->pSat );
-    // explore nodes in the frontier
-    Vec_PtrForEachEntry( Gia_Obj_t *, p->vFrontier, pNode, i )
-    {
-        // create the supergate
-        assert( Cec4_ObjSatId(p->pNew,pNode) >= 0 );
-        if ( fUseMuxes && pNode->fMark0 )
-        {
-            Vec_PtrClear( p->vFanins );
-            Vec_PtrPushUnique( p->vFanins, Gia_ObjFanin0( Gia_ObjFanin0(pNode) ) );
-            Vec_PtrPushUnique( p->vFanins, Gia_ObjFanin0( Gia_ObjFanin1(pNode) ) );
-            Vec_PtrPushUnique( p->vFanins, Gia_ObjFanin1( Gia_ObjFanin0(pNode) ) );
-            Vec_PtrPushUnique( p->vFanins, Gia_ObjFanin1( Gia_ObjFanin1(pNode) ) );
-            Vec_PtrForEachEntry( Gia_Obj_t *, p->vFanins, pFanin, k )
-                Cec4_ObjAddToFrontier( p->pNew, Gia_Regular(pFanin), p->vFrontier, p->pSat );
-            Cec4_AddClausesMux( p->pNew, pNode, p->pSat );
-        }
-        else
-        {
-            Cec4_CollectSuper( pNode, fUseMuxes, p->vFanins );
-            Vec_PtrForEachEntry( Gia_Obj_t *, p->vFanins, pFanin, k )
-                Cec4_ObjAddToFrontier( p->pNew, Gia_Regular(pFanin), p->vFrontier, p->pSat );
-            Cec4_AddClausesSuper( p->pNew, pNode, p->vFanins, p->pSat );
-        }
-        assert( Vec_PtrSize(p->vFanins) > 1 );
-    }
-    return Cec4_ObjSatId(p->pNew,pObj);
+    Gia_CnfInc_t * pCnf = Gia_CnfIncStart( p->pNew, 0 );
+    Gia_CnfIncSetSolver( pCnf, p->pSat, Cec4_CnfAddVar, Cec4_CnfVarNum, Cec4_CnfAddClause, 0 );
+    if ( p->pPars->jType > 0 )
+        Gia_CnfIncSetGates( pCnf, Cec4_CnfAddGate, p->pPars->jType >= 2 );
+    return pCnf;
 }
 
 
@@ -649,39 +382,13 @@ static inline word * Cec4_ObjSim( Gia_Man_t * p, int iObj )
 }
 static inline int Cec4_ObjSimEqual( Gia_Man_t * p, int iObj0, int iObj1 )
 {
-    int w;
     word * pSim0 = Cec4_ObjSim( p, iObj0 );
     word * pSim1 = Cec4_ObjSim( p, iObj1 );
-    if ( (pSim0[0] & 1) == (pSim1[0] & 1) )
-    {
-        for ( w = 0; w < p->nSimWords; w++ )
-            if ( pSim0[w] != pSim1[w] )
-                return 0;
-        return 1;
-    }
-    else
-    {
-        for ( w = 0; w < p->nSimWords; w++ )
-            if ( pSim0[w] != ~pSim1[w] )
-                return 0;
-        return 1;
-    }
+    return Abc_SimdEqual( pSim0, pSim1, (int)((pSim0[0] ^ pSim1[0]) & 1), p->nSimWords );
 }
 int Cec4_ManSimHashKey( word * pSim, int nSims, int nTableSize )
 {
-    static int s_Primes[16] = { 
-        1291, 1699, 1999, 2357, 2953, 3313, 3907, 4177, 
-        4831, 5147, 5647, 6343, 6899, 7103, 7873, 8147 };
-    unsigned uHash = 0, * pSimU = (unsigned *)pSim;
-    int i, nSimsU = 2 * nSims;
-    if ( pSimU[0] & 1 )
-        for ( i = 0; i < nSimsU; i++ )
-            uHash ^= ~pSimU[i] * s_Primes[i & 0xf];
-    else
-        for ( i = 0; i < nSimsU; i++ )
-            uHash ^= pSimU[i] * s_Primes[i & 0xf];
-    return (int)(uHash % nTableSize);
-
+    return (int)(Abc_SimdHash( pSim, (int)(pSim[0] & 1), nSims ) % nTableSize);
 }
 void Cec4_RefineOneClassIter( Gia_Man_t * p, int iRepr )
 {
@@ -829,50 +536,26 @@ static inline void Cec4_ObjSimRo( Gia_Man_t * p, int iObj )
 }
 static inline void Cec4_ObjSimCo( Gia_Man_t * p, int iObj )
 {
-    int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
     word * pSimCo  = Cec4_ObjSim( p, iObj );
     word * pSimDri = Cec4_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSimCo[w] = ~pSimDri[w];
-    else
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSimCo[w] =  pSimDri[w];
+    Abc_SimdCopy( pSimCo, pSimDri, Gia_ObjFaninC0(pObj), p->nSimWords );
 }
 static inline void Cec4_ObjSimAnd( Gia_Man_t * p, int iObj )
 {
-    int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
     word * pSim  = Cec4_ObjSim( p, iObj );
     word * pSim0 = Cec4_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec4_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] & ~pSim1[w];
-    else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] & pSim1[w];
-    else if ( !Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = pSim0[w] & ~pSim1[w];
-    else
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = pSim0[w] & pSim1[w];
+    Abc_SimdAnd( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), p->nSimWords );
 }
 static inline void Cec4_ObjSimXor( Gia_Man_t * p, int iObj )
 {
-    int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
     word * pSim  = Cec4_ObjSim( p, iObj );
     word * pSim0 = Cec4_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec4_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] ^ pSim1[w];
-    else
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] =  pSim0[w] ^ pSim1[w];
+    Abc_SimdXor( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj), p->nSimWords );
 }
 static inline void Cec4_ObjSimCi( Gia_Man_t * p, int iObj )
 {
@@ -1086,27 +769,27 @@ void Cec4_ManPrintClasses( Gia_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-int Cec4_ManVerify_rec( Gia_Man_t * p, int iObj, sat_solver * pSat )
+int Cec4_ManVerify_rec( Cec4_Man_t * p, int iObj )
 {
     int Value0, Value1;
-    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    Gia_Obj_t * pObj = Gia_ManObj( p->pNew, iObj );
     if ( iObj == 0 ) return 0;
-    if ( Gia_ObjIsTravIdCurrentId(p, iObj) )
+    if ( Gia_ObjIsTravIdCurrentId(p->pNew, iObj) )
         return pObj->fMark1;
-    Gia_ObjSetTravIdCurrentId(p, iObj);
+    Gia_ObjSetTravIdCurrentId(p->pNew, iObj);
     if ( Gia_ObjIsCi(pObj) )
-        return pObj->fMark1 = sat_solver_read_cex_varvalue(pSat, Cec4_ObjSatId(p, pObj));
+        return pObj->fMark1 = sat_solver_read_cex_varvalue(p->pSat, Gia_CnfIncObjVar(p->pCnf, iObj));
     assert( Gia_ObjIsAnd(pObj) );
-    Value0 = Cec4_ManVerify_rec( p, Gia_ObjFaninId0(pObj, iObj), pSat ) ^ Gia_ObjFaninC0(pObj);
-    Value1 = Cec4_ManVerify_rec( p, Gia_ObjFaninId1(pObj, iObj), pSat ) ^ Gia_ObjFaninC1(pObj);
+    Value0 = Cec4_ManVerify_rec( p, Gia_ObjFaninId0(pObj, iObj) ) ^ Gia_ObjFaninC0(pObj);
+    Value1 = Cec4_ManVerify_rec( p, Gia_ObjFaninId1(pObj, iObj) ) ^ Gia_ObjFaninC1(pObj);
     return pObj->fMark1 = Gia_ObjIsXor(pObj) ? Value0 ^ Value1 : Value0 & Value1;
 }
-void Cec4_ManVerify( Gia_Man_t * p, int iObj0, int iObj1, int fPhase, sat_solver * pSat )
+void Cec4_ManVerify( Cec4_Man_t * p, int iObj0, int iObj1, int fPhase )
 {
     int Value0, Value1;
-    Gia_ManIncrementTravId( p );
-    Value0 = Cec4_ManVerify_rec( p, iObj0, pSat );
-    Value1 = Cec4_ManVerify_rec( p, iObj1, pSat );
+    Gia_ManIncrementTravId( p->pNew );
+    Value0 = Cec4_ManVerify_rec( p, iObj0 );
+    Value1 = Cec4_ManVerify_rec( p, iObj1 );
     if ( (Value0 ^ Value1) == fPhase )
         printf( "CEX verification FAILED for obj %d and obj %d.\n", iObj0, iObj1 );
 //    else
@@ -1498,18 +1181,12 @@ int Cec4_ManGeneratePatterns( Cec4_Man_t * p )
 ***********************************************************************/
 void Cec4_ManSatSolverRecycle( Cec4_Man_t * p )
 {
-    Gia_Obj_t * pObj;
-    int i;
     //printf( "Solver size = %d.\n", sat_solver_varnum(p->pSat) );
     p->nRecycles++;
     p->nCallsSince = 0;
     sat_solver_reset( p->pSat );
     // clean mapping of AigIds into SatIds
-    Gia_ManForEachObjVec( &p->pNew->vSuppVars, p->pNew, pObj, i )
-        Cec4_ObjCleanSatId( p->pNew, pObj );
-    Vec_IntClear( &p->pNew->vSuppVars  );  // AigIds for which SatId is defined
-    Vec_IntClear( &p->pNew->vCopiesTwo );  // pairs (CiAigId, SatId)
-    Vec_IntClear( &p->pNew->vVarMap    );  // mapping of SatId into AigId
+    Gia_CnfIncReset( p->pCnf );
 }
 int Cec4_ManSolveTwo( Cec4_Man_t * p, int iObj0, int iObj1, int fPhase, int * pfEasy, int fVerbose, int fEffort )
 {
@@ -1525,19 +1202,17 @@ int Cec4_ManSolveTwo( Cec4_Man_t * p, int iObj0, int iObj1, int fPhase, int * pf
     // check if SAT solver needs recycling
     p->nCallsSince++; 
     if ( p->nCallsSince > p->pPars->nCallsRecycle && 
-         Vec_IntSize(&p->pNew->vSuppVars) > p->pPars->nSatVarMax && p->pPars->nSatVarMax )
+         p->pCnf->nVars > p->pPars->nSatVarMax && p->pPars->nSatVarMax )
         Cec4_ManSatSolverRecycle( p );
     // add more logic to the solver
-    if ( !iObj0 && Cec4_ObjSatId(p->pNew, Gia_ManConst0(p->pNew)) == -1 )
-        Cec4_ObjSetSatId( p->pNew, Gia_ManConst0(p->pNew), sat_solver_addvar(p->pSat) );
     clk = Abc_Clock();
-    iVar0 = Cec4_ObjGetCnfVar( p, iObj0 );
-    iVar1 = Cec4_ObjGetCnfVar( p, iObj1 );
+    iVar0 = Gia_CnfIncLoadObj( p->pCnf, iObj0 );
+    iVar1 = Gia_CnfIncLoadObj( p->pCnf, iObj1 );
     if( p->pPars->jType > 0 )
     {
         sat_solver_start_new_round( p->pSat );
-        sat_solver_mark_cone( p->pSat, Cec4_ObjSatId(p->pNew, Gia_ManObj(p->pNew, iObj0)) );
-        sat_solver_mark_cone( p->pSat, Cec4_ObjSatId(p->pNew, Gia_ManObj(p->pNew, iObj1)) );
+        sat_solver_mark_cone( p->pSat, iVar0 );
+        sat_solver_mark_cone( p->pSat, iVar1 );
     }
     p->timeCnf += Abc_Clock() - clk;
     // perform solving
@@ -1609,10 +1284,27 @@ int Cec4_ManSolveTwo( Cec4_Man_t * p, int iObj0, int iObj1, int fPhase, int * pf
     //    printf( "*  " );
     return status;
 }
+void Cec4_ManReadCexPattern( Cec4_Man_t * p )
+{
+    int i, IdAig, IdSat;
+    Vec_IntClear( p->vPat );
+    if ( p->pPars->jType == 0 )
+    {
+        Vec_IntForEachEntryDouble( p->pCnf->vCis, IdAig, IdSat, i )
+            Vec_IntPush( p->vPat, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(p->pSat, IdSat)) );
+    }
+    else
+    {
+        int * pCex = sat_solver_read_cex( p->pSat );
+        int * pMap = Vec_IntArray(p->pCnf->vVar2Obj);
+        for ( i = 0; i < pCex[0]; )
+            Vec_IntPush( p->vPat, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
+    }
+}
 int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
 {
     abctime clk = Abc_Clock();
-    int i, IdAig, IdSat, status, fEasy, RetValue = 1;
+    int i, status, fEasy, RetValue = 1;
     Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
     Gia_Obj_t * pRepr = Gia_ManObj( p->pAig, iRepr );
     int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
@@ -1625,19 +1317,7 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
         //printf( "Disproved: %d == %d.\n", Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value) );
         p->nSatSat++;
         p->nPatterns++;
-        Vec_IntClear( p->vPat );
-        if ( p->pPars->jType == 0 )
-        {
-            Vec_IntForEachEntryDouble( &p->pNew->vCopiesTwo, IdAig, IdSat, i )
-                Vec_IntPush( p->vPat, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(p->pSat, IdSat)) );
-        }
-        else
-        {
-            int * pCex = sat_solver_read_cex( p->pSat );
-            int * pMap = Vec_IntArray(&p->pNew->vVarMap);
-            for ( i = 0; i < pCex[0]; )
-                Vec_IntPush( p->vPat, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
-        }
+        Cec4_ManReadCexPattern( p );
         assert( p->pAig->iPatsPi >= 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords - 1 );
         p->pAig->iPatsPi++;
         Vec_IntForEachEntry( p->vPat, iLit, i )
@@ -1656,7 +1336,7 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
             p->timeSatSat += Abc_Clock() - clk;
         RetValue = 0;
         // this is not needed, but we keep it here anyway, because it takes very little time
-        //Cec4_ManVerify( p->pNew, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, p->pSat );
+        //Cec4_ManVerify( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl );
         // resimulated once in a while
         if ( p->pAig->iPatsPi == 64 * p->pAig->nSimWords - 2 )
         {
@@ -1825,6 +1505,367 @@ void Cec4_ManSimulateDumpInfo( Cec4_Man_t * pMan )
     Vec_WrdFree( vSims );
     Vec_WrdFree( vSimsPi );
 }
+/**Function*************************************************************
+
+  Synopsis    [Concurrent SAT sweeping of partitioned candidate pairs.]
+
+  Description [Candidate pairs (iRepr, iObj) are collected from the current
+  equivalence classes and greedily packed into partitions whose combinational
+  supports overlap most, as approximated by 64-bit CI-support signatures.
+  Each partition is extracted into a separate AIG keeping all CIs, so that
+  counter-examples found by the threads refer to the original CI IDs.
+  The threads use private SAT solvers. When they are done, the proved pairs
+  are recorded in pMan->vProved and merged by the sequential sweeping loop,
+  while the counter-examples are combined into one pattern pool and 
+  simulated to refine the classes for all partitions. The caller repeats
+  this while the counter-examples refine the classes; the pairs proved or
+  failed in the previous rounds are skipped. Returns the number of 
+  counter-examples.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cec4_ParData_t_ Cec4_ParData_t;
+struct Cec4_ParData_t_
+{
+    Cec_ParFra_t *   pPars;          // parameters
+    Gia_Man_t *      pPart;          // partition AIG
+    Vec_Int_t *      vPairs;         // pairs (iRepr, iObj) in the original AIG
+    int              nPairs;         // the number of entries in vPairs assigned to this partition
+    Vec_Int_t *      vLits;          // pairs of the corresponding literals in the partition AIG
+    Vec_Int_t *      vStatus;        // status of each pair (GLUCOSE_SAT/UNSAT/UNDEC)
+    Vec_Int_t *      vPats;          // counter-examples in the format of Cec4_EvalCombine()
+    int              nPats;          // the number of counter-examples
+    int              nConfs;         // the number of conflicts
+};
+
+void Cec4_ManCollectSuppSigns( Gia_Man_t * p, Vec_Wrd_t * vSigns )
+{
+    Gia_Obj_t * pObj; int i;
+    Vec_WrdFill( vSigns, Gia_ManObjNum(p), 0 );
+    Gia_ManForEachCi( p, pObj, i )
+        Vec_WrdWriteEntry( vSigns, Gia_ObjId(p, pObj), (word)1 << (i & 63) );
+    Gia_ManForEachAnd( p, pObj, i )
+        Vec_WrdWriteEntry( vSigns, i, Vec_WrdEntry(vSigns, Gia_ObjFaninId0(pObj, i)) | Vec_WrdEntry(vSigns, Gia_ObjFaninId1(pObj, i)) );
+}
+Vec_Ptr_t * Cec4_ManPartitionPairs( Gia_Man_t * p, Vec_Int_t * vPairs, int nParts )
+{
+    Vec_Wrd_t * vSigns = Vec_WrdAlloc( Gia_ManObjNum(p) );
+    Vec_Wrd_t * vPartSigns = Vec_WrdStart( nParts );
+    Vec_Ptr_t * vParts = Vec_PtrAlloc( nParts );
+    int i, k, iRepr, iObj, nPartSize = Abc_MaxInt( 1, (Vec_IntSize(vPairs)/2 + nParts - 1) / nParts );
+    Cec4_ManCollectSuppSigns( p, vSigns );
+    for ( k = 0; k < nParts; k++ )
+        Vec_PtrPush( vParts, Vec_IntAlloc(2 * nPartSize) );
+    Vec_IntForEachEntryDouble( vPairs, iRepr, iObj, i )
+    {
+        word Sign = Vec_WrdEntry(vSigns, iRepr) | Vec_WrdEntry(vSigns, iObj);
+        int iBest = -1, CostBest = -1;
+        for ( k = 0; k < nParts; k++ )
+        {
+            Vec_Int_t * vPart = (Vec_Int_t *)Vec_PtrEntry( vParts, k );
+            int Cost = Abc_TtCountOnes( Sign & Vec_WrdEntry(vPartSigns, k) );
+            if ( Vec_IntSize(vPart) >= 2 * nPartSize )
+                continue;
+            if ( CostBest < Cost || (CostBest == Cost && Vec_IntSize(vPart) < Vec_IntSize((Vec_Int_t *)Vec_PtrEntry(vParts, iBest))) )
+                CostBest = Cost, iBest = k;
+        }
+        assert( iBest >= 0 );
+        Vec_IntPushTwo( (Vec_Int_t *)Vec_PtrEntry(vParts, iBest), iRepr, iObj );
+        Vec_WrdWriteEntry( vPartSigns, iBest, Vec_WrdEntry(vPartSigns, iBest) | Sign );
+    }
+    Vec_WrdFree( vPartSigns );
+    Vec_WrdFree( vSigns );
+    return vParts;
+}
+void Cec4_ManCollectPart_rec( Gia_Man_t * p, int iObj, Vec_Int_t * vNodes )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    if ( Gia_ObjIsTravIdCurrentId(p, iObj) )
+        return;
+    Gia_ObjSetTravIdCurrentId(p, iObj);
+    assert( Gia_ObjIsAnd(pObj) );
+    Cec4_ManCollectPart_rec( p, Gia_ObjFaninId0(pObj, iObj), vNodes );
+    Cec4_ManCollectPart_rec( p, Gia_ObjFaninId1(pObj, iObj), vNodes );
+    Vec_IntPush( vNodes, iObj );
+}
+Gia_Man_t * Cec4_ManDupPart( Gia_Man_t * p, Vec_Int_t * vPairs, Vec_Int_t * vLits, Vec_Bit_t * vMarks )
+{
+    Gia_Man_t * pNew;
+    Vec_Int_t * vNodes = Vec_IntAlloc( 1000 );
+    Gia_Obj_t * pObj; int i, iObj, iRepr, nPairs = Vec_IntSize(vPairs);
+    // collect the cone of the pairs, so that only its nodes are sized and assigned
+    Gia_ManIncrementTravId( p );
+    Gia_ObjSetTravIdCurrentId( p, 0 );
+    Gia_ManForEachCi( p, pObj, i )
+        Gia_ObjSetTravIdCurrent( p, pObj );
+    Vec_IntForEachEntry( vPairs, iObj, i )
+        Cec4_ManCollectPart_rec( p, iObj, vNodes );
+    // the partition keeps all CIs, so that the counter-examples are shared
+    pNew = Gia_ManStart( 1 + Gia_ManCiNum(p) + Vec_IntSize(vNodes) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    if ( p->pMuxes )
+        pNew->pMuxes = ABC_CALLOC( unsigned, pNew->nObjsAlloc );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManHashAlloc( pNew );
+    Gia_ManForEachObjVec( vNodes, p, pObj, i )
+    {
+        if ( Gia_ObjIsXor(pObj) )
+            pObj->Value = Gia_ManHashXorReal( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        else
+            pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    }
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    Vec_IntClear( vLits );
+    Vec_IntForEachEntry( vPairs, iObj, i )
+        Vec_IntPush( vLits, Gia_ManObj(p, iObj)->Value );
+    // add the candidate pairs whose both nodes are in the cone, so that they could be merged
+    Vec_IntForEachEntryStart( vPairs, iObj, i, 1 )
+        if ( i % 2 == 1 )
+            Vec_BitWriteEntry( vMarks, iObj, 1 );
+    Vec_IntForEachEntry( vNodes, iObj, i )
+    {
+        iRepr = Gia_ObjRepr( p, iObj );
+        if ( iRepr == GIA_VOID || Vec_BitEntry(vMarks, iObj) || !Gia_ObjIsTravIdCurrentId(p, iRepr) )
+            continue;
+        Vec_IntPushTwo( vPairs, iRepr, iObj );
+        Vec_IntPushTwo( vLits, Gia_ManObj(p, iRepr)->Value, Gia_ManObj(p, iObj)->Value );
+    }
+    for ( i = 1; i < nPairs; i += 2 )
+        Vec_BitWriteEntry( vMarks, Vec_IntEntry(vPairs, i), 0 );
+    Vec_IntFree( vNodes );
+    return pNew;
+}
+Cec4_Man_t * Cec4_ManCreatePart( Gia_Man_t * pPart, Cec_ParFra_t * pPars )
+{
+    Cec4_Man_t * p = ABC_CALLOC( Cec4_Man_t, 1 );
+    p->pPars         = pPars;
+    p->pAig          = pPart;
+    p->pNew          = Cec4_ManStartNew( pPart );
+    p->pSat          = sat_solver_start();  
+    sat_solver_set_jftr( p->pSat, pPars->jType );
+    p->pCnf          = Cec4_ManStartCnf( p );
+    p->vPat          = Vec_IntAlloc( 100 );
+    p->vFails        = Vec_BitStart( Gia_ManObjNum(pPart) );
+    return p;
+}
+void Cec4_ManDestroyPart( Cec4_Man_t * p )
+{
+    sat_solver_stop( p->pSat );
+    Gia_ManStopP( &p->pNew );
+    Gia_CnfIncStop( p->pCnf );
+    Vec_IntFreeP( &p->vPat );
+    Vec_BitFreeP( &p->vFails );
+    ABC_FREE( p );
+}
+int Cec4_ManSweepPartPair( Cec4_Man_t * p, int iLitRepr, int iLitObj, int fPhase )
+{
+    Gia_Obj_t * pRepr = Gia_ManObj( p->pAig, Abc_Lit2Var(iLitRepr) );
+    Gia_Obj_t * pObj  = Gia_ManObj( p->pAig, Abc_Lit2Var(iLitObj) );
+    int iNewRepr = Abc_LitNotCond( pRepr->Value, Abc_LitIsCompl(iLitRepr) );
+    int iNewObj  = Abc_LitNotCond( pObj->Value,  Abc_LitIsCompl(iLitObj) );
+    int fCompl   = Abc_LitIsCompl(iNewRepr) ^ Abc_LitIsCompl(iNewObj) ^ fPhase;
+    int fEasy, status;
+    if ( Abc_Lit2Var(iNewRepr) == Abc_Lit2Var(iNewObj) )
+        return fCompl ? GLUCOSE_UNDEC : GLUCOSE_UNSAT;
+    status = Cec4_ManSolveTwo( p, Abc_Lit2Var(iNewRepr), Abc_Lit2Var(iNewObj), fCompl, &fEasy, 0, 0 );
+    if ( status == GLUCOSE_UNSAT && Abc_Lit2Var(iLitRepr) < Abc_Lit2Var(iLitObj) ) // merge in the partition
+        pObj->Value = Abc_LitNotCond( iNewRepr, fPhase ^ Abc_LitIsCompl(iLitObj) );
+    return status;
+}
+int Cec4_ManSweepPart( void * pArg )
+{
+    Cec4_ParData_t * pData = (Cec4_ParData_t *)pArg;
+    Cec4_Man_t * p = Cec4_ManCreatePart( pData->pPart, pData->pPars );
+    Vec_Int_t * vFirst = Vec_IntStartFull( Gia_ManObjNum(pData->pPart) );
+    Vec_Int_t * vNext  = Vec_IntStartFull( Vec_IntSize(pData->vLits)/2 );
+    Gia_Obj_t * pObj; int i, k, iLit0, iLit1, status;
+    // each pair is checked at the node where both of its literals are available
+    for ( k = Vec_IntSize(vNext) - 1; k >= 0; k-- )
+    {
+        int iNode = Abc_MaxInt( Abc_Lit2Var(Vec_IntEntry(pData->vLits, 2*k)), Abc_Lit2Var(Vec_IntEntry(pData->vLits, 2*k+1)) );
+        Vec_IntWriteEntry( vNext, k, Vec_IntEntry(vFirst, iNode) );
+        Vec_IntWriteEntry( vFirst, iNode, k );
+    }
+    // sweep the nodes in a topological order while merging the proved ones
+    Gia_ManForEachObj( pData->pPart, pObj, i )
+    {
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            if ( Gia_ObjIsXor(pObj) )
+                pObj->Value = Gia_ManHashXorReal( p->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+            else
+                pObj->Value = Gia_ManHashAnd( p->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        }
+        for ( k = Vec_IntEntry(vFirst, i); k >= 0; k = Vec_IntEntry(vNext, k) )
+        {
+            iLit0  = Vec_IntEntry( pData->vLits, 2*k );
+            iLit1  = Vec_IntEntry( pData->vLits, 2*k+1 );
+            status = Cec4_ManSweepPartPair( p, iLit0, iLit1, Vec_IntEntry(pData->vStatus, k) );
+            Vec_IntWriteEntry( pData->vStatus, k, status );
+            if ( status != GLUCOSE_SAT )
+                continue;
+            Cec4_ManReadCexPattern( p );
+            Vec_IntPush( pData->vPats, Vec_IntSize(p->vPat)+2 );
+            Vec_IntAppend( pData->vPats, p->vPat );
+            Vec_IntPush( pData->vPats, -1 );
+            pData->nPats++;
+        }
+    }
+    pData->nConfs = sat_solver_conflictnum( p->pSat );
+    Cec4_ManDestroyPart( p );
+    Vec_IntFree( vFirst );
+    Vec_IntFree( vNext );
+    return 1;
+}
+void Cec4_ManResimulatePats( Gia_Man_t * p, Cec4_Man_t * pMan, Vec_Int_t * vPats, int nPats )
+{
+    // the first pattern of each chunk is reserved for the all-0 pattern
+    int nChunk = 64 * p->nSimWords, nWords = p->nSimWords;
+    int nPatsAll = nPats + (nPats + nChunk - 2) / (nChunk - 1);
+    int nWordsAll = Abc_Bit6WordNum( nPatsAll ), i, c, Id, iPat = 0;
+    Vec_Int_t * vPatsAll = Vec_IntAlloc( Vec_IntSize(vPats) + 2 * nPatsAll );
+    Vec_Wrd_t * vSimsPi;
+    for ( i = 0; i < Vec_IntSize(vPats); i += Vec_IntEntry(vPats, i), iPat++ )
+    {
+        if ( iPat % (nChunk - 1) == 0 )
+            Vec_IntPushTwo( vPatsAll, 2, -1 );
+        Vec_IntPushArray( vPatsAll, Vec_IntEntryP(vPats, i), Vec_IntEntry(vPats, i) );
+    }
+    assert( iPat == nPats );
+    vSimsPi = Cec4_EvalCombine( vPatsAll, nPatsAll, Gia_ManCiNum(p), nWordsAll );
+    for ( c = 0; c * nChunk < nPatsAll; c++ )
+    {
+        Gia_ManForEachCiId( p, Id, i )
+        {
+            word * pSim = Cec4_ObjSim( p, Id );
+            word * pSimPi = Vec_WrdEntryP( vSimsPi, i * nWordsAll );
+            int w;
+            for ( w = 0; w < nWords; w++ )
+                pSim[w] = c * nWords + w < nWordsAll ? pSimPi[c * nWords + w] : Abc_RandomW(0);
+            pSim[0] &= ~(word)1;
+        }
+        Cec4_ManSimulate( p, pMan );
+    }
+    Vec_WrdFree( vSimsPi );
+    Vec_IntFree( vPatsAll );
+}
+int Cec4_ManSweepParallel( Gia_Man_t * p, Cec4_Man_t * pMan )
+{
+    abctime clk = Abc_Clock();
+    Cec_ParFra_t * pPars = pMan->pPars;
+    Vec_Int_t * vPairs = Vec_IntAlloc( 1000 ), * vPart, * vPats;
+    Vec_Ptr_t * vParts, * vData;
+    Vec_Bit_t * vMarks;
+    Cec4_ParData_t * pData;
+    int i, k, iRepr, iObj, nParts, nPats = 0, nConfs = 0, Counts[3] = {0};
+    if ( pMan->vProved == NULL )
+        pMan->vProved = Vec_IntStartFull( Gia_ManObjNum(p) );
+    // skip the pairs resolved by the previous rounds
+    Gia_ManForEachClass0( p, iRepr )
+        Gia_ClassForEachObj1( p, iRepr, iObj )
+            if ( Vec_IntEntry(pMan->vProved, iObj) != iRepr && !Vec_BitEntry(pMan->vFails, iObj) )
+                Vec_IntPushTwo( vPairs, iRepr, iObj );
+    if ( Vec_IntSize(vPairs) == 0 )
+    {
+        Vec_IntFree( vPairs );
+        return 0;
+    }
+    // create several partitions per thread to balance the load
+    nParts = Abc_MinInt( 4 * pPars->nProcs, Vec_IntSize(vPairs)/2 );
+    vParts = Cec4_ManPartitionPairs( p, vPairs, nParts );
+    vMarks = Vec_BitStart( Gia_ManObjNum(p) );
+    pData  = ABC_CALLOC( Cec4_ParData_t, nParts );
+    vData  = Vec_PtrAlloc( nParts );
+    Vec_PtrForEachEntry( Vec_Int_t *, vParts, vPart, i )
+    {
+        if ( Vec_IntSize(vPart) == 0 )
+            continue;
+        pData[i].pPars   = pPars;
+        pData[i].vPairs  = vPart;
+        pData[i].nPairs  = Vec_IntSize(vPart);
+        pData[i].vLits   = Vec_IntAlloc( Vec_IntSize(vPart) );
+        pData[i].vStatus = Vec_IntAlloc( Vec_IntSize(vPart)/2 );
+        pData[i].vPats   = Vec_IntAlloc( 1000 );
+        pData[i].pPart   = Cec4_ManDupPart( p, vPart, pData[i].vLits, vMarks );
+        // the status is initialized with the phase difference of the pair
+        Vec_IntForEachEntryDouble( vPart, iRepr, iObj, k )
+            Vec_IntPush( pData[i].vStatus, Gia_ManObj(p, iRepr)->fPhase ^ Gia_ManObj(p, iObj)->fPhase );
+        Vec_PtrPush( vData, pData + i );
+    }
+    // the calling thread only dispatches the partitions
+    Util_ProcessThreads( Cec4_ManSweepPart, vData, pPars->nProcs + 1, pPars->TimeLimit, pPars->fVerbose );
+    // collect the results in the order of partitions
+    vPats = Vec_IntAlloc( 1000 );
+    for ( i = 0; i < nParts; i++ )
+    {
+        if ( pData[i].pPart == NULL )
+            continue;
+        Vec_IntForEachEntryDouble( pData[i].vPairs, iRepr, iObj, k )
+        {
+            int status = Vec_IntEntry( pData[i].vStatus, k/2 );
+            if ( status == GLUCOSE_UNSAT )
+            {
+                Counts[0] += Vec_IntEntry(pMan->vProved, iObj) == -1;
+                Vec_IntWriteEntry( pMan->vProved, iObj, iRepr );
+            }
+            else if ( k >= pData[i].nPairs ) // the pairs added for merging are only used when proved
+                continue;
+            else if ( status == GLUCOSE_SAT )
+                Counts[1]++;
+            else
+                Vec_BitWriteEntry( pMan->vFails, iObj, 1 ), Counts[2]++;
+        }
+        Vec_IntAppend( vPats, pData[i].vPats );
+        nPats  += pData[i].nPats;
+        nConfs += pData[i].nConfs;
+        Gia_ManStop( pData[i].pPart );
+        Vec_IntFree( pData[i].vLits );
+        Vec_IntFree( pData[i].vStatus );
+        Vec_IntFree( pData[i].vPats );
+    }
+    pMan->nSatUnsat += Counts[0];
+    pMan->nSatSat   += Counts[1];
+    pMan->nSatUndec += Counts[2];
+    pMan->nPatterns += nPats;
+    pMan->timeSatUnsat += Abc_Clock() - clk;
+    // refine the classes using the counter-examples of all partitions
+    if ( nPats > 0 )
+    {
+        clk = Abc_Clock();
+        Cec4_ManResimulatePats( p, pMan, vPats, nPats );
+        pMan->timeResimGlo += Abc_Clock() - clk;
+    }
+    if ( pPars->fVerbose )
+    {
+        printf( "Concurrent sweeping with %d threads of %d pairs in %d partitions:  P = %d  D = %d  F = %d  Confs = %d\n", 
+            pPars->nProcs, Vec_IntSize(vPairs)/2, Vec_PtrSize(vData), Counts[0], Counts[1], Counts[2], nConfs );
+        Cec4_ManPrintStats( p, pPars, pMan, 0 );
+    }
+    Vec_IntFree( vPats );
+    Vec_BitFree( vMarks );
+    Vec_VecFree( (Vec_Vec_t *)vParts );
+    Vec_PtrFree( vData );
+    Vec_IntFree( vPairs );
+    ABC_FREE( pData );
+    return nPats;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** ppNew, int fSimOnly )
 {
 
@@ -1895,7 +1936,10 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     p->iPatsPi = 0;
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
     pMan->nSatSat = 0;
+    if ( pPars->nProcs > 1 ) // perform concurrent sweeping until the classes are not refined
+        while ( Cec4_ManSweepParallel( p, pMan ) );
     pMan->pNew = Cec4_ManStartNew( p );
+    pMan->pCnf = Cec4_ManStartCnf( pMan );
     Gia_ManForEachAnd( p, pObj, i )
     {
         Gia_Obj_t * pObjNew; 
@@ -1917,6 +1961,16 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
         pRepr = Gia_ObjReprObj( p, i );
         if ( pRepr == NULL )
             continue;
+        if ( pMan->vProved && Vec_IntEntry(pMan->vProved, i) == Gia_ObjId(p, pRepr) ) // proved by concurrent sweeping
+        {
+            if ( pPars->fBMiterInfo ) 
+                Bnd_ManMerge( Gia_ObjId(p, pRepr), i, pObj->fPhase ^ pRepr->fPhase );
+            pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+            Gia_ObjSetProved( p, i );
+            if ( Gia_ObjId(p, pRepr) == 0 )
+                pMan->iLastConst = i;
+            continue;
+        }
         if ( 1 ) // select representative based on recent counter-examples
         {
             pRepr = Cec4_ManFindRepr( p, pMan, i );
@@ -1983,7 +2037,7 @@ finalize:
             pMan->nSatUnsat, pMan->nConflicts[1][0], (float)pMan->nConflicts[1][1]/Abc_MaxInt(1, pMan->nSatUnsat-pMan->nConflicts[1][0]), pMan->nConflicts[1][2],
             pMan->nSatSat,   pMan->nConflicts[0][0], (float)pMan->nConflicts[0][1]/Abc_MaxInt(1, pMan->nSatSat  -pMan->nConflicts[0][0]), pMan->nConflicts[0][2],  
             pMan->nSatUndec,  
-            pMan->nSimulates, pMan->nRecycles, 100.0*pMan->nGates[1]/Abc_MaxInt(1, pMan->nGates[0]+pMan->nGates[1]) );
+            pMan->nSimulates, pMan->nRecycles, pMan->pCnf ? 100.0*pMan->pCnf->nGates[1]/Abc_MaxInt(1, pMan->pCnf->nGates[0]+pMan->pCnf->nGates[1]) : 0.0 );
     if ( pMan->vPairs && Vec_IntSize(pMan->vPairs) )
     {
         extern char * Extra_FileNameGeneric( char * FileName );
@@ -2045,6 +2099,17 @@ Gia_Man_t * Cec4_ManSimulateTest4( Gia_Man_t * p, int nBTLimit, int nBTLimitPo,
     Cec4_ManPerformSweeping( p, pPars, &pNew, 0 );
     return pNew;
 }
+Gia_Man_t * Cec4_ManSimulateTestPar( Gia_Man_t * p, int nBTLimit, int nProcs, int fVerbose )
+{
+    Gia_Man_t * pNew = NULL;
+    Cec_ParFra_t ParsFra, * pPars = &ParsFra;
+    Cec4_ManSetParams( pPars );
+    pPars->fVerbose = fVerbose;
+    pPars->nBTLimit = nBTLimit;
+    pPars->nProcs   = nProcs;
+    Cec4_ManPerformSweeping( p, pPars, &pNew, 0 );
+    return pNew;
+}
 int Cec4_ManSimulateOnlyTest( Gia_Man_t * p, int fVerbose )
 {
     Cec_ParFra_t ParsFra, * pPars = &ParsFra;
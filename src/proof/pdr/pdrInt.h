@@ -137,6 +137,8 @@ struct Pdr_Man_t_
     Vec_Int_t * vUndo;     // cone undos
     Vec_Int_t * vVisits;   // intermediate
     Vec_Int_t * vCi2Rem;   // CIs to be removed
+    Vec_Int_t * vTerMap;   // object to cone position (word-parallel lifting)
+    Vec_Wrd_t * vTerSims;  // simulation info (word-parallel lifting)
     Vec_Int_t * vRes;      // final result
     abctime *   pTime4Outs;// timeout per output
     Vec_Ptr_t * vInfCubes; // infinity clauses/cubes
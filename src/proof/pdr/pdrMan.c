@@ -278,6 +278,8 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     p->vUndo    = Vec_IntAlloc( 100 );  // cone undos
     p->vVisits  = Vec_IntAlloc( 100 );  // intermediate
     p->vCi2Rem  = Vec_IntAlloc( 100 );  // CIs to be removed
+    p->vTerMap  = Vec_IntStartFull( Aig_ManObjNumMax(pAig) );
+    p->vTerSims = Vec_WrdAlloc( 100 );
     p->vRes     = Vec_IntAlloc( 100 );  // final result
     p->pCnfMan  = Cnf_ManStart();
     // ternary simulation
@@ -381,6 +383,8 @@ void Pdr_ManStop( Pdr_Man_t * p )
     Vec_IntFree( p->vUndo     );  // cone undos
     Vec_IntFree( p->vVisits   );  // intermediate
     Vec_IntFree( p->vCi2Rem   );  // CIs to be removed
+    Vec_IntFree( p->vTerMap   );
+    Vec_WrdFree( p->vTerSims  );
     Vec_IntFree( p->vRes      );  // final result
     Vec_PtrFreeP( &p->vInfCubes );
     ABC_FREE( p->pTime4Outs );
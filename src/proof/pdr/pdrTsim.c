@@ -30,6 +30,9 @@ ABC_NAMESPACE_IMPL_START
 #define PDR_ONE 2
 #define PDR_UND 3
 
+#define PDR_TER_WORDS      4   // the max number of words in word-parallel lifting
+#define PDR_TER_BATCH_MIN 32   // the min number of flops to use word-parallel lifting
+
 static inline int Pdr_ManSimInfoNot( int Value )
 {
     if ( Value == PDR_ZER )
@@ -331,6 +334,151 @@ void Pdr_ManPrintCex( Aig_Man_t * pAig, Vec_Int_t * vCiObjs, Vec_Int_t * vCiVals
     ABC_FREE( pBuff );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Word-parallel ternary simulation of the cone.]
+
+  Description [Each object has two words per lane group: the first one
+  has 1 in the lanes where the object may be 1, the second one has 1 in
+  the lanes where the object may be 0. The CIs in vCi2Rem are X in all
+  lanes. Candidate j among nCands candidates starting at iStart in vCands
+  is X in lane j only. Returns in pFail the lanes where some CO lost its required value.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word * Pdr_ManTerSim( Pdr_Man_t * p, int iObj, int fNeg, int nWords )
+{
+    assert( Vec_IntEntry(p->vTerMap, iObj) >= 0 );
+    return Vec_WrdEntryP( p->vTerSims, (2 * Vec_IntEntry(p->vTerMap, iObj) + fNeg) * nWords );
+}
+static inline void Pdr_ManTerSimCopy( word * pPos, word * pNeg, word * pPos0, word * pNeg0, int fCompl, int nWords )
+{
+    int w;
+    if ( fCompl )
+        ABC_SWAP( word *, pPos0, pNeg0 );
+    for ( w = 0; w < nWords; w++ )
+        pPos[w] = pPos0[w], pNeg[w] = pNeg0[w];
+}
+void Pdr_ManTerSimBatch( Pdr_Man_t * p, Vec_Int_t * vCands, int iStart, int nCands, int nWords, word * pFail )
+{
+    Aig_Man_t * pAig = p->pAig;
+    Aig_Obj_t * pObj;
+    word * pPos, * pNeg, * pPos0, * pNeg0, * pPos1, * pNeg1;
+    int i, j, w, fCompl;
+    // constant and CIs
+    pPos = Pdr_ManTerSim( p, 0, 0, nWords );
+    pNeg = Pdr_ManTerSim( p, 0, 1, nWords );
+    for ( w = 0; w < nWords; w++ )
+        pPos[w] = ~(word)0, pNeg[w] = 0;
+    Aig_ManForEachObjVec( p->vCiObjs, pAig, pObj, i )
+    {
+        word Value = Vec_IntEntry(p->vCiVals, i) ? ~(word)0 : 0;
+        pPos = Pdr_ManTerSim( p, Aig_ObjId(pObj), 0, nWords );
+        pNeg = Pdr_ManTerSim( p, Aig_ObjId(pObj), 1, nWords );
+        for ( w = 0; w < nWords; w++ )
+            pPos[w] = Value, pNeg[w] = ~Value;
+    }
+    Aig_ManForEachObjVec( p->vCi2Rem, pAig, pObj, i )
+    {
+        pPos = Pdr_ManTerSim( p, Aig_ObjId(pObj), 0, nWords );
+        pNeg = Pdr_ManTerSim( p, Aig_ObjId(pObj), 1, nWords );
+        for ( w = 0; w < nWords; w++ )
+            pPos[w] = pNeg[w] = ~(word)0;
+    }
+    for ( j = 0; j < nCands; j++ )
+    {
+        int iObj = Vec_IntEntry( vCands, iStart + j );
+        pPos = Pdr_ManTerSim( p, iObj, 0, nWords );
+        pNeg = Pdr_ManTerSim( p, iObj, 1, nWords );
+        pPos[j / 64] |= (word)1 << (j % 64);
+        pNeg[j / 64] |= (word)1 << (j % 64);
+    }
+    // internal nodes
+    Aig_ManForEachObjVec( p->vNodes, pAig, pObj, i )
+    {
+        pPos  = Pdr_ManTerSim( p, Aig_ObjId(pObj), 0, nWords );
+        pNeg  = Pdr_ManTerSim( p, Aig_ObjId(pObj), 1, nWords );
+        fCompl = Aig_ObjFaninC0(pObj);
+        pPos0 = Pdr_ManTerSim( p, Aig_ObjFaninId0(pObj), fCompl, nWords );
+        pNeg0 = Pdr_ManTerSim( p, Aig_ObjFaninId0(pObj), !fCompl, nWords );
+        fCompl = Aig_ObjFaninC1(pObj);
+        pPos1 = Pdr_ManTerSim( p, Aig_ObjFaninId1(pObj), fCompl, nWords );
+        pNeg1 = Pdr_ManTerSim( p, Aig_ObjFaninId1(pObj), !fCompl, nWords );
+        for ( w = 0; w < nWords; w++ )
+        {
+            pPos[w] = pPos0[w] & pPos1[w];
+            pNeg[w] = pNeg0[w] | pNeg1[w];
+        }
+    }
+    // outputs
+    for ( w = 0; w < nWords; w++ )
+        pFail[w] = 0;
+    Aig_ManForEachObjVec( p->vCoObjs, pAig, pObj, i )
+    {
+        pPos = Pdr_ManTerSim( p, Aig_ObjId(pObj), 0, nWords );
+        pNeg = Pdr_ManTerSim( p, Aig_ObjId(pObj), 1, nWords );
+        Pdr_ManTerSimCopy( pPos, pNeg, Pdr_ManTerSim(p, Aig_ObjFaninId0(pObj), 0, nWords), 
+            Pdr_ManTerSim(p, Aig_ObjFaninId0(pObj), 1, nWords), Aig_ObjFaninC0(pObj), nWords );
+        for ( w = 0; w < nWords; w++ )
+            pFail[w] |= Vec_IntEntry(p->vCoVals, i) ? pNeg[w] : pPos[w];
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Filters out the flops that cannot be removed alone.]
+
+  Description [Simulates the candidates in vCands (CI object IDs) 64 *
+  PDR_TER_WORDS at a time, each in its own lane, on top of the flops
+  already in p->vCi2Rem, and compacts vCands to the candidates that can
+  be removed alone. Since ternary simulation is monotone, a flop that
+  cannot be removed now cannot be removed after more flops are removed,
+  so the greedy removal over the remaining candidates gives the same
+  result as the greedy removal over all of them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManTerFilter( Pdr_Man_t * p, Vec_Int_t * vCands )
+{
+    word pFail[PDR_TER_WORDS];
+    int i, j, k = 0, nPos = 0, nCands, nWords;
+    // assign simulation info
+    Vec_IntFillExtra( p->vTerMap, Aig_ManObjNumMax(p->pAig), -1 );
+    Vec_IntWriteEntry( p->vTerMap, 0, nPos++ );
+    for ( i = 0; i < Vec_IntSize(p->vCiObjs); i++ )
+        Vec_IntWriteEntry( p->vTerMap, Vec_IntEntry(p->vCiObjs, i), nPos++ );
+    for ( i = 0; i < Vec_IntSize(p->vNodes); i++ )
+        Vec_IntWriteEntry( p->vTerMap, Vec_IntEntry(p->vNodes, i), nPos++ );
+    for ( i = 0; i < Vec_IntSize(p->vCoObjs); i++ )
+        Vec_IntWriteEntry( p->vTerMap, Vec_IntEntry(p->vCoObjs, i), nPos++ );
+    Vec_WrdFill( p->vTerSims, 2 * nPos * PDR_TER_WORDS, 0 );
+    // simulate the candidates and keep those that did not fail
+    for ( i = 0; i < Vec_IntSize(vCands); i += nCands )
+    {
+        nCands = Abc_MinInt( 64 * PDR_TER_WORDS, Vec_IntSize(vCands) - i );
+        nWords = (nCands + 63) / 64;
+        Pdr_ManTerSimBatch( p, vCands, i, nCands, nWords, pFail );
+        for ( j = 0; j < nCands; j++ )
+            if ( !Abc_InfoHasBit((unsigned *)pFail, j) )
+                Vec_IntWriteEntry( vCands, k++, Vec_IntEntry(vCands, i + j) );
+    }
+    Vec_IntShrink( vCands, k );
+    // clean the mapping
+    Vec_IntWriteEntry( p->vTerMap, 0, -1 );
+    for ( i = 0; i < Vec_IntSize(p->vCiObjs); i++ )
+        Vec_IntWriteEntry( p->vTerMap, Vec_IntEntry(p->vCiObjs, i), -1 );
+    for ( i = 0; i < Vec_IntSize(p->vNodes); i++ )
+        Vec_IntWriteEntry( p->vTerMap, Vec_IntEntry(p->vNodes, i), -1 );
+    for ( i = 0; i < Vec_IntSize(p->vCoObjs); i++ )
+        Vec_IntWriteEntry( p->vTerMap, Vec_IntEntry(p->vCoObjs, i), -1 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Shrinks values using ternary simulation.]
@@ -420,6 +568,21 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
 
         // try removing flops starting from low-priority to high-priority
         Vec_IntClear( vCi2Rem );
+        if ( p->pPars->fTerFilter && Vec_IntSize(vRes) >= PDR_TER_BATCH_MIN )
+        {
+            Vec_IntForEachEntry( vRes, Entry, i )
+                Vec_IntWriteEntry( vRes, i, Aig_ObjId(Aig_ManCi(p->pAig, Saig_ManPiNum(p->pAig) + Entry)) );
+            Pdr_ManTerFilter( p, vRes );
+            Aig_ManForEachObjVec( vRes, p->pAig, pObj, i )
+            {
+                Vec_IntClear( vUndo );
+                if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
+                    Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
+                else
+                    Pdr_ManExtendUndo( p->pAig, vUndo );
+            }
+        }
+        else
         Vec_IntForEachEntry( vRes, Entry, i )
         {
             pObj = Aig_ManCi( p->pAig, Saig_ManPiNum(p->pAig) + Entry );
@@ -431,6 +594,28 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
                 Pdr_ManExtendUndo( p->pAig, vUndo );
         }
     }
+    else if ( p->pPars->fTerFilter && Vec_IntSize(vCiObjs) - Saig_ManPiNum(p->pAig) >= PDR_TER_BATCH_MIN )
+    {
+        // collect low-priority flops followed by high-priority flops
+        Vec_IntClear( vCi2Rem );
+        Vec_IntClear( vRes );
+        Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
+            if ( Saig_ObjIsLo(p->pAig, pObj) && !Vec_IntEntry(vPrio, Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig)) )
+                Vec_IntPush( vRes, Aig_ObjId(pObj) );
+        Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
+            if ( Saig_ObjIsLo(p->pAig, pObj) && Vec_IntEntry(vPrio, Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig)) )
+                Vec_IntPush( vRes, Aig_ObjId(pObj) );
+        // skip the flops that cannot be removed alone
+        Pdr_ManTerFilter( p, vRes );
+        Aig_ManForEachObjVec( vRes, p->pAig, pObj, i )
+        {
+            Vec_IntClear( vUndo );
+            if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
+                Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
+            else
+                Pdr_ManExtendUndo( p->pAig, vUndo );
+        }
+    }
     else
     {
         // try removing low-priority flops first
@@ -259,6 +259,31 @@ void Cnf_DataLiftAndFlipLits( Cnf_Dat_t * p, int nVarsPlus, Vec_Int_t * vLits )
         p->pClauses[0][iLit] = Abc_LitNot(p->pClauses[0][iLit]) + 2*nVarsPlus;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the clauses into one array.]
+
+  Description [Each clause is stored as (nLits, Lit0, Lit1, ...). This
+  array can be loaded into any SAT solver using Gia_CnfIncImport().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cnf_DataCollectClauses( Cnf_Dat_t * p )
+{
+    Vec_Int_t * vClauses = Vec_IntAlloc( p->nClauses + p->nLiterals );
+    int * pLit, * pStop, i;
+    for ( i = 0; i < p->nClauses; i++ )
+    {
+        Vec_IntPush( vClauses, (int)(p->pClauses[i+1] - p->pClauses[i]) );
+        for ( pLit = p->pClauses[i], pStop = p->pClauses[i+1]; pLit < pStop; pLit++ )
+            Vec_IntPush( vClauses, *pLit );
+    }
+    return vClauses;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
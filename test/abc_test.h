@@ -0,0 +1,113 @@
+#ifndef ABC_TEST_H
+#define ABC_TEST_H
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <string>
+
+#include "aig/gia/gia.h"
+#include "base/abc/abc.h"
+#include "base/main/main.h"
+#include "base/cmd/cmd.h"
+#include "proof/cec/cec.h"
+#include "map/mio/mio.h"
+
+ABC_NAMESPACE_HEADER_START
+
+// the fixture of the tests that run commands in a started ABC frame
+class AbcTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    Abc_Start();
+    abc = Abc_FrameGetGlobalFrame();
+  }
+  void TearDown() override { Abc_Stop(); }
+
+  // returns the path of a temporary file used only by the current test
+  static std::string Path(const std::string& name) {
+    const ::testing::TestInfo* pInfo =
+        ::testing::UnitTest::GetInstance()->current_test_info();
+    return ::testing::TempDir() + pInfo->test_suite_name() + "_" +
+           pInfo->name() + "_" + name;
+  }
+
+  // runs the commands and expects them to succeed
+  void Run(const std::string& commands) {
+    EXPECT_EQ(Cmd_CommandExecute(abc, commands.c_str()), 0) << commands;
+  }
+
+  // reads the circuit written by "gen" with the given options (for example,
+  // "-N 8 -m" for an 8x8 multiplier) as an AIG and runs the commands
+  void Gen(const std::string& options, const std::string& commands = "") {
+    std::string file = Path("gen.blif");
+    Run("gen " + options + " " + file + "; read " + file + "; strash; " +
+        commands);
+  }
+
+  // returns a copy of the AIG of the current network
+  Gia_Man_t* Current() {
+    Run("strash; &get -n");
+    return Gia_ManDup(Abc_FrameReadGia(abc));
+  }
+
+  // expects the two AIGs to be equivalent and frees them
+  static void ExpectEquivalent(Gia_Man_t* spec, Gia_Man_t* impl) {
+    EXPECT_EQ(Cec_ManVerifyTwo(spec, impl, 0), 1);
+    Gia_ManStop(impl);
+    Gia_ManStop(spec);
+  }
+
+  // writes a genlib library with constants, buffers, inverters, and the
+  // gates of which the mappers create AND, XOR, and MUX matches
+  static std::string WriteGenlib(const std::string& name) {
+    std::string file = Path(name);
+    FILE* pFile = fopen(file.c_str(), "w");
+    fprintf(pFile, "GATE ZERO  0 Y=CONST0;\n");
+    fprintf(pFile, "GATE ONE   0 Y=CONST1;\n");
+    fprintf(pFile, "GATE INV   1 Y=!A;            PIN * INV 1 999 1 0 1 0\n");
+    fprintf(pFile, "GATE BUF   1 Y=A;             PIN * NONINV 1 999 1 0 1 0\n");
+    fprintf(pFile, "GATE NAND2 2 Y=!(A*B);        PIN * INV 1 999 1 0 1 0\n");
+    fprintf(pFile, "GATE NOR2  2 Y=!(A+B);        PIN * INV 1 999 1 0 1 0\n");
+    fprintf(pFile, "GATE AND2  3 Y=A*B;           PIN * NONINV 1 999 1 0 1 0\n");
+    fprintf(pFile, "GATE OR2   3 Y=A+B;           PIN * NONINV 1 999 1 0 1 0\n");
+    fprintf(pFile, "GATE XOR2  4 Y=A*!B+!A*B;     PIN * UNKNOWN 1 999 1 0 1 0\n");
+    fprintf(pFile, "GATE AOI21 3 Y=!(A*B+C);      PIN * INV 1 999 1 0 1 0\n");
+    fprintf(pFile, "GATE MUX2  4 Y=S*B+!S*A;      PIN * UNKNOWN 1 999 1 0 1 0\n");
+    fclose(pFile);
+    return file;
+  }
+
+  // returns the names of the gates of the mapped network in the order
+  // of the node IDs
+  static std::string Gates(Abc_Ntk_t* pNtk) {
+    std::string gates;
+    Abc_Obj_t* pObj;
+    int i;
+    EXPECT_TRUE(Abc_NtkHasMapping(pNtk));
+    Abc_NtkForEachNode(pNtk, pObj, i)
+      gates += std::string(Mio_GateReadName((Mio_Gate_t*)pObj->pData)) + " ";
+    return gates;
+  }
+
+  // returns the contents of the file
+  static std::string Contents(const std::string& file) {
+    std::string contents;
+    char buffer[4096];
+    size_t size;
+    FILE* pFile = fopen(file.c_str(), "rb");
+    if (pFile == NULL) return contents;
+    while ((size = fread(buffer, sizeof(char), sizeof(buffer), pFile)) > 0)
+      contents.append(buffer, size);
+    fclose(pFile);
+    return contents;
+  }
+
+  Abc_Ntk_t* Ntk() { return Abc_FrameReadNtk(abc); }
+
+  Abc_Frame_t* abc;
+};
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
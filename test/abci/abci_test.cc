@@ -0,0 +1,42 @@
+#include "abc_test.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class AbciTest : public AbcTest {
+ protected:
+  int Nodes() { return Abc_NtkNodeNum(Ntk()); }
+};
+
+TEST_F(AbciTest, KeptRewritingCutsGiveSameResultAsRecomputedCuts) {
+  // a random function is one where the stale kept cuts of the nodes
+  // above a rewritten node made the second pass differ
+  std::string file = Path("random.blif");
+  Run("gen -N 12 -r " + file);
+  Run("read " + file + "; strash");
+  Gia_Man_t* spec = Current();
+  Run("read " + file + "; strash; rewrite -z; rewrite");
+  int nPlain = Nodes();
+  Run("read " + file + "; strash; rewrite -z -k; rewrite");
+  EXPECT_EQ(Nodes(), nPlain);
+  ExpectEquivalent(spec, Current());
+}
+
+TEST_F(AbciTest, ResubWithCareSetIsEquivalent) {
+  // the cones are simulated as wide as their cuts, unless the care set
+  // computed in a larger window is used; on the mesh, the care set
+  // changes the result for each cut size
+  Gen("-N 8 -e");
+  Gia_Man_t* spec = Current();
+  for (int nCutMax : {6, 8, 12}) {
+    std::string resub = "resub -K " + std::to_string(nCutMax) + " -N 2";
+    Gen("-N 8 -e", resub);
+    int nNodes = Nodes();
+    ExpectEquivalent(Gia_ManDup(spec), Current());
+    Gen("-N 8 -e", resub + " -F 2");
+    EXPECT_LT(Nodes(), nNodes) << resub;
+    ExpectEquivalent(Gia_ManDup(spec), Current());
+  }
+  Gia_ManStop(spec);
+}
+
+ABC_NAMESPACE_IMPL_END
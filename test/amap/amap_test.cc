@@ -0,0 +1,83 @@
+#include "abc_test.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class AmapTest : public AbcTest {
+ protected:
+  // maps the multiplier with amap and returns the names of the gates
+  std::string Map(const std::string& options) {
+    Gen("-N 16 -m", "amap " + options);
+    return Gates(Ntk());
+  }
+
+  // returns the size of the file or -1 if it does not exist
+  static long FileSize(const std::string& file) {
+    FILE* pFile = fopen(file.c_str(), "rb");
+    if (pFile == NULL) return -1;
+    fseek(pFile, 0, SEEK_END);
+    long size = ftell(pFile);
+    fclose(pFile);
+    return size;
+  }
+};
+
+TEST_F(AmapTest, ConcurrentMappingMatchesSerialMapping) {
+  Run("read_genlib " + WriteGenlib("a.genlib"));
+  Gen("-N 16 -m");
+  Gia_Man_t* spec = Current();
+  std::string serial = Map("-P 1");
+  ExpectEquivalent(spec, Current());
+  for (int nProcs = 2; nProcs <= 8; nProcs *= 2)
+    EXPECT_EQ(Map("-P " + std::to_string(nProcs)), serial)
+        << nProcs << " threads";
+}
+
+TEST_F(AmapTest, TooManyMappingThreadsAreRejected) {
+  Run("read_genlib " + WriteGenlib("a.genlib"));
+  Gen("-N 4 -m");
+  EXPECT_NE(Cmd_CommandExecute(abc, "amap -P 0"), 0);
+  EXPECT_NE(Cmd_CommandExecute(abc, "amap -P 101"), 0);
+}
+
+TEST_F(AmapTest, RulesReadFromFileGiveSameMapping) {
+  std::string lib = WriteGenlib("a.genlib"), rules = Path("a.rules");
+  remove(rules.c_str());
+  Run("read_genlib " + lib);
+  std::string created = Map("");
+  EXPECT_EQ(FileSize(rules), -1);
+
+  // the first reading writes the rules and the second one reads them
+  Run("read_genlib -R " + rules + " " + lib);
+  long size = FileSize(rules);
+  EXPECT_GT(size, 0);
+  EXPECT_EQ(Map(""), created);
+  Run("read_genlib -R " + rules + " " + lib);
+  EXPECT_EQ(FileSize(rules), size);
+  EXPECT_EQ(Map(""), created);
+}
+
+TEST_F(AmapTest, CorruptedRulesAreCreatedAgain) {
+  std::string lib = WriteGenlib("a.genlib"), rules = Path("a.rules");
+  remove(rules.c_str());
+  Run("read_genlib " + lib);
+  std::string created = Map("");
+  Run("read_genlib -R " + rules + " " + lib);
+
+  // overwrite the rules after the header with the bytes that do not make
+  // a valid library
+  long size = FileSize(rules);
+  ASSERT_GT(size, 64);
+  FILE* pFile = fopen(rules.c_str(), "r+b");
+  ASSERT_TRUE(pFile != NULL);
+  fseek(pFile, size / 2, SEEK_SET);
+  for (long i = size / 2; i < size; i++) fputc(0xFF, pFile);
+  fclose(pFile);
+  Run("read_genlib -R " + rules + " " + lib);
+  EXPECT_EQ(Map(""), created);
+
+  // the rules were written again for this library
+  Run("read_genlib -R " + rules + " " + lib);
+  EXPECT_EQ(Map(""), created);
+}
+
+ABC_NAMESPACE_IMPL_END
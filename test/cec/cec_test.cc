@@ -0,0 +1,68 @@
+#include "abc_test.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class CecTest : public AbcTest {
+ protected:
+  // returns a copy of the AIG of an 8x8 multiplier after the given commands
+  Gia_Man_t* Multiplier(const std::string& commands) {
+    Gen("-N 8 -m", "&get -n; " + commands);
+    return Gia_ManDup(Abc_FrameReadGia(abc));
+  }
+};
+
+TEST_F(CecTest, ConcurrentSweepingProvesEquivalentMiter) {
+  Gia_Man_t* spec = Multiplier("&ps");
+  Gia_Man_t* impl = Multiplier("&dc2; &syn2");
+  Gia_Man_t* miter = Gia_ManMiter(spec, impl, 0, 0, 0, 0, 0);
+  Gia_Man_t* swept = Cec4_ManSimulateTestPar(miter, 1000, 4, 0);
+
+  EXPECT_EQ(Gia_ManAndNum(swept), 0);
+  Gia_ManStop(swept);
+  Gia_ManStop(miter);
+  Gia_ManStop(impl);
+  Gia_ManStop(spec);
+}
+
+TEST_F(CecTest, ConcurrentSweepingKeepsNonEquivalentMiter) {
+  Gia_Man_t* spec = Multiplier("&ps");
+  Gia_Man_t* impl = Multiplier("&dc2; &syn2");
+  Gia_ManCo(impl, 3)->fCompl0 ^= 1;
+  Gia_Man_t* miter = Gia_ManMiter(spec, impl, 0, 0, 0, 0, 0);
+  Gia_Man_t* swept = Cec4_ManSimulateTestPar(miter, 1000, 4, 0);
+  Gia_Obj_t* pObj;
+  int i, nConst0 = 0;
+
+  Gia_ManForEachCo(swept, pObj, i)
+    nConst0 += Gia_ObjFaninLit0p(swept, pObj) == 0;
+  EXPECT_LT(nConst0, Gia_ManCoNum(swept));
+  Gia_ManStop(swept);
+  Gia_ManStop(miter);
+  Gia_ManStop(impl);
+  Gia_ManStop(spec);
+}
+
+TEST_F(CecTest, ConcurrentFraigingIsEquivalent) {
+  Gia_Man_t* spec = Multiplier("&ps");
+  Gia_Man_t* impl = Multiplier("&dc2; &syn2");
+  Gia_Man_t* miter = Gia_ManMiter(spec, impl, 0, 1, 0, 0, 0);
+  Gia_Man_t* fraiged;
+
+  Abc_FrameUpdateGia(abc, Gia_ManDup(miter));
+  Run("&fraig -x -X 4");
+  fraiged = Abc_FrameReadGia(abc);
+  EXPECT_LT(Gia_ManAndNum(fraiged), Gia_ManAndNum(miter));
+  EXPECT_EQ(Cec_ManVerifyTwo(miter, fraiged, 0), 1);
+  Gia_ManStop(miter);
+  Gia_ManStop(impl);
+  Gia_ManStop(spec);
+}
+
+TEST_F(CecTest, ThreadsWithoutConcurrentSweepingAreRejected) {
+  Abc_FrameUpdateGia(abc, Multiplier("&ps"));
+  EXPECT_NE(Cmd_CommandExecute(abc, "&fraig -X 4"), 0);
+  EXPECT_NE(Cmd_CommandExecute(abc, "&cec -m -P 4"), 0);
+  EXPECT_NE(Cmd_CommandExecute(abc, "&fraig -x -X 101"), 0);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,83 @@
+#include "abc_test.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class DarTest : public AbcTest {
+ protected:
+  // reads a redundant AIG of a 24x24 multiplier (about 7000 nodes, which
+  // gives two windows of the minimum size) and rewrites it
+  void Rewrite(const std::string& commands) {
+    Gen("-N 24 -m", "renode; strash; " + commands);
+  }
+
+  int Nodes() { return Abc_NtkNodeNum(Ntk()); }
+  int Levels() { return Abc_AigLevel(Ntk()); }
+};
+
+TEST_F(DarTest, ConcurrentRewritingIsEquivalentAndCloseToSerial) {
+  Rewrite("");
+  Gia_Man_t* spec = Current();
+  Rewrite("drw");
+  int nSerial = Nodes();
+  Rewrite("drw -P 4 -W 5000");
+  EXPECT_LE(Nodes(), nSerial + nSerial / 200);
+  ExpectEquivalent(spec, Current());
+}
+
+TEST_F(DarTest, ConcurrentRewritingDoesNotDependOnThreads) {
+  Rewrite("drw -P 2 -W 5000");
+  Gia_Man_t* two = Current();
+  Rewrite("drw -P 8 -W 5000");
+  Gia_Man_t* eight = Current();
+
+  EXPECT_EQ(Gia_ManAndNum(two), Gia_ManAndNum(eight));
+  EXPECT_EQ(Gia_ManLevelNum(two), Gia_ManLevelNum(eight));
+  Gia_ManStop(eight);
+  Gia_ManStop(two);
+}
+
+TEST_F(DarTest, ConcurrentRewritingPreservesLevels) {
+  Rewrite("");
+  int nLevels = Levels();
+  Rewrite("drw -P 4 -W 5000 -l");
+
+  EXPECT_LE(Levels(), nLevels);
+}
+
+TEST_F(DarTest, ConcurrentCompressionIsEquivalent) {
+  // four copies of the multiplier give four output partitions
+  std::string copies = "logic; double; double; strash; ";
+  Gen("-N 12 -m", copies);
+  Gia_Man_t* spec = Current();
+  ::testing::internal::CaptureStdout();
+  Gen("-N 12 -m", copies + "dc2 -P 4 -S 10 -v");
+  std::string output = ::testing::internal::GetCapturedStdout();
+  EXPECT_NE(output.find("into 4 partitions"), std::string::npos) << output;
+  ExpectEquivalent(spec, Current());
+
+  Gen("-N 12 -m", copies);
+  spec = Current();
+  Gen("-N 12 -m", copies + "&get -n; &dc2 -P 4 -S 10; &put");
+  ExpectEquivalent(spec, Current());
+}
+
+TEST_F(DarTest, CompressionWithoutSupportLimitUsesOnePartition) {
+  // the 16 copies of the multiplier have more CIs than the partitions
+  // packed by the partitioner when it is given no limit
+  std::string copies = "logic; double; double; double; double; strash; ";
+  Gen("-N 12 -m", copies);
+  Gia_Man_t* spec = Current();
+  ::testing::internal::CaptureStdout();
+  Gen("-N 12 -m", copies + "dc2 -P 4 -S 0 -v");
+  std::string output = ::testing::internal::GetCapturedStdout();
+  EXPECT_NE(output.find("into 1 partitions"), std::string::npos) << output;
+  ExpectEquivalent(spec, Current());
+}
+
+TEST_F(DarTest, SmallWindowsAndTooManyThreadsAreRejected) {
+  Rewrite("");
+  EXPECT_NE(Cmd_CommandExecute(abc, "drw -P 4 -W 2000"), 0);
+  EXPECT_NE(Cmd_CommandExecute(abc, "drw -P 101"), 0);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,54 @@
+#include "abc_test.h"
+
+#include <cstdio>
+#include <cstring>
+
+ABC_NAMESPACE_IMPL_START
+
+class ExactTest : public AbcTest {
+ protected:
+  // maps the multiplier with the optimum networks of the store started by
+  // the given command and compares the result with the multiplier
+  void ExpectEquivalentMapping(const std::string& start,
+                               const std::string& stop) {
+    Gen("-N 8 -m");
+    Gia_Man_t* spec = Current();
+    Gen("-N 8 -m", start + "; if -K 4 -u; " + stop);
+    EXPECT_GT(Abc_NtkNodeNum(Ntk()), 0);
+    ExpectEquivalent(spec, Current());
+  }
+};
+
+TEST_F(ExactTest, CanonicalMappingIsEquivalent) {
+  ExpectEquivalentMapping("bms_start", "bms_stop");
+}
+
+TEST_F(ExactTest, MappingIsEquivalent) {
+  ExpectEquivalentMapping("bms_start -n", "bms_stop");
+}
+
+TEST_F(ExactTest, StoreFileKeepsKeyMode) {
+  std::string file = Path("store.db");
+  char pMagic[4] = {0};
+  int fCanon = 0;
+
+  ExpectEquivalentMapping("bms_start", "bms_stop " + file);
+  FILE* pFile = fopen(file.c_str(), "rb");
+  ASSERT_TRUE(pFile != NULL);
+  EXPECT_EQ(fread(pMagic, sizeof(char), 4, pFile), 4u);
+  EXPECT_EQ(fread(&fCanon, sizeof(int), 1, pFile), 1u);
+  fclose(pFile);
+  EXPECT_EQ(strncmp(pMagic, "BMSC", 4), 0);
+  EXPECT_EQ(fCanon, 1);
+
+  // the networks read back from the file give an equivalent mapping
+  ExpectEquivalentMapping("bms_start " + file, "bms_stop");
+
+  // the file is neither read into nor overwritten by a store with
+  // the original functions as keys
+  std::string contents = Contents(file);
+  ExpectEquivalentMapping("bms_start -n " + file, "bms_stop");
+  EXPECT_EQ(Contents(file), contents);
+}
+
+ABC_NAMESPACE_IMPL_END
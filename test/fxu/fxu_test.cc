@@ -0,0 +1,58 @@
+#include "abc_test.h"
+
+#include <cstdio>
+#include <sstream>
+
+ABC_NAMESPACE_IMPL_START
+
+class FxuTest : public AbcTest {
+ protected:
+  // reads the multiplier as a network of SOPs and extracts the divisors
+  // with the given command
+  void Extract(const std::string& command) {
+    Gen("-N 8 -m", "renode -s; " + command);
+  }
+};
+
+TEST_F(FxuTest, ExtractionIsEquivalent) {
+  Gen("-N 8 -m");
+  Gia_Man_t* spec = Current();
+  Extract("fx");
+  ExpectEquivalent(spec, Current());
+
+  Gen("-N 8 -m");
+  spec = Current();
+  Extract("fx -n");
+  ExpectEquivalent(spec, Current());
+}
+
+TEST_F(FxuTest, MemoryOfEntriesAddsUpToAllocatedMemory) {
+  ::testing::internal::CaptureStdout();
+  Extract("fx -n -v");
+  std::istringstream output(::testing::internal::GetCapturedStdout());
+
+  // the memory is printed before and after the extraction; the entries
+  // of all types and the free entries take all of the allocated memory
+  std::string line;
+  double Sum = 0, Percent;
+  int nBlocks = 0;
+  while (std::getline(output, line)) {
+    size_t pos = line.find("Memory: ");
+    if (pos == std::string::npos) continue;
+    line = line.substr(pos);
+    if (line.find("Divisor table") != std::string::npos) continue;
+    ASSERT_EQ(sscanf(line.c_str() + line.find('('), "( %lf", &Percent), 1)
+        << line;
+    EXPECT_GE(Percent, 0.0) << line;
+    if (line.find("Allocated") == std::string::npos) {
+      Sum += Percent;
+      continue;
+    }
+    EXPECT_NEAR(Sum, 100.0, 0.1);
+    Sum = 0;
+    nBlocks++;
+  }
+  EXPECT_EQ(nBlocks, 2);
+}
+
+ABC_NAMESPACE_IMPL_END
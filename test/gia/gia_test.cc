@@ -1,6 +1,9 @@
 #include "gtest/gtest.h"
 
+#include "abc_test.h"
 #include "aig/gia/gia.h"
+#include "aig/gia/giaCnfInc.h"
+#include "sat/bsat/satSolver.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -51,4 +54,178 @@ TEST(GiaTest, CanAddAnAndGate) {
   Gia_ManStop(aig_manager);
 }
 
+// builds f = (a ^ b) & c, where the XOR is made of three AND nodes
+static Gia_Man_t* BuildXorAnd() {
+  Gia_Man_t* p = Gia_ManStart(100);
+  int a = Gia_ManAppendCi(p);
+  int b = Gia_ManAppendCi(p);
+  int c = Gia_ManAppendCi(p);
+  Gia_ManHashAlloc(p);
+  int n0 = Gia_ManHashAnd(p, a, b);
+  int n1 = Gia_ManHashAnd(p, Abc_LitNot(a), Abc_LitNot(b));
+  int x = Gia_ManHashAnd(p, Abc_LitNot(n0), Abc_LitNot(n1));
+  Gia_ManAppendCo(p, Gia_ManHashAnd(p, x, c));
+  Gia_ManHashStop(p);
+  return p;
+}
+
+// checks that the CNF of the output agrees with simulation on all patterns
+static void CheckCnf(Gia_Man_t* p, Gia_CnfInc_t* pCnf, sat_solver* pSat) {
+  int OutLit = Gia_CnfIncLoadCo(pCnf, 0);
+  for (int m = 0; m < 8; m++) {
+    int Lits[4], Value = ((m & 1) ^ ((m >> 1) & 1)) & (m >> 2);
+    for (int i = 0; i < 3; i++)
+      Lits[i] = Abc_Var2Lit(Gia_CnfIncObjVar(pCnf, Gia_ManCiIdToId(p, i)), !((m >> i) & 1));
+    Lits[3] = Abc_LitNotCond(OutLit, Value);
+    EXPECT_EQ(sat_solver_solve(pSat, Lits, Lits + 4, 0, 0, 0, 0), l_False);
+    Lits[3] = Abc_LitNotCond(OutLit, !Value);
+    EXPECT_EQ(sat_solver_solve(pSat, Lits, Lits + 4, 0, 0, 0, 0), l_True);
+  }
+}
+
+TEST(GiaTest, CnfIncLoadsXorAsOneGate) {
+  Gia_Man_t* p = BuildXorAnd();
+  Gia_CnfInc_t* pCnf = Gia_CnfIncStart(p, 0);
+  sat_solver* pSat = sat_solver_new();
+  Gia_CnfIncSetBsat(pCnf, pSat, 0);
+  CheckCnf(p, pCnf, pSat);
+  // three inputs, the XOR and the output; the internal AND nodes are skipped
+  EXPECT_EQ(pCnf->nVars, 5);
+  EXPECT_EQ(Vec_IntSize(pCnf->vCis), 6);
+  EXPECT_EQ(Gia_CnfIncObjVar(pCnf, 4), -1);
+  EXPECT_EQ(Gia_CnfIncObjVar(pCnf, 5), -1);
+  for (int i = 0; i < 3; i++) {
+    int iObj = Gia_ManCiIdToId(p, i);
+    EXPECT_EQ(Gia_CnfIncVarObj(pCnf, Gia_CnfIncObjVar(pCnf, iObj)), iObj);
+  }
+  Gia_CnfIncReset(pCnf);
+  EXPECT_EQ(Gia_CnfIncObjVar(pCnf, Gia_ManCiIdToId(p, 0)), -1);
+  sat_solver_delete(pSat);
+  Gia_CnfIncStop(pCnf);
+  Gia_ManStop(p);
+}
+
+TEST(GiaTest, CnfIncImportKeepsExistingVariables) {
+  Gia_Man_t* p = BuildXorAnd();
+  Gia_CnfInc_t* pCnf = Gia_CnfIncStart(p, 1);
+  sat_solver* pSat = sat_solver_new();
+  Gia_CnfIncSetBsat(pCnf, pSat, 0);
+  Gia_CnfIncLoadCo(pCnf, 0);
+  // a solver that already has more variables than the CNF
+  sat_solver* pSat2 = sat_solver_new();
+  sat_solver_setnvars(pSat2, pCnf->nVars + 3);
+  EXPECT_EQ(Gia_CnfIncSetBsat(pCnf, pSat2, 1), 1);
+  EXPECT_EQ(sat_solver_nvars(pSat2), pCnf->nVars + 3);
+  CheckCnf(p, pCnf, pSat2);
+  // an empty solver gets exactly the variables of the CNF
+  sat_solver* pSat3 = sat_solver_new();
+  EXPECT_EQ(Gia_CnfIncSetBsat(pCnf, pSat3, 1), 1);
+  EXPECT_EQ(sat_solver_nvars(pSat3), pCnf->nVars);
+  CheckCnf(p, pCnf, pSat3);
+  sat_solver_delete(pSat3);
+  sat_solver_delete(pSat2);
+  sat_solver_delete(pSat);
+  Gia_CnfIncStop(pCnf);
+  Gia_ManStop(p);
+}
+
+// returns a chain of nLength two-input gates fed by nIns inputs, which are
+// ANDs or, if fMixed is set, alternating ANDs and ORs
+static Gia_Man_t* DeepChain(int nLength, int nIns, int fMixed) {
+  Gia_Man_t* p = Gia_ManStart(nLength + nIns + 2);
+  int i, iLit;
+  for (i = 0; i < nIns; i++) Gia_ManAppendCi(p);
+  iLit = Gia_ManCiLit(p, 0);
+  for (i = 0; i < nLength; i++) {
+    int iIn = Gia_ManCiLit(p, (i + 1) % nIns);
+    iLit = fMixed && (i & 1) ? Gia_ManAppendOr(p, iLit, iIn)
+                             : Gia_ManAppendAnd(p, iLit, iIn);
+  }
+  Gia_ManAppendCo(p, iLit);
+  return p;
+}
+
+// expects the AIGs to have the same output values under random patterns
+static void ExpectSameOutputs(Gia_Man_t* p, Gia_Man_t* pNew) {
+  int nWords = 4;
+  ASSERT_EQ(Gia_ManCiNum(pNew), Gia_ManCiNum(p));
+  ASSERT_EQ(Gia_ManCoNum(pNew), Gia_ManCoNum(p));
+  Vec_Wrd_t* vSimsPi = Vec_WrdStartRandom(Gia_ManCiNum(p) * nWords);
+  Vec_Wrd_t* vSims = Gia_ManSimPatSimOut(p, vSimsPi, 0);
+  Vec_Wrd_t* vSimsNew = Gia_ManSimPatSimOut(pNew, vSimsPi, 0);
+  EXPECT_EQ(memcmp(Vec_WrdEntryP(vSims, Gia_ObjId(p, Gia_ManCo(p, 0)) * nWords),
+                   Vec_WrdEntryP(vSimsNew,
+                                 Gia_ObjId(pNew, Gia_ManCo(pNew, 0)) * nWords),
+                   sizeof(word) * nWords), 0);
+  Vec_WrdFree(vSimsNew);
+  Vec_WrdFree(vSims);
+  Vec_WrdFree(vSimsPi);
+}
+
+TEST(GiaBalanceTest, MillionLevelAndChainIsBalanced) {
+  // the balancer used to recurse once per level and overflow the stack
+  Gia_Man_t* p = DeepChain(1000000, 1000000, 0);
+  Gia_Man_t* pNew = Gia_ManBalance(p, 1, 0, 0);
+  EXPECT_EQ(Gia_ManAndNum(pNew), 1000000);
+  // the supergates have at most about 50 leaves, so each of them cuts
+  // the depth of its part of the chain by more than ten times
+  EXPECT_LT(Gia_ManLevelNum(pNew), 100000);
+  ExpectSameOutputs(p, pNew);
+  Gia_ManStop(pNew);
+  pNew = Gia_ManAreaBalance(p, 1, ABC_INFINITY, 0, 0);
+  EXPECT_LT(Gia_ManLevelNum(pNew), 100000);
+  ExpectSameOutputs(p, pNew);
+  Gia_ManStop(pNew);
+  Gia_ManStop(p);
+}
+
+TEST(GiaBalanceTest, MillionLevelMixedChainIsBalanced) {
+  // the ANDs and ORs do not form larger supergates, so the levels remain
+  Gia_Man_t* p = DeepChain(1000000, 64, 1);
+  Gia_Man_t* pNew = Gia_ManBalance(p, 1, 0, 0);
+  EXPECT_EQ(Gia_ManLevelNum(pNew), 1000000);
+  ExpectSameOutputs(p, pNew);
+  Gia_ManStop(pNew);
+  pNew = Gia_ManAreaBalance(p, 1, ABC_INFINITY, 0, 0);
+  EXPECT_EQ(Gia_ManLevelNum(pNew), 1000000);
+  ExpectSameOutputs(p, pNew);
+  Gia_ManStop(pNew);
+  Gia_ManStop(p);
+}
+
+class GiaSimTest : public AbcTest {};
+
+TEST_F(GiaSimTest, TiledSimulationMatchesSerialSimulation) {
+  Gen("-N 16 -m");
+  Gia_Man_t* p = Current();
+  // an odd number of words, so that the last tile is shorter
+  int nWords = 37;
+  Vec_Wrd_t* vSimsPi = Vec_WrdStartRandom(Gia_ManCiNum(p) * nWords);
+  Vec_Wrd_t* vSims = Gia_ManSimPatSimOut(p, vSimsPi, 0);
+  int Configs[4][2] = {{0, 1}, {1, 1}, {5, 4}, {3, 8}};
+  Gia_Obj_t* pObj;
+  int i, k;
+  for (k = 0; k < 4; k++) {
+    Vec_Wrd_t* vSimsCo =
+        Gia_ManSimPatSimOutTiled(p, vSimsPi, Configs[k][0], Configs[k][1], 0);
+    ASSERT_EQ(Vec_WrdSize(vSimsCo), Gia_ManCoNum(p) * nWords);
+    Gia_ManForEachCo(p, pObj, i)
+      EXPECT_EQ(memcmp(Vec_WrdEntryP(vSimsCo, i * nWords),
+                       Vec_WrdEntryP(vSims, Gia_ObjId(p, pObj) * nWords),
+                       sizeof(word) * nWords), 0)
+          << "tile words " << Configs[k][0] << ", threads " << Configs[k][1]
+          << ", output " << i;
+    Vec_WrdFree(vSimsCo);
+  }
+  Vec_WrdFree(vSims);
+  Vec_WrdFree(vSimsPi);
+  Gia_ManStop(p);
+}
+
+TEST_F(GiaSimTest, TooManySimulationThreadsAreRejected) {
+  Gen("-N 8 -m", "&get -n");
+  EXPECT_EQ(Cmd_CommandExecute(abc, "&sim_read -t -P 4"), 0);
+  EXPECT_NE(Cmd_CommandExecute(abc, "&sim_read -t -P 101"), 0);
+}
+
 ABC_NAMESPACE_IMPL_END
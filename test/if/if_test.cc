@@ -0,0 +1,232 @@
+#include "abc_test.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+#include "map/if/if.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class IfCacheTest : public AbcTest {
+ protected:
+  // maps a multiplier or an adder of the given width into 6-input LUT
+  // structures, returns the number of mapped nodes
+  int Map(const std::string& gen, const std::string& cache) {
+    std::string script = "if -K 6 -S 33";
+    if (!cache.empty()) script += " -L " + cache;
+    Gen(gen, script);
+    return Abc_NtkNodeNum(Ntk());
+  }
+
+  // returns the number of entries in the cache file or -1 if the header
+  // is not the current one; the integers are little-endian
+  static int ReadInt(FILE* pFile) {
+    unsigned char pBytes[4];
+    if (fread(pBytes, 4, 1, pFile) != 1) return -1;
+    return pBytes[0] | (pBytes[1] << 8) | (pBytes[2] << 16) | (pBytes[3] << 24);
+  }
+  static int CountEntries(const std::string& cache) {
+    FILE* pFile = fopen(cache.c_str(), "rb");
+    char pMagic[4], pSign[1000];
+    int nEntries = 0;
+    if (pFile == nullptr) return -1;
+    if (fread(pMagic, 4, 1, pFile) != 1 || strncmp(pMagic, "IFTC", 4) ||
+        ReadInt(pFile) != 2) {
+      fclose(pFile);
+      return -1;
+    }
+    int nSign = ReadInt(pFile);
+    EXPECT_EQ(fread(pSign, nSign, 1, pFile), 1u);
+    // the truth tables of cuts with up to 6 inputs take one word
+    for (int v = 0; v <= 6; v++) {
+      int n = ReadInt(pFile);
+      for (int i = 0; i < n; i++) {
+        ReadInt(pFile);
+        fseek(pFile, 8, SEEK_CUR);
+      }
+      nEntries += n;
+    }
+    fclose(pFile);
+    return nEntries;
+  }
+};
+
+TEST_F(IfCacheTest, WarmCacheGivesTheSameMapping) {
+  std::string cache = Path("warm.cache");
+  remove(cache.c_str());
+  int nNodes = Map("-N 8 -m", "");
+  EXPECT_EQ(Map("-N 8 -m", cache), nNodes);
+  EXPECT_GT(CountEntries(cache), 0);
+  EXPECT_EQ(Map("-N 8 -m", cache), nNodes);
+}
+
+#ifndef _WIN32
+TEST_F(IfCacheTest, CacheFileHasUsualPermissions) {
+  std::string cache = Path("mode.cache");
+  struct stat Stat;
+  mode_t Mask = umask(022);
+  remove(cache.c_str());
+  Map("-N 8 -m", cache);
+  umask(Mask);
+  ASSERT_EQ(stat(cache.c_str(), &Stat), 0);
+  EXPECT_EQ(Stat.st_mode & 0777, 0644u);
+}
+#endif
+
+TEST_F(IfCacheTest, SavingMergesEntriesOfOtherRuns) {
+  std::string cacheA = Path("a.cache"), cacheB = Path("b.cache");
+  remove(cacheA.c_str());
+  remove(cacheB.c_str());
+  Map("-N 8 -m", cacheA);
+  Map("-N 16 -a", cacheB);
+  int nEntriesA = CountEntries(cacheA), nEntriesB = CountEntries(cacheB);
+  ASSERT_GT(nEntriesA, 0);
+  ASSERT_GT(nEntriesB, 0);
+  // the adder run saving into the multiplier's cache keeps its entries
+  Map("-N 16 -a", cacheA);
+  EXPECT_GE(CountEntries(cacheA), nEntriesA);
+  EXPECT_GE(CountEntries(cacheA), nEntriesB);
+}
+
+TEST_F(IfCacheTest, UnusableCacheIsReplaced) {
+  std::string cache = Path("old.cache"), cacheRef = Path("ref.cache");
+  remove(cacheRef.c_str());
+  FILE* pFile = fopen(cache.c_str(), "wb");
+  fputs("ift1 not a cache in the current format", pFile);
+  fclose(pFile);
+  Map("-N 8 -m", cacheRef);
+  Map("-N 8 -m", cache);
+  EXPECT_EQ(CountEntries(cache), CountEntries(cacheRef));
+}
+
+class IfCutTest : public ::testing::Test {
+ protected:
+  static const int nLimit = 6;
+
+  void TearDown() override {
+    for (If_Cut_t* pCut : cuts) free(pCut);
+  }
+
+  // returns a new cut with the given leaves sorted
+  If_Cut_t* NewCut(std::vector<int> leaves) {
+    If_Cut_t* pCut =
+        (If_Cut_t*)calloc(1, sizeof(If_Cut_t) + sizeof(int) * nLimit);
+    std::sort(leaves.begin(), leaves.end());
+    pCut->nLimit = nLimit;
+    pCut->nLeaves = leaves.size();
+    std::copy(leaves.begin(), leaves.end(), pCut->pLeaves);
+    pCut->uSign = If_ObjCutSignCompute(pCut);
+    cuts.push_back(pCut);
+    return pCut;
+  }
+
+  // returns up to nLimit distinct random leaves among nIds IDs, which are
+  // spaced so that the signature bits of different leaves often coincide
+  static std::vector<int> RandomLeaves(int nIds) {
+    std::vector<int> leaves;
+    int nLeaves = Abc_Random(0) % (nLimit + 1);
+    while ((int)leaves.size() < nLeaves) {
+      int Leaf = (Abc_Random(0) % nIds) * 21;
+      if (std::find(leaves.begin(), leaves.end(), Leaf) == leaves.end())
+        leaves.push_back(Leaf);
+    }
+    std::sort(leaves.begin(), leaves.end());
+    return leaves;
+  }
+
+  static std::vector<int> Leaves(If_Cut_t* pCut) {
+    return std::vector<int>(pCut->pLeaves, pCut->pLeaves + pCut->nLeaves);
+  }
+
+  std::vector<If_Cut_t*> cuts;
+};
+
+TEST_F(IfCutTest, MergingGivesSortedUnionOfLeaves) {
+  If_Cut_t* pCut = NewCut({});
+  Abc_Random(1);
+  for (int n = 0; n < 20000; n++) {
+    std::vector<int> leaves0 = RandomLeaves(20), leaves1 = RandomLeaves(20);
+    // the cuts of the same size sometimes have the same leaves
+    if (n % 10 == 0) leaves1 = leaves0;
+    If_Cut_t* pCut0 = NewCut(leaves0);
+    If_Cut_t* pCut1 = NewCut(leaves1);
+    std::vector<int> leaves;
+    std::set_union(leaves0.begin(), leaves0.end(), leaves1.begin(),
+                   leaves1.end(), std::back_inserter(leaves));
+    int RetValue = If_CutMergeOrdered(NULL, pCut0, pCut1, pCut);
+    ASSERT_EQ(RetValue, (int)leaves.size() <= nLimit);
+    if (RetValue) {
+      EXPECT_EQ(Leaves(pCut), leaves);
+      EXPECT_EQ(pCut->uSign, If_ObjCutSignCompute(pCut));
+    }
+    cuts.pop_back(), free(pCut1);
+    cuts.pop_back(), free(pCut0);
+  }
+}
+
+TEST_F(IfCutTest, FilteringKeepsOnlyNonDominatedCuts) {
+  int nDominated = 0, nRemoved = 0;
+  Abc_Random(1);
+  for (int fOrdered = 0; fOrdered <= 1; fOrdered++) {
+    for (int n = 0; n < 200; n++) {
+      // the cut set with the cuts in the order in which they are kept
+      std::vector<If_Cut_t*> storage;
+      std::vector<std::vector<int>> kept;
+      for (int i = 0; i <= 64; i++) storage.push_back(NewCut({}));
+      If_Set_t Set;
+      Set.nCutsMax = 64;
+      Set.nCuts = 0;
+      Set.ppCuts = storage.data();
+      for (int i = 0; i < 300 && Set.nCuts < 64; i++) {
+        std::vector<int> leaves = RandomLeaves(12);
+        if (leaves.size() < 2) continue;
+        If_Cut_t* pCut = Set.ppCuts[Set.nCuts];
+        pCut->nLeaves = leaves.size();
+        std::copy(leaves.begin(), leaves.end(), pCut->pLeaves);
+        pCut->uSign = If_ObjCutSignCompute(pCut);
+        // the cuts with more leaves that contain the new cut are removed;
+        // the new cut is dropped if it contains one of the other cuts
+        int fDominated = 0;
+        std::vector<std::vector<int>> expected;
+        for (const std::vector<int>& other : kept) {
+          if (fDominated) {
+            expected.push_back(other);
+            continue;
+          }
+          if (other.size() > leaves.size()) {
+            if (!std::includes(other.begin(), other.end(), leaves.begin(),
+                               leaves.end()))
+              expected.push_back(other);
+            continue;
+          }
+          expected.push_back(other);
+          fDominated = std::includes(leaves.begin(), leaves.end(),
+                                     other.begin(), other.end());
+        }
+        int RetValue = If_CutFilter(&Set, pCut, 0, fOrdered);
+        ASSERT_EQ(RetValue, fDominated);
+        ASSERT_EQ(Set.ppCuts[Set.nCuts], pCut);
+        if (!RetValue) {
+          Set.nCuts++;
+          expected.push_back(leaves);
+        }
+        nDominated += RetValue;
+        nRemoved += kept.size() + !RetValue - expected.size();
+        kept = expected;
+        ASSERT_EQ(Set.nCuts, (int)kept.size());
+        for (int k = 0; k < Set.nCuts; k++)
+          ASSERT_EQ(Leaves(Set.ppCuts[k]), kept[k]);
+      }
+    }
+  }
+  EXPECT_GT(nDominated, 0);
+  EXPECT_GT(nRemoved, 0);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,72 @@
+#include "abc_test.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class MapperTest : public AbcTest {
+ protected:
+  // maps the multiplier with the current supergate library
+  std::string Map() {
+    Gen("-N 8 -m", "map");
+    return Gates(Ntk());
+  }
+
+  // writes the file with the given contents
+  static void Write(const std::string& file, const std::string& contents) {
+    FILE* pFile = fopen(file.c_str(), "wb");
+    fwrite(contents.data(), 1, contents.size(), pFile);
+    fclose(pFile);
+  }
+
+  // returns the position of the first supergate in the binary library,
+  // which follows the header, the version, the name of the genlib library,
+  // its hash, and three numbers
+  static size_t FirstSupergate(const std::string& contents) {
+    size_t i = contents.find('\0') + 1 + 4;
+    i = contents.find('\0', i) + 1 + 4;
+    for (int k = 0; k < 3; k++)
+      while (contents[i++] & 0x80)
+        ;
+    return i;
+  }
+};
+
+TEST_F(MapperTest, BinaryLibraryGivesSameMapping) {
+  std::string super = Path("a.super");
+  Run("read_genlib " + WriteGenlib("a.genlib"));
+  Gen("-N 8 -m");
+  Gia_Man_t* spec = Current();
+  std::string derived = Map();
+  ExpectEquivalent(spec, Current());
+  Run("write_super " + super);
+  Run("read_super " + super);
+  EXPECT_EQ(Map(), derived);
+  // the library written from the loaded one is the same
+  std::string contents = Contents(super);
+  Run("write_super " + super);
+  EXPECT_TRUE(Contents(super) == contents);
+}
+
+TEST_F(MapperTest, CorruptedBinaryLibraryIsDerivedAgain) {
+  std::string super = Path("a.super"), bad = Path("bad.super");
+  Run("read_genlib " + WriteGenlib("a.genlib"));
+  std::string derived = Map();
+  Run("write_super " + super);
+  std::string contents = Contents(super);
+
+  // the first supergate refers to the gate -1
+  std::string negative = contents;
+  negative.replace(FirstSupergate(contents), 1, "\xFF\xFF\xFF\xFF\x0F");
+  Write(bad, negative);
+  Run("read_super " + bad);
+  EXPECT_EQ(Map(), derived);
+
+  // the second half of the file is overwritten
+  std::string truncated = contents;
+  for (size_t i = contents.size() / 2; i < contents.size(); i++)
+    truncated[i] = '\xFF';
+  Write(bad, truncated);
+  Run("read_super " + bad);
+  EXPECT_EQ(Map(), derived);
+}
+
+ABC_NAMESPACE_IMPL_END
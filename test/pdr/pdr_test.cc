@@ -0,0 +1,79 @@
+#include "abc_test.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class PdrTest : public AbcTest {
+ protected:
+  // writes two copies of an n-bit counter with the same enable input;
+  // the property says that the counters are equal, and, if fBug is set,
+  // that the first counter never reaches 20
+  static std::string WriteCounters(int n, int fBug) {
+    std::string file = Path("counters.blif");
+    FILE* pFile = fopen(file.c_str(), "w");
+    int i;
+    fprintf(pFile, ".model counters\n.inputs en\n.outputs bad\n");
+    for (const char* c : {"a", "b"}) {
+      fprintf(pFile, ".names en %sc0\n1 1\n", c);
+      for (i = 0; i < n; i++) {
+        fprintf(pFile, ".latch %sn%d %s%d 0\n", c, i, c, i);
+        fprintf(pFile, ".names %s%d %sc%d %sn%d\n10 1\n01 1\n", c, i, c, i, c, i);
+        fprintf(pFile, ".names %s%d %sc%d %sc%d\n11 1\n", c, i, c, i, c, i + 1);
+      }
+    }
+    for (i = 0; i < n; i++)
+      fprintf(pFile, ".names a%d b%d d%d\n10 1\n01 1\n", i, i, i);
+    if (fBug)
+      fprintf(pFile, ".names a2 a4 d%d\n11 1\n", n);
+    else
+      fprintf(pFile, ".names d%d\n", n);
+    fprintf(pFile, ".names");
+    for (i = 0; i <= n; i++) fprintf(pFile, " d%d", i);
+    fprintf(pFile, " bad\n");
+    for (i = 0; i <= n; i++)
+      fprintf(pFile, "%s1%s 1\n", std::string(i, '-').c_str(),
+              std::string(n - i, '-').c_str());
+    fprintf(pFile, ".end\n");
+    fclose(pFile);
+    return file;
+  }
+
+  // returns the contents of the file without the comment lines, which
+  // include the time when the file was written
+  static std::string ContentsNoComments(const std::string& file) {
+    std::string contents = Contents(file), result;
+    size_t i = 0, k;
+    for (; i < contents.size(); i = k + 1) {
+      if ((k = contents.find('\n', i)) == std::string::npos)
+        k = contents.size();
+      if (contents[i] != '#') result += contents.substr(i, k + 1 - i);
+    }
+    return result;
+  }
+};
+
+TEST_F(PdrTest, TernaryFilterGivesSameInvariant) {
+  // the cubes have 48 flops, so the filter is used in ternary lifting
+  std::string file = WriteCounters(24, 0);
+  std::string inv = Path("filtered.pla"), invBase = Path("baseline.pla");
+  Run("read " + file + "; strash; pdr -d -I " + inv);
+  EXPECT_EQ(Abc_FrameReadProbStatus(abc), 1);
+  Run("read " + file + "; strash; pdr -b -d -I " + invBase);
+  EXPECT_EQ(Abc_FrameReadProbStatus(abc), 1);
+  EXPECT_FALSE(ContentsNoComments(inv).empty());
+  EXPECT_EQ(ContentsNoComments(inv), ContentsNoComments(invBase));
+}
+
+TEST_F(PdrTest, TernaryFilterGivesSameCounterExample) {
+  std::string file = WriteCounters(24, 1);
+  Run("read " + file + "; strash; pdr");
+  EXPECT_EQ(Abc_FrameReadProbStatus(abc), 0);
+  ASSERT_TRUE(Abc_FrameReadCex(abc) != NULL);
+  int iFrame = ((Abc_Cex_t*)Abc_FrameReadCex(abc))->iFrame;
+  EXPECT_EQ(iFrame, 20);
+  Run("read " + file + "; strash; pdr -b");
+  EXPECT_EQ(Abc_FrameReadProbStatus(abc), 0);
+  ASSERT_TRUE(Abc_FrameReadCex(abc) != NULL);
+  EXPECT_EQ(((Abc_Cex_t*)Abc_FrameReadCex(abc))->iFrame, iFrame);
+}
+
+ABC_NAMESPACE_IMPL_END
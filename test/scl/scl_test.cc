@@ -0,0 +1,277 @@
+#include "abc_test.h"
+
+#include <chrono>
+#include <cstdio>
+
+#include "map/scl/sclSize.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class SclTest : public AbcTest {
+ protected:
+  // writes a Liberty library with inverters, buffers, NAND2 and NOR2 gates
+  // in three sizes; the intrinsic delays and slews are multiplied by Scale
+  // and their dependence on the load by LoadScale; the cells are repeated
+  // nCopies times with larger areas
+  std::string WriteLib(const std::string& name, double Scale,
+                       double LoadScale = 1.0, const char* pLibName = "t",
+                       int nCopies = 1) {
+    std::string file = Path(name);
+    FILE* pFile = fopen(file.c_str(), "w");
+    const char* pNames[4] = {"INV", "BUF", "NAND2", "NOR2"};
+    const char* pFuncs[4] = {"!A", "A", "!(A&B)", "!(A|B)"};
+    const char* pTables[4] = {"cell_rise", "cell_fall", "rise_transition",
+                              "fall_transition"};
+    double Slews[3] = {0.01, 0.1, 0.5}, Loads[3] = {1, 10, 50};
+    fprintf(pFile, "library(%s) {\n  time_unit : \"1ns\";\n", pLibName);
+    fprintf(pFile, "  capacitive_load_unit (1,ff);\n");
+    fprintf(pFile, "  lu_table_template(tmpl) {\n");
+    fprintf(pFile, "    variable_1 : input_net_transition;\n");
+    fprintf(pFile, "    variable_2 : total_output_net_capacitance;\n");
+    fprintf(pFile, "    index_1(\"0.01, 0.1, 0.5\");\n");
+    fprintf(pFile, "    index_2(\"1, 10, 50\");\n  }\n");
+    for (int k = 0; k < nCopies; k++)
+    for (int c = 0; c < 4; c++)
+      for (int Size = 1; Size <= 4; Size *= 2) {
+        int nInputs = c < 2 ? 1 : 2;
+        if (k == 0)
+          fprintf(pFile, "  cell(%s_X%d) {\n", pNames[c], Size);
+        else
+          fprintf(pFile, "  cell(%s_X%d_%d) {\n", pNames[c], Size, k);
+        fprintf(pFile, "    area : %d;\n", Size * nInputs + k);
+        for (int i = 0; i < nInputs; i++)
+          fprintf(pFile, "    pin(%c) { direction : input; capacitance : %.1f; }\n",
+                  'A' + i, 1.5 * Size);
+        fprintf(pFile, "    pin(Y) {\n      direction : output;\n");
+        fprintf(pFile, "      function : \"%s\";\n", pFuncs[c]);
+        for (int i = 0; i < nInputs; i++) {
+          fprintf(pFile, "      timing() {\n        related_pin : \"%c\";\n",
+                  'A' + i);
+          fprintf(pFile, "        timing_sense : %s;\n",
+                  c == 1 ? "positive_unate" : "negative_unate");
+          for (int t = 0; t < 4; t++) {
+            fprintf(pFile, "        %s(tmpl) { values(", pTables[t]);
+            for (int s = 0; s < 3; s++) {
+              fprintf(pFile, "%s\"", s ? ", " : "");
+              for (int l = 0; l < 3; l++)
+                fprintf(pFile, "%s%.4f", l ? ", " : "",
+                        Scale * (0.02 - 0.002 * t + 0.2 * Slews[s]) +
+                            LoadScale * 0.004 * Loads[l] / Size);
+              fprintf(pFile, "\"");
+            }
+            fprintf(pFile, "); }\n");
+          }
+          fprintf(pFile, "      }\n");
+        }
+        fprintf(pFile, "    }\n  }\n");
+      }
+    fprintf(pFile, "}\n");
+    fclose(pFile);
+    return file;
+  }
+
+  SC_Lib* ReadLib(const std::string& file) {
+    SC_DontUse dont_use = {0};
+    return Abc_SclReadLiberty((char*)file.c_str(), 0, 0, dont_use);
+  }
+
+  // reads the library with the given number of threads and returns its
+  // binary representation
+  std::string ReadLibBinary(const std::string& file, int nProcs,
+                            int fUseCache = 0, int fVerbose = 0) {
+    SC_DontUse dont_use = {0};
+    std::string binary = Path("lib.scl");
+    SC_Lib* pLib = Abc_SclReadLibertyPar((char*)file.c_str(), fVerbose, 0,
+                                         dont_use, nProcs, fUseCache);
+    EXPECT_TRUE(pLib != NULL);
+    if (pLib == NULL) return "";
+    Abc_SclWriteScl((char*)binary.c_str(), pLib);
+    Abc_SclLibFree(pLib);
+    return Contents(binary);
+  }
+
+  // maps an 8x8 multiplier with the gates of the given library
+  Abc_Ntk_t* Map(const std::string& lib) {
+    Run("read_lib " + lib);
+    Gen("-N 8 -m", "map; topo");
+    return Ntk();
+  }
+
+  // returns the max delay of the network, keeping the timing manager with
+  // the network the way the sizing commands do
+  // (the worst delay across the corners when the library has corners)
+  float Delay(SC_Lib* pLib, Abc_Ntk_t* pNtk, int fRestored) {
+    if (!fRestored) Abc_SclManStoredFree(pNtk);
+    EXPECT_EQ(pNtk->pSclMan != NULL, fRestored);
+    SC_Man* p = Abc_SclManStart(pLib, pNtk, 0, 1, 0, 0);
+    float Delay = p->nCorners ? p->MaxDelayC : p->MaxDelay0;
+    Abc_SclManStore(p, 1);
+    return Delay;
+  }
+};
+
+TEST_F(SclTest, RestoredTimingMatchesRecomputedTiming) {
+  Abc_Ntk_t* pNtk = Map(WriteLib("a.lib", 1.0));
+  SC_Lib* pLib = (SC_Lib*)Abc_FrameReadLibScl();
+  Delay(pLib, pNtk, 0);
+  // the sizing commands change the gates in place and keep their timing
+  Run("upsize; dnsize");
+  ASSERT_EQ(Abc_FrameReadNtk(abc), pNtk);
+  float Restored = Delay(pLib, pNtk, 1);
+  EXPECT_FLOAT_EQ(Restored, Delay(pLib, pNtk, 0));
+}
+
+TEST_F(SclTest, TimingIsRecomputedForAnotherLibrary) {
+  std::string fileB = WriteLib("b.lib", 2.0);
+  Abc_Ntk_t* pNtk = Map(WriteLib("a.lib", 1.0));
+  SC_Lib* pLib = ReadLib(Path("a.lib"));
+  SC_Lib* pLibB = ReadLib(fileB);
+  SC_Lib Temp;
+  float Fast = Delay(pLib, pNtk, 0);
+  // the slower library takes the address of the first one, the way a library
+  // read after freeing the first one may do
+  Temp = *pLib, *pLib = *pLibB, *pLibB = Temp;
+  float Restored = Delay(pLib, pNtk, 1);
+  EXPECT_GT(Restored, Fast);
+  EXPECT_FLOAT_EQ(Restored, Delay(pLib, pNtk, 0));
+  Abc_SclManStoredFree(pNtk);
+  Abc_SclLibFree(pLibB);
+  Abc_SclLibFree(pLib);
+}
+
+TEST_F(SclTest, CornerTimingMatchesRecomputedTiming) {
+  std::string fileC = WriteLib("c.lib", 0.5, 6.0, "c");
+  Abc_Ntk_t* pNtk = Map(WriteLib("a.lib", 1.0));
+  std::string script = "read_lib -a " + fileC;
+  ASSERT_EQ(Cmd_CommandExecute(abc, script.c_str()), 0);
+  SC_Lib* pLib = (SC_Lib*)Abc_FrameReadLibScl();
+  ASSERT_EQ(SC_LibCornerNum(pLib), 1);
+  float Before = Delay(pLib, pNtk, 0);
+  Run("upsize -P 2");
+  ASSERT_EQ(Abc_FrameReadNtk(abc), pNtk);
+  float Restored = Delay(pLib, pNtk, 1);
+  // the corner is the slowest one, so upsizing has to reduce its delay
+  EXPECT_LT(Restored, Before);
+  EXPECT_FLOAT_EQ(Restored, Delay(pLib, pNtk, 0));
+}
+
+TEST_F(SclTest, ConcurrentUpsizingMatchesSerialUpsizing) {
+  std::string lib = WriteLib("a.lib", 1.0);
+  Abc_Ntk_t* pNtk = Map(lib);
+  std::string before = Gates(pNtk);
+  Run("upsize -P 1");
+  std::string serial = Gates(Ntk());
+  EXPECT_NE(serial, before);
+  for (int nProcs = 2; nProcs <= 8; nProcs *= 2) {
+    Map(lib);
+    Run("upsize -P " + std::to_string(nProcs));
+    EXPECT_EQ(Gates(Ntk()), serial) << nProcs << " threads";
+  }
+}
+
+TEST_F(SclTest, TooManyUpsizingThreadsAreRejected) {
+  Map(WriteLib("a.lib", 1.0));
+  EXPECT_NE(Cmd_CommandExecute(abc, "upsize -P 0"), 0);
+  EXPECT_NE(Cmd_CommandExecute(abc, "upsize -P 101"), 0);
+}
+
+TEST_F(SclTest, CornersAreKeptWhenLibraryIsRead) {
+  std::string fileC = WriteLib("c.lib", 0.5, 6.0, "c");
+  std::string fileB = WriteLib("b.lib", 2.0);
+  std::string script = "read_lib " + WriteLib("a.lib", 1.0) + "; read_lib -a " +
+                       fileC + "; read_lib " + fileB;
+  ASSERT_EQ(Cmd_CommandExecute(abc, script.c_str()), 0);
+  SC_Lib* pLib = (SC_Lib*)Abc_FrameReadLibScl();
+  ASSERT_EQ(SC_LibCornerNum(pLib), 1);
+  EXPECT_STREQ(SC_LibCorner(pLib, 0)->pName, "c");
+}
+
+TEST_F(SclTest, ConcurrentParsingMatchesSerialParsing) {
+  // the library is large enough to be parsed by several threads
+  std::string lib = WriteLib("big.lib", 1.0, 1.0, "t", 120);
+  std::string serial = ReadLibBinary(lib, 1);
+  EXPECT_GT(serial.size(), 0u);
+  for (int nProcs = 2; nProcs <= 8; nProcs *= 2)
+    EXPECT_TRUE(ReadLibBinary(lib, nProcs) == serial) << nProcs << " threads";
+}
+
+TEST_F(SclTest, TooManyParsingThreadsAreRejected) {
+  std::string lib = WriteLib("a.lib", 1.0);
+  EXPECT_NE(Cmd_CommandExecute(abc, ("read_lib -P 0 " + lib).c_str()), 0);
+  EXPECT_NE(Cmd_CommandExecute(abc, ("read_lib -P 101 " + lib).c_str()), 0);
+  Run("read_lib -P 100 " + lib);
+}
+
+TEST_F(SclTest, CachedLibraryIsReusedAndInvalidated) {
+  std::string lib = WriteLib("a.lib", 1.0), cache = lib + ".scl_cache";
+  remove(cache.c_str());
+  std::string parsed = ReadLibBinary(lib, 1);
+
+  // the first reading writes the cache with the key and the size in the
+  // little-endian byte order
+  EXPECT_TRUE(ReadLibBinary(lib, 1, 1) == parsed);
+  std::string contents = Contents(cache);
+  ASSERT_GT(contents.size(), 16u);
+  EXPECT_EQ(contents.substr(0, 4), "scc1");
+  unsigned nSize = 0;
+  for (int i = 0; i < 4; i++)
+    nSize |= (unsigned)(unsigned char)contents[12 + i] << (8 * i);
+  EXPECT_EQ(nSize, contents.size() - 16);
+
+  // the second reading loads the library from the cache
+  ::testing::internal::CaptureStdout();
+  EXPECT_TRUE(ReadLibBinary(lib, 1, 1, 1) == parsed);
+  EXPECT_NE(::testing::internal::GetCapturedStdout().find("loaded from cache"),
+            std::string::npos);
+  EXPECT_TRUE(Contents(cache) == contents);
+
+  // the changed library is parsed again and the cache is rewritten
+  WriteLib("a.lib", 2.0);
+  std::string changed = ReadLibBinary(lib, 1);
+  EXPECT_TRUE(changed != parsed);
+  ::testing::internal::CaptureStdout();
+  EXPECT_TRUE(ReadLibBinary(lib, 1, 1, 1) == changed);
+  EXPECT_EQ(::testing::internal::GetCapturedStdout().find("loaded from cache"),
+            std::string::npos);
+  EXPECT_TRUE(Contents(cache) != contents);
+  EXPECT_TRUE(ReadLibBinary(lib, 1, 1) == changed);
+}
+
+TEST_F(SclTest, HighFanoutNetIsBufferedQuickly) {
+  // one internal node drives 100k gates, each with its own output
+  const int nFanouts = 100000;
+  std::string file = Path("fanout.blif");
+  FILE* pFile = fopen(file.c_str(), "w");
+  fprintf(pFile, ".model fanout\n.inputs a b");
+  for (int i = 0; i < nFanouts; i++) fprintf(pFile, " c%d", i);
+  fprintf(pFile, "\n.outputs");
+  for (int i = 0; i < nFanouts; i++) fprintf(pFile, " y%d", i);
+  fprintf(pFile, "\n.names a b x\n11 1\n");
+  for (int i = 0; i < nFanouts; i++)
+    fprintf(pFile, ".names x c%d y%d\n11 1\n", i, i);
+  fprintf(pFile, ".end\n");
+  fclose(pFile);
+  Run("read_lib " + WriteLib("a.lib", 1.0) + "; read " + file);
+  Gia_Man_t* spec = Current();
+  Run("map; topo");
+
+  // the tree of the net is built in O(n log n) instead of O(n^2), which
+  // took more than half a minute on this net
+  auto start = std::chrono::steady_clock::now();
+  Run("buffer -N 3");
+  double Seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start).count();
+  EXPECT_LT(Seconds, 10.0);
+
+  // the nodes drive at most the given number of fanouts
+  Abc_Obj_t* pObj;
+  int i, nBufs = 0;
+  Abc_NtkForEachNode(Ntk(), pObj, i) {
+    EXPECT_LE(Abc_ObjFanoutNum(pObj), 3) << Abc_ObjName(pObj);
+    nBufs += Abc_ObjFaninNum(pObj) == 1;
+  }
+  EXPECT_GE(nBufs, nFanouts / 3);
+  ExpectEquivalent(spec, Current());
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,79 @@
+#include "abc_test.h"
+
+#include <cstdlib>
+
+ABC_NAMESPACE_IMPL_START
+
+class SfmTest : public AbcTest {
+ protected:
+  // maps a 12x12 multiplier into 4-input LUTs and runs the commands
+  void Map(const std::string& commands) {
+    Gen("-N 12 -m", "if -K 4; " + commands);
+  }
+
+  int Nodes() { return Abc_NtkNodeNum(Ntk()); }
+  int Edges() { return Abc_NtkGetTotalFanins(Ntk()); }
+  int Levels() { return Abc_NtkLevel(Ntk()); }
+
+  // runs the commands printing the summary of "mfs2 -v" and returns
+  // the number of SAT calls given there
+  int SatCalls(const std::string& commands) {
+    ::testing::internal::CaptureStdout();
+    Map(commands);
+    std::string output = ::testing::internal::GetCapturedStdout();
+    size_t pos = output.find("SAT calls = ");
+    EXPECT_NE(pos, std::string::npos) << output;
+    return pos == std::string::npos ? -1 : atoi(output.c_str() + pos + 12);
+  }
+};
+
+TEST_F(SfmTest, ConcurrentResubIsEquivalent) {
+  Map("");
+  int nNodes = Nodes();
+  Gia_Man_t* spec = Current();
+  Map("mfs2 -P 4");
+  EXPECT_LT(Nodes(), nNodes);
+  ExpectEquivalent(spec, Current());
+}
+
+TEST_F(SfmTest, ConcurrentResubDoesNotDependOnThreads) {
+  Map("mfs2 -P 2");
+  int nNodes = Nodes(), nEdges = Edges();
+  Map("mfs2 -P 8");
+
+  EXPECT_EQ(Nodes(), nNodes);
+  EXPECT_EQ(Edges(), nEdges);
+}
+
+TEST_F(SfmTest, ConcurrentResubKeepsLevelLimit) {
+  Map("");
+  int nLevels = Levels();
+  Map("mfs2 -P 4 -L 0");
+  EXPECT_LE(Levels(), nLevels);
+  Map("mfs2 -P 4 -L 1");
+  EXPECT_LE(Levels(), nLevels + 1);
+}
+
+TEST_F(SfmTest, PatternPoolFilterSavesSatCalls) {
+  Map("");
+  Gia_Man_t* spec = Current();
+  int nCallsBase = SatCalls("mfs2 -s -v");
+  int nNodesBase = Nodes();
+  ExpectEquivalent(Gia_ManDup(spec), Current());
+
+  // the divisors failing on the known patterns are not tried, so the other
+  // divisors are reached before the limit on the number of tries
+  int nCalls = SatCalls("mfs2 -v");
+  EXPECT_GT(nCalls, 0);
+  EXPECT_LT(nCalls, nCallsBase);
+  EXPECT_LT(Nodes(), nNodesBase);
+  ExpectEquivalent(spec, Current());
+}
+
+TEST_F(SfmTest, TooManyThreadsAreRejected) {
+  Map("");
+  EXPECT_NE(Cmd_CommandExecute(abc, "mfs2 -P 101"), 0);
+  EXPECT_NE(Cmd_CommandExecute(abc, "&get -m; &mfs -P 101"), 0);
+}
+
+ABC_NAMESPACE_IMPL_END
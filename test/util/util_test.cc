@@ -0,0 +1,119 @@
+#include "abc_test.h"
+
+#include <vector>
+
+#include "misc/util/utilSimd.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class SimdTest : public AbcTest {
+ protected:
+  static const int nWordsMax = 40;
+
+  // the results of all kernels for the given number of words
+  struct Results {
+    std::vector<word> And[4], Xor[2], Copy[2];
+    int Equal[2][2];
+    unsigned Hash[2];
+  };
+
+  word Random() {
+    Seed = Seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return Seed ^ (Seed >> 29);
+  }
+
+  // runs the kernels on the inputs
+  Results Compute(int nWords) {
+    Results r;
+    for (int c = 0; c < 4; c++) {
+      r.And[c].assign(nWords, 0);
+      Abc_SimdAndInt(r.And[c].data(), In0.data(), In1.data(), c & 1, c >> 1,
+                     nWords);
+    }
+    for (int c = 0; c < 2; c++) {
+      r.Xor[c].assign(nWords, 0);
+      r.Copy[c].assign(nWords, 0);
+      Abc_SimdXorInt(r.Xor[c].data(), In0.data(), In1.data(), c, nWords);
+      Abc_SimdCopyInt(r.Copy[c].data(), In0.data(), c, nWords);
+      r.Hash[c] = Abc_SimdHashInt(In0.data(), c, nWords);
+    }
+    // compares the input with itself, its copy, and a different one
+    std::vector<word> Same(In0), Compl(In0);
+    for (int w = 0; w < nWords; w++) Compl[w] = ~Compl[w];
+    r.Equal[0][0] = Abc_SimdEqualInt(In0.data(), Same.data(), 0, nWords);
+    r.Equal[0][1] = Abc_SimdEqualInt(In0.data(), Compl.data(), 1, nWords);
+    r.Equal[1][0] = Abc_SimdEqualInt(In0.data(), In1.data(), 0, nWords);
+    r.Equal[1][1] = Abc_SimdEqualInt(In0.data(), Compl.data(), 0, nWords);
+    return r;
+  }
+
+  static void ExpectEqual(const Results& a, const Results& b) {
+    for (int c = 0; c < 4; c++) EXPECT_EQ(a.And[c], b.And[c]);
+    for (int c = 0; c < 2; c++) {
+      EXPECT_EQ(a.Xor[c], b.Xor[c]);
+      EXPECT_EQ(a.Copy[c], b.Copy[c]);
+      EXPECT_EQ(a.Hash[c], b.Hash[c]);
+      for (int k = 0; k < 2; k++) EXPECT_EQ(a.Equal[c][k], b.Equal[c][k]);
+    }
+  }
+
+  std::vector<word> In0, In1;
+  word Seed = 1;
+};
+
+TEST_F(SimdTest, VectorKernelsMatchScalarKernels) {
+  int Level = Abc_SimdLevel();
+  if (Level == ABC_SIMD_NONE) GTEST_SKIP() << "no vector instructions";
+  for (int nWords = 1; nWords <= nWordsMax; nWords++) {
+    In0.resize(nWords);
+    In1.resize(nWords);
+    for (int w = 0; w < nWords; w++) In0[w] = Random();
+    // the inputs differ in the last word, so that the vector comparison
+    // has to look at the words processed by the scalar tail
+    for (int w = 0; w < nWords; w++)
+      In1[w] = w < nWords - 1 ? In0[w] : Random();
+    std::vector<Results> All;
+    for (int l = Level; l >= ABC_SIMD_NONE; l--) {
+      Abc_SimdSetLevel(l);
+      EXPECT_EQ(Abc_SimdLevel(), l);
+      All.push_back(Compute(nWords));
+    }
+    Abc_SimdSetLevel(Level);
+    for (size_t l = 1; l < All.size(); l++) {
+      SCOPED_TRACE("level " + std::to_string(Level - (int)l) + ", " +
+                   std::to_string(nWords) + " words");
+      ExpectEqual(All[0], All[l]);
+    }
+    EXPECT_EQ(All.back().Equal[0][0], 1);
+    EXPECT_EQ(All.back().Equal[0][1], 1);
+    EXPECT_EQ(All.back().Equal[1][0], 0);
+    EXPECT_EQ(All.back().Equal[1][1], 0);
+  }
+}
+
+TEST_F(SimdTest, LevelCannotExceedDetectedLevel) {
+  int Level = Abc_SimdLevel();
+  EXPECT_EQ(Abc_SimdSetLevel(ABC_SIMD_AVX512 + 1), Level);
+  EXPECT_EQ(Abc_SimdLevel(), Level);
+  EXPECT_EQ(Abc_SimdSetLevel(ABC_SIMD_NONE), Level);
+  EXPECT_EQ(Abc_SimdLevel(), ABC_SIMD_NONE);
+  Abc_SimdSetLevel(Level);
+}
+
+TEST_F(SimdTest, SimulationDoesNotDependOnLevel) {
+  int Level = Abc_SimdLevel();
+  // &fraig -y simulates with the default number of words
+  Gen("-N 12 -m");
+  Gia_Man_t* spec = Current();
+  Run("&get -n; &fraig -y; &put");
+  Gia_Man_t* pVector = Current();
+  Abc_SimdSetLevel(ABC_SIMD_NONE);
+  Gen("-N 12 -m", "&get -n; &fraig -y; &put");
+  Abc_SimdSetLevel(Level);
+  Gia_Man_t* pScalar = Current();
+  EXPECT_EQ(Gia_ManAndNum(pVector), Gia_ManAndNum(pScalar));
+  Gia_ManStop(pScalar);
+  ExpectEquivalent(spec, pVector);
+}
+
+ABC_NAMESPACE_IMPL_END